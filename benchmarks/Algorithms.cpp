@@ -0,0 +1,94 @@
+// Part of WardenSTL - https://github.com/WardenHD/WardenSTL
+// Copyright (c) 2025 Artem Bezruchko (WardenHD)
+//
+// Licensed under the MIT License. See LICENSE file for details.
+
+#include "Benchmarks.hpp"
+#include <wstl/Algorithm.hpp>
+#include <wstl/Numeric.hpp>
+#include <wstl/RadixSort.hpp>
+#include <wstl/Span.hpp>
+#include <wstl/Ranges.hpp>
+
+using namespace wstl;
+using namespace wstl::bench;
+
+static const size_t ElementCount = 4096;
+
+static uint32_t Input[ElementCount];
+static uint32_t Values[ElementCount];
+static uint32_t Scratch[ElementCount];
+static float Samples[ElementCount];
+static int16_t Signal[ElementCount];
+static int16_t Taps[ElementCount];
+
+void RunAlgorithmBenchmarks(BenchmarkRunner& runner) {
+    BenchmarkRandom random;
+    for(size_t i = 0; i < ElementCount; ++i) {
+        Input[i] = random();
+        Samples[i] = static_cast<float>(Input[i] % 1024) / 256;
+        Signal[i] = static_cast<int16_t>(Input[i]);
+        Taps[i] = static_cast<int16_t>(Input[i] >> 16);
+    }
+
+    runner.Run("algorithm/sort/random/4096", [] {
+        Copy(Input, Input + ElementCount, Values);
+        Sort(Values, Values + ElementCount);
+        ClobberMemory();
+    });
+
+    runner.Run("algorithm/stable_sort/random/4096", [] {
+        Copy(Input, Input + ElementCount, Values);
+        StableSort(Values, Values + ElementCount);
+        ClobberMemory();
+    });
+
+    runner.Run("algorithm/radix_sort/random/4096", [] {
+        Copy(Input, Input + ElementCount, Values);
+        RadixSort(Values, Values + ElementCount, Span<uint32_t>(Scratch, ElementCount));
+        ClobberMemory();
+    });
+
+    runner.Run("algorithm/nth_element/random/4096", [] {
+        Copy(Input, Input + ElementCount, Values);
+        NthElement(Values, Values + ElementCount / 2, Values + ElementCount);
+        ClobberMemory();
+    });
+
+    Copy(Input, Input + ElementCount, Values);
+    Sort(Values, Values + ElementCount);
+
+    runner.Run("algorithm/lower_bound/4096", [] {
+        static BenchmarkRandom keys;
+        uint32_t* position = LowerBound(Values, Values + ElementCount, keys());
+        DoNotOptimize(position);
+    });
+
+    runner.Run("numeric/accumulate/float/4096", [] {
+        float sum = Accumulate(Samples, Samples + ElementCount, 0.0f);
+        DoNotOptimize(sum);
+    });
+
+    runner.Run("numeric/reduce/float/4096", [] {
+        float sum = Reduce(Samples, Samples + ElementCount, 0.0f);
+        DoNotOptimize(sum);
+    });
+
+    runner.Run("numeric/inner_product/int16/4096", [] {
+        int32_t sum = InnerProduct(Signal, Signal + ElementCount, Taps, int32_t(0));
+        DoNotOptimize(sum);
+    });
+
+    runner.Run("ranges/filter_transform_sum/staged/4096", [] {
+        uint32_t* last = CopyIf(Input, Input + ElementCount, Scratch, [](uint32_t x) { return (x & 1) != 0; });
+        Transform(Scratch, last, Scratch, [](uint32_t x) { return x >> 4; });
+        uint32_t sum = Accumulate(Scratch, last, 0U);
+        DoNotOptimize(sum);
+    });
+
+    runner.Run("ranges/filter_transform_sum/view/4096", [] {
+        auto view = Input | Filter([](uint32_t x) { return (x & 1) != 0; }) | Transform([](uint32_t x) { return x >> 4; });
+        uint32_t sum = Accumulate(view.Begin(), view.End(), 0U);
+        DoNotOptimize(sum);
+    });
+}
@@ -0,0 +1,59 @@
+// Part of WardenSTL - https://github.com/WardenHD/WardenSTL
+// Copyright (c) 2025 Artem Bezruchko (WardenHD)
+//
+// Licensed under the MIT License. See LICENSE file for details.
+
+#include "Benchmarks.hpp"
+#include <wstl/BumpAllocator.hpp>
+#include <wstl/SlabAllocator.hpp>
+#include <wstl/TLSFAllocator.hpp>
+#include <wstl/Pool.hpp>
+
+using namespace wstl;
+using namespace wstl::bench;
+
+static const size_t ElementCount = 256;
+static const size_t ArenaSize = 64 * 1024;
+
+// Shared by the allocators, each one is only used while its own benchmark runs
+alignas(64) static uint8_t Arena[ArenaSize];
+
+static void* Blocks[ElementCount];
+static size_t Sizes[ElementCount];
+
+/// @brief Allocates blocks of mixed sizes and frees them in a shuffled order
+static void Churn(Allocator& allocator) {
+    for(size_t i = 0; i < ElementCount; ++i) Blocks[i] = allocator.Allocate(Sizes[i]);
+    for(size_t i = 0; i < ElementCount; ++i) allocator.Free(Blocks[(i * 97) % ElementCount]);
+    ClobberMemory();
+}
+
+struct PoolItem {
+    uint64_t Words[4];
+};
+
+void RunAllocatorBenchmarks(BenchmarkRunner& runner) {
+    BenchmarkRandom random;
+    for(size_t i = 0; i < ElementCount; ++i) Sizes[i] = 8 + random() % 121;
+
+    static BumpAllocator bump(Arena, ArenaSize);
+    runner.Run("allocator/bump/256", [] {
+        for(size_t i = 0; i < ElementCount; ++i) Blocks[i] = bump.Allocate(Sizes[i]);
+        bump.Reset();
+        ClobberMemory();
+    });
+
+    static SlabAllocator<> slab(Arena, ArenaSize);
+    runner.Run("allocator/slab/churn/256", [] { Churn(slab); });
+
+    static TLSFAllocator tlsf(Arena, ArenaSize);
+    runner.Run("allocator/tlsf/churn/256", [] { Churn(tlsf); });
+
+    static IntrusivePool<PoolItem, ElementCount> pool;
+    runner.Run("allocator/intrusive_pool/256", [] {
+        PoolItem* items[ElementCount];
+        for(size_t i = 0; i < ElementCount; ++i) items[i] = pool.Allocate();
+        for(size_t i = 0; i < ElementCount; ++i) pool.Release(items[(i * 97) % ElementCount]);
+        ClobberMemory();
+    });
+}
@@ -0,0 +1,34 @@
+// Part of WardenSTL - https://github.com/WardenHD/WardenSTL
+// Copyright (c) 2025 Artem Bezruchko (WardenHD)
+//
+// Licensed under the MIT License. See LICENSE file for details.
+
+#ifndef __WSTL_BENCHMARKS_HPP__
+#define __WSTL_BENCHMARKS_HPP__
+
+#include <wstl/Benchmark.hpp>
+
+typedef wstl::bench::Runner<wstl::bench::DefaultCounter> BenchmarkRunner;
+
+/// @brief Small xorshift generator, so every run measures the same inputs
+class BenchmarkRandom {
+public:
+    explicit BenchmarkRandom(uint32_t seed = 2463534242u) : m_State(seed) {}
+
+    uint32_t operator()() {
+        m_State ^= m_State << 13;
+        m_State ^= m_State >> 17;
+        m_State ^= m_State << 5;
+        return m_State;
+    }
+
+private:
+    uint32_t m_State;
+};
+
+void RunAlgorithmBenchmarks(BenchmarkRunner& runner);
+void RunHasherBenchmarks(BenchmarkRunner& runner);
+void RunContainerBenchmarks(BenchmarkRunner& runner);
+void RunAllocatorBenchmarks(BenchmarkRunner& runner);
+
+#endif
\ No newline at end of file
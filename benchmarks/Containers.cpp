@@ -0,0 +1,174 @@
+// Part of WardenSTL - https://github.com/WardenHD/WardenSTL
+// Copyright (c) 2025 Artem Bezruchko (WardenHD)
+//
+// Licensed under the MIT License. See LICENSE file for details.
+
+#include "Benchmarks.hpp"
+#include <wstl/Vector.hpp>
+#include <wstl/Deque.hpp>
+#include <wstl/HashMap.hpp>
+#include <wstl/FlatMap.hpp>
+#include <wstl/PriorityQueue.hpp>
+#include <wstl/SoAArray.hpp>
+#include <wstl/PerfectHashMap.hpp>
+#include <wstl/StringView.hpp>
+#include <wstl/CompressedBitmap.hpp>
+#include <wstl/Algorithm.hpp>
+
+using namespace wstl;
+using namespace wstl::bench;
+
+static const size_t ElementCount = 1024;
+
+static uint32_t Keys[ElementCount];
+
+static Vector<uint32_t, ElementCount> VectorInstance;
+static Deque<uint32_t, ElementCount> DequeInstance;
+static Deque<uint8_t, 4096> ByteDequeInstance;
+static uint8_t Payload[256];
+static HashMap<uint32_t, uint32_t, 2 * ElementCount> HashMapInstance;
+static FlatMap<uint32_t, uint32_t, ElementCount> FlatMapInstance;
+static PriorityQueue<uint32_t, ElementCount, Less<uint32_t>, 2> BinaryHeapInstance;
+static PriorityQueue<uint32_t, ElementCount, Less<uint32_t>, 4> QuaternaryHeapInstance;
+
+struct TrackRecord {
+    uint32_t Timestamp;
+    float X, Y, Z;
+    uint32_t Identifier;
+};
+
+static Array<TrackRecord, ElementCount> TrackRecords;
+static SoAArray<ElementCount, uint32_t, float, float, float, uint32_t> TrackColumns;
+
+static const size_t CommandCount = 16;
+
+static __WSTL_CONSTEXPR14__ Pair<StringView, uint32_t> Commands[CommandCount] = {
+    { "help", 0 }, { "version", 1 }, { "reset", 2 }, { "reboot", 3 },
+    { "status", 4 }, { "log", 5 }, { "get", 6 }, { "set", 7 },
+    { "erase", 8 }, { "write", 9 }, { "read", 10 }, { "dump", 11 },
+    { "ping", 12 }, { "time", 13 }, { "sleep", 14 }, { "wake", 15 }
+};
+
+static __WSTL_CONSTEXPR14__ PerfectHashMap<StringView, uint32_t, CommandCount> CommandMap(Commands);
+
+// IDs spread over 64 chunks of 65536, 16 per chunk
+static const uint32_t BitmapRange = 64UL << 16;
+
+static CompressedBitmap<64, 512> BitmapInstance;
+static CompressedBitmap<64, 512> OtherBitmapInstance;
+
+void RunContainerBenchmarks(BenchmarkRunner& runner) {
+    BenchmarkRandom random;
+    for(size_t i = 0; i < ElementCount; ++i) Keys[i] = random();
+
+    runner.Run("container/vector/push_back/1024", [] {
+        VectorInstance.Clear();
+        for(size_t i = 0; i < ElementCount; ++i) VectorInstance.PushBack(Keys[i]);
+        ClobberMemory();
+    });
+
+    runner.Run("container/deque/push_back_pop_front/1024", [] {
+        for(size_t i = 0; i < ElementCount; ++i) DequeInstance.PushBack(Keys[i]);
+        for(size_t i = 0; i < ElementCount; ++i) DequeInstance.PopFront();
+        ClobberMemory();
+    });
+
+    runner.Run("container/deque/insert_range_middle/256", [] {
+        ByteDequeInstance.Clear();
+        for(size_t i = 0; i < 8; ++i) ByteDequeInstance.InsertRange(ByteDequeInstance.Begin() + ByteDequeInstance.Size() / 2, Payload);
+        ClobberMemory();
+    });
+
+    runner.Run("container/hash_map/insert/1024", [] {
+        HashMapInstance.Clear();
+        for(size_t i = 0; i < ElementCount; ++i) HashMapInstance.Insert(MakePair(Keys[i], uint32_t(i)));
+        ClobberMemory();
+    });
+
+    runner.Run("container/hash_map/find/1024", [] {
+        size_t found = 0;
+        for(size_t i = 0; i < ElementCount; ++i) found += HashMapInstance.Find(Keys[i]) != HashMapInstance.End();
+        DoNotOptimize(found);
+    });
+
+    runner.Run("container/flat_map/insert/1024", [] {
+        FlatMapInstance.Clear();
+        for(size_t i = 0; i < ElementCount; ++i) FlatMapInstance.Insert(MakePair(Keys[i], uint32_t(i)));
+        ClobberMemory();
+    });
+
+    runner.Run("container/flat_map/find/1024", [] {
+        size_t found = 0;
+        for(size_t i = 0; i < ElementCount; ++i) found += FlatMapInstance.Find(Keys[i]) != FlatMapInstance.End();
+        DoNotOptimize(found);
+    });
+
+    runner.Run("container/priority_queue/binary/push_pop/1024", [] {
+        for(size_t i = 0; i < ElementCount; ++i) BinaryHeapInstance.Push(Keys[i]);
+        for(size_t i = 0; i < ElementCount; ++i) BinaryHeapInstance.Pop();
+        ClobberMemory();
+    });
+
+    runner.Run("container/priority_queue/quaternary/push_pop/1024", [] {
+        for(size_t i = 0; i < ElementCount; ++i) QuaternaryHeapInstance.Push(Keys[i]);
+        for(size_t i = 0; i < ElementCount; ++i) QuaternaryHeapInstance.Pop();
+        ClobberMemory();
+    });
+
+    for(size_t i = 0; i < ElementCount; ++i) {
+        const TrackRecord record = { Keys[i], float(i), float(i), float(i), uint32_t(i) };
+        TrackRecords[i] = record;
+        TrackColumns[i] = MakeTuple(record.Timestamp, record.X, record.Y, record.Z, record.Identifier);
+    }
+
+    runner.Run("container/array_of_structs/count_if/1024", [] {
+        DoNotOptimize(CountIf(TrackRecords.Begin(), TrackRecords.End(), [](const TrackRecord& record) {
+            return record.Timestamp < 0x80000000U;
+        }));
+    });
+
+    runner.Run("container/soa_array/count_if/1024", [] {
+        Span<uint32_t, ElementCount> timestamps = TrackColumns.Column<0>();
+        DoNotOptimize(CountIf(timestamps.Begin(), timestamps.End(), [](uint32_t timestamp) {
+            return timestamp < 0x80000000U;
+        }));
+    });
+
+    runner.Run("container/linear_search/string_find/16", [] {
+        uint32_t sum = 0;
+        for(size_t i = 0; i < CommandCount; ++i) {
+            const StringView name = Commands[(i * 7) % CommandCount].First;
+            for(size_t j = 0; j < CommandCount; ++j) {
+                if(Commands[j].First == name) {
+                    sum += Commands[j].Second;
+                    break;
+                }
+            }
+        }
+        DoNotOptimize(sum);
+    });
+
+    runner.Run("container/perfect_hash_map/string_find/16", [] {
+        uint32_t sum = 0;
+        for(size_t i = 0; i < CommandCount; ++i) sum += *CommandMap.Find(Commands[(i * 7) % CommandCount].First);
+        DoNotOptimize(sum);
+    });
+
+    for(size_t i = 0; i < ElementCount; i += 2) OtherBitmapInstance.Insert(Keys[i] % BitmapRange);
+
+    runner.Run("container/compressed_bitmap/insert/1024", [] {
+        BitmapInstance.Clear();
+        for(size_t i = 0; i < ElementCount; ++i) BitmapInstance.Insert(Keys[i] % BitmapRange);
+        ClobberMemory();
+    });
+
+    runner.Run("container/compressed_bitmap/contains/1024", [] {
+        size_t found = 0;
+        for(size_t i = 0; i < ElementCount; ++i) found += BitmapInstance.Contains(Keys[i] % BitmapRange);
+        DoNotOptimize(found);
+    });
+
+    runner.Run("container/compressed_bitmap/and_cardinality/1024", [] {
+        DoNotOptimize(BitmapInstance.AndCardinality(OtherBitmapInstance));
+    });
+}
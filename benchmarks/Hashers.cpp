@@ -0,0 +1,53 @@
+// Part of WardenSTL - https://github.com/WardenHD/WardenSTL
+// Copyright (c) 2025 Artem Bezruchko (WardenHD)
+//
+// Licensed under the MIT License. See LICENSE file for details.
+
+#include "Benchmarks.hpp"
+#include <wstl/CRC.hpp>
+#include <wstl/hash/FNV1.hpp>
+#include <wstl/hash/Murmur3.hpp>
+#include <wstl/hash/WyHash.hpp>
+
+using namespace wstl;
+using namespace wstl::bench;
+
+static const size_t BlockSize = 4096;
+static const size_t KeySize = 64;
+
+static uint8_t Bytes[BlockSize];
+
+template<typename Hasher>
+static void HashBlock() {
+    Hasher hasher;
+    hasher.Append(Bytes, BlockSize);
+
+    typename Hasher::HashType value = hasher.Value();
+    DoNotOptimize(value);
+}
+
+// Hashes the block as 64-byte keys, like the keys of a hash container
+static void HashKeysFNV1a() {
+    uint64_t sum = 0;
+    for(size_t i = 0; i < BlockSize; i += KeySize) sum += hash::FNV1a_64(Bytes + i, Bytes + i + KeySize);
+    DoNotOptimize(sum);
+}
+
+static void HashKeysWyHash() {
+    uint64_t sum = 0;
+    for(size_t i = 0; i < BlockSize; i += KeySize) sum += hash::WyHash::Hash(Bytes + i, KeySize);
+    DoNotOptimize(sum);
+}
+
+void RunHasherBenchmarks(BenchmarkRunner& runner) {
+    BenchmarkRandom random;
+    for(size_t i = 0; i < BlockSize; ++i) Bytes[i] = static_cast<uint8_t>(random());
+
+    runner.Run("hash/crc32/4096", HashBlock<crc::CRC32_ISOHDLC>);
+    runner.Run("hash/fnv1a_32/4096", HashBlock<hash::FNV1a<uint32_t> >);
+    runner.Run("hash/fnv1a_64/4096", HashBlock<hash::FNV1a<uint64_t> >);
+    runner.Run("hash/murmur3_32/4096", HashBlock<hash::Murmur3<uint32_t> >);
+    runner.Run("hash/wyhash/4096", HashBlock<hash::WyHash>);
+    runner.Run("hash/fnv1a_64/keys_64x64", HashKeysFNV1a);
+    runner.Run("hash/wyhash/keys_64x64", HashKeysWyHash);
+}
@@ -0,0 +1,23 @@
+// Part of WardenSTL - https://github.com/WardenHD/WardenSTL
+// Copyright (c) 2025 Artem Bezruchko (WardenHD)
+//
+// Licensed under the MIT License. See LICENSE file for details.
+
+#include "Benchmarks.hpp"
+#include <stdio.h>
+
+static void WriteLine(const char* text, size_t size) {
+    fwrite(text, 1, size, stdout);
+    fflush(stdout);
+}
+
+int main() {
+    BenchmarkRunner runner(WriteLine);
+
+    RunAlgorithmBenchmarks(runner);
+    RunHasherBenchmarks(runner);
+    RunContainerBenchmarks(runner);
+    RunAllocatorBenchmarks(runner);
+
+    return 0;
+}
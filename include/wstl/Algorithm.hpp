@@ -6,10 +6,20 @@
 #ifndef __WSTL_ALGORITHM_HPP__
 #define __WSTL_ALGORITHM_HPP__
 
+#include "private/Platform.hpp"
 #include "Iterator.hpp"
 #include "Utility.hpp"
 #include "Functional.hpp"
 #include "InitializerList.hpp"
+#include "NullPointer.hpp"
+#include "TypeTraits.hpp"
+#include "Instrumentation.hpp"
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __WSTL_LIBC_WRAPPERS__
+#include <string.h>
+#endif
 
 
 /// @defgroup algorithm Algorithm
@@ -286,6 +296,19 @@ namespace wstl {
         return last;
     }
 
+    /// @brief Searches for the first occurence of a sequence in a range using a searcher
+    /// @param first Iterator to the beginning of the range
+    /// @param last Iterator to the end of the range
+    /// @param searcher Searcher object that holds the sequence, see `Searcher.hpp`
+    /// @return Iterator to the first occurence of the sequence
+    /// @ingroup algorithm
+    /// @see https://en.cppreference.com/w/cpp/algorithm/search
+    template<typename ForwardIterator, typename Searcher>
+    __WSTL_NODISCARD__ __WSTL_CONSTEXPR14__
+    inline ForwardIterator Search(ForwardIterator first, ForwardIterator last, const Searcher& searcher) {
+        return searcher(first, last).First;
+    }
+
     // Search in range
 
     /// @brief Searches for the first occurence of N consecutive copies of an element in a range
@@ -478,9 +501,158 @@ namespace wstl {
         return last;
     }
 
+    // Bitwise operations
+
+    namespace __private {
+        /// @brief Checks whether a range can be copied into another one with `memmove`
+        template<typename InputIterator, typename OutputIterator>
+        struct __IsBitwiseCopyable : FalseType {};
+
+        template<typename T>
+        struct __IsBitwiseCopyable<T*, T*> : BoolConstant<IsTriviallyCopyable<T>::Value && !IsConst<T>::Value && !IsVolatile<T>::Value> {};
+
+        template<typename T>
+        struct __IsBitwiseCopyable<const T*, T*> : __IsBitwiseCopyable<T*, T*> {};
+
+        /// @brief Checks whether two ranges can be compared for equality with `memcmp`
+        template<typename InputIterator1, typename InputIterator2>
+        struct __IsBitwiseComparable : FalseType {};
+
+        template<typename T>
+        struct __IsBitwiseComparable<T*, T*> : BoolConstant<(IsIntegral<T>::Value || IsPointer<T>::Value) && !IsVolatile<T>::Value> {};
+
+        template<typename T>
+        struct __IsBitwiseComparable<const T*, T*> : __IsBitwiseComparable<T*, T*> {};
+
+        template<typename T>
+        struct __IsBitwiseComparable<T*, const T*> : __IsBitwiseComparable<T*, T*> {};
+
+        /// @brief Checks whether a range can be filled with `memset`
+        template<typename Iterator>
+        struct __IsBitwiseFillable : FalseType {};
+
+        template<typename T>
+        struct __IsBitwiseFillable<T*> : BoolConstant<IsIntegral<T>::Value && sizeof(T) == 1 && !IsConst<T>::Value && !IsVolatile<T>::Value> {};
+
+        /// @brief Machine word that may alias any other type, used for word-at-a-time loops
+        #if defined(__WSTL_GCC__) || defined(__WSTL_CLANG__)
+        typedef size_t __attribute__((__may_alias__)) __AliasWord;
+        #else
+        typedef size_t __AliasWord;
+        #endif
+
+        static const __WSTL_CONSTEXPR__ size_t __WORD_SIZE = sizeof(__AliasWord);
+
+        inline bool __IsWordAligned(const void* pointer) {
+            return (reinterpret_cast<uintptr_t>(pointer) % __WORD_SIZE) == 0;
+        }
+
+        inline bool __IsSameAlignment(const void* a, const void* b) {
+            return ((reinterpret_cast<uintptr_t>(a) ^ reinterpret_cast<uintptr_t>(b)) % __WORD_SIZE) == 0;
+        }
+
+        /// @brief Copies bytes between possibly overlapping ranges
+        /// @details Empty ranges may come with null pointers, which `memmove` must not be given
+        inline void __MemoryMove(void* destination, const void* source, size_t size) {
+            if(size == 0) return;
+
+            #ifdef __WSTL_LIBC_WRAPPERS__
+            memmove(destination, source, size);
+            #else
+            unsigned char* d = static_cast<unsigned char*>(destination);
+            const unsigned char* s = static_cast<const unsigned char*>(source);
+            if(d == s) return;
+
+            bool words = __IsSameAlignment(d, s);
+
+            if(reinterpret_cast<uintptr_t>(d) < reinterpret_cast<uintptr_t>(s)) {
+                if(words) {
+                    for(; size > 0 && !__IsWordAligned(d); --size) *d++ = *s++;
+
+                    for(; size >= __WORD_SIZE; size -= __WORD_SIZE, d += __WORD_SIZE, s += __WORD_SIZE) 
+                        *reinterpret_cast<__AliasWord*>(d) = *reinterpret_cast<const __AliasWord*>(s);
+                }
+
+                for(; size > 0; --size) *d++ = *s++;
+            }
+            else {
+                d += size;
+                s += size;
+
+                if(words) {
+                    for(; size > 0 && !__IsWordAligned(d); --size) *--d = *--s;
+
+                    for(; size >= __WORD_SIZE; size -= __WORD_SIZE) {
+                        d -= __WORD_SIZE;
+                        s -= __WORD_SIZE;
+                        *reinterpret_cast<__AliasWord*>(d) = *reinterpret_cast<const __AliasWord*>(s);
+                    }
+                }
+
+                for(; size > 0; --size) *--d = *--s;
+            }
+            #endif
+        }
+
+        /// @brief Checks whether two byte ranges are equal
+        inline bool __MemoryEqual(const void* first1, const void* first2, size_t size) {
+            #ifdef __WSTL_LIBC_WRAPPERS__
+            return memcmp(first1, first2, size) == 0;
+            #else
+            const unsigned char* a = static_cast<const unsigned char*>(first1);
+            const unsigned char* b = static_cast<const unsigned char*>(first2);
+
+            if(__IsSameAlignment(a, b)) {
+                for(; size > 0 && !__IsWordAligned(a); --size) if(*a++ != *b++) return false;
+
+                for(; size >= __WORD_SIZE; size -= __WORD_SIZE, a += __WORD_SIZE, b += __WORD_SIZE) 
+                    if(*reinterpret_cast<const __AliasWord*>(a) != *reinterpret_cast<const __AliasWord*>(b)) return false;
+            }
+
+            for(; size > 0; --size) if(*a++ != *b++) return false;
+            return true;
+            #endif
+        }
+
+        /// @brief Sets all bytes of a range to a value
+        inline void __MemorySet(void* destination, unsigned char value, size_t size) {
+            #ifdef __WSTL_LIBC_WRAPPERS__
+            memset(destination, value, size);
+            #else
+            unsigned char* d = static_cast<unsigned char*>(destination);
+            for(; size > 0 && !__IsWordAligned(d); --size) *d++ = value;
+
+            const __AliasWord pattern = static_cast<__AliasWord>(~__AliasWord(0) / 0xFFU) * value;
+            for(; size >= __WORD_SIZE; size -= __WORD_SIZE, d += __WORD_SIZE) *reinterpret_cast<__AliasWord*>(d) = pattern;
+
+            for(; size > 0; --size) *d++ = value;
+            #endif
+        }
+    }
+
     // Copy
 
+    namespace __private {
+        template<typename InputIterator, typename OutputIterator>
+        __WSTL_CONSTEXPR14__
+        OutputIterator __Copy(InputIterator first, InputIterator last, OutputIterator resultFirst, FalseType) {
+            for(; first != last; ++first, ++resultFirst) *resultFirst = *first;
+            return resultFirst;
+        }
+
+        template<typename T, typename U>
+        __WSTL_CONSTEXPR14__
+        U* __Copy(T* first, T* last, U* resultFirst, TrueType) {
+            if(__WSTL_IS_CONSTANT_EVALUATED__()) return __Copy(first, last, resultFirst, FalseType());
+
+            const size_t count = static_cast<size_t>(last - first);
+            __MemoryMove(resultFirst, first, count * sizeof(U));
+            return resultFirst + count;
+        }
+    }
+
     /// @brief Copies elements from one range to another
+    /// @details Ranges of trivially copyable types given by pointers are copied with `memmove`
     /// @param first Iterator to the beginning of the source range
     /// @param last Iterator to the end of the source range
     /// @param resultFirst Iterator to the beginning of the destination range
@@ -490,8 +662,7 @@ namespace wstl {
     template<typename InputIterator, typename OutputIterator>
     __WSTL_CONSTEXPR14__
     OutputIterator Copy(InputIterator first, InputIterator last, OutputIterator resultFirst) {
-        for(; first != last; ++first, ++resultFirst) *resultFirst = *first;
-        return resultFirst;
+        return __private::__Copy(first, last, resultFirst, __private::__IsBitwiseCopyable<InputIterator, OutputIterator>());
     }
 
     // Copy if
@@ -513,7 +684,24 @@ namespace wstl {
 
     // Copy in range
 
+    namespace __private {
+        template<typename InputIterator, typename Size, typename OutputIterator>
+        __WSTL_CONSTEXPR14__
+        OutputIterator __CopyInRange(InputIterator first, Size count, OutputIterator resultFirst, FalseType) {
+            if(count > 0) for(Size i = 0; i != count; ++i, ++resultFirst, ++first) *resultFirst = *first; 
+            return resultFirst;
+        }
+
+        template<typename T, typename Size, typename U>
+        __WSTL_CONSTEXPR14__
+        U* __CopyInRange(T* first, Size count, U* resultFirst, TrueType) {
+            if(count <= 0) return resultFirst;
+            return __Copy(first, first + count, resultFirst, TrueType());
+        }
+    }
+
     /// @brief Copies N elements from one range to another
+    /// @details Ranges of trivially copyable types given by pointers are copied with `memmove`
     /// @param first Iterator to the beginning of the source range
     /// @param count Number of elements to copy
     /// @param resultFirst Iterator to the beginning of the destination range
@@ -523,27 +711,61 @@ namespace wstl {
     template<typename InputIterator, typename Size, typename OutputIterator>
     __WSTL_CONSTEXPR14__
     OutputIterator CopyInRange(InputIterator first, Size count, OutputIterator resultFirst) {
-        if(count > 0) for(Size i = 0; i != count; ++i, ++resultFirst, ++first) *resultFirst = *first; 
-        return resultFirst;
+        return __private::__CopyInRange(first, count, resultFirst, __private::__IsBitwiseCopyable<InputIterator, OutputIterator>());
     }
 
     // Copy backward
 
+    namespace __private {
+        template<typename BidirectionalIterator1, typename BidirectionalIterator2>
+        __WSTL_CONSTEXPR14__
+        BidirectionalIterator2 __CopyBackward(BidirectionalIterator1 first, BidirectionalIterator1 last, BidirectionalIterator2 resultLast, FalseType) {
+            while(first != last) *--resultLast = *--last;
+            return resultLast;
+        }
+
+        template<typename T, typename U>
+        __WSTL_CONSTEXPR14__
+        U* __CopyBackward(T* first, T* last, U* resultLast, TrueType) {
+            if(__WSTL_IS_CONSTANT_EVALUATED__()) return __CopyBackward(first, last, resultLast, FalseType());
+
+            const size_t count = static_cast<size_t>(last - first);
+            __MemoryMove(resultLast - count, first, count * sizeof(U));
+            return resultLast - count;
+        }
+    }
+
     /// @brief Copies elements from one range to another in reversed order
     /// @param first Iterator to the beginning of the source range
     /// @param last Iterator to the end of the source range
     /// @param resultLast Iterator to the beginning of the destination range
     /// @return Output iterator to the last element copied
+    /// @details Ranges of trivially copyable types given by pointers are copied with `memmove`
     template<typename BidirectionalIterator1, typename BidirectionalIterator2>
     __WSTL_CONSTEXPR14__
     BidirectionalIterator2 CopyBackward(BidirectionalIterator1 first, BidirectionalIterator1 last, BidirectionalIterator2 resultLast) {
-        while(first != last) *--resultLast = *--last;
-        return resultLast;
+        return __private::__CopyBackward(first, last, resultLast, __private::__IsBitwiseCopyable<BidirectionalIterator1, BidirectionalIterator2>());
     }
 
     // Move
 
+    namespace __private {
+        template<typename InputIterator, typename OutputIterator>
+        __WSTL_CONSTEXPR14__
+        OutputIterator __Move(InputIterator first, InputIterator last, OutputIterator resultFirst, FalseType) {
+            for(; first != last; ++first, ++resultFirst) *resultFirst = __WSTL_MOVE__(*first);
+            return resultFirst;
+        }
+
+        template<typename T, typename U>
+        __WSTL_CONSTEXPR14__
+        inline U* __Move(T* first, T* last, U* resultFirst, TrueType) {
+            return __Copy(first, last, resultFirst, TrueType());
+        }
+    }
+
     /// @brief Moves elements from one range to another
+    /// @details Ranges of trivially copyable types given by pointers are copied with `memmove`
     /// @param first Iterator to the beginning of the source range
     /// @param last Iterator to the end of the source range
     /// @param resultFirst Iterator to the beginning of the destination range
@@ -553,13 +775,28 @@ namespace wstl {
     template<typename InputIterator, typename OutputIterator>
     __WSTL_CONSTEXPR14__
     OutputIterator Move(InputIterator first, InputIterator last, OutputIterator resultFirst) {
-        for(; first != last; ++first, ++resultFirst) *resultFirst = __WSTL_MOVE__(*first);
-        return resultFirst;
+        return __private::__Move(first, last, resultFirst, __private::__IsBitwiseCopyable<InputIterator, OutputIterator>());
     }
 
     // Move backward
 
+    namespace __private {
+        template<typename BidirectionalIterator1, typename BidirectionalIterator2>
+        __WSTL_CONSTEXPR14__
+        BidirectionalIterator2 __MoveBackward(BidirectionalIterator1 first, BidirectionalIterator1 last, BidirectionalIterator2 resultLast, FalseType) {
+            while(first != last) *--resultLast = __WSTL_MOVE__(*--last);
+            return resultLast;
+        }
+
+        template<typename T, typename U>
+        __WSTL_CONSTEXPR14__
+        inline U* __MoveBackward(T* first, T* last, U* resultLast, TrueType) {
+            return __CopyBackward(first, last, resultLast, TrueType());
+        }
+    }
+
     /// @brief Moves elements from one range to another in reversed order
+    /// @details Ranges of trivially copyable types given by pointers are copied with `memmove`
     /// @param first Iterator to the beginning of the source range
     /// @param last Iterator to the end of the source range
     /// @param resultLast Iterator to the beginning of the destination range
@@ -569,13 +806,28 @@ namespace wstl {
     template<typename BidirectionalIterator1, typename BidirectionalIterator2>
     __WSTL_CONSTEXPR14__
     BidirectionalIterator2 MoveBackward(BidirectionalIterator1 first, BidirectionalIterator1 last, BidirectionalIterator2 resultLast) {
-        while(first != last) *--resultLast = __WSTL_MOVE__(*--last);
-        return resultLast;
+        return __private::__MoveBackward(first, last, resultLast, __private::__IsBitwiseCopyable<BidirectionalIterator1, BidirectionalIterator2>());
     }
 
     // Fill
 
+    namespace __private {
+        template<typename ForwardIterator, typename T>
+        __WSTL_CONSTEXPR14__ 
+        void __Fill(ForwardIterator first, ForwardIterator last, const T& value, FalseType) {
+            for(; first != last; ++first) *first = value;
+        }
+
+        template<typename U, typename T>
+        __WSTL_CONSTEXPR14__ 
+        void __Fill(U* first, U* last, const T& value, TrueType) {
+            if(__WSTL_IS_CONSTANT_EVALUATED__()) __Fill(first, last, value, FalseType());
+            else __MemorySet(first, static_cast<unsigned char>(static_cast<U>(value)), static_cast<size_t>(last - first));
+        }
+    }
+
     /// @brief Fills a range with a specific value
+    /// @details Pointer ranges of byte-sized integral types are filled with `memset`
     /// @param first Iterator to the beginning of the range
     /// @param last Iterator to the end of the range
     /// @param value Value to fill the range with
@@ -584,12 +836,31 @@ namespace wstl {
     template<typename ForwardIterator, typename T>
     __WSTL_CONSTEXPR14__ 
     void Fill(ForwardIterator first, ForwardIterator last, const T& value) {
-        for(; first != last; ++first) *first = value;
+        __private::__Fill(first, last, value, __private::__IsBitwiseFillable<ForwardIterator>());
     }
 
     // Fill in range
 
+    namespace __private {
+        template<typename OutputIterator, typename Size, typename T>
+        __WSTL_CONSTEXPR14__ 
+        OutputIterator __FillInRange(OutputIterator first, Size count, const T& value, FalseType) {
+            if(count > 0) for(Size i = 0; i < count; ++i, ++first) *first = value;
+            return first;
+        }
+
+        template<typename U, typename Size, typename T>
+        __WSTL_CONSTEXPR14__ 
+        U* __FillInRange(U* first, Size count, const T& value, TrueType) {
+            if(count <= 0) return first;
+
+            __Fill(first, first + count, value, TrueType());
+            return first + count;
+        }
+    }
+
     /// @brief Fills N elements in a range with a specific value
+    /// @details Pointer ranges of byte-sized integral types are filled with `memset`
     /// @param first Iterator to the beginning of the range
     /// @param count Number of elements to fill
     /// @param value Value to fill the range with
@@ -598,8 +869,7 @@ namespace wstl {
     template<typename OutputIterator, typename Size, typename T>
     __WSTL_CONSTEXPR14__ 
     OutputIterator FillInRange(OutputIterator first, Size count, const T& value) {
-        if(count > 0) for(Size i = 0; i < count; ++i, ++first) *first = value;
-        return first;
+        return __private::__FillInRange(first, count, value, __private::__IsBitwiseFillable<OutputIterator>());
     }
 
     // Transform
@@ -1408,6 +1678,40 @@ namespace wstl {
 
     // Equal
 
+    namespace __private {
+        template<typename InputIterator1, typename InputIterator2>
+        __WSTL_CONSTEXPR14__
+        bool __Equal(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, FalseType) {
+            for(; first1 != last1; ++first1, ++first2)
+                if(!(*first1 == *first2)) return false;
+            
+            return true;
+        }
+
+        template<typename T, typename U>
+        __WSTL_CONSTEXPR14__
+        bool __Equal(T* first1, T* last1, U* first2, TrueType) {
+            if(__WSTL_IS_CONSTANT_EVALUATED__()) return __Equal(first1, last1, first2, FalseType());
+            return __MemoryEqual(first1, first2, static_cast<size_t>(last1 - first1) * sizeof(T));
+        }
+
+        template<typename InputIterator1, typename InputIterator2>
+        __WSTL_CONSTEXPR14__
+        bool __Equal(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, InputIterator2 last2, FalseType) {
+            for(; first1 != last1 && first2 != last2; ++first1, ++first2)
+                if(!(*first1 == *first2)) return false;
+
+            return first1 == last1 && first2 == last2;
+        }
+
+        template<typename T, typename U>
+        __WSTL_CONSTEXPR14__
+        bool __Equal(T* first1, T* last1, U* first2, U* last2, TrueType) {
+            if(last1 - first1 != last2 - first2) return false;
+            return __Equal(first1, last1, first2, TrueType());
+        }
+    }
+
     /// @brief Checks whether two ranges are equal using a predicate
     /// @param first1 Iterator to the beginning of the first range
     /// @param last1 Iterator to the end of the first range
@@ -1430,15 +1734,13 @@ namespace wstl {
     /// @param last1 Iterator to the end of the first range
     /// @param first2 Iterator to the beginning of the second range
     /// @return True if elements in the ranges are equal, false otherwise
+    /// @details Pointer ranges of integral and pointer types are compared with `memcmp`
     /// @ingroup algorithm
     /// @see https://en.cppreference.com/w/cpp/algorithm/equal
     template<typename InputIterator1, typename InputIterator2>
     __WSTL_NODISCARD__ __WSTL_CONSTEXPR14__
     bool Equal(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2) {
-        for(; first1 != last1; ++first1, ++first2)
-            if(!(*first1 == *first2)) return false;
-        
-        return true;
+        return __private::__Equal(first1, last1, first2, __private::__IsBitwiseComparable<InputIterator1, InputIterator2>());
     }
 
     /// @brief Checks whether two ranges are equal using a predicate
@@ -1465,15 +1767,13 @@ namespace wstl {
     /// @param first2 Iterator to the beginning of the second range
     /// @param last2 Iterator to the end of the second range
     /// @return True if elements in the ranges are equal, false otherwise
+    /// @details Pointer ranges of integral and pointer types are compared with `memcmp`
     /// @ingroup algorithm
     /// @see https://en.cppreference.com/w/cpp/algorithm/equal
     template<typename InputIterator1, typename InputIterator2>
     __WSTL_NODISCARD__ __WSTL_CONSTEXPR14__
     bool Equal(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, InputIterator2 last2) {
-        for(; first1 != last1 && first2 != last2; ++first1, ++first2)
-            if(!(*first1 == *first2)) return false;
-
-        return first1 == last1 && first2 == last2;
+        return __private::__Equal(first1, last1, first2, last2, __private::__IsBitwiseComparable<InputIterator1, InputIterator2>());
     }
 
     // Lexicographical compare
@@ -1792,31 +2092,63 @@ namespace wstl {
 
     // Quick sort
 
+    namespace __private {
+        /// @brief Partitions a range around its last element
+        /// @return Iterator to the pivot in its final position
+        template<typename RandomAccessIterator, typename Compare>
+        __WSTL_CONSTEXPR14__
+        RandomAccessIterator __QuickSortPartition(RandomAccessIterator first, RandomAccessIterator last, Compare compare) {
+            RandomAccessIterator pivot = Previous(last);
+            RandomAccessIterator i = first;
+
+            for(RandomAccessIterator j = first; j != pivot; ++j) {
+                if (compare(*j, *pivot)) {
+                    IteratorSwap(i, j);
+                    ++i;
+                }
+            }
+
+            IteratorSwap(i, pivot);
+            return i;
+        }
+
+        #ifdef __WSTL_INSTRUMENTATION__
+        /// @brief Quick sort that returns its recursion depth
+        template<typename RandomAccessIterator, typename Compare>
+        __WSTL_CONSTEXPR14__
+        size_t __InstrumentedQuickSort(RandomAccessIterator first, RandomAccessIterator last, Compare compare) {
+            if(Distance(first, last) <= 1) return 0;
+
+            RandomAccessIterator i = __QuickSortPartition(first, last, compare);
+
+            const size_t left = __InstrumentedQuickSort(first, i, compare);
+            const size_t right = __InstrumentedQuickSort(Next(i), last, compare);
+            return 1 + (left < right ? right : left);
+        }
+        #endif
+    }
+
     /// @brief Sorts a range using quick sort algorithm and a comparator
     /// @param first Iterator to the beginning of the range
     /// @param last Iterator to the end of the range
     /// @param compare Binary comparator function that returns a boolean value
+    /// @details With `__WSTL_INSTRUMENTATION__` defined, the recursion depth is recorded in `QuickSortStatistics`
     /// @ingroup algorithm
     template<typename RandomAccessIterator, typename Compare>
     __WSTL_CONSTEXPR14__
     void QuickSort(RandomAccessIterator first, RandomAccessIterator last, Compare compare) {
+        #ifdef __WSTL_INSTRUMENTATION__
+        const size_t depth = __private::__InstrumentedQuickSort(first, last, compare);
+        if(!__WSTL_IS_CONSTANT_EVALUATED__()) QuickSortStatistics().Record(depth);
+        #else
         // base case
         if(Distance(first, last) <= 1) return;
 
-        RandomAccessIterator pivot = Previous(last);
-        RandomAccessIterator i = first;
-
-        for(RandomAccessIterator j = first; j != pivot; ++j) {
-            if (compare(*j, *pivot)) {
-                IteratorSwap(i, j);
-                ++i;
-            }
-        }
-
-        IteratorSwap(i, pivot);
+        RandomAccessIterator i = __private::__QuickSortPartition(first, last, compare);
 
         QuickSort(first, i, compare);
         QuickSort(Next(i), last, compare);
+        #endif
     }
 
     /// @brief Sorts a range into ascending order using quick sort algorithm
@@ -1996,35 +2328,149 @@ namespace wstl {
     // Merge sort
 
     namespace __private {
+        /// @brief Length of the runs sorted with insertion sort before merging
+        static const __WSTL_CONSTEXPR__ ptrdiff_t __MERGESORT_RUN = 16;
+
         template<typename RandomAccessIterator, typename Compare>
         __WSTL_CONSTEXPR14__
-        void __MergeSort(RandomAccessIterator first, RandomAccessIterator last, RandomAccessIterator temp, Compare compare) {
-            if(Distance(first, last) <= 1) return;
-            RandomAccessIterator middle = first + (last - first) / 2;
+        void __InsertionSort(RandomAccessIterator first, RandomAccessIterator last, Compare compare) {
+            if(first == last) return;
 
-            __MergeSort(first, middle, temp, compare);
-            __MergeSort(middle, last, temp, compare);
+            for(RandomAccessIterator i = first + 1; i != last; ++i) {
+                typename IteratorTraits<RandomAccessIterator>::ValueType value = __WSTL_MOVE__(*i);
+                RandomAccessIterator j = i;
 
-            Merge(first, middle, middle, last, temp, compare);
-            for(RandomAccessIterator l = first; l != last; ++l, ++temp) *l = *temp;
+                for(; j != first && compare(value, *(j - 1)); --j) *j = __WSTL_MOVE__(*(j - 1));
+                *j = __WSTL_MOVE__(value);
+            }
+        }
+
+        /// @brief Merges two adjacent sorted ranges, moving the shorter one into the buffer
+        template<typename RandomAccessIterator, typename T, typename Compare>
+        __WSTL_CONSTEXPR14__
+        void __MergeWithBuffer(RandomAccessIterator first, RandomAccessIterator middle, RandomAccessIterator last, 
+            T* buffer, Compare compare) {
+            if(middle - first <= last - middle) {
+                T* bufferLast = Move(first, middle, buffer);
+
+                for(; buffer != bufferLast && middle != last; ++first) {
+                    if(compare(*middle, *buffer)) *first = __WSTL_MOVE__(*middle++);
+                    else *first = __WSTL_MOVE__(*buffer++);
+                }
+
+                Move(buffer, bufferLast, first);
+            }
+            else {
+                T* bufferLast = Move(middle, last, buffer);
+
+                while(buffer != bufferLast && first != middle) {
+                    if(compare(*(bufferLast - 1), *(middle - 1))) *--last = __WSTL_MOVE__(*--middle);
+                    else *--last = __WSTL_MOVE__(*--bufferLast);
+                }
+
+                MoveBackward(buffer, bufferLast, last);
+            }
+        }
+
+        /// @brief Merges two adjacent sorted ranges by rotations, recursion depth is O(log n)
+        template<typename RandomAccessIterator, typename Compare>
+        __WSTL_CONSTEXPR14__
+        void __MergeWithoutBuffer(RandomAccessIterator first, RandomAccessIterator middle, RandomAccessIterator last, Compare compare) {
+            typedef typename IteratorTraits<RandomAccessIterator>::DifferenceType DifferenceType;
+
+            while(first != middle && middle != last) {
+                DifferenceType length1 = middle - first;
+                DifferenceType length2 = last - middle;
+
+                if(length1 + length2 == 2) {
+                    if(compare(*middle, *first)) IteratorSwap(first, middle);
+                    return;
+                }
+
+                RandomAccessIterator firstCut = first;
+                RandomAccessIterator secondCut = middle;
+
+                if(length1 > length2) {
+                    // Lower bound of the middle element of the first range in the second range
+                    firstCut += length1 / 2;
+
+                    for(DifferenceType count = length2; count > 0;) {
+                        DifferenceType step = count / 2;
+                        if(compare(*(secondCut + step), *firstCut)) {
+                            secondCut += step + 1;
+                            count -= step + 1;
+                        }
+                        else count = step;
+                    }
+                }
+                else {
+                    // Upper bound of the middle element of the second range in the first range
+                    secondCut += length2 / 2;
+
+                    for(DifferenceType count = length1; count > 0;) {
+                        DifferenceType step = count / 2;
+                        if(!compare(*secondCut, *(firstCut + step))) {
+                            firstCut += step + 1;
+                            count -= step + 1;
+                        }
+                        else count = step;
+                    }
+                }
+
+                RandomAccessIterator newMiddle = Rotate(firstCut, middle, secondCut);
+
+                // Recurse into the left part, loop on the right one
+                __MergeWithoutBuffer(first, firstCut, newMiddle, compare);
+                first = newMiddle;
+                middle = secondCut;
+            }
+        }
+
+        /// @brief Bottom-up merge sort, merges that do not fit into the buffer are done without it
+        template<typename RandomAccessIterator, typename T, typename Compare>
+        __WSTL_CONSTEXPR14__
+        void __MergeSort(RandomAccessIterator first, RandomAccessIterator last, T* buffer, size_t bufferSize, Compare compare) {
+            typedef typename IteratorTraits<RandomAccessIterator>::DifferenceType DifferenceType;
+            DifferenceType n = last - first;
+            if(n <= 1) return;
+
+            RandomAccessIterator run = first;
+            for(; last - run > __MERGESORT_RUN; run += __MERGESORT_RUN) __InsertionSort(run, run + __MERGESORT_RUN, compare);
+            __InsertionSort(run, last, compare);
+
+            for(DifferenceType width = __MERGESORT_RUN; width < n; width *= 2) {
+                for(DifferenceType low = 0; low < n - width; low += 2 * width) {
+                    RandomAccessIterator middle = first + (low + width);
+                    RandomAccessIterator high = (n - low > 2 * width) ? middle + width : last;
+
+                    // Runs that are already in order need no merge
+                    if(!compare(*middle, *(middle - 1))) continue;
+
+                    // Without a buffer there is nothing to copy into, the null pointer must not reach `Move`
+                    if(bufferSize == 0 || static_cast<size_t>(Min(width, high - middle)) > bufferSize)
+                        __MergeWithoutBuffer(first + low, middle, high, compare);
+                    else __MergeWithBuffer(first + low, middle, high, buffer, compare);
+                }
+            }
         }
     }
 
-    /// @brief Sorts a range using merge sort algorithm and a comparator
+    /// @brief Sorts a range using bottom-up merge sort algorithm and a comparator, without additional memory
     /// @param first Iterator to the beginning of the range
     /// @param last Iterator to the end of the range
     /// @param compare Binary comparator to use for sorting
+    /// @details Runs are merged in place by rotations, which takes O(n log^2 n) time and O(log n) stack
     /// @ingroup algorithm
     template<typename RandomAccessIterator, typename Compare>
     __WSTL_CONSTEXPR14__
-    void MergeSort(RandomAccessIterator first, RandomAccessIterator last, Compare compare) {
-        typename IteratorTraits<RandomAccessIterator>::ValueType temp[Distance(first, last)];
-        __private::__MergeSort(first, last, temp, compare);
+    inline void MergeSort(RandomAccessIterator first, RandomAccessIterator last, Compare compare) {
+        __private::__MergeSort(first, last, static_cast<typename IteratorTraits<RandomAccessIterator>::ValueType*>(__WSTL_NULLPTR__), 0, compare);
     }
 
-    /// @brief Sorts a range into ascending order using merge sort algorithm
+    /// @brief Sorts a range into ascending order using bottom-up merge sort algorithm, without additional memory
     /// @param first Iterator to the beginning of the range
     /// @param last Iterator to the end of the range
+    /// @details Runs are merged in place by rotations, which takes O(n log^2 n) time and O(log n) stack
     /// @ingroup algorithm
     template<typename RandomAccessIterator>
     __WSTL_CONSTEXPR14__
@@ -2056,90 +2502,158 @@ namespace wstl {
         HeapSort(first, last, Less<typename IteratorTraits<RandomAccessIterator>::ValueType>());
     }
 
-    // Nth element
+    // Sort
 
     namespace __private {
+        /// @brief Ranges up to this size are finished with insertion sort
+        static const __WSTL_CONSTEXPR__ ptrdiff_t __INTROSORT_THRESHOLD = 16;
+
         template<typename RandomAccessIterator, typename Compare>
-        class __PivotComparator {
-        public:
-            __WSTL_CONSTEXPR__ __PivotComparator(RandomAccessIterator pivot, Compare compare) 
-                : m_Pivot(pivot), m_Compare(compare) {};
+        __WSTL_CONSTEXPR14__
+        void __MoveMedianToFirst(RandomAccessIterator result, RandomAccessIterator a, RandomAccessIterator b, 
+            RandomAccessIterator c, Compare compare) {
+            if(compare(*a, *b)) {
+                if(compare(*b, *c)) IteratorSwap(result, b);
+                else if(compare(*a, *c)) IteratorSwap(result, c);
+                else IteratorSwap(result, a);
+            }
+            else if(compare(*a, *c)) IteratorSwap(result, a);
+            else if(compare(*b, *c)) IteratorSwap(result, c);
+            else IteratorSwap(result, b);
+        }
+
+        /// @brief Hoare partition around `*pivot`, the range must contain elements 
+        /// not less and not greater than the pivot, which act as sentinels
+        template<typename RandomAccessIterator, typename Compare>
+        __WSTL_CONSTEXPR14__
+        RandomAccessIterator __UnguardedPartition(RandomAccessIterator first, RandomAccessIterator last, 
+            RandomAccessIterator pivot, Compare compare) {
+            while(true) {
+                while(compare(*first, *pivot)) ++first;
+                --last;
+                while(compare(*pivot, *last)) --last;
 
-            bool operator()(const typename IteratorTraits<RandomAccessIterator>::ValueType& x) const {
-                return m_Compare(x, *m_Pivot);
+                if(!(first < last)) return first;
+                IteratorSwap(first, last);
+                ++first;
             }
+        }
 
-        private:
-            RandomAccessIterator m_Pivot;
-            Compare m_Compare;
-        };
+        template<typename RandomAccessIterator, typename Compare>
+        __WSTL_CONSTEXPR14__
+        void __IntroSort(RandomAccessIterator first, RandomAccessIterator last, size_t depth, Compare compare) {
+            while(last - first > __INTROSORT_THRESHOLD) {
+                if(depth == 0) {
+                    HeapSort(first, last, compare);
+                    return;
+                }
+
+                --depth;
+
+                __MoveMedianToFirst(first, first + 1, first + (last - first) / 2, last - 1, compare);
+                RandomAccessIterator cut = __UnguardedPartition(first + 1, last, first, compare);
+
+                // Recurse into the smaller part only, so the stack depth stays logarithmic
+                if(cut - first < last - cut) {
+                    __IntroSort(first, cut, depth, compare);
+                    first = cut;
+                }
+                else {
+                    __IntroSort(cut, last, depth, compare);
+                    last = cut;
+                }
+            }
+
+            __InsertionSort(first, last, compare);
+        }
     }
 
-    /// @brief Partially sorts a range such that the element at `nth` is in its correct position using a comparator
+    /// @brief Sorts a range using a comparator. Uses introsort algorithm internally
     /// @param first Iterator to the beginning of the range
-    /// @param nth Iterator to the element to be placed in its correct position
     /// @param last Iterator to the end of the range
     /// @param compare Binary comparator to use for sorting
+    /// @details Quick sort with median-of-three pivot and Hoare partition, which falls back 
+    /// to heap sort once recursion depth reaches 2 * log2(n), small ranges are finished with 
+    /// insertion sort. Worst case is O(n log n) time and O(log n) stack
     /// @ingroup algorithm
-    /// @see https://en.cppreference.com/w/cpp/algorithm/nth_element
+    /// @see https://en.cppreference.com/w/cpp/algorithm/sort
     template<typename RandomAccessIterator, typename Compare>
     __WSTL_CONSTEXPR14__
-    void NthElement(RandomAccessIterator first, RandomAccessIterator nth, RandomAccessIterator last, Compare compare) {
-        while(first < last) {
-            RandomAccessIterator middle = Partition(first, last, 
-                __private::__PivotComparator<RandomAccessIterator, Compare>(first, compare));
-
-            IteratorSwap(first, middle);
+    void Sort(RandomAccessIterator first, RandomAccessIterator last, Compare compare) {
+        size_t depth = 0;
+        for(size_t n = static_cast<size_t>(Distance(first, last)); n > 1; n >>= 1) depth += 2;
 
-            if(middle == nth) return;
-            else if(middle < nth) first = middle + 1;
-            else last = middle;
-        }
+        __private::__IntroSort(first, last, depth, compare);
     }
 
-    /// @brief Partially sorts a range such that the element at `nth` is in its correct position
+    /// @brief Sorts a range into ascending order. Uses introsort algorithm internally
     /// @param first Iterator to the beginning of the range
-    /// @param nth Iterator to the element to be placed in its correct position
     /// @param last Iterator to the end of the range
     /// @ingroup algorithm
-    /// @see https://en.cppreference.com/w/cpp/algorithm/nth_element
+    /// @see https://en.cppreference.com/w/cpp/algorithm/sort
     template<typename RandomAccessIterator>
     __WSTL_CONSTEXPR14__
-    inline void NthElement(RandomAccessIterator first, RandomAccessIterator nth, RandomAccessIterator last) {
-        NthElement(first, nth, last, Less<typename IteratorTraits<RandomAccessIterator>::ValueType>());
+    inline void Sort(RandomAccessIterator first, RandomAccessIterator last) {
+        Sort(first, last, Less<typename IteratorTraits<RandomAccessIterator>::ValueType>());
     }
-    
-    // Sort
 
-    /// @brief Sorts a range using a comparator. Uses quick sort algorithm internally
+    // Nth element
+
+    /// @brief Partially sorts a range such that the element at `nth` is in its correct position using a comparator
     /// @param first Iterator to the beginning of the range
+    /// @param nth Iterator to the element to be placed in its correct position
     /// @param last Iterator to the end of the range
     /// @param compare Binary comparator to use for sorting
+    /// @details Quickselect with the median-of-three pivot and Hoare partition of `Sort`, so sorted and
+    /// reversed ranges take linear time. Falls back to heap sort once the depth reaches 2 * log2(n),
+    /// small ranges are finished with insertion sort. Worst case is O(n log n)
     /// @ingroup algorithm
-    /// @see https://en.cppreference.com/w/cpp/algorithm/sort
+    /// @see https://en.cppreference.com/w/cpp/algorithm/nth_element
     template<typename RandomAccessIterator, typename Compare>
     __WSTL_CONSTEXPR14__
-    inline void Sort(RandomAccessIterator first, RandomAccessIterator last, Compare compare) {
-        QuickSort(first, last, compare);
+    void NthElement(RandomAccessIterator first, RandomAccessIterator nth, RandomAccessIterator last, Compare compare) {
+        if(nth == last) return;
+
+        size_t depth = 0;
+        for(size_t n = static_cast<size_t>(Distance(first, last)); n > 1; n >>= 1) depth += 2;
+
+        while(last - first > __private::__INTROSORT_THRESHOLD) {
+            if(depth == 0) {
+                HeapSort(first, last, compare);
+                return;
+            }
+
+            --depth;
+
+            __private::__MoveMedianToFirst(first, first + 1, first + (last - first) / 2, last - 1, compare);
+            RandomAccessIterator cut = __private::__UnguardedPartition(first + 1, last, first, compare);
+
+            if(cut <= nth) first = cut;
+            else last = cut;
+        }
+
+        __private::__InsertionSort(first, last, compare);
     }
 
-    /// @brief Sorts a range into ascending order. Uses quick sort algorithm internally
+    /// @brief Partially sorts a range such that the element at `nth` is in its correct position
     /// @param first Iterator to the beginning of the range
+    /// @param nth Iterator to the element to be placed in its correct position
     /// @param last Iterator to the end of the range
     /// @ingroup algorithm
-    /// @see https://en.cppreference.com/w/cpp/algorithm/sort
+    /// @see https://en.cppreference.com/w/cpp/algorithm/nth_element
     template<typename RandomAccessIterator>
     __WSTL_CONSTEXPR14__
-    inline void Sort(RandomAccessIterator first, RandomAccessIterator last) {
-        QuickSort(first, last);
+    inline void NthElement(RandomAccessIterator first, RandomAccessIterator nth, RandomAccessIterator last) {
+        NthElement(first, nth, last, Less<typename IteratorTraits<RandomAccessIterator>::ValueType>());
     }
-
+    
     // Stable sort
 
     /// @brief Sorts a range using a comparator, preserving order between equal elements. Uses merge sort algorithm internally
     /// @param first Iterator to the beginning of the range
     /// @param last Iterator to the end of the range
     /// @param compare Binary comparator to use for sorting
+    /// @details Does not use additional memory, see `MergeSort`
     /// @ingroup algorithm
     /// @see https://en.cppreference.com/w/cpp/algorithm/stable_sort
     template<typename RandomAccessIterator, typename Compare>
@@ -2151,6 +2665,7 @@ namespace wstl {
     /// @brief Sorts a range into ascending order, preserving order between equal elements. Uses merge sort algorithm internally
     /// @param first Iterator to the beginning of the range
     /// @param last Iterator to the end of the range
+    /// @details Does not use additional memory, see `MergeSort`
     /// @ingroup algorithm
     /// @see https://en.cppreference.com/w/cpp/algorithm/stable_sort
     template<typename RandomAccessIterator>
@@ -2322,6 +2837,271 @@ namespace wstl {
         return BinaryFind(first, last, value, Less<ValueType>(), EqualTo<ValueType>());
     }
 
+    // Branchless lower bound
+
+    namespace __private {
+        /// @brief Finds the first element of a partitioned range for which the predicate is false,
+        /// without branching on the comparisons
+        /// @details The range shrinks by half on every step whatever the outcome, so the position
+        /// moves forward by a multiple of the outcome rather than by a branch. Both elements that
+        /// the next step may compare are prefetched
+        template<typename RandomAccessIterator, typename Predicate>
+        RandomAccessIterator __BranchlessPartitionPoint(RandomAccessIterator first, 
+            typename IteratorTraits<RandomAccessIterator>::DifferenceType length, Predicate predicate) {
+            typedef typename IteratorTraits<RandomAccessIterator>::DifferenceType DifferenceType;
+            if(length == 0) return first;
+
+            while(length > 1) {
+                const DifferenceType half = length / 2;
+                const DifferenceType next = (length - half) / 2;
+
+                __WSTL_PREFETCH__(&first[next]);
+                __WSTL_PREFETCH__(&first[half + next]);
+
+                first += static_cast<DifferenceType>(predicate(first[half])) * half;
+                length -= half;
+            }
+
+            return first + static_cast<DifferenceType>(predicate(*first));
+        }
+
+        /// @brief Checks whether an element is less than a value, the predicate of a lower bound search
+        template<typename T, typename Compare>
+        struct __LessThanValue {
+            const T& Value;
+            Compare Function;
+
+            __LessThanValue(const T& value, Compare function) : Value(value), Function(function) {}
+
+            template<typename U>
+            bool operator()(const U& element) const {
+                return Function(element, Value);
+            }
+        };
+
+        /// @brief Checks whether an element is not greater than a value, the predicate of an upper bound search
+        template<typename T, typename Compare>
+        struct __NotGreaterThanValue {
+            const T& Value;
+            Compare Function;
+
+            __NotGreaterThanValue(const T& value, Compare function) : Value(value), Function(function) {}
+
+            template<typename U>
+            bool operator()(const U& element) const {
+                return !Function(Value, element);
+            }
+        };
+    }
+
+    /// @brief Finds the first element in a sorted range that is not less than the given value using a comparator,
+    /// without branching on the comparisons
+    /// @param first Iterator to the beginning of the range
+    /// @param last Iterator to the end of the range
+    /// @param value Value to compare against
+    /// @param compare Binary comparator to use for examining
+    /// @return Iterator to the first element that is not less than the given value
+    /// @details Always takes ceil(log2(n)) + 1 comparisons and compiles to conditional moves, so it does
+    /// not suffer branch mispredictions on large ranges, where `LowerBound` mispredicts about every
+    /// other step. Both candidates of the next step are prefetched, which hides part of the memory latency
+    /// @ingroup algorithm
+    template<typename RandomAccessIterator, typename T, typename Compare>
+    __WSTL_NODISCARD__
+    inline RandomAccessIterator BranchlessLowerBound(RandomAccessIterator first, RandomAccessIterator last, const T& value, Compare compare) {
+        return __private::__BranchlessPartitionPoint(first, last - first, __private::__LessThanValue<T, Compare>(value, compare));
+    }
+
+    /// @brief Finds the first element in a sorted range that is not less than the given value,
+    /// without branching on the comparisons
+    /// @param first Iterator to the beginning of the range
+    /// @param last Iterator to the end of the range
+    /// @param value Value to compare against
+    /// @return Iterator to the first element that is not less than the given value
+    /// @details See `BranchlessLowerBound(RandomAccessIterator, RandomAccessIterator, const T&, Compare)`
+    /// @ingroup algorithm
+    template<typename RandomAccessIterator, typename T>
+    __WSTL_NODISCARD__
+    inline RandomAccessIterator BranchlessLowerBound(RandomAccessIterator first, RandomAccessIterator last, const T& value) {
+        return BranchlessLowerBound(first, last, value, Less<typename IteratorTraits<RandomAccessIterator>::ValueType>());
+    }
+
+    // Eytzinger index
+
+    namespace __private {
+        /// @brief Assumed size of a cache line, the unit of prefetching during Eytzinger searches
+        static const __WSTL_CONSTEXPR__ size_t __EYTZINGER_CACHE_LINE_SIZE = 64;
+
+        /// @brief Number of elements on the deepest level of a complete binary tree
+        inline size_t __EytzingerLeaves(size_t size) {
+            size_t level = 1;
+            while(level <= size / 2) level *= 2;
+            return size - (level - 1);
+        }
+
+        /// @brief Moves elements at even offsets in front of ones at odd offsets, keeping their order
+        template<typename T>
+        void __EytzingerUnshuffle(T* data, size_t size) {
+            if(size <= 2) return;
+
+            const size_t left = 2 * ((size + 2) / 4);
+
+            __EytzingerUnshuffle(data, left);
+            __EytzingerUnshuffle(data + left, size - left);
+            Rotate(data + left / 2, data + left, data + left + (size - left + 1) / 2);
+        }
+
+        /// @brief Reverses `__EytzingerUnshuffle`
+        template<typename T>
+        void __EytzingerShuffle(T* data, size_t size) {
+            if(size <= 2) return;
+
+            const size_t left = 2 * ((size + 2) / 4);
+            const size_t even = (size + 1) / 2;
+
+            Rotate(data + left / 2, data + even, data + even + left / 2);
+            __EytzingerShuffle(data, left);
+            __EytzingerShuffle(data + left, size - left);
+        }
+
+        /// @brief Rearranges a sorted range into breadth-first order of a binary search tree
+        /// @details The deepest level holds every other element of a prefix of the sorted range.
+        /// It is moved to the back in order, and the remaining elements form a perfect tree,
+        /// which is arranged the same way level by level. Works in place in O(n log n)
+        template<typename T>
+        void __EytzingerBuild(T* data, size_t size) {
+            while(size > 1) {
+                const size_t leaves = __EytzingerLeaves(size);
+
+                __EytzingerUnshuffle(data, Min(2 * leaves, size));
+                Rotate(data, data + leaves, data + size);
+                size -= leaves;
+            }
+        }
+
+        /// @brief Rearranges a range in Eytzinger order back into sorted order, reversing `__EytzingerBuild`
+        template<typename T>
+        void __EytzingerRestore(T* data, size_t size) {
+            if(size <= 1) return;
+
+            const size_t leaves = __EytzingerLeaves(size);
+
+            __EytzingerRestore(data, size - leaves);
+            Rotate(data, data + (size - leaves), data + size);
+            __EytzingerShuffle(data, Min(2 * leaves, size));
+        }
+
+        /// @brief Finds the first element in key order of a range in Eytzinger order for which the predicate is false
+        /// @return Position of the element in memory, or `size` if there is none
+        /// @details Descends to a leaf without branching on the comparisons, then climbs back
+        /// to the last node where the search went left. The descendants four levels below a node
+        /// are contiguous and fill one cache line for small elements, so that line is prefetched on every step
+        template<typename T, typename Predicate>
+        size_t __EytzingerSearch(const T* data, size_t size, Predicate predicate) {
+            size_t block = 1;
+            while(2 * block * sizeof(T) <= __EYTZINGER_CACHE_LINE_SIZE) block *= 2;
+
+            // One-based indices, so the children of the node at i are at 2i and 2i + 1
+            size_t index = 1;
+            while(index <= size) {
+                if(block > 1) __WSTL_PREFETCH__(reinterpret_cast<const void*>(reinterpret_cast<uintptr_t>(data) + (index * block - 1) * sizeof(T)));
+                index = 2 * index + static_cast<size_t>(predicate(data[index - 1]));
+            }
+
+            // Every trailing one is a step to the right after the last step to the left
+            while((index & 1) != 0) index >>= 1;
+            index >>= 1;
+
+            return index == 0 ? size : index - 1;
+        }
+    }
+
+    /// @brief Search index over a sorted range, which the index rearranges in place into Eytzinger order
+    /// @tparam T Type of the elements
+    /// @tparam Compare Comparator the range is sorted by
+    /// @details The elements are put into breadth-first order of an implicit binary search tree:
+    /// the children of the element at `i` are at `2i + 1` and `2i + 2`. Searches then read memory
+    /// in a predictable pattern, where the next four levels of the tree share a cache line that
+    /// is prefetched, and they do not branch on the comparisons. Building the index takes O(n log n)
+    /// without extra memory and pays off over many lookups into a large range. The range is not in
+    /// sorted order while indexed, `Restore` brings it back. The results of the searches point into the range
+    /// @ingroup algorithm
+    template<typename T, typename Compare = Less<T> >
+    class EytzingerIndex {
+    public:
+        typedef T ValueType;
+        typedef size_t SizeType;
+        typedef T* PointerType;
+        typedef const T* ConstPointerType;
+        typedef Compare CompareType;
+
+        /// @brief Constructor, rearranges the range
+        /// @param first Pointer to the beginning of the range to index, sorted by `compare`
+        /// @param last Pointer to the end of the range
+        /// @param compare Comparator the range is sorted by
+        EytzingerIndex(PointerType first, PointerType last, const CompareType& compare = CompareType()) :
+            m_Data(first), m_Size(static_cast<SizeType>(last - first)), m_Compare(compare) {
+            __private::__EytzingerBuild(m_Data, m_Size);
+        }
+
+        /// @brief Finds the first element that is not less than the given value
+        /// @param value Value to compare against
+        /// @return Pointer to the element, or `End()` if there is none
+        template<typename U>
+        __WSTL_NODISCARD__ PointerType LowerBound(const U& value) const {
+            return m_Data + __private::__EytzingerSearch(m_Data, m_Size, __private::__LessThanValue<U, CompareType>(value, m_Compare));
+        }
+
+        /// @brief Finds the first element that is greater than the given value
+        /// @param value Value to compare against
+        /// @return Pointer to the element, or `End()` if there is none
+        template<typename U>
+        __WSTL_NODISCARD__ PointerType UpperBound(const U& value) const {
+            return m_Data + __private::__EytzingerSearch(m_Data, m_Size, __private::__NotGreaterThanValue<U, CompareType>(value, m_Compare));
+        }
+
+        /// @brief Finds an element equivalent to the given value
+        /// @param value Value to search for
+        /// @return Pointer to the element, or `End()` if not found
+        template<typename U>
+        __WSTL_NODISCARD__ PointerType Find(const U& value) const {
+            PointerType element = LowerBound(value);
+            return element != End() && !m_Compare(value, *element) ? element : End();
+        }
+
+        /// @brief Checks whether an element equivalent to the given value is in the range
+        /// @param value Value to search for
+        template<typename U>
+        __WSTL_NODISCARD__ bool Contains(const U& value) const {
+            return Find(value) != End();
+        }
+
+        /// @brief Gets pointer past the last element of the range, returned when searches find nothing
+        __WSTL_NODISCARD__ PointerType End() const {
+            return m_Data + m_Size;
+        }
+
+        /// @brief Gets the indexed range, in Eytzinger order
+        __WSTL_NODISCARD__ PointerType Data() const {
+            return m_Data;
+        }
+
+        /// @brief Gets the number of elements in the range
+        __WSTL_NODISCARD__ SizeType Size() const {
+            return m_Size;
+        }
+
+        /// @brief Puts the range back into sorted order, the index is empty afterwards
+        void Restore() {
+            __private::__EytzingerRestore(m_Data, m_Size);
+            m_Size = 0;
+        }
+
+    private:
+        PointerType m_Data;
+        SizeType m_Size;
+        CompareType m_Compare;
+    };
+
     // Includes
 
     /// @brief Checks if a sorted range is a subsequence of another sorted range using a comparator (can be non-contiguous)
@@ -8,6 +8,10 @@
 
 #include "private/Platform.hpp"
 #include "Exception.hpp"
+#include "Expected.hpp"
+#include "NullPointer.hpp"
+#include "TypeTraits.hpp"
+#include "Instrumentation.hpp"
 #include <stddef.h>
 
 
@@ -16,6 +20,20 @@
 /// @ingroup memory
 
 namespace wstl {
+    namespace __private {
+        /// @brief Type with the strictest alignment of the fundamental types
+        union __MaxAlignType {
+            long double LongDouble;
+            long long LongLong;
+            void* Pointer;
+            void(*Function)();
+        };
+    }
+
+    /// @brief Alignment that suits any fundamental type, used when no alignment is requested
+    /// @ingroup allocator
+    static const __WSTL_CONSTEXPR__ size_t DefaultAlignment = AlignmentOf<__private::__MaxAlignType>::Value;
+
     // Bad allocation exception
 
     /// @brief Exception thrown when memory allocation fails
@@ -50,9 +68,74 @@ namespace wstl {
         /// @throws `BadAllocation` if the allocation fails
         virtual void* Allocate(size_t size) = 0;
 
+        /// @brief Allocates a block of memory of the specified size without error handling
+        /// @param size The size of the memory to allocate
+        /// @return A pointer to the allocated memory, or the reason the allocation failed
+        /// @details The default calls `Allocate`, so failures still go through error handling and
+        /// are all reported as `ERROR_CODE_OUT_OF_MEMORY`. The allocators of the library override it
+        virtual Expected<void*> TryAllocate(size_t size) {
+            void* const result = Allocate(size);
+            if(result == NullPointer) return MakeUnexpected(ERROR_CODE_OUT_OF_MEMORY);
+
+            return result;
+        }
+
         /// @brief Frees a block of memory at the specified address
         /// @param address The address to free
         virtual void Free(void* address) = 0;
+
+        #ifdef __WSTL_INSTRUMENTATION__
+        /// @brief Gets the allocation counters
+        /// @note Requires `__WSTL_INSTRUMENTATION__` to be defined
+        const AllocatorStatistics& Statistics() const __WSTL_NOEXCEPT__ {
+            return m_Statistics;
+        }
+
+        /// @brief Zeroes the allocation counters
+        /// @note Requires `__WSTL_INSTRUMENTATION__` to be defined
+        void ResetStatistics() __WSTL_NOEXCEPT__ {
+            m_Statistics = AllocatorStatistics();
+        }
+        #endif
+
+    protected:
+        /// @brief Records the result of an allocation, does nothing without `__WSTL_INSTRUMENTATION__`
+        /// @param size The requested size
+        /// @param result The allocated block, null pointer if the allocation failed
+        void RecordAllocation(size_t size, const void* result) {
+            #ifdef __WSTL_INSTRUMENTATION__
+            if(result == NullPointer) {
+                ++m_Statistics.Failures;
+                __private::__Trace(TRACE_ALLOCATION_FAILURE, this, NullPointer, size);
+                return;
+            }
+
+            ++m_Statistics.Allocations;
+            m_Statistics.RequestedBytes += size;
+            if(m_Statistics.Live() > m_Statistics.PeakLive) m_Statistics.PeakLive = m_Statistics.Live();
+
+            __private::__Trace(TRACE_ALLOCATE, this, result, size);
+            #else
+            (void) size;
+            (void) result;
+            #endif
+        }
+
+        /// @brief Records that a block was freed, does nothing without `__WSTL_INSTRUMENTATION__`
+        /// @param address The freed block
+        void RecordFree(const void* address) {
+            #ifdef __WSTL_INSTRUMENTATION__
+            ++m_Statistics.Frees;
+            __private::__Trace(TRACE_FREE, this, address, 0);
+            #else
+            (void) address;
+            #endif
+        }
+
+    #ifdef __WSTL_INSTRUMENTATION__
+    private:
+        AllocatorStatistics m_Statistics;
+    #endif
     };
 }
 
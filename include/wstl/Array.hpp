@@ -108,7 +108,7 @@ namespace wstl {
         }
 
         /// @brief Gets the const data pointer of the array
-        __WSTL_NODISCARD__ __WSTL_CONSTEXPR__ ConstReferenceType Data() const __WSTL_NOEXCEPT__ {
+        __WSTL_NODISCARD__ __WSTL_CONSTEXPR__ ConstPointerType Data() const __WSTL_NOEXCEPT__ {
             return __m_Data;
         }
 
@@ -384,12 +384,12 @@ namespace wstl {
 
         /// @brief Gets the data pointer of the array
         __WSTL_NODISCARD__ __WSTL_CONSTEXPR14__ PointerType Data() __WSTL_NOEXCEPT__ {
-            return (const T*) 0;
+            return (T*) 0;
         }
 
         /// @brief Gets the const data pointer of the array
-        __WSTL_NODISCARD__ __WSTL_CONSTEXPR__ ConstReferenceType Data() const __WSTL_NOEXCEPT__ {
-            return (T*) 0;
+        __WSTL_NODISCARD__ __WSTL_CONSTEXPR__ ConstPointerType Data() const __WSTL_NOEXCEPT__ {
+            return (const T*) 0;
         }
 
         /// @brief Gets the iterator to the beginning of the array
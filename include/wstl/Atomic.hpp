@@ -0,0 +1,614 @@
+// Part of WardenSTL - https://github.com/WardenHD/WardenSTL
+// Copyright (c) 2025 Artem Bezruchko (WardenHD)
+//
+// Licensed under the MIT License. See LICENSE file for details.
+
+#ifndef __WSTL_ATOMIC_HPP__
+#define __WSTL_ATOMIC_HPP__
+
+#include "private/Platform.hpp"
+#include "TypeTraits.hpp"
+#include "StaticAssert.hpp"
+#include <stddef.h>
+
+
+/// @defgroup atomic Atomic
+/// @brief Atomic operations on top of compiler builtins, with a critical section fallback
+/// @ingroup utilities
+
+namespace wstl {
+    // Memory order
+
+    /// @brief Specifies how memory accesses around an atomic operation are ordered
+    /// @details The values match the `__ATOMIC_*` constants of GCC and Clang
+    /// @ingroup atomic
+    /// @see https://en.cppreference.com/w/cpp/atomic/memory_order
+    enum MemoryOrder {
+        MEMORY_ORDER_RELAXED = 0,
+        MEMORY_ORDER_CONSUME = 1,
+        MEMORY_ORDER_ACQUIRE = 2,
+        MEMORY_ORDER_RELEASE = 3,
+        MEMORY_ORDER_ACQ_REL = 4,
+        MEMORY_ORDER_SEQ_CST = 5
+    };
+
+    namespace __private {
+        /// @brief Prevents the compiler from moving memory accesses across this point
+        inline void __CompilerBarrier() {
+            #if defined(__WSTL_GCC__) || defined(__WSTL_CLANG__)
+            __asm__ __volatile__("" ::: "memory");
+            #elif defined(__WSTL_MSVC__)
+            _ReadWriteBarrier();
+            #endif
+        }
+
+        /// @brief Gets the failure order of a compare-exchange from its success order
+        inline MemoryOrder __FailureOrder(MemoryOrder order) {
+            return (order == MEMORY_ORDER_ACQ_REL) ? MEMORY_ORDER_ACQUIRE :
+                (order == MEMORY_ORDER_RELEASE) ? MEMORY_ORDER_RELAXED : order;
+        }
+
+        #if (defined(__WSTL_GCC__) || defined(__WSTL_CLANG__)) && (defined(__ARM_ARCH_6M__) || defined(__ARM_ARCH_7M__) || \
+            defined(__ARM_ARCH_7EM__) || defined(__ARM_ARCH_8M_BASE__) || defined(__ARM_ARCH_8M_MAIN__))
+        // Cortex-M: mask interrupts with PRIMASK and restore the previous state on exit
+        inline unsigned long __DefaultCriticalEnter() {
+            unsigned long state;
+            __asm__ __volatile__("mrs %0, primask\n\tcpsid i" : "=r"(state) :: "memory");
+            return state;
+        }
+
+        inline void __DefaultCriticalExit(unsigned long state) {
+            __asm__ __volatile__("msr primask, %0" :: "r"(state) : "memory");
+        }
+        #else
+        inline unsigned long __DefaultCriticalEnter() { return 0; }
+        inline void __DefaultCriticalExit(unsigned long) {}
+        #endif
+    }
+
+    // Atomic critical section
+
+    /// @brief Scoped critical section used by atomics that are not lock-free
+    /// @details On Cortex-M targets the default hooks mask interrupts through PRIMASK,
+    /// elsewhere they do nothing, which is only correct without concurrency. Set custom hooks
+    /// with `SetHooks` to use an RTOS lock or a platform specific interrupt mask
+    /// @ingroup atomic
+    class AtomicCriticalSection {
+    public:
+        typedef unsigned long StateType;
+        typedef StateType (*EnterFunction)();
+        typedef void (*ExitFunction)(StateType);
+
+        /// @brief Constructor, enters the critical section
+        AtomicCriticalSection() : m_State(EnterHook()()) {
+            __private::__CompilerBarrier();
+        }
+
+        /// @brief Destructor, exits the critical section
+        ~AtomicCriticalSection() {
+            __private::__CompilerBarrier();
+            ExitHook()(m_State);
+        }
+
+        /// @brief Sets functions used to enter and exit the critical section
+        /// @param enter Function that enters the critical section and returns the state to restore
+        /// @param exit Function that restores the state returned by `enter`
+        /// @details Must be called before any atomic that uses the critical section is shared
+        static void SetHooks(EnterFunction enter, ExitFunction exit) {
+            EnterHook() = enter;
+            ExitHook() = exit;
+        }
+
+    private:
+        StateType m_State;
+
+        static EnterFunction& EnterHook() {
+            static EnterFunction function = &__private::__DefaultCriticalEnter;
+            return function;
+        }
+
+        static ExitFunction& ExitHook() {
+            static ExitFunction function = &__private::__DefaultCriticalExit;
+            return function;
+        }
+
+        /// @brief Deleted copy constructor
+        AtomicCriticalSection(const AtomicCriticalSection&) __WSTL_DELETE__;
+
+        /// @brief Deleted copy assignment operator
+        AtomicCriticalSection& operator=(const AtomicCriticalSection&) __WSTL_DELETE__;
+    };
+
+    // Fences
+
+    /// @brief Orders memory accesses between threads without an associated atomic operation
+    /// @param order Memory order of the fence
+    /// @ingroup atomic
+    /// @see https://en.cppreference.com/w/cpp/atomic/atomic_thread_fence
+    inline void AtomicThreadFence(MemoryOrder order) {
+        #ifdef __WSTL_HAS_ATOMIC_BUILTINS__
+        __atomic_thread_fence(order);
+        #else
+        (void) order;
+        __private::__CompilerBarrier();
+        #endif
+    }
+
+    /// @brief Orders memory accesses between a thread and a signal handler or interrupt executed on it
+    /// @param order Memory order of the fence
+    /// @ingroup atomic
+    /// @see https://en.cppreference.com/w/cpp/atomic/atomic_signal_fence
+    inline void AtomicSignalFence(MemoryOrder order) {
+        #ifdef __WSTL_HAS_ATOMIC_BUILTINS__
+        __atomic_signal_fence(order);
+        #else
+        (void) order;
+        __private::__CompilerBarrier();
+        #endif
+    }
+
+    // Atomic storage
+
+    namespace __private {
+        /// @brief Checks whether atomic operations on T compile to lock-free instructions
+        template<typename T>
+        struct __IsAtomicLockFree : BoolConstant<
+            #ifdef __WSTL_HAS_ATOMIC_BUILTINS__
+            __atomic_always_lock_free(sizeof(T), 0)
+            #else
+            false
+            #endif
+        > {};
+
+        template<typename T, bool = __IsAtomicLockFree<T>::Value>
+        class __AtomicStorage;
+
+        // Compiler builtins
+
+        template<typename T>
+        class __AtomicStorage<T, true> {
+        public:
+            __AtomicStorage() : m_Value() {}
+            __AtomicStorage(T value) : m_Value(value) {}
+
+            T Load(MemoryOrder order) const {
+                T result;
+                __atomic_load(&m_Value, &result, order);
+                return result;
+            }
+
+            void Store(T value, MemoryOrder order) {
+                __atomic_store(&m_Value, &value, order);
+            }
+
+            T Exchange(T value, MemoryOrder order) {
+                T result;
+                __atomic_exchange(&m_Value, &value, &result, order);
+                return result;
+            }
+
+            bool CompareExchange(T& expected, T desired, bool weak, MemoryOrder success, MemoryOrder failure) {
+                return __atomic_compare_exchange(&m_Value, &expected, &desired, weak, success, failure);
+            }
+
+            template<typename U>
+            T FetchAdd(U value, MemoryOrder order) {
+                return __atomic_fetch_add(&m_Value, value, order);
+            }
+
+            template<typename U>
+            T FetchSub(U value, MemoryOrder order) {
+                return __atomic_fetch_sub(&m_Value, value, order);
+            }
+
+            T FetchAnd(T value, MemoryOrder order) {
+                return __atomic_fetch_and(&m_Value, value, order);
+            }
+
+            T FetchOr(T value, MemoryOrder order) {
+                return __atomic_fetch_or(&m_Value, value, order);
+            }
+
+            T FetchXor(T value, MemoryOrder order) {
+                return __atomic_fetch_xor(&m_Value, value, order);
+            }
+
+        private:
+            // Lock-free operations need natural alignment, which 8-byte types lack on some 32-bit ABIs
+            __WSTL_ALIGNAS__(sizeof(T)) T m_Value;
+        };
+
+        // Critical section
+
+        template<typename T>
+        class __AtomicStorage<T, false> {
+        public:
+            __AtomicStorage() : m_Value() {}
+            __AtomicStorage(T value) : m_Value(value) {}
+
+            T Load(MemoryOrder) const {
+                AtomicCriticalSection section;
+                return m_Value;
+            }
+
+            void Store(T value, MemoryOrder) {
+                AtomicCriticalSection section;
+                m_Value = value;
+            }
+
+            T Exchange(T value, MemoryOrder) {
+                AtomicCriticalSection section;
+                T result = m_Value;
+                m_Value = value;
+                return result;
+            }
+
+            bool CompareExchange(T& expected, T desired, bool, MemoryOrder, MemoryOrder) {
+                AtomicCriticalSection section;
+
+                // Bitwise comparison, like the builtins
+                const unsigned char* current = reinterpret_cast<const unsigned char*>(&m_Value);
+                const unsigned char* compare = reinterpret_cast<const unsigned char*>(&expected);
+
+                for(size_t i = 0; i < sizeof(T); ++i) {
+                    if(current[i] != compare[i]) {
+                        expected = m_Value;
+                        return false;
+                    }
+                }
+
+                m_Value = desired;
+                return true;
+            }
+
+            template<typename U>
+            T FetchAdd(U value, MemoryOrder) {
+                AtomicCriticalSection section;
+                T result = m_Value;
+                m_Value = Add(result, value, IsPointer<T>());
+                return result;
+            }
+
+            template<typename U>
+            T FetchSub(U value, MemoryOrder) {
+                AtomicCriticalSection section;
+                T result = m_Value;
+                m_Value = Add(result, -value, IsPointer<T>());
+                return result;
+            }
+
+            T FetchAnd(T value, MemoryOrder) {
+                AtomicCriticalSection section;
+                T result = m_Value;
+                m_Value = T(result & value);
+                return result;
+            }
+
+            T FetchOr(T value, MemoryOrder) {
+                AtomicCriticalSection section;
+                T result = m_Value;
+                m_Value = T(result | value);
+                return result;
+            }
+
+            T FetchXor(T value, MemoryOrder) {
+                AtomicCriticalSection section;
+                T result = m_Value;
+                m_Value = T(result ^ value);
+                return result;
+            }
+
+        private:
+            T m_Value;
+
+            // The builtins add bytes to pointers, so the pointer atomic passes byte offsets
+            template<typename U>
+            static T Add(T value, U offset, TrueType) {
+                return reinterpret_cast<T>(reinterpret_cast<unsigned char*>(value) + offset);
+            }
+
+            template<typename U>
+            static T Add(T value, U offset, FalseType) {
+                return T(value + offset);
+            }
+        };
+
+        // Atomic base
+
+        template<typename T>
+        class __AtomicBase {
+        public:
+            WSTL_STATIC_ASSERT(IsTriviallyCopyable<T>::Value, "Atomic type must be trivially copyable");
+
+            typedef T ValueType;
+
+            /// @brief Whether the operations are always lock-free on this target
+            static const __WSTL_CONSTEXPR__ bool IsAlwaysLockFree = __IsAtomicLockFree<T>::Value;
+
+            /// @brief Checks whether the operations are lock-free
+            bool IsLockFree() const __WSTL_NOEXCEPT__ {
+                return IsAlwaysLockFree;
+            }
+
+            /// @brief Atomically loads the value
+            /// @param order Memory order of the load, must not be release
+            T Load(MemoryOrder order = MEMORY_ORDER_SEQ_CST) const {
+                return m_Storage.Load(order);
+            }
+
+            /// @brief Atomically stores a value
+            /// @param value Value to store
+            /// @param order Memory order of the store, must not be acquire or consume
+            void Store(T value, MemoryOrder order = MEMORY_ORDER_SEQ_CST) {
+                m_Storage.Store(value, order);
+            }
+
+            /// @brief Atomically replaces the value
+            /// @param value Value to store
+            /// @param order Memory order of the operation
+            /// @return The previous value
+            T Exchange(T value, MemoryOrder order = MEMORY_ORDER_SEQ_CST) {
+                return m_Storage.Exchange(value, order);
+            }
+
+            /// @brief Atomically replaces the value if it equals the expected one, may fail spuriously
+            /// @param expected Value expected to be stored, receives the actual value on failure
+            /// @param desired Value to store on success
+            /// @param success Memory order if the values are equal
+            /// @param failure Memory order if the values are different
+            /// @return `true` if the value was replaced
+            bool CompareExchangeWeak(T& expected, T desired, MemoryOrder success, MemoryOrder failure) {
+                return m_Storage.CompareExchange(expected, desired, true, success, failure);
+            }
+
+            /// @brief Atomically replaces the value if it equals the expected one, may fail spuriously
+            /// @param expected Value expected to be stored, receives the actual value on failure
+            /// @param desired Value to store on success
+            /// @param order Memory order of the operation
+            /// @return `true` if the value was replaced
+            bool CompareExchangeWeak(T& expected, T desired, MemoryOrder order = MEMORY_ORDER_SEQ_CST) {
+                return m_Storage.CompareExchange(expected, desired, true, order, __FailureOrder(order));
+            }
+
+            /// @brief Atomically replaces the value if it equals the expected one
+            /// @param expected Value expected to be stored, receives the actual value on failure
+            /// @param desired Value to store on success
+            /// @param success Memory order if the values are equal
+            /// @param failure Memory order if the values are different
+            /// @return `true` if the value was replaced
+            bool CompareExchangeStrong(T& expected, T desired, MemoryOrder success, MemoryOrder failure) {
+                return m_Storage.CompareExchange(expected, desired, false, success, failure);
+            }
+
+            /// @brief Atomically replaces the value if it equals the expected one
+            /// @param expected Value expected to be stored, receives the actual value on failure
+            /// @param desired Value to store on success
+            /// @param order Memory order of the operation
+            /// @return `true` if the value was replaced
+            bool CompareExchangeStrong(T& expected, T desired, MemoryOrder order = MEMORY_ORDER_SEQ_CST) {
+                return m_Storage.CompareExchange(expected, desired, false, order, __FailureOrder(order));
+            }
+
+            /// @brief Atomically loads the value with sequentially consistent ordering
+            operator T() const {
+                return Load();
+            }
+
+        protected:
+            __AtomicStorage<T> m_Storage;
+
+            __AtomicBase() : m_Storage() {}
+            __AtomicBase(T value) : m_Storage(value) {}
+
+        private:
+            __AtomicBase(const __AtomicBase&) __WSTL_DELETE__;
+            __AtomicBase& operator=(const __AtomicBase&) __WSTL_DELETE__;
+        };
+
+        template<typename T>
+        const __WSTL_CONSTEXPR__ bool __AtomicBase<T>::IsAlwaysLockFree;
+
+        // Integral atomic
+
+        template<typename T>
+        class __AtomicIntegral : public __AtomicBase<T> {
+        public:
+            /// @brief Atomically adds to the value
+            /// @param value Value to add
+            /// @param order Memory order of the operation
+            /// @return The previous value
+            T FetchAdd(T value, MemoryOrder order = MEMORY_ORDER_SEQ_CST) {
+                return this->m_Storage.FetchAdd(value, order);
+            }
+
+            /// @brief Atomically subtracts from the value
+            /// @param value Value to subtract
+            /// @param order Memory order of the operation
+            /// @return The previous value
+            T FetchSub(T value, MemoryOrder order = MEMORY_ORDER_SEQ_CST) {
+                return this->m_Storage.FetchSub(value, order);
+            }
+
+            /// @brief Atomically performs bitwise AND with the value
+            /// @param value Second operand
+            /// @param order Memory order of the operation
+            /// @return The previous value
+            T FetchAnd(T value, MemoryOrder order = MEMORY_ORDER_SEQ_CST) {
+                return this->m_Storage.FetchAnd(value, order);
+            }
+
+            /// @brief Atomically performs bitwise OR with the value
+            /// @param value Second operand
+            /// @param order Memory order of the operation
+            /// @return The previous value
+            T FetchOr(T value, MemoryOrder order = MEMORY_ORDER_SEQ_CST) {
+                return this->m_Storage.FetchOr(value, order);
+            }
+
+            /// @brief Atomically performs bitwise XOR with the value
+            /// @param value Second operand
+            /// @param order Memory order of the operation
+            /// @return The previous value
+            T FetchXor(T value, MemoryOrder order = MEMORY_ORDER_SEQ_CST) {
+                return this->m_Storage.FetchXor(value, order);
+            }
+
+            T operator++() { return T(FetchAdd(T(1)) + T(1)); }
+            T operator++(int) { return FetchAdd(T(1)); }
+            T operator--() { return T(FetchSub(T(1)) - T(1)); }
+            T operator--(int) { return FetchSub(T(1)); }
+            T operator+=(T value) { return T(FetchAdd(value) + value); }
+            T operator-=(T value) { return T(FetchSub(value) - value); }
+            T operator&=(T value) { return T(FetchAnd(value) & value); }
+            T operator|=(T value) { return T(FetchOr(value) | value); }
+            T operator^=(T value) { return T(FetchXor(value) ^ value); }
+
+        protected:
+            __AtomicIntegral() : __AtomicBase<T>() {}
+            __AtomicIntegral(T value) : __AtomicBase<T>(value) {}
+        };
+
+        // Pointer atomic
+
+        template<typename T>
+        class __AtomicPointer : public __AtomicBase<T> {
+        public:
+            /// @brief Atomically advances the pointer
+            /// @param value Number of elements to advance by
+            /// @param order Memory order of the operation
+            /// @return The previous value
+            T FetchAdd(ptrdiff_t value, MemoryOrder order = MEMORY_ORDER_SEQ_CST) {
+                return this->m_Storage.FetchAdd(value * ElementSize(), order);
+            }
+
+            /// @brief Atomically moves the pointer back
+            /// @param value Number of elements to move back by
+            /// @param order Memory order of the operation
+            /// @return The previous value
+            T FetchSub(ptrdiff_t value, MemoryOrder order = MEMORY_ORDER_SEQ_CST) {
+                return this->m_Storage.FetchSub(value * ElementSize(), order);
+            }
+
+            T operator++() { return FetchAdd(1) + 1; }
+            T operator++(int) { return FetchAdd(1); }
+            T operator--() { return FetchSub(1) - 1; }
+            T operator--(int) { return FetchSub(1); }
+            T operator+=(ptrdiff_t value) { return FetchAdd(value) + value; }
+            T operator-=(ptrdiff_t value) { return FetchSub(value) - value; }
+
+        protected:
+            __AtomicPointer() : __AtomicBase<T>() {}
+            __AtomicPointer(T value) : __AtomicBase<T>(value) {}
+
+        private:
+            static ptrdiff_t ElementSize() {
+                return static_cast<ptrdiff_t>(sizeof(typename RemovePointer<T>::Type));
+            }
+        };
+
+        template<typename T>
+        struct __AtomicSelect {
+            typedef typename Conditional<IsIntegral<T>::Value && !IsSame<T, bool>::Value, __AtomicIntegral<T>,
+                typename Conditional<IsPointer<T>::Value, __AtomicPointer<T>, __AtomicBase<T> >::Type>::Type Type;
+        };
+    }
+
+    // Atomic
+
+    /// @brief Object whose value can be read and modified from several threads or interrupts without data races
+    /// @tparam T Type of the value, must be trivially copyable
+    /// @details Uses the `__atomic` builtins of GCC and Clang when they are lock-free for T,
+    /// otherwise every operation runs inside an `AtomicCriticalSection`. Integral types add
+    /// arithmetic and bitwise operations, pointers add arithmetic
+    /// @ingroup atomic
+    /// @see https://en.cppreference.com/w/cpp/atomic/atomic
+    template<typename T>
+    class Atomic : public __private::__AtomicSelect<T>::Type {
+    private:
+        typedef typename __private::__AtomicSelect<T>::Type Base;
+
+    public:
+        /// @brief Default constructor, value-initializes the value
+        Atomic() : Base() {}
+
+        /// @brief Constructor
+        /// @param value Initial value, stored without synchronization
+        Atomic(T value) : Base(value) {}
+
+        /// @brief Atomically stores a value with sequentially consistent ordering
+        /// @param value Value to store
+        /// @return The stored value
+        T operator=(T value) {
+            this->Store(value);
+            return value;
+        }
+
+    private:
+        /// @brief Deleted copy constructor
+        Atomic(const Atomic&) __WSTL_DELETE__;
+
+        /// @brief Deleted copy assignment operator
+        Atomic& operator=(const Atomic&) __WSTL_DELETE__;
+    };
+
+    // Atomic flag
+
+    /// @brief Atomic boolean flag, the simplest atomic type
+    /// @ingroup atomic
+    /// @see https://en.cppreference.com/w/cpp/atomic/atomic_flag
+    class AtomicFlag {
+    public:
+        /// @brief Constructor, the flag is cleared
+        AtomicFlag() : m_Flag(0) {}
+
+        /// @brief Atomically sets the flag
+        /// @param order Memory order of the operation
+        /// @return The previous state of the flag
+        bool TestAndSet(MemoryOrder order = MEMORY_ORDER_SEQ_CST) {
+            #ifdef __WSTL_HAS_ATOMIC_BUILTINS__
+            return __atomic_test_and_set(&m_Flag, order);
+            #else
+            (void) order;
+            AtomicCriticalSection section;
+            const bool result = m_Flag != 0;
+            m_Flag = 1;
+            return result;
+            #endif
+        }
+
+        /// @brief Atomically clears the flag
+        /// @param order Memory order of the operation, must not be acquire or consume
+        void Clear(MemoryOrder order = MEMORY_ORDER_SEQ_CST) {
+            #ifdef __WSTL_HAS_ATOMIC_BUILTINS__
+            __atomic_clear(&m_Flag, order);
+            #else
+            (void) order;
+            AtomicCriticalSection section;
+            m_Flag = 0;
+            #endif
+        }
+
+        /// @brief Atomically reads the flag
+        /// @param order Memory order of the operation, must not be release
+        bool Test(MemoryOrder order = MEMORY_ORDER_SEQ_CST) const {
+            #ifdef __WSTL_HAS_ATOMIC_BUILTINS__
+            return __atomic_load_n(&m_Flag, order) != 0;
+            #else
+            (void) order;
+            AtomicCriticalSection section;
+            return m_Flag != 0;
+            #endif
+        }
+
+    private:
+        unsigned char m_Flag;
+
+        /// @brief Deleted copy constructor
+        AtomicFlag(const AtomicFlag&) __WSTL_DELETE__;
+
+        /// @brief Deleted copy assignment operator
+        AtomicFlag& operator=(const AtomicFlag&) __WSTL_DELETE__;
+    };
+}
+
+#endif
\ No newline at end of file
@@ -71,16 +71,16 @@ namespace wstl {
     /// @ingroup string
     /// @see https://en.cppreference.com/w/cpp/string/basic_string
     template<typename Derived, typename T, typename Traits = CharacterTraits<T> >
-    class BasicString : public TypedContainerBase<T> {
+    class BasicString : public TypedContainerBase<void, T> {
     public:
         typedef Traits TraitsType;
-        typedef typename TypedContainerBase<T>::ValueType ValueType;
-        typedef typename TypedContainerBase<T>::SizeType SizeType;
-        typedef typename TypedContainerBase<T>::DifferenceType DifferenceType;
-        typedef typename TypedContainerBase<T>::ReferenceType ReferenceType;
-        typedef typename TypedContainerBase<T>::ConstReferenceType ConstReferenceType;
-        typedef typename TypedContainerBase<T>::PointerType PointerType;
-        typedef typename TypedContainerBase<T>::ConstPointerType ConstPointerType;
+        typedef typename TypedContainerBase<void, T>::ValueType ValueType;
+        typedef typename TypedContainerBase<void, T>::SizeType SizeType;
+        typedef typename TypedContainerBase<void, T>::DifferenceType DifferenceType;
+        typedef typename TypedContainerBase<void, T>::ReferenceType ReferenceType;
+        typedef typename TypedContainerBase<void, T>::ConstReferenceType ConstReferenceType;
+        typedef typename TypedContainerBase<void, T>::PointerType PointerType;
+        typedef typename TypedContainerBase<void, T>::ConstPointerType ConstPointerType;
 
         typedef T* Iterator;
         typedef const T* ConstIterator;
@@ -263,6 +263,7 @@ namespace wstl {
             #ifdef __WSTL_STRING_TRUNCATION_CHECK__
             if(count > this->Available()) {
                 m_Truncated = true;
+                this->RecordFailure();
 
                 #ifdef __WSTL_STRING_TRUNCATION_ERROR__
                 __WSTL_THROW__(WSTL_MAKE_EXCEPTION(LengthError, "String truncation"));
@@ -310,6 +311,7 @@ namespace wstl {
             #ifdef __WSTL_STRING_TRUNCATION_CHECK__
             if(SizeType(count) > this->Available()) {
                 m_Truncated = true;
+                this->RecordFailure();
 
                 #ifdef __WSTL_STRING_TRUNCATION_ERROR__
                 __WSTL_THROW__(WSTL_MAKE_EXCEPTION(LengthError, "String truncation"));
@@ -401,6 +403,7 @@ namespace wstl {
             if(this->m_CurrentSize >= this->m_Capacity) {
                 #ifdef __WSTL_STRING_TRUNCATION_CHECK__
                 m_Truncated = true;
+                this->RecordFailure();
 
                 #ifdef __WSTL_STRING_TRUNCATION_ERROR__
                 __WSTL_THROW__(WSTL_MAKE_EXCEPTION(LengthError, "String truncation"));
@@ -463,6 +466,16 @@ namespace wstl {
             return *this;
         }
 
+        /// @brief Inserts a range of characters at specified position, shifting the tail once
+        /// @param position Position to insert at (iterator)
+        /// @param range Range of characters to insert
+        /// @return Iterator to the first inserted character, or `position` if insertion failed
+        /// @throws `OutOfRange` if `position` is greater than the string size
+        template<typename Range>
+        inline Iterator InsertRange(ConstIterator position, const Range& range) {
+            return Insert(position, wstl::Begin(range), wstl::End(range));
+        }
+
         /// @brief Erases a range of characters from the string
         /// @param first Iterator to the first character to erase
         /// @param last Iterator to one past the last character to erase
@@ -518,6 +531,7 @@ namespace wstl {
             else {
                 #ifdef __WSTL_STRING_TRUNCATION_CHECK__
                 m_Truncated = true;
+                this->RecordFailure();
 
                 #ifdef __WSTL_STRING_TRUNCATION_ERROR__
                 __WSTL_THROW__(WSTL_MAKE_EXCEPTION(LengthError, "String truncation"));
@@ -545,6 +559,7 @@ namespace wstl {
             #ifdef __WSTL_STRING_TRUNCATION_CHECK__
             if(count > this->Available()) {
                 m_Truncated = true;
+                this->RecordFailure();
 
                 #ifdef __WSTL_STRING_TRUNCATION_ERROR__
                 __WSTL_THROW__(WSTL_MAKE_EXCEPTION(LengthError, "String truncation"));
@@ -576,6 +591,7 @@ namespace wstl {
             #ifdef __WSTL_STRING_TRUNCATION_CHECK__
             if(count > this->Available()) {
                 m_Truncated = true;
+                this->RecordFailure();
 
                 #ifdef __WSTL_STRING_TRUNCATION_ERROR__
                 __WSTL_THROW__(WSTL_MAKE_EXCEPTION(LengthError, "String truncation"));
@@ -666,6 +682,14 @@ namespace wstl {
             return Append(list.Begin(), list.End());
         }
         #endif
+
+        /// @brief Appends a range of characters to the end of the string
+        /// @param range Range of characters to append
+        /// @return Reference to this string
+        template<typename Range>
+        inline BasicString& AppendRange(const Range& range) {
+            return Append(wstl::Begin(range), wstl::End(range));
+        }
         
         /// @brief Addition combination operator for another string
         /// @param string String to append
@@ -998,6 +1022,7 @@ namespace wstl {
             #ifdef __WSTL_STRING_TRUNCATION_CHECK__
             if(count > this->m_Capacity) {
                 m_Truncated = true;
+                this->RecordFailure();
 
                 #ifdef __WSTL_STRING_TRUNCATION_ERROR__
                 __WSTL_THROW__(WSTL_MAKE_EXCEPTION(LengthError, "String truncation"));
@@ -1074,6 +1099,7 @@ namespace wstl {
             #ifdef __WSTL_STRING_TRUNCATION_CHECK__
             if(count > this->m_Capacity) {
                 m_Truncated = true;
+                this->RecordFailure();
 
                 #ifdef __WSTL_STRING_TRUNCATION_ERROR__
                 __WSTL_THROW__(WSTL_MAKE_EXCEPTION(LengthError, "String truncation"));
@@ -1111,6 +1137,7 @@ namespace wstl {
             #ifdef __WSTL_STRING_TRUNCATION_CHECK__
             if(count > this->m_Capacity) {
                 m_Truncated = true;
+                this->RecordFailure();
 
                 #ifdef __WSTL_STRING_TRUNCATION_ERROR__
                 __WSTL_THROW__(WSTL_MAKE_EXCEPTION(LengthError, "String truncation"));
@@ -1287,6 +1314,13 @@ namespace wstl {
         SizeType Find(const T* string, SizeType position, SizeType count) const {
             if(position + count > this->Size()) return NoPosition;
 
+            if(count >= __private::__SEARCHER_THRESHOLD) {
+                const T* end = Data() + this->Size();
+                const T* result = BoyerMooreHorspoolSearcher<const T*, uint8_t>(string, string + count)(Data() + position, end).First;
+
+                return result == end ? NoPosition : static_cast<SizeType>(result - Data());
+            }
+
             ConstIterator iterator = Search(Begin() + position, End(), string, string + count);
             if(iterator == End()) return NoPosition;
 
@@ -1300,10 +1334,10 @@ namespace wstl {
         SizeType Find(T ch, SizeType position = 0) const {
             if(position + 1 > this->Size()) return NoPosition;
 
-            ConstIterator iterator = wstl::Find(Begin() + position, End(), ch);
-            if(iterator == End()) return NoPosition;
+            const T* pointer = TraitsType::Find(m_Buffer + position, this->Size() - position, ch);
+            if(pointer == 0) return NoPosition;
 
-            return Distance(Begin(), iterator);
+            return static_cast<SizeType>(pointer - m_Buffer);
         }
 
         /// @brief Finds the first occurrence of a substring
@@ -1411,12 +1445,7 @@ namespace wstl {
         /// @param position Position to start the search from (default is 0)
         /// @return The position of the first occurrence, or `NoPosition` if not found
         SizeType FindFirstOf(T ch, SizeType position = 0) const {
-            if(position < this->Size()) {
-                for(size_t i = position; i < this->Size(); ++i) 
-                    if(m_Buffer[i] == ch) return i;
-            }
-
-            return NoPosition;
+            return Find(ch, position);
         }
 
         /// @brief Finds the first occurrence of any character from another string
@@ -1829,7 +1858,7 @@ namespace wstl {
         /// @brief Protected constructor
         /// @param buffer Pointer to the character buffer
         /// @param capacity Capacity of the buffer
-        BasicString(T* buffer, SizeType capacity) : TypedContainerBase<T>(capacity), m_Buffer(buffer), m_Truncated(false) {
+        BasicString(T* buffer, SizeType capacity) : TypedContainerBase<void, T>(capacity), m_Buffer(buffer), m_Truncated(false) {
             m_Buffer[0] = 0;
         }
 
@@ -1837,7 +1866,7 @@ namespace wstl {
         /// @brief Protected constructor
         /// @param buffer Pointer to the character buffer
         /// @param capacity Capacity of the buffer
-        BasicString(T* buffer, SizeType capacity) : TypedContainerBase<T>(capacity), m_Buffer(buffer) {
+        BasicString(T* buffer, SizeType capacity) : TypedContainerBase<void, T>(capacity), m_Buffer(buffer) {
             m_Buffer[0] = 0;
         }
 
@@ -1941,6 +1970,7 @@ namespace wstl {
             #ifdef __WSTL_STRING_TRUNCATION_CHECK__
             if(truncated || (insertCount != count && string != NullPointer) || (tailSpace < tailCount)) {
                 m_Truncated = true;
+                this->RecordFailure();
 
                 #ifdef __WSTL_STRING_TRUNCATION_ERROR__
                 __WSTL_THROW__(WSTL_MAKE_EXCEPTION(LengthError, "Replace truncation"));
@@ -0,0 +1,358 @@
+// Part of WardenSTL - https://github.com/WardenHD/WardenSTL
+// Copyright (c) 2025 Artem Bezruchko (WardenHD)
+//
+// Licensed under the MIT License. See LICENSE file for details.
+
+#ifndef __WSTL_BENCHMARK_HPP__
+#define __WSTL_BENCHMARK_HPP__
+
+#include "private/Platform.hpp"
+#include "NullPointer.hpp"
+#include "Algorithm.hpp"
+#include "Format.hpp"
+#include "StaticAssert.hpp"
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <time.h>
+#endif
+
+
+/// @defgroup benchmark Benchmark
+/// @brief Microbenchmark harness with pluggable cycle counters
+
+// Defines introduced
+
+/// @def __WSTL_BENCHMARK_DWT__
+/// @brief Defined when the target is an ARM M-profile core, which has the DWT cycle counter
+/// @ingroup benchmark
+
+/// @def __WSTL_BENCHMARK_TSC__
+/// @brief Defined when the target is x86 and the compiler is GCC or Clang, so `rdtsc` is available
+/// @ingroup benchmark
+
+/// @def __WSTL_BENCHMARK_MONOTONIC_CLOCK__
+/// @brief Defined when `clock_gettime` with `CLOCK_MONOTONIC` is available
+/// @ingroup benchmark
+
+#if defined(__ARM_ARCH_PROFILE) && __ARM_ARCH_PROFILE == 'M' || defined(__ARM_ARCH_6M__) || defined(__ARM_ARCH_7M__) || \
+    defined(__ARM_ARCH_7EM__) || defined(__ARM_ARCH_8M_MAIN__) || defined(__ARM_ARCH_8M_BASE__) || defined(__DOXYGEN__)
+    #define __WSTL_BENCHMARK_DWT__
+#endif
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__WSTL_GCC__) || defined(__WSTL_CLANG__)) || defined(__DOXYGEN__)
+    #define __WSTL_BENCHMARK_TSC__
+#endif
+
+#if (defined(__unix__) || defined(__APPLE__)) && defined(CLOCK_MONOTONIC) || defined(__DOXYGEN__)
+    #define __WSTL_BENCHMARK_MONOTONIC_CLOCK__
+#endif
+
+namespace wstl {
+    namespace bench {
+        // Optimization barriers
+
+        #if defined(__WSTL_GCC__) || defined(__WSTL_CLANG__)
+        /// @brief Makes the compiler assume the value is read, so the computation of it is not removed
+        /// @param value The value that must be computed
+        /// @ingroup benchmark
+        template<typename T>
+        inline void DoNotOptimize(const T& value) {
+            __asm__ __volatile__("" : : "r,m"(value) : "memory");
+        }
+
+        /// @brief Makes the compiler assume the value is read and modified, so it is neither removed
+        /// nor kept in a register across iterations
+        /// @param value The value that must be computed
+        /// @ingroup benchmark
+        template<typename T>
+        inline void DoNotOptimize(T& value) {
+            __asm__ __volatile__("" : "+m"(value) : : "memory");
+        }
+
+        /// @brief Makes the compiler assume all memory is read and written, so pending stores are done
+        /// @ingroup benchmark
+        inline void ClobberMemory() {
+            __asm__ __volatile__("" : : : "memory");
+        }
+        #else
+        namespace __private {
+            inline const volatile void*& __BenchmarkSink() {
+                static const volatile void* sink = NullPointer;
+                return sink;
+            }
+        }
+
+        /// @brief Makes the compiler assume the value is read, so the computation of it is not removed
+        /// @param value The value that must be computed
+        /// @ingroup benchmark
+        template<typename T>
+        inline void DoNotOptimize(const T& value) {
+            __private::__BenchmarkSink() = &value;
+        }
+
+        /// @brief Makes the compiler assume all memory is read and written, so pending stores are done
+        /// @ingroup benchmark
+        inline void ClobberMemory() {
+            __private::__BenchmarkSink() = NullPointer;
+        }
+        #endif
+
+        // Cycle counters
+
+        // A counter has a `ValueType`, a static `Initialize` called once by the runner,
+        // a static `Now` and a static `Unit` naming what it counts
+
+        #ifdef __WSTL_BENCHMARK_DWT__
+        /// @brief Counts core cycles with the `CYCCNT` register of the Data Watchpoint and Trace unit of Cortex-M3 and later
+        /// @details The counter is 32 bits wide, so a single measurement must be shorter than 2^32 cycles.
+        /// Cortex-M0 and M0+ have no cycle counter, `Initialize` then has no effect and `Now` returns zero
+        /// @ingroup benchmark
+        struct DWTCycleCounter {
+            typedef uint32_t ValueType;
+
+            static void Initialize() {
+                Register(0xE000EDFCu) |= 1u << 24;  // DEMCR.TRCENA enables the trace units
+                Register(0xE0001FB0u) = 0xC5ACCE55u; // Unlock the DWT on cores that have a lock
+                Register(0xE0001004u) = 0;
+                Register(0xE0001000u) |= 1u;        // DWT_CTRL.CYCCNTENA
+            }
+
+            static ValueType Now() {
+                return Register(0xE0001004u);
+            }
+
+            static const char* Unit() {
+                return "cycles";
+            }
+
+        private:
+            static volatile uint32_t& Register(uintptr_t address) {
+                return *reinterpret_cast<volatile uint32_t*>(address);
+            }
+        };
+        #endif
+
+        #ifdef __WSTL_BENCHMARK_TSC__
+        /// @brief Reads the time stamp counter with `rdtsc`, after an `lfence` that waits for earlier instructions
+        /// @details Modern processors tick the counter at a constant rate, not with the core clock
+        /// @ingroup benchmark
+        struct TimeStampCounter {
+            typedef uint64_t ValueType;
+
+            static void Initialize() {}
+
+            static ValueType Now() {
+                uint32_t low, high;
+                __asm__ __volatile__("lfence\n\trdtsc" : "=a"(low), "=d"(high) : : "memory");
+
+                return (uint64_t(high) << 32) | low;
+            }
+
+            static const char* Unit() {
+                return "ticks";
+            }
+        };
+        #endif
+
+        #ifdef __WSTL_BENCHMARK_MONOTONIC_CLOCK__
+        /// @brief Measures nanoseconds with `clock_gettime(CLOCK_MONOTONIC)`
+        /// @ingroup benchmark
+        struct MonotonicClock {
+            typedef uint64_t ValueType;
+
+            static void Initialize() {}
+
+            static ValueType Now() {
+                timespec time;
+                clock_gettime(CLOCK_MONOTONIC, &time);
+
+                return uint64_t(time.tv_sec) * 1000000000u + uint64_t(time.tv_nsec);
+            }
+
+            static const char* Unit() {
+                return "ns";
+            }
+        };
+        #endif
+
+        #if defined(__WSTL_BENCHMARK_DWT__)
+        /// @brief Counter used when none is given, the most precise one available on the target
+        /// @ingroup benchmark
+        typedef DWTCycleCounter DefaultCounter;
+        #define __WSTL_BENCHMARK_DEFAULT_COUNTER__
+        #elif defined(__WSTL_BENCHMARK_MONOTONIC_CLOCK__)
+        typedef MonotonicClock DefaultCounter;
+        #define __WSTL_BENCHMARK_DEFAULT_COUNTER__
+        #elif defined(__WSTL_BENCHMARK_TSC__)
+        typedef TimeStampCounter DefaultCounter;
+        #define __WSTL_BENCHMARK_DEFAULT_COUNTER__
+        #endif
+
+        // Options
+
+        /// @brief How a benchmark is run
+        /// @ingroup benchmark
+        struct Options {
+            /// @brief Number of untimed batches run first to warm up caches and branch predictors
+            uint32_t Warmup;
+            /// @brief Number of timed batches, the minimum, median and maximum over them are reported
+            uint32_t Repetitions;
+            /// @brief Calls per batch, zero to double them until a batch takes `MinimumTicks`
+            uint64_t Iterations;
+            /// @brief Shortest batch, in counter units, when the iterations are calibrated
+            uint64_t MinimumTicks;
+
+            /// @brief Default constructor, one warm-up batch and nine calibrated batches of at least a million ticks
+            Options() : Warmup(1), Repetitions(9), Iterations(0), MinimumTicks(1000000) {}
+        };
+
+        // Result
+
+        /// @brief Measurement of one benchmark, times are per call
+        /// @ingroup benchmark
+        struct Result {
+            /// @brief Name of the benchmark
+            const char* Name;
+            /// @brief Calls per batch
+            uint64_t Iterations;
+            /// @brief Number of timed batches
+            uint32_t Repetitions;
+            /// @brief Time of a call in the fastest batch
+            double Minimum;
+            /// @brief Median time of a call over the batches
+            double Median;
+            /// @brief Time of a call in the slowest batch
+            double Maximum;
+            /// @brief Unit of the times, from the counter
+            const char* Unit;
+        };
+
+        // Runner
+
+        /// @brief Runs benchmarks and reports every result as one line of JSON
+        /// @tparam Counter The cycle counter, see `DefaultCounter`
+        /// @tparam MaxRepetitions Largest number of timed batches, their times are kept inside the runner
+        /// @details Each benchmark is a callable run `Iterations` times per batch. It should pass its results
+        /// to `DoNotOptimize` so they are not optimized away. A line looks like
+        /// `{"name":"sort/random/1024","iterations":512,"repetitions":9,"min":41.2,"median":41.9,"max":45.0,"unit":"ns"}`,
+        /// names are written as they are and must not need escaping. Nothing is allocated, the line is
+        /// formatted into a buffer in the runner and passed to the output function, which can write to
+        /// `stdout`, a UART or a trace channel
+        /// @ingroup benchmark
+        template<typename Counter
+        #ifdef __WSTL_BENCHMARK_DEFAULT_COUNTER__
+            = DefaultCounter
+        #endif
+            , size_t MaxRepetitions = 64>
+        class Runner {
+        public:
+            WSTL_STATIC_ASSERT(MaxRepetitions > 0, "Runner must keep at least one repetition");
+
+            typedef typename Counter::ValueType TickType;
+
+            /// @brief Function that receives the report lines
+            typedef void (*OutputFunction)(const char* text, size_t size);
+
+            /// @brief Constructor, initializes the counter
+            /// @param output The function that receives a line per benchmark, or null pointer for no report
+            /// @param options The options used by `Run` without explicit options
+            explicit Runner(OutputFunction output = NullPointer, const Options& options = Options()) : m_Output(output), m_Options(options) {
+                Counter::Initialize();
+            }
+
+            /// @brief Gets the options used by `Run` without explicit options
+            const Options& GetOptions() const {
+                return m_Options;
+            }
+
+            /// @brief Sets the options used by `Run` without explicit options
+            void SetOptions(const Options& options) {
+                m_Options = options;
+            }
+
+            /// @brief Measures a callable with the default options
+            /// @param name The name printed in the report
+            /// @param function The callable to measure, called without arguments
+            /// @return The measurement
+            template<typename Function>
+            Result Run(const char* name, Function function) {
+                return Run(name, function, m_Options);
+            }
+
+            /// @brief Measures a callable
+            /// @param name The name printed in the report
+            /// @param function The callable to measure, called without arguments
+            /// @param options How to run it
+            /// @return The measurement
+            template<typename Function>
+            Result Run(const char* name, Function function, const Options& options) {
+                const uint32_t repetitions = options.Repetitions == 0 ? 1 :
+                    options.Repetitions > MaxRepetitions ? uint32_t(MaxRepetitions) : options.Repetitions;
+                const uint64_t iterations = options.Iterations != 0 ? options.Iterations : Calibrate(function, options.MinimumTicks);
+
+                for(uint32_t i = 0; i < options.Warmup; ++i) Batch(function, iterations);
+                for(uint32_t i = 0; i < repetitions; ++i) m_Ticks[i] = Batch(function, iterations);
+
+                Sort(m_Ticks, m_Ticks + repetitions);
+
+                const double count = static_cast<double>(iterations);
+                const uint32_t middle = repetitions / 2;
+
+                Result result;
+                result.Name = name;
+                result.Iterations = iterations;
+                result.Repetitions = repetitions;
+                result.Minimum = static_cast<double>(m_Ticks[0]) / count;
+                result.Maximum = static_cast<double>(m_Ticks[repetitions - 1]) / count;
+                result.Median = (repetitions % 2 != 0 ? static_cast<double>(m_Ticks[middle]) :
+                    (static_cast<double>(m_Ticks[middle - 1]) + static_cast<double>(m_Ticks[middle])) / 2.0) / count;
+                result.Unit = Counter::Unit();
+
+                Report(result);
+                return result;
+            }
+
+            /// @brief Writes a result as one line of JSON to the output function
+            /// @param result The result to write
+            void Report(const Result& result) {
+                if(m_Output == NullPointer) return;
+
+                char* const last = m_Line + sizeof(m_Line) - 1;
+                char* out = FormatToN(m_Line, size_t(last - m_Line), "{{\"name\":\"{}\",\"iterations\":{},\"repetitions\":{},",
+                    result.Name, result.Iterations, result.Repetitions).Output;
+                out = FormatToN(out, size_t(last - out), "\"min\":{:.3f},\"median\":{:.3f},\"max\":{:.3f},",
+                    result.Minimum, result.Median, result.Maximum).Output;
+                out = FormatToN(out, size_t(last - out), "\"unit\":\"{}\"}}", result.Unit).Output;
+                *out++ = '\n';
+
+                m_Output(m_Line, size_t(out - m_Line));
+            }
+
+        private:
+            OutputFunction m_Output;
+            Options m_Options;
+            TickType m_Ticks[MaxRepetitions];
+            char m_Line[256];
+
+            template<typename Function>
+            static TickType Batch(Function& function, uint64_t iterations) {
+                const TickType start = Counter::Now();
+                for(uint64_t i = 0; i < iterations; ++i) function();
+
+                return TickType(Counter::Now() - start);
+            }
+
+            template<typename Function>
+            static uint64_t Calibrate(Function& function, uint64_t minimum) {
+                uint64_t iterations = 1;
+
+                while(iterations < (uint64_t(1) << 40) && static_cast<uint64_t>(Batch(function, iterations)) < minimum) iterations *= 2;
+                return iterations;
+            }
+        };
+    }
+}
+
+#endif
\ No newline at end of file
@@ -1313,7 +1313,7 @@ namespace wstl {
             static const __WSTL_CONSTEXPR__ T Value3 = (Value2 >> 4) & 0x0F0F | (Value2 << 4) & 0xF0F0;
         
         public:
-            static const __WSTL_CONSTEXPR__ T Value = (Value3 >> 8) | (Value3 << 8);
+            static const __WSTL_CONSTEXPR__ T Value = static_cast<T>((Value3 >> 8) | (Value3 << 8));
         };
 
         template<typename T, T N>
@@ -22,21 +22,16 @@
 /// @ingroup containers
 /// @brief A fixed-size sequence of bits
 
-// Defines introduced
-
-/// @def __WSTL_BITSET_USE_CTZ___
-/// @brief Define to enable use of `CountRightZero` function in bitset find functions
-/// @details This define best works with `__WSTL_BIT_USE_BUILTIN__` defined. 
-/// These two defines improve the performance of find functions at the cost of constexpr-ness.
-/// @ingroup bitset
-#ifdef __DOXYGEN__
-    #define __WSTL_BITSET_USE_CTZ___ 
-#endif
-
 namespace wstl {
     // Bitset internal classes
 
     namespace __private {
+        /// @brief Native word used as bitset storage where scanning speed matters more than size
+        typedef size_t __BitsetWord;
+
+        /// @brief Number of elements OR-reduced at once to skip empty regions while scanning
+        static const __WSTL_CONSTEXPR__ size_t __BITSET_SCAN_GROUP = 4;
+
         template<size_t N, typename T>
         class __BitsetCommon {
         public:
@@ -60,6 +55,60 @@ namespace wstl {
         public:
             typedef Span<T, NumberOfElements> SpanType;
             typedef Span<const T, NumberOfElements> ConstSpanType;    
+
+        protected:
+            /// @brief Gets an element with the bits past `N` cleared, inverted when `invert` is all set
+            static __WSTL_CONSTEXPR14__ ElementType Element(ConstPointerType bits, SizeType index, ElementType invert) __WSTL_NOEXCEPT__ {
+                const ElementType element = ElementType(bits[index] ^ invert);
+                return (index == NumberOfElements - 1) ? ElementType(element & TopMask) : element;
+            }
+
+            /// @brief Skips groups of elements that have no bit of interest
+            /// @details The OR-reduction over a group has no branches, so the compiler is free to vectorize it. 
+            /// The last element is never skipped, it is the only one with bits past `N`
+            static __WSTL_CONSTEXPR14__ SizeType SkipEmpty(ConstPointerType bits, SizeType index, ElementType invert) __WSTL_NOEXCEPT__ {
+                while(index + __BITSET_SCAN_GROUP < NumberOfElements) {
+                    ElementType reduced = AllClear;
+                    for(SizeType i = 0; i < __BITSET_SCAN_GROUP; ++i) reduced |= ElementType(bits[index + i] ^ invert);
+                    
+                    if(reduced != AllClear) break;
+                    index += __BITSET_SCAN_GROUP;
+                }
+
+                return index;
+            }
+
+            /// @brief Finds the next bit equal to the given value, word by word using `CountRightZero`
+            /// @param invert `AllClear` to look for set bits, `AllSet` to look for cleared bits
+            static __WSTL_CONSTEXPR14__ SizeType Scan(ConstPointerType bits, SizeType position, ElementType invert) __WSTL_NOEXCEPT__ {
+                if(position >= N) return NoPosition;
+
+                SizeType index = position / BitsPerElement;
+                ElementType block = ElementType(Element(bits, index, invert) & ElementType(AllSet << (position % BitsPerElement)));
+
+                while(block == AllClear) {
+                    if(++index == NumberOfElements) return NoPosition;
+
+                    index = SkipEmpty(bits, index, invert);
+                    block = Element(bits, index, invert);
+                }
+
+                return index * BitsPerElement + CountRightZero(block);
+            }
+
+            /// @brief Calls a function with the position of every set bit in ascending order
+            template<typename Function>
+            static __WSTL_CONSTEXPR14__ Function ForEachSet(ConstPointerType bits, Function function) {
+                for(SizeType index = SkipEmpty(bits, 0, AllClear); index < NumberOfElements; index = SkipEmpty(bits, index + 1, AllClear)) {
+                    ElementType block = Element(bits, index, AllClear);
+
+                    // Clear the lowest set bit on each step
+                    for(; block != AllClear; block = ElementType(block & (block - 1))) 
+                        function(index * BitsPerElement + CountRightZero(block));
+                }
+
+                return function;
+            }
         };
 
         template<size_t N, typename T>
@@ -123,7 +172,7 @@ namespace wstl {
             }
 
             static __WSTL_CONSTEXPR14__ bool All(ConstPointerType bits) __WSTL_NOEXCEPT__ {
-                return (*bits & TopMask) == AllSet;
+                return (*bits & TopMask) == TopMask;
             }
 
             static __WSTL_CONSTEXPR14__ bool Any(ConstPointerType bits) __WSTL_NOEXCEPT__ {
@@ -153,19 +202,19 @@ namespace wstl {
 
             static __WSTL_CONSTEXPR14__ void Set(PointerType bits, SizeType position, bool value) {
                 if(value) *bits |= (ElementType(1) << position);
-                *bits &= ~(ElementType(1) << position);
+                else *bits &= ~(ElementType(1) << position);
             }
 
             template<size_t Position>
             static __WSTL_CONSTEXPR14__ void Set(PointerType bits, bool value) {
                 if(value) *bits |= (ElementType(1) << Position);
-                *bits &= ~(ElementType(1) << Position);
+                else *bits &= ~(ElementType(1) << Position);
             }
 
             template<size_t Position, bool Value>
             static __WSTL_CONSTEXPR14__ void Set(PointerType bits) {
                 if(Value) *bits |= (ElementType(1) << Position);
-                *bits &= ~(ElementType(1) << Position);
+                else *bits &= ~(ElementType(1) << Position);
             }
 
             static __WSTL_CONSTEXPR14__ void Reset(PointerType bits) __WSTL_NOEXCEPT__ {
@@ -264,26 +313,17 @@ namespace wstl {
             }
 
             static __WSTL_CONSTEXPR14__ SizeType FindNext(ConstPointerType bits, SizeType position, bool value) __WSTL_NOEXCEPT__ {
-                #ifdef __WSTL_BITSET_USE_CTZ___
-                if(position < N) {
-                    ElementType block = (value) ? *bits : ~(*bits);
-                    block &= ElementType(~0 << position);
+                return Base::Scan(bits, position, value ? AllClear : AllSet);
+            }
 
-                    if(block != 0) return CountRightZero(block); 
-                }
-                #else
-                if((value && *bits != AllClear) || (!value && *bits != AllSet)) {
-                    ElementType mask = ElementType(1) << position;
-
-                    while(position < N) {
-                        if(((*bits & mask) != 0) == value) return position;
-                        mask <<= 1;
-                        ++position;
-                    }
-                }
-                #endif
+            template<bool Value>
+            static __WSTL_CONSTEXPR14__ SizeType FindNext(ConstPointerType bits, SizeType position) __WSTL_NOEXCEPT__ {
+                return Base::Scan(bits, position, Value ? AllClear : AllSet);
+            }
 
-                return NoPosition;
+            template<typename Function>
+            static __WSTL_CONSTEXPR14__ Function ForEachSet(ConstPointerType bits, Function function) {
+                return Base::ForEachSet(bits, function);
             }
 
             static __WSTL_CONSTEXPR14__ void Swap(PointerType bits1, PointerType bits2) __WSTL_NOEXCEPT__ {
@@ -334,7 +374,7 @@ namespace wstl {
                 for(SizeType i = 1; i < NumberOfElements; ++i)
                     if(*bits++ != AllSet) return false;
 
-                return (*bits & TopMask) == AllSet;
+                return (*bits & TopMask) == TopMask;
             }
 
             static __WSTL_CONSTEXPR14__ bool Any(ConstPointerType bits) __WSTL_NOEXCEPT__ {
@@ -599,100 +639,17 @@ namespace wstl {
             }
 
             static __WSTL_CONSTEXPR14__ SizeType FindNext(ConstPointerType bits, SizeType position, bool value) __WSTL_NOEXCEPT__ {
-                #ifdef __WSTL_BITSET_USE_CTZ___
-                if(position < N) {
-                    const SizeType bitPosition = position & (BitsPerElement - 1);
-                    SizeType blockPosition = position >> Logarithm2<BitsPerElement>::Value;
-
-                    const ElementType invertMask = (value) ? ElementType(0) : ElementType(~0);
-
-                    ElementType block = bits[blockPosition] ^ invertMask;
-                    block &= ElementType(~0 << bitPosition);
-
-                    while(blockPosition < NumberOfElements) {
-                        if(block != 0) {
-                            uint_least8_t ctz = CountRightZero(block);
-                            return (blockPosition << Logarithm2<BitsPerElement>::Value) + ctz;
-                        }
-
-                        block = bits[++blockPosition] ^ invertMask;
-                    }
-                }
-                #else
-                if(position < N) {
-                    SizeType bitPosition = position & (BitsPerElement - 1);
-                    SizeType blockPosition = position >> Logarithm2<BitsPerElement>::Value;
-
-                    ElementType mask = ElementType(1) << bitPosition;
-
-                    while(blockPosition < NumberOfElements) {
-                        ElementType block = bits[blockPosition++];
-
-                        if((value && block != AllClear) || (!value && block != AllSet)) {
-                            while(bitPosition++ < BitsPerElement && position < N) {
-                                if(((block & mask) != 0) == value) return position;
-                                mask <<= 1;
-                                ++position;
-                            }
-                        } 
-                        else position += (BitsPerElement - bitPosition);
-
-                        bitPosition = 0;
-                        mask = 1;
-                    }
-                }
-                #endif
-
-                return NoPosition;
+                return Base::Scan(bits, position, value ? AllClear : AllSet);
             }
 
             template<bool Value>
             static __WSTL_CONSTEXPR14__ SizeType FindNext(ConstPointerType bits, SizeType position) __WSTL_NOEXCEPT__ {
-                #ifdef __WSTL_BITSET_USE_CTZ___
-                if(position < N) {
-                    const SizeType bitPosition = position & (BitsPerElement - 1);
-                    SizeType blockPosition = position >> Logarithm2<BitsPerElement>::Value;
-
-                    const ElementType invertMask = (Value) ? ElementType(0) : ElementType(~0);
-
-                    ElementType block = bits[blockPosition] ^ invertMask;
-                    block &= ElementType(~0 << bitPosition);
-
-                    while(blockPosition < NumberOfElements) {
-                        if(block != 0) {
-                            uint_least8_t ctz = CountRightZero(block);
-                            return (blockPosition << Logarithm2<BitsPerElement>::Value) + ctz;
-                        }
-
-                        block = bits[++blockPosition] ^ invertMask;
-                    }
-                }
-                #else
-                if(position < N) {
-                    SizeType bitPosition = position & (BitsPerElement - 1);
-                    SizeType blockPosition = position >> Logarithm2<BitsPerElement>::Value;
-
-                    ElementType mask = ElementType(1) << bitPosition;
-
-                    while(blockPosition < NumberOfElements) {
-                        ElementType block = bits[blockPosition++];
-
-                        if((Value && block != AllClear) || (!Value && block != AllSet)) {
-                            while(bitPosition++ < BitsPerElement && position < N) {
-                                if(((block & mask) != 0) == Value) return position;
-                                mask <<= 1;
-                                ++position;
-                            }
-                        } 
-                        else position += (BitsPerElement - bitPosition);
-
-                        bitPosition = 0;
-                        mask = 1;
-                    }
-                }
-                #endif
+                return Base::Scan(bits, position, Value ? AllClear : AllSet);
+            }
 
-                return NoPosition;
+            template<typename Function>
+            static __WSTL_CONSTEXPR14__ Function ForEachSet(ConstPointerType bits, Function function) {
+                return Base::ForEachSet(bits, function);
             }
 
             static __WSTL_CONSTEXPR14__ void Swap(PointerType bits1, PointerType bits2) {
@@ -1108,6 +1065,16 @@ namespace wstl {
             return Base::template FindNext<Value>(m_Bits, ++position);
         }
 
+        /// @brief Calls a function with the position of every set bit in ascending order
+        /// @param function Unary function that takes the position of a set bit
+        /// @return The function after it was called for every set bit
+        /// @details Visits whole elements at a time and skips empty regions, which is 
+        /// cheaper than a chain of `FindNext` calls for sparse bitsets
+        template<typename Function>
+        __WSTL_CONSTEXPR14__ Function ForEachSet(Function function) const {
+            return Base::ForEachSet(m_Bits, function);
+        }
+
         /// @brief Swaps the contents of this bitset with another
         /// @param other Other bitset to swap with
         __WSTL_CONSTEXPR14__ void Swap(Bitset& other) __WSTL_NOEXCEPT__ {
@@ -1224,9 +1191,12 @@ namespace wstl {
     // Hash specialization
 
     template<size_t N, typename T>
-    struct Hash<Bitset<N, T> > {
+    struct Hash<Bitset<N, T> > : __private::__SeededHash {
+        Hash() : __SeededHash(0) {}
+        explicit Hash(size_t seed) : __SeededHash(seed) {}
+
         size_t operator()(const Bitset<N, T>& bitset) const {
-            return __private::__GenericHash<size_t>(reinterpret_cast<const uint8_t*>(bitset.m_Bits), reinterpret_cast<const uint8_t*>(bitset.m_Bits + bitset.NumberOfElements));
+            return HashBytes(bitset.m_Bits, sizeof(bitset.m_Bits[0]) * bitset.NumberOfElements);
         }
     };
 
@@ -1731,6 +1701,16 @@ namespace wstl {
                 return Base::template FindNext<Value>(m_Bits, ++position);
             }
 
+            /// @brief Calls a function with the position of every set bit in ascending order
+            /// @param function Unary function that takes the position of a set bit
+            /// @return The function after it was called for every set bit
+            /// @details Visits whole elements at a time and skips empty regions, which is 
+            /// cheaper than a chain of `FindNext` calls for sparse bitsets
+            template<typename Function>
+            __WSTL_CONSTEXPR14__ Function ForEachSet(Function function) const {
+                return Base::ForEachSet(m_Bits, function);
+            }
+
             /// @brief Swaps the contents of this bitset with another
             /// @param other Other bitset to swap with
             __WSTL_CONSTEXPR14__ void Swap(Bitset& other) __WSTL_NOEXCEPT__ {
@@ -1841,9 +1821,12 @@ namespace wstl {
     // Hash specialization
 
     template<size_t N, typename T>
-    struct Hash<external::Bitset<N, T> > {
+    struct Hash<external::Bitset<N, T> > : __private::__SeededHash {
+        Hash() : __SeededHash(0) {}
+        explicit Hash(size_t seed) : __SeededHash(seed) {}
+
         size_t operator()(const external::Bitset<N, T>& bitset) const {
-            return __private::__GenericHash<size_t>(reinterpret_cast<const uint8_t*>(bitset.m_Bits), reinterpret_cast<const uint8_t*>(bitset.m_Bits + bitset.NumberOfElements));
+            return HashBytes(bitset.m_Bits, sizeof(bitset.m_Bits[0]) * bitset.NumberOfElements);
         }
     };
 }
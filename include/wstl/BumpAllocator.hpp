@@ -13,8 +13,15 @@
 
 
 namespace wstl {
+    /// @brief Allocator that hands out memory by moving a pointer forward
+    /// @details Memory is reclaimed all at once with `Reset`, or back to a point taken with
+    /// `GetMarker` using `Rewind`. `Free` does nothing
+    /// @ingroup allocator
     class BumpAllocator : public Allocator {
     public:
+        /// @brief Position in the allocator that it can be rewound to
+        typedef size_t Marker;
+
         /// @brief Constructor
         /// @param base The base address of the memory block
         /// @param limit The limit of the memory block
@@ -22,23 +29,195 @@ namespace wstl {
             m_Allocated(0), m_Limit(limit) {}
 
         /// @copydoc Allocator::Allocate(size_t)
+        /// @details The memory is aligned to `DefaultAlignment`
         virtual void* Allocate(size_t size) __WSTL_OVERRIDE__ {
-            __WSTL_ASSERT_RETURNVALUE__(m_Allocated + size <= m_Limit, WSTL_MAKE_EXCEPTION(BadAllocation, "BumpAllocator: Allocation exceeds limit"), NullPointer);
+            return Allocate(size, DefaultAlignment);
+        }
+
+        /// @brief Allocates a block of memory of the specified size and alignment
+        /// @param size The size of the memory to allocate
+        /// @param alignment The alignment of the memory, must be a power of two
+        /// @return A pointer to the allocated memory or null pointer if unsuccessful
+        /// @throws `BadAllocation` if the allocation fails
+        void* Allocate(size_t size, size_t alignment) {
+            const Expected<void*> result = TryAllocate(size, alignment);
+
+            if(!result.HasValue()) {
+                __WSTL_ASSERT_RETURNVALUE__(result.Error() != ERROR_CODE_INVALID_ARGUMENT, WSTL_MAKE_EXCEPTION(BadAllocation, "BumpAllocator: Alignment is not a power of two"), NullPointer);
+                __WSTL_THROW_RETURNVALUE__(WSTL_MAKE_EXCEPTION(BadAllocation, "BumpAllocator: Allocation exceeds limit"), NullPointer);
+            }
+
+            return *result;
+        }
+
+        /// @copydoc Allocator::TryAllocate(size_t)
+        /// @details The memory is aligned to `DefaultAlignment`
+        virtual Expected<void*> TryAllocate(size_t size) __WSTL_OVERRIDE__ {
+            return TryAllocate(size, DefaultAlignment);
+        }
+
+        /// @brief Allocates a block of memory of the specified size and alignment without error handling
+        /// @param size The size of the memory to allocate
+        /// @param alignment The alignment of the memory, must be a power of two
+        /// @return A pointer to the allocated memory, `ERROR_CODE_INVALID_ARGUMENT` if the alignment
+        /// is not a power of two, or `ERROR_CODE_OUT_OF_MEMORY` if the allocation exceeds the limit
+        Expected<void*> TryAllocate(size_t size, size_t alignment) {
+            const Expected<void*> result = Bump(size, alignment);
+            RecordAllocation(size, result.ValueOr(NullPointer));
 
-            void* result = m_Base + m_Allocated;
-            m_Allocated += size;
             return result;
         }
 
         /// @brief Frees a block of memory at the specified address - does not do anything
-        virtual void Free(void*) __WSTL_OVERRIDE__ {
-            // Does not do anything, not operational
+        virtual void Free(void* address) __WSTL_OVERRIDE__ {
+            // Blocks are only released by Rewind and Reset, the call is still counted
+            RecordFree(address);
+        }
+
+        /// @brief Gets the current position, everything allocated after it is released by `Rewind`
+        Marker GetMarker() const __WSTL_NOEXCEPT__ {
+            return m_Allocated;
+        }
+
+        /// @brief Releases everything allocated after the marker was taken
+        /// @param marker Marker returned by `GetMarker`
+        void Rewind(Marker marker) {
+            __WSTL_ASSERT_RETURN__(marker <= m_Allocated, WSTL_MAKE_EXCEPTION(BadAllocation, "BumpAllocator: Marker is past the current position"));
+            m_Allocated = marker;
+        }
+
+        /// @brief Releases all allocations
+        void Reset() __WSTL_NOEXCEPT__ {
+            m_Allocated = 0;
+        }
+
+        /// @brief Gets the number of bytes in use, including alignment padding
+        size_t Used() const __WSTL_NOEXCEPT__ {
+            return m_Allocated;
+        }
+
+        /// @brief Gets the number of bytes left
+        size_t Available() const __WSTL_NOEXCEPT__ {
+            return m_Limit - m_Allocated;
+        }
+
+        /// @brief Gets the size of the memory block
+        size_t Capacity() const __WSTL_NOEXCEPT__ {
+            return m_Limit;
         }
     
     private:
         uint8_t* m_Base;
         size_t m_Allocated;
         size_t m_Limit;
+
+        Expected<void*> Bump(size_t size, size_t alignment) {
+            if(alignment == 0 || (alignment & (alignment - 1)) != 0) return MakeUnexpected(ERROR_CODE_INVALID_ARGUMENT);
+
+            // Align the address, not the offset, the base may be unaligned
+            const uintptr_t current = reinterpret_cast<uintptr_t>(m_Base) + m_Allocated;
+            const size_t offset = m_Allocated + (((current + alignment - 1) & ~uintptr_t(alignment - 1)) - current);
+
+            if(offset > m_Limit || size > m_Limit - offset) return MakeUnexpected(ERROR_CODE_OUT_OF_MEMORY);
+
+            m_Allocated = offset + size;
+            return static_cast<void*>(m_Base + offset);
+        }
+    };
+
+    // Scoped arena
+
+    /// @brief Releases everything allocated from a bump allocator during its lifetime
+    /// @details Takes a marker on construction and rewinds to it on destruction, scopes can be nested
+    /// @ingroup allocator
+    class ScopedArena {
+    public:
+        /// @brief Constructor
+        /// @param allocator The allocator to rewind
+        explicit ScopedArena(BumpAllocator& allocator) : m_Allocator(allocator), m_Marker(allocator.GetMarker()) {}
+
+        /// @brief Destructor, rewinds the allocator
+        ~ScopedArena() {
+            m_Allocator.Rewind(m_Marker);
+        }
+
+        /// @brief Allocates a block of memory from the allocator
+        /// @param size The size of the memory to allocate
+        /// @param alignment The alignment of the memory, must be a power of two
+        /// @return A pointer to the allocated memory or null pointer if unsuccessful
+        void* Allocate(size_t size, size_t alignment = DefaultAlignment) {
+            return m_Allocator.Allocate(size, alignment);
+        }
+
+        /// @brief Gets the allocator
+        BumpAllocator& GetAllocator() const __WSTL_NOEXCEPT__ {
+            return m_Allocator;
+        }
+
+    private:
+        BumpAllocator& m_Allocator;
+        BumpAllocator::Marker m_Marker;
+
+        /// @brief Deleted copy constructor
+        ScopedArena(const ScopedArena&) __WSTL_DELETE__;
+
+        /// @brief Deleted copy assignment operator
+        ScopedArena& operator=(const ScopedArena&) __WSTL_DELETE__;
+    };
+
+    // Frame arena
+
+    /// @brief Double-buffered arena for per-frame temporary memory
+    /// @details The memory block is split into two bump allocators. Allocations of the current
+    /// frame stay valid during the next one, so results can be handed from frame to frame.
+    /// `NextFrame` swaps the allocators and resets the one that becomes current, which is
+    /// the only cost of freeing a frame
+    /// @ingroup allocator
+    class FrameArena {
+    public:
+        /// @brief Constructor
+        /// @param base The base address of the memory block
+        /// @param limit The limit of the memory block, each frame gets half of it
+        FrameArena(void* base, size_t limit) : m_Even(base, limit / 2),
+            m_Odd(reinterpret_cast<uint8_t*>(base) + limit / 2, limit - limit / 2), m_Current(&m_Even), m_Previous(&m_Odd) {}
+
+        /// @brief Allocates a block of memory from the current frame
+        /// @param size The size of the memory to allocate
+        /// @param alignment The alignment of the memory, must be a power of two
+        /// @return A pointer to the allocated memory or null pointer if unsuccessful
+        void* Allocate(size_t size, size_t alignment = DefaultAlignment) {
+            return Current().Allocate(size, alignment);
+        }
+
+        /// @brief Starts a new frame, releasing the memory of the frame before the current one
+        void NextFrame() __WSTL_NOEXCEPT__ {
+            BumpAllocator* previous = m_Current;
+            m_Current = m_Previous;
+            m_Previous = previous;
+            m_Current->Reset();
+        }
+
+        /// @brief Gets the allocator of the current frame
+        BumpAllocator& Current() __WSTL_NOEXCEPT__ {
+            return *m_Current;
+        }
+
+        /// @brief Gets the allocator of the previous frame, its memory is still valid
+        BumpAllocator& Previous() __WSTL_NOEXCEPT__ {
+            return *m_Previous;
+        }
+
+    private:
+        BumpAllocator m_Even;
+        BumpAllocator m_Odd;
+        BumpAllocator* m_Current;
+        BumpAllocator* m_Previous;
+
+        /// @brief Deleted copy constructor
+        FrameArena(const FrameArena&) __WSTL_DELETE__;
+
+        /// @brief Deleted copy assignment operator
+        FrameArena& operator=(const FrameArena&) __WSTL_DELETE__;
     };
 }
 
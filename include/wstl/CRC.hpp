@@ -1,126 +1,732 @@
-// #ifndef __WSTL_CRC_HPP__
-// #define __WSTL_CRC_HPP__
+// Part of WardenSTL - https://github.com/WardenHD/WardenSTL
+// Copyright (c) 2025 Artem Bezruchko (WardenHD)
+//
+// Licensed under the MIT License. See LICENSE file for details.
 
-// #include "private/Platform.hpp"
-// #include "Bit.hpp"
+#ifndef __WSTL_CRC_HPP__
+#define __WSTL_CRC_HPP__
 
+#include "private/Platform.hpp"
+#include "HasherBase.hpp"
+#include "CRCParameters.hpp"
+#include "Bit.hpp"
+#include <stdint.h>
+#include <stddef.h>
 
-// namespace wstl {
-//     // CRC Compute steps
+// Defines introduced
 
-//     namespace __private {
-//         template<typename T, T Polynomial, bool Reflect, T Input>
-//         struct __CRCStep {
-//         private:
-//             static const __WSTL_CONSTEXPR__ bool XORPolynomial = Reflect ? (Input & T(1U)) == 1U : (Input & (T(1U) << (sizeof(T) * 8 - 1))) == 1U;
-        
-//         public:
-//             static const __WSTL_CONSTEXPR__ T Value = Reflect ? (XORPolynomial ? ((Input >> 1U) ^ compile::ReverseBits<T, Polynomial>::Value) : (Input >> 1U)) : 
-//                 (XORPolynomial ? ((Input << 1U) ^ Polynomial) : (Input << 1U));
-//         };
-
-//         template<typename T, T Polynomial, bool Reflect, T Input>
-//         const __WSTL_CONSTEXPR__ T __CRCStep<T, Polynomial, Reflect, Input>::Value;
-//     }
-
-//     template<typename T, T Polynomial, bool Reflect, T Input, size_t N>
-//     struct CRCComputeSteps {
-//         static const __WSTL_CONSTEXPR__ T Value = __private::__CRCStep<T, Polynomial, Reflect, CRCComputeSteps<T, Polynomial, Reflect, Input, N - 1>::Value>::Value;
-//     };
-
-//     template<typename T, T Polynomial, bool Reflect, T Input>
-//     struct CRCComputeSteps<T, Polynomial, Reflect, Input, 0> {
-//         static const __WSTL_CONSTEXPR__ T Value = Input;
-//     };
-
-//     // CRC Table entry
-
-//     template<typename T, T Polynomial, bool Reflect, size_t Index, uint8_t ChunkBits>
-//     class CRCTableEntry;
-
-//     // Chunk bit size of 2
-
-//     template<typename T, T Polynomial, bool Reflect, size_t Index>
-//     class CRCTableEntry<T, Polynomial, Reflect, Index, 2> {
-//     public:
-//         static const __WSTL_CONSTEXPR__ T Entry = Reflect ? T(Index) : (T(Index) << (sizeof(T) * 8 - 2));
-
-//         static const __WSTL_CONSTEXPR__ T Value = CRCComputeSteps<T, Polynomial, Reflect, Entry, 2>::Value;
-//     };
-
-//     // Chunk bit size of 4
-
-//     template<typename T, T Polynomial, bool Reflect, size_t Index>
-//     class CRCTableEntry<T, Polynomial, Reflect, Index, 4> {
-//     public:
-//         static const __WSTL_CONSTEXPR__ T Entry = Reflect ? T(Index) : (T(Index) << (sizeof(T) * 8 - 4));
-
-//         static const __WSTL_CONSTEXPR__ T Value = CRCComputeSteps<T, Polynomial, Reflect, Entry, 4>::Value;
-//     };
-
-//     // Chunk bit size of 8
-
-//     template<typename T, T Polynomial, bool Reflect, size_t Index>
-//     class CRCTableEntry<T, Polynomial, Reflect, Index, 8> {
-//     public:
-//         static const __WSTL_CONSTEXPR__ T Entry = Reflect ? T(Index) : (T(Index) << (sizeof(T) * 8 - 8));
-
-//         static const __WSTL_CONSTEXPR__ T Value = CRCComputeSteps<T, Polynomial, Reflect, Entry, 8>::Value;
-//     };
-
-//     // CRC Type
-
-//     template<typename Parameters, size_t TableSize>
-//     class CRCType;
-
-//     template<typename Parameters>
-//     class CRCType<Parameters, 0> : public HasherBase<CRCType<Parameters, 0>, typename Parameters::Type, uint8_t> {
-//     private:
-//         typedef HasherBase<CRCType<Parameters, 0>, uint8_t, uint8_t> Base;
-
-//     public:
-//         typedef typename Base::HashType HashType;
-//         typedef typename Base::ValueType ValueType;
-
-//         __WSTL_CONSTEXPR__ CRCType() {
-//             Reset();
-//         };
-
-//         template<typename Iterator>
-//         __WSTL_CONSTEXPR14__ CRCType(Iterator first, Iterator last) {
-//             WSTL_STATIC_ASSERT(sizeof(typename IteratorTraits<Iterator>::ValueType) == sizeof(ValueType), "Type not supported");
-//             Reset();
-//             this->Append(first, last);
-//         }
-
-//         __WSTL_CONSTEXPR14__ void Reset() {
-//             this->m_Hash = Parameters::ReflectValue ? compile::ReverseBits<typename Parameters::Type, Parameters::InitialValue>::Value : Parameters::InitialValue;
-//         }
-
-//         __WSTL_CONSTEXPR14__ void PushBack(ValueType value) {
-//             this->m_Hash ^= value;
-
-//             if __WSTL_IF_CONSTEXPR__(Parameters::ReflectValue) {
-//                 for(size_t i = 0; i < 8; ++i) {
-//                     if(this->m_Hash & 1) this->m_Hash = (this->m_Hash >> 1) ^ compile::ReverseBits<typename Parameters::Type, Parameters::PolynomialValue>::Value;
-//                     else this->m_Hash >>= 1; 
-//                 }
-//             }
-//             else {
-//                 for(size_t i = 0; i < 8; ++i) {
-//                     if(this->m_Hash & 0x80) this->m_Hash = (this->m_Hash << 1) ^ Parameters::PolynomialValue;
-//                     else this->m_Hash <<= 1; 
-//                 }
-//             }
-//         }
-    
-//     private:
-//         friend Base;
-
-//         __WSTL_CONSTEXPR14__ void Finalize() {
-//             this->m_Hash ^= Parameters::FinalXORValue;
-//         }
-//     };
-// }   
-
-// #endif
\ No newline at end of file
+/// @def __WSTL_CRC_USE_BUILTINS__
+/// @brief If defined, hardware CRC instructions will be used for block appends where available
+/// @details Supported are ARMv8 CRC32 extension (`__ARM_FEATURE_CRC32`) for CRC-32/ISO-HDLC 
+/// and CRC-32/ISCSI polynomials, and x86 SSE4.2 (`__SSE4_2__`) for CRC-32/ISCSI polynomial.
+/// The target must be compiled with the corresponding instruction set enabled
+/// @ingroup crc
+#ifdef __DOXYGEN__
+    #define __WSTL_CRC_USE_BUILTINS__ 
+#endif
+
+#ifdef __WSTL_CRC_USE_BUILTINS__
+    #if defined(__ARM_FEATURE_CRC32)
+        #include <arm_acle.h>
+        #define __WSTL_CRC_ARM__
+    #elif defined(__SSE4_2__)
+        #include <nmmintrin.h>
+        #define __WSTL_CRC_SSE42__
+    #endif
+#endif
+
+
+namespace wstl {
+    // CRC compute steps
+
+    namespace __private {
+        template<typename T, T Polynomial, bool Reflect, T Input>
+        struct __CRCStep {
+        private:
+            static const __WSTL_CONSTEXPR__ T MSB = static_cast<T>(T(1U) << (sizeof(T) * 8 - 1));
+            static const __WSTL_CONSTEXPR__ bool XORPolynomial = Reflect ? (Input & T(1U)) != 0 : (Input & MSB) != 0;
+            static const __WSTL_CONSTEXPR__ T Shifted = Reflect ? static_cast<T>(Input >> 1U) : static_cast<T>(Input << 1U);
+            static const __WSTL_CONSTEXPR__ T Divisor = Reflect ? compile::ReverseBits<T, Polynomial>::Value : Polynomial;
+
+        public:
+            static const __WSTL_CONSTEXPR__ T Value = XORPolynomial ? static_cast<T>(Shifted ^ Divisor) : Shifted;
+        };
+
+        template<typename T, T Polynomial, bool Reflect, T Input>
+        const __WSTL_CONSTEXPR__ T __CRCStep<T, Polynomial, Reflect, Input>::Value;
+    }
+
+    /// @brief Computes `N` bit-steps of the CRC division at compile time
+    /// @tparam T The type of the CRC value
+    /// @tparam Polynomial The generator polynomial in normal form
+    /// @tparam Reflect Whether the algorithm is reflected
+    /// @tparam Input The initial register value
+    /// @tparam N The number of steps to compute
+    /// @ingroup crc
+    template<typename T, T Polynomial, bool Reflect, T Input, size_t N>
+    struct CRCComputeSteps {
+        static const __WSTL_CONSTEXPR__ T Value = __private::__CRCStep<T, Polynomial, Reflect, CRCComputeSteps<T, Polynomial, Reflect, Input, N - 1>::Value>::Value;
+    };
+
+    template<typename T, T Polynomial, bool Reflect, T Input, size_t N>
+    const __WSTL_CONSTEXPR__ T CRCComputeSteps<T, Polynomial, Reflect, Input, N>::Value;
+
+    template<typename T, T Polynomial, bool Reflect, T Input>
+    struct CRCComputeSteps<T, Polynomial, Reflect, Input, 0> {
+        static const __WSTL_CONSTEXPR__ T Value = Input;
+    };
+
+    template<typename T, T Polynomial, bool Reflect, T Input>
+    const __WSTL_CONSTEXPR__ T CRCComputeSteps<T, Polynomial, Reflect, Input, 0>::Value;
+
+    // CRC table entry
+
+    /// @brief Compile-time computed entry of a CRC lookup table
+    /// @tparam T The type of the CRC value
+    /// @tparam Polynomial The generator polynomial in normal form
+    /// @tparam Reflect Whether the algorithm is reflected
+    /// @tparam Index The index of the entry in the table
+    /// @tparam ChunkBits The number of input bits processed per lookup (2, 4 or 8)
+    /// @ingroup crc
+    template<typename T, T Polynomial, bool Reflect, size_t Index, uint8_t ChunkBits>
+    class CRCTableEntry {
+    private:
+        WSTL_STATIC_ASSERT(ChunkBits == 2 || ChunkBits == 4 || ChunkBits == 8, "Only 2, 4 and 8-bit chunks are supported");
+        WSTL_STATIC_ASSERT(sizeof(T) * 8 >= ChunkBits, "CRC type is narrower than the chunk");
+
+    public:
+        static const __WSTL_CONSTEXPR__ T Entry = Reflect ? static_cast<T>(Index) : static_cast<T>(T(Index) << (sizeof(T) * 8 - ChunkBits));
+
+        static const __WSTL_CONSTEXPR__ T Value = CRCComputeSteps<T, Polynomial, Reflect, Entry, ChunkBits>::Value;
+    };
+
+    template<typename T, T Polynomial, bool Reflect, size_t Index, uint8_t ChunkBits>
+    const __WSTL_CONSTEXPR__ T CRCTableEntry<T, Polynomial, Reflect, Index, ChunkBits>::Entry;
+
+    template<typename T, T Polynomial, bool Reflect, size_t Index, uint8_t ChunkBits>
+    const __WSTL_CONSTEXPR__ T CRCTableEntry<T, Polynomial, Reflect, Index, ChunkBits>::Value;
+
+    // CRC table
+
+    #define __WSTL_CRC_ENTRY__(i) CRCTableEntry<T, Polynomial, Reflect, (i), ChunkBits>::Value
+    #define __WSTL_CRC_ENTRIES4__(i) __WSTL_CRC_ENTRY__(i), __WSTL_CRC_ENTRY__((i) + 1), __WSTL_CRC_ENTRY__((i) + 2), __WSTL_CRC_ENTRY__((i) + 3)
+    #define __WSTL_CRC_ENTRIES16__(i) __WSTL_CRC_ENTRIES4__(i), __WSTL_CRC_ENTRIES4__((i) + 4), __WSTL_CRC_ENTRIES4__((i) + 8), __WSTL_CRC_ENTRIES4__((i) + 12)
+    #define __WSTL_CRC_ENTRIES64__(i) __WSTL_CRC_ENTRIES16__(i), __WSTL_CRC_ENTRIES16__((i) + 16), __WSTL_CRC_ENTRIES16__((i) + 32), __WSTL_CRC_ENTRIES16__((i) + 48)
+    #define __WSTL_CRC_ENTRIES256__(i) __WSTL_CRC_ENTRIES64__(i), __WSTL_CRC_ENTRIES64__((i) + 64), __WSTL_CRC_ENTRIES64__((i) + 128), __WSTL_CRC_ENTRIES64__((i) + 192)
+
+    namespace __private {
+        template<typename T, T Polynomial, bool Reflect, uint8_t ChunkBits>
+        struct __CRCTable;
+
+        template<typename T, T Polynomial, bool Reflect>
+        struct __CRCTable<T, Polynomial, Reflect, 2> {
+            static const __WSTL_CONSTEXPR__ uint8_t ChunkBits = 2;
+
+            #ifdef __WSTL_CXX11__
+            static constexpr T Data[4] = { __WSTL_CRC_ENTRIES4__(0) };
+            #else
+            static const T Data[4];
+            #endif
+        };
+
+        template<typename T, T Polynomial, bool Reflect>
+        struct __CRCTable<T, Polynomial, Reflect, 4> {
+            static const __WSTL_CONSTEXPR__ uint8_t ChunkBits = 4;
+
+            #ifdef __WSTL_CXX11__
+            static constexpr T Data[16] = { __WSTL_CRC_ENTRIES16__(0) };
+            #else
+            static const T Data[16];
+            #endif
+        };
+
+        template<typename T, T Polynomial, bool Reflect>
+        struct __CRCTable<T, Polynomial, Reflect, 8> {
+            static const __WSTL_CONSTEXPR__ uint8_t ChunkBits = 8;
+
+            #ifdef __WSTL_CXX11__
+            static constexpr T Data[256] = { __WSTL_CRC_ENTRIES256__(0) };
+            #else
+            static const T Data[256];
+            #endif
+        };
+
+        #ifdef __WSTL_CXX11__
+        template<typename T, T Polynomial, bool Reflect>
+        constexpr T __CRCTable<T, Polynomial, Reflect, 2>::Data[4];
+
+        template<typename T, T Polynomial, bool Reflect>
+        constexpr T __CRCTable<T, Polynomial, Reflect, 4>::Data[16];
+
+        template<typename T, T Polynomial, bool Reflect>
+        constexpr T __CRCTable<T, Polynomial, Reflect, 8>::Data[256];
+        #else
+        template<typename T, T Polynomial, bool Reflect>
+        const T __CRCTable<T, Polynomial, Reflect, 2>::Data[4] = { __WSTL_CRC_ENTRIES4__(0) };
+
+        template<typename T, T Polynomial, bool Reflect>
+        const T __CRCTable<T, Polynomial, Reflect, 4>::Data[16] = { __WSTL_CRC_ENTRIES16__(0) };
+
+        template<typename T, T Polynomial, bool Reflect>
+        const T __CRCTable<T, Polynomial, Reflect, 8>::Data[256] = { __WSTL_CRC_ENTRIES256__(0) };
+        #endif
+
+        // Table-driven CRC update
+
+        template<typename Parameters, uint8_t ChunkBits, bool Reflect = Parameters::ReflectValue>
+        struct __CRCUpdate;
+
+        template<typename Parameters, uint8_t ChunkBits>
+        struct __CRCUpdate<Parameters, ChunkBits, true> {
+            typedef typename Parameters::Type Type;
+            typedef __CRCTable<Type, Parameters::PolynomialValue, true, ChunkBits> Table;
+
+            static __WSTL_CONSTEXPR14__ Type Update(Type crc, uint8_t value) {
+                for(uint8_t i = 0; i < 8; i += ChunkBits) {
+                    const uint8_t index = static_cast<uint8_t>((crc ^ (value >> i)) & ((1U << ChunkBits) - 1U));
+                    crc = static_cast<Type>(Table::Data[index] ^ (crc >> ChunkBits));
+                }
+
+                return crc;
+            }
+
+            static __WSTL_CONSTEXPR14__ Type Update(Type crc, const uint8_t* data, size_t size) {
+                for(; size > 0; --size) crc = Update(crc, *data++);
+                return crc;
+            }
+        };
+
+        template<typename Parameters, uint8_t ChunkBits>
+        struct __CRCUpdate<Parameters, ChunkBits, false> {
+            typedef typename Parameters::Type Type;
+            typedef __CRCTable<Type, Parameters::PolynomialValue, false, ChunkBits> Table;
+
+            static const __WSTL_CONSTEXPR__ uint8_t Width = sizeof(Type) * 8;
+
+            static __WSTL_CONSTEXPR14__ Type Update(Type crc, uint8_t value) {
+                for(uint8_t i = ChunkBits; i <= 8; i += ChunkBits) {
+                    const uint8_t index = static_cast<uint8_t>(((crc >> (Width - ChunkBits)) ^ (value >> (8 - i))) & ((1U << ChunkBits) - 1U));
+                    crc = static_cast<Type>(Table::Data[index] ^ (crc << ChunkBits));
+                }
+
+                return crc;
+            }
+
+            static __WSTL_CONSTEXPR14__ Type Update(Type crc, const uint8_t* data, size_t size) {
+                for(; size > 0; --size) crc = Update(crc, *data++);
+                return crc;
+            }
+        };
+
+        // Slicing tables
+
+        template<typename T, T Polynomial, bool Reflect, T Input>
+        struct __CRCSliceStep;
+
+        template<typename T, T Polynomial, T Input>
+        struct __CRCSliceStep<T, Polynomial, true, Input> {
+            static const __WSTL_CONSTEXPR__ T Value = static_cast<T>((Input >> 8) ^ CRCTableEntry<T, Polynomial, true, (Input & 0xFFU), 8>::Value);
+        };
+
+        template<typename T, T Polynomial, T Input>
+        struct __CRCSliceStep<T, Polynomial, false, Input> {
+            static const __WSTL_CONSTEXPR__ T Value = static_cast<T>((Input << 8) ^ CRCTableEntry<T, Polynomial, false, ((Input >> (sizeof(T) * 8 - 8)) & 0xFFU), 8>::Value);
+        };
+
+        template<typename T, T Polynomial, bool Reflect, size_t Index, size_t Row>
+        struct __CRCSliceEntry {
+            static const __WSTL_CONSTEXPR__ T Value = __CRCSliceStep<T, Polynomial, Reflect, __CRCSliceEntry<T, Polynomial, Reflect, Index, Row - 1>::Value>::Value;
+        };
+
+        template<typename T, T Polynomial, bool Reflect, size_t Index>
+        struct __CRCSliceEntry<T, Polynomial, Reflect, Index, 0> {
+            static const __WSTL_CONSTEXPR__ T Value = CRCTableEntry<T, Polynomial, Reflect, Index, 8>::Value;
+        };
+
+        #define __WSTL_CRC_SLICE_ENTRY__(k, i) __CRCSliceEntry<T, Polynomial, Reflect, (i), (k)>::Value
+        #define __WSTL_CRC_SLICE_ENTRIES4__(k, i) __WSTL_CRC_SLICE_ENTRY__(k, i), __WSTL_CRC_SLICE_ENTRY__(k, (i) + 1), __WSTL_CRC_SLICE_ENTRY__(k, (i) + 2), __WSTL_CRC_SLICE_ENTRY__(k, (i) + 3)
+        #define __WSTL_CRC_SLICE_ENTRIES16__(k, i) __WSTL_CRC_SLICE_ENTRIES4__(k, i), __WSTL_CRC_SLICE_ENTRIES4__(k, (i) + 4), __WSTL_CRC_SLICE_ENTRIES4__(k, (i) + 8), __WSTL_CRC_SLICE_ENTRIES4__(k, (i) + 12)
+        #define __WSTL_CRC_SLICE_ENTRIES64__(k, i) __WSTL_CRC_SLICE_ENTRIES16__(k, i), __WSTL_CRC_SLICE_ENTRIES16__(k, (i) + 16), __WSTL_CRC_SLICE_ENTRIES16__(k, (i) + 32), __WSTL_CRC_SLICE_ENTRIES16__(k, (i) + 48)
+        #define __WSTL_CRC_SLICE_ROW__(k) { __WSTL_CRC_SLICE_ENTRIES64__(k, 0), __WSTL_CRC_SLICE_ENTRIES64__(k, 64), __WSTL_CRC_SLICE_ENTRIES64__(k, 128), __WSTL_CRC_SLICE_ENTRIES64__(k, 192) }
+        #define __WSTL_CRC_SLICE_ROWS8__(k) __WSTL_CRC_SLICE_ROW__(k), __WSTL_CRC_SLICE_ROW__((k) + 1), __WSTL_CRC_SLICE_ROW__((k) + 2), __WSTL_CRC_SLICE_ROW__((k) + 3), \
+            __WSTL_CRC_SLICE_ROW__((k) + 4), __WSTL_CRC_SLICE_ROW__((k) + 5), __WSTL_CRC_SLICE_ROW__((k) + 6), __WSTL_CRC_SLICE_ROW__((k) + 7)
+
+        template<typename T, T Polynomial, bool Reflect, size_t Slices>
+        struct __CRCSliceTable;
+
+        template<typename T, T Polynomial, bool Reflect>
+        struct __CRCSliceTable<T, Polynomial, Reflect, 8> {
+            #ifdef __WSTL_CXX11__
+            static constexpr T Data[8][256] = { __WSTL_CRC_SLICE_ROWS8__(0) };
+            #else
+            static const T Data[8][256];
+            #endif
+        };
+
+        template<typename T, T Polynomial, bool Reflect>
+        struct __CRCSliceTable<T, Polynomial, Reflect, 16> {
+            #ifdef __WSTL_CXX11__
+            static constexpr T Data[16][256] = { __WSTL_CRC_SLICE_ROWS8__(0), __WSTL_CRC_SLICE_ROWS8__(8) };
+            #else
+            static const T Data[16][256];
+            #endif
+        };
+
+        #ifdef __WSTL_CXX11__
+        template<typename T, T Polynomial, bool Reflect>
+        constexpr T __CRCSliceTable<T, Polynomial, Reflect, 8>::Data[8][256];
+
+        template<typename T, T Polynomial, bool Reflect>
+        constexpr T __CRCSliceTable<T, Polynomial, Reflect, 16>::Data[16][256];
+        #else
+        template<typename T, T Polynomial, bool Reflect>
+        const T __CRCSliceTable<T, Polynomial, Reflect, 8>::Data[8][256] = { __WSTL_CRC_SLICE_ROWS8__(0) };
+
+        template<typename T, T Polynomial, bool Reflect>
+        const T __CRCSliceTable<T, Polynomial, Reflect, 16>::Data[16][256] = { __WSTL_CRC_SLICE_ROWS8__(0), __WSTL_CRC_SLICE_ROWS8__(8) };
+        #endif
+
+        #undef __WSTL_CRC_SLICE_ENTRY__
+        #undef __WSTL_CRC_SLICE_ENTRIES4__
+        #undef __WSTL_CRC_SLICE_ENTRIES16__
+        #undef __WSTL_CRC_SLICE_ENTRIES64__
+        #undef __WSTL_CRC_SLICE_ROW__
+        #undef __WSTL_CRC_SLICE_ROWS8__
+
+        // Slicing CRC update, processes `Slices` bytes per iteration
+
+        template<typename Parameters, size_t Slices, size_t Index = 0, bool = (Index < Slices)>
+        struct __CRCSliceCombine {
+            typedef typename Parameters::Type Type;
+            typedef __CRCSliceTable<Type, Parameters::PolynomialValue, Parameters::ReflectValue, Slices> Table;
+
+            static const __WSTL_CONSTEXPR__ uint8_t Width = sizeof(Type) * 8;
+
+            // Unrolled at compile time, each step mixes one byte of the block with the matching register byte
+            static __WSTL_CONSTEXPR14__ Type Combine(Type crc, const uint8_t* data) {
+                uint8_t index = data[Index];
+
+                if(Index < sizeof(Type)) {
+                    if __WSTL_IF_CONSTEXPR__(Parameters::ReflectValue) index ^= static_cast<uint8_t>(crc >> ((Index * 8) % Width));
+                    else index ^= static_cast<uint8_t>(crc >> ((Width - (Index + 1) * 8) % Width));
+                }
+
+                return static_cast<Type>(Table::Data[Slices - 1 - Index][index] ^ __CRCSliceCombine<Parameters, Slices, Index + 1>::Combine(crc, data));
+            }
+        };
+
+        template<typename Parameters, size_t Slices, size_t Index>
+        struct __CRCSliceCombine<Parameters, Slices, Index, false> {
+            static __WSTL_CONSTEXPR14__ typename Parameters::Type Combine(typename Parameters::Type, const uint8_t*) {
+                return 0;
+            }
+        };
+
+        template<typename Parameters, size_t Slices>
+        struct __CRCSliceUpdate {
+            typedef typename Parameters::Type Type;
+            typedef __CRCSliceTable<Type, Parameters::PolynomialValue, Parameters::ReflectValue, Slices> Table;
+
+            static const __WSTL_CONSTEXPR__ uint8_t Width = sizeof(Type) * 8;
+
+            static __WSTL_CONSTEXPR14__ Type Update(Type crc, uint8_t value) {
+                if __WSTL_IF_CONSTEXPR__(Parameters::ReflectValue) return static_cast<Type>(Table::Data[0][(crc ^ value) & 0xFFU] ^ (crc >> 8));
+                else return static_cast<Type>(Table::Data[0][((crc >> (Width - 8)) ^ value) & 0xFFU] ^ (crc << 8));
+            }
+
+            static __WSTL_CONSTEXPR14__ Type Update(Type crc, const uint8_t* data, size_t size) {
+                for(; size >= Slices; size -= Slices, data += Slices) crc = __CRCSliceCombine<Parameters, Slices>::Combine(crc, data);
+                for(; size > 0; --size) crc = Update(crc, *data++);
+                return crc;
+            }
+        };
+
+        // Hardware CRC update
+
+        template<typename T, T Polynomial, bool Reflect>
+        struct __CRCHardware {
+            static const __WSTL_CONSTEXPR__ bool Available = false;
+
+            static T Update(T crc, const uint8_t*, size_t) {
+                return crc;
+            }
+        };
+
+        #if defined(__WSTL_CRC_ARM__) || defined(__WSTL_CRC_SSE42__)
+        inline uint64_t __CRCLoad64(const uint8_t* data) {
+            return uint64_t(data[0]) | (uint64_t(data[1]) << 8) | (uint64_t(data[2]) << 16) | (uint64_t(data[3]) << 24) |
+                (uint64_t(data[4]) << 32) | (uint64_t(data[5]) << 40) | (uint64_t(data[6]) << 48) | (uint64_t(data[7]) << 56);
+        }
+        #endif
+
+        #ifdef __WSTL_CRC_ARM__
+        template<>
+        struct __CRCHardware<uint32_t, 0x04C11DB7UL, true> {
+            static const __WSTL_CONSTEXPR__ bool Available = true;
+
+            static uint32_t Update(uint32_t crc, const uint8_t* data, size_t size) {
+                for(; size >= 8; size -= 8, data += 8) crc = __crc32d(crc, __CRCLoad64(data));
+                for(; size > 0; --size) crc = __crc32b(crc, *data++);
+                return crc;
+            }
+        };
+
+        template<>
+        struct __CRCHardware<uint32_t, 0x1EDC6F41UL, true> {
+            static const __WSTL_CONSTEXPR__ bool Available = true;
+
+            static uint32_t Update(uint32_t crc, const uint8_t* data, size_t size) {
+                for(; size >= 8; size -= 8, data += 8) crc = __crc32cd(crc, __CRCLoad64(data));
+                for(; size > 0; --size) crc = __crc32cb(crc, *data++);
+                return crc;
+            }
+        };
+        #elif defined(__WSTL_CRC_SSE42__)
+        template<>
+        struct __CRCHardware<uint32_t, 0x1EDC6F41UL, true> {
+            static const __WSTL_CONSTEXPR__ bool Available = true;
+
+            static uint32_t Update(uint32_t crc, const uint8_t* data, size_t size) {
+                #if defined(__x86_64__) || defined(_M_X64)
+                uint64_t crc64 = crc;
+                for(; size >= 8; size -= 8, data += 8) crc64 = _mm_crc32_u64(crc64, __CRCLoad64(data));
+                crc = static_cast<uint32_t>(crc64);
+                #else
+                for(; size >= 4; size -= 4, data += 4) {
+                    crc = _mm_crc32_u32(crc, uint32_t(data[0]) | (uint32_t(data[1]) << 8) | (uint32_t(data[2]) << 16) | (uint32_t(data[3]) << 24));
+                }
+                #endif
+                for(; size > 0; --size) crc = _mm_crc32_u8(crc, *data++);
+                return crc;
+            }
+        };
+        #endif
+    }
+
+    #undef __WSTL_CRC_ENTRY__
+    #undef __WSTL_CRC_ENTRIES4__
+    #undef __WSTL_CRC_ENTRIES16__
+    #undef __WSTL_CRC_ENTRIES64__
+    #undef __WSTL_CRC_ENTRIES256__
+
+    // CRC type
+
+    /// @brief CRC calculator
+    /// @tparam Parameters The parameters of the CRC algorithm, see `CRCParameters`
+    /// @tparam TableSize The total number of lookup table entries: 0 for bitwise calculation,
+    /// 4 for 2-bit chunks, 16 for 4-bit chunks, 256 for 8-bit chunks, 2048 for slice-by-8 
+    /// or 4096 for slice-by-16
+    /// @details Bigger tables trade flash for speed. All tables are generated at compile time
+    /// and placed in read-only memory. Slicing tables only make a difference for block appends
+    /// of contiguous byte ranges, where 8 or 16 bytes are processed per iteration
+    /// @ingroup crc
+    template<typename Parameters, size_t TableSize = 256>
+    class CRCType;
+
+    /// @brief CRC calculator, bitwise version without lookup table
+    /// @tparam Parameters The parameters of the CRC algorithm, see `CRCParameters`
+    /// @ingroup crc
+    template<typename Parameters>
+    class CRCType<Parameters, 0> : public HasherBase<CRCType<Parameters, 0>, typename Parameters::Type, uint8_t> {
+    private:
+        typedef HasherBase<CRCType<Parameters, 0>, typename Parameters::Type, uint8_t> Base;
+        typedef __private::__CRCHardware<typename Parameters::Type, Parameters::PolynomialValue, Parameters::ReflectValue> Hardware;
+
+    public:
+        typedef typename Base::HashType HashType;
+        typedef typename Base::ValueType ValueType;
+
+        /// @brief Default constructor
+        __WSTL_CONSTEXPR14__ CRCType() {
+            Reset();
+        }
+
+        /// @brief Constructor that initializes the CRC with a range of values
+        /// @param first The beginning of the range
+        /// @param last The end of the range
+        template<typename Iterator>
+        __WSTL_CONSTEXPR14__ CRCType(Iterator first, Iterator last) {
+            WSTL_STATIC_ASSERT(sizeof(typename IteratorTraits<Iterator>::ValueType) == sizeof(ValueType), "Type not supported");
+            Reset();
+            this->Append(first, last);
+        }
+
+        /// @brief Resets the CRC to its initial state
+        __WSTL_CONSTEXPR14__ void Reset() {
+            m_Register = Parameters::ReflectValue ? compile::ReverseBits<HashType, Parameters::InitialValue>::Value : Parameters::InitialValue;
+            this->m_Hash = 0;
+        }
+
+        /// @brief Pushes a value into the CRC
+        /// @param value The value to be added to the CRC
+        __WSTL_CONSTEXPR14__ void PushBack(ValueType value) {
+            if __WSTL_IF_CONSTEXPR__(Parameters::ReflectValue) {
+                m_Register = static_cast<HashType>(m_Register ^ value);
+
+                for(uint8_t i = 0; i < 8; ++i) {
+                    if(m_Register & 1U) m_Register = static_cast<HashType>((m_Register >> 1) ^ compile::ReverseBits<HashType, Parameters::PolynomialValue>::Value);
+                    else m_Register = static_cast<HashType>(m_Register >> 1);
+                }
+            }
+            else {
+                m_Register = static_cast<HashType>(m_Register ^ (HashType(value) << (WIDTH - 8)));
+
+                for(uint8_t i = 0; i < 8; ++i) {
+                    if(m_Register & MSB) m_Register = static_cast<HashType>((m_Register << 1) ^ Parameters::PolynomialValue);
+                    else m_Register = static_cast<HashType>(m_Register << 1);
+                }
+            }
+        }
+
+    private:
+        static const __WSTL_INLINE_VARIABLE__ __WSTL_CONSTEXPR__ uint8_t WIDTH = sizeof(HashType) * 8;
+        static const __WSTL_INLINE_VARIABLE__ __WSTL_CONSTEXPR__ HashType MSB = static_cast<HashType>(HashType(1U) << (WIDTH - 1));
+
+        HashType m_Register;
+
+        friend Base;
+
+        /// @brief Appends a block of bytes to the CRC
+        /// @param data Pointer to the block
+        /// @param size Size of the block in bytes
+        /// @details Uses hardware CRC instructions if `__WSTL_CRC_USE_BUILTINS__` is defined and they are available
+        void AppendBlock(const uint8_t* data, size_t size) {
+            if __WSTL_IF_CONSTEXPR__(Hardware::Available) m_Register = Hardware::Update(m_Register, data, size);
+            else for(; size > 0; --size) PushBack(*data++);
+        }
+
+        /// @brief Finalizes the CRC by applying the final XOR value
+        /// @details The register itself is left intact, so more data can still be appended afterwards
+        __WSTL_CONSTEXPR14__ void Finalize() {
+            this->m_Hash = static_cast<HashType>(m_Register ^ Parameters::FinalXORValue);
+        }
+    };
+
+    namespace __private {
+        template<typename Parameters, size_t TableSize>
+        struct __CRCTableTraits;
+
+        template<typename Parameters>
+        struct __CRCTableTraits<Parameters, 4> {
+            typedef __CRCUpdate<Parameters, 2> UpdateType;
+        };
+
+        template<typename Parameters>
+        struct __CRCTableTraits<Parameters, 16> {
+            typedef __CRCUpdate<Parameters, 4> UpdateType;
+        };
+
+        template<typename Parameters>
+        struct __CRCTableTraits<Parameters, 256> {
+            typedef __CRCUpdate<Parameters, 8> UpdateType;
+        };
+
+        template<typename Parameters>
+        struct __CRCTableTraits<Parameters, 2048> {
+            typedef __CRCSliceUpdate<Parameters, 8> UpdateType;
+        };
+
+        template<typename Parameters>
+        struct __CRCTableTraits<Parameters, 4096> {
+            typedef __CRCSliceUpdate<Parameters, 16> UpdateType;
+        };
+    }
+
+    /// @brief CRC calculator, table-driven version
+    /// @tparam Parameters The parameters of the CRC algorithm, see `CRCParameters`
+    /// @tparam TableSize The total number of lookup table entries: 4, 16, 256, 2048 (slice-by-8) or 4096 (slice-by-16)
+    /// @ingroup crc
+    template<typename Parameters, size_t TableSize>
+    class CRCType : public HasherBase<CRCType<Parameters, TableSize>, typename Parameters::Type, uint8_t> {
+    private:
+        typedef HasherBase<CRCType<Parameters, TableSize>, typename Parameters::Type, uint8_t> Base;
+        typedef typename __private::__CRCTableTraits<Parameters, TableSize>::UpdateType Update;
+        typedef __private::__CRCHardware<typename Parameters::Type, Parameters::PolynomialValue, Parameters::ReflectValue> Hardware;
+
+    public:
+        typedef typename Base::HashType HashType;
+        typedef typename Base::ValueType ValueType;
+
+        /// @brief Default constructor
+        __WSTL_CONSTEXPR14__ CRCType() {
+            Reset();
+        }
+
+        /// @brief Constructor that initializes the CRC with a range of values
+        /// @param first The beginning of the range
+        /// @param last The end of the range
+        template<typename Iterator>
+        __WSTL_CONSTEXPR14__ CRCType(Iterator first, Iterator last) {
+            WSTL_STATIC_ASSERT(sizeof(typename IteratorTraits<Iterator>::ValueType) == sizeof(ValueType), "Type not supported");
+            Reset();
+            this->Append(first, last);
+        }
+
+        /// @brief Resets the CRC to its initial state
+        __WSTL_CONSTEXPR14__ void Reset() {
+            m_Register = Parameters::ReflectValue ? compile::ReverseBits<HashType, Parameters::InitialValue>::Value : Parameters::InitialValue;
+            this->m_Hash = 0;
+        }
+
+        /// @brief Pushes a value into the CRC
+        /// @param value The value to be added to the CRC
+        __WSTL_CONSTEXPR14__ void PushBack(ValueType value) {
+            m_Register = Update::Update(m_Register, value);
+        }
+
+    private:
+        HashType m_Register;
+
+        friend Base;
+
+        /// @brief Appends a block of bytes to the CRC
+        /// @param data Pointer to the block
+        /// @param size Size of the block in bytes
+        /// @details With slicing tables 8 or 16 bytes are processed per iteration. Uses hardware 
+        /// CRC instructions instead if `__WSTL_CRC_USE_BUILTINS__` is defined and they are available
+        void AppendBlock(const uint8_t* data, size_t size) {
+            if __WSTL_IF_CONSTEXPR__(Hardware::Available) m_Register = Hardware::Update(m_Register, data, size);
+            else m_Register = Update::Update(m_Register, data, size);
+        }
+
+        /// @brief Finalizes the CRC by applying the final XOR value
+        /// @details The register itself is left intact, so more data can still be appended afterwards
+        __WSTL_CONSTEXPR14__ void Finalize() {
+            this->m_Hash = static_cast<HashType>(m_Register ^ Parameters::FinalXORValue);
+        }
+    };
+
+    /// @brief Namespace that holds predefined CRC calculators
+    /// @details Every calculator uses a 256-entry lookup table,
+    /// for the smaller or slicing tables use `CRCType` with the parameters directly
+    /// @ingroup crc
+    namespace crc {
+        // 8-bit
+
+        /// @brief CRC-8/SMBUS calculator
+        /// @ingroup crc
+        typedef CRCType<CRC8ParametersSMBUS> CRC8_SMBUS;
+
+        /// @brief CRC-8/I-432-1 calculator
+        /// @ingroup crc
+        typedef CRCType<CRC8ParametersI4321> CRC8_I4321;
+
+        /// @brief CRC-8/ROHC calculator
+        /// @ingroup crc
+        typedef CRCType<CRC8ParametersROHC> CRC8_ROHC;
+
+        /// @brief CRC-8/SAE-J1850 calculator
+        /// @ingroup crc
+        typedef CRCType<CRC8ParametersSAEJ1850> CRC8_SAEJ1850;
+
+        /// @brief CRC-8/AUTOSAR calculator
+        /// @ingroup crc
+        typedef CRCType<CRC8ParametersAUTOSAR> CRC8_AUTOSAR;
+
+        /// @brief CRC-8/MAXIM-DOW calculator
+        /// @ingroup crc
+        typedef CRCType<CRC8ParametersMAXIMDOW> CRC8_MAXIMDOW;
+
+        /// @brief CRC-8/DVB-S2 calculator
+        /// @ingroup crc
+        typedef CRCType<CRC8ParametersDVBS2> CRC8_DVBS2;
+
+        // 16-bit
+
+        /// @brief CRC-16/ARC calculator
+        /// @ingroup crc
+        typedef CRCType<CRC16ParametersARC> CRC16_ARC;
+
+        /// @brief CRC-16/MODBUS calculator
+        /// @ingroup crc
+        typedef CRCType<CRC16ParametersMODBUS> CRC16_MODBUS;
+
+        /// @brief CRC-16/USB calculator
+        /// @ingroup crc
+        typedef CRCType<CRC16ParametersUSB> CRC16_USB;
+
+        /// @brief CRC-16/IBM-3740 (CCITT-FALSE) calculator
+        /// @ingroup crc
+        typedef CRCType<CRC16ParametersIBM3740> CRC16_IBM3740;
+
+        /// @brief CRC-16/XMODEM calculator
+        /// @ingroup crc
+        typedef CRCType<CRC16ParametersXMODEM> CRC16_XMODEM;
+
+        /// @brief CRC-16/GENIBUS calculator
+        /// @ingroup crc
+        typedef CRCType<CRC16ParametersGENIBUS> CRC16_GENIBUS;
+
+        /// @brief CRC-16/KERMIT calculator
+        /// @ingroup crc
+        typedef CRCType<CRC16ParametersKERMIT> CRC16_KERMIT;
+
+        /// @brief CRC-16/IBM-SDLC (X-25) calculator
+        /// @ingroup crc
+        typedef CRCType<CRC16ParametersIBMSDLC> CRC16_IBMSDLC;
+
+        /// @brief CRC-16/DNP calculator
+        /// @ingroup crc
+        typedef CRCType<CRC16ParametersDNP> CRC16_DNP;
+
+        // 32-bit
+
+        /// @brief CRC-32/ISO-HDLC calculator
+        /// @ingroup crc
+        typedef CRCType<CRC32ParametersISOHDLC> CRC32_ISOHDLC;
+
+        /// @brief CRC-32/JAMCRC calculator
+        /// @ingroup crc
+        typedef CRCType<CRC32ParametersJAMCRC> CRC32_JAMCRC;
+
+        /// @brief CRC-32/BZIP2 calculator
+        /// @ingroup crc
+        typedef CRCType<CRC32ParametersBZIP2> CRC32_BZIP2;
+
+        /// @brief CRC-32/MPEG-2 calculator
+        /// @ingroup crc
+        typedef CRCType<CRC32ParametersMPEG2> CRC32_MPEG2;
+
+        /// @brief CRC-32/CKSUM calculator
+        /// @ingroup crc
+        typedef CRCType<CRC32ParametersCKSUM> CRC32_CKSUM;
+
+        /// @brief CRC-32/ISCSI (CRC-32C) calculator
+        /// @ingroup crc
+        typedef CRCType<CRC32ParametersISCSI> CRC32_ISCSI;
+
+        /// @brief CRC-32/AUTOSAR calculator
+        /// @ingroup crc
+        typedef CRCType<CRC32ParametersAUTOSAR> CRC32_AUTOSAR;
+
+        // 64-bit
+
+        /// @brief CRC-64/ECMA-182 calculator
+        /// @ingroup crc
+        typedef CRCType<CRC64ParametersECMA182> CRC64_ECMA182;
+
+        /// @brief CRC-64/WE calculator
+        /// @ingroup crc
+        typedef CRCType<CRC64ParametersWE> CRC64_WE;
+
+        /// @brief CRC-64/XZ calculator
+        /// @ingroup crc
+        typedef CRCType<CRC64ParametersXZ> CRC64_XZ;
+
+        /// @brief CRC-64/GO-ISO calculator
+        /// @ingroup crc
+        typedef CRCType<CRC64ParametersGOISO> CRC64_GOISO;
+
+        // Common aliases
+
+        /// @brief The most common CRC-32 calculator (CRC-32/ISO-HDLC)
+        /// @ingroup crc
+        typedef CRC32_ISOHDLC CRC32;
+
+        /// @brief Castagnoli CRC-32 calculator (CRC-32/ISCSI)
+        /// @ingroup crc
+        typedef CRC32_ISCSI CRC32C;
+    }
+}
+
+#endif
\ No newline at end of file
@@ -1,37 +1,160 @@
-// #ifndef __WSTL_CRCTRAITS_HPP__
-// #define __WSTL_CRCTRAITS_HPP__
+// Part of WardenSTL - https://github.com/WardenHD/WardenSTL
+// Copyright (c) 2025 Artem Bezruchko (WardenHD)
+//
+// Licensed under the MIT License. See LICENSE file for details.
 
-// #include "private/Platform.hpp"
-// #include <stdint.h>
+#ifndef __WSTL_CRCPARAMETERS_HPP__
+#define __WSTL_CRCPARAMETERS_HPP__
 
+#include "private/Platform.hpp"
+#include <stdint.h>
 
-// namespace wstl {
-//     template<typename T, T Polynomial, T Initial, T FinalXOR, bool Reflect>
-//     struct CRCParameters {
-//         typedef T Type;
-//         static const __WSTL_CONSTEXPR__ T PolynomialValue = Polynomial;
-//         static const __WSTL_CONSTEXPR__ T InitialValue = Initial;
-//         static const __WSTL_CONSTEXPR__ T FinalXORValue = FinalXOR;
-//         static const __WSTL_CONSTEXPR__ bool ReflectValue = Reflect;
-//     };
 
-//     template<typename T, T Polynomial, T Initial, T FinalXOR, bool Reflect>
-//     const __WSTL_CONSTEXPR__ T CRCParameters<T, Polynomial, Initial, FinalXOR, Reflect>::PolynomialValue;
+namespace wstl {
+    /// @brief Set of parameters describing a CRC algorithm
+    /// @tparam T The type of the CRC value, its width defines the width of the CRC
+    /// @tparam Polynomial The generator polynomial in normal (MSB-first) form
+    /// @tparam Initial The initial value of the CRC register
+    /// @tparam FinalXOR The value XORed with the CRC register at finalization
+    /// @tparam Reflect Whether the input bytes and the output value are reflected
+    /// @ingroup crc
+    /// @see https://reveng.sourceforge.io/crc-catalogue/all.htm
+    template<typename T, T Polynomial, T Initial, T FinalXOR, bool Reflect>
+    struct CRCParameters {
+        typedef T Type;
+        static const __WSTL_CONSTEXPR__ T PolynomialValue = Polynomial;
+        static const __WSTL_CONSTEXPR__ T InitialValue = Initial;
+        static const __WSTL_CONSTEXPR__ T FinalXORValue = FinalXOR;
+        static const __WSTL_CONSTEXPR__ bool ReflectValue = Reflect;
+    };
 
-//     template<typename T, T Polynomial, T Initial, T FinalXOR, bool Reflect>
-//     const __WSTL_CONSTEXPR__ T CRCParameters<T, Polynomial, Initial, FinalXOR, Reflect>::InitialValue;
+    template<typename T, T Polynomial, T Initial, T FinalXOR, bool Reflect>
+    const __WSTL_CONSTEXPR__ T CRCParameters<T, Polynomial, Initial, FinalXOR, Reflect>::PolynomialValue;
 
-//     template<typename T, T Polynomial, T Initial, T FinalXOR, bool Reflect>
-//     const __WSTL_CONSTEXPR__ T CRCParameters<T, Polynomial, Initial, FinalXOR, Reflect>::FinalXORValue;
+    template<typename T, T Polynomial, T Initial, T FinalXOR, bool Reflect>
+    const __WSTL_CONSTEXPR__ T CRCParameters<T, Polynomial, Initial, FinalXOR, Reflect>::InitialValue;
 
-//     template<typename T, T Polynomial, T Initial, T FinalXOR, bool Reflect>
-//     const __WSTL_CONSTEXPR__ bool CRCParameters<T, Polynomial, Initial, FinalXOR, Reflect>::ReflectValue;
+    template<typename T, T Polynomial, T Initial, T FinalXOR, bool Reflect>
+    const __WSTL_CONSTEXPR__ T CRCParameters<T, Polynomial, Initial, FinalXOR, Reflect>::FinalXORValue;
 
-//     // 8-bit
+    template<typename T, T Polynomial, T Initial, T FinalXOR, bool Reflect>
+    const __WSTL_CONSTEXPR__ bool CRCParameters<T, Polynomial, Initial, FinalXOR, Reflect>::ReflectValue;
 
-//     typedef CRCParameters<uint8_t, 0xD5, 0, 0, false> CRC8ParametersDVBS2;
+    // 8-bit
 
+    /// @brief CRC-8/SMBUS parameters, check value `0xF4`
+    /// @ingroup crc
+    typedef CRCParameters<uint8_t, 0x07U, 0x00U, 0x00U, false> CRC8ParametersSMBUS;
 
-// }
+    /// @brief CRC-8/I-432-1 (also known as CRC-8/ITU) parameters, check value `0xA1`
+    /// @ingroup crc
+    typedef CRCParameters<uint8_t, 0x07U, 0x00U, 0x55U, false> CRC8ParametersI4321;
 
-// #endif
\ No newline at end of file
+    /// @brief CRC-8/ROHC parameters, check value `0xD0`
+    /// @ingroup crc
+    typedef CRCParameters<uint8_t, 0x07U, 0xFFU, 0x00U, true> CRC8ParametersROHC;
+
+    /// @brief CRC-8/SAE-J1850 parameters, check value `0x4B`
+    /// @ingroup crc
+    typedef CRCParameters<uint8_t, 0x1DU, 0xFFU, 0xFFU, false> CRC8ParametersSAEJ1850;
+
+    /// @brief CRC-8/AUTOSAR parameters, check value `0xDF`
+    /// @ingroup crc
+    typedef CRCParameters<uint8_t, 0x2FU, 0xFFU, 0xFFU, false> CRC8ParametersAUTOSAR;
+
+    /// @brief CRC-8/MAXIM-DOW (also known as CRC-8/MAXIM) parameters, check value `0xA1`
+    /// @ingroup crc
+    typedef CRCParameters<uint8_t, 0x31U, 0x00U, 0x00U, true> CRC8ParametersMAXIMDOW;
+
+    /// @brief CRC-8/DVB-S2 parameters, check value `0xBC`
+    /// @ingroup crc
+    typedef CRCParameters<uint8_t, 0xD5U, 0x00U, 0x00U, false> CRC8ParametersDVBS2;
+
+    // 16-bit
+
+    /// @brief CRC-16/ARC parameters, check value `0xBB3D`
+    /// @ingroup crc
+    typedef CRCParameters<uint16_t, 0x8005U, 0x0000U, 0x0000U, true> CRC16ParametersARC;
+
+    /// @brief CRC-16/MODBUS parameters, check value `0x4B37`
+    /// @ingroup crc
+    typedef CRCParameters<uint16_t, 0x8005U, 0xFFFFU, 0x0000U, true> CRC16ParametersMODBUS;
+
+    /// @brief CRC-16/USB parameters, check value `0xB4C8`
+    /// @ingroup crc
+    typedef CRCParameters<uint16_t, 0x8005U, 0xFFFFU, 0xFFFFU, true> CRC16ParametersUSB;
+
+    /// @brief CRC-16/IBM-3740 (also known as CRC-16/CCITT-FALSE) parameters, check value `0x29B1`
+    /// @ingroup crc
+    typedef CRCParameters<uint16_t, 0x1021U, 0xFFFFU, 0x0000U, false> CRC16ParametersIBM3740;
+
+    /// @brief CRC-16/XMODEM parameters, check value `0x31C3`
+    /// @ingroup crc
+    typedef CRCParameters<uint16_t, 0x1021U, 0x0000U, 0x0000U, false> CRC16ParametersXMODEM;
+
+    /// @brief CRC-16/GENIBUS parameters, check value `0xD64E`
+    /// @ingroup crc
+    typedef CRCParameters<uint16_t, 0x1021U, 0xFFFFU, 0xFFFFU, false> CRC16ParametersGENIBUS;
+
+    /// @brief CRC-16/KERMIT (also known as CRC-16/CCITT) parameters, check value `0x2189`
+    /// @ingroup crc
+    typedef CRCParameters<uint16_t, 0x1021U, 0x0000U, 0x0000U, true> CRC16ParametersKERMIT;
+
+    /// @brief CRC-16/IBM-SDLC (also known as CRC-16/X-25) parameters, check value `0x906E`
+    /// @ingroup crc
+    typedef CRCParameters<uint16_t, 0x1021U, 0xFFFFU, 0xFFFFU, true> CRC16ParametersIBMSDLC;
+
+    /// @brief CRC-16/DNP parameters, check value `0xEA82`
+    /// @ingroup crc
+    typedef CRCParameters<uint16_t, 0x3D65U, 0x0000U, 0xFFFFU, true> CRC16ParametersDNP;
+
+    // 32-bit
+
+    /// @brief CRC-32/ISO-HDLC (the common Ethernet/ZIP CRC-32) parameters, check value `0xCBF43926`
+    /// @ingroup crc
+    typedef CRCParameters<uint32_t, 0x04C11DB7UL, 0xFFFFFFFFUL, 0xFFFFFFFFUL, true> CRC32ParametersISOHDLC;
+
+    /// @brief CRC-32/JAMCRC parameters, check value `0x340BC6D9`
+    /// @ingroup crc
+    typedef CRCParameters<uint32_t, 0x04C11DB7UL, 0xFFFFFFFFUL, 0x00000000UL, true> CRC32ParametersJAMCRC;
+
+    /// @brief CRC-32/BZIP2 parameters, check value `0xFC891918`
+    /// @ingroup crc
+    typedef CRCParameters<uint32_t, 0x04C11DB7UL, 0xFFFFFFFFUL, 0xFFFFFFFFUL, false> CRC32ParametersBZIP2;
+
+    /// @brief CRC-32/MPEG-2 parameters, check value `0x0376E6E7`
+    /// @ingroup crc
+    typedef CRCParameters<uint32_t, 0x04C11DB7UL, 0xFFFFFFFFUL, 0x00000000UL, false> CRC32ParametersMPEG2;
+
+    /// @brief CRC-32/CKSUM (POSIX) parameters, check value `0x765E7680`
+    /// @ingroup crc
+    typedef CRCParameters<uint32_t, 0x04C11DB7UL, 0x00000000UL, 0xFFFFFFFFUL, false> CRC32ParametersCKSUM;
+
+    /// @brief CRC-32/ISCSI (also known as CRC-32C) parameters, check value `0xE3069283`
+    /// @ingroup crc
+    typedef CRCParameters<uint32_t, 0x1EDC6F41UL, 0xFFFFFFFFUL, 0xFFFFFFFFUL, true> CRC32ParametersISCSI;
+
+    /// @brief CRC-32/AUTOSAR parameters, check value `0x1697D06A`
+    /// @ingroup crc
+    typedef CRCParameters<uint32_t, 0xF4ACFB13UL, 0xFFFFFFFFUL, 0xFFFFFFFFUL, true> CRC32ParametersAUTOSAR;
+
+    // 64-bit
+
+    /// @brief CRC-64/ECMA-182 parameters, check value `0x6C40DF5F0B497347`
+    /// @ingroup crc
+    typedef CRCParameters<uint64_t, 0x42F0E1EBA9EA3693ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, false> CRC64ParametersECMA182;
+
+    /// @brief CRC-64/WE parameters, check value `0x62EC59E3F1A4F00A`
+    /// @ingroup crc
+    typedef CRCParameters<uint64_t, 0x42F0E1EBA9EA3693ULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL, false> CRC64ParametersWE;
+
+    /// @brief CRC-64/XZ parameters, check value `0x995DC9BBDF1939FA`
+    /// @ingroup crc
+    typedef CRCParameters<uint64_t, 0x42F0E1EBA9EA3693ULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL, true> CRC64ParametersXZ;
+
+    /// @brief CRC-64/GO-ISO parameters, check value `0xB90956C775A41001`
+    /// @ingroup crc
+    typedef CRCParameters<uint64_t, 0x000000000000001BULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL, true> CRC64ParametersGOISO;
+}
+
+#endif
\ No newline at end of file
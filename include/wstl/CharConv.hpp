@@ -0,0 +1,1608 @@
+// Part of WardenSTL - https://github.com/WardenHD/WardenSTL
+// Copyright (c) 2025 Artem Bezruchko (WardenHD)
+//
+// Licensed under the MIT License. See LICENSE file for details.
+
+#ifndef __WSTL_CHARCONV_HPP__
+#define __WSTL_CHARCONV_HPP__
+
+#include "private/Platform.hpp"
+#include "private/Error.hpp"
+#include "private/CharConvTables.hpp"
+#include "TypeTraits.hpp"
+#include "StandardExceptions.hpp"
+#include "Limits.hpp"
+#include "StringView.hpp"
+#include "Bit.hpp"
+#include <stddef.h>
+#include <stdint.h>
+
+
+/// @defgroup charconv Character conversions
+/// @brief Conversions between numbers and text without `printf`
+
+namespace wstl {
+    // Conversion error
+
+    /// @brief Error of a conversion between numbers and text
+    /// @ingroup charconv
+    /// @see https://en.cppreference.com/w/cpp/error/errc
+    enum ConversionError {
+        CONVERSION_ERROR_NONE = 0,
+        CONVERSION_ERROR_INVALID_ARGUMENT,
+        CONVERSION_ERROR_RESULT_OUT_OF_RANGE,
+        CONVERSION_ERROR_VALUE_TOO_LARGE
+    };
+
+    // Characters format
+
+    /// @brief Notation of floating-point numbers converted to text
+    /// @ingroup charconv
+    /// @see https://en.cppreference.com/w/cpp/utility/chars_format
+    enum CharsFormat {
+        CHARS_FORMAT_SCIENTIFIC = 1,
+        CHARS_FORMAT_FIXED = 2,
+        /// @brief Whichever of scientific and fixed notation is shorter, fixed on a tie
+        CHARS_FORMAT_GENERAL = CHARS_FORMAT_SCIENTIFIC | CHARS_FORMAT_FIXED
+    };
+
+    // To characters result
+
+    /// @brief Result of `ToChars`
+    /// @ingroup charconv
+    /// @see https://en.cppreference.com/w/cpp/utility/to_chars_result
+    struct ToCharsResult {
+        /// @brief One past the last character written, or the end of the buffer on error
+        char* Pointer;
+        ConversionError Error;
+    };
+
+    namespace __private {
+        /// @brief Lookup tables of the integer conversions
+        template<typename T = void>
+        struct __CharConvDigits {
+            /// @brief Digits of the bases up to 36
+            static const char Alphabet[37];
+            /// @brief The two digits of every number from `00` to `99`
+            static const char Pairs[201];
+            /// @brief Powers of ten from `10^1` to `10^19`, the first entry is `0`
+            static const uint64_t PowersOf10[20];
+        };
+
+        template<typename T>
+        const char __CharConvDigits<T>::Alphabet[37] = "0123456789abcdefghijklmnopqrstuvwxyz";
+
+        template<typename T>
+        const char __CharConvDigits<T>::Pairs[201] =
+            "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+            "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+            "8081828384858687888990919293949596979899";
+
+        template<typename T>
+        const uint64_t __CharConvDigits<T>::PowersOf10[20] = {
+            0ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL, 10000000ULL, 100000000ULL,
+            1000000000ULL, 10000000000ULL, 100000000000ULL, 1000000000000ULL, 10000000000000ULL,
+            100000000000000ULL, 1000000000000000ULL, 10000000000000000ULL, 100000000000000000ULL,
+            1000000000000000000ULL, 10000000000000000000ULL
+        };
+
+        /// @brief Counts the decimal digits of a value from its bit length, without dividing
+        template<typename T>
+        inline unsigned __DecimalLength(T value) {
+            const unsigned bits = static_cast<unsigned>(sizeof(T) * 8 - CountLeftZero(static_cast<T>(value | 1U)));
+            // 1233 / 4096 is just above log10(2), the guess is exact or one too small
+            const unsigned guess = (bits * 1233U) >> 12;
+
+            return guess + (value >= __CharConvDigits<>::PowersOf10[guess] ? 1U : 0U);
+        }
+
+        /// @brief Writes two digits of a number below `100`
+        inline void __WriteDigitPair(char* destination, uint32_t value) {
+            destination[0] = __CharConvDigits<>::Pairs[value * 2];
+            destination[1] = __CharConvDigits<>::Pairs[value * 2 + 1];
+        }
+
+        /// @brief Writes the decimal digits of a value so that they end at `end`, two at a time
+        /// @return The first character written
+        inline char* __WriteDecimal(char* end, uint32_t value) {
+            while(value >= 100) {
+                const uint32_t pair = value % 100;
+                value /= 100;
+
+                end -= 2;
+                __WriteDigitPair(end, pair);
+            }
+
+            if(value >= 10) {
+                end -= 2;
+                __WriteDigitPair(end, value);
+            }
+            else *--end = static_cast<char>('0' + value);
+
+            return end;
+        }
+
+        /// @copydoc __WriteDecimal(char*, uint32_t)
+        /// @details Splits off eight digits per 64-bit division, the rest is done in 32 bits
+        inline char* __WriteDecimal(char* end, uint64_t value) {
+            while(value > 0xFFFFFFFFULL) {
+                const uint64_t quotient = value / 100000000ULL;
+                uint32_t block = static_cast<uint32_t>(value - quotient * 100000000ULL);
+                value = quotient;
+
+                for(int i = 0; i < 4; ++i) {
+                    end -= 2;
+                    __WriteDigitPair(end, block % 100);
+                    block /= 100;
+                }
+            }
+
+            return __WriteDecimal(end, static_cast<uint32_t>(value));
+        }
+
+        template<typename T>
+        inline ToCharsResult __ToCharsUnsigned(char* first, char* last, T value, int base) {
+            ToCharsResult result = { last, CONVERSION_ERROR_VALUE_TOO_LARGE };
+            size_t length;
+
+            if(base == 10) {
+                length = __DecimalLength(value);
+                if(static_cast<size_t>(last - first) < length) return result;
+
+                __WriteDecimal(first + length, value);
+            }
+            else if((base & (base - 1)) == 0) {
+                const unsigned shift = CountRightZero(static_cast<unsigned>(base));
+                const unsigned bits = static_cast<unsigned>(sizeof(T) * 8 - CountLeftZero(static_cast<T>(value | 1U)));
+
+                length = (bits + shift - 1) / shift;
+                if(static_cast<size_t>(last - first) < length) return result;
+
+                const T mask = static_cast<T>(base - 1);
+                char* position = first + length;
+
+                do {
+                    *--position = __CharConvDigits<>::Alphabet[value & mask];
+                    value >>= shift;
+                } while(value != 0);
+            }
+            else {
+                const T divisor = static_cast<T>(base);
+
+                length = 1;
+                for(T rest = value / divisor; rest != 0; rest /= divisor) ++length;
+                if(static_cast<size_t>(last - first) < length) return result;
+
+                char* position = first + length;
+
+                do {
+                    *--position = __CharConvDigits<>::Alphabet[value % divisor];
+                    value /= divisor;
+                } while(value != 0);
+            }
+
+            result.Pointer = first + length;
+            result.Error = CONVERSION_ERROR_NONE;
+            return result;
+        }
+
+        template<typename T>
+        inline bool __IsNegative(T value, TrueType) {
+            return value < 0;
+        }
+
+        template<typename T>
+        inline bool __IsNegative(T, FalseType) {
+            return false;
+        }
+    }
+
+    // To characters
+
+    /// @brief Converts an integer to text
+    /// @tparam T Type of the integer
+    /// @param first Beginning of the buffer to write to
+    /// @param last End of the buffer to write to
+    /// @param value The integer to convert
+    /// @param base Base of the text, from 2 to 36, digits above 9 are lowercase letters
+    /// @return One past the last character written, or the end of the buffer and
+    /// `CONVERSION_ERROR_VALUE_TOO_LARGE` if the text does not fit. Nothing is null-terminated
+    /// @details The digit count is known up front from the bit length, the decimal digits are then
+    /// written from a table two at a time and 64-bit values need one 64-bit division per eight
+    /// digits. Powers of two bases use shifts only
+    /// @throws `OutOfRange` if the base is not in the range
+    /// @ingroup charconv
+    /// @see https://en.cppreference.com/w/cpp/utility/to_chars
+    template<typename T>
+    typename EnableIf<IsIntegral<T>::Value && !IsSame<typename RemoveCV<T>::Type, bool>::Value, ToCharsResult>::Type
+    ToChars(char* first, char* last, T value, int base = 10) {
+        typedef typename Conditional<(sizeof(T) > 4), uint64_t, uint32_t>::Type UnsignedType;
+
+        ToCharsResult result = { last, CONVERSION_ERROR_VALUE_TOO_LARGE };
+        __WSTL_ASSERT_RETURNVALUE__(base >= 2 && base <= 36, WSTL_MAKE_EXCEPTION(OutOfRange, "Base out of range"), result);
+
+        UnsignedType magnitude = static_cast<UnsignedType>(value);
+
+        if(__private::__IsNegative(value, BoolConstant<IsSigned<T>::Value>())) {
+            if(first == last) return result;
+
+            *first++ = '-';
+            magnitude = static_cast<UnsignedType>(UnsignedType(0) - magnitude);
+        }
+
+        return __private::__ToCharsUnsigned(first, last, magnitude, base);
+    }
+
+    namespace __private {
+        /// @brief A floating-point value as `Significand * 10^Exponent`
+        struct __DecimalFloat {
+            uint64_t Significand;
+            int Exponent;
+        };
+
+        /// @brief Gets the upper 64 bits of the product of two 64-bit values
+        inline uint64_t __MultiplyHigh64(uint64_t a, uint64_t b) {
+            #ifdef __SIZEOF_INT128__
+            __extension__ typedef unsigned __int128 ProductType;
+            return static_cast<uint64_t>((static_cast<ProductType>(a) * b) >> 64);
+            #else
+            const uint64_t aLow = a & 0xFFFFFFFFULL, aHigh = a >> 32;
+            const uint64_t bLow = b & 0xFFFFFFFFULL, bHigh = b >> 32;
+
+            const uint64_t lowLow = aLow * bLow;
+            const uint64_t highLow = aHigh * bLow;
+            const uint64_t cross = (lowLow >> 32) + (highLow & 0xFFFFFFFFULL) + aLow * bHigh;
+
+            return aHigh * bHigh + (highLow >> 32) + (cross >> 32);
+            #endif
+        }
+
+        /// @brief Computes `floor(e * log10(2))`
+        inline int __FloorLog10Pow2(int e) {
+            return static_cast<int>((static_cast<int64_t>(e) * 661971961083LL) >> 41);
+        }
+
+        /// @brief Computes `floor(e * log10(2) + log10(3/4))`
+        inline int __FloorLog10ThreeQuartersPow2(int e) {
+            return static_cast<int>((static_cast<int64_t>(e) * 661971961083LL - 274743187321LL) >> 41);
+        }
+
+        /// @brief Computes `floor(e * log2(10))`
+        inline int __FloorLog2Pow10(int e) {
+            return static_cast<int>((static_cast<int64_t>(e) * 913124641741LL) >> 38);
+        }
+
+        /// @brief Multiplies by a 126-bit multiplier and rounds to odd
+        inline uint64_t __RoundToOdd(uint64_t high, uint64_t low, uint64_t value) {
+            const uint64_t mask = 0x7FFFFFFFFFFFFFFFULL;
+
+            const uint64_t x1 = __MultiplyHigh64(low, value);
+            const uint64_t y0 = high * value;
+            const uint64_t y1 = __MultiplyHigh64(high, value);
+            const uint64_t z = (y0 >> 1) + x1;
+
+            return (y1 + (z >> 63)) | (((z & mask) + mask) >> 63);
+        }
+
+        /// @brief Multiplies by a 63-bit multiplier and rounds to odd
+        inline uint32_t __RoundToOdd(uint64_t multiplier, uint64_t value) {
+            const uint64_t mask = 0xFFFFFFFFULL;
+            const uint64_t x1 = __MultiplyHigh64(multiplier, value);
+
+            return static_cast<uint32_t>((x1 >> 31) | (((x1 & mask) + mask) >> 32));
+        }
+
+        /// @brief Picks the shortest decimal in the rounding interval of `c * 2^q`
+        /// @details One of the two candidates with one digit less than the rounding interval
+        /// allows is inside it, or the interval has only one of two adjacent candidates,
+        /// otherwise the closer one wins. The bounds are computed exactly enough by rounding to odd,
+        /// as described in R. Giulietti, "The Schubfach way to render doubles"
+        template<typename T>
+        inline __DecimalFloat __SchubfachChoose(T vb, T vbl, T vbr, T out, int k) {
+            const T s = vb >> 2;
+            __DecimalFloat result;
+
+            // A one-digit candidate is never shorter than the neighbours of a one-digit s
+            if(s >= 10) {
+                const T sp10 = s / 10 * 10;
+                const T tp10 = sp10 + 10;
+
+                const bool upin = vbl + out <= (sp10 << 2);
+                const bool wpin = (tp10 << 2) + out <= vbr;
+
+                if(upin != wpin) {
+                    result.Significand = upin ? sp10 : tp10;
+                    result.Exponent = k;
+                    return result;
+                }
+            }
+
+            const T t = s + 1;
+            const bool uin = vbl + out <= (s << 2);
+            const bool win = (t << 2) + out <= vbr;
+
+            result.Exponent = k;
+
+            if(uin != win) result.Significand = uin ? s : t;
+            else {
+                // Both or none are inside, take the closer one and the even one on a tie
+                const T middle = (s + t) << 1;
+                result.Significand = vb < middle || (vb == middle && (s & 1) == 0) ? s : t;
+            }
+
+            return result;
+        }
+
+        /// @brief Converts `c * 2^q` to the shortest decimal that rounds back to it
+        inline __DecimalFloat __SchubfachDouble(int q, uint64_t c) {
+            const uint64_t out = c & 1U;
+            const uint64_t cb = c << 2;
+            const uint64_t cbr = cb + 2;
+            uint64_t cbl;
+            int k;
+
+            // The interval below a power of two is half as wide
+            if(c != (1ULL << 52) || q == -1074) {
+                cbl = cb - 2;
+                k = __FloorLog10Pow2(q);
+            }
+            else {
+                cbl = cb - 1;
+                k = __FloorLog10ThreeQuartersPow2(q);
+            }
+
+            const int h = q + __FloorLog2Pow10(-k) + 2;
+            const uint64_t* g = __DoubleMultipliers<>::Values[k - __DoubleMultipliers<>::MinExponent];
+
+            const uint64_t vb = __RoundToOdd(g[0], g[1], cb << h);
+            const uint64_t vbl = __RoundToOdd(g[0], g[1], cbl << h);
+            const uint64_t vbr = __RoundToOdd(g[0], g[1], cbr << h);
+
+            return __SchubfachChoose<uint64_t>(vb, vbl, vbr, out, k);
+        }
+
+        /// @copydoc __SchubfachDouble
+        inline __DecimalFloat __SchubfachFloat(int q, uint32_t c) {
+            const uint32_t out = c & 1U;
+            const uint32_t cb = c << 2;
+            const uint32_t cbr = cb + 2;
+            uint32_t cbl;
+            int k;
+
+            if(c != (1UL << 23) || q == -149) {
+                cbl = cb - 2;
+                k = __FloorLog10Pow2(q);
+            }
+            else {
+                cbl = cb - 1;
+                k = __FloorLog10ThreeQuartersPow2(q);
+            }
+
+            const int h = q + __FloorLog2Pow10(-k) + 33;
+            const uint64_t g = __FloatMultipliers<>::Values[k - __FloatMultipliers<>::MinExponent];
+
+            const uint32_t vb = __RoundToOdd(g, static_cast<uint64_t>(cb) << h);
+            const uint32_t vbl = __RoundToOdd(g, static_cast<uint64_t>(cbl) << h);
+            const uint32_t vbr = __RoundToOdd(g, static_cast<uint64_t>(cbr) << h);
+
+            return __SchubfachChoose<uint32_t>(vb, vbl, vbr, out, k);
+        }
+
+        /// @brief Decomposes a finite non-zero value and finds its shortest decimal
+        inline __DecimalFloat __ShortestDecimal(uint64_t bits) {
+            const uint64_t fraction = bits & ((1ULL << 52) - 1);
+            const int biasedExponent = static_cast<int>((bits >> 52) & 0x7FF);
+
+            if(biasedExponent == 0) return __SchubfachDouble(-1074, fraction);
+
+            const int shift = 1075 - biasedExponent;
+            const uint64_t c = fraction | (1ULL << 52);
+
+            // Small integers are exact
+            if(shift > 0 && shift < 53 && ((c >> shift) << shift) == c) {
+                __DecimalFloat result = { c >> shift, 0 };
+                return result;
+            }
+
+            return __SchubfachDouble(-shift, c);
+        }
+
+        /// @copydoc __ShortestDecimal(uint64_t)
+        inline __DecimalFloat __ShortestDecimal(uint32_t bits) {
+            const uint32_t fraction = bits & ((1UL << 23) - 1);
+            const int biasedExponent = static_cast<int>((bits >> 23) & 0xFF);
+
+            if(biasedExponent == 0) return __SchubfachFloat(-149, fraction);
+
+            const int shift = 150 - biasedExponent;
+            const uint32_t c = fraction | (1UL << 23);
+
+            if(shift > 0 && shift < 24 && ((c >> shift) << shift) == c) {
+                __DecimalFloat result = { c >> shift, 0 };
+                return result;
+            }
+
+            return __SchubfachFloat(-shift, c);
+        }
+
+        /// @brief An integer in base `10^9`, large enough for any finite `double`
+        struct __ExactInteger {
+            uint32_t Limbs[35];
+            int Size;
+        };
+
+        /// @brief Computes `significand * 2^exponent` exactly
+        /// @return Number of decimal digits of the result
+        inline int __MakeExactInteger(__ExactInteger& integer, uint64_t significand, int exponent) {
+            const uint32_t base = 1000000000U;
+
+            integer.Size = 0;
+            do {
+                integer.Limbs[integer.Size++] = static_cast<uint32_t>(significand % base);
+                significand /= base;
+            } while(significand != 0);
+
+            // A limb is below 2^30, so shifting by up to 29 bits stays within 64 bits
+            while(exponent > 0) {
+                const int shift = exponent < 29 ? exponent : 29;
+                uint64_t carry = 0;
+
+                for(int i = 0; i < integer.Size; ++i) {
+                    const uint64_t value = (static_cast<uint64_t>(integer.Limbs[i]) << shift) + carry;
+                    integer.Limbs[i] = static_cast<uint32_t>(value % base);
+                    carry = value / base;
+                }
+
+                while(carry != 0) {
+                    integer.Limbs[integer.Size++] = static_cast<uint32_t>(carry % base);
+                    carry /= base;
+                }
+
+                exponent -= shift;
+            }
+
+            return static_cast<int>(__DecimalLength(integer.Limbs[integer.Size - 1])) + 9 * (integer.Size - 1);
+        }
+
+        /// @brief Writes an exact integer, the buffer must have room for all of its digits
+        inline char* __WriteExactInteger(char* first, const __ExactInteger& integer) {
+            const uint32_t top = integer.Limbs[integer.Size - 1];
+
+            first += __DecimalLength(top);
+            __WriteDecimal(first, top);
+
+            for(int i = integer.Size - 2; i >= 0; --i) {
+                uint32_t limb = integer.Limbs[i];
+                first += 9;
+
+                for(int j = 0; j < 4; ++j) {
+                    __WriteDigitPair(first - 2 * (j + 1), limb % 100);
+                    limb /= 100;
+                }
+
+                first[-9] = static_cast<char>('0' + limb);
+            }
+
+            return first;
+        }
+
+        /// @brief Writes `digits * 10^exponent` in scientific or fixed notation
+        /// @details Fixed notation of a value at or above `2^52` or `2^23` writes its exact integer,
+        /// `binarySignificand * 2^binaryExponent`, as it is the closest of the texts of that length
+        inline ToCharsResult __WriteDecimalFloat(char* first, char* last, bool negative, uint64_t digits, int exponent,
+            uint64_t binarySignificand, int binaryExponent, CharsFormat format) {
+            ToCharsResult result = { last, CONVERSION_ERROR_VALUE_TOO_LARGE };
+
+            if(digits != 0) {
+                while(digits % 10 == 0) {
+                    digits /= 10;
+                    ++exponent;
+                }
+            }
+
+            const int length = static_cast<int>(__DecimalLength(digits));
+            const int scientificExponent = exponent + length - 1;
+            const int absoluteExponent = scientificExponent < 0 ? -scientificExponent : scientificExponent;
+
+            const int scientificLength = length + (length > 1 ? 1 : 0) + 2 + (absoluteExponent >= 100 ? 3 : 2);
+            int fixedLength = exponent >= 0 ? length + exponent : (-exponent < length ? length + 1 : 2 - exponent);
+
+            __ExactInteger integer;
+            integer.Size = 0;
+
+            if(format != CHARS_FORMAT_SCIENTIFIC && exponent > 0 && binaryExponent > 0) {
+                fixedLength = __MakeExactInteger(integer, binarySignificand, binaryExponent);
+            }
+
+            const bool fixed = format == CHARS_FORMAT_FIXED || (format != CHARS_FORMAT_SCIENTIFIC && fixedLength <= scientificLength);
+            const int total = (negative ? 1 : 0) + (fixed ? fixedLength : scientificLength);
+
+            if(last - first < total) return result;
+            if(negative) *first++ = '-';
+
+            if(!fixed) {
+                if(length == 1) *first++ = static_cast<char>('0' + digits);
+                else {
+                    // Write the digits one place further and pull the first one out before the point
+                    __WriteDecimal(first + 1 + length, digits);
+                    first[0] = first[1];
+                    first[1] = '.';
+                    first += length + 1;
+                }
+
+                *first++ = 'e';
+                *first++ = scientificExponent < 0 ? '-' : '+';
+
+                if(absoluteExponent >= 100) {
+                    *first++ = static_cast<char>('0' + absoluteExponent / 100);
+                    __WriteDigitPair(first, static_cast<uint32_t>(absoluteExponent % 100));
+                }
+                else __WriteDigitPair(first, static_cast<uint32_t>(absoluteExponent));
+
+                result.Pointer = first + 2;
+            }
+            else if(integer.Size != 0) result.Pointer = __WriteExactInteger(first, integer);
+            else if(exponent >= 0) {
+                __WriteDecimal(first + length, digits);
+                first += length;
+
+                for(int i = 0; i < exponent; ++i) *first++ = '0';
+                result.Pointer = first;
+            }
+            else if(-exponent < length) {
+                const int integerLength = length + exponent;
+
+                __WriteDecimal(first + 1 + length, digits);
+                for(int i = 0; i < integerLength; ++i) first[i] = first[i + 1];
+                first[integerLength] = '.';
+
+                result.Pointer = first + length + 1;
+            }
+            else {
+                *first++ = '0';
+                *first++ = '.';
+
+                for(int i = 0; i < -exponent - length; ++i) *first++ = '0';
+                __WriteDecimal(first + length, digits);
+
+                result.Pointer = first + length;
+            }
+
+            result.Error = CONVERSION_ERROR_NONE;
+            return result;
+        }
+
+        /// @brief Writes infinity or NaN
+        inline ToCharsResult __WriteNonFinite(char* first, char* last, bool negative, bool nan) {
+            ToCharsResult result = { last, CONVERSION_ERROR_VALUE_TOO_LARGE };
+            const char* text = nan ? "nan" : "inf";
+
+            if(last - first < (negative ? 4 : 3)) return result;
+            if(negative) *first++ = '-';
+
+            for(int i = 0; i < 3; ++i) *first++ = text[i];
+
+            result.Pointer = first;
+            result.Error = CONVERSION_ERROR_NONE;
+            return result;
+        }
+
+        template<typename Bits>
+        inline ToCharsResult __ToCharsFloat(char* first, char* last, Bits bits, CharsFormat format) {
+            const int mantissaBits = sizeof(Bits) == 8 ? 52 : 23;
+            const Bits exponentMask = static_cast<Bits>(sizeof(Bits) == 8 ? 0x7FF : 0xFF);
+
+            const bool negative = (bits >> (sizeof(Bits) * 8 - 1)) != 0;
+            const Bits magnitude = static_cast<Bits>(bits & ~(Bits(1) << (sizeof(Bits) * 8 - 1)));
+
+            if((magnitude >> mantissaBits) == exponentMask) {
+                return __WriteNonFinite(first, last, negative, (magnitude & ((Bits(1) << mantissaBits) - 1)) != 0);
+            }
+
+            if(magnitude == 0) return __WriteDecimalFloat(first, last, negative, 0, 0, 0, 0, format);
+
+            const int biasedExponent = static_cast<int>(magnitude >> mantissaBits);
+            const uint64_t significand = (magnitude & ((Bits(1) << mantissaBits) - 1)) | (biasedExponent != 0 ? uint64_t(1) << mantissaBits : 0);
+            const int exponent = (biasedExponent != 0 ? biasedExponent : 1) - static_cast<int>(exponentMask >> 1) - mantissaBits;
+
+            const __DecimalFloat decimal = __ShortestDecimal(magnitude);
+            return __WriteDecimalFloat(first, last, negative, decimal.Significand, decimal.Exponent, significand, exponent, format);
+        }
+
+        union __FloatBits {
+            float Value;
+            uint32_t Bits;
+        };
+
+        union __DoubleBits {
+            double Value;
+            uint64_t Bits;
+        };
+    }
+
+    /// @brief Converts a floating-point value to the shortest text that reads back as the same value
+    /// @param first Beginning of the buffer to write to
+    /// @param last End of the buffer to write to
+    /// @param value The value to convert
+    /// @param format Notation to use, the shorter one by default
+    /// @return One past the last character written, or the end of the buffer and
+    /// `CONVERSION_ERROR_VALUE_TOO_LARGE` if the text does not fit. Nothing is null-terminated
+    /// @details Uses the Schubfach algorithm, which needs a few 64-bit multiplications and no
+    /// big-number arithmetic. Scientific notation looks like `1.5e-07`, infinity and NaN are
+    /// written as `inf` and `nan`
+    /// @ingroup charconv
+    /// @see https://en.cppreference.com/w/cpp/utility/to_chars
+    inline ToCharsResult ToChars(char* first, char* last, float value, CharsFormat format = CHARS_FORMAT_GENERAL) {
+        __private::__FloatBits bits;
+        bits.Value = value;
+
+        return __private::__ToCharsFloat(first, last, bits.Bits, format);
+    }
+
+    /// @copydoc ToChars(char*, char*, float, CharsFormat)
+    inline ToCharsResult ToChars(char* first, char* last, double value, CharsFormat format = CHARS_FORMAT_GENERAL) {
+        __private::__DoubleBits bits;
+        bits.Value = value;
+
+        return __private::__ToCharsFloat(first, last, bits.Bits, format);
+    }
+    // From characters result
+
+    /// @brief Result of `FromChars`
+    /// @ingroup charconv
+    /// @see https://en.cppreference.com/w/cpp/utility/from_chars_result
+    struct FromCharsResult {
+        /// @brief One past the last character parsed, or the beginning of the text if nothing matched
+        const char* Pointer;
+        ConversionError Error;
+    };
+
+    namespace __private {
+        /// @brief Gets the value of a digit of the bases up to 36, or 36 if the character is not one
+        inline unsigned __DigitValue(char c) {
+            const unsigned character = static_cast<unsigned char>(c);
+            const unsigned digit = character - '0';
+
+            if(digit < 10) return digit;
+
+            const unsigned letter = (character | 0x20U) - 'a';
+            return letter < 26 ? letter + 10 : 36;
+        }
+
+        inline bool __IsDecimalDigit(char c) {
+            return static_cast<unsigned>(static_cast<unsigned char>(c)) - '0' < 10;
+        }
+
+        /// @brief Loads eight characters as a little-endian word, compilers merge it into one load
+        inline uint64_t __LoadEightCharacters(const char* pointer) {
+            uint64_t word = 0;
+            for(int i = 0; i < 8; ++i) word |= static_cast<uint64_t>(static_cast<unsigned char>(pointer[i])) << (8 * i);
+
+            return word;
+        }
+
+        /// @brief Checks if all eight characters of a word are decimal digits
+        inline bool __IsEightDigits(uint64_t word) {
+            return ((word & 0xF0F0F0F0F0F0F0F0ULL) | (((word + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4)) == 0x3333333333333333ULL;
+        }
+
+        /// @brief Converts eight decimal digits in a word to their value, combining pairs of lanes in three multiplications
+        inline uint32_t __ParseEightDigits(uint64_t word) {
+            const uint64_t mask = 0x000000FF000000FFULL;
+            const uint64_t multiplier1 = 100 + (1000000ULL << 32);
+            const uint64_t multiplier2 = 1 + (10000ULL << 32);
+
+            word -= 0x3030303030303030ULL;
+            word = word * 10 + (word >> 8);
+
+            return static_cast<uint32_t>((((word & mask) * multiplier1) + (((word >> 16) & mask) * multiplier2)) >> 32);
+        }
+
+        /// @brief Parses decimal digits, eight at a time while they cannot overflow
+        template<typename T>
+        inline const char* __ParseDecimalInteger(const char* first, const char* last, T& value, bool& overflow) {
+            while(first != last && *first == '0') ++first;
+
+            const char* const significant = first;
+            // Up to Digits10 digits always fit, only the one after needs a check
+            const ptrdiff_t unchecked = NumericLimits<T>::Digits10;
+            T result = 0;
+
+            while(last - first >= 8 && (first - significant) + 8 <= unchecked) {
+                const uint64_t word = __LoadEightCharacters(first);
+                if(!__IsEightDigits(word)) break;
+
+                result = static_cast<T>(result * 100000000U + __ParseEightDigits(word));
+                first += 8;
+            }
+
+            while(first != last && first - significant < unchecked && __IsDecimalDigit(*first)) {
+                result = static_cast<T>(result * 10 + static_cast<unsigned>(*first - '0'));
+                ++first;
+            }
+
+            overflow = false;
+
+            if(first != last && __IsDecimalDigit(*first)) {
+                const unsigned digit = static_cast<unsigned>(*first - '0');
+
+                if(result > (NumericLimits<T>::Max() - digit) / 10) overflow = true;
+                else result = static_cast<T>(result * 10 + digit);
+
+                for(++first; first != last && __IsDecimalDigit(*first); ++first) overflow = true;
+            }
+
+            value = result;
+            return first;
+        }
+
+        template<typename T>
+        inline const char* __ParseInteger(const char* first, const char* last, T& value, int base, bool& overflow) {
+            if(base == 10) return __ParseDecimalInteger(first, last, value, overflow);
+
+            const T divisor = static_cast<T>(base);
+            const T limit = NumericLimits<T>::Max() / divisor;
+            const unsigned limitDigit = static_cast<unsigned>(NumericLimits<T>::Max() % divisor);
+            T result = 0;
+
+            overflow = false;
+
+            for(; first != last; ++first) {
+                const unsigned digit = __DigitValue(*first);
+                if(digit >= static_cast<unsigned>(base)) break;
+
+                if(result > limit || (result == limit && digit > limitDigit)) overflow = true;
+                else if(!overflow) result = static_cast<T>(result * divisor + digit);
+            }
+
+            value = result;
+            return first;
+        }
+
+        /// @brief Negates a magnitude that fits the signed type without overflowing on the minimum
+        template<typename T, typename U>
+        inline T __NegateMagnitude(U magnitude) {
+            return magnitude == 0 ? T(0) : static_cast<T>(-static_cast<T>(magnitude - 1) - 1);
+        }
+    }
+
+    // From characters
+
+    /// @brief Parses an integer from text
+    /// @tparam T Type of the integer
+    /// @param first Beginning of the text
+    /// @param last End of the text
+    /// @param value Receives the integer, unchanged on error
+    /// @param base Base of the text, from 2 to 36, letters may be uppercase or lowercase
+    /// @return One past the last digit and no error, `CONVERSION_ERROR_INVALID_ARGUMENT` and `first`
+    /// if the text does not start with a digit, or `CONVERSION_ERROR_RESULT_OUT_OF_RANGE` if the
+    /// number does not fit. A minus sign is accepted for signed types, no plus sign, prefix or whitespace
+    /// @details Decimal text is read eight digits at a time with SWAR arithmetic as long as
+    /// the value cannot overflow, so only the last digit of the longest numbers is checked
+    /// @throws `OutOfRange` if the base is not in the range
+    /// @ingroup charconv
+    /// @see https://en.cppreference.com/w/cpp/utility/from_chars
+    template<typename T>
+    typename EnableIf<IsIntegral<T>::Value && !IsSame<typename RemoveCV<T>::Type, bool>::Value, FromCharsResult>::Type
+    FromChars(const char* first, const char* last, T& value, int base = 10) {
+        typedef typename Conditional<(sizeof(T) > 4), uint64_t, uint32_t>::Type UnsignedType;
+
+        FromCharsResult result = { first, CONVERSION_ERROR_INVALID_ARGUMENT };
+        __WSTL_ASSERT_RETURNVALUE__(base >= 2 && base <= 36, WSTL_MAKE_EXCEPTION(OutOfRange, "Base out of range"), result);
+
+        const bool negative = IsSigned<T>::Value && first != last && *first == '-';
+        const char* const digits = negative ? first + 1 : first;
+
+        UnsignedType magnitude;
+        bool overflow;
+
+        const char* const end = __private::__ParseInteger(digits, last, magnitude, base, overflow);
+        if(end == digits) return result;
+
+        result.Pointer = end;
+
+        const UnsignedType maximum = static_cast<UnsignedType>(static_cast<UnsignedType>(NumericLimits<T>::Max()) + (negative ? 1U : 0U));
+
+        if(overflow || magnitude > maximum) {
+            result.Error = CONVERSION_ERROR_RESULT_OUT_OF_RANGE;
+            return result;
+        }
+
+        value = negative ? __private::__NegateMagnitude<T>(magnitude) : static_cast<T>(magnitude);
+        result.Error = CONVERSION_ERROR_NONE;
+        return result;
+    }
+
+    /// @brief Parses an integer from a string view or a string
+    /// @tparam T Type of the integer
+    /// @param text The text, strings convert to a view implicitly
+    /// @param value Receives the integer, unchanged on error
+    /// @param base Base of the text, from 2 to 36
+    /// @return See `FromChars(const char*, const char*, T&, int)`
+    /// @ingroup charconv
+    template<typename T>
+    typename EnableIf<IsIntegral<T>::Value && !IsSame<typename RemoveCV<T>::Type, bool>::Value, FromCharsResult>::Type
+    FromChars(const StringView& text, T& value, int base = 10) {
+        return FromChars(text.Data(), text.Data() + text.Size(), value, base);
+    }
+
+    namespace __private {
+        /// @brief Parameters of a binary floating-point format
+        template<typename T>
+        struct __BinaryFormat;
+
+        template<>
+        struct __BinaryFormat<float> {
+            typedef uint32_t BitsType;
+            typedef __FloatBits UnionType;
+
+            static const int MantissaBits = 23;
+            static const int Bias = -127;
+            static const int InfinitePower = 0xFF;
+            static const int SmallestPowerOf10 = -65;
+            static const int LargestPowerOf10 = 38;
+            static const int MinRoundToEven = -17;
+            static const int MaxRoundToEven = 10;
+            static const uint64_t QuietNaN = 0x7FC00000ULL;
+        };
+
+        template<>
+        struct __BinaryFormat<double> {
+            typedef uint64_t BitsType;
+            typedef __DoubleBits UnionType;
+
+            static const int MantissaBits = 52;
+            static const int Bias = -1023;
+            static const int InfinitePower = 0x7FF;
+            static const int SmallestPowerOf10 = -342;
+            static const int LargestPowerOf10 = 308;
+            static const int MinRoundToEven = -4;
+            static const int MaxRoundToEven = 23;
+            static const uint64_t QuietNaN = 0x7FF8000000000000ULL;
+        };
+
+        /// @brief A binary floating-point value as the stored mantissa and the biased exponent
+        struct __AdjustedMantissa {
+            uint64_t Mantissa;
+            int Power2;
+
+            bool operator==(const __AdjustedMantissa& other) const {
+                return Mantissa == other.Mantissa && Power2 == other.Power2;
+            }
+
+            bool operator!=(const __AdjustedMantissa& other) const {
+                return !(*this == other);
+            }
+        };
+
+        /// @brief Decimal number in text, split into its first 19 significant digits and the rest
+        struct __DecimalText {
+            /// @brief The first 19 significant digits
+            uint64_t Significand;
+            /// @brief Power of ten of the significand
+            int64_t Exponent;
+            /// @brief Exponent written after `e`
+            int64_t ExplicitExponent;
+            /// @brief Whether there are more significant digits than the significand holds
+            bool Truncated;
+
+            const char* IntegerFirst;
+            const char* IntegerLast;
+            const char* FractionFirst;
+            const char* FractionLast;
+        };
+
+        /// @brief Reads decimal digits into a wrapping accumulator, eight at a time
+        inline const char* __AccumulateDigits(const char* first, const char* last, uint64_t& value) {
+            while(last - first >= 8) {
+                const uint64_t word = __LoadEightCharacters(first);
+                if(!__IsEightDigits(word)) break;
+
+                value = value * 100000000U + __ParseEightDigits(word);
+                first += 8;
+            }
+
+            for(; first != last && __IsDecimalDigit(*first); ++first) value = value * 10 + static_cast<unsigned>(*first - '0');
+            return first;
+        }
+
+        /// @brief Splits the text of a decimal number
+        /// @return One past the number, or a null pointer if there is no number
+        inline const char* __ParseDecimalText(const char* first, const char* last, __DecimalText& text, CharsFormat format) {
+            uint64_t significand = 0;
+
+            text.IntegerFirst = first;
+            first = __AccumulateDigits(first, last, significand);
+            text.IntegerLast = first;
+
+            text.FractionFirst = text.FractionLast = first;
+
+            if(first != last && *first == '.') {
+                text.FractionFirst = ++first;
+                first = __AccumulateDigits(first, last, significand);
+                text.FractionLast = first;
+            }
+
+            const ptrdiff_t integerLength = text.IntegerLast - text.IntegerFirst;
+            const ptrdiff_t fractionLength = text.FractionLast - text.FractionFirst;
+
+            if(integerLength + fractionLength == 0) return NullPointer;
+
+            // The exponent belongs to the number only if digits follow it
+            int64_t explicitExponent = 0;
+            bool hasExponent = false;
+
+            if((format & CHARS_FORMAT_SCIENTIFIC) != 0 && first != last && (*first | 0x20) == 'e') {
+                const char* position = first + 1;
+                const bool negative = position != last && *position == '-';
+
+                if(position != last && (*position == '-' || *position == '+')) ++position;
+
+                if(position != last && __IsDecimalDigit(*position)) {
+                    for(; position != last && __IsDecimalDigit(*position); ++position) {
+                        if(explicitExponent < 0x10000000) explicitExponent = explicitExponent * 10 + (*position - '0');
+                    }
+
+                    if(negative) explicitExponent = -explicitExponent;
+
+                    first = position;
+                    hasExponent = true;
+                }
+            }
+
+            if(format == CHARS_FORMAT_SCIENTIFIC && !hasExponent) return NullPointer;
+
+            text.Significand = significand;
+            text.Exponent = explicitExponent - fractionLength;
+            text.ExplicitExponent = explicitExponent;
+            text.Truncated = false;
+
+            ptrdiff_t digitCount = integerLength + fractionLength;
+
+            if(digitCount > 19) {
+                for(const char* position = text.IntegerFirst; position != text.FractionLast && (*position == '0' || *position == '.'); ++position) {
+                    if(*position == '0') --digitCount;
+                }
+
+                // Keep the first 19 significant digits, leading zeros add nothing to the value
+                if(digitCount > 19) {
+                    const uint64_t minimum = 1000000000000000000ULL;
+                    const char* position = text.IntegerFirst;
+
+                    significand = 0;
+                    for(; significand < minimum && position != text.IntegerLast; ++position) significand = significand * 10 + static_cast<unsigned>(*position - '0');
+
+                    if(significand >= minimum) text.Exponent = explicitExponent + (text.IntegerLast - position);
+                    else {
+                        position = text.FractionFirst;
+                        for(; significand < minimum && position != text.FractionLast; ++position) significand = significand * 10 + static_cast<unsigned>(*position - '0');
+
+                        text.Exponent = explicitExponent - (position - text.FractionFirst);
+                    }
+
+                    text.Significand = significand;
+                    text.Truncated = true;
+                }
+            }
+
+            return first;
+        }
+
+        /// @brief Converts `w * 10^q` to binary with the Eisel-Lemire algorithm, exact for any `w`
+        /// @details `w` is multiplied by a 128-bit approximation of `5^q`, the second half of it is
+        /// only needed when the bits below the mantissa of the first product are all ones
+        /// @see https://arxiv.org/abs/2101.11408
+        template<typename T>
+        inline __AdjustedMantissa __EiselLemire(int64_t q, uint64_t w) {
+            typedef __BinaryFormat<T> Format;
+            __AdjustedMantissa answer = { 0, 0 };
+
+            if(w == 0 || q < Format::SmallestPowerOf10) return answer;
+
+            if(q > Format::LargestPowerOf10) {
+                answer.Power2 = Format::InfinitePower;
+                return answer;
+            }
+
+            const int leadingZeros = CountLeftZero(w);
+            w <<= leadingZeros;
+
+            const uint64_t* power = __PowersOfFive<>::Values[q - __PowersOfFive<>::MinExponent];
+            const uint64_t precisionMask = 0xFFFFFFFFFFFFFFFFULL >> (Format::MantissaBits + 3);
+
+            uint64_t high = __MultiplyHigh64(w, power[0]);
+            uint64_t low = w * power[0];
+
+            if((high & precisionMask) == precisionMask) {
+                const uint64_t secondHigh = __MultiplyHigh64(w, power[1]);
+
+                low += secondHigh;
+                if(secondHigh > low) ++high;
+            }
+
+            const int upperBit = static_cast<int>(high >> 63);
+            const int shift = upperBit + 64 - Format::MantissaBits - 3;
+
+            answer.Mantissa = high >> shift;
+            // (217706 * q) >> 16 is floor(q * log2(10))
+            answer.Power2 = static_cast<int>(((217706 * q) >> 16) + 63 + upperBit - leadingZeros - Format::Bias);
+
+            if(answer.Power2 <= 0) {
+                // Subnormal, or zero if even the largest mantissa is shifted out
+                if(-answer.Power2 + 1 >= 64) {
+                    answer.Mantissa = 0;
+                    answer.Power2 = 0;
+                    return answer;
+                }
+
+                answer.Mantissa >>= -answer.Power2 + 1;
+                answer.Mantissa += answer.Mantissa & 1;
+                answer.Mantissa >>= 1;
+                answer.Power2 = answer.Mantissa < (uint64_t(1) << Format::MantissaBits) ? 0 : 1;
+                return answer;
+            }
+
+            // Exactly halfway between two values, which is only possible for small powers: round to even
+            if(low <= 1 && q >= Format::MinRoundToEven && q <= Format::MaxRoundToEven && (answer.Mantissa & 3) == 1) {
+                if((answer.Mantissa << shift) == high) answer.Mantissa &= ~uint64_t(1);
+            }
+
+            answer.Mantissa += answer.Mantissa & 1;
+            answer.Mantissa >>= 1;
+
+            if(answer.Mantissa >= (uint64_t(2) << Format::MantissaBits)) {
+                answer.Mantissa = uint64_t(1) << Format::MantissaBits;
+                ++answer.Power2;
+            }
+
+            answer.Mantissa &= ~(uint64_t(1) << Format::MantissaBits);
+
+            if(answer.Power2 >= Format::InfinitePower) {
+                answer.Power2 = Format::InfinitePower;
+                answer.Mantissa = 0;
+            }
+
+            return answer;
+        }
+
+        /// @brief Decimal number with up to 800 digits, for the inputs the fast path cannot decide
+        /// @details The value is `0.Digits * 10^Point`. Shifting by powers of two is done digit
+        /// by digit, so the conversion is exact, but slow and it needs the digits on the stack
+        struct __BigDecimal {
+            static const int MaxDigits = 800;
+            static const int MaxShift = 60;
+
+            unsigned char Digits[MaxDigits];
+            int Count;
+            int Point;
+            bool Truncated;
+
+            void Push(unsigned digit) {
+                if(Count < MaxDigits) Digits[Count++] = static_cast<unsigned char>(digit);
+                else if(digit != 0) Truncated = true;
+            }
+
+            void Trim() {
+                while(Count > 0 && Digits[Count - 1] == 0) --Count;
+                if(Count == 0) Point = 0;
+            }
+
+            void Assign(const __DecimalText& text) {
+                Count = 0;
+                Point = 0;
+                Truncated = false;
+
+                for(const char* position = text.IntegerFirst; position != text.IntegerLast; ++position) {
+                    const unsigned digit = static_cast<unsigned>(*position - '0');
+                    if(Count == 0 && digit == 0) continue;
+
+                    ++Point;
+                    Push(digit);
+                }
+
+                for(const char* position = text.FractionFirst; position != text.FractionLast; ++position) {
+                    const unsigned digit = static_cast<unsigned>(*position - '0');
+
+                    if(Count == 0 && digit == 0) --Point;
+                    else Push(digit);
+                }
+
+                Point += static_cast<int>(text.ExplicitExponent);
+                Trim();
+            }
+
+            void Assign(uint64_t value) {
+                char text[20];
+                const char* position = __WriteDecimal(text + 20, value);
+
+                Count = 0;
+                Truncated = false;
+
+                for(; position != text + 20; ++position) Push(static_cast<unsigned>(*position - '0'));
+
+                Point = Count;
+                Trim();
+            }
+
+            void ShiftLeft(unsigned shift) {
+                // Count the digits the carry adds before writing anything
+                uint64_t carry = 0;
+                for(int read = Count - 1; read >= 0; --read) carry = ((static_cast<uint64_t>(Digits[read]) << shift) + carry) / 10;
+
+                int added = 0;
+                for(; carry != 0; carry /= 10) ++added;
+
+                int write = Count + added;
+                uint64_t n = 0;
+
+                for(int read = Count - 1; read >= 0; --read) {
+                    n += static_cast<uint64_t>(Digits[read]) << shift;
+
+                    const uint64_t quotient = n / 10;
+                    const unsigned remainder = static_cast<unsigned>(n - 10 * quotient);
+
+                    if(--write < MaxDigits) Digits[write] = static_cast<unsigned char>(remainder);
+                    else if(remainder != 0) Truncated = true;
+
+                    n = quotient;
+                }
+
+                while(n != 0) {
+                    const uint64_t quotient = n / 10;
+                    const unsigned remainder = static_cast<unsigned>(n - 10 * quotient);
+
+                    if(--write < MaxDigits) Digits[write] = static_cast<unsigned char>(remainder);
+                    else if(remainder != 0) Truncated = true;
+
+                    n = quotient;
+                }
+
+                Count += added;
+                if(Count > MaxDigits) Count = MaxDigits;
+
+                Point += added;
+                Trim();
+            }
+
+            void ShiftRight(unsigned shift) {
+                int read = 0;
+                int write = 0;
+                uint64_t n = 0;
+
+                // Take enough leading digits to produce the first digit of the result
+                for(; (n >> shift) == 0; ++read) {
+                    if(read >= Count) {
+                        if(n == 0) {
+                            Count = 0;
+                            return;
+                        }
+
+                        while((n >> shift) == 0) {
+                            n *= 10;
+                            ++read;
+                        }
+
+                        break;
+                    }
+
+                    n = n * 10 + Digits[read];
+                }
+
+                Point -= read - 1;
+
+                const uint64_t mask = (uint64_t(1) << shift) - 1;
+
+                for(; read < Count; ++read) {
+                    const uint64_t digit = n >> shift;
+                    n &= mask;
+
+                    Digits[write++] = static_cast<unsigned char>(digit);
+                    n = n * 10 + Digits[read];
+                }
+
+                while(n != 0) {
+                    const uint64_t digit = n >> shift;
+                    n &= mask;
+
+                    if(write < MaxDigits) Digits[write++] = static_cast<unsigned char>(digit);
+                    else if(digit != 0) Truncated = true;
+
+                    n *= 10;
+                }
+
+                Count = write;
+                Trim();
+            }
+
+            /// @brief Multiplies by `2^shift`, divides for a negative shift
+            void Shift(int shift) {
+                if(Count == 0) return;
+
+                for(; shift > MaxShift; shift -= MaxShift) ShiftLeft(MaxShift);
+                for(; shift < -MaxShift; shift += MaxShift) ShiftRight(MaxShift);
+
+                if(shift > 0) ShiftLeft(static_cast<unsigned>(shift));
+                else if(shift < 0) ShiftRight(static_cast<unsigned>(-shift));
+            }
+
+            /// @brief Keeps the first `count` digits, rounded to nearest with ties to even
+            void Round(int count) {
+                if(count < 0 || count >= Count) return;
+
+                const bool up = Digits[count] == 5 && count + 1 == Count ?
+                    Truncated || (count > 0 && (Digits[count - 1] & 1) != 0) : Digits[count] >= 5;
+
+                if(!up) {
+                    Count = count;
+                    Trim();
+                    return;
+                }
+
+                int i = count - 1;
+                while(i >= 0 && Digits[i] == 9) --i;
+
+                if(i < 0) {
+                    Digits[0] = 1;
+                    Count = 1;
+                    ++Point;
+                }
+                else {
+                    ++Digits[i];
+                    Count = i + 1;
+                }
+            }
+
+            /// @brief Gets the integer part rounded to nearest, ties to even
+            uint64_t RoundedInteger() const {
+                if(Point > 20) return 0xFFFFFFFFFFFFFFFFULL;
+
+                uint64_t n = 0;
+                int i = 0;
+
+                for(; i < Point && i < Count; ++i) n = n * 10 + Digits[i];
+                for(; i < Point; ++i) n *= 10;
+
+                if(Point >= 0 && Point < Count) {
+                    if(Digits[Point] == 5 && Point + 1 == Count) {
+                        if(Truncated || (Point > 0 && (Digits[Point - 1] & 1) != 0)) ++n;
+                    }
+                    else if(Digits[Point] >= 5) ++n;
+                }
+
+                return n;
+            }
+        };
+
+        /// @brief Converts a decimal number to binary exactly by shifting its digits
+        template<typename T>
+        inline __AdjustedMantissa __SlowDecimalToBinary(const __DecimalText& text) {
+            typedef __BinaryFormat<T> Format;
+
+            static const int Powers[] = { 1, 3, 6, 9, 13, 16, 19, 23, 26 };
+            const int maxExponent = (1 << (Format::InfinitePower == 0xFF ? 8 : 11)) - 1;
+
+            __AdjustedMantissa answer = { 0, 0 };
+            __BigDecimal decimal;
+            decimal.Assign(text);
+
+            if(decimal.Count == 0 || decimal.Point < -330) return answer;
+
+            if(decimal.Point > 310) {
+                answer.Power2 = Format::InfinitePower;
+                return answer;
+            }
+
+            // Scale by powers of two into [0.5, 1)
+            int exponent = 0;
+
+            while(decimal.Point > 0) {
+                const int n = decimal.Point >= 9 ? 27 : Powers[decimal.Point];
+                decimal.Shift(-n);
+                exponent += n;
+            }
+
+            while(decimal.Point < 0 || (decimal.Point == 0 && decimal.Digits[0] < 5)) {
+                const int n = -decimal.Point >= 9 ? 27 : Powers[-decimal.Point];
+                decimal.Shift(n);
+                exponent -= n;
+            }
+
+            --exponent;
+
+            if(exponent < Format::Bias + 1) {
+                const int n = Format::Bias + 1 - exponent;
+                decimal.Shift(-n);
+                exponent += n;
+            }
+
+            if(exponent - Format::Bias >= maxExponent) {
+                answer.Power2 = Format::InfinitePower;
+                return answer;
+            }
+
+            decimal.Shift(1 + Format::MantissaBits);
+            uint64_t mantissa = decimal.RoundedInteger();
+
+            if(mantissa == (uint64_t(2) << Format::MantissaBits)) {
+                mantissa >>= 1;
+
+                if(++exponent - Format::Bias >= maxExponent) {
+                    answer.Power2 = Format::InfinitePower;
+                    return answer;
+                }
+            }
+
+            if((mantissa & (uint64_t(1) << Format::MantissaBits)) == 0) exponent = Format::Bias;
+
+            answer.Mantissa = mantissa & ((uint64_t(1) << Format::MantissaBits) - 1);
+            answer.Power2 = exponent - Format::Bias;
+            return answer;
+        }
+
+        /// @brief Matches a word ignoring case
+        inline bool __MatchWord(const char* first, const char* last, const char* word, ptrdiff_t length) {
+            if(last - first < length) return false;
+
+            for(ptrdiff_t i = 0; i < length; ++i) {
+                if((first[i] | 0x20) != word[i]) return false;
+            }
+
+            return true;
+        }
+
+        /// @brief Parses `inf`, `infinity`, `nan` or `nan(...)`
+        /// @return One past the word, or `first` if there is none
+        inline const char* __ParseNonFinite(const char* first, const char* last, bool& nan) {
+            if(__MatchWord(first, last, "inf", 3)) {
+                nan = false;
+                return __MatchWord(first + 3, last, "inity", 5) ? first + 8 : first + 3;
+            }
+
+            if(__MatchWord(first, last, "nan", 3)) {
+                nan = true;
+
+                const char* position = first + 3;
+                if(position == last || *position != '(') return position;
+
+                for(++position; position != last; ++position) {
+                    const char c = *position;
+
+                    if(c == ')') return position + 1;
+                    if(!(__DigitValue(c) < 36 || c == '_')) break;
+                }
+
+                return first + 3;
+            }
+
+            return first;
+        }
+
+        template<typename T>
+        inline FromCharsResult __FromCharsFloat(const char* first, const char* last, T& value, CharsFormat format) {
+            typedef __BinaryFormat<T> Format;
+            typedef typename Format::BitsType BitsType;
+
+            FromCharsResult result = { first, CONVERSION_ERROR_INVALID_ARGUMENT };
+
+            const bool negative = first != last && *first == '-';
+            const char* const start = negative ? first + 1 : first;
+            const BitsType sign = negative ? static_cast<BitsType>(BitsType(1) << (sizeof(BitsType) * 8 - 1)) : BitsType(0);
+
+            typename Format::UnionType number;
+            bool nan;
+
+            const char* end = __ParseNonFinite(start, last, nan);
+
+            if(end != start) {
+                number.Bits = static_cast<BitsType>(sign | (nan ? Format::QuietNaN : static_cast<uint64_t>(Format::InfinitePower) << Format::MantissaBits));
+                value = number.Value;
+
+                result.Pointer = end;
+                result.Error = CONVERSION_ERROR_NONE;
+                return result;
+            }
+
+            __DecimalText text;
+
+            end = __ParseDecimalText(start, last, text, format);
+            if(end == NullPointer) return result;
+
+            result.Pointer = end;
+
+            __AdjustedMantissa answer = __EiselLemire<T>(text.Exponent, text.Significand);
+
+            // The dropped digits matter only if the next larger significand rounds differently
+            if(text.Truncated && answer != __EiselLemire<T>(text.Exponent, text.Significand + 1)) {
+                answer = __SlowDecimalToBinary<T>(text);
+            }
+
+            if(answer.Power2 == Format::InfinitePower || (answer.Power2 == 0 && answer.Mantissa == 0 && text.Significand != 0)) {
+                result.Error = CONVERSION_ERROR_RESULT_OUT_OF_RANGE;
+                return result;
+            }
+
+            number.Bits = static_cast<BitsType>(sign | answer.Mantissa | (static_cast<uint64_t>(answer.Power2) << Format::MantissaBits));
+            value = number.Value;
+
+            result.Error = CONVERSION_ERROR_NONE;
+            return result;
+        }
+    }
+
+    /// @brief Parses a floating-point value from text, correctly rounded
+    /// @param first Beginning of the text
+    /// @param last End of the text
+    /// @param value Receives the value, unchanged on error
+    /// @param format Notations to accept, `CHARS_FORMAT_SCIENTIFIC` requires an exponent and
+    /// `CHARS_FORMAT_FIXED` does not read one
+    /// @return One past the number and no error, `CONVERSION_ERROR_INVALID_ARGUMENT` and `first` if
+    /// the text does not start with a number, or `CONVERSION_ERROR_RESULT_OUT_OF_RANGE` if it
+    /// overflows to infinity or underflows to zero. `inf`, `infinity`, `nan` and `nan(...)` are
+    /// accepted in any case, a minus sign is accepted, no plus sign or whitespace
+    /// @details Numbers with up to 19 significant digits are converted with the Eisel-Lemire
+    /// algorithm, which uses one or two 64-bit multiplications and no floating-point arithmetic.
+    /// Longer numbers fall back to exact decimal arithmetic, which takes around a kilobyte of stack,
+    /// when their first 19 digits do not decide the result
+    /// @ingroup charconv
+    /// @see https://en.cppreference.com/w/cpp/utility/from_chars
+    inline FromCharsResult FromChars(const char* first, const char* last, float& value, CharsFormat format = CHARS_FORMAT_GENERAL) {
+        return __private::__FromCharsFloat(first, last, value, format);
+    }
+
+    /// @copydoc FromChars(const char*, const char*, float&, CharsFormat)
+    inline FromCharsResult FromChars(const char* first, const char* last, double& value, CharsFormat format = CHARS_FORMAT_GENERAL) {
+        return __private::__FromCharsFloat(first, last, value, format);
+    }
+
+    /// @brief Parses a floating-point value from a string view or a string
+    /// @param text The text, strings convert to a view implicitly
+    /// @param value Receives the value, unchanged on error
+    /// @param format Notations to accept
+    /// @return See `FromChars(const char*, const char*, float&, CharsFormat)`
+    /// @ingroup charconv
+    inline FromCharsResult FromChars(const StringView& text, float& value, CharsFormat format = CHARS_FORMAT_GENERAL) {
+        return FromChars(text.Data(), text.Data() + text.Size(), value, format);
+    }
+
+    /// @copydoc FromChars(const StringView&, float&, CharsFormat)
+    inline FromCharsResult FromChars(const StringView& text, double& value, CharsFormat format = CHARS_FORMAT_GENERAL) {
+        return FromChars(text.Data(), text.Data() + text.Size(), value, format);
+    }
+
+    // To characters with precision
+
+    namespace __private {
+        inline char* __WriteExponent(char* first, int exponent) {
+            *first++ = 'e';
+            *first++ = exponent < 0 ? '-' : '+';
+
+            if(exponent < 0) exponent = -exponent;
+
+            if(exponent >= 100) {
+                *first++ = static_cast<char>('0' + exponent / 100);
+                exponent %= 100;
+            }
+
+            __WriteDigitPair(first, static_cast<uint32_t>(exponent));
+            return first + 2;
+        }
+
+        /// @brief Writes the digits of a rounded decimal with `precision` digits after the point
+        inline ToCharsResult __WriteFixedDigits(char* first, char* last, bool negative, const __BigDecimal& decimal, int precision) {
+            ToCharsResult result = { last, CONVERSION_ERROR_VALUE_TOO_LARGE };
+
+            const int integerLength = decimal.Point > 0 ? decimal.Point : 1;
+            const ptrdiff_t total = (negative ? 1 : 0) + integerLength + (precision > 0 ? 1 + precision : 0);
+
+            if(last - first < total) return result;
+            if(negative) *first++ = '-';
+
+            if(decimal.Point > 0) {
+                for(int i = 0; i < decimal.Point; ++i) *first++ = static_cast<char>('0' + (i < decimal.Count ? decimal.Digits[i] : 0));
+            }
+            else *first++ = '0';
+
+            if(precision > 0) {
+                *first++ = '.';
+
+                for(int i = 0; i < precision; ++i) {
+                    const int index = decimal.Point + i;
+                    *first++ = static_cast<char>('0' + (index >= 0 && index < decimal.Count ? decimal.Digits[index] : 0));
+                }
+            }
+
+            result.Pointer = first;
+            result.Error = CONVERSION_ERROR_NONE;
+            return result;
+        }
+
+        /// @brief Writes the digits of a rounded decimal in scientific notation with `precision` digits after the point
+        inline ToCharsResult __WriteScientificDigits(char* first, char* last, bool negative, const __BigDecimal& decimal, int precision) {
+            ToCharsResult result = { last, CONVERSION_ERROR_VALUE_TOO_LARGE };
+
+            const int exponent = decimal.Count == 0 ? 0 : decimal.Point - 1;
+            const int absoluteExponent = exponent < 0 ? -exponent : exponent;
+            const ptrdiff_t total = (negative ? 1 : 0) + 1 + (precision > 0 ? 1 + precision : 0) + 2 + (absoluteExponent >= 100 ? 3 : 2);
+
+            if(last - first < total) return result;
+            if(negative) *first++ = '-';
+
+            *first++ = static_cast<char>('0' + (decimal.Count > 0 ? decimal.Digits[0] : 0));
+
+            if(precision > 0) {
+                *first++ = '.';
+                for(int i = 1; i <= precision; ++i) *first++ = static_cast<char>('0' + (i < decimal.Count ? decimal.Digits[i] : 0));
+            }
+
+            result.Pointer = __WriteExponent(first, exponent);
+            result.Error = CONVERSION_ERROR_NONE;
+            return result;
+        }
+
+        inline ToCharsResult __ToCharsPrecise(char* first, char* last, uint64_t bits, CharsFormat format, int precision) {
+            const bool negative = (bits >> 63) != 0;
+            const uint64_t magnitude = bits & ~(uint64_t(1) << 63);
+
+            if((magnitude >> 52) == 0x7FF) return __WriteNonFinite(first, last, negative, (magnitude & ((uint64_t(1) << 52) - 1)) != 0);
+            if(precision < 0) precision = 6;
+
+            const int biasedExponent = static_cast<int>(magnitude >> 52);
+            const uint64_t significand = (magnitude & ((uint64_t(1) << 52) - 1)) | (biasedExponent != 0 ? uint64_t(1) << 52 : 0);
+
+            // Every double has an exact decimal expansion, of at most 767 significant digits
+            __BigDecimal decimal;
+            decimal.Assign(significand);
+            decimal.Shift((biasedExponent != 0 ? biasedExponent : 1) - 1075);
+
+            if(format == CHARS_FORMAT_FIXED) {
+                decimal.Round(decimal.Point + precision);
+                return __WriteFixedDigits(first, last, negative, decimal, precision);
+            }
+
+            if(format == CHARS_FORMAT_SCIENTIFIC) {
+                decimal.Round(precision + 1);
+                return __WriteScientificDigits(first, last, negative, decimal, precision);
+            }
+
+            // As %g: the notation follows the exponent after rounding, trailing zeros are dropped
+            const int significant = precision == 0 ? 1 : precision;
+            decimal.Round(significant);
+
+            const int exponent = decimal.Count == 0 ? 0 : decimal.Point - 1;
+
+            if(exponent < significant && exponent >= -4) {
+                return __WriteFixedDigits(first, last, negative, decimal, decimal.Count > decimal.Point ? decimal.Count - decimal.Point : 0);
+            }
+
+            return __WriteScientificDigits(first, last, negative, decimal, decimal.Count > 1 ? decimal.Count - 1 : 0);
+        }
+    }
+
+    /// @brief Converts a floating-point value to text with a given precision
+    /// @param first Beginning of the buffer to write to
+    /// @param last End of the buffer to write to
+    /// @param value The value to convert
+    /// @param format Notation to use, general picks it like `%g` of `printf`
+    /// @param precision Digits after the point, or significant digits for the general notation. 
+    /// A negative precision means `6`
+    /// @return One past the last character written, or the end of the buffer and
+    /// `CONVERSION_ERROR_VALUE_TOO_LARGE` if the text does not fit. Nothing is null-terminated
+    /// @details The exact decimal expansion of the value is rounded to nearest with ties to even,
+    /// so the result matches `printf`. The expansion is computed digit by digit with around a
+    /// kilobyte of stack, prefer the shortest conversion where the precision is not fixed
+    /// @ingroup charconv
+    /// @see https://en.cppreference.com/w/cpp/utility/to_chars
+    inline ToCharsResult ToChars(char* first, char* last, double value, CharsFormat format, int precision) {
+        __private::__DoubleBits bits;
+        bits.Value = value;
+
+        return __private::__ToCharsPrecise(first, last, bits.Bits, format, precision);
+    }
+
+    /// @copydoc ToChars(char*, char*, double, CharsFormat, int)
+    inline ToCharsResult ToChars(char* first, char* last, float value, CharsFormat format, int precision) {
+        return ToChars(first, last, static_cast<double>(value), format, precision);
+    }
+}
+
+#endif
\ No newline at end of file
@@ -15,6 +15,12 @@
 #include "NullPointer.hpp"
 #include "Algorithm.hpp"
 
+#if defined(__WSTL_SSE2__)
+#include <emmintrin.h>
+#elif defined(__WSTL_NEON__)
+#include <arm_neon.h>
+#endif
+
 
 namespace wstl {
     namespace __private {
@@ -96,6 +102,141 @@ namespace wstl {
         #endif
     }
 
+    // Word-at-a-time primitives for byte-sized characters
+
+    namespace __private {
+        static const __WSTL_CONSTEXPR__ size_t __WORD_ONES = ~size_t(0) / 0xFFU;
+        static const __WSTL_CONSTEXPR__ size_t __WORD_HIGHS = __WORD_ONES * 0x80U;
+
+        /// @brief Checks whether any byte of a word is zero
+        inline bool __HasZeroByte(size_t word) {
+            return ((word - __WORD_ONES) & ~word & __WORD_HIGHS) != 0;
+        }
+
+        #if defined(__WSTL_SSE2__)
+        inline unsigned __LowestSetBit(unsigned mask) {
+            #if defined(__WSTL_GCC__) || defined(__WSTL_CLANG__)
+            return static_cast<unsigned>(__builtin_ctz(mask));
+            #else
+            unsigned index = 0;
+            for(; !(mask & 1U); mask >>= 1) ++index;
+            return index;
+            #endif
+        }
+        #endif
+
+        /// @brief Gets the length of a null-terminated byte string
+        /// @details Reads whole aligned blocks, which may go past the terminator but never 
+        /// cross the block that contains it
+        __WSTL_NO_SANITIZE_ADDRESS__ inline size_t __StringLength(const unsigned char* string) {
+            const unsigned char* pointer = string;
+
+            #if defined(__WSTL_SSE2__)
+            const size_t offset = reinterpret_cast<uintptr_t>(pointer) & 15U;
+            const __m128i* block = reinterpret_cast<const __m128i*>(pointer - offset);
+            const __m128i zero = _mm_setzero_si128();
+
+            unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_load_si128(block), zero))) >> offset;
+            if(mask != 0) return __LowestSetBit(mask);
+
+            for(;;) {
+                mask = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_load_si128(++block), zero)));
+                if(mask != 0) return static_cast<size_t>(reinterpret_cast<const unsigned char*>(block) - string) + __LowestSetBit(mask);
+            }
+            #elif defined(__WSTL_NEON__)
+            for(; (reinterpret_cast<uintptr_t>(pointer) & 15U) != 0; ++pointer) if(*pointer == 0) return static_cast<size_t>(pointer - string);
+            while(vmaxvq_u8(vceqzq_u8(vld1q_u8(pointer))) == 0) pointer += 16;
+            #else
+            for(; !__IsWordAligned(pointer); ++pointer) if(*pointer == 0) return static_cast<size_t>(pointer - string);
+            while(!__HasZeroByte(*reinterpret_cast<const __AliasWord*>(pointer))) pointer += __WORD_SIZE;
+            #endif
+
+            while(*pointer != 0) ++pointer;
+            return static_cast<size_t>(pointer - string);
+        }
+
+        /// @brief Gets the length of a null-terminated byte string, up to a maximum length
+        inline size_t __StringLength(const unsigned char* string, size_t maxLength) {
+            const unsigned char* pointer = string;
+            const unsigned char* const end = string + maxLength;
+
+            #if defined(__WSTL_SSE2__)
+            const __m128i zero = _mm_setzero_si128();
+
+            for(; end - pointer >= 16; pointer += 16) {
+                unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pointer)), zero)));
+                if(mask != 0) return static_cast<size_t>(pointer - string) + __LowestSetBit(mask);
+            }
+            #elif defined(__WSTL_NEON__)
+            for(; end - pointer >= 16 && vmaxvq_u8(vceqzq_u8(vld1q_u8(pointer))) == 0; pointer += 16);
+            #else
+            for(; pointer != end && !__IsWordAligned(pointer); ++pointer) if(*pointer == 0) return static_cast<size_t>(pointer - string);
+
+            for(; static_cast<size_t>(end - pointer) >= __WORD_SIZE; pointer += __WORD_SIZE) 
+                if(__HasZeroByte(*reinterpret_cast<const __AliasWord*>(pointer))) break;
+            #endif
+
+            while(pointer != end && *pointer != 0) ++pointer;
+            return static_cast<size_t>(pointer - string);
+        }
+
+        /// @brief Finds the first occurrence of a byte in a range
+        /// @return Pointer to the byte, or null pointer if not found
+        inline const unsigned char* __StringFind(const unsigned char* pointer, size_t count, unsigned char value) {
+            const unsigned char* const end = pointer + count;
+
+            #if defined(__WSTL_SSE2__)
+            const __m128i pattern = _mm_set1_epi8(static_cast<char>(value));
+
+            for(; end - pointer >= 16; pointer += 16) {
+                unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pointer)), pattern)));
+                if(mask != 0) return pointer + __LowestSetBit(mask);
+            }
+            #elif defined(__WSTL_NEON__)
+            const uint8x16_t pattern = vdupq_n_u8(value);
+            for(; end - pointer >= 16 && vmaxvq_u8(vceqq_u8(vld1q_u8(pointer), pattern)) == 0; pointer += 16);
+            #else
+            for(; pointer != end && !__IsWordAligned(pointer); ++pointer) if(*pointer == value) return pointer;
+
+            const size_t pattern = __WORD_ONES * value;
+            for(; static_cast<size_t>(end - pointer) >= __WORD_SIZE; pointer += __WORD_SIZE) 
+                if(__HasZeroByte(*reinterpret_cast<const __AliasWord*>(pointer) ^ pattern)) break;
+            #endif
+
+            for(; pointer != end; ++pointer) if(*pointer == value) return pointer;
+            return 0;
+        }
+
+        /// @brief Finds the index of the first differing byte of two ranges
+        /// @return Index of the first difference, or `count` if the ranges are equal
+        inline size_t __StringMismatch(const unsigned char* string1, const unsigned char* string2, size_t count) {
+            size_t i = 0;
+
+            #if defined(__WSTL_SSE2__)
+            for(; count - i >= 16; i += 16) {
+                unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(
+                    _mm_loadu_si128(reinterpret_cast<const __m128i*>(string1 + i)), 
+                    _mm_loadu_si128(reinterpret_cast<const __m128i*>(string2 + i)))));
+
+                if(mask != 0xFFFFU) return i + __LowestSetBit(~mask & 0xFFFFU);
+            }
+            #elif defined(__WSTL_NEON__)
+            for(; count - i >= 16 && vminvq_u8(vceqq_u8(vld1q_u8(string1 + i), vld1q_u8(string2 + i))) == 0xFFU; i += 16);
+            #else
+            if(__IsSameAlignment(string1, string2)) {
+                for(; i < count && !__IsWordAligned(string1 + i); ++i) if(string1[i] != string2[i]) return i;
+
+                for(; count - i >= __WORD_SIZE; i += __WORD_SIZE) {
+                    if(*reinterpret_cast<const __AliasWord*>(string1 + i) != *reinterpret_cast<const __AliasWord*>(string2 + i)) break;
+                }
+            }
+            #endif
+
+            for(; i < count; ++i) if(string1[i] != string2[i]) return i;
+            return count;
+        }
+    }
+
     /// @brief Class that stores character traits and provides static methods for character operations
     /// @tparam T Character type
     /// @ingroup string
@@ -125,20 +266,34 @@ namespace wstl {
 
         /// @brief Gets the length of a C-style string
         /// @param string C-style string pointer
+        /// @details Byte-sized characters are scanned a word at a time (or with SSE2/NEON 
+        /// if `__WSTL_USE_SIMD__` is defined) outside of constant evaluation
         static __WSTL_CONSTEXPR14__ size_t Length(const CharacterType* string) {
-            size_t count = 0;
+            if(string == 0) return 0;
+
+            if __WSTL_IF_CONSTEXPR__(sizeof(CharacterType) == 1) {
+                if(!__WSTL_IS_CONSTANT_EVALUATED__()) return __private::__StringLength(reinterpret_cast<const unsigned char*>(string));
+            }
 
-            if(string != 0) while(*string++) ++count;
+            size_t count = 0;
+            while(*string++) ++count;
             return count;
         }
 
         /// @brief Gets the length of a C-style string, up to a maximum length
         /// @param string C-style string pointer
         /// @param maxLength Maximum length to check
+        /// @details Byte-sized characters are scanned a word at a time (or with SSE2/NEON 
+        /// if `__WSTL_USE_SIMD__` is defined) outside of constant evaluation
         static __WSTL_CONSTEXPR14__ size_t Length(const CharacterType* string, size_t maxLength) {
-            size_t count = 0;
+            if(string == 0) return 0;
+
+            if __WSTL_IF_CONSTEXPR__(sizeof(CharacterType) == 1) {
+                if(!__WSTL_IS_CONSTANT_EVALUATED__()) return __private::__StringLength(reinterpret_cast<const unsigned char*>(string), maxLength);
+            }
 
-            if(string != 0) while(*string++ && count < maxLength) ++count;
+            size_t count = 0;
+            while(count < maxLength && *string++) ++count;
             return count;
         }
 
@@ -189,10 +344,22 @@ namespace wstl {
         /// @param string2 Second C-style string pointer
         /// @param count Maximum number of characters to compare
         /// @return `0` if equal, negative if `string1 < string2`, positive if `string1 > string2`
+        /// @details For byte-sized characters the equal prefix is skipped a word at a time 
+        /// (or with SSE2/NEON if `__WSTL_USE_SIMD__` is defined) outside of constant evaluation
         static __WSTL_CONSTEXPR14__ int Compare(const CharacterType* string1, const CharacterType* string2, size_t count) {
+            if __WSTL_IF_CONSTEXPR__(sizeof(CharacterType) == 1) {
+                if(!__WSTL_IS_CONSTANT_EVALUATED__()) {
+                    size_t i = __private::__StringMismatch(reinterpret_cast<const unsigned char*>(string1), 
+                        reinterpret_cast<const unsigned char*>(string2), count);
+
+                    if(i == count) return 0;
+                    return LessThan(string1[i], string2[i]) ? -1 : 1;
+                }
+            }
+
             for(size_t i = 0; i < count; ++i) {
-                const CharacterType* c1 = *string1++;
-                const CharacterType* c2 = *string2++;
+                const CharacterType c1 = *string1++;
+                const CharacterType c2 = *string2++;
 
                 if(c1 < c2) return -1;
                 else if(c1 > c2) return 1;
@@ -206,7 +373,16 @@ namespace wstl {
         /// @param count Number of characters in the range
         /// @param c Character to find
         /// @return Pointer to the first occurrence of the character, or `0` if not found
+        /// @details Byte-sized characters are searched a word at a time (or with SSE2/NEON 
+        /// if `__WSTL_USE_SIMD__` is defined) outside of constant evaluation
         static __WSTL_CONSTEXPR14__ const CharacterType* Find(const CharacterType* pointer, size_t count, const CharacterType& c) {
+            if __WSTL_IF_CONSTEXPR__(sizeof(CharacterType) == 1) {
+                if(!__WSTL_IS_CONSTANT_EVALUATED__()) {
+                    return reinterpret_cast<const CharacterType*>(__private::__StringFind(reinterpret_cast<const unsigned char*>(pointer), 
+                        count, static_cast<unsigned char>(c)));
+                }
+            }
+
             for(size_t i = 0; i < count; ++i, ++pointer) if(*pointer == c) return pointer;
             return 0;
         }
@@ -60,6 +60,15 @@ namespace wstl {
     private:
         friend Base;
 
+        /// @brief Appends a block of bytes to the checksum
+        /// @param data Pointer to the block
+        /// @param size Size of the block in bytes
+        __WSTL_CONSTEXPR14__ void AppendBlock(const uint8_t* data, size_t size) {
+            HashType sum = this->m_Hash;
+            for(const uint8_t* end = data + size; data != end; ++data) sum += *data;
+            this->m_Hash = sum;
+        }
+
         /// @brief Finalizes the checksum calculation, does nothing
         __WSTL_CONSTEXPR14__ void Finalize() {}
     };
@@ -107,6 +116,15 @@ namespace wstl {
     private:
         friend Base;
 
+        /// @brief Appends a block of bytes to the checksum
+        /// @param data Pointer to the block
+        /// @param size Size of the block in bytes
+        __WSTL_CONSTEXPR14__ void AppendBlock(const uint8_t* data, size_t size) {
+            HashType sum = this->m_Hash;
+            for(const uint8_t* end = data + size; data != end; ++data) sum = RotateRight(sum, 1) + *data;
+            this->m_Hash = sum;
+        }
+
         /// @brief Finalizes the checksum calculation, does nothing
         __WSTL_CONSTEXPR14__ void Finalize() {}
     };
@@ -154,6 +172,16 @@ namespace wstl {
     private:
         friend Base;
 
+        /// @brief Appends a block of bytes to the checksum
+        /// @details The bytes are folded into a single byte first, which the compiler can vectorize
+        /// @param data Pointer to the block
+        /// @param size Size of the block in bytes
+        __WSTL_CONSTEXPR14__ void AppendBlock(const uint8_t* data, size_t size) {
+            uint8_t folded = 0;
+            for(const uint8_t* end = data + size; data != end; ++data) folded ^= *data;
+            this->m_Hash ^= folded;
+        }
+
         /// @brief Finalizes the checksum calculation, does nothing
         __WSTL_CONSTEXPR14__ void Finalize() {}
     };
@@ -201,6 +229,15 @@ namespace wstl {
     private:
         friend Base;
 
+        /// @brief Appends a block of bytes to the checksum
+        /// @param data Pointer to the block
+        /// @param size Size of the block in bytes
+        __WSTL_CONSTEXPR14__ void AppendBlock(const uint8_t* data, size_t size) {
+            HashType sum = this->m_Hash;
+            for(const uint8_t* end = data + size; data != end; ++data) sum = RotateLeft(sum, 1) ^ *data;
+            this->m_Hash = sum;
+        }
+
         /// @brief Finalizes the checksum calculation, does nothing
         __WSTL_CONSTEXPR14__ void Finalize() {}
     };
@@ -248,6 +285,16 @@ namespace wstl {
     private:
         friend Base;
 
+        /// @brief Appends a block of bytes to the checksum
+        /// @details The parity of all bytes equals the parity of their XOR, so only one parity is computed
+        /// @param data Pointer to the block
+        /// @param size Size of the block in bytes
+        __WSTL_CONSTEXPR14__ void AppendBlock(const uint8_t* data, size_t size) {
+            uint8_t folded = 0;
+            for(const uint8_t* end = data + size; data != end; ++data) folded ^= *data;
+            this->m_Hash = this->m_Hash ^ Parity(folded);
+        }
+
         /// @brief Finalizes the checksum calculation, does nothing
         __WSTL_CONSTEXPR14__ void Finalize() {}
     };
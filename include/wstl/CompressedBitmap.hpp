@@ -0,0 +1,923 @@
+// Part of WardenSTL - https://github.com/WardenHD/WardenSTL
+// Copyright (c) 2025 Artem Bezruchko (WardenHD)
+//
+// Licensed under the MIT License. See LICENSE file for details.
+
+#ifndef __WSTL_COMPRESSEDBITMAP_HPP__
+#define __WSTL_COMPRESSEDBITMAP_HPP__
+
+#include "private/Platform.hpp"
+#include "private/Error.hpp"
+#include "Bit.hpp"
+#include "Iterator.hpp"
+#include "StandardExceptions.hpp"
+#include "StaticAssert.hpp"
+#include "NullPointer.hpp"
+#include <stddef.h>
+#include <stdint.h>
+
+
+namespace wstl {
+    // Compressed bitmap
+
+    /// @brief Set of 32-bit IDs that stores each range of 65536 IDs in the smallest of three encodings
+    /// @tparam MaxChunks Maximum number of ranges of 65536 IDs that hold at least one ID
+    /// @tparam WordCount Number of 64-bit words shared by the data of all ranges
+    /// @details The design follows Roaring bitmaps. The upper 16 bits of an ID select a chunk, and
+    /// the lower 16 bits are stored in the chunk as one of:
+    /// - a sorted array of 16-bit values, four per word, for up to `ArrayLimit` IDs;
+    /// - a dense bitmap of `BitmapWords` words, tested and counted with `Bit.hpp` operations;
+    /// - sorted runs of consecutive IDs, stored as first and last value, two runs per word.
+    /// The data of the chunks lies back to back in a single array of `WordCount` words, so a set of
+    /// a few hundred IDs scattered over the whole 32-bit range takes a few hundred bytes, while a
+    /// set of every ID in a range takes one word. `Insert` and `Erase` keep arrays and runs
+    /// sorted, moving the words of later chunks when a chunk grows or shrinks, and turn a full
+    /// array into runs or a bitmap. `And`, `Or` and `AndNot` work chunk by chunk and pick the
+    /// smallest encoding for every resulting chunk; `Optimize` does the same for the whole set.
+    /// @ingroup bitset
+    ///
+    /// @code
+    /// CompressedBitmap<16, 512> online, alarmed;
+    /// ...
+    /// online.And(alarmed);
+    /// for(CompressedBitmap<16, 512>::ConstIterator it = online.Begin(); it != online.End(); ++it) Notify(*it);
+    /// @endcode
+    /// @see https://arxiv.org/abs/1603.06549
+    template<size_t MaxChunks, size_t WordCount>
+    class CompressedBitmap {
+    public:
+        WSTL_STATIC_ASSERT(MaxChunks > 0 && MaxChunks <= 0x10000, "Number of chunks must be in [1, 65536]");
+        WSTL_STATIC_ASSERT(WordCount > 0 && WordCount <= 0xFFFFFFFFUL, "Number of words must fit in 32 bits");
+
+        typedef uint32_t ValueType;
+        typedef size_t SizeType;
+
+        /// @brief Maximum number of IDs a chunk stores as an array, which then takes as many words as a bitmap
+        static const __WSTL_CONSTEXPR__ SizeType ArrayLimit = 4096;
+
+        /// @brief Number of words of a chunk stored as a bitmap
+        static const __WSTL_CONSTEXPR__ SizeType BitmapWords = 1024;
+
+    private:
+        enum Kind {
+            KIND_ARRAY,
+            KIND_BITMAP,
+            KIND_RUN
+        };
+
+        enum Operation {
+            OPERATION_AND,
+            OPERATION_OR,
+            OPERATION_AND_NOT
+        };
+
+        /// @brief Past-the-end value of the lower 16 bits of an ID
+        static const __WSTL_CONSTEXPR__ uint32_t ChunkEnd = 0x10000;
+
+        struct Chunk {
+            uint32_t Offset;
+            uint32_t Cardinality;
+            /// @brief Number of 16-bit entries of an array or of runs, two per run
+            uint32_t Entries;
+            uint16_t Key;
+            uint16_t Size;
+            uint8_t Kind;
+        };
+
+        /// @brief Walks the values of a chunk in ascending order, `Value` is `ChunkEnd` past the last
+        struct Cursor {
+            const uint64_t* Words;
+            uint32_t Entries;
+            uint32_t Index;
+            uint32_t Value;
+            uint32_t Last;
+            uint8_t Kind;
+
+            Cursor() : Words(NullPointer), Entries(0), Index(0), Value(ChunkEnd), Last(0), Kind(KIND_ARRAY) {}
+
+            Cursor(const uint64_t* words, const Chunk& chunk) : Words(words), Entries(chunk.Entries), Index(0), Value(0), Last(0), Kind(chunk.Kind) {
+                if(Kind == KIND_BITMAP) Scan(0);
+                else Load();
+            }
+
+            void Next() {
+                if(Kind == KIND_ARRAY) {
+                    ++Index;
+                    Load();
+                }
+                else if(Kind == KIND_RUN) {
+                    if(Value < Last) ++Value;
+                    else {
+                        Index += 2;
+                        Load();
+                    }
+                }
+                else Scan(Value + 1);
+            }
+
+            void Load() {
+                if(Index >= Entries) Value = ChunkEnd;
+                else {
+                    Value = Entry(Words, Index);
+                    if(Kind == KIND_RUN) Last = Entry(Words, Index + 1);
+                }
+            }
+
+            void Scan(uint32_t from) {
+                SizeType word = from >> 6;
+                if(word >= BitmapWords) {
+                    Value = ChunkEnd;
+                    return;
+                }
+
+                uint64_t bits = Words[word] & (~uint64_t(0) << (from & 63));
+
+                while(bits == 0) {
+                    if(++word == BitmapWords) {
+                        Value = ChunkEnd;
+                        return;
+                    }
+
+                    bits = Words[word];
+                }
+
+                Value = uint32_t(word * 64 + CountRightZero(bits));
+            }
+        };
+
+        /// @brief Appends ascending values to a chunk being built
+        struct Writer {
+            uint64_t* Words;
+            uint32_t Cardinality;
+            uint32_t Entries;
+            uint8_t Kind;
+
+            Writer(uint64_t* words, uint8_t kind) : Words(words), Cardinality(0), Entries(0), Kind(kind) {
+                if(kind == KIND_BITMAP) {
+                    for(SizeType i = 0; i < BitmapWords; ++i) Words[i] = 0;
+                }
+            }
+
+            void Push(uint32_t value) {
+                ++Cardinality;
+
+                if(Kind == KIND_ARRAY) SetEntry(Words, Entries++, uint16_t(value));
+                else if(Kind == KIND_BITMAP) Words[value >> 6] |= uint64_t(1) << (value & 63);
+                else if(Entries != 0 && Entry(Words, Entries - 1) + 1U == value) SetEntry(Words, Entries - 1, uint16_t(value));
+                else {
+                    SetEntry(Words, Entries++, uint16_t(value));
+                    SetEntry(Words, Entries++, uint16_t(value));
+                }
+            }
+
+            SizeType Size() const {
+                return Kind == KIND_BITMAP ? BitmapWords : EntryWords(Entries);
+            }
+        };
+
+    public:
+        // Iterator
+
+        /// @brief Forward iterator over the IDs of the set in ascending order
+        class ConstIterator {
+        public:
+            typedef const uint32_t ValueType;
+            typedef ForwardIteratorTag IteratorCategory;
+            typedef uint32_t ReferenceType;
+            typedef const uint32_t* PointerType;
+            typedef ptrdiff_t DifferenceType;
+
+            friend class CompressedBitmap;
+
+            ConstIterator() : m_Bitmap(NullPointer), m_Chunk(0), m_Cursor() {}
+
+            ReferenceType operator*() const {
+                return (uint32_t(m_Bitmap->m_Chunks[m_Chunk].Key) << 16) | m_Cursor.Value;
+            }
+
+            ConstIterator& operator++() {
+                m_Cursor.Next();
+
+                if(m_Cursor.Value == ChunkEnd) {
+                    ++m_Chunk;
+                    Load();
+                }
+
+                return *this;
+            }
+
+            ConstIterator operator++(int) {
+                ConstIterator original(*this);
+                ++(*this);
+                return original;
+            }
+
+            friend bool operator==(const ConstIterator& a, const ConstIterator& b) {
+                return a.m_Chunk == b.m_Chunk && a.m_Cursor.Value == b.m_Cursor.Value;
+            }
+
+            friend bool operator!=(const ConstIterator& a, const ConstIterator& b) {
+                return !(a == b);
+            }
+
+        private:
+            const CompressedBitmap* m_Bitmap;
+            SizeType m_Chunk;
+            Cursor m_Cursor;
+
+            ConstIterator(const CompressedBitmap* bitmap, SizeType chunk) : m_Bitmap(bitmap), m_Chunk(chunk), m_Cursor() {
+                Load();
+            }
+
+            void Load() {
+                if(m_Chunk < m_Bitmap->m_ChunkCount) m_Cursor = Cursor(m_Bitmap->Data(m_Bitmap->m_Chunks[m_Chunk]), m_Bitmap->m_Chunks[m_Chunk]);
+                else m_Cursor = Cursor();
+            }
+        };
+
+        /// @brief Default constructor, creates an empty set
+        CompressedBitmap() : m_ChunkCount(0), m_Used(0) {}
+
+        /// @brief Inserts an ID
+        /// @param value ID to insert
+        /// @return `true` if the ID was inserted, `false` if it was already in the set
+        /// @throws `LengthError` if the chunks or the words are exhausted, `false` is returned then
+        bool Insert(ValueType value) {
+            const uint16_t key = uint16_t(value >> 16);
+            const uint16_t low = uint16_t(value);
+            const SizeType index = FindChunk(key);
+
+            if(index == m_ChunkCount || m_Chunks[index].Key != key) {
+                __WSTL_ASSERT_RETURNVALUE__(m_ChunkCount < MaxChunks && m_Used < WordCount, WSTL_MAKE_EXCEPTION(LengthError, "CompressedBitmap: Full"), false);
+                CreateChunk(index, key);
+            }
+
+            Chunk& chunk = m_Chunks[index];
+            uint64_t* words = Data(chunk);
+
+            if(chunk.Kind == KIND_ARRAY) {
+                const SizeType position = Search(words, chunk.Entries, 1, low);
+                if(position < chunk.Entries && Entry(words, position) == low) return false;
+
+                if(chunk.Entries < ArrayLimit) {
+                    __WSTL_ASSERT_RETURNVALUE__(InsertEntries(index, position, 1), WSTL_MAKE_EXCEPTION(LengthError, "CompressedBitmap: Full"), false);
+
+                    SetEntry(Data(chunk), position, low);
+                    ++chunk.Cardinality;
+                    return true;
+                }
+
+                // A full array becomes runs if they are smaller, otherwise a bitmap
+                const SizeType runSize = EntryWords(2 * RunCount(words, chunk));
+                const bool runs = runSize < BitmapWords;
+
+                __WSTL_ASSERT_RETURNVALUE__(Reencode(index, runs ? KIND_RUN : KIND_BITMAP, runs ? runSize : BitmapWords), WSTL_MAKE_EXCEPTION(LengthError, "CompressedBitmap: Full"), false);
+                words = Data(chunk);
+            }
+
+            if(chunk.Kind == KIND_BITMAP) {
+                uint64_t& word = words[low >> 6];
+                const uint64_t bit = uint64_t(1) << (low & 63);
+                if(word & bit) return false;
+
+                word |= bit;
+                ++chunk.Cardinality;
+                return true;
+            }
+
+            // Run of the first run that ends at or after the value
+            const SizeType position = Search(words, chunk.Entries / 2, 2, low);
+            if(position < chunk.Entries && Entry(words, position) <= low) return false;
+
+            const bool joinsPrevious = position > 0 && Entry(words, position - 1) + 1U == low;
+            const bool joinsNext = position < chunk.Entries && Entry(words, position) == low + 1U;
+
+            if(joinsPrevious && joinsNext) {
+                SetEntry(words, position - 1, Entry(words, position + 1));
+                EraseEntries(index, position, 2);
+            }
+            else if(joinsPrevious) SetEntry(words, position - 1, low);
+            else if(joinsNext) SetEntry(words, position, low);
+            else if(EntryWords(chunk.Entries + 2) > BitmapWords) {
+                // Another run would take more words than a bitmap
+                __WSTL_ASSERT_RETURNVALUE__(Reencode(index, KIND_BITMAP, BitmapWords), WSTL_MAKE_EXCEPTION(LengthError, "CompressedBitmap: Full"), false);
+                Data(chunk)[low >> 6] |= uint64_t(1) << (low & 63);
+            }
+            else {
+                __WSTL_ASSERT_RETURNVALUE__(InsertEntries(index, position, 2), WSTL_MAKE_EXCEPTION(LengthError, "CompressedBitmap: Full"), false);
+
+                SetEntry(Data(chunk), position, low);
+                SetEntry(Data(chunk), position + 1, low);
+            }
+
+            ++chunk.Cardinality;
+            return true;
+        }
+
+        /// @brief Erases an ID
+        /// @param value ID to erase
+        /// @return `true` if the ID was erased, `false` if it was not in the set
+        /// @throws `LengthError` if a run has to be split and the words are exhausted, `false` is
+        /// returned then
+        bool Erase(ValueType value) {
+            const uint16_t key = uint16_t(value >> 16);
+            const uint16_t low = uint16_t(value);
+            const SizeType index = FindChunk(key);
+
+            if(index == m_ChunkCount || m_Chunks[index].Key != key) return false;
+
+            Chunk& chunk = m_Chunks[index];
+            uint64_t* words = Data(chunk);
+
+            if(chunk.Kind == KIND_ARRAY) {
+                const SizeType position = Search(words, chunk.Entries, 1, low);
+                if(position == chunk.Entries || Entry(words, position) != low) return false;
+
+                EraseEntries(index, position, 1);
+            }
+            else if(chunk.Kind == KIND_BITMAP) {
+                uint64_t& word = words[low >> 6];
+                const uint64_t bit = uint64_t(1) << (low & 63);
+                if(!(word & bit)) return false;
+
+                word &= ~bit;
+            }
+            else {
+                const SizeType position = Search(words, chunk.Entries / 2, 2, low);
+                if(position == chunk.Entries || Entry(words, position) > low) return false;
+
+                const uint16_t first = Entry(words, position);
+                const uint16_t last = Entry(words, position + 1);
+
+                if(first == last) EraseEntries(index, position, 2);
+                else if(low == first) SetEntry(words, position, uint16_t(low + 1));
+                else if(low == last) SetEntry(words, position + 1, uint16_t(low - 1));
+                else if(EntryWords(chunk.Entries + 2) > BitmapWords) {
+                    // Splitting the run would take more words than a bitmap
+                    __WSTL_ASSERT_RETURNVALUE__(Reencode(index, KIND_BITMAP, BitmapWords), WSTL_MAKE_EXCEPTION(LengthError, "CompressedBitmap: Full"), false);
+                    Data(chunk)[low >> 6] &= ~(uint64_t(1) << (low & 63));
+                }
+                else {
+                    __WSTL_ASSERT_RETURNVALUE__(InsertEntries(index, position + 2, 2), WSTL_MAKE_EXCEPTION(LengthError, "CompressedBitmap: Full"), false);
+
+                    words = Data(chunk);
+                    SetEntry(words, position + 1, uint16_t(low - 1));
+                    SetEntry(words, position + 2, uint16_t(low + 1));
+                    SetEntry(words, position + 3, last);
+                }
+            }
+
+            if(--chunk.Cardinality == 0) RemoveChunk(index);
+            return true;
+        }
+
+        /// @brief Checks whether the set contains an ID
+        /// @param value ID to search for
+        __WSTL_NODISCARD__ bool Contains(ValueType value) const {
+            const uint16_t key = uint16_t(value >> 16);
+            const SizeType index = FindChunk(key);
+
+            return index < m_ChunkCount && m_Chunks[index].Key == key && ChunkContains(Data(m_Chunks[index]), m_Chunks[index], uint16_t(value));
+        }
+
+        /// @brief Keeps only the IDs that are also in another set
+        /// @param other The other set, may be this set
+        /// @return `true` on success
+        /// @throws `LengthError` if the result does not fit in the free words, the set is left
+        /// unchanged and `false` is returned then
+        /// @details The result is built after the words in use and then moved to the front, so
+        /// the set needs as many free words as the result takes
+        bool And(const CompressedBitmap& other) {
+            __WSTL_ASSERT_RETURNVALUE__(Combine(other, OPERATION_AND), WSTL_MAKE_EXCEPTION(LengthError, "CompressedBitmap: Full"), false);
+            return true;
+        }
+
+        /// @brief Adds the IDs of another set
+        /// @param other The other set, may be this set
+        /// @return `true` on success
+        /// @throws `LengthError` if the result does not fit in the free words or the chunks, the
+        /// set is left unchanged and `false` is returned then
+        /// @details The set needs as many free words as the result takes, see `And`
+        bool Or(const CompressedBitmap& other) {
+            __WSTL_ASSERT_RETURNVALUE__(Combine(other, OPERATION_OR), WSTL_MAKE_EXCEPTION(LengthError, "CompressedBitmap: Full"), false);
+            return true;
+        }
+
+        /// @brief Removes the IDs that are in another set
+        /// @param other The other set, may be this set
+        /// @return `true` on success
+        /// @throws `LengthError` if the result does not fit in the free words, the set is left
+        /// unchanged and `false` is returned then
+        /// @details The set needs as many free words as the result takes, see `And`
+        bool AndNot(const CompressedBitmap& other) {
+            __WSTL_ASSERT_RETURNVALUE__(Combine(other, OPERATION_AND_NOT), WSTL_MAKE_EXCEPTION(LengthError, "CompressedBitmap: Full"), false);
+            return true;
+        }
+
+        /// @brief Keeps only the IDs that are also in another set, see `And`
+        /// @param other The other set
+        CompressedBitmap& operator&=(const CompressedBitmap& other) {
+            And(other);
+            return *this;
+        }
+
+        /// @brief Adds the IDs of another set, see `Or`
+        /// @param other The other set
+        CompressedBitmap& operator|=(const CompressedBitmap& other) {
+            Or(other);
+            return *this;
+        }
+
+        /// @brief Counts the IDs that are in both sets without building the intersection
+        /// @param other The other set
+        __WSTL_NODISCARD__ SizeType AndCardinality(const CompressedBitmap& other) const {
+            SizeType count = 0;
+
+            for(SizeType i = 0, j = 0; i < m_ChunkCount && j < other.m_ChunkCount;) {
+                const Chunk& a = m_Chunks[i];
+                const Chunk& b = other.m_Chunks[j];
+
+                if(a.Key < b.Key) ++i;
+                else if(b.Key < a.Key) ++j;
+                else {
+                    const uint64_t* wordsA = Data(a);
+                    const uint64_t* wordsB = other.Data(b);
+
+                    if(a.Kind == KIND_BITMAP && b.Kind == KIND_BITMAP) {
+                        for(SizeType k = 0; k < BitmapWords; ++k) count += PopulationCount(uint64_t(wordsA[k] & wordsB[k]));
+                    }
+                    else {
+                        // Walk one chunk and look its values up in the other, a bitmap answers in constant time
+                        const bool walkA = b.Kind == KIND_BITMAP || (a.Kind != KIND_BITMAP && a.Cardinality < b.Cardinality);
+                        const Chunk& walked = walkA ? a : b;
+                        const Chunk& tested = walkA ? b : a;
+                        const uint64_t* testedWords = walkA ? wordsB : wordsA;
+
+                        for(Cursor cursor(walkA ? wordsA : wordsB, walked); cursor.Value != ChunkEnd; cursor.Next()) {
+                            count += ChunkContains(testedWords, tested, uint16_t(cursor.Value));
+                        }
+                    }
+
+                    ++i;
+                    ++j;
+                }
+            }
+
+            return count;
+        }
+
+        /// @brief Re-encodes every chunk in its smallest encoding
+        /// @details Useful after many calls to `Insert` and `Erase`, which only switch a chunk away
+        /// from an array once it is full. Conversion builds the new encoding in the free words, or in
+        /// `BitmapWords` words on the stack if they are too few and the chunk shrinks. Chunks that
+        /// would grow beyond the free words stay as they are
+        void Optimize() {
+            for(SizeType i = 0; i < m_ChunkCount; ++i) {
+                SizeType size = 0;
+                const uint8_t kind = BestKind(Data(m_Chunks[i]), m_Chunks[i], size);
+
+                if(kind != m_Chunks[i].Kind) Reencode(i, kind, size);
+            }
+        }
+
+        /// @brief Removes all IDs
+        void Clear() __WSTL_NOEXCEPT__ {
+            m_ChunkCount = 0;
+            m_Used = 0;
+        }
+
+        /// @brief Gets the number of IDs
+        __WSTL_NODISCARD__ SizeType Cardinality() const __WSTL_NOEXCEPT__ {
+            SizeType count = 0;
+            for(SizeType i = 0; i < m_ChunkCount; ++i) count += m_Chunks[i].Cardinality;
+
+            return count;
+        }
+
+        /// @brief Checks whether the set has no IDs
+        __WSTL_NODISCARD__ bool Empty() const __WSTL_NOEXCEPT__ {
+            return m_ChunkCount == 0;
+        }
+
+        /// @brief Gets the number of chunks in use
+        __WSTL_NODISCARD__ SizeType ChunkCount() const __WSTL_NOEXCEPT__ {
+            return m_ChunkCount;
+        }
+
+        /// @brief Gets the number of words in use
+        __WSTL_NODISCARD__ SizeType Used() const __WSTL_NOEXCEPT__ {
+            return m_Used;
+        }
+
+        /// @brief Gets the number of free words
+        __WSTL_NODISCARD__ SizeType Available() const __WSTL_NOEXCEPT__ {
+            return WordCount - m_Used;
+        }
+
+        /// @brief Gets the iterator to the smallest ID
+        __WSTL_NODISCARD__ ConstIterator Begin() const {
+            return ConstIterator(this, 0);
+        }
+
+        /// @brief Gets the iterator past the largest ID
+        __WSTL_NODISCARD__ ConstIterator End() const {
+            return ConstIterator(this, m_ChunkCount);
+        }
+
+    private:
+        Chunk m_Chunks[MaxChunks];
+        SizeType m_ChunkCount;
+        uint64_t m_Words[WordCount];
+        SizeType m_Used;
+
+        static uint16_t Entry(const uint64_t* words, SizeType index) {
+            return uint16_t(words[index >> 2] >> ((index & 3) * 16));
+        }
+
+        static void SetEntry(uint64_t* words, SizeType index, uint16_t value) {
+            const unsigned shift = unsigned(index & 3) * 16;
+            words[index >> 2] = (words[index >> 2] & ~(uint64_t(0xFFFF) << shift)) | (uint64_t(value) << shift);
+        }
+
+        static SizeType EntryWords(SizeType entries) {
+            return (entries + 3) / 4;
+        }
+
+        /// @brief Finds the first of `count` entries, `stride` apart, whose last entry is not less than a value
+        /// @return Index of the first entry of the found element, `count * stride` if there is none
+        static SizeType Search(const uint64_t* words, SizeType count, SizeType stride, uint16_t value) {
+            SizeType first = 0;
+
+            while(count > 0) {
+                const SizeType half = count / 2;
+
+                if(Entry(words, (first + half) * stride + stride - 1) < value) {
+                    first += half + 1;
+                    count -= half + 1;
+                }
+                else count = half;
+            }
+
+            return first * stride;
+        }
+
+        static bool ChunkContains(const uint64_t* words, const Chunk& chunk, uint16_t value) {
+            if(chunk.Kind == KIND_BITMAP) return (words[value >> 6] >> (value & 63)) & 1;
+
+            if(chunk.Kind == KIND_ARRAY) {
+                const SizeType position = Search(words, chunk.Entries, 1, value);
+                return position < chunk.Entries && Entry(words, position) == value;
+            }
+
+            const SizeType position = Search(words, chunk.Entries / 2, 2, value);
+            return position < chunk.Entries && Entry(words, position) <= value;
+        }
+
+        static SizeType RunCount(const uint64_t* words, const Chunk& chunk) {
+            if(chunk.Kind == KIND_RUN) return chunk.Entries / 2;
+
+            SizeType runs = 0;
+
+            if(chunk.Kind == KIND_ARRAY) {
+                for(SizeType i = 0; i < chunk.Entries; ++i) {
+                    if(i == 0 || Entry(words, i) != Entry(words, i - 1) + 1U) ++runs;
+                }
+            }
+            else {
+                // A run starts at every set bit whose lower neighbour is cleared
+                uint64_t carry = 0;
+
+                for(SizeType i = 0; i < BitmapWords; ++i) {
+                    runs += PopulationCount(uint64_t(words[i] & ~((words[i] << 1) | carry)));
+                    carry = words[i] >> 63;
+                }
+            }
+
+            return runs;
+        }
+
+        /// @brief Picks the encoding that takes the fewest words, preferring an array and then a bitmap on ties
+        static uint8_t BestKind(const uint64_t* words, const Chunk& chunk, SizeType& size) {
+            uint8_t kind = KIND_BITMAP;
+            size = BitmapWords;
+
+            if(chunk.Cardinality <= ArrayLimit) {
+                kind = KIND_ARRAY;
+                size = EntryWords(chunk.Cardinality);
+            }
+
+            const SizeType runSize = EntryWords(2 * RunCount(words, chunk));
+
+            if(runSize < size) {
+                kind = KIND_RUN;
+                size = runSize;
+            }
+
+            return kind;
+        }
+
+        uint64_t* Data(const Chunk& chunk) {
+            return m_Words + chunk.Offset;
+        }
+
+        const uint64_t* Data(const Chunk& chunk) const {
+            return m_Words + chunk.Offset;
+        }
+
+        SizeType FindChunk(uint16_t key) const {
+            SizeType first = 0;
+            SizeType count = m_ChunkCount;
+
+            while(count > 0) {
+                const SizeType half = count / 2;
+
+                if(m_Chunks[first + half].Key < key) {
+                    first += half + 1;
+                    count -= half + 1;
+                }
+                else count = half;
+            }
+
+            return first;
+        }
+
+        void CreateChunk(SizeType index, uint16_t key) {
+            for(SizeType i = m_ChunkCount; i > index; --i) m_Chunks[i] = m_Chunks[i - 1];
+
+            Chunk& chunk = m_Chunks[index];
+            chunk.Offset = uint32_t(index < m_ChunkCount ? m_Chunks[index + 1].Offset : m_Used);
+            chunk.Cardinality = 0;
+            chunk.Entries = 0;
+            chunk.Key = key;
+            chunk.Size = 0;
+            chunk.Kind = KIND_ARRAY;
+
+            ++m_ChunkCount;
+        }
+
+        void RemoveChunk(SizeType index) {
+            Resize(index, 0);
+
+            for(SizeType i = index + 1; i < m_ChunkCount; ++i) m_Chunks[i - 1] = m_Chunks[i];
+            --m_ChunkCount;
+        }
+
+        /// @brief Changes the number of words of a chunk, moving the words of the chunks after it
+        bool Resize(SizeType index, SizeType size) {
+            Chunk& chunk = m_Chunks[index];
+            const SizeType end = chunk.Offset + chunk.Size;
+
+            if(size > chunk.Size) {
+                const SizeType delta = size - chunk.Size;
+                if(delta > WordCount - m_Used) return false;
+
+                for(SizeType i = m_Used; i > end; --i) m_Words[i - 1 + delta] = m_Words[i - 1];
+                for(SizeType i = index + 1; i < m_ChunkCount; ++i) m_Chunks[i].Offset += uint32_t(delta);
+                m_Used += delta;
+            }
+            else {
+                const SizeType delta = chunk.Size - size;
+
+                for(SizeType i = end; i < m_Used; ++i) m_Words[i - delta] = m_Words[i];
+                for(SizeType i = index + 1; i < m_ChunkCount; ++i) m_Chunks[i].Offset -= uint32_t(delta);
+                m_Used -= delta;
+            }
+
+            chunk.Size = uint16_t(size);
+            return true;
+        }
+
+        bool InsertEntries(SizeType index, SizeType position, SizeType count) {
+            Chunk& chunk = m_Chunks[index];
+            const SizeType size = EntryWords(chunk.Entries + count);
+
+            if(size > chunk.Size && !Resize(index, size)) return false;
+
+            uint64_t* words = Data(chunk);
+            for(SizeType i = chunk.Entries; i > position; --i) SetEntry(words, i - 1 + count, Entry(words, i - 1));
+
+            chunk.Entries += uint32_t(count);
+            return true;
+        }
+
+        void EraseEntries(SizeType index, SizeType position, SizeType count) {
+            Chunk& chunk = m_Chunks[index];
+            uint64_t* words = Data(chunk);
+
+            for(SizeType i = position + count; i < chunk.Entries; ++i) SetEntry(words, i - count, Entry(words, i));
+
+            chunk.Entries -= uint32_t(count);
+            Resize(index, EntryWords(chunk.Entries));
+        }
+
+        /// @brief Converts a chunk to another encoding of `size` words, built in the free words
+        /// @details An encoding that is not larger is built in scratch words on the stack if the free
+        /// words are too few, the words of the chunk are still needed while it is built
+        bool Reencode(SizeType index, uint8_t kind, SizeType size) {
+            const Chunk original = m_Chunks[index];
+
+            if(size <= original.Size && WordCount - m_Used < size) {
+                ReencodeInScratch(index, kind, size);
+                return true;
+            }
+
+            if(size > original.Size && !Resize(index, size)) return false;
+
+            if(WordCount - m_Used < size) {
+                Resize(index, original.Size);
+                return false;
+            }
+
+            Build(index, kind, size, m_Words + m_Used);
+            return true;
+        }
+
+        void ReencodeInScratch(SizeType index, uint8_t kind, SizeType size) {
+            uint64_t scratch[BitmapWords];
+            Build(index, kind, size, scratch);
+        }
+
+        /// @brief Writes the values of a chunk to `scratch` in another encoding, then copies it over the chunk
+        void Build(SizeType index, uint8_t kind, SizeType size, uint64_t* scratch) {
+            Chunk& chunk = m_Chunks[index];
+
+            Writer writer(scratch, kind);
+            for(Cursor cursor(Data(chunk), chunk); cursor.Value != ChunkEnd; cursor.Next()) writer.Push(cursor.Value);
+
+            for(SizeType i = 0; i < size; ++i) m_Words[chunk.Offset + i] = scratch[i];
+
+            chunk.Kind = kind;
+            chunk.Entries = writer.Entries;
+
+            if(size < chunk.Size) Resize(index, size);
+        }
+
+        /// @brief Builds the result of an operation into the free words, then moves it to the front
+        bool Combine(const CompressedBitmap& other, Operation operation) {
+            Chunk chunks[MaxChunks];
+            SizeType count = 0;
+            const SizeType base = m_Used;
+            SizeType position = base;
+
+            for(SizeType i = 0, j = 0; i < m_ChunkCount || j < other.m_ChunkCount;) {
+                const uint32_t keyA = i < m_ChunkCount ? m_Chunks[i].Key : ChunkEnd;
+                const uint32_t keyB = j < other.m_ChunkCount ? other.m_Chunks[j].Key : ChunkEnd;
+                Chunk result;
+
+                if(keyA != keyB) {
+                    // A chunk in only one set is kept as it is or dropped
+                    const bool inA = keyA < keyB;
+                    if(inA) ++i;
+                    else ++j;
+
+                    if(inA ? operation == OPERATION_AND : operation != OPERATION_OR) continue;
+
+                    const Chunk& source = inA ? m_Chunks[i - 1] : other.m_Chunks[j - 1];
+                    const uint64_t* words = inA ? Data(source) : other.Data(source);
+
+                    if(WordCount - position < source.Size) return false;
+                    for(SizeType k = 0; k < source.Size; ++k) m_Words[position + k] = words[k];
+
+                    result = source;
+                    result.Offset = uint32_t(position);
+                }
+                else {
+                    if(!Merge(m_Chunks[i], Data(m_Chunks[i]), other.m_Chunks[j], other.Data(other.m_Chunks[j]), operation, position, result)) return false;
+
+                    ++i;
+                    ++j;
+
+                    if(result.Cardinality == 0) continue;
+                }
+
+                if(count == MaxChunks) return false;
+
+                chunks[count++] = result;
+                position += result.Size;
+            }
+
+            for(SizeType k = base; k < position; ++k) m_Words[k - base] = m_Words[k];
+
+            for(SizeType k = 0; k < count; ++k) {
+                m_Chunks[k] = chunks[k];
+                m_Chunks[k].Offset -= uint32_t(base);
+            }
+
+            m_ChunkCount = count;
+            m_Used = position - base;
+            return true;
+        }
+
+        /// @brief Combines two chunks with the same key into the words at `position`
+        bool Merge(const Chunk& a, const uint64_t* wordsA, const Chunk& b, const uint64_t* wordsB, Operation operation, SizeType position, Chunk& result) {
+            const bool bitmapA = a.Kind == KIND_BITMAP;
+            const bool bitmapB = b.Kind == KIND_BITMAP;
+            const bool modifiesBitmap = (operation == OPERATION_OR && (bitmapA || bitmapB)) || (operation == OPERATION_AND_NOT && bitmapA);
+
+            // The result is built as an array if its cardinality cannot exceed the array limit
+            SizeType bound = a.Cardinality;
+            if(operation == OPERATION_AND && b.Cardinality < bound) bound = b.Cardinality;
+            else if(operation == OPERATION_OR) bound += b.Cardinality;
+
+            const uint8_t kind = (bitmapA && bitmapB) || modifiesBitmap || bound > ArrayLimit ? KIND_BITMAP : KIND_ARRAY;
+            if(WordCount - position < (kind == KIND_BITMAP ? BitmapWords : EntryWords(bound))) return false;
+
+            uint64_t* words = m_Words + position;
+            Writer writer(words, kind);
+
+            if(bitmapA && bitmapB) {
+                for(SizeType k = 0; k < BitmapWords; ++k) {
+                    if(operation == OPERATION_AND) words[k] = wordsA[k] & wordsB[k];
+                    else if(operation == OPERATION_OR) words[k] = wordsA[k] | wordsB[k];
+                    else words[k] = wordsA[k] & ~wordsB[k];
+
+                    writer.Cardinality += PopulationCount(words[k]);
+                }
+            }
+            else if(modifiesBitmap) {
+                // Copy the bitmap and set or clear the values of the other chunk in it
+                const bool copyA = bitmapA;
+                const uint64_t* bitmap = copyA ? wordsA : wordsB;
+                for(SizeType k = 0; k < BitmapWords; ++k) words[k] = bitmap[k];
+
+                for(Cursor cursor(copyA ? wordsB : wordsA, copyA ? b : a); cursor.Value != ChunkEnd; cursor.Next()) {
+                    const uint64_t bit = uint64_t(1) << (cursor.Value & 63);
+
+                    if(operation == OPERATION_OR) words[cursor.Value >> 6] |= bit;
+                    else words[cursor.Value >> 6] &= ~bit;
+                }
+
+                for(SizeType k = 0; k < BitmapWords; ++k) writer.Cardinality += PopulationCount(words[k]);
+            }
+            else if(bitmapA || bitmapB) {
+                // Intersection or difference with a bitmap, walk the other chunk and test each value
+                const bool walkA = bitmapB;
+                const bool keep = operation == OPERATION_AND;
+
+                for(Cursor cursor(walkA ? wordsA : wordsB, walkA ? a : b); cursor.Value != ChunkEnd; cursor.Next()) {
+                    if(ChunkContains(walkA ? wordsB : wordsA, walkA ? b : a, uint16_t(cursor.Value)) == keep) writer.Push(cursor.Value);
+                }
+            }
+            else {
+                Cursor first(wordsA, a);
+                Cursor second(wordsB, b);
+
+                while(first.Value != ChunkEnd && second.Value != ChunkEnd) {
+                    if(first.Value < second.Value) {
+                        if(operation != OPERATION_AND) writer.Push(first.Value);
+                        first.Next();
+                    }
+                    else if(second.Value < first.Value) {
+                        if(operation == OPERATION_OR) writer.Push(second.Value);
+                        second.Next();
+                    }
+                    else {
+                        if(operation != OPERATION_AND_NOT) writer.Push(first.Value);
+                        first.Next();
+                        second.Next();
+                    }
+                }
+
+                for(; first.Value != ChunkEnd && operation != OPERATION_AND; first.Next()) writer.Push(first.Value);
+                for(; second.Value != ChunkEnd && operation == OPERATION_OR; second.Next()) writer.Push(second.Value);
+            }
+
+            result.Offset = uint32_t(position);
+            result.Cardinality = writer.Cardinality;
+            result.Entries = writer.Entries;
+            result.Key = a.Key;
+            result.Size = uint16_t(writer.Size());
+            result.Kind = kind;
+
+            if(result.Cardinality == 0) return true;
+
+            // Switch to a smaller encoding if there are free words to build it in
+            SizeType size = 0;
+            const uint8_t best = BestKind(words, result, size);
+
+            if(best != kind && WordCount - position - result.Size >= size) {
+                Writer packed(words + result.Size, best);
+                for(Cursor cursor(words, result); cursor.Value != ChunkEnd; cursor.Next()) packed.Push(cursor.Value);
+
+                for(SizeType k = 0; k < size; ++k) words[k] = packed.Words[k];
+
+                result.Entries = packed.Entries;
+                result.Size = uint16_t(size);
+                result.Kind = best;
+            }
+
+            return true;
+        }
+    };
+
+    template<size_t MaxChunks, size_t WordCount>
+    const __WSTL_CONSTEXPR__ typename CompressedBitmap<MaxChunks, WordCount>::SizeType CompressedBitmap<MaxChunks, WordCount>::ArrayLimit;
+
+    template<size_t MaxChunks, size_t WordCount>
+    const __WSTL_CONSTEXPR__ typename CompressedBitmap<MaxChunks, WordCount>::SizeType CompressedBitmap<MaxChunks, WordCount>::BitmapWords;
+
+    template<size_t MaxChunks, size_t WordCount>
+    const __WSTL_CONSTEXPR__ uint32_t CompressedBitmap<MaxChunks, WordCount>::ChunkEnd;
+}
+
+#endif
@@ -8,11 +8,48 @@
 
 #include "private/Platform.hpp"
 #include "TypeTraits.hpp"
+#include "Limits.hpp"
 #include "Memory.hpp"
+#include "Allocator.hpp"
+#include "Instrumentation.hpp"
+#include "NullPointer.hpp"
+#include "private/Error.hpp"
 #include <stddef.h>
 
 
 namespace wstl {
+    namespace __private {
+        /// @brief Moves elements into uninitialized memory and destroys the originals, general version
+        template<typename T>
+        void __Relocate(T* first, size_t count, T* result, FalseType) {
+            for(size_t i = 0; i < count; ++i) {
+                ::new(static_cast<void*>(result + i)) T(__WSTL_MOVE__(first[i]));
+                first[i].~T();
+            }
+        }
+
+        /// @brief Moves elements into uninitialized memory, trivially relocatable version: moves the bytes,
+        /// the ranges may overlap
+        template<typename T>
+        inline void __Relocate(T* first, size_t count, T* result, TrueType) {
+            __MemoryMove(static_cast<void*>(result), static_cast<const void*>(first), count * sizeof(T));
+        }
+
+        /// @brief Moves elements into uninitialized memory and destroys the originals
+        template<typename T>
+        inline void __Relocate(T* first, size_t count, T* result) {
+            __Relocate(first, count, result, BoolConstant<IsTriviallyRelocatable<T>::Value>());
+        }
+
+        /// @brief Draws a block for `count` objects from an allocator
+        /// @return Pointer to the block, or null if the allocator fails or the size in bytes overflows
+        template<typename T>
+        inline T* __AllocateArray(Allocator& allocator, size_t count) {
+            if(count > NumericLimits<size_t>::Max() / sizeof(T)) return NullPointer;
+            return static_cast<T*>(allocator.Allocate(count * sizeof(T)));
+        }
+    }
+
     // Storage types
 
     /// @brief Storage type representing a fixed-size buffer
@@ -75,6 +112,201 @@ namespace wstl {
     FixedExternalStorage(T (&)[N]) -> FixedExternalStorage<T, N>;
     #endif
 
+    /// @brief Storage type representing a buffer drawn from an allocator
+    /// @tparam T Type of the object to store
+    /// @details The block is requested from the allocator at construction and returned to it
+    /// at destruction, so the capacity can be chosen at run time. The storage owns its block and
+    /// cannot be copied, moving it transfers the block and leaves the source without one.
+    /// Containers that support it can grow into a larger block with `Reserve`
+    /// @ingroup containers
+    template<typename T>
+    struct AllocatorStorage {
+        typedef T ValueType;
+        typedef size_t SizeType;
+
+        ValueType* Data;
+        SizeType Capacity;
+
+        /// @brief Constructor
+        /// @param allocator The allocator to draw the block from, it must outlive the storage
+        /// @param capacity The number of objects the block must hold
+        /// @throws `BadAllocation` if the allocator fails or the block size overflows, the capacity is zero then
+        AllocatorStorage(Allocator& allocator, SizeType capacity) : Data(__private::__AllocateArray<ValueType>(allocator, capacity)), 
+            Capacity(0), m_Allocator(&allocator) {
+            __WSTL_ASSERT_RETURN__(Data != NullPointer, WSTL_MAKE_EXCEPTION(BadAllocation, "AllocatorStorage: Allocation failed"));
+            Capacity = capacity;
+        }
+
+        #ifdef __WSTL_CXX11__
+        /// @brief Move constructor, takes the block over from the other storage
+        /// @param other The storage to take the block from
+        /// @since C++11
+        AllocatorStorage(AllocatorStorage&& other) __WSTL_NOEXCEPT__ : Data(other.Data), Capacity(other.Capacity), m_Allocator(other.m_Allocator) {
+            other.Release();
+        }
+        #endif
+
+        /// @brief Destructor, returns the block to the allocator if still owned
+        ~AllocatorStorage() {
+            if(m_Allocator) m_Allocator->Free(Data);
+        }
+
+        #ifdef __WSTL_CXX11__
+        /// @brief Move assignment operator, returns the own block and takes the block over from the other storage
+        /// @param other The storage to take the block from
+        /// @since C++11
+        AllocatorStorage& operator=(AllocatorStorage&& other) __WSTL_NOEXCEPT__ {
+            if(this != &other) {
+                if(m_Allocator) m_Allocator->Free(Data);
+
+                Data = other.Data;
+                Capacity = other.Capacity;
+                m_Allocator = other.m_Allocator;
+                other.Release();
+            }
+
+            return *this;
+        }
+        #endif
+
+        /// @brief Exchanges the blocks of two storages
+        /// @param other The storage to exchange the block with
+        void Swap(AllocatorStorage& other) __WSTL_NOEXCEPT__ {
+            ValueType* const data = Data;
+            const SizeType capacity = Capacity;
+            Allocator* const allocator = m_Allocator;
+
+            Data = other.Data;
+            Capacity = other.Capacity;
+            m_Allocator = other.m_Allocator;
+
+            other.Data = data;
+            other.Capacity = capacity;
+            other.m_Allocator = allocator;
+        }
+
+        /// @brief Gets the allocator the block was drawn from
+        /// @details Null if the block was moved to another storage
+        Allocator* GetAllocator() const {
+            return m_Allocator;
+        }
+
+        /// @brief Moves the first elements into a new block and returns the old one to the allocator
+        /// @param capacity The capacity of the new block
+        /// @param count The number of constructed elements at the start of the block
+        /// @return `true` if the block was replaced
+        /// @throws `BadAllocation` if the allocator fails or the block size overflows
+        bool Reallocate(SizeType capacity, SizeType count) {
+            __WSTL_ASSERT_RETURNVALUE__(m_Allocator != NullPointer, WSTL_MAKE_EXCEPTION(BadAllocation, "AllocatorStorage: No allocator"), false);
+
+            ValueType* const block = __private::__AllocateArray<ValueType>(*m_Allocator, capacity);
+            __WSTL_ASSERT_RETURNVALUE__(block != NullPointer, WSTL_MAKE_EXCEPTION(BadAllocation, "AllocatorStorage: Allocation failed"), false);
+
+            __private::__Relocate(Data, count, block);
+            m_Allocator->Free(Data);
+
+            Data = block;
+            Capacity = capacity;
+            return true;
+        }
+
+    private:
+        Allocator* m_Allocator;
+
+        /// @brief Leaves the storage without a block after it was moved away
+        void Release() {
+            Data = NullPointer;
+            Capacity = 0;
+            m_Allocator = NullPointer;
+        }
+
+        /// @brief Deleted copy constructor, the block has a single owner
+        AllocatorStorage(const AllocatorStorage&) __WSTL_DELETE__;
+
+        /// @brief Deleted copy assignment operator, the block has a single owner
+        AllocatorStorage& operator=(const AllocatorStorage&) __WSTL_DELETE__;
+    };
+
+    /// @brief Storage type representing an inline buffer that spills to an allocator when it grows
+    /// @tparam T Type of the object to store
+    /// @tparam N Number of objects in the inline buffer
+    /// @details Elements live in the inline buffer until `Reallocate` moves them to a larger block
+    /// drawn from the allocator, the block is returned to the allocator at destruction. The storage
+    /// cannot be copied. Moving it transfers an allocated block the same way as `AllocatorStorage`,
+    /// while the destination of an inline storage gets its own empty inline buffer
+    /// @ingroup containers
+    template<typename T, size_t N>
+    struct SmallStorage {
+        typedef T ValueType;
+        typedef size_t SizeType;
+
+        ValueType* Data;
+        SizeType Capacity;
+
+        /// @brief Constructor
+        /// @param allocator The allocator to spill to, it must outlive the storage
+        explicit SmallStorage(Allocator& allocator) : Data(Inline()), Capacity(N), m_Allocator(&allocator) {}
+
+        #ifdef __WSTL_CXX11__
+        /// @brief Move constructor, takes an allocated block over from the other storage
+        /// @param other The storage to take the block from, its inline elements are not moved
+        /// and it is left with its empty inline buffer
+        /// @since C++11
+        SmallStorage(SmallStorage&& other) __WSTL_NOEXCEPT__ : Data(Inline()), Capacity(N), m_Allocator(other.m_Allocator) {
+            if(!other.IsInline()) {
+                Data = other.Data;
+                Capacity = other.Capacity;
+                other.Data = other.Inline();
+                other.Capacity = N;
+            }
+        }
+        #endif
+
+        /// @brief Destructor, returns an allocated block to the allocator
+        ~SmallStorage() {
+            if(!IsInline() && m_Allocator) m_Allocator->Free(Data);
+        }
+
+        /// @brief Checks whether the elements live in the inline buffer
+        bool IsInline() const {
+            return Data == reinterpret_cast<const ValueType*>(&m_Buffer);
+        }
+
+        /// @brief Gets the allocator the storage spills to
+        Allocator* GetAllocator() const {
+            return m_Allocator;
+        }
+
+        /// @copydoc AllocatorStorage::Reallocate(SizeType, SizeType)
+        bool Reallocate(SizeType capacity, SizeType count) {
+            __WSTL_ASSERT_RETURNVALUE__(m_Allocator != NullPointer, WSTL_MAKE_EXCEPTION(BadAllocation, "SmallStorage: No allocator"), false);
+
+            ValueType* const block = __private::__AllocateArray<ValueType>(*m_Allocator, capacity);
+            __WSTL_ASSERT_RETURNVALUE__(block != NullPointer, WSTL_MAKE_EXCEPTION(BadAllocation, "SmallStorage: Allocation failed"), false);
+
+            __private::__Relocate(Data, count, block);
+            if(!IsInline()) m_Allocator->Free(Data);
+
+            Data = block;
+            Capacity = capacity;
+            return true;
+        }
+
+    private:
+        Allocator* m_Allocator;
+        typename AlignedStorage<sizeof(T) * N, AlignmentOf<T>::Value>::Type m_Buffer;
+
+        ValueType* Inline() {
+            return reinterpret_cast<ValueType*>(&m_Buffer);
+        }
+
+        /// @brief Deleted copy constructor, the inline buffer cannot be shared
+        SmallStorage(const SmallStorage&) __WSTL_DELETE__;
+
+        /// @brief Deleted copy assignment operator, the inline buffer cannot be handed over
+        SmallStorage& operator=(const SmallStorage&) __WSTL_DELETE__;
+    };
+
     // Storage traits
     
     /// @brief Traits class for container storage types
@@ -96,11 +328,23 @@ namespace wstl {
 
         /// @brief Indicates whether the storage type supports swapping itself without moving elements
         static const __WSTL_CONSTEXPR__ bool IsSwappable = false;
+
+        /// @brief Indicates whether the storage can move its elements into a larger block with `Reallocate`
+        static const __WSTL_CONSTEXPR__ bool IsGrowable = false;
+
+        /// @brief The capacity if it is fixed at compile time, zero if it is chosen at run time
+        static const __WSTL_CONSTEXPR__ SizeType StaticCapacity = 0;
     };
 
     template<typename Storage>
     const __WSTL_CONSTEXPR__ bool StorageTraits<Storage>::IsSwappable;
 
+    template<typename Storage>
+    const __WSTL_CONSTEXPR__ bool StorageTraits<Storage>::IsGrowable;
+
+    template<typename Storage>
+    const __WSTL_CONSTEXPR__ typename StorageTraits<Storage>::SizeType StorageTraits<Storage>::StaticCapacity;
+
     template<typename T, size_t N>
     struct StorageTraits<FixedStorage<T, N> > {
         /// @brief The type of the storage
@@ -117,6 +361,12 @@ namespace wstl {
 
         /// @brief Indicates whether the storage type supports swapping itself without moving elements
         static const __WSTL_CONSTEXPR__ bool IsSwappable = false;
+
+        /// @brief Indicates whether the storage can move its elements into a larger block with `Reallocate`
+        static const __WSTL_CONSTEXPR__ bool IsGrowable = false;
+
+        /// @brief The capacity if it is fixed at compile time, zero if it is chosen at run time
+        static const __WSTL_CONSTEXPR__ SizeType StaticCapacity = N;
     };
 
     template<typename T>
@@ -135,6 +385,12 @@ namespace wstl {
 
         /// @brief Indicates whether the storage type supports swapping itself without moving elements
         static const __WSTL_CONSTEXPR__ bool IsSwappable = true;
+
+        /// @brief Indicates whether the storage can move its elements into a larger block with `Reallocate`
+        static const __WSTL_CONSTEXPR__ bool IsGrowable = false;
+
+        /// @brief The capacity if it is fixed at compile time, zero if it is chosen at run time
+        static const __WSTL_CONSTEXPR__ SizeType StaticCapacity = 0;
     };
 
     template<typename T, size_t N>
@@ -152,6 +408,60 @@ namespace wstl {
         struct Rebind { typedef FixedExternalStorage<U, N> Other; };
 
         static const __WSTL_CONSTEXPR__ bool IsSwappable = true;
+
+        /// @brief Indicates whether the storage can move its elements into a larger block with `Reallocate`
+        static const __WSTL_CONSTEXPR__ bool IsGrowable = false;
+
+        /// @brief The capacity if it is fixed at compile time, zero if it is chosen at run time
+        static const __WSTL_CONSTEXPR__ SizeType StaticCapacity = N;
+    };
+
+    template<typename T>
+    struct StorageTraits<AllocatorStorage<T> > {
+        /// @brief The type of the storage
+        typedef AllocatorStorage<T> StorageType;
+        /// @brief The type of the elements stored in the storage
+        typedef T ValueType;
+        /// @brief The type used for sizes and indices
+        typedef size_t SizeType;
+
+        /// @brief Rebinds the storage type to a different value type
+        /// @tparam U The new value type to rebind to
+        template<typename U>
+        struct Rebind { typedef AllocatorStorage<U> Other; };
+
+        /// @brief Indicates whether the storage type supports swapping itself without moving elements
+        static const __WSTL_CONSTEXPR__ bool IsSwappable = true;
+
+        /// @brief Indicates whether the storage can move its elements into a larger block with `Reallocate`
+        static const __WSTL_CONSTEXPR__ bool IsGrowable = true;
+
+        /// @brief The capacity if it is fixed at compile time, zero if it is chosen at run time
+        static const __WSTL_CONSTEXPR__ SizeType StaticCapacity = 0;
+    };
+
+    template<typename T, size_t N>
+    struct StorageTraits<SmallStorage<T, N> > {
+        /// @brief The type of the storage
+        typedef SmallStorage<T, N> StorageType;
+        /// @brief The type of the elements stored in the storage
+        typedef T ValueType;
+        /// @brief The type used for sizes and indices
+        typedef size_t SizeType;
+
+        /// @brief Rebinds the storage type to a different value type
+        /// @tparam U The new value type to rebind to
+        template<typename U>
+        struct Rebind { typedef SmallStorage<U, N> Other; };
+
+        /// @brief Indicates whether the storage type supports swapping itself without moving elements
+        static const __WSTL_CONSTEXPR__ bool IsSwappable = false;
+
+        /// @brief Indicates whether the storage can move its elements into a larger block with `Reallocate`
+        static const __WSTL_CONSTEXPR__ bool IsGrowable = true;
+
+        /// @brief The capacity if it is fixed at compile time, zero if it is chosen at run time
+        static const __WSTL_CONSTEXPR__ SizeType StaticCapacity = 0;
     };
 
     /// @brief Base class for all containers
@@ -204,6 +514,26 @@ namespace wstl {
             return MaxSize() - Size();
         }
 
+        #ifdef __WSTL_INSTRUMENTATION__
+        /// @brief Gets the largest size the container reached since construction or `ResetPeakSize`
+        /// @note Requires `__WSTL_INSTRUMENTATION__` to be defined
+        SizeType PeakSize() const __WSTL_NOEXCEPT__ {
+            return m_CurrentSize.Peak();
+        }
+
+        /// @brief Restarts the peak size from the current size
+        /// @note Requires `__WSTL_INSTRUMENTATION__` to be defined
+        void ResetPeakSize() __WSTL_NOEXCEPT__ {
+            m_CurrentSize.ResetPeak();
+        }
+
+        /// @brief Gets the number of insertions or allocations that failed because the container was full
+        /// @note Requires `__WSTL_INSTRUMENTATION__` to be defined
+        SizeType FailureCount() const __WSTL_NOEXCEPT__ {
+            return m_CurrentSize.Failures();
+        }
+        #endif
+
     protected:
         /// @brief Protected default constructor
         /// @details Only available if Storage is default-constructible
@@ -212,8 +542,16 @@ namespace wstl {
         /// @brief Protected destructor
         ~ContainerBase() {}
 
+        /// @brief Records that the container was full, does nothing without `__WSTL_INSTRUMENTATION__`
+        void RecordFailure() {
+            #ifdef __WSTL_INSTRUMENTATION__
+            m_CurrentSize.RecordFailure();
+            __private::__Trace(TRACE_CONTAINER_FULL, this, NullPointer, Capacity());
+            #endif
+        }
+
         Storage m_Storage;
-        SizeType m_CurrentSize;
+        typename __private::__ContainerSize<SizeType>::Type m_CurrentSize;
     };
 
     template<typename Storage>
@@ -254,17 +592,45 @@ namespace wstl {
             return MaxSize() - Size();
         }
 
+        #ifdef __WSTL_INSTRUMENTATION__
+        /// @brief Gets the largest size the container reached since construction or `ResetPeakSize`
+        /// @note Requires `__WSTL_INSTRUMENTATION__` to be defined
+        SizeType PeakSize() const __WSTL_NOEXCEPT__ {
+            return m_CurrentSize.Peak();
+        }
+
+        /// @brief Restarts the peak size from the current size
+        /// @note Requires `__WSTL_INSTRUMENTATION__` to be defined
+        void ResetPeakSize() __WSTL_NOEXCEPT__ {
+            m_CurrentSize.ResetPeak();
+        }
+
+        /// @brief Gets the number of insertions or allocations that failed because the container was full
+        /// @note Requires `__WSTL_INSTRUMENTATION__` to be defined
+        SizeType FailureCount() const __WSTL_NOEXCEPT__ {
+            return m_CurrentSize.Failures();
+        }
+        #endif
+
     protected:
         /// @brief Protected constructor with storage parameter
         /// @details Only available if Storage is not default-constructible
         /// @param storage The storage to use for the container
-        ContainerBase(const Storage& storage) : m_Storage(storage), m_CurrentSize(0) {}
+        ContainerBase(Storage storage) : m_Storage(__WSTL_MOVE__(storage)), m_CurrentSize(0) {}
 
         /// @brief Protected destructor
         ~ContainerBase() {}
 
+        /// @brief Records that the container was full, does nothing without `__WSTL_INSTRUMENTATION__`
+        void RecordFailure() {
+            #ifdef __WSTL_INSTRUMENTATION__
+            m_CurrentSize.RecordFailure();
+            __private::__Trace(TRACE_CONTAINER_FULL, this, NullPointer, Capacity());
+            #endif
+        }
+
         Storage m_Storage;
-        SizeType m_CurrentSize;
+        typename __private::__ContainerSize<SizeType>::Type m_CurrentSize;
     };
 
     template<>
@@ -301,6 +667,27 @@ namespace wstl {
             return MaxSize() - Size();
         }
 
+        #ifdef __WSTL_INSTRUMENTATION__
+        /// @brief Gets the largest size the container reached since construction or `ResetPeakSize`
+        /// @note Requires `__WSTL_INSTRUMENTATION__` to be defined
+        SizeType PeakSize() const __WSTL_NOEXCEPT__ {
+            return m_CurrentSize.Peak();
+        }
+
+        /// @brief Restarts the peak size from the current size
+        /// @note Requires `__WSTL_INSTRUMENTATION__` to be defined
+        void ResetPeakSize() __WSTL_NOEXCEPT__ {
+            m_CurrentSize.ResetPeak();
+        }
+
+        /// @brief Gets the number of insertions or allocations that failed because the container was full
+        /// @details Strings count the truncations detected with `__WSTL_STRING_TRUNCATION_CHECK__`
+        /// @note Requires `__WSTL_INSTRUMENTATION__` to be defined
+        SizeType FailureCount() const __WSTL_NOEXCEPT__ {
+            return m_CurrentSize.Failures();
+        }
+        #endif
+
     protected:
         /// @brief Protected constructor
         /// @param capacity The maximum number of elements container can hold
@@ -309,7 +696,15 @@ namespace wstl {
         /// @brief Protected destructor
         ~ContainerBase() {}
 
-        SizeType m_CurrentSize;
+        /// @brief Records that the container was full, does nothing without `__WSTL_INSTRUMENTATION__`
+        void RecordFailure() {
+            #ifdef __WSTL_INSTRUMENTATION__
+            m_CurrentSize.RecordFailure();
+            __private::__Trace(TRACE_CONTAINER_FULL, this, NullPointer, Capacity());
+            #endif
+        }
+
+        __private::__ContainerSize<SizeType>::Type m_CurrentSize;
         const SizeType m_Capacity;
     };
 
@@ -361,7 +756,7 @@ namespace wstl {
         /// @brief Protected constructor with storage parameter
         /// @details Only available if Storage is not default-constructible
         /// @param storage The storage to use for the container
-        TypedContainerBase(const Storage& storage) : ContainerBase<Storage>(storage) {}
+        TypedContainerBase(Storage storage) : ContainerBase<Storage>(__WSTL_MOVE__(storage)) {}
     };
 
     /// @brief Base class for all typed containers, version with storage and custom value type
@@ -396,7 +791,7 @@ namespace wstl {
         /// @brief Protected constructor with storage parameter
         /// @details Only available if Storage is not default-constructible
         /// @param storage The storage to use for the container
-        TypedContainerBase(const Storage& storage) : ContainerBase<Storage>(storage) {}
+        TypedContainerBase(Storage storage) : ContainerBase<Storage>(__WSTL_MOVE__(storage)) {}
     };
 
     /// @brief Base class for all typed containers, version without storage
@@ -0,0 +1,160 @@
+// Part of WardenSTL - https://github.com/WardenHD/WardenSTL
+// Copyright (c) 2025 Artem Bezruchko (WardenHD)
+//
+// Licensed under the MIT License. See LICENSE file for details.
+
+#ifndef __WSTL_DELEGATE_HPP__
+#define __WSTL_DELEGATE_HPP__
+
+#include "private/Platform.hpp"
+#include "TypeTraits.hpp"
+#include "Utility.hpp"
+#include "NullPointer.hpp"
+#include "Functional.hpp"
+#include "private/Error.hpp"
+
+
+/// @defgroup delegate Delegate
+/// @ingroup functional
+/// @brief Non-owning reference to a function, a member function of an object or a callable
+
+#ifdef __WSTL_CXX11__
+namespace wstl {
+    // Delegate
+
+    /// @brief Non-owning reference to a function, a member function of an object or a callable
+    /// @tparam Signature The signature of the call (`void(int)`)
+    /// @details A delegate is an object pointer and a stub function pointer, it is trivially
+    /// copyable and calls its target with one indirect call. Functions and member functions given
+    /// as template arguments are called directly from the stub, so they can be inlined into it.
+    /// The delegate does not own the object or callable it refers to, it must outlive the delegate
+    /// @ingroup delegate
+    /// @since C++11
+    template<typename Signature>
+    class Delegate;
+
+    template<typename Return, typename... Args>
+    class Delegate<Return(Args...)> {
+    private:
+        union Target {
+            void* Object;
+            const void* ConstObject;
+            Return (*Function)(Args...);
+        };
+
+        typedef Return (*StubType)(Target, Args&&...);
+
+    public:
+        typedef Return ResultType;
+
+        /// @brief Default constructor, creates an empty delegate
+        __WSTL_CONSTEXPR14__ Delegate() __WSTL_NOEXCEPT__ : m_Target(), m_Stub(nullptr) {}
+
+        /// @brief Creates a delegate that calls a function known at compile time
+        /// @tparam Function The function to call
+        template<Return (*Function)(Args...)>
+        static Delegate Create() __WSTL_NOEXCEPT__ {
+            Target target;
+            target.Object = nullptr;
+            return Delegate(target, &FunctionStub<Function>);
+        }
+
+        /// @brief Creates a delegate that calls a member function known at compile time
+        /// @tparam Object Type of the object
+        /// @tparam Method The member function to call
+        /// @param object The object to call the member function on
+        template<typename Object, Return (Object::*Method)(Args...)>
+        static Delegate Create(Object& object) __WSTL_NOEXCEPT__ {
+            Target target;
+            target.Object = &object;
+            return Delegate(target, &MethodStub<Object, Method>);
+        }
+
+        /// @brief Creates a delegate that calls a const member function known at compile time
+        /// @tparam Object Type of the object
+        /// @tparam Method The const member function to call
+        /// @param object The object to call the member function on
+        template<typename Object, Return (Object::*Method)(Args...) const>
+        static Delegate Create(const Object& object) __WSTL_NOEXCEPT__ {
+            Target target;
+            target.ConstObject = &object;
+            return Delegate(target, &ConstMethodStub<Object, Method>);
+        }
+
+        /// @brief Creates a delegate that calls a function pointer
+        /// @param function The function to call, a null pointer creates an empty delegate
+        static Delegate Create(Return (*function)(Args...)) __WSTL_NOEXCEPT__ {
+            Target target;
+            target.Function = function;
+            return function == nullptr ? Delegate() : Delegate(target, &PointerStub);
+        }
+
+        /// @brief Creates a delegate that calls a callable object, such as a lambda, by reference
+        /// @param callable The callable, must outlive the delegate
+        template<typename Callable>
+        static typename EnableIf<!IsPointer<Callable>::Value, Delegate>::Type Create(Callable& callable) __WSTL_NOEXCEPT__ {
+            Target target;
+            target.ConstObject = &callable;
+            return Delegate(target, &CallableStub<Callable>);
+        }
+
+        /// @brief Calls the target
+        /// @param ...args The arguments to forward to the target
+        /// @return The result of the call
+        /// @throws `BadFunctionCall` if the delegate is empty
+        Return operator()(Args... args) const {
+            __WSTL_ASSERT__(m_Stub != nullptr, WSTL_MAKE_EXCEPTION(BadFunctionCall));
+            return m_Stub(m_Target, Forward<Args>(args)...);
+        }
+
+        /// @brief Checks if the delegate has a target
+        explicit __WSTL_CONSTEXPR14__ operator bool() const __WSTL_NOEXCEPT__ {
+            return m_Stub != nullptr;
+        }
+
+        /// @brief Checks if two delegates call the same target
+        friend bool operator==(const Delegate& a, const Delegate& b) __WSTL_NOEXCEPT__ {
+            if(a.m_Stub != b.m_Stub) return false;
+            if(a.m_Stub == &PointerStub) return a.m_Target.Function == b.m_Target.Function;
+
+            return a.m_Target.ConstObject == b.m_Target.ConstObject;
+        }
+
+        friend bool operator!=(const Delegate& a, const Delegate& b) __WSTL_NOEXCEPT__ {
+            return !(a == b);
+        }
+
+    private:
+        Target m_Target;
+        StubType m_Stub;
+
+        Delegate(Target target, StubType stub) __WSTL_NOEXCEPT__ : m_Target(target), m_Stub(stub) {}
+
+        template<Return (*Function)(Args...)>
+        static Return FunctionStub(Target, Args&&... args) {
+            return Function(Forward<Args>(args)...);
+        }
+
+        template<typename Object, Return (Object::*Method)(Args...)>
+        static Return MethodStub(Target target, Args&&... args) {
+            return (static_cast<Object*>(target.Object)->*Method)(Forward<Args>(args)...);
+        }
+
+        template<typename Object, Return (Object::*Method)(Args...) const>
+        static Return ConstMethodStub(Target target, Args&&... args) {
+            return (static_cast<const Object*>(target.ConstObject)->*Method)(Forward<Args>(args)...);
+        }
+
+        static Return PointerStub(Target target, Args&&... args) {
+            return target.Function(Forward<Args>(args)...);
+        }
+
+        template<typename Callable>
+        static Return CallableStub(Target target, Args&&... args) {
+            return static_cast<Return>((*static_cast<Callable*>(const_cast<void*>(target.ConstObject)))(Forward<Args>(args)...));
+        }
+    };
+}
+#endif
+
+#endif
\ No newline at end of file
@@ -17,6 +17,8 @@
 #include "StandardExceptions.hpp"
 #include "PlacementNew.hpp"
 #include "Algorithm.hpp"
+#include "Span.hpp"
+#include "Expected.hpp"
 
 
 /// @defgroup deque Deque
@@ -440,7 +442,7 @@ namespace wstl {
 
         /// @brief Constructor with custom storage, only for non-default-constructible storage
         /// @param storage Storage to use for the deque
-        explicit BasicDeque(const StorageType& storage) : Base(storage), m_StartIndex(0) {}
+        explicit BasicDeque(StorageType storage) : Base(__WSTL_MOVE__(storage)), m_StartIndex(0) {}
 
         /// @brief Destructor
         ~BasicDeque() {
@@ -460,7 +462,7 @@ namespace wstl {
         /// @param other The deque to copy from
         /// @param storage Storage to use for the deque
         /// @throws `LengthError` if the copied deque's size exceeds the deque's capacity
-        BasicDeque(const BasicDeque& other, const StorageType& storage) : Base(storage), m_StartIndex(0) {
+        BasicDeque(const BasicDeque& other, StorageType storage) : Base(__WSTL_MOVE__(storage)), m_StartIndex(0) {
             __WSTL_ASSERT_RETURN__(other.Size() <= this->Capacity(), WSTL_MAKE_EXCEPTION(LengthError, "Deque overflow"));
             
             typename BasicDeque::ConstIterator it = other.Begin();
@@ -486,7 +488,7 @@ namespace wstl {
         /// @param storage Storage to use for the deque
         /// @throws `LengthError` if the moved deque's size exceeds the deque's capacity
         /// @since C++11
-        BasicDeque(BasicDeque&& other, const StorageType& storage) : Base(storage), m_StartIndex(0) {
+        BasicDeque(BasicDeque&& other, StorageType storage) : Base(__WSTL_MOVE__(storage)), m_StartIndex(0) {
             if(this != &other) {
                 __WSTL_ASSERT_RETURN__(other.Size() <= this->Capacity(), WSTL_MAKE_EXCEPTION(LengthError, "Deque overflow"));
 
@@ -513,7 +515,7 @@ namespace wstl {
         /// @param storage Storage to use for the deque
         /// @throws `LengthError` if the range size exceeds the deque's capacity
         template<typename InputIterator>
-        BasicDeque(InputIterator first, InputIterator last, const StorageType& storage, typename EnableIf<!IsIntegral<InputIterator>::Value, int>::Type = 0) : Base(storage), m_StartIndex(0) {
+        BasicDeque(InputIterator first, InputIterator last, StorageType storage, typename EnableIf<!IsIntegral<InputIterator>::Value, int>::Type = 0) : Base(__WSTL_MOVE__(storage)), m_StartIndex(0) {
             __WSTL_ASSERT_RETURN__(Distance(first, last) <= this->Capacity(), WSTL_MAKE_EXCEPTION(LengthError, "Deque overflow"));
             for(; first != last; ++first) CreateBack(*first);
         }
@@ -531,7 +533,7 @@ namespace wstl {
         /// @param count The number of elements to initialize the deque with
         /// @param storage Storage to use for the deque
         /// @throws `LengthError` if count exceeds the deque's capacity
-        explicit BasicDeque(SizeType count, const StorageType& storage) : Base(storage), m_StartIndex(0) {
+        explicit BasicDeque(SizeType count, StorageType storage) : Base(__WSTL_MOVE__(storage)), m_StartIndex(0) {
             __WSTL_ASSERT_RETURN__(count <= this->Capacity(), WSTL_MAKE_EXCEPTION(LengthError, "Deque overflow"));
             while(count--) CreateBack();
         }
@@ -551,7 +553,7 @@ namespace wstl {
         /// @param value The value to initialize each element with
         /// @param storage Storage to use for the deque
         /// @throws `LengthError` if count exceeds the deque's capacity
-        BasicDeque(SizeType count, ConstReferenceType value, const StorageType& storage) : Base(storage), m_StartIndex(0) {
+        BasicDeque(SizeType count, ConstReferenceType value, StorageType storage) : Base(__WSTL_MOVE__(storage)), m_StartIndex(0) {
             __WSTL_ASSERT_RETURN__(count <= this->Capacity(), WSTL_MAKE_EXCEPTION(LengthError, "Deque overflow"));
             while(count--) CreateBack(value);
         }
@@ -574,7 +576,7 @@ namespace wstl {
         /// @param storage Storage to use for the deque
         /// @throws `LengthError` if list size exceeds the deque's capacity
         /// @since C++11
-        BasicDeque(InitializerList<ValueType> list, const StorageType& storage) : Base(storage), m_StartIndex(0) {
+        BasicDeque(InitializerList<ValueType> list, StorageType storage) : Base(__WSTL_MOVE__(storage)), m_StartIndex(0) {
             __WSTL_ASSERT_RETURN__(list.Size() <= this->Capacity(), WSTL_MAKE_EXCEPTION(LengthError, "Deque overflow"));
             
             typename InitializerList<ValueType>::Iterator it = list.Begin();
@@ -783,6 +785,52 @@ namespace wstl {
             return ConstReverseIterator(Begin());
         }
 
+        /// @brief Gets the contiguous run of elements that starts at the given position
+        /// @param position The position of the first element of the run
+        /// @return Span reaching to the end of the buffer or the end of the deque, whichever comes first,
+        /// empty if the position is not less than the size
+        /// @details The elements form at most two runs, looping over them runs at pointer speed
+        Span<ValueType> SegmentFrom(SizeType position) {
+            if(position >= this->m_CurrentSize) return Span<ValueType>();
+
+            const SizeType physical = PhysicalIndex(position);
+            return Span<ValueType>(this->m_Storage.Data + physical, RunLength(physical, position));
+        }
+
+        /// @copydoc SegmentFrom(SizeType)
+        Span<const ValueType> SegmentFrom(SizeType position) const {
+            if(position >= this->m_CurrentSize) return Span<const ValueType>();
+
+            const SizeType physical = PhysicalIndex(position);
+            return Span<const ValueType>(this->m_Storage.Data + physical, RunLength(physical, position));
+        }
+
+        /// @brief Calls a function on every contiguous run of elements, front to back
+        /// @param function Function that takes a `Span` of elements
+        /// @return The function
+        template<typename Function>
+        Function ForEachSegment(Function function) {
+            for(SizeType position = 0; position < this->m_CurrentSize;) {
+                Span<ValueType> segment = SegmentFrom(position);
+                function(segment);
+                position += segment.Size();
+            }
+
+            return function;
+        }
+
+        /// @copydoc ForEachSegment(Function)
+        template<typename Function>
+        Function ForEachSegment(Function function) const {
+            for(SizeType position = 0; position < this->m_CurrentSize;) {
+                Span<const ValueType> segment = SegmentFrom(position);
+                function(segment);
+                position += segment.Size();
+            }
+
+            return function;
+        }
+
         /// @brief Clears the deque, removing all elements
         void Clear() {
             Initialize<ValueType>();
@@ -796,6 +844,7 @@ namespace wstl {
         Iterator Insert(ConstIterator position, ConstReferenceType value) {
             Iterator result = ToIterator(position);
 
+            if(this->Full()) this->RecordFailure();
             __WSTL_ASSERT_RETURNVALUE__(!this->Full(), WSTL_MAKE_EXCEPTION(LengthError, "Deque full"), result);
             
             if(result == Begin()) CreateFront(value);
@@ -829,6 +878,7 @@ namespace wstl {
         Iterator Insert(ConstIterator position, ValueType&& value) {
             Iterator result = ToIterator(position);
 
+            if(this->Full()) this->RecordFailure();
             __WSTL_ASSERT_RETURNVALUE__(!this->Full(), WSTL_MAKE_EXCEPTION(LengthError, "Deque full"), result);
 
             if(result == Begin()) CreateFront(Move(value));
@@ -861,11 +911,12 @@ namespace wstl {
         /// @throws `LengthError` if the deque is full
         Iterator Insert(ConstIterator position, SizeType count, ConstReferenceType value) {
             Iterator result = ToIterator(position);
+            if(count == 0) return result;
 
+            if(count > this->Capacity() - this->m_CurrentSize) this->RecordFailure();
             __WSTL_ASSERT_RETURNVALUE__(count <= this->Capacity() - this->m_CurrentSize, WSTL_MAKE_EXCEPTION(LengthError, "Deque full"), result);
 
             SizeType distanceFront = Distance(Begin(), result);
-            SizeType distanceBack = Distance(result, End());
 
             if(position == Begin()) {
                 // Insert at front
@@ -878,49 +929,13 @@ namespace wstl {
                 result = End() - count;
             }
             else {
-                // Insert in the middle
-                if (distanceFront <= distanceBack) {
-                    SizeType createCopy = Min(count, distanceFront);
-                    SizeType createNew = (count > createCopy) ? count - createCopy : 0;
-                    SizeType copyNew = (count > createNew) ? count - createNew : 0;
-                    SizeType copyOld = distanceFront - createCopy;
-
-                    // Create new values
-                    for(SizeType i = 0; i < createNew; ++i) CreateFront(value);
-
-                    // Create copies of old values
-                    Iterator from = Begin() + createCopy - 1 + createNew;
-                    for(SizeType i = 0; i < createCopy; ++i, --from) CreateFront(*from);
-
-                    // Move old values
-                    from = result - copyOld;
-                    Iterator to = Begin() + createCopy;
-                    Move(from, from + copyOld, to);
-
-                    // Fill the rest of the new values
-                    to = result - createCopy;
-                    FillInRange(to, copyNew, value);
-
-                    result = Begin() + distanceFront;
-                } 
-                else {
-                    SizeType createCopy = Min(count, distanceBack);
-                    SizeType createNew = (count > createCopy) ? count - createCopy : 0;
-                    SizeType copyNew = (count > createNew) ? count - createNew : 0;
-                    SizeType copyOld = distanceBack - createCopy;
+                // The value may be an element of the deque, which is moved by opening the gap
+                const ValueType copy(value);
 
-                    // Create new values
-                    for(SizeType i = 0; i < createNew; ++i) CreateBack(value);
-
-                    // Create copies of old values
-                    for(SizeType i = 0; i < createCopy; ++i) CreateBack(*(result + copyOld + i));
-
-                    // Move old values
-                    MoveBackward(result, result + copyOld, result + count + copyOld);
-
-                    // Fill the rest of the new values
-                    FillInRange(result, copyNew, value);
-                }
+                // Shift the shorter side in bulk and fill the gap
+                OpenGap(distanceFront, count);
+                FillGap(distanceFront, count, copy);
+                result = Begin() + distanceFront;
             }
 
             return result;
@@ -937,11 +952,12 @@ namespace wstl {
         Insert(ConstIterator position, InputIterator first, InputIterator last) {
             Iterator result = ToIterator(position);
             SizeType count = Distance(first, last);
+            if(count == 0) return result;
 
+            if(count > this->Available()) this->RecordFailure();
             __WSTL_ASSERT_RETURNVALUE__(count <= this->Available(), WSTL_MAKE_EXCEPTION(LengthError, "Deque full"), result);
 
             SizeType distanceFront = Distance(Begin(), result);
-            SizeType distanceBack = Distance(result, End());
 
             if(position == Begin()) {
                 // Insert at front
@@ -954,50 +970,10 @@ namespace wstl {
                 result = End() - count;
             }
             else {
-                // Insert in the middle
-                if (distanceFront <= distanceBack) {
-                    SizeType createCopy = Min(count, distanceFront);
-                    SizeType createNew = (count > createCopy) ? count - createCopy : 0;
-                    SizeType copyNew = (count > createNew) ? count - createNew : 0;
-                    SizeType copyOld = distanceFront - createCopy;
-
-                    // Create new values
-                    CreateFront(first, createNew);
-
-                    // Create copies of old values
-                    CreateFront(Begin() + createNew, createCopy);
-
-                    // Move old values
-                    Iterator from = result - copyOld;
-                    Iterator to = Begin() + createCopy;
-                    Move(from, from + copyOld, to);
-                    
-                    // Copy new values
-                    to = result - createCopy;
-                    first += createNew;
-                    CopyInRange(first, copyNew, to);
-
-                    result = Begin() + distanceFront;
-                } 
-                else {
-                    SizeType createCopy = Min(count, distanceBack);
-                    SizeType createNew = (count > createCopy) ? count - createCopy : 0;
-                    SizeType copyNew = (count > createNew) ? count - createNew : 0;
-                    SizeType copyOld = distanceBack - createCopy;
-
-                    // Create new values
-                    InputIterator it = first + (count - createNew);
-                    for(SizeType i = 0; i < createNew; ++i, ++it) CreateBack(*it);
-
-                    // Create copies of old values
-                    for(SizeType i = 0; i < createCopy; ++i) CreateBack(*(result + copyOld + i));
-
-                    // Move old values
-                    MoveBackward(result, result + copyOld, result + count + copyOld);
-
-                    // Copy new values
-                    CopyInRange(first, copyNew, result);
-                }
+                // Shift the shorter side in bulk and construct the new elements in the gap
+                OpenGap(distanceFront, count);
+                ConstructGap(distanceFront, first, count);
+                result = Begin() + distanceFront;
             }
 
             return result;
@@ -1012,11 +988,12 @@ namespace wstl {
         /// @since C++11
         Iterator Insert(ConstIterator position, InitializerList<ValueType> list) {
             Iterator result = ToIterator(position);
+            if(list.Size() == 0) return result;
 
+            if(list.Size() > this->Available()) this->RecordFailure();
             __WSTL_ASSERT_RETURNVALUE__(list.Size() <= this->Available(), WSTL_MAKE_EXCEPTION(LengthError, "Deque overflow"), result);
 
             SizeType distanceFront = Distance(Begin(), result);
-            SizeType distanceBack = Distance(result, End());
 
             if(position == Begin()) {
                 // Insert at front
@@ -1029,49 +1006,10 @@ namespace wstl {
                 result = End() - list.Size();
             }
             else {
-                // Insert in the middle
-                if (distanceFront <= distanceBack) {
-                    SizeType createCopy = Min(list.Size(), distanceFront);
-                    SizeType createNew = (list.Size() > createCopy) ? list.Size() - createCopy : 0;
-                    SizeType copyNew = (list.Size() > createNew) ? list.Size() - createNew : 0;
-                    SizeType copyOld = distanceFront - createCopy;
-
-                    // Create new values
-                    CreateFront(list.Begin(), createNew);
-
-                    // Create copies of old values
-                    CreateFront(Begin() + createNew, createCopy);
-
-                    // Move old values
-                    Iterator from = result - copyOld;
-                    Iterator to = Begin() + createCopy;
-                    Move(from, from + copyOld, to);
-                    
-                    // Copy new values
-                    to = result - createCopy;
-                    CopyInRange(list.Begin() + createNew, copyNew, to);
-
-                    result = Begin() + distanceFront;
-                } 
-                else {
-                    SizeType createCopy = Min(list.Size(), distanceBack);
-                    SizeType createNew = (list.Size() > createCopy) ? list.Size() - createCopy : 0;
-                    SizeType copyNew = (list.Size() > createNew) ? list.Size() - createNew : 0;
-                    SizeType copyOld = distanceBack - createCopy;
-
-                    // Create new values
-                    typename InitializerList<ValueType>::Iterator it = list.Begin() + (list.Size() - createNew);
-                    for(SizeType i = 0; i < createNew; ++i, ++it) CreateBack(*it);
-
-                    // Create copies of old values
-                    for(SizeType i = 0; i < createCopy; ++i) CreateBack(*(result + copyOld + i));
-
-                    // Move old values
-                    MoveBackward(result, result + copyOld, result + list.Size() + copyOld);
-
-                    // Copy new values
-                    CopyInRange(list.Begin(), copyNew, result);
-                }
+                // Shift the shorter side in bulk and construct the new elements in the gap
+                OpenGap(distanceFront, list.Size());
+                ConstructGap(distanceFront, list.Begin(), list.Size());
+                result = Begin() + distanceFront;
             }
 
             return result;
@@ -1112,6 +1050,7 @@ namespace wstl {
         Iterator Emplace(ConstIterator position, Args&&... args) {
             Iterator result = ToIterator(position);
 
+            if(this->Full()) this->RecordFailure();
             __WSTL_ASSERT_RETURNVALUE__(!this->Full(), WSTL_MAKE_EXCEPTION(LengthError, "Deque full"), result);
 
             void* pointer;
@@ -1162,6 +1101,7 @@ namespace wstl {
         Iterator Emplace(ConstIterator position) {
             Iterator result = ToIterator(position);
 
+            if(this->Full()) this->RecordFailure();
             __WSTL_ASSERT_RETURNVALUE__(!this->Full(), WSTL_MAKE_EXCEPTION(LengthError, "Deque full"), result);
 
             void* pointer;
@@ -1213,6 +1153,7 @@ namespace wstl {
         Iterator Emplace(ConstIterator position, const Arg& arg) {
             Iterator result = ToIterator(position);
 
+            if(this->Full()) this->RecordFailure();
             __WSTL_ASSERT_RETURNVALUE__(!this->Full(), WSTL_MAKE_EXCEPTION(LengthError, "Deque full"), result);
 
             void* pointer;
@@ -1265,6 +1206,7 @@ namespace wstl {
         Iterator Emplace(ConstIterator position, const Arg1& arg1, const Arg2& arg2) {
             Iterator result = ToIterator(position);
 
+            if(this->Full()) this->RecordFailure();
             __WSTL_ASSERT_RETURNVALUE__(!this->Full(), WSTL_MAKE_EXCEPTION(LengthError, "Deque full"), result);
 
             void* pointer;
@@ -1318,6 +1260,7 @@ namespace wstl {
         Iterator Emplace(ConstIterator position, const Arg1& arg1, const Arg2& arg2, const Arg3& arg3) {
             Iterator result = ToIterator(position);
 
+            if(this->Full()) this->RecordFailure();
             __WSTL_ASSERT_RETURNVALUE__(!this->Full(), WSTL_MAKE_EXCEPTION(LengthError, "Deque full"), result);
 
             void* pointer;
@@ -1405,6 +1348,7 @@ namespace wstl {
         Iterator Erase(ConstIterator first, ConstIterator last) {
             Iterator result = ToIterator(first);
             SizeType count = Distance(first, last);
+            if(count == 0) return result;
 
             if(result == Begin()) {
                 for(SizeType i = 0; i < count; ++i) DestroyFront();
@@ -1415,21 +1359,12 @@ namespace wstl {
                 result = End();
             }
             else {
-                if(Distance(Begin(), result) <= DifferenceType(this->m_CurrentSize / 2)) {
-                    // Move front elements to the back to overwrite the range
-                    MoveBackward(Begin(), result, result + count);
+                const SizeType index = Distance(Begin(), result);
 
-                    // Destroy unneeded front elements
-                    for(SizeType i = 0; i < count; ++i) DestroyFront();
-                    result += count;
-                }
-                else {
-                    // Move back elements to the front to overwrite the range
-                    Move(result + count, End(), result);
-                    
-                    // Destroy unneeded back elements
-                    for(SizeType i = 0; i < count; ++i) DestroyBack();
-                }
+                // Destroy the range and shift the shorter side over it in bulk
+                for(SizeType i = 0; i < count; ++i) this->m_Storage.Data[PhysicalIndex(index + i)].~ValueType();
+                CloseGap(index, count);
+                result = Begin() + index;
             }
 
             return result;
@@ -1439,6 +1374,7 @@ namespace wstl {
         /// @param value The value to push to the back
         /// @throws `LengthError` if the deque is full and `__WSTL_ASSERT_PUSHPOP__` is defined
         void PushBack(ConstReferenceType value) {
+            if(this->Full()) this->RecordFailure();
             __WSTL_ASSERT_PUSHPOP_RETURN__(!this->Full(), WSTL_MAKE_EXCEPTION(LengthError, "Deque full"));
             CreateBack(value);
         }
@@ -1449,6 +1385,7 @@ namespace wstl {
         /// @throws `LengthError` if the deque is full and `__WSTL_ASSERT_PUSHPOP__` is defined
         /// @since C++11
         void PushBack(ValueType&& value) {
+            if(this->Full()) this->RecordFailure();
             __WSTL_ASSERT_PUSHPOP_RETURN__(!this->Full(), WSTL_MAKE_EXCEPTION(LengthError, "Deque full"));
             CreateBack(Forward<ValueType>(value));
         }
@@ -1461,6 +1398,7 @@ namespace wstl {
         /// @since C++11
         template<typename... Args>
         void EmplaceBack(Args&&... args) {
+            if(this->Full()) this->RecordFailure();
             __WSTL_ASSERT_PUSHPOP_RETURN__(!this->Full(), WSTL_MAKE_EXCEPTION(LengthError, "Deque full"));
 
             // Construct back element at the beginning of the buffer
@@ -1472,6 +1410,7 @@ namespace wstl {
         /// @brief Emplaces an element at the back of the deque, constructing it in place
         /// @throws `LengthError` if the deque is full and `__WSTL_ASSERT_PUSHPOP__` is defined
         void EmplaceBack() {
+            if(this->Full()) this->RecordFailure();
             __WSTL_ASSERT_PUSHPOP_RETURN__(!this->Full(), WSTL_MAKE_EXCEPTION(LengthError, "Deque full"));
 
             ::new(&this->m_Storage.Data[PhysicalIndex(this->m_CurrentSize)]) ValueType();
@@ -1483,6 +1422,7 @@ namespace wstl {
         /// @throws `LengthError` if the deque is full and `__WSTL_ASSERT_PUSHPOP__` is defined
         template<typename Arg>
         void EmplaceBack(const Arg& arg) {
+            if(this->Full()) this->RecordFailure();
             __WSTL_ASSERT_PUSHPOP_RETURN__(!this->Full(), WSTL_MAKE_EXCEPTION(LengthError, "Deque full"));
 
             // Construct back element at the beginning of the buffer
@@ -1496,6 +1436,7 @@ namespace wstl {
         /// @throws `LengthError` if the deque is full and `__WSTL_ASSERT_PUSHPOP__` is defined
         template<typename Arg1, typename Arg2>
         void EmplaceBack(const Arg1& arg1, const Arg2& arg2) {
+            if(this->Full()) this->RecordFailure();
             __WSTL_ASSERT_PUSHPOP_RETURN__(!this->Full(), WSTL_MAKE_EXCEPTION(LengthError, "Deque full"));
 
             // Construct back element at the beginning of the buffer
@@ -1510,6 +1451,7 @@ namespace wstl {
         /// @throws `LengthError` if the deque is full and `__WSTL_ASSERT_PUSHPOP__` is defined
         template<typename Arg1, typename Arg2, typename Arg3>
         void EmplaceBack(const Arg1& arg1, const Arg2& arg2, const Arg3& arg3) {
+            if(this->Full()) this->RecordFailure();
             __WSTL_ASSERT_PUSHPOP_RETURN__(!this->Full(), WSTL_MAKE_EXCEPTION(LengthError, "Deque full"));
 
             // Construct back element at the beginning of the buffer
@@ -1549,6 +1491,7 @@ namespace wstl {
         /// @param value The value to push to the front
         /// @throws `LengthError` if the deque is full and `__WSTL_ASSERT_PUSHPOP__` is defined
         void PushFront(ConstReferenceType value) {
+            if(this->Full()) this->RecordFailure();
             __WSTL_ASSERT_PUSHPOP_RETURN__(!this->Full(), WSTL_MAKE_EXCEPTION(LengthError, "Deque full"));
             CreateFront(value);
         }
@@ -1559,6 +1502,7 @@ namespace wstl {
         /// @throws `LengthError` if the deque is full and `__WSTL_ASSERT_PUSHPOP__` is defined
         /// @since C++11
         void PushFront(ValueType&& value) {
+            if(this->Full()) this->RecordFailure();
             __WSTL_ASSERT_PUSHPOP_RETURN__(!this->Full(), WSTL_MAKE_EXCEPTION(LengthError, "Deque full"));
             CreateFront(Forward<ValueType>(value));
         }
@@ -1571,6 +1515,7 @@ namespace wstl {
         /// @since C++11
         template<typename... Args>
         void EmplaceFront(Args&&... args) {
+            if(this->Full()) this->RecordFailure();
             __WSTL_ASSERT_PUSHPOP_RETURN__(!this->Full(), WSTL_MAKE_EXCEPTION(LengthError, "Deque full"));
 
             // Construct the front element at the end of the buffer
@@ -1583,6 +1528,7 @@ namespace wstl {
         /// @brief Emplaces an element at the front of the deque, constructing it in place
         /// @throws `LengthError` if the deque is full and `__WSTL_ASSERT_PUSHPOP__` is defined
         void EmplaceFront() {
+            if(this->Full()) this->RecordFailure();
             __WSTL_ASSERT_PUSHPOP_RETURN__(!this->Full(), WSTL_MAKE_EXCEPTION(LengthError, "Deque full"));
 
             // Construct the front element at the end of the buffer
@@ -1597,6 +1543,7 @@ namespace wstl {
         /// @throws `LengthError` if the deque is full and `__WSTL_ASSERT_PUSHPOP__` is defined
         template<typename Arg>
         void EmplaceFront(const Arg& arg) {
+            if(this->Full()) this->RecordFailure();
             __WSTL_ASSERT_PUSHPOP_RETURN__(!this->Full(), WSTL_MAKE_EXCEPTION(LengthError, "Deque full"));
 
             // Construct the front element at the end of the buffer
@@ -1611,6 +1558,7 @@ namespace wstl {
         /// @throws `LengthError` if the deque is full and `__WSTL_ASSERT_PUSHPOP__` is defined
         template<typename Arg1, typename Arg2>
         void EmplaceFront(const Arg1& arg1, const Arg2& arg2) {
+            if(this->Full()) this->RecordFailure();
             __WSTL_ASSERT_PUSHPOP_RETURN__(!this->Full(), WSTL_MAKE_EXCEPTION(LengthError, "Deque full"));
 
             // Construct the front element at the end of the buffer
@@ -1626,6 +1574,7 @@ namespace wstl {
         /// @throws `LengthError` if the deque is full and `__WSTL_ASSERT_PUSHPOP__` is defined
         template<typename Arg1, typename Arg2, typename Arg3>
         void EmplaceFront(const Arg1& arg1, const Arg2& arg2, const Arg3& arg3) {
+            if(this->Full()) this->RecordFailure();
             __WSTL_ASSERT_PUSHPOP_RETURN__(!this->Full(), WSTL_MAKE_EXCEPTION(LengthError, "Deque full"));
 
             // Construct the front element at the end of the buffer
@@ -1642,6 +1591,142 @@ namespace wstl {
             DestroyFront();
         }
 
+        /// @brief Pushes an element to the back of the deque if there is room, without error handling
+        /// @param value The value to push to the back
+        /// @return Nothing, or `ERROR_CODE_FULL` if the deque is full
+        Expected<void> TryPushBack(ConstReferenceType value) {
+            if(this->Full()) {
+                this->RecordFailure();
+                return MakeUnexpected(ERROR_CODE_FULL);
+            }
+
+            CreateBack(value);
+            return Expected<void>();
+        }
+
+        #ifdef __WSTL_CXX11__
+        /// @brief Pushes an element to the back of the deque if there is room, without error handling
+        /// @param value The value to push to the back (rvalue reference)
+        /// @return Nothing, or `ERROR_CODE_FULL` if the deque is full
+        /// @since C++11
+        Expected<void> TryPushBack(ValueType&& value) {
+            if(this->Full()) {
+                this->RecordFailure();
+                return MakeUnexpected(ERROR_CODE_FULL);
+            }
+
+            CreateBack(Forward<ValueType>(value));
+            return Expected<void>();
+        }
+
+        /// @brief Emplaces an element at the back of the deque if there is room, without error handling
+        /// @param ...args The arguments to forward to the constructor of the element
+        /// @return Nothing, or `ERROR_CODE_FULL` if the deque is full
+        /// @since C++11
+        template<typename... Args>
+        Expected<void> TryEmplaceBack(Args&&... args) {
+            if(this->Full()) {
+                this->RecordFailure();
+                return MakeUnexpected(ERROR_CODE_FULL);
+            }
+
+            ::new(&this->m_Storage.Data[PhysicalIndex(this->m_CurrentSize)]) ValueType(Forward<Args>(args)...);
+            ++this->m_CurrentSize;
+            return Expected<void>();
+        }
+        #endif
+
+        /// @brief Pushes an element to the front of the deque if there is room, without error handling
+        /// @param value The value to push to the front
+        /// @return Nothing, or `ERROR_CODE_FULL` if the deque is full
+        Expected<void> TryPushFront(ConstReferenceType value) {
+            if(this->Full()) {
+                this->RecordFailure();
+                return MakeUnexpected(ERROR_CODE_FULL);
+            }
+
+            CreateFront(value);
+            return Expected<void>();
+        }
+
+        #ifdef __WSTL_CXX11__
+        /// @brief Pushes an element to the front of the deque if there is room, without error handling
+        /// @param value The value to push to the front (rvalue reference)
+        /// @return Nothing, or `ERROR_CODE_FULL` if the deque is full
+        /// @since C++11
+        Expected<void> TryPushFront(ValueType&& value) {
+            if(this->Full()) {
+                this->RecordFailure();
+                return MakeUnexpected(ERROR_CODE_FULL);
+            }
+
+            CreateFront(Forward<ValueType>(value));
+            return Expected<void>();
+        }
+
+        /// @brief Emplaces an element at the front of the deque if there is room, without error handling
+        /// @param ...args The arguments to forward to the constructor of the element
+        /// @return Nothing, or `ERROR_CODE_FULL` if the deque is full
+        /// @since C++11
+        template<typename... Args>
+        Expected<void> TryEmplaceFront(Args&&... args) {
+            if(this->Full()) {
+                this->RecordFailure();
+                return MakeUnexpected(ERROR_CODE_FULL);
+            }
+
+            this->m_StartIndex = PhysicalIndex(this->Capacity() - 1);
+            ::new(&this->m_Storage.Data[this->m_StartIndex]) ValueType(Forward<Args>(args)...);
+            ++this->m_CurrentSize;
+            return Expected<void>();
+        }
+        #endif
+
+        /// @brief Pops the last element if there is one, without error handling
+        /// @return Nothing, or `ERROR_CODE_EMPTY` if the deque is empty
+        Expected<void> TryPopBack() {
+            if(this->Empty()) return MakeUnexpected(ERROR_CODE_EMPTY);
+
+            DestroyBack();
+            return Expected<void>();
+        }
+
+        /// @brief Pops the first element if there is one, without error handling
+        /// @return Nothing, or `ERROR_CODE_EMPTY` if the deque is empty
+        Expected<void> TryPopFront() {
+            if(this->Empty()) return MakeUnexpected(ERROR_CODE_EMPTY);
+
+            DestroyFront();
+            return Expected<void>();
+        }
+
+        /// @brief Inserts an element at specified position if there is room, without error handling
+        /// @param position The position to insert the element at
+        /// @param value The value to insert
+        /// @return Iterator to the newly inserted element, or `ERROR_CODE_FULL` if the deque is full
+        Expected<Iterator> TryInsert(ConstIterator position, ConstReferenceType value) {
+            if(this->Full()) {
+                this->RecordFailure();
+                return MakeUnexpected(ERROR_CODE_FULL);
+            }
+            return Insert(position, value);
+        }
+
+        #ifdef __WSTL_CXX11__
+        /// @brief Inserts an element at specified position if there is room, without error handling
+        /// @param position The position to insert the element at
+        /// @param value The value to insert (rvalue reference)
+        /// @return Iterator to the newly inserted element, or `ERROR_CODE_FULL` if the deque is full
+        /// @since C++11
+        Expected<Iterator> TryInsert(ConstIterator position, ValueType&& value) {
+            if(this->Full()) {
+                this->RecordFailure();
+                return MakeUnexpected(ERROR_CODE_FULL);
+            }
+            return Insert(position, Move(value));
+        }
+        #endif
+
         /// @brief Prepends a range of elements to the front of the deque
         /// @param range The range to prepend the elements from
         /// @throws `LengthError` if the deque is full
@@ -1700,21 +1785,191 @@ namespace wstl {
             wstl::Swap(m_StartIndex, other.m_StartIndex);
             wstl::Swap(this->m_CurrentSize, other.m_CurrentSize);
         }
+
+        /// @brief Grows the deque into a larger block drawn from the allocator of its storage
+        /// @param capacity The minimum capacity after the call
+        /// @return `true` if the capacity is at least `capacity` afterwards
+        /// @details Only available for `AllocatorStorage`. Elements are moved to the new block in order
+        /// and the old block is returned to the allocator, all iterators and references are invalidated
+        /// @throws `BadAllocation` if the allocator fails
+        bool Reserve(SizeType capacity) {
+            if(capacity <= this->Capacity()) return true;
+            __WSTL_ASSERT_RETURNVALUE__(this->m_Storage.GetAllocator() != NullPointer, WSTL_MAKE_EXCEPTION(BadAllocation, "Deque storage has no allocator"), false);
+
+            StorageType grown(*this->m_Storage.GetAllocator(), capacity);
+            if(grown.Capacity < capacity) return false;
+
+            for(SizeType i = 0; i < this->m_CurrentSize; ++i) {
+                ValueType& element = this->m_Storage.Data[PhysicalIndex(i)];
+                ::new(static_cast<void*>(grown.Data + i)) ValueType(__WSTL_MOVE__(element));
+                element.~ValueType();
+            }
+
+            this->m_Storage.Swap(grown);
+            m_StartIndex = 0;
+            return true;
+        }
     
     private:
         SizeType m_StartIndex;
 
+        /// @brief Whether the capacity is a power of two known at compile time, wrapping is a mask then
+        static const __WSTL_CONSTEXPR__ bool IsMasked = StorageTraits<Storage>::StaticCapacity != 0 &&
+            (StorageTraits<Storage>::StaticCapacity & (StorageTraits<Storage>::StaticCapacity - 1)) == 0;
+
         /// @brief Converts a logical index to a physical index in the buffer
         /// @param index The logical index
         /// @return The physical index in the buffer
         SizeType PhysicalIndex(SizeType index) const {
+            return PhysicalIndex(index, BoolConstant<IsMasked>());
+        }
+
+        /// @brief Converts a logical index to a physical index, power-of-two capacity version
+        SizeType PhysicalIndex(SizeType index, TrueType) const {
+            return (m_StartIndex + index) & (StorageTraits<Storage>::StaticCapacity - 1);
+        }
+
+        /// @brief Converts a logical index to a physical index, general version
+        SizeType PhysicalIndex(SizeType index, FalseType) const {
             return (m_StartIndex + index) % this->Capacity();
         }
 
+        /// @brief Gets the number of elements from a physical index to the end of its run
+        SizeType RunLength(SizeType physical, SizeType position) const {
+            const SizeType buffer = this->Capacity() - physical;
+            const SizeType remaining = this->m_CurrentSize - position;
+            return buffer < remaining ? buffer : remaining;
+        }
+
         Iterator ToIterator(ConstIterator iterator) {
             return Iterator(this, iterator.m_CurrentIndex);
         }
 
+        /// @brief Moves elements between two places of the buffer, leaving the source slots uninitialized
+        /// @param source Physical index of the first element to move
+        /// @param destination Physical index to move the first element to
+        /// @param count The number of elements to move
+        /// @param forward Whether to move from the first element on, must be `true` when moving towards the front
+        void RelocateElements(SizeType source, SizeType destination, SizeType count, bool forward) {
+            RelocateElements(source, destination, count, forward, BoolConstant<IsTriviallyRelocatable<ValueType>::Value>());
+        }
+
+        /// @brief Moves elements between two places of the buffer, general version: one element at a time
+        void RelocateElements(SizeType source, SizeType destination, SizeType count, bool forward, FalseType) {
+            PointerType data = &this->m_Storage.Data[0];
+            const SizeType capacity = this->Capacity();
+
+            for(SizeType i = 0; i < count; ++i) {
+                const SizeType offset = forward ? i : count - 1 - i;
+                SizeType from = source + offset;
+                SizeType to = destination + offset;
+                if(from >= capacity) from -= capacity;
+                if(to >= capacity) to -= capacity;
+
+                ::new(static_cast<void*>(data + to)) ValueType(__WSTL_MOVE__(data[from]));
+                data[from].~ValueType();
+            }
+        }
+
+        /// @brief Moves elements between two places of the buffer, trivially relocatable version: each side
+        /// wraps around the end of the buffer at most once, so this takes up to three `memmove` calls
+        void RelocateElements(SizeType source, SizeType destination, SizeType count, bool forward, TrueType) {
+            PointerType data = &this->m_Storage.Data[0];
+            const SizeType capacity = this->Capacity();
+
+            if(forward) {
+                while(count > 0) {
+                    const SizeType run = Min(count, Min(capacity - source, capacity - destination));
+                    __private::__Relocate(data + source, run, data + destination, TrueType());
+
+                    source = (source + run == capacity) ? 0 : source + run;
+                    destination = (destination + run == capacity) ? 0 : destination + run;
+                    count -= run;
+                }
+            }
+            else {
+                // Walk back from the ends, which lie in `(0, capacity]`
+                source += count;
+                destination += count;
+                if(source > capacity) source -= capacity;
+                if(destination > capacity) destination -= capacity;
+
+                while(count > 0) {
+                    const SizeType run = Min(count, Min(source, destination));
+                    source -= run;
+                    destination -= run;
+                    count -= run;
+
+                    __private::__Relocate(data + source, run, data + destination, TrueType());
+
+                    if(source == 0) source = capacity;
+                    if(destination == 0) destination = capacity;
+                }
+            }
+        }
+
+        /// @brief Opens a gap of uninitialized slots by moving the shorter side of the deque
+        /// @param index Logical index of the first slot of the gap
+        /// @param count The number of slots in the gap, must not exceed the available space
+        void OpenGap(SizeType index, SizeType count) {
+            if(index <= this->m_CurrentSize - index) {
+                const SizeType start = PhysicalIndex(this->Capacity() - count);
+                RelocateElements(this->m_StartIndex, start, index, true);
+                this->m_StartIndex = start;
+            }
+            else RelocateElements(PhysicalIndex(index), PhysicalIndex(index + count), this->m_CurrentSize - index, false);
+
+            this->m_CurrentSize += count;
+        }
+
+        /// @brief Closes a gap of destroyed elements by moving the shorter side of the deque
+        /// @param index Logical index of the first slot of the gap
+        /// @param count The number of slots in the gap
+        void CloseGap(SizeType index, SizeType count) {
+            const SizeType tail = this->m_CurrentSize - index - count;
+
+            if(index <= tail) {
+                const SizeType start = PhysicalIndex(count);
+                RelocateElements(this->m_StartIndex, start, index, false);
+                this->m_StartIndex = start;
+            }
+            else RelocateElements(PhysicalIndex(index + count), PhysicalIndex(index), tail, true);
+
+            this->m_CurrentSize -= count;
+        }
+
+        /// @brief Constructs elements in a gap opened by `OpenGap`, one bulk copy per side of the wrap
+        /// @param index Logical index of the first slot of the gap
+        /// @param first Iterator to the first element to copy
+        /// @param count The number of elements to copy
+        template<typename InputIterator>
+        void ConstructGap(SizeType index, InputIterator first, SizeType count) {
+            PointerType data = &this->m_Storage.Data[0];
+            const SizeType physical = PhysicalIndex(index);
+            const SizeType run = Min(count, this->Capacity() - physical);
+
+            InputIterator middle = first;
+            Advance(middle, run);
+            UninitializedCopy(first, middle, data + physical);
+
+            InputIterator last = middle;
+            Advance(last, count - run);
+            UninitializedCopy(middle, last, data);
+        }
+
+        /// @brief Fills a gap opened by `OpenGap` with copies of a value, one bulk fill per side of the wrap
+        /// @param index Logical index of the first slot of the gap
+        /// @param count The number of elements to construct
+        /// @param value The value to copy
+        void FillGap(SizeType index, SizeType count, ConstReferenceType value) {
+            PointerType data = &this->m_Storage.Data[0];
+            const SizeType physical = PhysicalIndex(index);
+            const SizeType run = Min(count, this->Capacity() - physical);
+
+            UninitializedFillInRange(data + physical, run, value);
+            UninitializedFillInRange(data, count - run, value);
+        }
+
         /// @brief Initializes the deque, trivial version
         template<typename U>
         typename EnableIf<IsTriviallyDestructible<U>::Value, void>::Type Initialize() {
@@ -1750,7 +2005,7 @@ namespace wstl {
             this->m_CurrentSize += count;
 
             for(SizeType i = 0; i < count; ++i, ++first)
-                ::new(&this->m_Storage.Data[this->m_StartIndex + i]) ValueType(*first);
+                ::new(&this->m_Storage.Data[PhysicalIndex(i)]) ValueType(*first);
         }
 
         /// @brief Creates a default-constructed element at the back of the deque
@@ -1798,7 +2053,7 @@ namespace wstl {
         /// @brief Destroys an element at the front of the deque
         void DestroyFront() {
             this->m_Storage.Data[this->m_StartIndex].~ValueType();
-            this->m_StartIndex = (this->m_StartIndex + 1) % this->Capacity();
+            this->m_StartIndex = PhysicalIndex(1);
             --this->m_CurrentSize;
         }
     };
@@ -1942,13 +2197,13 @@ namespace wstl {
 
     // Make deque
 
-    #ifdef __WSTL_CXX11__
+    #if defined(__WSTL_CXX14__) && !defined(__WSTL_NO_INITIALIZERLIST__)
     /// @brief Makes a deque out of the given values, with specified type
     /// @tparam T Type of the elements
     /// @param ...values Values to make the deque with
     /// @return A deque containing the given values
     /// @ingroup deque
-    /// @since C++11
+    /// @since C++14
     template<typename T, typename First, typename... Rest>
     constexpr auto MakeDeque(First&& first, Rest&&... rest) {
         return Deque<T, sizeof...(rest) + 1>({ Forward<First>(first), Forward<Rest>(rest)... });
@@ -1958,7 +2213,7 @@ namespace wstl {
     /// @param ...values Values to make the deque with
     /// @return A deque containing the given values
     /// @ingroup deque
-    /// @since C++11
+    /// @since C++14
     template<typename First, typename... Rest>
     constexpr auto MakeDeque(First&& first, Rest&&... rest) {
         using T = CommonTypeType<First, Rest...>;
@@ -1991,20 +2246,20 @@ namespace wstl {
             /// @brief Constructor that uses external buffer
             /// @param buffer Pointer to the external buffer
             /// @param capacity Capacity of the external buffer
-            Deque(T* buffer, SizeType capacity) : Base(ExternalStorage(buffer, capacity)) {}
+            Deque(T* buffer, SizeType capacity) : Base(StorageType(buffer, capacity)) {}
 
             /// @brief Copy constructor that uses external buffer
             /// @param other The deque to copy from
             /// @param buffer Pointer to the external buffer
             /// @param capacity Capacity of the external buffer
-            Deque(const Deque& other, T* buffer, SizeType capacity) : Base(other, ExternalStorage(buffer, capacity)) {}
+            Deque(const Deque& other, T* buffer, SizeType capacity) : Base(other, StorageType(buffer, capacity)) {}
 
             #ifdef __WSTL_CXX11__
             /// @brief Move constructor that uses external buffer
             /// @param other The deque to move from
             /// @param buffer Pointer to the external buffer
             /// @param capacity Capacity of the external buffer
-            Deque(Deque&& other, T* buffer, SizeType capacity) : Base(Move(other), ExternalStorage(buffer, capacity)) {}
+            Deque(Deque&& other, T* buffer, SizeType capacity) : Base(Move(other), StorageType(buffer, capacity)) {}
             #endif
 
             /// @brief Constructor that initializes the deque with a range of elements
@@ -2013,20 +2268,20 @@ namespace wstl {
             /// @param buffer Pointer to the external buffer
             /// @param capacity Capacity of the external buffer
             template<typename InputIterator>
-            Deque(InputIterator first, InputIterator last, T* buffer, SizeType capacity) : Base(first, last, ExternalStorage(buffer, capacity)) {}
+            Deque(InputIterator first, InputIterator last, T* buffer, SizeType capacity) : Base(first, last, StorageType(buffer, capacity)) {}
 
             /// @brief Constructor that initializes the deque with a number of copies of a value
             /// @param count The number of elements to create
             /// @param buffer Pointer to the external buffer
             /// @param capacity Capacity of the external buffer
-            explicit Deque(SizeType count, T* buffer, SizeType capacity) : Base(count, ExternalStorage(buffer, capacity)) {}
+            explicit Deque(SizeType count, T* buffer, SizeType capacity) : Base(count, StorageType(buffer, capacity)) {}
 
             /// @brief Constructor that initializes the deque with a number of copies of a value
             /// @param count The number of elements to create
             /// @param value The value to fill the deque with
             /// @param buffer Pointer to the external buffer
             /// @param capacity Capacity of the external buffer
-            Deque(SizeType count, ConstReferenceType value, T* buffer, SizeType capacity) : Base(count, value, ExternalStorage(buffer, capacity)) {}
+            Deque(SizeType count, ConstReferenceType value, T* buffer, SizeType capacity) : Base(count, value, StorageType(buffer, capacity)) {}
 
             #if defined(__WSTL_CXX11__) && !defined(__WSTL_NO_INITIALIZERLIST__)
             /// @brief Constructor that initializes the deque with an initializer list
@@ -2034,7 +2289,7 @@ namespace wstl {
             /// @param buffer Pointer to the external buffer
             /// @param capacity Capacity of the external buffer
             /// @since C++11
-            Deque(InitializerList<ValueType> list, T* buffer, SizeType capacity) : Base(list, ExternalStorage(buffer, capacity)) {}
+            Deque(InitializerList<ValueType> list, T* buffer, SizeType capacity) : Base(list, StorageType(buffer, capacity)) {}
             #endif
 
             /// @brief Copy assignment operator
@@ -2185,9 +2440,117 @@ namespace wstl {
         template<typename T, typename U1, typename U2, size_t N>
         FixedDeque(U1, U2, T(&)[N]) -> FixedDeque<T, N>;
 
+        #ifndef __WSTL_NO_INITIALIZERLIST__
         template<typename T, size_t N>
         FixedDeque(InitializerList<T>, T(&)[N]) -> FixedDeque<T, N>;
         #endif
+        #endif
+    }
+
+    namespace allocated {
+        /// @brief Version of deque that draws its storage from an allocator
+        /// @tparam T Type of the elements
+        /// @details The capacity is chosen at construction and can be raised later with `Reserve`
+        /// @ingroup deque
+        template<typename T>
+        class Deque : public BasicDeque<AllocatorStorage<T> > {
+        private:
+            typedef BasicDeque<AllocatorStorage<T> > Base;
+
+        public:
+            typedef typename Base::ValueType ValueType;
+            typedef typename Base::SizeType SizeType;
+            typedef typename Base::DifferenceType DifferenceType;
+            typedef typename Base::ReferenceType ReferenceType;
+            typedef typename Base::ConstReferenceType ConstReferenceType;
+            typedef typename Base::PointerType PointerType;
+            typedef typename Base::ConstPointerType ConstPointerType;
+
+            typedef typename Base::StorageType StorageType;
+
+            /// @brief Constructor that draws storage from an allocator
+            /// @param allocator The allocator to draw the storage from
+            /// @param capacity Capacity of the deque
+            Deque(Allocator& allocator, SizeType capacity) : Base(StorageType(allocator, capacity)) {}
+
+            /// @brief Copy constructor that draws storage from an allocator
+            /// @param other The deque to copy from
+            /// @param allocator The allocator to draw the storage from
+            /// @param capacity Capacity of the deque
+            Deque(const Deque& other, Allocator& allocator, SizeType capacity) : Base(other, StorageType(allocator, capacity)) {}
+
+            #ifdef __WSTL_CXX11__
+            /// @brief Move constructor that draws storage from an allocator
+            /// @param other The deque to move from
+            /// @param allocator The allocator to draw the storage from
+            /// @param capacity Capacity of the deque
+            Deque(Deque&& other, Allocator& allocator, SizeType capacity) : Base(Move(other), StorageType(allocator, capacity)) {}
+            #endif
+
+            /// @brief Constructor that initializes the deque with a range of elements
+            /// @param first Iterator to the first element in the range
+            /// @param last Iterator to the element following the last element in the range
+            /// @param allocator The allocator to draw the storage from
+            /// @param capacity Capacity of the deque
+            template<typename InputIterator>
+            Deque(InputIterator first, InputIterator last, Allocator& allocator, SizeType capacity, 
+                typename EnableIf<!IsIntegral<InputIterator>::Value, int>::Type = 0) : Base(first, last, StorageType(allocator, capacity)) {}
+
+            /// @brief Constructor that initializes the deque with a number of default-inserted elements
+            /// @param count The number of elements to create
+            /// @param allocator The allocator to draw the storage from
+            /// @param capacity Capacity of the deque
+            Deque(SizeType count, Allocator& allocator, SizeType capacity) : Base(count, StorageType(allocator, capacity)) {}
+
+            /// @brief Constructor that initializes the deque with a number of copies of a value
+            /// @param count The number of elements to create
+            /// @param value The value to fill the deque with
+            /// @param allocator The allocator to draw the storage from
+            /// @param capacity Capacity of the deque
+            Deque(SizeType count, ConstReferenceType value, Allocator& allocator, SizeType capacity) : Base(count, value, StorageType(allocator, capacity)) {}
+
+            #if defined(__WSTL_CXX11__) && !defined(__WSTL_NO_INITIALIZERLIST__)
+            /// @brief Constructor that initializes the deque with an initializer list
+            /// @param list The initializer list to initialize the deque with
+            /// @param allocator The allocator to draw the storage from
+            /// @param capacity Capacity of the deque
+            /// @since C++11
+            Deque(InitializerList<ValueType> list, Allocator& allocator, SizeType capacity) : Base(list, StorageType(allocator, capacity)) {}
+            #endif
+
+            /// @brief Copy assignment operator
+            /// @param other The deque to copy from
+            Deque& operator=(const Deque& other) {
+                if(this != &other) this->Assign(other.Begin(), other.End());
+                return *this;
+            }
+
+            #ifdef __WSTL_CXX11__
+            /// @brief Move assignment operator
+            /// @param other The deque to move from
+            /// @since C++11
+            Deque& operator=(Deque&& other) {
+                if(this != &other) {
+                    this->Clear();
+
+                    typename Base::Iterator it = other.Begin();
+                    for(; it != other.End(); ++it) this->CreateBack(Move(*it));
+                }
+
+                return *this;
+            }
+
+            #ifndef __WSTL_NO_INITIALIZERLIST__
+            /// @brief Assignment operator that assigns from an initializer list
+            /// @param list The initializer list to assign from
+            /// @since C++11
+            Deque& operator=(InitializerList<ValueType> list) {
+                this->Assign(list);
+                return *this;
+            }
+            #endif
+            #endif
+        };
     }
 }
 
@@ -13,6 +13,7 @@
 
 #include "Exception.hpp"
 #include "Functional.hpp"
+#include "InplaceFunction.hpp"
 #include "Utility.hpp"
 #include "private/Error.hpp"
 
@@ -104,6 +105,21 @@ namespace wstl {
             Create<const Object, Instance>(Function);
         }
 
+        #ifdef __WSTL_CXX11__
+        /// @brief Sets a callable that will be called when an exception occurs
+        /// @param callable Callable that takes `const Exception&` as a parameter, such as a capturing
+        /// lambda, stored inline without allocating
+        /// @details Function pointers and function wrappers keep going through the overloads above
+        /// @since C++11
+        template<typename Callable>
+        static typename EnableIf<!IsPointer<typename Decay<Callable>::Type>::Value &&
+            !IsBaseOf<FunctionInterface<void(const Exception&)>, typename Decay<Callable>::Type>::Value>::Type
+        SetCallback(Callable&& callable) {
+            Clear();
+            GetInplaceCallback() = Forward<Callable>(callable);
+        }
+        #endif
+
         // Error
 
         /// @brief Calls the error handler function
@@ -111,9 +127,32 @@ namespace wstl {
         static void Error(const Exception& exception) {
             Function<void(const Exception&)>& function = GetCallback();
             if(function) function(exception);
+
+            #ifdef __WSTL_CXX11__
+            InplaceFunction<void(const Exception&)>& inplaceFunction = GetInplaceCallback();
+            if(inplaceFunction) inplaceFunction(exception);
+            #endif
         }
     
     private:
+        #ifdef __WSTL_CXX11__
+        /// @brief Gets the inline callable
+        /// @return Reference to the inplace function
+        static InplaceFunction<void(const Exception&)>& GetInplaceCallback() {
+            static InplaceFunction<void(const Exception&)> function;
+            return function;
+        }
+        #endif
+
+        /// @brief Clears the callbacks called by `Error`, so only the one set last stays active
+        static void Clear() {
+            GetCallback<>() = Function<void(const Exception&)>();
+
+            #ifdef __WSTL_CXX11__
+            GetInplaceCallback() = NullPointer;
+            #endif
+        }
+
         // Member
 
         /// @brief Gets the callback function
@@ -141,6 +180,7 @@ namespace wstl {
         /// @brief Creates the callback function
         /// @param function Function wrapper class that takes `const Exception&` as a parameter
         static void Create(const Function<void(const Exception&)>& function) {
+            Clear();
             Function<void(const Exception&)>& staticFunction = GetCallback<>();
             staticFunction = function;
         }
@@ -150,6 +190,7 @@ namespace wstl {
         /// @param function Member function wrapper class that takes `const Exception&` as a parameter
         template<typename Object>
         static void Create(const Function<void(const Exception&), Object>& function) {
+            Clear();
             Function<void(const Exception&), Object>& staticFunction = GetCallback<Object>();
             staticFunction = function;
         }
@@ -159,6 +200,7 @@ namespace wstl {
         /// @param function Const member function wrapper class that takes `const Exception&` as a parameter
         template<typename Object>
         static void Create(const Function<void(const Exception&), const Object>& function) {
+            Clear();
             Function<void(const Exception&), const Object>& staticFunction = GetCallback<const Object>();
             staticFunction = function;
         }
@@ -166,6 +208,7 @@ namespace wstl {
         /// @brief Creates the callback function
         /// @param function Function pointer that takes `const Exception&` as a parameter
         static void Create(void(*function)(const Exception&)) {
+            Clear();
             Function<void(const Exception&)>& staticFunction = GetCallback<>();
             staticFunction = function;
         }
@@ -178,6 +221,7 @@ namespace wstl {
         /// @param object Pointer to the object
         template<typename Object>
         static void Create(void(Object::*function)(const Exception&), void* object) {
+            Clear();
             Function<void(const Exception&), Object>& staticFunction = GetCallback<Object>();
             staticFunction = MakePair(static_cast<Object*>(object), function);
         }
@@ -190,6 +234,7 @@ namespace wstl {
         /// @param object Const pointer to the object
         template<typename Object>
         static void Create(void(Object::*function)(const Exception&) const, void* object) {
+            Clear();
             Function<void(const Exception&), const Object>& staticFunction = GetCallback<const Object>();
             staticFunction = MakePair(static_cast<const Object*>(object), function);
         }
@@ -202,6 +247,7 @@ namespace wstl {
         /// @param function Member function pointer that takes `const Exception&` as a parameter
         template<typename Object, Object& Instance>
         static void Create(void(Object::*function)(const Exception&), void*) {
+            Clear();
             Function<void(const Exception&), Object>& staticFunction = GetCallback<Object>();
             staticFunction = MakePair(Instance, function);
         }
@@ -214,6 +260,7 @@ namespace wstl {
         /// @param function Const member function pointer that takes `const Exception&` as a parameter
         template<typename Object, const Object& Instance>
         static void Create(void(Object::*function)(const Exception&) const, void*) {
+            Clear();
             Function<void(const Exception&), const Object>& staticFunction = GetCallback<const Object>();
             staticFunction = MakePair(Instance, function);
         }
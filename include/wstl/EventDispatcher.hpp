@@ -0,0 +1,310 @@
+// Part of WardenSTL - https://github.com/WardenHD/WardenSTL
+// Copyright (c) 2025 Artem Bezruchko (WardenHD)
+//
+// Licensed under the MIT License. See LICENSE file for details.
+
+#ifndef __WSTL_EVENTDISPATCHER_HPP__
+#define __WSTL_EVENTDISPATCHER_HPP__
+
+#include "private/Platform.hpp"
+#include "private/Error.hpp"
+#include "Delegate.hpp"
+#include "Atomic.hpp"
+#include "StandardExceptions.hpp"
+#include "StaticAssert.hpp"
+#include <stddef.h>
+
+
+/// @defgroup event_dispatcher Event dispatcher
+/// @ingroup functional
+/// @brief Broadcasts calls to a fixed number of subscribed delegates
+
+#ifdef __WSTL_CXX11__
+namespace wstl {
+    // Event dispatcher
+
+    /// @brief Broadcasts calls to up to `N` subscribed delegates
+    /// @tparam Signature The signature of the subscribers (`void(const Reading&)`), results are discarded
+    /// @tparam N Maximum number of subscribers
+    /// @details The subscribers are kept in two flat tables and an atomic index tells which one is
+    /// current. `Publish` is lock-free: it registers itself as a reader of the current table and
+    /// calls the delegates in it, so it may run from an interrupt while a task subscribes.
+    /// `Size` and `Contains` register the same way before they look at the table.
+    /// Subscribing copies the current table into the other one, edits the copy and switches the
+    /// index, so a publish in progress keeps the snapshot it started with. Changes are serialized
+    /// by a flag and wait until no publish is still reading the table they are about to edit,
+    /// so they must not be made from a context that preempts a running `Publish`, such as an interrupt
+    /// @ingroup event_dispatcher
+    /// @since C++11
+    template<typename Signature, size_t N>
+    class EventDispatcher;
+
+    template<typename Return, typename... Args, size_t N>
+    class EventDispatcher<Return(Args...), N> {
+    public:
+        WSTL_STATIC_ASSERT(N > 0, "Event dispatcher must have a capacity");
+
+        typedef Delegate<Return(Args...)> DelegateType;
+        typedef size_t SizeType;
+
+        /// @brief Default constructor, creates a dispatcher without subscribers
+        EventDispatcher() : m_Current(0) {
+            m_Tables[0].Size = 0;
+            m_Tables[1].Size = 0;
+        }
+
+        /// @brief Gets the number of subscribers
+        SizeType Size() const {
+            const unsigned char current = BeginRead();
+            const SizeType size = m_Tables[current].Size;
+            EndRead(current);
+
+            return size;
+        }
+
+        /// @brief Gets the maximum number of subscribers
+        __WSTL_CONSTEXPR__ SizeType Capacity() const __WSTL_NOEXCEPT__ {
+            return N;
+        }
+
+        /// @brief Checks if there are no subscribers
+        bool Empty() const {
+            return Size() == 0;
+        }
+
+        /// @brief Checks if no more subscribers fit
+        bool Full() const {
+            return Size() == N;
+        }
+
+        /// @brief Checks if a delegate is subscribed
+        /// @param delegate The delegate to look for
+        bool Contains(const DelegateType& delegate) const {
+            const unsigned char current = BeginRead();
+            const Table& table = m_Tables[current];
+            const bool found = Find(table, delegate) != table.Size;
+            EndRead(current);
+
+            return found;
+        }
+
+        /// @brief Subscribes a delegate
+        /// @param delegate The delegate to call on every publish
+        /// @return `true` if the delegate was added, `false` if it is empty or already subscribed
+        /// @throws `LengthError` if the dispatcher is full
+        bool Subscribe(const DelegateType& delegate) {
+            if(!delegate) return false;
+
+            Lock();
+
+            Table& table = BeginChange();
+            bool added = false;
+
+            if(Find(table, delegate) == table.Size) {
+                if(table.Size == N) {
+                    Unlock();
+                    __WSTL_ASSERT_RETURNVALUE__(false, WSTL_MAKE_EXCEPTION(LengthError, "Event dispatcher full"), false);
+                    return false;
+                }
+
+                table.Delegates[table.Size++] = delegate;
+                added = true;
+            }
+
+            if(added) Commit();
+            Unlock();
+
+            return added;
+        }
+
+        /// @brief Subscribes a function known at compile time, it is called directly from the delegate stub
+        /// @tparam Function The function to call on every publish
+        /// @return `true` if the function was added, `false` if it is already subscribed
+        /// @throws `LengthError` if the dispatcher is full
+        template<Return (*Function)(Args...)>
+        bool Subscribe() {
+            return Subscribe(DelegateType::template Create<Function>());
+        }
+
+        /// @brief Subscribes a member function known at compile time
+        /// @tparam Object Type of the object
+        /// @tparam Method The member function to call on every publish
+        /// @param object The object to call the member function on, must stay alive while subscribed
+        /// @return `true` if the member function was added, `false` if it is already subscribed
+        /// @throws `LengthError` if the dispatcher is full
+        template<typename Object, Return (Object::*Method)(Args...)>
+        bool Subscribe(Object& object) {
+            return Subscribe(DelegateType::template Create<Object, Method>(object));
+        }
+
+        /// @brief Unsubscribes a delegate
+        /// @param delegate The delegate to remove
+        /// @return `true` if the delegate was subscribed
+        /// @details The order of the remaining subscribers is preserved
+        bool Unsubscribe(const DelegateType& delegate) {
+            Lock();
+
+            Table& table = BeginChange();
+            const SizeType index = Find(table, delegate);
+            const bool removed = index != table.Size;
+
+            if(removed) {
+                for(SizeType i = index + 1; i < table.Size; ++i) table.Delegates[i - 1] = table.Delegates[i];
+                --table.Size;
+                Commit();
+            }
+
+            Unlock();
+            return removed;
+        }
+
+        /// @brief Unsubscribes a function known at compile time
+        /// @tparam Function The function to remove
+        /// @return `true` if the function was subscribed
+        template<Return (*Function)(Args...)>
+        bool Unsubscribe() {
+            return Unsubscribe(DelegateType::template Create<Function>());
+        }
+
+        /// @brief Unsubscribes a member function known at compile time
+        /// @tparam Object Type of the object
+        /// @tparam Method The member function to remove
+        /// @param object The object the member function was subscribed with
+        /// @return `true` if the member function was subscribed
+        template<typename Object, Return (Object::*Method)(Args...)>
+        bool Unsubscribe(Object& object) {
+            return Unsubscribe(DelegateType::template Create<Object, Method>(object));
+        }
+
+        /// @brief Unsubscribes all delegates
+        void Clear() {
+            Lock();
+
+            BeginChange().Size = 0;
+            Commit();
+
+            Unlock();
+        }
+
+        /// @brief Calls all subscribers in the order they subscribed
+        /// @param ...args The arguments passed to every subscriber
+        /// @details Lock-free, can be called from an interrupt. Subscribers added or removed during
+        /// the call take effect from the next publish
+        void Publish(Args... args) const {
+            const unsigned char current = BeginRead();
+
+            const Table& table = m_Tables[current];
+            for(SizeType i = 0; i < table.Size; ++i) table.Delegates[i](args...);
+
+            EndRead(current);
+        }
+
+        /// @copydoc Publish
+        void operator()(Args... args) const {
+            Publish(args...);
+        }
+
+    private:
+        struct Table {
+            DelegateType Delegates[N];
+            SizeType Size;
+        };
+
+        Table m_Tables[2];
+        Atomic<unsigned char> m_Current;
+        mutable Atomic<SizeType> m_Readers[2];
+        AtomicFlag m_Writing;
+
+        /// @brief Deleted copy constructor
+        EventDispatcher(const EventDispatcher&) __WSTL_DELETE__;
+
+        /// @brief Deleted copy assignment operator
+        EventDispatcher& operator=(const EventDispatcher&) __WSTL_DELETE__;
+
+        static SizeType Find(const Table& table, const DelegateType& delegate) {
+            SizeType i = 0;
+            while(i < table.Size && table.Delegates[i] != delegate) ++i;
+
+            return i;
+        }
+
+        /// @brief Registers as a reader of the current table, so no change edits it while it is read
+        /// @return The index of the table to read, to be passed to `EndRead`
+        unsigned char BeginRead() const {
+            unsigned char current;
+
+            // Register as a reader, then make sure the table did not change in the meantime
+            for(;;) {
+                current = m_Current.Load();
+                m_Readers[current].FetchAdd(1);
+
+                if(m_Current.Load() == current) break;
+                m_Readers[current].FetchSub(1);
+            }
+
+            return current;
+        }
+
+        /// @brief Ends a read started by `BeginRead`
+        void EndRead(unsigned char current) const {
+            m_Readers[current].FetchSub(1, MEMORY_ORDER_RELEASE);
+        }
+
+        void Lock() {
+            while(m_Writing.TestAndSet(MEMORY_ORDER_ACQUIRE)) {}
+        }
+
+        void Unlock() {
+            m_Writing.Clear(MEMORY_ORDER_RELEASE);
+        }
+
+        /// @brief Waits until the inactive table has no readers and fills it with the current subscribers
+        /// @return The inactive table, to be edited and then made current by `Commit`
+        Table& BeginChange() {
+            const unsigned char current = m_Current.Load(MEMORY_ORDER_RELAXED);
+            Table& next = m_Tables[current ^ 1];
+
+            while(m_Readers[current ^ 1].Load() != 0) {}
+
+            const Table& source = m_Tables[current];
+            for(SizeType i = 0; i < source.Size; ++i) next.Delegates[i] = source.Delegates[i];
+            next.Size = source.Size;
+
+            return next;
+        }
+
+        /// @brief Makes the edited table current
+        void Commit() {
+            m_Current.Store(m_Current.Load(MEMORY_ORDER_RELAXED) ^ 1);
+        }
+    };
+
+    // Static event dispatcher
+
+    /// @brief Broadcasts calls to functions fixed at compile time
+    /// @tparam Signature The signature of the functions (`void(const Reading&)`), results are discarded
+    /// @tparam Functions The functions to call, in order
+    /// @details There is no table and no indirect call, `Publish` calls each function directly,
+    /// so the compiler can inline all of them
+    /// @ingroup event_dispatcher
+    /// @since C++11
+    template<typename Signature, Signature*... Functions>
+    struct StaticEventDispatcher {
+        /// @brief Number of subscribed functions
+        static const __WSTL_CONSTEXPR__ size_t Size = sizeof...(Functions);
+
+        /// @brief Calls all functions in order
+        /// @param ...args The arguments passed to every function
+        template<typename... Args>
+        static void Publish(Args&&... args) {
+            const int calls[] = { 0, (Functions(args...), 0)... };
+            (void) calls;
+        }
+    };
+
+    template<typename Signature, Signature*... Functions>
+    const __WSTL_CONSTEXPR__ size_t StaticEventDispatcher<Signature, Functions...>::Size;
+}
+#endif
+
+#endif
\ No newline at end of file
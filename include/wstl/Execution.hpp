@@ -0,0 +1,546 @@
+// Part of WardenSTL - https://github.com/WardenHD/WardenSTL
+// Copyright (c) 2025 Artem Bezruchko (WardenHD)
+//
+// Licensed under the MIT License. See LICENSE file for details.
+
+#ifndef __WSTL_EXECUTION_HPP__
+#define __WSTL_EXECUTION_HPP__
+
+#include "private/Platform.hpp"
+#include "Algorithm.hpp"
+#include "Numeric.hpp"
+#include "Functional.hpp"
+#include "Iterator.hpp"
+#include "TypeTraits.hpp"
+#include "NullPointer.hpp"
+#include "PlacementNew.hpp"
+
+#ifdef __WSTL_PARALLEL__
+#include "Atomic.hpp"
+#endif
+
+#include <stddef.h>
+
+
+/// @defgroup execution Execution
+/// @ingroup utilities
+/// @brief Execution policies and overloads of algorithms that run on several threads
+
+namespace wstl {
+    // Execution policies
+
+    /// @brief Policy that runs an algorithm on the calling thread
+    /// @ingroup execution
+    /// @see https://en.cppreference.com/w/cpp/algorithm/execution_policy_tag_t
+    struct SequencedPolicy {
+        __WSTL_CONSTEXPR__ SequencedPolicy() {}
+    };
+
+    /// @brief Policy that may split an algorithm into tasks that run on the parallel backend
+    /// @ingroup execution
+    /// @see https://en.cppreference.com/w/cpp/algorithm/execution_policy_tag_t
+    struct ParallelPolicy {
+        __WSTL_CONSTEXPR__ ParallelPolicy() {}
+    };
+
+    /// @brief Policy that may split an algorithm into tasks and vectorize the work inside them
+    /// @ingroup execution
+    /// @see https://en.cppreference.com/w/cpp/algorithm/execution_policy_tag_t
+    struct ParallelUnsequencedPolicy {
+        __WSTL_CONSTEXPR__ ParallelUnsequencedPolicy() {}
+    };
+
+    /// @brief Checks if a type is an execution policy
+    /// @ingroup execution
+    template<typename T>
+    struct IsExecutionPolicy : FalseType {};
+
+    template<>
+    struct IsExecutionPolicy<SequencedPolicy> : TrueType {};
+
+    template<>
+    struct IsExecutionPolicy<ParallelPolicy> : TrueType {};
+
+    template<>
+    struct IsExecutionPolicy<ParallelUnsequencedPolicy> : TrueType {};
+
+    namespace execution {
+        /// @brief Runs an algorithm on the calling thread
+        /// @ingroup execution
+        static const __WSTL_CONSTEXPR__ SequencedPolicy Sequential;
+
+        /// @brief Runs an algorithm on the parallel backend
+        /// @ingroup execution
+        static const __WSTL_CONSTEXPR__ ParallelPolicy Parallel;
+
+        /// @brief Runs an algorithm on the parallel backend, allowing vectorization
+        /// @ingroup execution
+        static const __WSTL_CONSTEXPR__ ParallelUnsequencedPolicy ParallelUnsequenced;
+    }
+
+    // Parallel backend
+
+    /// @brief Interface of the thread pool that parallel policies run on
+    /// @details Algorithms describe their work as indices `[0, count)` and the backend calls a
+    /// task function on subranges of them, possibly from several threads at once. Implement it
+    /// over the threads of the platform, or use `WorkStealingPool`, and install it with
+    /// `SetParallelBackend`. Without a backend, or in freestanding builds where
+    /// `__WSTL_PARALLEL__` is not defined, all policies run sequentially
+    /// @ingroup execution
+    class ParallelBackend {
+    public:
+        /// @brief Function that processes the indices `[begin, end)` of an execution
+        typedef void (*TaskFunction)(void* context, size_t begin, size_t end);
+
+        /// @brief Gets the number of threads that run tasks
+        virtual size_t Concurrency() const = 0;
+
+        /// @brief Calls a task function on subranges that together cover `[0, count)` exactly once
+        /// @param function The task function
+        /// @param context Passed to every call of the function
+        /// @param count Number of indices
+        /// @param grain Subranges are not split below this size
+        /// @details Returns once every call has returned
+        virtual void Execute(TaskFunction function, void* context, size_t count, size_t grain) = 0;
+    };
+
+    namespace __private {
+        inline ParallelBackend*& __ParallelBackendInstance() {
+            static ParallelBackend* backend = NullPointer;
+            return backend;
+        }
+    }
+
+    /// @brief Sets the backend that parallel policies run on
+    /// @param backend The backend, null pointer to run everything sequentially
+    /// @details It is not synchronized with running algorithms, set it before starting any
+    /// @ingroup execution
+    inline void SetParallelBackend(ParallelBackend* backend) {
+        __private::__ParallelBackendInstance() = backend;
+    }
+
+    /// @brief Gets the backend that parallel policies run on, null pointer if none
+    /// @ingroup execution
+    inline ParallelBackend* GetParallelBackend() {
+        return __private::__ParallelBackendInstance();
+    }
+
+    namespace __private {
+        /// @brief Ranges below this size are not split into tasks
+        static const __WSTL_CONSTEXPR__ size_t __PARALLEL_MINIMUM_GRAIN = 2048;
+
+        /// @brief Number of partial results a parallel reduction keeps
+        static const __WSTL_CONSTEXPR__ size_t __PARALLEL_REDUCE_CHUNKS = 64;
+
+        /// @brief Selects the parallel path for a policy and an iterator
+        template<typename Policy, typename Iterator>
+        struct __IsParallelExecution : BoolConstant<
+            #ifdef __WSTL_PARALLEL__
+            !IsSame<typename Decay<Policy>::Type, SequencedPolicy>::Value && IsRandomAccessIterator<Iterator>::Value
+            #else
+            false
+            #endif
+        > {};
+
+        #ifdef __WSTL_PARALLEL__
+        template<typename Function>
+        void __InvokeParallelTask(void* context, size_t begin, size_t end) {
+            (*static_cast<Function*>(context))(begin, end);
+        }
+
+        /// @brief Gets the backend if a range of a size is worth splitting, null pointer otherwise
+        inline ParallelBackend* __ParallelBackendFor(size_t count) {
+            ParallelBackend* const backend = GetParallelBackend();
+            return backend != NullPointer && backend->Concurrency() > 1 && count >= 2 * __PARALLEL_MINIMUM_GRAIN ? backend : NullPointer;
+        }
+
+        /// @brief Calls `function(begin, end)` on subranges of `[0, count)`, on the backend if it is worth it
+        template<typename Function>
+        void __ParallelFor(size_t count, Function function) {
+            ParallelBackend* const backend = __ParallelBackendFor(count);
+
+            if(backend == NullPointer) {
+                function(size_t(0), count);
+                return;
+            }
+
+            // A few tasks per thread keep the load balanced without making tasks too small
+            size_t grain = count / (backend->Concurrency() * 8);
+            if(grain < __PARALLEL_MINIMUM_GRAIN) grain = __PARALLEL_MINIMUM_GRAIN;
+
+            backend->Execute(&__InvokeParallelTask<Function>, &function, count, grain);
+        }
+
+        /// @brief Calls `function(begin, end)` on subranges of `[0, count)` split down to a grain, on the backend if there is one
+        /// @details For indices that each stand for a task already worth running on its own, such as the
+        /// halves of a sort or the chunks of a reduction, which `__PARALLEL_MINIMUM_GRAIN` would keep together
+        template<typename Function>
+        void __ParallelFor(size_t count, size_t grain, Function function) {
+            ParallelBackend* const backend = GetParallelBackend();
+
+            if(backend == NullPointer || backend->Concurrency() < 2) {
+                function(size_t(0), count);
+                return;
+            }
+
+            backend->Execute(&__InvokeParallelTask<Function>, &function, count, grain);
+        }
+
+        template<typename RandomAccessIterator, typename Compare>
+        void __ParallelSort(RandomAccessIterator first, RandomAccessIterator last, size_t depth, Compare& compare) {
+            const size_t count = static_cast<size_t>(last - first);
+
+            if(depth == 0 || __ParallelBackendFor(count) == NullPointer) {
+                Sort(first, last, compare);
+                return;
+            }
+
+            __MoveMedianToFirst(first, first + 1, first + (last - first) / 2, last - 1, compare);
+            const RandomAccessIterator cut = __UnguardedPartition(first + 1, last, first, compare);
+
+            // Both sides are sorted as two tasks, idle workers steal one of them
+            __ParallelFor(2, 1, [&](size_t begin, size_t end) {
+                for(size_t i = begin; i < end; ++i) {
+                    if(i == 0) __ParallelSort(first, cut, depth - 1, compare);
+                    else __ParallelSort(cut, last, depth - 1, compare);
+                }
+            });
+        }
+        #endif
+    }
+
+    // For each
+
+    /// @brief Applies a function to each element in a range according to an execution policy
+    /// @param policy The execution policy
+    /// @param first Iterator to the beginning of the range
+    /// @param last Iterator to the end of the range
+    /// @param function The function to apply, copies of it may run at the same time on different elements
+    /// @details Parallel policies split random access ranges into tasks, other ranges run sequentially
+    /// @ingroup execution
+    /// @see https://en.cppreference.com/w/cpp/algorithm/for_each
+    template<typename Policy, typename ForwardIterator, typename Function>
+    typename EnableIf<IsExecutionPolicy<typename Decay<Policy>::Type>::Value>::Type
+    ForEach(const Policy& policy, ForwardIterator first, ForwardIterator last, Function function) {
+        (void) policy;
+
+        #ifdef __WSTL_PARALLEL__
+        if(__private::__IsParallelExecution<Policy, ForwardIterator>::Value) {
+            __private::__ParallelFor(static_cast<size_t>(Distance(first, last)), [&](size_t begin, size_t end) {
+                ForEach(Next(first, begin), Next(first, end), function);
+            });
+            return;
+        }
+        #endif
+
+        ForEach(first, last, function);
+    }
+
+    // Transform
+
+    /// @brief Applies an operation to each element in a range and stores the results according to an execution policy
+    /// @param policy The execution policy
+    /// @param first Iterator to the beginning of the range
+    /// @param last Iterator to the end of the range
+    /// @param resultFirst Iterator to the beginning of the destination range
+    /// @param operation The unary operation, it may run at the same time on different elements
+    /// @return Iterator past the last stored element
+    /// @details Parallel policies split the work when both ranges are random access, otherwise it runs sequentially
+    /// @ingroup execution
+    /// @see https://en.cppreference.com/w/cpp/algorithm/transform
+    template<typename Policy, typename ForwardIterator, typename OutputIterator, typename UnaryOperation>
+    typename EnableIf<IsExecutionPolicy<typename Decay<Policy>::Type>::Value, OutputIterator>::Type
+    Transform(const Policy& policy, ForwardIterator first, ForwardIterator last, OutputIterator resultFirst, UnaryOperation operation) {
+        (void) policy;
+
+        #ifdef __WSTL_PARALLEL__
+        if(__private::__IsParallelExecution<Policy, ForwardIterator>::Value && IsRandomAccessIterator<OutputIterator>::Value) {
+            const size_t count = static_cast<size_t>(Distance(first, last));
+
+            __private::__ParallelFor(count, [&](size_t begin, size_t end) {
+                Transform(Next(first, begin), Next(first, end), Next(resultFirst, begin), operation);
+            });
+
+            return Next(resultFirst, count);
+        }
+        #endif
+
+        return Transform(first, last, resultFirst, operation);
+    }
+
+    /// @brief Applies an operation to pairs of elements of two ranges and stores the results according to an execution policy
+    /// @param policy The execution policy
+    /// @param first1 Iterator to the beginning of the first range
+    /// @param last1 Iterator to the end of the first range
+    /// @param first2 Iterator to the beginning of the second range
+    /// @param resultFirst Iterator to the beginning of the destination range
+    /// @param operation The binary operation, it may run at the same time on different elements
+    /// @return Iterator past the last stored element
+    /// @details Parallel policies split the work when all ranges are random access, otherwise it runs sequentially
+    /// @ingroup execution
+    /// @see https://en.cppreference.com/w/cpp/algorithm/transform
+    template<typename Policy, typename ForwardIterator1, typename ForwardIterator2, typename OutputIterator, typename BinaryOperation>
+    typename EnableIf<IsExecutionPolicy<typename Decay<Policy>::Type>::Value, OutputIterator>::Type
+    Transform(const Policy& policy, ForwardIterator1 first1, ForwardIterator1 last1, ForwardIterator2 first2,
+        OutputIterator resultFirst, BinaryOperation operation) {
+        (void) policy;
+
+        #ifdef __WSTL_PARALLEL__
+        if(__private::__IsParallelExecution<Policy, ForwardIterator1>::Value && IsRandomAccessIterator<ForwardIterator2>::Value &&
+            IsRandomAccessIterator<OutputIterator>::Value) {
+            const size_t count = static_cast<size_t>(Distance(first1, last1));
+
+            __private::__ParallelFor(count, [&](size_t begin, size_t end) {
+                Transform(Next(first1, begin), Next(first1, end), Next(first2, begin), Next(resultFirst, begin), operation);
+            });
+
+            return Next(resultFirst, count);
+        }
+        #endif
+
+        return Transform(first1, last1, first2, resultFirst, operation);
+    }
+
+    // Reduce
+
+    /// @brief Combines the values in a range with an operation according to an execution policy
+    /// @param policy The execution policy
+    /// @param first Iterator to the beginning of the range
+    /// @param last Iterator to the end of the range
+    /// @param initial Initial value
+    /// @param operation The binary operation, must be associative and commutative, as values are combined in any order
+    /// @return The combined value
+    /// @details Parallel policies reduce parts of random access ranges on the backend and combine the partial results
+    /// @ingroup execution
+    /// @see https://en.cppreference.com/w/cpp/algorithm/reduce
+    template<typename Policy, typename ForwardIterator, typename T, typename BinaryOperation>
+    typename EnableIf<IsExecutionPolicy<typename Decay<Policy>::Type>::Value, T>::Type
+    Reduce(const Policy& policy, ForwardIterator first, ForwardIterator last, T initial, BinaryOperation operation) {
+        (void) policy;
+
+        #ifdef __WSTL_PARALLEL__
+        const size_t count = static_cast<size_t>(Distance(first, last));
+
+        if(__private::__IsParallelExecution<Policy, ForwardIterator>::Value && __private::__ParallelBackendFor(count) != NullPointer) {
+            size_t chunks = count / __private::__PARALLEL_MINIMUM_GRAIN;
+            if(chunks > __private::__PARALLEL_REDUCE_CHUNKS) chunks = __private::__PARALLEL_REDUCE_CHUNKS;
+
+            typename AlignedStorage<sizeof(T) * __private::__PARALLEL_REDUCE_CHUNKS, AlignmentOf<T>::Value>::Type storage;
+            T* const partials = storage.template GetPointer<T>();
+
+            // Every chunk starts from its first element, so the initial value is used exactly once
+            __private::__ParallelFor(chunks, 1, [&](size_t begin, size_t end) {
+                for(size_t i = begin; i < end; ++i) {
+                    const ForwardIterator chunkFirst = Next(first, count * i / chunks);
+                    const ForwardIterator chunkLast = Next(first, count * (i + 1) / chunks);
+
+                    ::new(partials + i) T(Reduce(Next(chunkFirst), chunkLast, T(*chunkFirst), operation));
+                }
+            });
+
+            for(size_t i = 0; i < chunks; ++i) {
+                initial = operation(__WSTL_MOVE__(initial), __WSTL_MOVE__(partials[i]));
+                partials[i].~T();
+            }
+
+            return initial;
+        }
+        #endif
+
+        return Reduce(first, last, initial, operation);
+    }
+
+    /// @brief Sums the values in a range according to an execution policy
+    /// @param policy The execution policy
+    /// @param first Iterator to the beginning of the range
+    /// @param last Iterator to the end of the range
+    /// @param initial Initial value
+    /// @return The sum
+    /// @ingroup execution
+    /// @see https://en.cppreference.com/w/cpp/algorithm/reduce
+    template<typename Policy, typename ForwardIterator, typename T>
+    typename EnableIf<IsExecutionPolicy<typename Decay<Policy>::Type>::Value, T>::Type
+    Reduce(const Policy& policy, ForwardIterator first, ForwardIterator last, T initial) {
+        if(!__private::__IsParallelExecution<Policy, ForwardIterator>::Value) return Reduce(first, last, initial);
+        return Reduce(policy, first, last, initial, Plus<T>());
+    }
+
+    // Accumulate
+
+    /// @brief Accumulates the values in a range according to an execution policy
+    /// @param policy The execution policy
+    /// @param first Iterator to the beginning of the range
+    /// @param last Iterator to the end of the range
+    /// @param initial Initial value
+    /// @param operation The binary operation, must be associative and commutative for parallel policies
+    /// @return The accumulated value
+    /// @details Parallel policies do the same as `Reduce`, the sequential one accumulates from left to right
+    /// @ingroup execution
+    template<typename Policy, typename ForwardIterator, typename T, typename BinaryOperation>
+    typename EnableIf<IsExecutionPolicy<typename Decay<Policy>::Type>::Value, T>::Type
+    Accumulate(const Policy& policy, ForwardIterator first, ForwardIterator last, T initial, BinaryOperation operation) {
+        if(IsSame<typename Decay<Policy>::Type, SequencedPolicy>::Value) return Accumulate(first, last, initial, operation);
+        return Reduce(policy, first, last, initial, operation);
+    }
+
+    /// @brief Sums the values in a range according to an execution policy
+    /// @param policy The execution policy
+    /// @param first Iterator to the beginning of the range
+    /// @param last Iterator to the end of the range
+    /// @param initial Initial value
+    /// @return The sum
+    /// @ingroup execution
+    template<typename Policy, typename ForwardIterator, typename T>
+    typename EnableIf<IsExecutionPolicy<typename Decay<Policy>::Type>::Value, T>::Type
+    Accumulate(const Policy& policy, ForwardIterator first, ForwardIterator last, T initial) {
+        if(IsSame<typename Decay<Policy>::Type, SequencedPolicy>::Value) return Accumulate(first, last, initial);
+        return Reduce(policy, first, last, initial, Plus<T>());
+    }
+
+    // Count
+
+    /// @brief Counts the elements in a range that satisfy a predicate according to an execution policy
+    /// @param policy The execution policy
+    /// @param first Iterator to the beginning of the range
+    /// @param last Iterator to the end of the range
+    /// @param predicate The unary predicate, it may run at the same time on different elements
+    /// @return The number of elements
+    /// @ingroup execution
+    /// @see https://en.cppreference.com/w/cpp/algorithm/count
+    template<typename Policy, typename ForwardIterator, typename UnaryPredicate>
+    typename EnableIf<IsExecutionPolicy<typename Decay<Policy>::Type>::Value, typename IteratorTraits<ForwardIterator>::DifferenceType>::Type
+    CountIf(const Policy& policy, ForwardIterator first, ForwardIterator last, UnaryPredicate predicate) {
+        (void) policy;
+
+        #ifdef __WSTL_PARALLEL__
+        if(__private::__IsParallelExecution<Policy, ForwardIterator>::Value) {
+            typedef typename IteratorTraits<ForwardIterator>::DifferenceType DifferenceType;
+            Atomic<DifferenceType> total(0);
+
+            __private::__ParallelFor(static_cast<size_t>(Distance(first, last)), [&](size_t begin, size_t end) {
+                total.FetchAdd(CountIf(Next(first, begin), Next(first, end), predicate), MEMORY_ORDER_RELAXED);
+            });
+
+            return total.Load(MEMORY_ORDER_RELAXED);
+        }
+        #endif
+
+        return CountIf(first, last, predicate);
+    }
+
+    /// @brief Counts the elements in a range equal to a value according to an execution policy
+    /// @param policy The execution policy
+    /// @param first Iterator to the beginning of the range
+    /// @param last Iterator to the end of the range
+    /// @param value The value to count
+    /// @return The number of elements
+    /// @ingroup execution
+    /// @see https://en.cppreference.com/w/cpp/algorithm/count
+    template<typename Policy, typename ForwardIterator, typename T>
+    typename EnableIf<IsExecutionPolicy<typename Decay<Policy>::Type>::Value, typename IteratorTraits<ForwardIterator>::DifferenceType>::Type
+    Count(const Policy& policy, ForwardIterator first, ForwardIterator last, const T& value) {
+        return CountIf(policy, first, last, [&value](const typename IteratorTraits<ForwardIterator>::ValueType& element) {
+            return element == value;
+        });
+    }
+
+    // Find
+
+    /// @brief Finds the first element in a range that satisfies a predicate according to an execution policy
+    /// @param policy The execution policy
+    /// @param first Iterator to the beginning of the range
+    /// @param last Iterator to the end of the range
+    /// @param predicate The unary predicate, it may run at the same time on different elements
+    /// @return Iterator to the first such element, `last` if there is none
+    /// @details Parallel tasks stop once an element before them has been found
+    /// @ingroup execution
+    /// @see https://en.cppreference.com/w/cpp/algorithm/find
+    template<typename Policy, typename ForwardIterator, typename UnaryPredicate>
+    typename EnableIf<IsExecutionPolicy<typename Decay<Policy>::Type>::Value, ForwardIterator>::Type
+    FindIf(const Policy& policy, ForwardIterator first, ForwardIterator last, UnaryPredicate predicate) {
+        (void) policy;
+
+        #ifdef __WSTL_PARALLEL__
+        if(__private::__IsParallelExecution<Policy, ForwardIterator>::Value) {
+            const size_t count = static_cast<size_t>(Distance(first, last));
+            Atomic<size_t> found(count);
+
+            __private::__ParallelFor(count, [&](size_t begin, size_t end) {
+                for(size_t i = begin; i < end; ++i) {
+                    // Checked in steps so the atomic load does not slow down the loop
+                    if((i - begin) % 256 == 0 && found.Load(MEMORY_ORDER_RELAXED) < i) return;
+                    if(!predicate(*Next(first, i))) continue;
+
+                    size_t current = found.Load(MEMORY_ORDER_RELAXED);
+                    while(i < current && !found.CompareExchangeWeak(current, i, MEMORY_ORDER_RELAXED, MEMORY_ORDER_RELAXED)) {}
+                    return;
+                }
+            });
+
+            return Next(first, found.Load(MEMORY_ORDER_RELAXED));
+        }
+        #endif
+
+        return FindIf(first, last, predicate);
+    }
+
+    /// @brief Finds the first element in a range equal to a value according to an execution policy
+    /// @param policy The execution policy
+    /// @param first Iterator to the beginning of the range
+    /// @param last Iterator to the end of the range
+    /// @param value The value to find
+    /// @return Iterator to the first such element, `last` if there is none
+    /// @ingroup execution
+    /// @see https://en.cppreference.com/w/cpp/algorithm/find
+    template<typename Policy, typename ForwardIterator, typename T>
+    typename EnableIf<IsExecutionPolicy<typename Decay<Policy>::Type>::Value, ForwardIterator>::Type
+    Find(const Policy& policy, ForwardIterator first, ForwardIterator last, const T& value) {
+        return FindIf(policy, first, last, [&value](const typename IteratorTraits<ForwardIterator>::ValueType& element) {
+            return element == value;
+        });
+    }
+
+    // Sort
+
+    /// @brief Sorts a range using a comparator according to an execution policy
+    /// @param policy The execution policy
+    /// @param first Iterator to the beginning of the range
+    /// @param last Iterator to the end of the range
+    /// @param compare Binary comparator to use for sorting
+    /// @details Parallel policies partition the range like `Sort` and sort both sides as separate tasks,
+    /// down to ranges that are too small to split, which are sorted with `Sort`. The depth of splitting
+    /// is limited like that of introsort, so the worst case stays O(n log n)
+    /// @ingroup execution
+    /// @see https://en.cppreference.com/w/cpp/algorithm/sort
+    template<typename Policy, typename RandomAccessIterator, typename Compare>
+    typename EnableIf<IsExecutionPolicy<typename Decay<Policy>::Type>::Value>::Type
+    Sort(const Policy& policy, RandomAccessIterator first, RandomAccessIterator last, Compare compare) {
+        (void) policy;
+
+        #ifdef __WSTL_PARALLEL__
+        if(__private::__IsParallelExecution<Policy, RandomAccessIterator>::Value) {
+            size_t depth = 0;
+            for(size_t n = static_cast<size_t>(Distance(first, last)); n > 1; n >>= 1) depth += 2;
+
+            __private::__ParallelSort(first, last, depth, compare);
+            return;
+        }
+        #endif
+
+        Sort(first, last, compare);
+    }
+
+    /// @brief Sorts a range into ascending order according to an execution policy
+    /// @param policy The execution policy
+    /// @param first Iterator to the beginning of the range
+    /// @param last Iterator to the end of the range
+    /// @ingroup execution
+    /// @see https://en.cppreference.com/w/cpp/algorithm/sort
+    template<typename Policy, typename RandomAccessIterator>
+    typename EnableIf<IsExecutionPolicy<typename Decay<Policy>::Type>::Value>::Type
+    Sort(const Policy& policy, RandomAccessIterator first, RandomAccessIterator last) {
+        Sort(policy, first, last, Less<typename IteratorTraits<RandomAccessIterator>::ValueType>());
+    }
+}
+
+#endif
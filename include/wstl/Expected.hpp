@@ -0,0 +1,327 @@
+// Part of WardenSTL - https://github.com/WardenHD/WardenSTL
+// Copyright (c) 2025 Artem Bezruchko (WardenHD)
+//
+// Licensed under the MIT License. See LICENSE file for details.
+
+#ifndef __WSTL_EXPECTED_HPP__
+#define __WSTL_EXPECTED_HPP__
+
+#include "private/Platform.hpp"
+#include "private/Error.hpp"
+#include "Exception.hpp"
+#include "TypeTraits.hpp"
+#include "Utility.hpp"
+#include "PlacementNew.hpp"
+
+
+/// @defgroup expected Expected
+/// @ingroup utility
+/// @brief Value or error returned inline, for error handling without exceptions
+
+namespace wstl {
+    // Error code
+
+    /// @brief Reason a `Try` operation of a container or an allocator failed
+    /// @ingroup expected
+    enum ErrorCode {
+        ERROR_CODE_NONE = 0,
+        /// @brief The container has no room for another element
+        ERROR_CODE_FULL,
+        /// @brief The container has no element to remove
+        ERROR_CODE_EMPTY,
+        /// @brief An index, position or pointer lies outside of the container
+        ERROR_CODE_OUT_OF_RANGE,
+        /// @brief The allocator has no free block to serve the request
+        ERROR_CODE_OUT_OF_MEMORY,
+        /// @brief The request is larger than anything the allocator can serve
+        ERROR_CODE_TOO_LARGE,
+        /// @brief An argument is invalid, such as an alignment that is not a power of two
+        ERROR_CODE_INVALID_ARGUMENT
+    };
+
+    // Bad expected access exception
+
+    /// @brief Exception thrown when the value of an `Expected` that holds an error is accessed
+    /// @ingroup expected
+    /// @see https://en.cppreference.com/w/cpp/utility/expected/bad_expected_access
+    class BadExpectedAccess __WSTL_FINAL__ : public Exception {
+    public:
+        #ifdef __WSTL_EXCEPTION_LOCATION__
+        /// @brief Constructor
+        /// @param file The name of the source file where the exception occurred
+        /// @param line The line number in the source file where the exception occurred
+        /// @param message The message describing the exception, default is `Bad expected access`
+        BadExpectedAccess(StringType file, NumericType line, StringType message = "Bad expected access") : Exception(file, line, message) {}
+        #else
+        /// @brief Constructor
+        /// @param message The exception message, default is `Bad expected access`
+        BadExpectedAccess(StringType message = "Bad expected access") : Exception(message) {}
+        #endif
+
+        /// @copydoc Exception::Name()
+        virtual StringType Name() const __WSTL_NOEXCEPT__ __WSTL_OVERRIDE__ {
+            return "BadExpectedAccess";
+        }
+    };
+
+    // Unexpected
+
+    /// @brief Error to construct an `Expected` from
+    /// @tparam E Type of the error
+    /// @ingroup expected
+    /// @see https://en.cppreference.com/w/cpp/utility/expected/unexpected
+    template<typename E>
+    class Unexpected {
+    public:
+        typedef E ErrorType;
+
+        /// @brief Constructor
+        /// @param error The error
+        __WSTL_CONSTEXPR__ explicit Unexpected(const E& error) : m_Error(error) {}
+
+        /// @brief Gets the error
+        __WSTL_CONSTEXPR__ const E& Error() const __WSTL_NOEXCEPT__ {
+            return m_Error;
+        }
+
+    private:
+        E m_Error;
+    };
+
+    /// @brief Creates an `Unexpected`, deducing the type of the error
+    /// @param error The error
+    /// @ingroup expected
+    template<typename E>
+    __WSTL_CONSTEXPR__ inline Unexpected<E> MakeUnexpected(const E& error) {
+        return Unexpected<E>(error);
+    }
+
+    // Expected
+
+    /// @brief Holds either a value or the error that prevented producing it
+    /// @tparam T Type of the value
+    /// @tparam E Type of the error, `ErrorCode` by default
+    /// @details Both live in the object itself, so returning one costs no more than returning the
+    /// value and a flag. The `Try` operations of containers and allocators return an `Expected`
+    /// instead of going through the error handler or throwing, which keeps them inlinable and
+    /// gives the reason of a failure even with `__WSTL_EXCEPTIONS__` and `__WSTL_HANDLE_ERRORS__`
+    /// off
+    /// @ingroup expected
+    ///
+    /// @code
+    /// if(Expected<Message*> message = pool.TryCreate()) Send(*message);
+    /// else Log(message.Error());
+    /// @endcode
+    /// @see https://en.cppreference.com/w/cpp/utility/expected
+    template<typename T, typename E = ErrorCode>
+    class Expected {
+    public:
+        typedef T ValueType;
+        typedef E ErrorType;
+
+        /// @brief Constructor from a value
+        /// @param value The value
+        Expected(const T& value) : m_HasValue(true) {
+            ::new(ValueAddress()) T(value);
+        }
+
+        #ifdef __WSTL_CXX11__
+        /// @brief Constructor from a value
+        /// @param value The value to move
+        /// @since C++11
+        Expected(T&& value) : m_HasValue(true) {
+            ::new(ValueAddress()) T(Move(value));
+        }
+        #endif
+
+        /// @brief Constructor from an error
+        /// @param error The error
+        Expected(const Unexpected<E>& error) : m_HasValue(false) {
+            ::new(ErrorAddress()) E(error.Error());
+        }
+
+        /// @brief Copy constructor
+        /// @param other The expected to copy
+        Expected(const Expected& other) : m_HasValue(other.m_HasValue) {
+            if(m_HasValue) ::new(ValueAddress()) T(*other.ValuePointer());
+            else ::new(ErrorAddress()) E(*other.ErrorPointer());
+        }
+
+        #ifdef __WSTL_CXX11__
+        /// @brief Move constructor
+        /// @param other The expected to move
+        /// @since C++11
+        Expected(Expected&& other) : m_HasValue(other.m_HasValue) {
+            if(m_HasValue) ::new(ValueAddress()) T(Move(*other.ValuePointer()));
+            else ::new(ErrorAddress()) E(Move(*other.ErrorPointer()));
+        }
+        #endif
+
+        /// @brief Destructor
+        ~Expected() {
+            Destroy();
+        }
+
+        /// @brief Copy assignment operator
+        /// @param other The expected to copy
+        Expected& operator=(const Expected& other) {
+            if(this != &other) {
+                Destroy();
+                m_HasValue = other.m_HasValue;
+
+                if(m_HasValue) ::new(ValueAddress()) T(*other.ValuePointer());
+                else ::new(ErrorAddress()) E(*other.ErrorPointer());
+            }
+
+            return *this;
+        }
+
+        /// @brief Checks whether a value is held
+        __WSTL_NODISCARD__ bool HasValue() const __WSTL_NOEXCEPT__ {
+            return m_HasValue;
+        }
+
+        #ifdef __WSTL_CXX11__
+        /// @brief Checks whether a value is held
+        /// @since C++11
+        explicit operator bool() const __WSTL_NOEXCEPT__ {
+            return m_HasValue;
+        }
+        #endif
+
+        /// @brief Gets the value with checking
+        /// @throws `BadExpectedAccess` if an error is held
+        __WSTL_NODISCARD__ T& Value() {
+            __WSTL_ASSERT__(m_HasValue, WSTL_MAKE_EXCEPTION(BadExpectedAccess));
+            return *ValuePointer();
+        }
+
+        /// @brief Gets the value with checking
+        /// @throws `BadExpectedAccess` if an error is held
+        __WSTL_NODISCARD__ const T& Value() const {
+            __WSTL_ASSERT__(m_HasValue, WSTL_MAKE_EXCEPTION(BadExpectedAccess));
+            return *ValuePointer();
+        }
+
+        /// @brief Gets the value, or a fallback if an error is held
+        /// @param fallback The value to return if an error is held
+        __WSTL_NODISCARD__ T ValueOr(const T& fallback) const {
+            return m_HasValue ? *ValuePointer() : fallback;
+        }
+
+        /// @brief Gets the error, only valid if no value is held
+        __WSTL_NODISCARD__ const E& Error() const __WSTL_NOEXCEPT__ {
+            return *ErrorPointer();
+        }
+
+        /// @brief Gets the value without checking
+        T& operator*() __WSTL_NOEXCEPT__ {
+            return *ValuePointer();
+        }
+
+        /// @brief Gets the value without checking
+        const T& operator*() const __WSTL_NOEXCEPT__ {
+            return *ValuePointer();
+        }
+
+        /// @brief Accesses members of the value without checking
+        T* operator->() __WSTL_NOEXCEPT__ {
+            return ValuePointer();
+        }
+
+        /// @brief Accesses members of the value without checking
+        const T* operator->() const __WSTL_NOEXCEPT__ {
+            return ValuePointer();
+        }
+
+    private:
+        typename AlignedStorage<(sizeof(T) > sizeof(E) ? sizeof(T) : sizeof(E)),
+            (AlignmentOf<T>::Value > AlignmentOf<E>::Value ? AlignmentOf<T>::Value : AlignmentOf<E>::Value)>::Type m_Storage;
+        bool m_HasValue;
+
+        void* ValueAddress() {
+            return &m_Storage;
+        }
+
+        void* ErrorAddress() {
+            return &m_Storage;
+        }
+
+        T* ValuePointer() {
+            return reinterpret_cast<T*>(&m_Storage);
+        }
+
+        const T* ValuePointer() const {
+            return reinterpret_cast<const T*>(&m_Storage);
+        }
+
+        E* ErrorPointer() {
+            return reinterpret_cast<E*>(&m_Storage);
+        }
+
+        const E* ErrorPointer() const {
+            return reinterpret_cast<const E*>(&m_Storage);
+        }
+
+        void Destroy() {
+            if(m_HasValue) ValuePointer()->~T();
+            else ErrorPointer()->~E();
+        }
+    };
+
+    /// @brief Specialization for operations that produce no value, holds only a possible error
+    /// @tparam E Type of the error
+    /// @ingroup expected
+    template<typename E>
+    class Expected<void, E> {
+    public:
+        typedef void ValueType;
+        typedef E ErrorType;
+
+        /// @brief Default constructor, holds success
+        __WSTL_CONSTEXPR__ Expected() : m_HasValue(true), m_Error() {}
+
+        /// @brief Constructor from an error
+        /// @param error The error
+        __WSTL_CONSTEXPR__ Expected(const Unexpected<E>& error) : m_HasValue(false), m_Error(error.Error()) {}
+
+        /// @brief Checks whether the operation succeeded
+        __WSTL_NODISCARD__ __WSTL_CONSTEXPR__ bool HasValue() const __WSTL_NOEXCEPT__ {
+            return m_HasValue;
+        }
+
+        #ifdef __WSTL_CXX11__
+        /// @brief Checks whether the operation succeeded
+        /// @since C++11
+        __WSTL_CONSTEXPR__ explicit operator bool() const __WSTL_NOEXCEPT__ {
+            return m_HasValue;
+        }
+        #endif
+
+        /// @brief Checks that the operation succeeded
+        /// @throws `BadExpectedAccess` if an error is held
+        void Value() const {
+            __WSTL_ASSERT__(m_HasValue, WSTL_MAKE_EXCEPTION(BadExpectedAccess));
+        }
+
+        /// @brief Gets the error, only valid if the operation failed
+        __WSTL_NODISCARD__ __WSTL_CONSTEXPR__ const E& Error() const __WSTL_NOEXCEPT__ {
+            return m_Error;
+        }
+
+    private:
+        bool m_HasValue;
+        E m_Error;
+    };
+
+    #ifdef __WSTL_CXX11__
+    /// @brief Result of a `Try` operation of a container or an allocator
+    /// @tparam T Type of the value, `void` if there is none
+    /// @ingroup expected
+    /// @since C++11
+    template<typename T>
+    using Result = Expected<T, ErrorCode>;
+    #endif
+}
+
+#endif
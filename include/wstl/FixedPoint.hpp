@@ -0,0 +1,461 @@
+// Part of WardenSTL - https://github.com/WardenHD/WardenSTL
+// Copyright (c) 2025 Artem Bezruchko (WardenHD)
+//
+// Licensed under the MIT License. See LICENSE file for details.
+
+#ifndef __WSTL_FIXEDPOINT_HPP__
+#define __WSTL_FIXEDPOINT_HPP__
+
+#include "private/Platform.hpp"
+#include "TypeTraits.hpp"
+#include "Limits.hpp"
+#include "Math.hpp"
+#include "Bit.hpp"
+#include "StaticAssert.hpp"
+#include <stddef.h>
+#include <stdint.h>
+
+
+/// @defgroup fixed_point Fixed point
+/// @ingroup maths
+/// @brief Fractional numbers stored in integers, for targets without a floating point unit
+
+namespace wstl {
+    namespace __private {
+        /// @brief Integer type that holds products of two values of `T` without overflow
+        template<typename T, bool = (sizeof(T) <= 2)>
+        struct __FixedPointWide {
+            typedef typename Conditional<IsSigned<T>::Value, int32_t, uint32_t>::Type Type;
+        };
+
+        template<typename T>
+        struct __FixedPointWide<T, false> {
+            typedef typename Conditional<IsSigned<T>::Value, int64_t, uint64_t>::Type Type;
+        };
+
+        /// @brief Raw value of a `Ratio` in a fixed point format, rounded to nearest
+        template<typename T, size_t F, typename R>
+        struct __FixedPointRatio {
+        private:
+            static const __WSTL_CONSTEXPR__ intmax_t Scaled = R::Numerator * (intmax_t(1) << F);
+            static const __WSTL_CONSTEXPR__ intmax_t Half = R::Denominator / 2;
+
+        public:
+            static const __WSTL_CONSTEXPR__ intmax_t Value = (Scaled < 0 ? Scaled - Half : Scaled + Half) / R::Denominator;
+
+            WSTL_STATIC_ASSERT(R::Denominator > 0, "Ratio denominator must be positive");
+            WSTL_STATIC_ASSERT(Value >= intmax_t(NumericLimits<T>::Min()) && (Value < 0 || uintmax_t(Value) <= uintmax_t(NumericLimits<T>::Max())),
+                "Ratio is out of the range of the fixed point type");
+        };
+
+        template<typename T, size_t F, typename R>
+        const __WSTL_CONSTEXPR__ intmax_t __FixedPointRatio<T, F, R>::Scaled;
+
+        template<typename T, size_t F, typename R>
+        const __WSTL_CONSTEXPR__ intmax_t __FixedPointRatio<T, F, R>::Half;
+
+        template<typename T, size_t F, typename R>
+        const __WSTL_CONSTEXPR__ intmax_t __FixedPointRatio<T, F, R>::Value;
+
+        template<typename T>
+        __WSTL_CONSTEXPR__ T __FixedPointFromScaled(double scaled) {
+            return scaled != scaled ? T(0) : scaled >= double(NumericLimits<T>::Max()) ? NumericLimits<T>::Max() :
+                scaled <= double(NumericLimits<T>::Min()) ? NumericLimits<T>::Min() : T(scaled < 0 ? scaled - 0.5 : scaled + 0.5);
+        }
+    }
+
+    // Fixed point
+
+    /// @brief Number with a fixed count of fractional bits, stored in an integer (Q format)
+    /// @tparam T Integral type that holds the value, at most 32 bits wide
+    /// @tparam F Number of fractional bits, `FixedPoint<int16_t, 15>` is Q15 and `FixedPoint<int32_t, 16>` is Q16.16
+    /// @details Arithmetic is integer arithmetic: addition and subtraction are one instruction,
+    /// multiplication and division go through a type twice as wide. All operations saturate
+    /// instead of wrapping around, and multiplication and division round to nearest. Division by
+    /// zero saturates towards the sign of the dividend. With `__WSTL_ARM_DSP__` defined, 32-bit
+    /// saturation uses `QADD`, `QSUB` and `SSAT`, and compilers turn the wide products into `SMULL`
+    /// and `SMLAL`. `Reciprocal` and `SquareRoot` use Newton's method on integers, without
+    /// hardware division for the reciprocal.
+    ///
+    /// Values are made from integers, from floating point values, which is constant-folded for
+    /// constants, or at compile time from a `Ratio` with `FromRatio`
+    /// @ingroup fixed_point
+    ///
+    /// @code
+    /// typedef FixedPoint<int16_t, 15> Q15;
+    ///
+    /// const Q15 gain = Q15::FromRatio<Ratio<3, 4> >();
+    /// Q15 output = gain * input + feedback;
+    /// @endcode
+    template<typename T, size_t F>
+    class FixedPoint {
+    public:
+        WSTL_STATIC_ASSERT(IsIntegral<T>::Value && !IsSame<T, bool>::Value, "Fixed point value must be stored in an integral type");
+        WSTL_STATIC_ASSERT(sizeof(T) <= 4, "Fixed point value must be at most 32 bits wide");
+        WSTL_STATIC_ASSERT(F <= size_t(NumericLimits<T>::Digits), "Too many fractional bits for the type");
+
+        typedef T ValueType;
+
+        /// @brief Number of fractional bits
+        static const __WSTL_CONSTEXPR__ size_t FractionalBits = F;
+
+        /// @brief Number of integral bits, without the sign bit
+        static const __WSTL_CONSTEXPR__ size_t IntegralBits = size_t(NumericLimits<T>::Digits) - F;
+
+        /// @brief Default constructor, creates zero
+        __WSTL_CONSTEXPR__ FixedPoint() : m_Value(0) {}
+
+        /// @brief Constructor from an integer, clamps it to the range of the type
+        /// @param value The integer
+        template<typename U>
+        explicit __WSTL_CONSTEXPR14__ FixedPoint(U value, typename EnableIf<IsIntegral<U>::Value, int>::Type = 0)
+            : m_Value(SaturateCast<T>(WideType(SaturateCast<T>(value)) * (WideType(1) << F))) {}
+
+        /// @brief Constructor from a floating point value, rounds it to nearest and clamps it to the range of the type
+        /// @param value The floating point value, NaN gives zero
+        explicit __WSTL_CONSTEXPR__ FixedPoint(double value) : m_Value(__private::__FixedPointFromScaled<T>(value * Scale())) {}
+
+        /// @brief Creates a fixed point value from its representation
+        /// @param raw The stored integer, the value multiplied by two to the power of `F`
+        static __WSTL_CONSTEXPR__ FixedPoint FromRaw(T raw) {
+            return FixedPoint(raw, RawTag());
+        }
+
+        /// @brief Creates a fixed point value from a ratio at compile time
+        /// @tparam R A `Ratio`, rounded to nearest, must be in the range of the type
+        template<typename R>
+        static __WSTL_CONSTEXPR__ FixedPoint FromRatio() {
+            return FromRaw(T(__private::__FixedPointRatio<T, F, R>::Value));
+        }
+
+        /// @brief Gets the stored integer, the value multiplied by two to the power of `F`
+        __WSTL_CONSTEXPR__ T Raw() const {
+            return m_Value;
+        }
+
+        /// @brief Converts to an integer, rounding towards negative infinity
+        __WSTL_CONSTEXPR__ T ToInteger() const {
+            return T(WideType(m_Value) >> F);
+        }
+
+        /// @brief Converts to `float`
+        __WSTL_CONSTEXPR__ float ToFloat() const {
+            return float(ToDouble());
+        }
+
+        /// @brief Converts to `double`
+        __WSTL_CONSTEXPR__ double ToDouble() const {
+            return double(m_Value) / Scale();
+        }
+
+        /// @brief Gets the absolute value, the lowest value of a signed type gives the highest
+        __WSTL_CONSTEXPR14__ FixedPoint Absolute() const {
+            return __private::__IsNegativeInteger(m_Value, IsSigned<T>()) ? -*this : *this;
+        }
+
+        /// @brief Computes one divided by the value
+        /// @return The reciprocal, accurate to about 30 significant bits, saturated if it is out of range
+        /// @details Normalizes the value to [0.5, 1) and refines the linear estimate `48/17 - 32/17 x`
+        /// with three Newton steps `r = r (2 - x r)`, which only multiply
+        __WSTL_CONSTEXPR14__ FixedPoint Reciprocal() const {
+            const bool negative = __private::__IsNegativeInteger(m_Value, IsSigned<T>());
+            const uint32_t magnitude = negative ? uint32_t(0) - uint32_t(m_Value) : uint32_t(m_Value);
+
+            if(magnitude == 0) return FromRaw(NumericLimits<T>::Max());
+
+            // Mantissa in [0.5, 1) as Q0.32 and the reciprocal of it in (1, 2] as Q2.30
+            const int shift = CountLeftZero(magnitude);
+            const uint32_t mantissa = magnitude << shift;
+            uint32_t reciprocal = 3031741621U - uint32_t((uint64_t(2021161081U) * mantissa) >> 32);
+
+            for(int i = 0; i < 3; ++i) {
+                const uint32_t product = uint32_t((uint64_t(mantissa) * reciprocal) >> 32);
+                reciprocal = uint32_t((uint64_t(reciprocal) * ((uint32_t(1) << 31) - product)) >> 30);
+            }
+
+            // The result is the reciprocal times two to the power of 2F + shift - 62
+            const int exponent = int(2 * F) + shift - 62;
+            uint64_t result = 0;
+
+            if(exponent >= 32) result = ~uint64_t(0);
+            else if(exponent >= 0) result = uint64_t(reciprocal) << exponent;
+            else result = (uint64_t(reciprocal) + (uint64_t(1) << (-exponent - 1))) >> -exponent;
+
+            return FromRaw(FromMagnitude(result, negative));
+        }
+
+        /// @brief Computes the square root of the value
+        /// @return The square root rounded to nearest, zero for negative values
+        /// @details Newton's method on the integer square root of the value shifted by `F` more bits,
+        /// starting above the root from its bit length, which takes a few steps
+        __WSTL_CONSTEXPR14__ FixedPoint SquareRoot() const {
+            if(!(m_Value > T(0))) return FixedPoint();
+
+            const uint64_t value = uint64_t(m_Value) << F;
+            uint64_t root = uint64_t(1) << ((65 - CountLeftZero(value)) / 2);
+
+            for(;;) {
+                const uint64_t next = (root + value / root) >> 1;
+                if(next >= root) break;
+
+                root = next;
+            }
+
+            if(value - root * root > root) ++root;
+            return FromRaw(FromMagnitude(root, false));
+        }
+
+        /// @brief Negates the value, saturating
+        __WSTL_CONSTEXPR14__ FixedPoint operator-() const {
+            return FromRaw(SaturatingSubtract(T(0), m_Value));
+        }
+
+        /// @brief Returns the value
+        __WSTL_CONSTEXPR__ FixedPoint operator+() const {
+            return *this;
+        }
+
+        /// @brief Adds a value, saturating
+        __WSTL_CONSTEXPR14__ FixedPoint& operator+=(const FixedPoint& other) {
+            m_Value = SaturatingAdd(m_Value, other.m_Value);
+            return *this;
+        }
+
+        /// @brief Subtracts a value, saturating
+        __WSTL_CONSTEXPR14__ FixedPoint& operator-=(const FixedPoint& other) {
+            m_Value = SaturatingSubtract(m_Value, other.m_Value);
+            return *this;
+        }
+
+        /// @brief Multiplies by a value, rounding to nearest and saturating
+        __WSTL_CONSTEXPR14__ FixedPoint& operator*=(const FixedPoint& other) {
+            WideType product = WideType(m_Value) * WideType(other.m_Value);
+            if(F > 0) product += WideType(1) << (F > 0 ? F - 1 : 0);
+
+            m_Value = SaturateCast<T>(product >> F);
+            return *this;
+        }
+
+        /// @brief Divides by a value, rounding to nearest and saturating
+        __WSTL_CONSTEXPR14__ FixedPoint& operator/=(const FixedPoint& other) {
+            m_Value = Divide(WideType(m_Value) * (WideType(1) << F), WideType(other.m_Value));
+            return *this;
+        }
+
+        /// @brief Multiplies by an integer, saturating
+        template<typename U>
+        __WSTL_CONSTEXPR14__ typename EnableIf<IsIntegral<U>::Value, FixedPoint&>::Type operator*=(U value) {
+            m_Value = SaturateCast<T>(WideType(m_Value) * WideType(SaturateCast<T>(value)));
+            return *this;
+        }
+
+        /// @brief Divides by an integer, rounding to nearest and saturating
+        template<typename U>
+        __WSTL_CONSTEXPR14__ typename EnableIf<IsIntegral<U>::Value, FixedPoint&>::Type operator/=(U value) {
+            // The divisor keeps its full range and sign, only the quotient saturates
+            const bool negative = __private::__IsNegativeInteger(value, IsSigned<U>());
+            const uint64_t magnitude = negative ? uint64_t(0) - uint64_t(value) : uint64_t(value);
+
+            // The dividend is below the range of the wide type, so a larger divisor rounds the quotient to zero
+            if(magnitude > uint64_t(NumericLimits<UnsignedWideType>::Max())) m_Value = T(0);
+            else m_Value = Divide(WideType(m_Value), UnsignedWideType(magnitude), negative);
+
+            return *this;
+        }
+
+    private:
+        typedef typename __private::__FixedPointWide<T>::Type WideType;
+        typedef typename MakeUnsigned<WideType>::Type UnsignedWideType;
+
+        struct RawTag {};
+
+        T m_Value;
+
+        __WSTL_CONSTEXPR__ FixedPoint(T raw, RawTag) : m_Value(raw) {}
+
+        static __WSTL_CONSTEXPR__ double Scale() {
+            return double(uint64_t(1) << F);
+        }
+
+        /// Clamps a magnitude with a sign to the range of `T`
+        static __WSTL_CONSTEXPR14__ T FromMagnitude(uint64_t magnitude, bool negative) {
+            if(!negative) return magnitude > uint64_t(NumericLimits<T>::Max()) ? NumericLimits<T>::Max() : T(magnitude);
+            if(!IsSigned<T>::Value) return T(0);
+
+            // The lowest value of a signed type has a magnitude one above the highest value
+            return magnitude > uint64_t(NumericLimits<T>::Max()) ? NumericLimits<T>::Min() : T(-WideType(magnitude));
+        }
+
+        /// Divides wide integers rounding to nearest, saturating to `T`
+        static __WSTL_CONSTEXPR14__ T Divide(WideType dividend, WideType divisor) {
+            const bool negativeDivisor = __private::__IsNegativeInteger(divisor, IsSigned<WideType>());
+            return Divide(dividend, negativeDivisor ? UnsignedWideType(0) - UnsignedWideType(divisor) : UnsignedWideType(divisor), negativeDivisor);
+        }
+
+        /// Divides a wide integer by a magnitude with a sign rounding to nearest, saturating to `T`
+        static __WSTL_CONSTEXPR14__ T Divide(WideType dividend, UnsignedWideType denominator, bool negativeDivisor) {
+            const bool negativeDividend = __private::__IsNegativeInteger(dividend, IsSigned<WideType>());
+
+            if(denominator == 0) return dividend == 0 ? T(0) : negativeDividend ? NumericLimits<T>::Min() : NumericLimits<T>::Max();
+
+            const UnsignedWideType numerator = negativeDividend ? UnsignedWideType(0) - UnsignedWideType(dividend) : UnsignedWideType(dividend);
+
+            return FromMagnitude(uint64_t((numerator + denominator / 2) / denominator), negativeDividend != negativeDivisor);
+        }
+    };
+
+    template<typename T, size_t F>
+    const __WSTL_CONSTEXPR__ size_t FixedPoint<T, F>::FractionalBits;
+
+    template<typename T, size_t F>
+    const __WSTL_CONSTEXPR__ size_t FixedPoint<T, F>::IntegralBits;
+
+    /// @brief Q15 format, 15 fractional bits in a 16-bit integer, values in [-1, 1)
+    /// @ingroup fixed_point
+    typedef FixedPoint<int16_t, 15> Q15;
+
+    /// @brief Q31 format, 31 fractional bits in a 32-bit integer, values in [-1, 1)
+    /// @ingroup fixed_point
+    typedef FixedPoint<int32_t, 31> Q31;
+
+    /// @brief Q16.16 format, 16 integral and 16 fractional bits in a 32-bit integer
+    /// @ingroup fixed_point
+    typedef FixedPoint<int32_t, 16> Q16_16;
+
+    /// @brief Adds two fixed point values, saturating
+    /// @ingroup fixed_point
+    template<typename T, size_t F>
+    __WSTL_CONSTEXPR14__ FixedPoint<T, F> operator+(FixedPoint<T, F> a, const FixedPoint<T, F>& b) {
+        return a += b;
+    }
+
+    /// @brief Subtracts two fixed point values, saturating
+    /// @ingroup fixed_point
+    template<typename T, size_t F>
+    __WSTL_CONSTEXPR14__ FixedPoint<T, F> operator-(FixedPoint<T, F> a, const FixedPoint<T, F>& b) {
+        return a -= b;
+    }
+
+    /// @brief Multiplies two fixed point values, rounding to nearest and saturating
+    /// @ingroup fixed_point
+    template<typename T, size_t F>
+    __WSTL_CONSTEXPR14__ FixedPoint<T, F> operator*(FixedPoint<T, F> a, const FixedPoint<T, F>& b) {
+        return a *= b;
+    }
+
+    /// @brief Divides two fixed point values, rounding to nearest and saturating
+    /// @ingroup fixed_point
+    template<typename T, size_t F>
+    __WSTL_CONSTEXPR14__ FixedPoint<T, F> operator/(FixedPoint<T, F> a, const FixedPoint<T, F>& b) {
+        return a /= b;
+    }
+
+    /// @brief Multiplies a fixed point value by an integer, saturating
+    /// @ingroup fixed_point
+    template<typename T, size_t F, typename U>
+    __WSTL_CONSTEXPR14__ typename EnableIf<IsIntegral<U>::Value, FixedPoint<T, F> >::Type operator*(FixedPoint<T, F> a, U b) {
+        return a *= b;
+    }
+
+    /// @brief Multiplies an integer by a fixed point value, saturating
+    /// @ingroup fixed_point
+    template<typename T, size_t F, typename U>
+    __WSTL_CONSTEXPR14__ typename EnableIf<IsIntegral<U>::Value, FixedPoint<T, F> >::Type operator*(U a, FixedPoint<T, F> b) {
+        return b *= a;
+    }
+
+    /// @brief Divides a fixed point value by an integer, rounding to nearest and saturating
+    /// @ingroup fixed_point
+    template<typename T, size_t F, typename U>
+    __WSTL_CONSTEXPR14__ typename EnableIf<IsIntegral<U>::Value, FixedPoint<T, F> >::Type operator/(FixedPoint<T, F> a, U b) {
+        return a /= b;
+    }
+
+    /// @brief Checks if two fixed point values are equal
+    /// @ingroup fixed_point
+    template<typename T, size_t F>
+    __WSTL_CONSTEXPR__ bool operator==(const FixedPoint<T, F>& a, const FixedPoint<T, F>& b) {
+        return a.Raw() == b.Raw();
+    }
+
+    /// @brief Checks if two fixed point values are not equal
+    /// @ingroup fixed_point
+    template<typename T, size_t F>
+    __WSTL_CONSTEXPR__ bool operator!=(const FixedPoint<T, F>& a, const FixedPoint<T, F>& b) {
+        return a.Raw() != b.Raw();
+    }
+
+    /// @brief Checks if a fixed point value is less than another
+    /// @ingroup fixed_point
+    template<typename T, size_t F>
+    __WSTL_CONSTEXPR__ bool operator<(const FixedPoint<T, F>& a, const FixedPoint<T, F>& b) {
+        return a.Raw() < b.Raw();
+    }
+
+    /// @brief Checks if a fixed point value is less than or equal to another
+    /// @ingroup fixed_point
+    template<typename T, size_t F>
+    __WSTL_CONSTEXPR__ bool operator<=(const FixedPoint<T, F>& a, const FixedPoint<T, F>& b) {
+        return a.Raw() <= b.Raw();
+    }
+
+    /// @brief Checks if a fixed point value is greater than another
+    /// @ingroup fixed_point
+    template<typename T, size_t F>
+    __WSTL_CONSTEXPR__ bool operator>(const FixedPoint<T, F>& a, const FixedPoint<T, F>& b) {
+        return a.Raw() > b.Raw();
+    }
+
+    /// @brief Checks if a fixed point value is greater than or equal to another
+    /// @ingroup fixed_point
+    template<typename T, size_t F>
+    __WSTL_CONSTEXPR__ bool operator>=(const FixedPoint<T, F>& a, const FixedPoint<T, F>& b) {
+        return a.Raw() >= b.Raw();
+    }
+
+    // Fixed point limits
+
+    /// @brief Limits of a fixed point type, which follow those of floating point types:
+    /// `Min` is the smallest positive value and `Lowest` the most negative one
+    /// @ingroup fixed_point
+    template<typename T, size_t F>
+    class NumericLimits<FixedPoint<T, F> > : public __private::__IntegralLimitsCommon<> {
+    public:
+        static const __WSTL_CONSTEXPR__ bool IsInteger = false;
+        static const __WSTL_CONSTEXPR__ bool IsSigned = NumericLimits<T>::IsSigned;
+        static const __WSTL_CONSTEXPR__ bool IsModulo = false;
+        static const __WSTL_CONSTEXPR__ int Digits = NumericLimits<T>::Digits;
+        static const __WSTL_CONSTEXPR__ int Digits10 = __WSTL_LOG10_2__(Digits);
+        static const __WSTL_CONSTEXPR__ FloatRoundStyle RoundStyle = ROUND_TO_NEAREST;
+
+        static __WSTL_CONSTEXPR__ FixedPoint<T, F> Min() __WSTL_NOEXCEPT__ { return FixedPoint<T, F>::FromRaw(T(1)); }
+        static __WSTL_CONSTEXPR__ FixedPoint<T, F> Max() __WSTL_NOEXCEPT__ { return FixedPoint<T, F>::FromRaw(NumericLimits<T>::Max()); }
+        static __WSTL_CONSTEXPR__ FixedPoint<T, F> Lowest() __WSTL_NOEXCEPT__ { return FixedPoint<T, F>::FromRaw(NumericLimits<T>::Min()); }
+        static __WSTL_CONSTEXPR__ FixedPoint<T, F> Epsilon() __WSTL_NOEXCEPT__ { return FixedPoint<T, F>::FromRaw(T(1)); }
+        static __WSTL_CONSTEXPR__ FixedPoint<T, F> RoundError() __WSTL_NOEXCEPT__ { return FixedPoint<T, F>::FromRaw(F > 0 ? T(uint64_t(1) << (F > 0 ? F - 1 : 0)) : T(0)); }
+        static __WSTL_CONSTEXPR__ FixedPoint<T, F> Infinity() __WSTL_NOEXCEPT__ { return FixedPoint<T, F>(); }
+        static __WSTL_CONSTEXPR__ FixedPoint<T, F> QuietNaN() __WSTL_NOEXCEPT__ { return FixedPoint<T, F>(); }
+        static __WSTL_CONSTEXPR__ FixedPoint<T, F> SignalingNaN() __WSTL_NOEXCEPT__ { return FixedPoint<T, F>(); }
+        static __WSTL_CONSTEXPR__ FixedPoint<T, F> DenormalizedMin() __WSTL_NOEXCEPT__ { return FixedPoint<T, F>::FromRaw(T(1)); }
+    };
+
+    template<typename T, size_t F>
+    const __WSTL_CONSTEXPR__ bool NumericLimits<FixedPoint<T, F> >::IsInteger;
+
+    template<typename T, size_t F>
+    const __WSTL_CONSTEXPR__ bool NumericLimits<FixedPoint<T, F> >::IsSigned;
+
+    template<typename T, size_t F>
+    const __WSTL_CONSTEXPR__ bool NumericLimits<FixedPoint<T, F> >::IsModulo;
+
+    template<typename T, size_t F>
+    const __WSTL_CONSTEXPR__ int NumericLimits<FixedPoint<T, F> >::Digits;
+
+    template<typename T, size_t F>
+    const __WSTL_CONSTEXPR__ int NumericLimits<FixedPoint<T, F> >::Digits10;
+
+    template<typename T, size_t F>
+    const __WSTL_CONSTEXPR__ FloatRoundStyle NumericLimits<FixedPoint<T, F> >::RoundStyle;
+}
+
+#endif
@@ -0,0 +1,485 @@
+// Part of WardenSTL - https://github.com/WardenHD/WardenSTL
+// Copyright (c) 2025 Artem Bezruchko (WardenHD)
+//
+// Licensed under the MIT License. See LICENSE file for details.
+
+#ifndef __WSTL_FLATMAP_HPP__
+#define __WSTL_FLATMAP_HPP__
+
+#include "private/Platform.hpp"
+#include "private/FlatTable.hpp"
+#include "Container.hpp"
+#include "Functional.hpp"
+#include "InitializerList.hpp"
+#include "StandardExceptions.hpp"
+#include "Utility.hpp"
+
+
+/// @defgroup flat_map Flat map
+/// @ingroup containers
+/// @brief Sorted associative container in contiguous memory
+
+namespace wstl {
+    // Basic flat map
+
+    /// @brief Associative container of unique keys and mapped values, stored in one array ordered by key
+    /// @tparam Key Type of the keys
+    /// @tparam T Type of the mapped values
+    /// @tparam Storage Storage of `SlotType` used by the map
+    /// @tparam Compare Ordering of the keys
+    /// @tparam Layout Order of the elements in memory, see `FlatLayout`
+    /// @details Elements are `Pair<Key, T>` without any per-element overhead, lookups are binary
+    /// searches. Inserting a range sorts it once and merges it into the map, which is how tables
+    /// filled at startup should be built. Keys must not be changed through iterators. Insertion
+    /// and erasure invalidate all iterators. With `FlatLayout::Eytzinger` lookups are faster on
+    /// large maps, but every single insertion or erasure costs O(n log n)
+    /// @ingroup flat_map
+    template<typename Key, typename T, typename Storage, typename Compare = Less<Key>, FlatLayout Layout = FlatLayout::Sorted>
+    class BasicFlatMap : public __private::__FlatTable<__private::__FlatMapTraits<Key, T>, Storage, Compare, Layout> {
+    private:
+        typedef __private::__FlatTable<__private::__FlatMapTraits<Key, T>, Storage, Compare, Layout> Base;
+        typedef typename Base::Probe Probe;
+
+    public:
+        WSTL_STATIC_ASSERT(!IsVoid<Storage>::Value, "Storage must be non-void");
+
+        typedef typename Base::KeyType KeyType;
+        typedef T MappedType;
+        typedef typename Base::ValueType ValueType;
+        typedef typename Base::SizeType SizeType;
+        typedef typename Base::DifferenceType DifferenceType;
+        typedef typename Base::ReferenceType ReferenceType;
+        typedef typename Base::ConstReferenceType ConstReferenceType;
+        typedef typename Base::PointerType PointerType;
+        typedef typename Base::ConstPointerType ConstPointerType;
+
+        typedef typename Base::StorageType StorageType;
+        typedef typename Base::SlotType SlotType;
+        typedef typename Base::KeyCompareType KeyCompareType;
+
+        typedef typename Base::Iterator Iterator;
+        typedef typename Base::ConstIterator ConstIterator;
+
+        /// @brief Copy assignment operator
+        /// @param other The map to copy from
+        /// @throws `LengthError` if the map's capacity is exceeded
+        BasicFlatMap& operator=(const BasicFlatMap& other) {
+            if(this != &other) {
+                this->Clear();
+                this->Insert(other.Begin(), other.End());
+            }
+
+            return *this;
+        }
+
+        #ifdef __WSTL_CXX11__
+        /// @brief Move assignment operator
+        /// @param other The map to move from
+        /// @throws `LengthError` if the map's capacity is exceeded
+        /// @since C++11
+        BasicFlatMap& operator=(BasicFlatMap&& other) {
+            if(this != &other) {
+                this->Clear();
+                this->Insert(MakeMoveIterator(other.Begin()), MakeMoveIterator(other.End()));
+            }
+
+            return *this;
+        }
+        #endif
+
+        using Base::Insert;
+
+        /// @brief Gets the value mapped to a key
+        /// @param key The key to search for
+        /// @throws `OutOfRange` if the key is not in the map
+        MappedType& At(const KeyType& key) {
+            const SizeType index = this->FindIndex(key);
+            __WSTL_ASSERT__(index != this->Size(), WSTL_MAKE_EXCEPTION(OutOfRange, "FlatMap key not found"));
+            return this->Data()[index].Second;
+        }
+
+        /// @brief Gets the value mapped to a key
+        /// @param key The key to search for
+        /// @throws `OutOfRange` if the key is not in the map
+        const MappedType& At(const KeyType& key) const {
+            const SizeType index = this->FindIndex(key);
+            __WSTL_ASSERT__(index != this->Size(), WSTL_MAKE_EXCEPTION(OutOfRange, "FlatMap key not found"));
+            return this->Data()[index].Second;
+        }
+
+        /// @brief Gets the value mapped to a key, inserting a default-constructed value if the key is not in the map
+        /// @param key The key to search for
+        /// @throws `LengthError` if the key is not in the map and the map is full
+        MappedType& operator[](const KeyType& key) {
+            return TryEmplace(key).First->Second;
+        }
+
+        /// @brief Inserts an element, or assigns to the mapped value if the key is already in the map
+        /// @param key The key of the element
+        /// @param value The value to map to the key
+        /// @return Pair of iterator to the element with the key and whether the element was inserted
+        /// @throws `LengthError` if the map is full
+        Pair<Iterator, bool> InsertOrAssign(const KeyType& key, const MappedType& value) {
+            const Probe probe = this->Prepare(key);
+
+            if(probe.Found) {
+                this->Data()[probe.Index].Second = value;
+                return Pair<Iterator, bool>(this->IteratorAt(probe.Index), false);
+            }
+
+            ValueType element(key, value);
+            return this->PlaceAt(probe, element);
+        }
+
+        #ifdef __WSTL_CXX11__
+        /// @brief Inserts an element, or assigns to the mapped value if the key is already in the map
+        /// @param key The key of the element
+        /// @param value The value to map to the key (rvalue reference)
+        /// @return Pair of iterator to the element with the key and whether the element was inserted
+        /// @throws `LengthError` if the map is full
+        /// @since C++11
+        Pair<Iterator, bool> InsertOrAssign(const KeyType& key, MappedType&& value) {
+            const Probe probe = this->Prepare(key);
+
+            if(probe.Found) {
+                this->Data()[probe.Index].Second = Move(value);
+                return Pair<Iterator, bool>(this->IteratorAt(probe.Index), false);
+            }
+
+            ValueType element(key, Move(value));
+            return this->PlaceAt(probe, element);
+        }
+
+        /// @brief Constructs an element in place if its key is not in the map
+        /// @param ...args The arguments to forward to the constructor of the element
+        /// @return Pair of iterator to the element with the key and whether the element was inserted
+        /// @throws `LengthError` if the map is full
+        /// @details The element is constructed before the lookup, use `TryEmplace` to avoid that
+        /// @since C++11
+        template<typename... Args>
+        Pair<Iterator, bool> Emplace(Args&&... args) {
+            return Insert(ValueType(Forward<Args>(args)...));
+        }
+
+        /// @brief Constructs the mapped value in place if the key is not in the map
+        /// @param key The key of the element
+        /// @param ...args The arguments to forward to the constructor of the mapped value
+        /// @return Pair of iterator to the element with the key and whether the element was inserted
+        /// @throws `LengthError` if the map is full
+        /// @since C++11
+        template<typename... Args>
+        Pair<Iterator, bool> TryEmplace(const KeyType& key, Args&&... args) {
+            const Probe probe = this->Prepare(key);
+            if(probe.Found) return Pair<Iterator, bool>(this->IteratorAt(probe.Index), false);
+
+            ValueType element(key, MappedType(Forward<Args>(args)...));
+            return this->PlaceAt(probe, element);
+        }
+
+        #else
+        /// @brief Constructs an element in place if its key is not in the map
+        /// @param key The key of the element
+        /// @param value The value to map to the key
+        /// @return Pair of iterator to the element with the key and whether the element was inserted
+        /// @throws `LengthError` if the map is full
+        template<typename K, typename V>
+        Pair<Iterator, bool> Emplace(const K& key, const V& value) {
+            return Insert(ValueType(key, value));
+        }
+
+        /// @brief Constructs a default mapped value in place if the key is not in the map
+        /// @param key The key of the element
+        /// @return Pair of iterator to the element with the key and whether the element was inserted
+        /// @throws `LengthError` if the map is full
+        Pair<Iterator, bool> TryEmplace(const KeyType& key) {
+            return TryEmplace(key, MappedType());
+        }
+
+        /// @brief Constructs the mapped value in place if the key is not in the map
+        /// @param key The key of the element
+        /// @param arg The argument to pass to the constructor of the mapped value
+        /// @return Pair of iterator to the element with the key and whether the element was inserted
+        /// @throws `LengthError` if the map is full
+        template<typename Arg>
+        Pair<Iterator, bool> TryEmplace(const KeyType& key, const Arg& arg) {
+            const Probe probe = this->Prepare(key);
+            if(probe.Found) return Pair<Iterator, bool>(this->IteratorAt(probe.Index), false);
+
+            ValueType element(key, MappedType(arg));
+            return this->PlaceAt(probe, element);
+        }
+        #endif
+
+    protected:
+        /// @brief Constructor, only for default-constructible storage
+        /// @param compare Key comparison functor
+        explicit BasicFlatMap(const KeyCompareType& compare) : Base(compare) {}
+
+        /// @brief Constructor with custom storage, only for non-default-constructible storage
+        /// @param storage Storage for the slots
+        /// @param compare Key comparison functor
+        BasicFlatMap(const StorageType& storage, const KeyCompareType& compare) : Base(storage, compare) {}
+    };
+
+    // Comparison operators
+
+    template<typename Key, typename T, typename Storage, typename Compare, FlatLayout Layout>
+    inline bool operator==(const BasicFlatMap<Key, T, Storage, Compare, Layout>& a, const BasicFlatMap<Key, T, Storage, Compare, Layout>& b) {
+        if(a.Size() != b.Size()) return false;
+
+        typedef typename BasicFlatMap<Key, T, Storage, Compare, Layout>::ConstIterator ConstIterator;
+
+        for(ConstIterator first = a.Begin(), second = b.Begin(); first != a.End(); ++first, ++second)
+            if(!(first->First == second->First) || !(first->Second == second->Second)) return false;
+
+        return true;
+    }
+
+    template<typename Key, typename T, typename Storage, typename Compare, FlatLayout Layout>
+    inline bool operator!=(const BasicFlatMap<Key, T, Storage, Compare, Layout>& a, const BasicFlatMap<Key, T, Storage, Compare, Layout>& b) {
+        return !(a == b);
+    }
+
+    // Flat map
+
+    /// @brief Version of flat map with fixed storage, default option
+    /// @tparam Key Type of the keys
+    /// @tparam T Type of the mapped values
+    /// @tparam N Maximum number of elements
+    /// @tparam Compare Ordering of the keys
+    /// @tparam Layout Order of the elements in memory, see `FlatLayout`
+    /// @ingroup flat_map
+    template<typename Key, typename T, size_t N, typename Compare = Less<Key>, FlatLayout Layout = FlatLayout::Sorted>
+    class FlatMap : public BasicFlatMap<Key, T, FixedStorage<__private::__FlatSlot<Pair<Key, T> >, N>, Compare, Layout> {
+    private:
+        typedef BasicFlatMap<Key, T, FixedStorage<__private::__FlatSlot<Pair<Key, T> >, N>, Compare, Layout> Base;
+
+    public:
+        typedef typename Base::KeyType KeyType;
+        typedef typename Base::MappedType MappedType;
+        typedef typename Base::ValueType ValueType;
+        typedef typename Base::SizeType SizeType;
+        typedef typename Base::DifferenceType DifferenceType;
+        typedef typename Base::ReferenceType ReferenceType;
+        typedef typename Base::ConstReferenceType ConstReferenceType;
+        typedef typename Base::PointerType PointerType;
+        typedef typename Base::ConstPointerType ConstPointerType;
+
+        typedef typename Base::StorageType StorageType;
+        typedef typename Base::KeyCompareType KeyCompareType;
+
+        /// @brief The static size, needed for metaprogramming
+        static const __WSTL_CONSTEXPR__ SizeType StaticSize = N;
+
+        /// @brief Default constructor
+        /// @param compare Key comparison functor
+        explicit FlatMap(const KeyCompareType& compare = KeyCompareType()) : Base(compare) {}
+
+        /// @brief Copy constructor
+        /// @param other The map to copy from
+        FlatMap(const FlatMap& other) : Base(other.KeyComp()) {
+            this->Insert(other.Begin(), other.End());
+        }
+
+        #ifdef __WSTL_CXX11__
+        /// @brief Move constructor
+        /// @param other The map to move from
+        /// @since C++11
+        FlatMap(FlatMap&& other) : Base(other.KeyComp()) {
+            this->Insert(MakeMoveIterator(other.Begin()), MakeMoveIterator(other.End()));
+        }
+        #endif
+
+        /// @brief Constructor that initializes the map with a range of elements
+        /// @param first Iterator to the first element in the range
+        /// @param last Iterator to the element following the last element in the range
+        /// @param compare Key comparison functor
+        /// @throws `LengthError` if the map's capacity is exceeded
+        template<typename InputIterator>
+        FlatMap(InputIterator first, InputIterator last, const KeyCompareType& compare = KeyCompareType()) : Base(compare) {
+            this->Insert(first, last);
+        }
+
+        #if defined(__WSTL_CXX11__) && !defined(__WSTL_NO_INITIALIZERLIST__)
+        /// @brief Constructor that initializes the map with an initializer list
+        /// @param list The initializer list to initialize the map with
+        /// @param compare Key comparison functor
+        /// @throws `LengthError` if the map's capacity is exceeded
+        /// @since C++11
+        FlatMap(InitializerList<ValueType> list, const KeyCompareType& compare = KeyCompareType()) : Base(compare) {
+            this->Insert(list.Begin(), list.End());
+        }
+        #endif
+
+        /// @brief Copy assignment operator
+        /// @param other The map to copy from
+        FlatMap& operator=(const FlatMap& other) {
+            Base::operator=(other);
+            return *this;
+        }
+
+        #ifdef __WSTL_CXX11__
+        /// @brief Move assignment operator
+        /// @param other The map to move from
+        /// @since C++11
+        FlatMap& operator=(FlatMap&& other) {
+            Base::operator=(Move(other));
+            return *this;
+        }
+        #endif
+    };
+
+    template<typename Key, typename T, size_t N, typename Compare, FlatLayout Layout>
+    const __WSTL_CONSTEXPR__ typename FlatMap<Key, T, N, Compare, Layout>::SizeType FlatMap<Key, T, N, Compare, Layout>::StaticSize;
+
+    namespace external {
+        /// @brief Version of flat map that uses external storage
+        /// @tparam Key Type of the keys
+        /// @tparam T Type of the mapped values
+        /// @tparam Compare Ordering of the keys
+        /// @tparam Layout Order of the elements in memory, see `FlatLayout`
+        /// @details The slots are an array of `SlotType` of `capacity` elements
+        /// @ingroup flat_map
+        template<typename Key, typename T, typename Compare = Less<Key>, FlatLayout Layout = FlatLayout::Sorted>
+        class FlatMap : public BasicFlatMap<Key, T, ExternalStorage<__private::__FlatSlot<Pair<Key, T> > >, Compare, Layout> {
+        private:
+            typedef BasicFlatMap<Key, T, ExternalStorage<__private::__FlatSlot<Pair<Key, T> > >, Compare, Layout> Base;
+
+        public:
+            typedef typename Base::KeyType KeyType;
+            typedef typename Base::MappedType MappedType;
+            typedef typename Base::ValueType ValueType;
+            typedef typename Base::SizeType SizeType;
+            typedef typename Base::DifferenceType DifferenceType;
+            typedef typename Base::ReferenceType ReferenceType;
+            typedef typename Base::ConstReferenceType ConstReferenceType;
+            typedef typename Base::PointerType PointerType;
+            typedef typename Base::ConstPointerType ConstPointerType;
+
+            typedef typename Base::StorageType StorageType;
+            typedef typename Base::SlotType SlotType;
+            typedef typename Base::KeyCompareType KeyCompareType;
+
+            /// @brief Constructor that uses external buffer
+            /// @param slots Pointer to the external slots
+            /// @param capacity Number of slots
+            /// @param compare Key comparison functor
+            FlatMap(SlotType* slots, SizeType capacity, const KeyCompareType& compare = KeyCompareType()) :
+                Base(StorageType(slots, capacity), compare) {}
+
+            /// @brief Copy constructor that uses external buffer
+            /// @param other The map to copy from
+            /// @param slots Pointer to the external slots
+            /// @param capacity Number of slots
+            /// @throws `LengthError` if the map's capacity is exceeded
+            FlatMap(const FlatMap& other, SlotType* slots, SizeType capacity) : Base(StorageType(slots, capacity), other.KeyComp()) {
+                this->Insert(other.Begin(), other.End());
+            }
+
+            #ifdef __WSTL_CXX11__
+            /// @brief Move constructor that uses external buffer
+            /// @param other The map to move from
+            /// @param slots Pointer to the external slots
+            /// @param capacity Number of slots
+            /// @throws `LengthError` if the map's capacity is exceeded
+            /// @since C++11
+            FlatMap(FlatMap&& other, SlotType* slots, SizeType capacity) : Base(StorageType(slots, capacity), other.KeyComp()) {
+                this->Insert(MakeMoveIterator(other.Begin()), MakeMoveIterator(other.End()));
+            }
+            #endif
+
+            /// @brief Copy assignment operator
+            /// @param other The map to copy from
+            FlatMap& operator=(const FlatMap& other) {
+                Base::operator=(other);
+                return *this;
+            }
+
+            #ifdef __WSTL_CXX11__
+            /// @brief Move assignment operator
+            /// @param other The map to move from
+            /// @since C++11
+            FlatMap& operator=(FlatMap&& other) {
+                Base::operator=(Move(other));
+                return *this;
+            }
+            #endif
+        };
+
+        /// @brief Version of flat map that uses fixed external storage with compile-time known capacity
+        /// @tparam Key Type of the keys
+        /// @tparam T Type of the mapped values
+        /// @tparam N Maximum number of elements
+        /// @tparam Compare Ordering of the keys
+        /// @tparam Layout Order of the elements in memory, see `FlatLayout`
+        /// @details The slots are an array of `SlotType` of `N` elements
+        /// @ingroup flat_map
+        template<typename Key, typename T, size_t N, typename Compare = Less<Key>, FlatLayout Layout = FlatLayout::Sorted>
+        class FixedFlatMap : public BasicFlatMap<Key, T, FixedExternalStorage<__private::__FlatSlot<Pair<Key, T> >, N>, Compare, Layout> {
+        private:
+            typedef BasicFlatMap<Key, T, FixedExternalStorage<__private::__FlatSlot<Pair<Key, T> >, N>, Compare, Layout> Base;
+
+        public:
+            typedef typename Base::KeyType KeyType;
+            typedef typename Base::MappedType MappedType;
+            typedef typename Base::ValueType ValueType;
+            typedef typename Base::SizeType SizeType;
+            typedef typename Base::DifferenceType DifferenceType;
+            typedef typename Base::ReferenceType ReferenceType;
+            typedef typename Base::ConstReferenceType ConstReferenceType;
+            typedef typename Base::PointerType PointerType;
+            typedef typename Base::ConstPointerType ConstPointerType;
+
+            typedef typename Base::StorageType StorageType;
+            typedef typename Base::SlotType SlotType;
+            typedef typename Base::KeyCompareType KeyCompareType;
+
+            /// @brief The static size, needed for metaprogramming
+            static const __WSTL_CONSTEXPR__ SizeType StaticSize = N;
+
+            /// @brief Constructor that uses external buffer
+            /// @param slots Pointer to the external slots
+            /// @param compare Key comparison functor
+            explicit FixedFlatMap(SlotType* slots, const KeyCompareType& compare = KeyCompareType()) : Base(StorageType(slots), compare) {}
+
+            /// @brief Copy constructor that uses external buffer
+            /// @param other The map to copy from
+            /// @param slots Pointer to the external slots
+            FixedFlatMap(const FixedFlatMap& other, SlotType* slots) : Base(StorageType(slots), other.KeyComp()) {
+                this->Insert(other.Begin(), other.End());
+            }
+
+            #ifdef __WSTL_CXX11__
+            /// @brief Move constructor that uses external buffer
+            /// @param other The map to move from
+            /// @param slots Pointer to the external slots
+            /// @since C++11
+            FixedFlatMap(FixedFlatMap&& other, SlotType* slots) : Base(StorageType(slots), other.KeyComp()) {
+                this->Insert(MakeMoveIterator(other.Begin()), MakeMoveIterator(other.End()));
+            }
+            #endif
+
+            /// @brief Copy assignment operator
+            /// @param other The map to copy from
+            FixedFlatMap& operator=(const FixedFlatMap& other) {
+                Base::operator=(other);
+                return *this;
+            }
+
+            #ifdef __WSTL_CXX11__
+            /// @brief Move assignment operator
+            /// @param other The map to move from
+            /// @since C++11
+            FixedFlatMap& operator=(FixedFlatMap&& other) {
+                Base::operator=(Move(other));
+                return *this;
+            }
+            #endif
+        };
+
+        template<typename Key, typename T, size_t N, typename Compare, FlatLayout Layout>
+        const __WSTL_CONSTEXPR__ typename FixedFlatMap<Key, T, N, Compare, Layout>::SizeType FixedFlatMap<Key, T, N, Compare, Layout>::StaticSize;
+    }
+}
+
+#endif
\ No newline at end of file
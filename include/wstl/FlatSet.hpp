@@ -0,0 +1,364 @@
+// Part of WardenSTL - https://github.com/WardenHD/WardenSTL
+// Copyright (c) 2025 Artem Bezruchko (WardenHD)
+//
+// Licensed under the MIT License. See LICENSE file for details.
+
+#ifndef __WSTL_FLATSET_HPP__
+#define __WSTL_FLATSET_HPP__
+
+#include "private/Platform.hpp"
+#include "private/FlatTable.hpp"
+#include "Container.hpp"
+#include "Functional.hpp"
+#include "InitializerList.hpp"
+#include "StandardExceptions.hpp"
+#include "Utility.hpp"
+
+
+/// @defgroup flat_set Flat set
+/// @ingroup containers
+/// @brief Sorted set of unique keys in contiguous memory
+
+namespace wstl {
+    // Basic flat set
+
+    /// @brief Associative container of unique keys, stored in one array ordered by key
+    /// @tparam Key Type of the keys
+    /// @tparam Storage Storage of `SlotType` used by the set
+    /// @tparam Compare Ordering of the keys
+    /// @tparam Layout Order of the elements in memory, see `FlatLayout`
+    /// @details Uses the same table as `BasicFlatMap`, see there for the details. Keys are
+    /// immutable through iterators, since changing one would break the order
+    /// @ingroup flat_set
+    template<typename Key, typename Storage, typename Compare = Less<Key>, FlatLayout Layout = FlatLayout::Sorted>
+    class BasicFlatSet : public __private::__FlatTable<__private::__FlatSetTraits<Key>, Storage, Compare, Layout> {
+    private:
+        typedef __private::__FlatTable<__private::__FlatSetTraits<Key>, Storage, Compare, Layout> Base;
+
+    public:
+        WSTL_STATIC_ASSERT(!IsVoid<Storage>::Value, "Storage must be non-void");
+
+        typedef typename Base::KeyType KeyType;
+        typedef typename Base::ValueType ValueType;
+        typedef typename Base::SizeType SizeType;
+        typedef typename Base::DifferenceType DifferenceType;
+        typedef typename Base::ConstReferenceType ReferenceType;
+        typedef typename Base::ConstReferenceType ConstReferenceType;
+        typedef typename Base::ConstPointerType PointerType;
+        typedef typename Base::ConstPointerType ConstPointerType;
+
+        typedef typename Base::StorageType StorageType;
+        typedef typename Base::SlotType SlotType;
+        typedef typename Base::KeyCompareType KeyCompareType;
+
+        typedef typename Base::Iterator Iterator;
+        typedef typename Base::ConstIterator ConstIterator;
+
+        /// @brief Copy assignment operator
+        /// @param other The set to copy from
+        /// @throws `LengthError` if the set's capacity is exceeded
+        BasicFlatSet& operator=(const BasicFlatSet& other) {
+            if(this != &other) {
+                this->Clear();
+                this->Insert(other.Begin(), other.End());
+            }
+
+            return *this;
+        }
+
+        #ifdef __WSTL_CXX11__
+        /// @brief Move assignment operator
+        /// @param other The set to move from
+        /// @throws `LengthError` if the set's capacity is exceeded
+        /// @since C++11
+        BasicFlatSet& operator=(BasicFlatSet&& other) {
+            if(this != &other) {
+                this->Clear();
+                this->Insert(MakeMoveIterator(other.Begin()), MakeMoveIterator(other.End()));
+            }
+
+            return *this;
+        }
+        #endif
+
+        #ifdef __WSTL_CXX11__
+        /// @brief Constructs a key in place if it is not in the set
+        /// @param ...args The arguments to forward to the constructor of the key
+        /// @return Pair of iterator to the key in the set and whether the key was inserted
+        /// @throws `LengthError` if the set is full
+        /// @since C++11
+        template<typename... Args>
+        Pair<Iterator, bool> Emplace(Args&&... args) {
+            return this->Insert(KeyType(Forward<Args>(args)...));
+        }
+        #else
+        /// @brief Constructs a key in place if it is not in the set
+        /// @param arg The argument to pass to the constructor of the key
+        /// @return Pair of iterator to the key in the set and whether the key was inserted
+        /// @throws `LengthError` if the set is full
+        template<typename Arg>
+        Pair<Iterator, bool> Emplace(const Arg& arg) {
+            return this->Insert(KeyType(arg));
+        }
+        #endif
+
+    protected:
+        /// @brief Constructor, only for default-constructible storage
+        /// @param compare Key comparison functor
+        explicit BasicFlatSet(const KeyCompareType& compare) : Base(compare) {}
+
+        /// @brief Constructor with custom storage, only for non-default-constructible storage
+        /// @param storage Storage for the slots
+        /// @param compare Key comparison functor
+        BasicFlatSet(const StorageType& storage, const KeyCompareType& compare) : Base(storage, compare) {}
+    };
+
+    // Comparison operators
+
+    template<typename Key, typename Storage, typename Compare, FlatLayout Layout>
+    inline bool operator==(const BasicFlatSet<Key, Storage, Compare, Layout>& a, const BasicFlatSet<Key, Storage, Compare, Layout>& b) {
+        return a.Size() == b.Size() && Equal(a.Begin(), a.End(), b.Begin());
+    }
+
+    template<typename Key, typename Storage, typename Compare, FlatLayout Layout>
+    inline bool operator!=(const BasicFlatSet<Key, Storage, Compare, Layout>& a, const BasicFlatSet<Key, Storage, Compare, Layout>& b) {
+        return !(a == b);
+    }
+
+    // Flat set
+
+    /// @brief Version of flat set with fixed storage, default option
+    /// @tparam Key Type of the keys
+    /// @tparam N Maximum number of elements
+    /// @tparam Compare Ordering of the keys
+    /// @tparam Layout Order of the elements in memory, see `FlatLayout`
+    /// @ingroup flat_set
+    template<typename Key, size_t N, typename Compare = Less<Key>, FlatLayout Layout = FlatLayout::Sorted>
+    class FlatSet : public BasicFlatSet<Key, FixedStorage<__private::__FlatSlot<Key>, N>, Compare, Layout> {
+    private:
+        typedef BasicFlatSet<Key, FixedStorage<__private::__FlatSlot<Key>, N>, Compare, Layout> Base;
+
+    public:
+        typedef typename Base::KeyType KeyType;
+        typedef typename Base::ValueType ValueType;
+        typedef typename Base::SizeType SizeType;
+        typedef typename Base::DifferenceType DifferenceType;
+        typedef typename Base::ReferenceType ReferenceType;
+        typedef typename Base::ConstReferenceType ConstReferenceType;
+        typedef typename Base::PointerType PointerType;
+        typedef typename Base::ConstPointerType ConstPointerType;
+
+        typedef typename Base::StorageType StorageType;
+        typedef typename Base::KeyCompareType KeyCompareType;
+
+        /// @brief The static size, needed for metaprogramming
+        static const __WSTL_CONSTEXPR__ SizeType StaticSize = N;
+
+        /// @brief Default constructor
+        /// @param compare Key comparison functor
+        explicit FlatSet(const KeyCompareType& compare = KeyCompareType()) : Base(compare) {}
+
+        /// @brief Copy constructor
+        /// @param other The set to copy from
+        FlatSet(const FlatSet& other) : Base(other.KeyComp()) {
+            this->Insert(other.Begin(), other.End());
+        }
+
+        #ifdef __WSTL_CXX11__
+        /// @brief Move constructor
+        /// @param other The set to move from
+        /// @since C++11
+        FlatSet(FlatSet&& other) : Base(other.KeyComp()) {
+            this->Insert(MakeMoveIterator(other.Begin()), MakeMoveIterator(other.End()));
+        }
+        #endif
+
+        /// @brief Constructor that initializes the set with a range of elements
+        /// @param first Iterator to the first element in the range
+        /// @param last Iterator to the element following the last element in the range
+        /// @param compare Key comparison functor
+        /// @throws `LengthError` if the set's capacity is exceeded
+        template<typename InputIterator>
+        FlatSet(InputIterator first, InputIterator last, const KeyCompareType& compare = KeyCompareType()) : Base(compare) {
+            this->Insert(first, last);
+        }
+
+        #if defined(__WSTL_CXX11__) && !defined(__WSTL_NO_INITIALIZERLIST__)
+        /// @brief Constructor that initializes the set with an initializer list
+        /// @param list The initializer list to initialize the set with
+        /// @param compare Key comparison functor
+        /// @throws `LengthError` if the set's capacity is exceeded
+        /// @since C++11
+        FlatSet(InitializerList<ValueType> list, const KeyCompareType& compare = KeyCompareType()) : Base(compare) {
+            this->Insert(list.Begin(), list.End());
+        }
+        #endif
+
+        /// @brief Copy assignment operator
+        /// @param other The set to copy from
+        FlatSet& operator=(const FlatSet& other) {
+            Base::operator=(other);
+            return *this;
+        }
+
+        #ifdef __WSTL_CXX11__
+        /// @brief Move assignment operator
+        /// @param other The set to move from
+        /// @since C++11
+        FlatSet& operator=(FlatSet&& other) {
+            Base::operator=(Move(other));
+            return *this;
+        }
+        #endif
+    };
+
+    template<typename Key, size_t N, typename Compare, FlatLayout Layout>
+    const __WSTL_CONSTEXPR__ typename FlatSet<Key, N, Compare, Layout>::SizeType FlatSet<Key, N, Compare, Layout>::StaticSize;
+
+    namespace external {
+        /// @brief Version of flat set that uses external storage
+        /// @tparam Key Type of the keys
+        /// @tparam Compare Ordering of the keys
+        /// @tparam Layout Order of the elements in memory, see `FlatLayout`
+        /// @details The slots are an array of `SlotType` of `capacity` elements
+        /// @ingroup flat_set
+        template<typename Key, typename Compare = Less<Key>, FlatLayout Layout = FlatLayout::Sorted>
+        class FlatSet : public BasicFlatSet<Key, ExternalStorage<__private::__FlatSlot<Key> >, Compare, Layout> {
+        private:
+            typedef BasicFlatSet<Key, ExternalStorage<__private::__FlatSlot<Key> >, Compare, Layout> Base;
+
+        public:
+            typedef typename Base::KeyType KeyType;
+            typedef typename Base::ValueType ValueType;
+            typedef typename Base::SizeType SizeType;
+            typedef typename Base::DifferenceType DifferenceType;
+            typedef typename Base::ReferenceType ReferenceType;
+            typedef typename Base::ConstReferenceType ConstReferenceType;
+            typedef typename Base::PointerType PointerType;
+            typedef typename Base::ConstPointerType ConstPointerType;
+
+            typedef typename Base::StorageType StorageType;
+            typedef typename Base::SlotType SlotType;
+            typedef typename Base::KeyCompareType KeyCompareType;
+
+            /// @brief Constructor that uses external buffer
+            /// @param slots Pointer to the external slots
+            /// @param capacity Number of slots
+            /// @param compare Key comparison functor
+            FlatSet(SlotType* slots, SizeType capacity, const KeyCompareType& compare = KeyCompareType()) :
+                Base(StorageType(slots, capacity), compare) {}
+
+            /// @brief Copy constructor that uses external buffer
+            /// @param other The set to copy from
+            /// @param slots Pointer to the external slots
+            /// @param capacity Number of slots
+            /// @throws `LengthError` if the set's capacity is exceeded
+            FlatSet(const FlatSet& other, SlotType* slots, SizeType capacity) : Base(StorageType(slots, capacity), other.KeyComp()) {
+                this->Insert(other.Begin(), other.End());
+            }
+
+            #ifdef __WSTL_CXX11__
+            /// @brief Move constructor that uses external buffer
+            /// @param other The set to move from
+            /// @param slots Pointer to the external slots
+            /// @param capacity Number of slots
+            /// @throws `LengthError` if the set's capacity is exceeded
+            /// @since C++11
+            FlatSet(FlatSet&& other, SlotType* slots, SizeType capacity) : Base(StorageType(slots, capacity), other.KeyComp()) {
+                this->Insert(MakeMoveIterator(other.Begin()), MakeMoveIterator(other.End()));
+            }
+            #endif
+
+            /// @brief Copy assignment operator
+            /// @param other The set to copy from
+            FlatSet& operator=(const FlatSet& other) {
+                Base::operator=(other);
+                return *this;
+            }
+
+            #ifdef __WSTL_CXX11__
+            /// @brief Move assignment operator
+            /// @param other The set to move from
+            /// @since C++11
+            FlatSet& operator=(FlatSet&& other) {
+                Base::operator=(Move(other));
+                return *this;
+            }
+            #endif
+        };
+
+        /// @brief Version of flat set that uses fixed external storage with compile-time known capacity
+        /// @tparam Key Type of the keys
+        /// @tparam N Maximum number of elements
+        /// @tparam Compare Ordering of the keys
+        /// @tparam Layout Order of the elements in memory, see `FlatLayout`
+        /// @details The slots are an array of `SlotType` of `N` elements
+        /// @ingroup flat_set
+        template<typename Key, size_t N, typename Compare = Less<Key>, FlatLayout Layout = FlatLayout::Sorted>
+        class FixedFlatSet : public BasicFlatSet<Key, FixedExternalStorage<__private::__FlatSlot<Key>, N>, Compare, Layout> {
+        private:
+            typedef BasicFlatSet<Key, FixedExternalStorage<__private::__FlatSlot<Key>, N>, Compare, Layout> Base;
+
+        public:
+            typedef typename Base::KeyType KeyType;
+            typedef typename Base::ValueType ValueType;
+            typedef typename Base::SizeType SizeType;
+            typedef typename Base::DifferenceType DifferenceType;
+            typedef typename Base::ReferenceType ReferenceType;
+            typedef typename Base::ConstReferenceType ConstReferenceType;
+            typedef typename Base::PointerType PointerType;
+            typedef typename Base::ConstPointerType ConstPointerType;
+
+            typedef typename Base::StorageType StorageType;
+            typedef typename Base::SlotType SlotType;
+            typedef typename Base::KeyCompareType KeyCompareType;
+
+            /// @brief The static size, needed for metaprogramming
+            static const __WSTL_CONSTEXPR__ SizeType StaticSize = N;
+
+            /// @brief Constructor that uses external buffer
+            /// @param slots Pointer to the external slots
+            /// @param compare Key comparison functor
+            explicit FixedFlatSet(SlotType* slots, const KeyCompareType& compare = KeyCompareType()) : Base(StorageType(slots), compare) {}
+
+            /// @brief Copy constructor that uses external buffer
+            /// @param other The set to copy from
+            /// @param slots Pointer to the external slots
+            FixedFlatSet(const FixedFlatSet& other, SlotType* slots) : Base(StorageType(slots), other.KeyComp()) {
+                this->Insert(other.Begin(), other.End());
+            }
+
+            #ifdef __WSTL_CXX11__
+            /// @brief Move constructor that uses external buffer
+            /// @param other The set to move from
+            /// @param slots Pointer to the external slots
+            /// @since C++11
+            FixedFlatSet(FixedFlatSet&& other, SlotType* slots) : Base(StorageType(slots), other.KeyComp()) {
+                this->Insert(MakeMoveIterator(other.Begin()), MakeMoveIterator(other.End()));
+            }
+            #endif
+
+            /// @brief Copy assignment operator
+            /// @param other The set to copy from
+            FixedFlatSet& operator=(const FixedFlatSet& other) {
+                Base::operator=(other);
+                return *this;
+            }
+
+            #ifdef __WSTL_CXX11__
+            /// @brief Move assignment operator
+            /// @param other The set to move from
+            /// @since C++11
+            FixedFlatSet& operator=(FixedFlatSet&& other) {
+                Base::operator=(Move(other));
+                return *this;
+            }
+            #endif
+        };
+
+        template<typename Key, size_t N, typename Compare, FlatLayout Layout>
+        const __WSTL_CONSTEXPR__ typename FixedFlatSet<Key, N, Compare, Layout>::SizeType FixedFlatSet<Key, N, Compare, Layout>::StaticSize;
+    }
+}
+
+#endif
\ No newline at end of file
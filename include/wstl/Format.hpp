@@ -0,0 +1,1252 @@
+// Part of WardenSTL - https://github.com/WardenHD/WardenSTL
+// Copyright (c) 2025 Artem Bezruchko (WardenHD)
+//
+// Licensed under the MIT License. See LICENSE file for details.
+
+#ifndef __WSTL_FORMAT_HPP__
+#define __WSTL_FORMAT_HPP__
+
+#include "private/Platform.hpp"
+#include "private/Error.hpp"
+#include "TypeTraits.hpp"
+#include "StandardExceptions.hpp"
+#include "NullPointer.hpp"
+#include "CharacterTraits.hpp"
+#include "CharConv.hpp"
+#include "Limits.hpp"
+#include "StringView.hpp"
+#include "BasicString.hpp"
+#include "StreamBuffer.hpp"
+#include <stddef.h>
+#include <stdint.h>
+
+
+/// @defgroup format Format
+/// @brief Text formatting with `{}` replacement fields, without `printf` and without allocating
+
+namespace wstl {
+    // Format exceptions
+
+    /// @brief Exception thrown when a format string is invalid or does not match its arguments
+    /// @ingroup format
+    /// @see https://en.cppreference.com/w/cpp/utility/format/format_error
+    class FormatError __WSTL_FINAL__ : public Exception {
+    public:
+        #ifdef __WSTL_EXCEPTION_LOCATION__
+        /// @brief Constructor
+        /// @param file The name of the source file where the exception occurred
+        /// @param line The line number in the source file where the exception occurred
+        /// @param message The message describing the exception, default is `Format error`
+        FormatError(StringType file, NumericType line, StringType message = "Format error") : Exception(file, line, message) {}
+        #else
+        /// @brief Constructor
+        /// @param message The exception message, default is `Format error`
+        FormatError(StringType message = "Format error") : Exception(message) {}
+        #endif
+
+        /// @copydoc Exception::Name()
+        virtual StringType Name() const __WSTL_NOEXCEPT__ __WSTL_OVERRIDE__ {
+            return "FormatError";
+        }
+    };
+
+    namespace __private {
+        // Format string parsing
+
+        /// @brief Options of a replacement field, `[[fill]align][sign][#][0][width][.precision][type]`
+        struct __FormatSpecification {
+            size_t Width;
+            int Precision;
+            char Fill;
+            char Align;
+            char Sign;
+            char Type;
+            bool Alternate;
+            bool ZeroPad;
+        };
+
+        /// @brief Tracks the argument indices of a format string, automatic and manual indexing cannot be mixed
+        struct __FormatIndexing {
+            size_t Next;
+            bool Automatic;
+            bool Manual;
+        };
+
+        __WSTL_CONSTEXPR14__ inline bool __IsFormatDigit(char c) {
+            return c >= '0' && c <= '9';
+        }
+
+        __WSTL_CONSTEXPR14__ inline bool __IsFormatAlign(char c) {
+            return c == '<' || c == '>' || c == '^';
+        }
+
+        __WSTL_CONSTEXPR14__ inline bool __IsFormatType(char c) {
+            switch(c) {
+                case 'b': case 'B': case 'c': case 'd': case 'o': case 'x': case 'X':
+                case 'e': case 'E': case 'f': case 'F': case 'g': case 'G': case 's': case 'p':
+                    return true;
+                default:
+                    return false;
+            }
+        }
+
+        /// @brief Parses a decimal number of a format string, numbers above `65535` are rejected
+        __WSTL_CONSTEXPR14__ inline bool __ParseFormatNumber(const char*& position, const char* last, size_t& value) {
+            value = 0;
+
+            for(; position != last && __IsFormatDigit(*position); ++position) {
+                value = value * 10 + static_cast<size_t>(*position - '0');
+                if(value > 0xFFFF) return false;
+            }
+
+            return true;
+        }
+
+        /// @brief Parses a replacement field from after its opening brace up to and including its closing brace
+        /// @return `false` if the field is malformed
+        __WSTL_CONSTEXPR14__ inline bool __ParseFormatField(const char*& position, const char* last, __FormatIndexing& indexing,
+            size_t& index, __FormatSpecification& specification) {
+            if(position == last) return false;
+
+            if(__IsFormatDigit(*position)) {
+                if(indexing.Automatic || !__ParseFormatNumber(position, last, index)) return false;
+                indexing.Manual = true;
+            }
+            else {
+                if(indexing.Manual) return false;
+
+                indexing.Automatic = true;
+                index = indexing.Next++;
+            }
+
+            specification.Width = 0;
+            specification.Precision = -1;
+            specification.Fill = ' ';
+            specification.Align = 0;
+            specification.Sign = 0;
+            specification.Type = 0;
+            specification.Alternate = false;
+            specification.ZeroPad = false;
+
+            if(position == last) return false;
+
+            if(*position == '}') {
+                ++position;
+                return true;
+            }
+
+            if(*position++ != ':') return false;
+
+            if(last - position >= 2 && __IsFormatAlign(position[1]) && position[0] != '{' && position[0] != '}') {
+                specification.Fill = position[0];
+                specification.Align = position[1];
+                position += 2;
+            }
+            else if(position != last && __IsFormatAlign(*position)) specification.Align = *position++;
+
+            if(position != last && (*position == '+' || *position == '-' || *position == ' ')) specification.Sign = *position++;
+
+            if(position != last && *position == '#') {
+                specification.Alternate = true;
+                ++position;
+            }
+
+            if(position != last && *position == '0') {
+                specification.ZeroPad = true;
+                ++position;
+            }
+
+            if(!__ParseFormatNumber(position, last, specification.Width)) return false;
+
+            if(position != last && *position == '.') {
+                size_t precision = 0;
+
+                if(++position == last || !__IsFormatDigit(*position) || !__ParseFormatNumber(position, last, precision)) return false;
+                specification.Precision = static_cast<int>(precision);
+            }
+
+            if(position != last && *position != '}') {
+                if(!__IsFormatType(*position)) return false;
+                specification.Type = *position++;
+            }
+
+            if(position == last || *position != '}') return false;
+
+            ++position;
+            return true;
+        }
+
+        /// @brief Checks the syntax of a format string and that it refers to no more than `count` arguments
+        __WSTL_CONSTEXPR14__ inline bool __CheckFormatString(const char* first, const char* last, size_t count) {
+            __FormatIndexing indexing = { 0, false, false };
+
+            while(first != last) {
+                const char c = *first++;
+
+                if(c != '{' && c != '}') continue;
+
+                if(first != last && *first == c) {
+                    ++first;
+                    continue;
+                }
+
+                if(c == '}') return false;
+
+                size_t index = 0;
+                __FormatSpecification specification = { 0, -1, ' ', 0, 0, 0, false, false };
+
+                if(!__ParseFormatField(first, last, indexing, index, specification) || index >= count) return false;
+            }
+
+            return true;
+        }
+
+        /// @brief Not a constant expression, calling it in a constant evaluation stops the compilation
+        inline void __InvalidFormatString() {}
+
+        // Format arguments
+
+        enum __FormatArgumentType {
+            __FORMAT_ARGUMENT_BOOL,
+            __FORMAT_ARGUMENT_CHARACTER,
+            __FORMAT_ARGUMENT_SIGNED,
+            __FORMAT_ARGUMENT_UNSIGNED,
+            __FORMAT_ARGUMENT_FLOAT,
+            __FORMAT_ARGUMENT_DOUBLE,
+            __FORMAT_ARGUMENT_STRING,
+            __FORMAT_ARGUMENT_POINTER
+        };
+
+        struct __FormatText {
+            const char* Data;
+            size_t Size;
+        };
+
+        /// @brief Type-erased argument, the formatting code is shared by all argument lists
+        struct __FormatArgument {
+            __FormatArgumentType Type;
+
+            union {
+                bool Bool;
+                char Character;
+                int64_t Signed;
+                uint64_t Unsigned;
+                float Float;
+                double Double;
+                __FormatText Text;
+                const void* Pointer;
+            };
+        };
+
+        inline __FormatArgument __MakeFormatArgument(bool value) {
+            __FormatArgument argument;
+            argument.Type = __FORMAT_ARGUMENT_BOOL;
+            argument.Bool = value;
+            return argument;
+        }
+
+        inline __FormatArgument __MakeFormatArgument(char value) {
+            __FormatArgument argument;
+            argument.Type = __FORMAT_ARGUMENT_CHARACTER;
+            argument.Character = value;
+            return argument;
+        }
+
+        inline __FormatArgument __MakeSignedFormatArgument(int64_t value) {
+            __FormatArgument argument;
+            argument.Type = __FORMAT_ARGUMENT_SIGNED;
+            argument.Signed = value;
+            return argument;
+        }
+
+        inline __FormatArgument __MakeUnsignedFormatArgument(uint64_t value) {
+            __FormatArgument argument;
+            argument.Type = __FORMAT_ARGUMENT_UNSIGNED;
+            argument.Unsigned = value;
+            return argument;
+        }
+
+        inline __FormatArgument __MakeFormatArgument(signed char value) { return __MakeSignedFormatArgument(value); }
+        inline __FormatArgument __MakeFormatArgument(short value) { return __MakeSignedFormatArgument(value); }
+        inline __FormatArgument __MakeFormatArgument(int value) { return __MakeSignedFormatArgument(value); }
+        inline __FormatArgument __MakeFormatArgument(long value) { return __MakeSignedFormatArgument(value); }
+        inline __FormatArgument __MakeFormatArgument(long long value) { return __MakeSignedFormatArgument(value); }
+
+        inline __FormatArgument __MakeFormatArgument(unsigned char value) { return __MakeUnsignedFormatArgument(value); }
+        inline __FormatArgument __MakeFormatArgument(unsigned short value) { return __MakeUnsignedFormatArgument(value); }
+        inline __FormatArgument __MakeFormatArgument(unsigned int value) { return __MakeUnsignedFormatArgument(value); }
+        inline __FormatArgument __MakeFormatArgument(unsigned long value) { return __MakeUnsignedFormatArgument(value); }
+        inline __FormatArgument __MakeFormatArgument(unsigned long long value) { return __MakeUnsignedFormatArgument(value); }
+
+        inline __FormatArgument __MakeFormatArgument(float value) {
+            __FormatArgument argument;
+            argument.Type = __FORMAT_ARGUMENT_FLOAT;
+            argument.Float = value;
+            return argument;
+        }
+
+        inline __FormatArgument __MakeFormatArgument(double value) {
+            __FormatArgument argument;
+            argument.Type = __FORMAT_ARGUMENT_DOUBLE;
+            argument.Double = value;
+            return argument;
+        }
+
+        /// @details Formatted as a `double`, precision beyond it is lost
+        inline __FormatArgument __MakeFormatArgument(long double value) {
+            return __MakeFormatArgument(static_cast<double>(value));
+        }
+
+        inline __FormatArgument __MakeFormatArgument(const char* data, size_t size) {
+            __FormatArgument argument;
+            argument.Type = __FORMAT_ARGUMENT_STRING;
+            argument.Text.Data = data;
+            argument.Text.Size = size;
+            return argument;
+        }
+
+        inline __FormatArgument __MakeFormatArgument(const char* string) {
+            return __MakeFormatArgument(string, string != NullPointer ? CharacterTraits<char>::Length(string) : 0);
+        }
+
+        inline __FormatArgument __MakeFormatArgument(char* string) {
+            return __MakeFormatArgument(static_cast<const char*>(string));
+        }
+
+        template<typename Traits>
+        inline __FormatArgument __MakeFormatArgument(const BasicStringView<char, Traits>& string) {
+            return __MakeFormatArgument(string.Data(), string.Size());
+        }
+
+        template<typename Derived, typename Traits>
+        inline __FormatArgument __MakeFormatArgument(const BasicString<Derived, char, Traits>& string) {
+            return __MakeFormatArgument(string.Data(), string.Size());
+        }
+
+        template<typename T>
+        inline __FormatArgument __MakeFormatArgument(T* pointer) {
+            __FormatArgument argument;
+            argument.Type = __FORMAT_ARGUMENT_POINTER;
+            argument.Pointer = static_cast<const void*>(pointer);
+            return argument;
+        }
+
+        inline __FormatArgument __MakeFormatArgument(NullPointerType) {
+            return __MakeFormatArgument(static_cast<const void*>(NullPointer));
+        }
+
+        // Writers
+
+        /// @brief Counts the characters without writing them, for the first pass
+        struct __FormatCounter {
+            /// @brief Numbers are only measured, not converted
+            static const bool Measures = true;
+
+            size_t Size;
+
+            void Write(const char*, size_t size) {
+                Size += size;
+            }
+
+            void Fill(char, size_t count) {
+                Size += count;
+            }
+        };
+
+        /// @brief Writes to a buffer already known to be large enough
+        struct __FormatPointerWriter {
+            static const bool Measures = false;
+
+            char* Position;
+
+            void Write(const char* text, size_t size) {
+                CharacterTraits<char>::Copy(Position, text, size);
+                Position += size;
+            }
+
+            void Fill(char c, size_t count) {
+                CharacterTraits<char>::Assign(Position, count, c);
+                Position += count;
+            }
+        };
+
+        /// @brief Writes through an output iterator
+        template<typename OutputIterator>
+        struct __FormatIteratorWriter {
+            static const bool Measures = false;
+
+            OutputIterator Output;
+
+            void Write(const char* text, size_t size) {
+                for(size_t i = 0; i < size; ++i) *Output++ = text[i];
+            }
+
+            void Fill(char c, size_t count) {
+                for(size_t i = 0; i < count; ++i) *Output++ = c;
+            }
+        };
+
+        /// @brief Writes the first `Limit` characters through an output iterator and counts all of them
+        template<typename OutputIterator>
+        struct __FormatBoundedWriter {
+            static const bool Measures = false;
+
+            OutputIterator Output;
+            size_t Limit;
+            size_t Size;
+
+            void Write(const char* text, size_t size) {
+                const size_t count = Size < Limit ? Min(size, Limit - Size) : 0;
+                for(size_t i = 0; i < count; ++i) *Output++ = text[i];
+
+                Size += size;
+            }
+
+            void Fill(char c, size_t count) {
+                const size_t written = Size < Limit ? Min(count, Limit - Size) : 0;
+                for(size_t i = 0; i < written; ++i) *Output++ = c;
+
+                Size += count;
+            }
+        };
+
+        /// @brief Writes to a stream buffer and counts the characters it accepted
+        template<typename Traits>
+        struct __FormatStreamWriter {
+            static const bool Measures = false;
+
+            BasicStreamBuffer<char, Traits>* Buffer;
+            size_t Size;
+
+            void Write(const char* text, size_t size) {
+                Size += Buffer->Sputn(text, size);
+            }
+
+            void Fill(char c, size_t count) {
+                for(size_t i = 0; i < count && !Traits::EqualsIntegerType(Buffer->Sputc(c), Traits::EOF()); ++i) ++Size;
+            }
+        };
+
+        // Value formatting
+
+        /// @brief Writes a field of a head (sign and prefix) and a body, padded to the field width
+        /// @param defaultAlign Alignment when the field does not give one
+        /// @param zeroPad Whether the `0` option pads between the head and the body
+        template<typename Writer>
+        inline void __FormatAligned(Writer& writer, const char* head, size_t headSize, const char* body, size_t bodySize,
+            const __FormatSpecification& specification, char defaultAlign, bool zeroPad) {
+            const size_t size = headSize + bodySize;
+            const size_t padding = specification.Width > size ? specification.Width - size : 0;
+
+            if(zeroPad && specification.ZeroPad && specification.Align == 0) {
+                writer.Write(head, headSize);
+                writer.Fill('0', padding);
+                writer.Write(body, bodySize);
+                return;
+            }
+
+            const char align = specification.Align != 0 ? specification.Align : defaultAlign;
+            const size_t before = align == '<' ? 0 : (align == '^' ? padding / 2 : padding);
+
+            writer.Fill(specification.Fill, before);
+            writer.Write(head, headSize);
+            writer.Write(body, bodySize);
+            writer.Fill(specification.Fill, padding - before);
+        }
+
+        inline void __UppercaseFormatted(char* first, char* last) {
+            for(; first != last; ++first) {
+                if(*first >= 'a' && *first <= 'z') *first = static_cast<char>(*first - 'a' + 'A');
+            }
+        }
+
+        template<typename Writer>
+        inline bool __FormatInteger(Writer& writer, uint64_t magnitude, bool negative, const __FormatSpecification& specification) {
+            if(specification.Precision >= 0) return false;
+
+            int base = 10;
+            const char* prefix = "";
+            size_t prefixSize = 0;
+
+            switch(specification.Type) {
+                case 0: case 'd':
+                    break;
+                case 'x': case 'X':
+                    base = 16;
+                    prefix = specification.Type == 'x' ? "0x" : "0X";
+                    prefixSize = 2;
+                    break;
+                case 'b': case 'B':
+                    base = 2;
+                    prefix = specification.Type == 'b' ? "0b" : "0B";
+                    prefixSize = 2;
+                    break;
+                case 'o':
+                    base = 8;
+                    prefix = "0";
+                    prefixSize = magnitude != 0 ? 1 : 0;
+                    break;
+                case 'c': {
+                    if(negative || magnitude > 0xFF) return false;
+
+                    const char c = static_cast<char>(magnitude);
+                    __FormatAligned(writer, "", 0, &c, 1, specification, '<', false);
+                    return true;
+                }
+                default:
+                    return false;
+            }
+
+            char digits[64];
+            size_t digitCount;
+
+            if(Writer::Measures) {
+                digitCount = base == 10 ? __DecimalLength(magnitude) :
+                    (64 - CountLeftZero(magnitude | 1U) + CountRightZero(static_cast<unsigned>(base)) - 1) / CountRightZero(static_cast<unsigned>(base));
+            }
+            else {
+                char* const end = ToChars(digits, digits + sizeof(digits), magnitude, base).Pointer;
+                if(specification.Type == 'X') __UppercaseFormatted(digits, end);
+
+                digitCount = static_cast<size_t>(end - digits);
+            }
+
+            char head[3];
+            size_t headSize = 0;
+
+            if(negative) head[headSize++] = '-';
+            else if(specification.Sign == '+' || specification.Sign == ' ') head[headSize++] = specification.Sign;
+
+            if(specification.Alternate) {
+                for(size_t i = 0; i < prefixSize; ++i) head[headSize++] = prefix[i];
+            }
+
+            __FormatAligned(writer, head, headSize, digits, digitCount, specification, '>', true);
+            return true;
+        }
+
+        inline bool __IsSignBitSet(float value) {
+            __FloatBits bits;
+            bits.Value = value;
+            return (bits.Bits >> 31) != 0;
+        }
+
+        inline bool __IsSignBitSet(double value) {
+            __DoubleBits bits;
+            bits.Value = value;
+            return (bits.Bits >> 63) != 0;
+        }
+
+        /// @brief Longest text of a floating-point field before padding, the shortest fixed notation of any double fits
+        static const __WSTL_CONSTEXPR__ size_t __FORMAT_FLOAT_LENGTH = 384;
+
+        template<typename Writer, typename T>
+        inline bool __FormatFloat(Writer& writer, T value, const __FormatSpecification& specification) {
+            CharsFormat format = CHARS_FORMAT_GENERAL;
+
+            switch(specification.Type) {
+                case 0: case 'g': case 'G':
+                    break;
+                case 'e': case 'E':
+                    format = CHARS_FORMAT_SCIENTIFIC;
+                    break;
+                case 'f': case 'F':
+                    format = CHARS_FORMAT_FIXED;
+                    break;
+                default:
+                    return false;
+            }
+
+            const bool negative = __IsSignBitSet(value);
+            const T magnitude = negative ? -value : value;
+
+            char buffer[__FORMAT_FLOAT_LENGTH];
+            // An alternate form may add a point
+            char* const last = buffer + sizeof(buffer) - 1;
+
+            // Without a type or precision the shortest round-trip text is written, with a type
+            // the precision defaults to 6 like in printf
+            int precision = specification.Precision < 0 ? 6 : specification.Precision;
+
+            // A large precision is cut to what fits the buffer. Fixed text needs room for the integral
+            // digits and a point, the others for at most a leading digit or zeros, a point and the exponent
+            const int length = static_cast<int>(last - buffer);
+
+            if(format == CHARS_FORMAT_FIXED) {
+                if(precision > length - NumericLimits<T>::MaxExponent10 - 2) {
+                    const ToCharsResult integral = ToChars(buffer, last, magnitude, format, 0);
+                    precision = Min(precision, static_cast<int>(last - integral.Pointer) - 1);
+                }
+            }
+            else if(precision > length - 7) precision = length - 7;
+
+            const ToCharsResult result = specification.Type == 0 && specification.Precision < 0 ?
+                ToChars(buffer, last, magnitude, format) :
+                ToChars(buffer, last, magnitude, format, precision);
+
+            if(result.Error != CONVERSION_ERROR_NONE) return false;
+
+            char* end = result.Pointer;
+            const bool finite = buffer[0] != 'i' && buffer[0] != 'n';
+
+            if(specification.Alternate && finite) {
+                char* point = buffer;
+                while(point != end && *point != '.' && *point != 'e') ++point;
+
+                if(point == end || *point == 'e') {
+                    CharacterTraits<char>::Move(point + 1, point, static_cast<size_t>(end - point));
+                    *point = '.';
+                    ++end;
+                }
+            }
+
+            if(specification.Type == 'E' || specification.Type == 'F' || specification.Type == 'G') __UppercaseFormatted(buffer, end);
+
+            char sign = 0;
+
+            if(negative) sign = '-';
+            else if(specification.Sign == '+' || specification.Sign == ' ') sign = specification.Sign;
+
+            __FormatAligned(writer, &sign, sign != 0 ? 1 : 0, buffer, static_cast<size_t>(end - buffer), specification, '>', finite);
+            return true;
+        }
+
+        template<typename Writer>
+        inline bool __FormatValue(Writer& writer, const __FormatArgument& argument, const __FormatSpecification& specification) {
+            switch(argument.Type) {
+                case __FORMAT_ARGUMENT_BOOL:
+                    if(specification.Type == 0 || specification.Type == 's') {
+                        if(specification.Precision >= 0) return false;
+
+                        __FormatAligned(writer, "", 0, argument.Bool ? "true" : "false", argument.Bool ? 4 : 5, specification, '<', false);
+                        return true;
+                    }
+
+                    return __FormatInteger(writer, argument.Bool ? 1 : 0, false, specification);
+
+                case __FORMAT_ARGUMENT_CHARACTER:
+                    if(specification.Type == 0 || specification.Type == 'c') {
+                        if(specification.Precision >= 0) return false;
+
+                        __FormatAligned(writer, "", 0, &argument.Character, 1, specification, '<', false);
+                        return true;
+                    }
+
+                    {
+                        const int value = argument.Character;
+                        return __FormatInteger(writer, static_cast<uint64_t>(value < 0 ? -value : value), value < 0, specification);
+                    }
+
+                case __FORMAT_ARGUMENT_SIGNED: {
+                    const bool negative = argument.Signed < 0;
+                    const uint64_t magnitude = negative ? uint64_t(0) - static_cast<uint64_t>(argument.Signed) : static_cast<uint64_t>(argument.Signed);
+
+                    return __FormatInteger(writer, magnitude, negative, specification);
+                }
+
+                case __FORMAT_ARGUMENT_UNSIGNED:
+                    return __FormatInteger(writer, argument.Unsigned, false, specification);
+
+                case __FORMAT_ARGUMENT_FLOAT:
+                    return __FormatFloat(writer, argument.Float, specification);
+
+                case __FORMAT_ARGUMENT_DOUBLE:
+                    return __FormatFloat(writer, argument.Double, specification);
+
+                case __FORMAT_ARGUMENT_STRING: {
+                    if(specification.Type != 0 && specification.Type != 's') return false;
+
+                    const size_t size = specification.Precision >= 0 ?
+                        Min(argument.Text.Size, static_cast<size_t>(specification.Precision)) : argument.Text.Size;
+
+                    __FormatAligned(writer, "", 0, argument.Text.Data, size, specification, '<', false);
+                    return true;
+                }
+
+                case __FORMAT_ARGUMENT_POINTER: {
+                    if(specification.Type != 0 && specification.Type != 'p') return false;
+
+                    __FormatSpecification hexadecimal = specification;
+                    hexadecimal.Type = 'x';
+                    hexadecimal.Alternate = true;
+                    hexadecimal.Sign = 0;
+
+                    return __FormatInteger(writer, static_cast<uint64_t>(reinterpret_cast<uintptr_t>(argument.Pointer)), false, hexadecimal);
+                }
+            }
+
+            return false;
+        }
+
+        /// @brief Writes the formatted text, parsing the format string on the way
+        /// @return `false` if the format string is invalid or does not match the arguments,
+        /// the text up to the error is written
+        template<typename Writer>
+        inline bool __FormatEngine(Writer& writer, const StringView& format, const __FormatArgument* arguments, size_t count) {
+            const char* first = format.Data();
+            const char* const last = first + format.Size();
+
+            __FormatIndexing indexing = { 0, false, false };
+
+            while(first != last) {
+                const char* const literal = first;
+                while(first != last && *first != '{' && *first != '}') ++first;
+
+                if(first != literal) writer.Write(literal, static_cast<size_t>(first - literal));
+                if(first == last) break;
+
+                const char brace = *first++;
+
+                // Escaped brace
+                if(first != last && *first == brace) {
+                    writer.Write(first++, 1);
+                    continue;
+                }
+
+                if(brace == '}') return false;
+
+                size_t index = 0;
+                __FormatSpecification specification = { 0, -1, ' ', 0, 0, 0, false, false };
+
+                // Plain field, the most common one
+                if(first != last && *first == '}' && !indexing.Manual) {
+                    ++first;
+                    indexing.Automatic = true;
+                    index = indexing.Next++;
+                }
+                else if(!__ParseFormatField(first, last, indexing, index, specification)) return false;
+
+                if(index >= count || !__FormatValue(writer, arguments[index], specification)) return false;
+            }
+
+            return true;
+        }
+
+        // Targets
+
+        /// @brief Writes the formatted text into a string from `offset` on, in place
+        struct __FormatStringOperation {
+            StringView Format;
+            const __FormatArgument* Arguments;
+            size_t Count;
+            size_t Offset;
+            size_t Size;
+
+            size_t operator()(char* data, size_t capacity) const {
+                if(Offset + Size <= capacity) {
+                    __FormatPointerWriter writer = { data + Offset };
+                    __FormatEngine(writer, Format, Arguments, Count);
+                }
+                else {
+                    __FormatBoundedWriter<char*> writer = { data + Offset, capacity - Offset, 0 };
+                    __FormatEngine(writer, Format, Arguments, Count);
+                }
+
+                return Min(Offset + Size, capacity);
+            }
+        };
+
+        /// @brief Checks if the format string or a string argument lies in a buffer
+        inline bool __FormatReadsFrom(const char* first, const char* last, const StringView& format, const __FormatArgument* arguments, size_t count) {
+            if(format.Data() < last && first < format.Data() + format.Size()) return true;
+
+            for(size_t i = 0; i < count; ++i) {
+                if(arguments[i].Type != __FORMAT_ARGUMENT_STRING) continue;
+                if(arguments[i].Text.Data < last && first < arguments[i].Text.Data + arguments[i].Text.Size) return true;
+            }
+
+            return false;
+        }
+
+        template<typename Derived, typename Traits>
+        inline BasicString<Derived, char, Traits>& __FormatString(BasicString<Derived, char, Traits>& string, bool append,
+            const StringView& format, const __FormatArgument* arguments, size_t count) {
+            __FormatCounter counter = { 0 };
+            const bool valid = __FormatEngine(counter, format, arguments, count);
+
+            __WSTL_ASSERT_RETURNVALUE__(valid, WSTL_MAKE_EXCEPTION(FormatError, "Invalid format string"), string);
+
+            // Overwriting the string would change text that is still to be read, format into a copy then
+            if(!append && __FormatReadsFrom(string.Data(), string.Data() + string.Capacity(), format, arguments, count)) {
+                Derived temporary;
+                __FormatString(temporary, false, format, arguments, count);
+                return string.Assign(temporary);
+            }
+
+            const size_t offset = append ? string.Size() : 0;
+            const __FormatStringOperation operation = { format, arguments, count, offset, counter.Size };
+
+            string.ResizeAndOverwrite(Min(offset + counter.Size, static_cast<size_t>(string.Capacity())), operation);
+
+            __WSTL_ASSERT_RETURNVALUE__(offset + counter.Size <= string.Capacity(),
+                WSTL_MAKE_EXCEPTION(LengthError, "Formatted text does not fit into the string"), string);
+
+            return string;
+        }
+
+        template<typename Traits>
+        inline size_t __FormatStream(BasicStreamBuffer<char, Traits>& buffer, const StringView& format, const __FormatArgument* arguments, size_t count) {
+            __FormatCounter counter = { 0 };
+            const bool valid = __FormatEngine(counter, format, arguments, count);
+
+            __WSTL_ASSERT_RETURNVALUE__(valid, WSTL_MAKE_EXCEPTION(FormatError, "Invalid format string"), 0);
+
+            const Span<char> region = buffer.WriteRegion();
+
+            if(region.Size() >= counter.Size) {
+                __FormatPointerWriter writer = { region.Data() };
+                __FormatEngine(writer, format, arguments, count);
+
+                buffer.Commit(counter.Size);
+                return counter.Size;
+            }
+
+            __FormatStreamWriter<Traits> writer = { &buffer, 0 };
+            __FormatEngine(writer, format, arguments, count);
+
+            return writer.Size;
+        }
+
+        template<typename OutputIterator>
+        inline OutputIterator __FormatIterator(OutputIterator output, const StringView& format, const __FormatArgument* arguments, size_t count) {
+            __FormatIteratorWriter<OutputIterator> writer = { output };
+            const bool valid = __FormatEngine(writer, format, arguments, count);
+
+            __WSTL_ASSERT_RETURNVALUE__(valid, WSTL_MAKE_EXCEPTION(FormatError, "Invalid format string"), writer.Output);
+            return writer.Output;
+        }
+
+        inline size_t __FormattedSize(const StringView& format, const __FormatArgument* arguments, size_t count) {
+            __FormatCounter counter = { 0 };
+            const bool valid = __FormatEngine(counter, format, arguments, count);
+
+            __WSTL_ASSERT_RETURNVALUE__(valid, WSTL_MAKE_EXCEPTION(FormatError, "Invalid format string"), 0);
+            return counter.Size;
+        }
+    }
+
+    // Format to result
+
+    /// @brief Result of `FormatToN`
+    /// @tparam OutputIterator Type of the output iterator
+    /// @ingroup format
+    /// @see https://en.cppreference.com/w/cpp/utility/format/format_to_n
+    template<typename OutputIterator>
+    struct FormatToResult {
+        /// @brief Iterator past the last character written
+        OutputIterator Output;
+        /// @brief Size of the whole formatted text, including the characters that were not written
+        size_t Size;
+    };
+
+    namespace __private {
+        template<typename OutputIterator>
+        inline FormatToResult<OutputIterator> __FormatIteratorN(OutputIterator output, size_t size, const StringView& format,
+            const __FormatArgument* arguments, size_t count) {
+            __FormatBoundedWriter<OutputIterator> writer = { output, size, 0 };
+            const bool valid = __FormatEngine(writer, format, arguments, count);
+
+            FormatToResult<OutputIterator> result = { writer.Output, writer.Size };
+            __WSTL_ASSERT_RETURNVALUE__(valid, WSTL_MAKE_EXCEPTION(FormatError, "Invalid format string"), result);
+
+            return result;
+        }
+    }
+
+    #ifdef __WSTL_CXX11__
+    // Format string
+
+    /// @brief Format string that can not be checked at compile time, made by `RuntimeFormat`
+    /// @ingroup format
+    struct RuntimeFormatString {
+        StringView View;
+    };
+
+    /// @brief Marks a format string known only at run time, it is checked while formatting
+    /// @param format The format string
+    /// @ingroup format
+    /// @since C++11
+    /// @see https://en.cppreference.com/w/cpp/utility/format/runtime_format
+    inline RuntimeFormatString RuntimeFormat(const StringView& format) {
+        RuntimeFormatString result = { format };
+        return result;
+    }
+
+    /// @brief Format string for the arguments `Args`
+    /// @tparam ...Args Types of the arguments
+    /// @details Constructed implicitly from a string literal. Since C++20 the construction is an
+    /// immediate function that checks the syntax and the argument indices, so a wrong format
+    /// string does not compile. Format strings known only at run time go through `RuntimeFormat`
+    /// @ingroup format
+    /// @since C++11
+    /// @see https://en.cppreference.com/w/cpp/utility/format/basic_format_string
+    template<typename... Args>
+    class BasicFormatString {
+    public:
+        /// @brief Constructor from a string literal or other text convertible to a string view
+        /// @param string The format string
+        template<typename String, typename = typename EnableIf<IsConvertible<const String&, StringView>::Value>::Type>
+        __WSTL_CONSTEVAL__ BasicFormatString(const String& string) : m_View(string) {
+            #ifdef __WSTL_CXX20__
+            if(!__private::__CheckFormatString(m_View.Data(), m_View.Data() + m_View.Size(), sizeof...(Args))) {
+                __private::__InvalidFormatString();
+            }
+            #endif
+        }
+
+        /// @brief Constructor from a format string checked at run time
+        /// @param format The format string
+        BasicFormatString(RuntimeFormatString format) : m_View(format.View) {}
+
+        /// @brief Gets the format string
+        __WSTL_CONSTEXPR__ StringView Get() const __WSTL_NOEXCEPT__ {
+            return m_View;
+        }
+
+    private:
+        StringView m_View;
+    };
+
+    /// @brief Format string for the arguments `Args`, the arguments are not deduced from it
+    /// @ingroup format
+    /// @since C++11
+    template<typename... Args>
+    using FormatString = BasicFormatString<typename TypeIdentity<Args>::Type...>;
+
+    // Format
+
+    /// @brief Replaces the contents of a string with formatted text
+    /// @param string The string to write to
+    /// @param format The format string, replacement fields are `{[index][:[[fill]align][sign][#][0][width][.precision][type]]}`
+    /// @param ...args The arguments
+    /// @return The string
+    /// @details The length of the text is computed in a first pass, then the text is written into
+    /// the string buffer directly after a single capacity check. Integers are written with
+    /// `ToChars`, in base `b`, `o`, `d` or `x`, characters with `c`. Floating-point values without
+    /// a type are written in the shortest form that reads back the same, `e`, `f` and `g` take a
+    /// precision which is 6 by default and is cut so the number takes at most 383 characters.
+    /// Uppercase types write uppercase letters. Strings are cut to the precision. Pointers are
+    /// written in hexadecimal. Numbers align to the right, the rest to the left
+    /// @throws `FormatError` if the format string is invalid, the string is unchanged then
+    /// @throws `LengthError` if the text does not fit, the string holds the part that fits then
+    /// @ingroup format
+    /// @since C++11
+    /// @see https://en.cppreference.com/w/cpp/utility/format/format
+    template<typename Derived, typename Traits, typename... Args>
+    inline BasicString<Derived, char, Traits>& Format(BasicString<Derived, char, Traits>& string, FormatString<Args...> format, const Args&... args) {
+        const __private::__FormatArgument arguments[] = { __private::__MakeFormatArgument(args)..., __private::__FormatArgument() };
+        return __private::__FormatString(string, false, format.Get(), arguments, sizeof...(Args));
+    }
+
+    /// @brief Appends formatted text to a string
+    /// @param string The string to append to
+    /// @param format The format string, see `Format`
+    /// @param ...args The arguments
+    /// @return The string
+    /// @throws `FormatError` if the format string is invalid, the string is unchanged then
+    /// @throws `LengthError` if the text does not fit, the string holds the part that fits then
+    /// @ingroup format
+    /// @since C++11
+    template<typename Derived, typename Traits, typename... Args>
+    inline BasicString<Derived, char, Traits>& AppendFormat(BasicString<Derived, char, Traits>& string, FormatString<Args...> format, const Args&... args) {
+        const __private::__FormatArgument arguments[] = { __private::__MakeFormatArgument(args)..., __private::__FormatArgument() };
+        return __private::__FormatString(string, true, format.Get(), arguments, sizeof...(Args));
+    }
+
+    /// @brief Writes formatted text to a stream buffer
+    /// @param buffer The stream buffer to write to
+    /// @param format The format string, see `Format`
+    /// @param ...args The arguments
+    /// @return Number of characters written
+    /// @details If the put area has room for the whole text, it is written there in place
+    /// @throws `FormatError` if the format string is invalid, nothing is written then
+    /// @ingroup format
+    /// @since C++11
+    template<typename Traits, typename... Args>
+    inline size_t Format(BasicStreamBuffer<char, Traits>& buffer, FormatString<Args...> format, const Args&... args) {
+        const __private::__FormatArgument arguments[] = { __private::__MakeFormatArgument(args)..., __private::__FormatArgument() };
+        return __private::__FormatStream(buffer, format.Get(), arguments, sizeof...(Args));
+    }
+
+    /// @brief Writes formatted text through an output iterator
+    /// @param output The output iterator
+    /// @param format The format string, see `Format`
+    /// @param ...args The arguments
+    /// @return Iterator past the last character written
+    /// @throws `FormatError` if the format string is invalid
+    /// @ingroup format
+    /// @since C++11
+    /// @see https://en.cppreference.com/w/cpp/utility/format/format_to
+    template<typename OutputIterator, typename... Args>
+    inline OutputIterator FormatTo(OutputIterator output, FormatString<Args...> format, const Args&... args) {
+        const __private::__FormatArgument arguments[] = { __private::__MakeFormatArgument(args)..., __private::__FormatArgument() };
+        return __private::__FormatIterator(output, format.Get(), arguments, sizeof...(Args));
+    }
+
+    /// @brief Writes at most `size` characters of formatted text through an output iterator
+    /// @param output The output iterator
+    /// @param size Maximum number of characters to write
+    /// @param format The format string, see `Format`
+    /// @param ...args The arguments
+    /// @return Iterator past the last character written and the size of the whole text
+    /// @throws `FormatError` if the format string is invalid
+    /// @ingroup format
+    /// @since C++11
+    /// @see https://en.cppreference.com/w/cpp/utility/format/format_to_n
+    template<typename OutputIterator, typename... Args>
+    inline FormatToResult<OutputIterator> FormatToN(OutputIterator output, size_t size, FormatString<Args...> format, const Args&... args) {
+        const __private::__FormatArgument arguments[] = { __private::__MakeFormatArgument(args)..., __private::__FormatArgument() };
+        return __private::__FormatIteratorN(output, size, format.Get(), arguments, sizeof...(Args));
+    }
+
+    /// @brief Gets the number of characters of formatted text without writing it
+    /// @param format The format string, see `Format`
+    /// @param ...args The arguments
+    /// @throws `FormatError` if the format string is invalid
+    /// @ingroup format
+    /// @since C++11
+    /// @see https://en.cppreference.com/w/cpp/utility/format/formatted_size
+    template<typename... Args>
+    inline size_t FormattedSize(FormatString<Args...> format, const Args&... args) {
+        const __private::__FormatArgument arguments[] = { __private::__MakeFormatArgument(args)..., __private::__FormatArgument() };
+        return __private::__FormattedSize(format.Get(), arguments, sizeof...(Args));
+    }
+    #else
+    // Format
+
+    /// @brief Replaces the contents of a string with formatted text
+    /// @param string The string to write to
+    /// @param format The format string, see the C++11 version for its syntax
+    /// @return The string
+    /// @note In C++98 it supports maximum four arguments and the format string is checked only at run time
+    /// @throws `FormatError` if the format string is invalid, the string is unchanged then
+    /// @throws `LengthError` if the text does not fit, the string holds the part that fits then
+    /// @ingroup format
+    template<typename Derived, typename Traits>
+    inline BasicString<Derived, char, Traits>& Format(BasicString<Derived, char, Traits>& string, const StringView& format) {
+        return __private::__FormatString(string, false, format, NullPointer, 0);
+    }
+
+    template<typename Derived, typename Traits, typename T1>
+    inline BasicString<Derived, char, Traits>& Format(BasicString<Derived, char, Traits>& string, const StringView& format, const T1& a1) {
+        const __private::__FormatArgument arguments[] = { __private::__MakeFormatArgument(a1) };
+        return __private::__FormatString(string, false, format, arguments, 1);
+    }
+
+    template<typename Derived, typename Traits, typename T1, typename T2>
+    inline BasicString<Derived, char, Traits>& Format(BasicString<Derived, char, Traits>& string, const StringView& format, const T1& a1, const T2& a2) {
+        const __private::__FormatArgument arguments[] = { __private::__MakeFormatArgument(a1), __private::__MakeFormatArgument(a2) };
+        return __private::__FormatString(string, false, format, arguments, 2);
+    }
+
+    template<typename Derived, typename Traits, typename T1, typename T2, typename T3>
+    inline BasicString<Derived, char, Traits>& Format(BasicString<Derived, char, Traits>& string, const StringView& format, const T1& a1, const T2& a2, const T3& a3) {
+        const __private::__FormatArgument arguments[] = { __private::__MakeFormatArgument(a1), __private::__MakeFormatArgument(a2),
+            __private::__MakeFormatArgument(a3) };
+        return __private::__FormatString(string, false, format, arguments, 3);
+    }
+
+    template<typename Derived, typename Traits, typename T1, typename T2, typename T3, typename T4>
+    inline BasicString<Derived, char, Traits>& Format(BasicString<Derived, char, Traits>& string, const StringView& format, const T1& a1, const T2& a2,
+        const T3& a3, const T4& a4) {
+        const __private::__FormatArgument arguments[] = { __private::__MakeFormatArgument(a1), __private::__MakeFormatArgument(a2),
+            __private::__MakeFormatArgument(a3), __private::__MakeFormatArgument(a4) };
+        return __private::__FormatString(string, false, format, arguments, 4);
+    }
+
+    /// @brief Appends formatted text to a string
+    /// @param string The string to append to
+    /// @param format The format string, see the C++11 version for its syntax
+    /// @return The string
+    /// @note In C++98 it supports maximum four arguments and the format string is checked only at run time
+    /// @throws `FormatError` if the format string is invalid, the string is unchanged then
+    /// @throws `LengthError` if the text does not fit, the string holds the part that fits then
+    /// @ingroup format
+    template<typename Derived, typename Traits>
+    inline BasicString<Derived, char, Traits>& AppendFormat(BasicString<Derived, char, Traits>& string, const StringView& format) {
+        return __private::__FormatString(string, true, format, NullPointer, 0);
+    }
+
+    template<typename Derived, typename Traits, typename T1>
+    inline BasicString<Derived, char, Traits>& AppendFormat(BasicString<Derived, char, Traits>& string, const StringView& format, const T1& a1) {
+        const __private::__FormatArgument arguments[] = { __private::__MakeFormatArgument(a1) };
+        return __private::__FormatString(string, true, format, arguments, 1);
+    }
+
+    template<typename Derived, typename Traits, typename T1, typename T2>
+    inline BasicString<Derived, char, Traits>& AppendFormat(BasicString<Derived, char, Traits>& string, const StringView& format, const T1& a1, const T2& a2) {
+        const __private::__FormatArgument arguments[] = { __private::__MakeFormatArgument(a1), __private::__MakeFormatArgument(a2) };
+        return __private::__FormatString(string, true, format, arguments, 2);
+    }
+
+    template<typename Derived, typename Traits, typename T1, typename T2, typename T3>
+    inline BasicString<Derived, char, Traits>& AppendFormat(BasicString<Derived, char, Traits>& string, const StringView& format, const T1& a1, const T2& a2,
+        const T3& a3) {
+        const __private::__FormatArgument arguments[] = { __private::__MakeFormatArgument(a1), __private::__MakeFormatArgument(a2),
+            __private::__MakeFormatArgument(a3) };
+        return __private::__FormatString(string, true, format, arguments, 3);
+    }
+
+    template<typename Derived, typename Traits, typename T1, typename T2, typename T3, typename T4>
+    inline BasicString<Derived, char, Traits>& AppendFormat(BasicString<Derived, char, Traits>& string, const StringView& format, const T1& a1, const T2& a2,
+        const T3& a3, const T4& a4) {
+        const __private::__FormatArgument arguments[] = { __private::__MakeFormatArgument(a1), __private::__MakeFormatArgument(a2),
+            __private::__MakeFormatArgument(a3), __private::__MakeFormatArgument(a4) };
+        return __private::__FormatString(string, true, format, arguments, 4);
+    }
+
+    /// @brief Writes formatted text to a stream buffer
+    /// @param buffer The stream buffer to write to
+    /// @param format The format string, see the C++11 version for its syntax
+    /// @return Number of characters written
+    /// @note In C++98 it supports maximum four arguments and the format string is checked only at run time
+    /// @throws `FormatError` if the format string is invalid, nothing is written then
+    /// @ingroup format
+    template<typename Traits>
+    inline size_t Format(BasicStreamBuffer<char, Traits>& buffer, const StringView& format) {
+        return __private::__FormatStream(buffer, format, NullPointer, 0);
+    }
+
+    template<typename Traits, typename T1>
+    inline size_t Format(BasicStreamBuffer<char, Traits>& buffer, const StringView& format, const T1& a1) {
+        const __private::__FormatArgument arguments[] = { __private::__MakeFormatArgument(a1) };
+        return __private::__FormatStream(buffer, format, arguments, 1);
+    }
+
+    template<typename Traits, typename T1, typename T2>
+    inline size_t Format(BasicStreamBuffer<char, Traits>& buffer, const StringView& format, const T1& a1, const T2& a2) {
+        const __private::__FormatArgument arguments[] = { __private::__MakeFormatArgument(a1), __private::__MakeFormatArgument(a2) };
+        return __private::__FormatStream(buffer, format, arguments, 2);
+    }
+
+    template<typename Traits, typename T1, typename T2, typename T3>
+    inline size_t Format(BasicStreamBuffer<char, Traits>& buffer, const StringView& format, const T1& a1, const T2& a2, const T3& a3) {
+        const __private::__FormatArgument arguments[] = { __private::__MakeFormatArgument(a1), __private::__MakeFormatArgument(a2),
+            __private::__MakeFormatArgument(a3) };
+        return __private::__FormatStream(buffer, format, arguments, 3);
+    }
+
+    template<typename Traits, typename T1, typename T2, typename T3, typename T4>
+    inline size_t Format(BasicStreamBuffer<char, Traits>& buffer, const StringView& format, const T1& a1, const T2& a2, const T3& a3, const T4& a4) {
+        const __private::__FormatArgument arguments[] = { __private::__MakeFormatArgument(a1), __private::__MakeFormatArgument(a2),
+            __private::__MakeFormatArgument(a3), __private::__MakeFormatArgument(a4) };
+        return __private::__FormatStream(buffer, format, arguments, 4);
+    }
+
+    /// @brief Writes formatted text through an output iterator
+    /// @param output The output iterator
+    /// @param format The format string, see the C++11 version for its syntax
+    /// @return Iterator past the last character written
+    /// @note In C++98 it supports maximum four arguments and the format string is checked only at run time
+    /// @throws `FormatError` if the format string is invalid
+    /// @ingroup format
+    template<typename OutputIterator>
+    inline OutputIterator FormatTo(OutputIterator output, const StringView& format) {
+        return __private::__FormatIterator(output, format, NullPointer, 0);
+    }
+
+    template<typename OutputIterator, typename T1>
+    inline OutputIterator FormatTo(OutputIterator output, const StringView& format, const T1& a1) {
+        const __private::__FormatArgument arguments[] = { __private::__MakeFormatArgument(a1) };
+        return __private::__FormatIterator(output, format, arguments, 1);
+    }
+
+    template<typename OutputIterator, typename T1, typename T2>
+    inline OutputIterator FormatTo(OutputIterator output, const StringView& format, const T1& a1, const T2& a2) {
+        const __private::__FormatArgument arguments[] = { __private::__MakeFormatArgument(a1), __private::__MakeFormatArgument(a2) };
+        return __private::__FormatIterator(output, format, arguments, 2);
+    }
+
+    template<typename OutputIterator, typename T1, typename T2, typename T3>
+    inline OutputIterator FormatTo(OutputIterator output, const StringView& format, const T1& a1, const T2& a2, const T3& a3) {
+        const __private::__FormatArgument arguments[] = { __private::__MakeFormatArgument(a1), __private::__MakeFormatArgument(a2),
+            __private::__MakeFormatArgument(a3) };
+        return __private::__FormatIterator(output, format, arguments, 3);
+    }
+
+    template<typename OutputIterator, typename T1, typename T2, typename T3, typename T4>
+    inline OutputIterator FormatTo(OutputIterator output, const StringView& format, const T1& a1, const T2& a2, const T3& a3, const T4& a4) {
+        const __private::__FormatArgument arguments[] = { __private::__MakeFormatArgument(a1), __private::__MakeFormatArgument(a2),
+            __private::__MakeFormatArgument(a3), __private::__MakeFormatArgument(a4) };
+        return __private::__FormatIterator(output, format, arguments, 4);
+    }
+
+    /// @brief Writes at most `size` characters of formatted text through an output iterator
+    /// @param output The output iterator
+    /// @param size Maximum number of characters to write
+    /// @param format The format string, see the C++11 version for its syntax
+    /// @return Iterator past the last character written and the size of the whole text
+    /// @note In C++98 it supports maximum four arguments and the format string is checked only at run time
+    /// @throws `FormatError` if the format string is invalid
+    /// @ingroup format
+    template<typename OutputIterator>
+    inline FormatToResult<OutputIterator> FormatToN(OutputIterator output, size_t size, const StringView& format) {
+        return __private::__FormatIteratorN(output, size, format, NullPointer, 0);
+    }
+
+    template<typename OutputIterator, typename T1>
+    inline FormatToResult<OutputIterator> FormatToN(OutputIterator output, size_t size, const StringView& format, const T1& a1) {
+        const __private::__FormatArgument arguments[] = { __private::__MakeFormatArgument(a1) };
+        return __private::__FormatIteratorN(output, size, format, arguments, 1);
+    }
+
+    template<typename OutputIterator, typename T1, typename T2>
+    inline FormatToResult<OutputIterator> FormatToN(OutputIterator output, size_t size, const StringView& format, const T1& a1, const T2& a2) {
+        const __private::__FormatArgument arguments[] = { __private::__MakeFormatArgument(a1), __private::__MakeFormatArgument(a2) };
+        return __private::__FormatIteratorN(output, size, format, arguments, 2);
+    }
+
+    template<typename OutputIterator, typename T1, typename T2, typename T3>
+    inline FormatToResult<OutputIterator> FormatToN(OutputIterator output, size_t size, const StringView& format, const T1& a1, const T2& a2,
+        const T3& a3) {
+        const __private::__FormatArgument arguments[] = { __private::__MakeFormatArgument(a1), __private::__MakeFormatArgument(a2),
+            __private::__MakeFormatArgument(a3) };
+        return __private::__FormatIteratorN(output, size, format, arguments, 3);
+    }
+
+    template<typename OutputIterator, typename T1, typename T2, typename T3, typename T4>
+    inline FormatToResult<OutputIterator> FormatToN(OutputIterator output, size_t size, const StringView& format, const T1& a1, const T2& a2,
+        const T3& a3, const T4& a4) {
+        const __private::__FormatArgument arguments[] = { __private::__MakeFormatArgument(a1), __private::__MakeFormatArgument(a2),
+            __private::__MakeFormatArgument(a3), __private::__MakeFormatArgument(a4) };
+        return __private::__FormatIteratorN(output, size, format, arguments, 4);
+    }
+
+    /// @brief Gets the number of characters of formatted text without writing it
+    /// @param format The format string, see the C++11 version for its syntax
+    /// @note In C++98 it supports maximum four arguments and the format string is checked only at run time
+    /// @throws `FormatError` if the format string is invalid
+    /// @ingroup format
+    inline size_t FormattedSize(const StringView& format) {
+        return __private::__FormattedSize(format, NullPointer, 0);
+    }
+
+    template<typename T1>
+    inline size_t FormattedSize(const StringView& format, const T1& a1) {
+        const __private::__FormatArgument arguments[] = { __private::__MakeFormatArgument(a1) };
+        return __private::__FormattedSize(format, arguments, 1);
+    }
+
+    template<typename T1, typename T2>
+    inline size_t FormattedSize(const StringView& format, const T1& a1, const T2& a2) {
+        const __private::__FormatArgument arguments[] = { __private::__MakeFormatArgument(a1), __private::__MakeFormatArgument(a2) };
+        return __private::__FormattedSize(format, arguments, 2);
+    }
+
+    template<typename T1, typename T2, typename T3>
+    inline size_t FormattedSize(const StringView& format, const T1& a1, const T2& a2, const T3& a3) {
+        const __private::__FormatArgument arguments[] = { __private::__MakeFormatArgument(a1), __private::__MakeFormatArgument(a2),
+            __private::__MakeFormatArgument(a3) };
+        return __private::__FormattedSize(format, arguments, 3);
+    }
+
+    template<typename T1, typename T2, typename T3, typename T4>
+    inline size_t FormattedSize(const StringView& format, const T1& a1, const T2& a2, const T3& a3, const T4& a4) {
+        const __private::__FormatArgument arguments[] = { __private::__MakeFormatArgument(a1), __private::__MakeFormatArgument(a2),
+            __private::__MakeFormatArgument(a3), __private::__MakeFormatArgument(a4) };
+        return __private::__FormattedSize(format, arguments, 4);
+    }
+    #endif
+}
+
+#endif
\ No newline at end of file
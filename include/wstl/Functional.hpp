@@ -1553,6 +1553,42 @@ namespace wstl {
     };
     #endif
 
+    // Minimum
+
+    /// @brief Functor that returns the smaller of two objects, the first one if they are equivalent
+    /// @tparam T Type of the objects
+    /// @details Associative, so it can fold windows and ranges like `Plus`.
+    /// `SlidingWindow` recognizes it and keeps a monotonic queue instead of partial results
+    /// @ingroup functional
+    template<typename T>
+    struct Minimum : BinaryFunction<T, T, T> {
+        /// @brief Applies the functor to two arguments
+        /// @param a Value of the first argument
+        /// @param b Value of the second argument
+        /// @return The smaller of the two arguments
+        __WSTL_CONSTEXPR__ T operator()(const T& a, const T& b) const {
+            return b < a ? b : a;
+        }
+    };
+
+    // Maximum
+
+    /// @brief Functor that returns the larger of two objects, the first one if they are equivalent
+    /// @tparam T Type of the objects
+    /// @details Associative, so it can fold windows and ranges like `Plus`.
+    /// `SlidingWindow` recognizes it and keeps a monotonic queue instead of partial results
+    /// @ingroup functional
+    template<typename T>
+    struct Maximum : BinaryFunction<T, T, T> {
+        /// @brief Applies the functor to two arguments
+        /// @param a Value of the first argument
+        /// @param b Value of the second argument
+        /// @return The larger of the two arguments
+        __WSTL_CONSTEXPR__ T operator()(const T& a, const T& b) const {
+            return a < b ? b : a;
+        }
+    };
+
     // Equal to
 
     #ifdef __WSTL_CXX11__
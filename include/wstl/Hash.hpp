@@ -18,25 +18,75 @@
 #include "hash/Jenkins.hpp"
 #include "hash/Pearson.hpp"
 #include "hash/Murmur3.hpp"
+#include "hash/WyHash.hpp"
 
 
+#ifdef __DOXYGEN__
+    /// @def __WSTL_FAST_HASH__
+    /// @brief If defined, `Hash` of strings, string views, spans and bitsets uses `hash::WyHash`
+    /// instead of FNV-1a. It is several times faster on keys longer than a few bytes, but needs
+    /// 64-bit multiplications, which targets without them emulate
+    /// @ingroup hash
+    #define __WSTL_FAST_HASH__
+#endif
+
 namespace wstl {
     namespace __private {
+        #ifdef __WSTL_FAST_HASH__
         template<typename T>
-        __WSTL_CONSTEXPR14__ typename EnableIf<sizeof(T) == sizeof(uint16_t), size_t>::Type __GenericHash(const uint8_t* first, const uint8_t* last) {
-            uint32_t hash = hash::FNV1a_32(first, last);
+        inline size_t __GenericHash(const uint8_t* first, const uint8_t* last, size_t seed = 0) {
+            return static_cast<size_t>(hash::WyHash::Hash(first, static_cast<size_t>(last - first), seed));
+        }
+        #else
+        /// @brief Hashes a range with FNV-1a, a non-zero seed is hashed before it
+        template<typename Hasher>
+        __WSTL_CONSTEXPR14__ typename Hasher::HashType __SeededFNV1a(const uint8_t* first, const uint8_t* last, size_t seed) {
+            Hasher hasher;
+            for(size_t i = 0; seed != 0 && i < sizeof(size_t); ++i) hasher.PushBack(uint8_t(seed >> (8 * i)));
+
+            hasher.Append(first, last);
+            return hasher.Value();
+        }
+
+        template<typename T>
+        __WSTL_CONSTEXPR14__ typename EnableIf<sizeof(T) == sizeof(uint16_t), size_t>::Type __GenericHash(const uint8_t* first, const uint8_t* last, size_t seed = 0) {
+            uint32_t hash = __SeededFNV1a<hash::FNV1a_32>(first, last, seed);
             return static_cast<size_t>(hash ^ (hash >> 16));
         }
 
         template<typename T>
-        __WSTL_CONSTEXPR14__ typename EnableIf<sizeof(T) == sizeof(uint32_t), size_t>::Type __GenericHash(const uint8_t* first, const uint8_t* last) {
-            return hash::FNV1a_32(first, last);
+        __WSTL_CONSTEXPR14__ typename EnableIf<sizeof(T) == sizeof(uint32_t), size_t>::Type __GenericHash(const uint8_t* first, const uint8_t* last, size_t seed = 0) {
+            return __SeededFNV1a<hash::FNV1a_32>(first, last, seed);
         }
         
         template<typename T>
-        __WSTL_CONSTEXPR14__ typename EnableIf<sizeof(T) == sizeof(uint64_t), size_t>::Type __GenericHash(const uint8_t* first, const uint8_t* last) {
-            return hash::FNV1a_64(first, last);
+        __WSTL_CONSTEXPR14__ typename EnableIf<sizeof(T) == sizeof(uint64_t), size_t>::Type __GenericHash(const uint8_t* first, const uint8_t* last, size_t seed = 0) {
+            return __SeededFNV1a<hash::FNV1a_64>(first, last, seed);
         }
+        #endif
+
+        /// @brief Base of the hashes of byte sequences, such as strings, spans and bitsets
+        /// @details Holds a seed that is mixed into every hash, 0 by default. Hash containers copy
+        /// the hasher they are constructed with, so giving each container a secret random seed
+        /// keeps an attacker from choosing keys that collide (hash flooding)
+        class __SeededHash {
+        public:
+            /// @brief Gets the seed
+            size_t Seed() const __WSTL_NOEXCEPT__ {
+                return m_Seed;
+            }
+
+        protected:
+            explicit __SeededHash(size_t seed) : m_Seed(seed) {}
+
+            size_t HashBytes(const void* data, size_t size) const {
+                const uint8_t* first = static_cast<const uint8_t*>(data);
+                return __GenericHash<size_t>(first, first + size, m_Seed);
+            }
+
+        private:
+            size_t m_Seed;
+        };
 
         template<typename T, bool IsEnum = false>
         struct __HashBase {
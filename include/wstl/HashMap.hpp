@@ -0,0 +1,573 @@
+// Part of WardenSTL - https://github.com/WardenHD/WardenSTL
+// Copyright (c) 2025 Artem Bezruchko (WardenHD)
+//
+// Licensed under the MIT License. See LICENSE file for details.
+
+#ifndef __WSTL_HASHMAP_HPP__
+#define __WSTL_HASHMAP_HPP__
+
+#include "private/Platform.hpp"
+#include "private/HashTable.hpp"
+#include "Container.hpp"
+#include "Hash.hpp"
+#include "Functional.hpp"
+#include "InitializerList.hpp"
+#include "StandardExceptions.hpp"
+#include "Utility.hpp"
+
+
+/// @defgroup hash_map Hash map
+/// @ingroup containers
+/// @brief Open-addressing hash map container
+
+namespace wstl {
+    // Basic hash map
+
+    /// @brief Associative container of unique keys and mapped values, stored in an open-addressing hash table
+    /// @tparam Key Type of the keys
+    /// @tparam T Type of the mapped values
+    /// @tparam Storage Storage of `SlotType` used by the map
+    /// @tparam Hasher Hash functor for the keys
+    /// @tparam KeyEqual Equality functor for the keys
+    /// @details Elements live in slots of uninitialized memory. Next to them the map keeps one
+    /// control byte per slot, which holds 7 bits of the hash of the element, so probing reads
+    /// the small control array and compares keys only when those bits match. Colliding keys
+    /// go to the following slots, erased slots are reused by later insertions. The capacity is
+    /// fixed: keep the map below about 7/8 full for short probes. Insertion and erasure
+    /// do not invalidate iterators to other elements
+    /// @ingroup hash_map
+    template<typename Key, typename T, typename Storage, typename Hasher = Hash<Key>, typename KeyEqual = EqualTo<Key> >
+    class BasicHashMap : public __private::__HashTable<__private::__HashMapTraits<Key, T>, Storage, Hasher, KeyEqual> {
+    private:
+        typedef __private::__HashTable<__private::__HashMapTraits<Key, T>, Storage, Hasher, KeyEqual> Base;
+        typedef typename Base::Probe Probe;
+
+    public:
+        WSTL_STATIC_ASSERT(!IsVoid<Storage>::Value, "Storage must be non-void");
+
+        typedef typename Base::KeyType KeyType;
+        typedef T MappedType;
+        typedef typename Base::ValueType ValueType;
+        typedef typename Base::SizeType SizeType;
+        typedef typename Base::DifferenceType DifferenceType;
+        typedef typename Base::ReferenceType ReferenceType;
+        typedef typename Base::ConstReferenceType ConstReferenceType;
+        typedef typename Base::PointerType PointerType;
+        typedef typename Base::ConstPointerType ConstPointerType;
+
+        typedef typename Base::StorageType StorageType;
+        typedef typename Base::SlotType SlotType;
+        typedef typename Base::HasherType HasherType;
+        typedef typename Base::KeyEqualType KeyEqualType;
+
+        typedef typename Base::Iterator Iterator;
+        typedef typename Base::ConstIterator ConstIterator;
+
+        /// @brief Copy assignment operator
+        /// @param other The map to copy from
+        /// @throws `LengthError` if the map's capacity is exceeded
+        BasicHashMap& operator=(const BasicHashMap& other) {
+            if(this != &other) {
+                this->Clear();
+                this->InsertUnique(other.Begin(), other.End());
+            }
+
+            return *this;
+        }
+
+        #ifdef __WSTL_CXX11__
+        /// @brief Move assignment operator
+        /// @param other The map to move from
+        /// @throws `LengthError` if the map's capacity is exceeded
+        /// @since C++11
+        BasicHashMap& operator=(BasicHashMap&& other) {
+            if(this != &other) {
+                this->Clear();
+                this->InsertUnique(MakeMoveIterator(other.Begin()), MakeMoveIterator(other.End()));
+            }
+
+            return *this;
+        }
+        #endif
+
+        /// @brief Gets the value mapped to a key
+        /// @param key The key to search for
+        /// @throws `OutOfRange` if the key is not in the map
+        MappedType& At(const KeyType& key) {
+            const SizeType index = this->FindIndex(key);
+            __WSTL_ASSERT__(index != this->NoIndex(), WSTL_MAKE_EXCEPTION(OutOfRange, "HashMap key not found"));
+            return this->SlotAt(index)->Second;
+        }
+
+        /// @brief Gets the value mapped to a key
+        /// @param key The key to search for
+        /// @throws `OutOfRange` if the key is not in the map
+        const MappedType& At(const KeyType& key) const {
+            const SizeType index = this->FindIndex(key);
+            __WSTL_ASSERT__(index != this->NoIndex(), WSTL_MAKE_EXCEPTION(OutOfRange, "HashMap key not found"));
+            return this->SlotAt(index)->Second;
+        }
+
+        /// @brief Gets the value mapped to a key, inserting a default-constructed value if the key is not in the map
+        /// @param key The key to search for
+        /// @throws `LengthError` if the key is not in the map and the map is full
+        MappedType& operator[](const KeyType& key) {
+            return TryEmplace(key).First->Second;
+        }
+
+        /// @brief Inserts an element if its key is not in the map
+        /// @param value The element to insert
+        /// @return Pair of iterator to the element with the key and whether the element was inserted
+        /// @throws `LengthError` if the map is full
+        Pair<Iterator, bool> Insert(ConstReferenceType value) {
+            const Probe probe = this->Prepare(value.First);
+            if(probe.Index == this->NoIndex()) return Pair<Iterator, bool>(this->End(), false);
+
+            if(!probe.Found) {
+                ::new(this->RawAt(probe.Index)) ValueType(value);
+                this->Commit(probe);
+            }
+
+            return Pair<Iterator, bool>(this->IteratorAt(probe.Index), !probe.Found);
+        }
+
+        #ifdef __WSTL_CXX11__
+        /// @brief Inserts an element if its key is not in the map
+        /// @param value The element to insert (rvalue reference)
+        /// @return Pair of iterator to the element with the key and whether the element was inserted
+        /// @throws `LengthError` if the map is full
+        /// @since C++11
+        Pair<Iterator, bool> Insert(ValueType&& value) {
+            const Probe probe = this->Prepare(value.First);
+            if(probe.Index == this->NoIndex()) return Pair<Iterator, bool>(this->End(), false);
+
+            if(!probe.Found) {
+                ::new(this->RawAt(probe.Index)) ValueType(Move(value));
+                this->Commit(probe);
+            }
+
+            return Pair<Iterator, bool>(this->IteratorAt(probe.Index), !probe.Found);
+        }
+        #endif
+
+        /// @brief Inserts a range of elements, skipping keys that are already in the map
+        /// @param first Iterator to the first element in the range
+        /// @param last Iterator to the element following the last element in the range
+        /// @throws `LengthError` if the map is full
+        template<typename InputIterator>
+        void Insert(InputIterator first, InputIterator last) {
+            for(; first != last; ++first) Insert(*first);
+        }
+
+        #if defined(__WSTL_CXX11__) && !defined(__WSTL_NO_INITIALIZERLIST__)
+        /// @brief Inserts elements from an initializer list, skipping keys that are already in the map
+        /// @param list The initializer list to insert
+        /// @throws `LengthError` if the map is full
+        /// @since C++11
+        void Insert(InitializerList<ValueType> list) {
+            Insert(list.Begin(), list.End());
+        }
+        #endif
+
+        /// @brief Inserts an element, or assigns to the mapped value if the key is already in the map
+        /// @param key The key of the element
+        /// @param value The value to map to the key
+        /// @return Pair of iterator to the element with the key and whether the element was inserted
+        /// @throws `LengthError` if the map is full
+        Pair<Iterator, bool> InsertOrAssign(const KeyType& key, const MappedType& value) {
+            Pair<Iterator, bool> result = TryEmplace(key, value);
+            if(!result.Second && result.First != this->End()) result.First->Second = value;
+            return result;
+        }
+
+        #ifdef __WSTL_CXX11__
+        /// @brief Inserts an element, or assigns to the mapped value if the key is already in the map
+        /// @param key The key of the element
+        /// @param value The value to map to the key (rvalue reference)
+        /// @return Pair of iterator to the element with the key and whether the element was inserted
+        /// @throws `LengthError` if the map is full
+        /// @since C++11
+        Pair<Iterator, bool> InsertOrAssign(const KeyType& key, MappedType&& value) {
+            const Probe probe = this->Prepare(key);
+            if(probe.Index == this->NoIndex()) return Pair<Iterator, bool>(this->End(), false);
+
+            if(probe.Found) this->SlotAt(probe.Index)->Second = Move(value);
+            else {
+                ::new(this->RawAt(probe.Index)) ValueType(key, Move(value));
+                this->Commit(probe);
+            }
+
+            return Pair<Iterator, bool>(this->IteratorAt(probe.Index), !probe.Found);
+        }
+
+        /// @brief Constructs an element in place if its key is not in the map
+        /// @param ...args The arguments to forward to the constructor of the element
+        /// @return Pair of iterator to the element with the key and whether the element was inserted
+        /// @throws `LengthError` if the map is full
+        /// @details The element is constructed before the lookup, use `TryEmplace` to avoid that
+        /// @since C++11
+        template<typename... Args>
+        Pair<Iterator, bool> Emplace(Args&&... args) {
+            return Insert(ValueType(Forward<Args>(args)...));
+        }
+
+        /// @brief Constructs the mapped value in place if the key is not in the map
+        /// @param key The key of the element
+        /// @param ...args The arguments to forward to the constructor of the mapped value
+        /// @return Pair of iterator to the element with the key and whether the element was inserted
+        /// @throws `LengthError` if the map is full
+        /// @since C++11
+        template<typename... Args>
+        Pair<Iterator, bool> TryEmplace(const KeyType& key, Args&&... args) {
+            const Probe probe = this->Prepare(key);
+            if(probe.Index == this->NoIndex()) return Pair<Iterator, bool>(this->End(), false);
+
+            if(!probe.Found) {
+                ::new(this->RawAt(probe.Index)) ValueType(key, MappedType(Forward<Args>(args)...));
+                this->Commit(probe);
+            }
+
+            return Pair<Iterator, bool>(this->IteratorAt(probe.Index), !probe.Found);
+        }
+
+        #else
+        /// @brief Constructs an element in place if its key is not in the map
+        /// @param key The key of the element
+        /// @param value The value to map to the key
+        /// @return Pair of iterator to the element with the key and whether the element was inserted
+        /// @throws `LengthError` if the map is full
+        template<typename K, typename V>
+        Pair<Iterator, bool> Emplace(const K& key, const V& value) {
+            return Insert(ValueType(key, value));
+        }
+
+        /// @brief Constructs a default mapped value in place if the key is not in the map
+        /// @param key The key of the element
+        /// @return Pair of iterator to the element with the key and whether the element was inserted
+        /// @throws `LengthError` if the map is full
+        Pair<Iterator, bool> TryEmplace(const KeyType& key) {
+            return TryEmplace(key, MappedType());
+        }
+
+        /// @brief Constructs the mapped value in place if the key is not in the map
+        /// @param key The key of the element
+        /// @param arg The argument to pass to the constructor of the mapped value
+        /// @return Pair of iterator to the element with the key and whether the element was inserted
+        /// @throws `LengthError` if the map is full
+        template<typename Arg>
+        Pair<Iterator, bool> TryEmplace(const KeyType& key, const Arg& arg) {
+            const Probe probe = this->Prepare(key);
+            if(probe.Index == this->NoIndex()) return Pair<Iterator, bool>(this->End(), false);
+
+            if(!probe.Found) {
+                ::new(this->RawAt(probe.Index)) ValueType(key, MappedType(arg));
+                this->Commit(probe);
+            }
+
+            return Pair<Iterator, bool>(this->IteratorAt(probe.Index), !probe.Found);
+        }
+        #endif
+
+    protected:
+        /// @brief Constructor, only for default-constructible storage
+        /// @param control Control bytes, one per slot and `ControlPadding` more
+        /// @param hasher Hash functor
+        /// @param equal Key equality functor
+        BasicHashMap(uint8_t* control, const HasherType& hasher, const KeyEqualType& equal) : Base(control, hasher, equal) {}
+
+        /// @brief Constructor with custom storage, only for non-default-constructible storage
+        /// @param storage Storage for the slots
+        /// @param control Control bytes, one per slot and `ControlPadding` more
+        /// @param hasher Hash functor
+        /// @param equal Key equality functor
+        BasicHashMap(const StorageType& storage, uint8_t* control, const HasherType& hasher, const KeyEqualType& equal) : Base(storage, control, hasher, equal) {}
+    };
+
+    // Comparison operators
+
+    template<typename Key, typename T, typename Storage, typename Hasher, typename KeyEqual>
+    inline bool operator==(const BasicHashMap<Key, T, Storage, Hasher, KeyEqual>& a, const BasicHashMap<Key, T, Storage, Hasher, KeyEqual>& b) {
+        if(a.Size() != b.Size()) return false;
+
+        typedef typename BasicHashMap<Key, T, Storage, Hasher, KeyEqual>::ConstIterator ConstIterator;
+
+        for(ConstIterator it = a.Begin(); it != a.End(); ++it) {
+            ConstIterator other = b.Find(it->First);
+            if(other == b.End() || !(other->Second == it->Second)) return false;
+        }
+
+        return true;
+    }
+
+    template<typename Key, typename T, typename Storage, typename Hasher, typename KeyEqual>
+    inline bool operator!=(const BasicHashMap<Key, T, Storage, Hasher, KeyEqual>& a, const BasicHashMap<Key, T, Storage, Hasher, KeyEqual>& b) {
+        return !(a == b);
+    }
+
+    // Hash map
+
+    /// @brief Version of hash map with fixed storage, default option
+    /// @tparam Key Type of the keys
+    /// @tparam T Type of the mapped values
+    /// @tparam N Number of slots
+    /// @tparam Hasher Hash functor for the keys
+    /// @tparam KeyEqual Equality functor for the keys
+    /// @ingroup hash_map
+    template<typename Key, typename T, size_t N, typename Hasher = Hash<Key>, typename KeyEqual = EqualTo<Key> >
+    class HashMap : private __private::__HashControl<N>,
+        public BasicHashMap<Key, T, FixedStorage<__private::__HashSlot<Pair<const Key, T> >, N>, Hasher, KeyEqual> {
+    private:
+        typedef __private::__HashControl<N> ControlBase;
+        typedef BasicHashMap<Key, T, FixedStorage<__private::__HashSlot<Pair<const Key, T> >, N>, Hasher, KeyEqual> Base;
+
+    public:
+        typedef typename Base::KeyType KeyType;
+        typedef typename Base::MappedType MappedType;
+        typedef typename Base::ValueType ValueType;
+        typedef typename Base::SizeType SizeType;
+        typedef typename Base::DifferenceType DifferenceType;
+        typedef typename Base::ReferenceType ReferenceType;
+        typedef typename Base::ConstReferenceType ConstReferenceType;
+        typedef typename Base::PointerType PointerType;
+        typedef typename Base::ConstPointerType ConstPointerType;
+
+        typedef typename Base::StorageType StorageType;
+        typedef typename Base::HasherType HasherType;
+        typedef typename Base::KeyEqualType KeyEqualType;
+
+        /// @brief The static size, needed for metaprogramming
+        static const __WSTL_CONSTEXPR__ SizeType StaticSize = N;
+
+        /// @brief Default constructor
+        /// @param hasher Hash functor
+        /// @param equal Key equality functor
+        explicit HashMap(const HasherType& hasher = HasherType(), const KeyEqualType& equal = KeyEqualType()) :
+            ControlBase(), Base(ControlBase::Control, hasher, equal) {}
+
+        /// @brief Copy constructor
+        /// @param other The map to copy from
+        HashMap(const HashMap& other) : ControlBase(), Base(ControlBase::Control, other.HashFunction(), other.KeyEq()) {
+            this->InsertUnique(other.Begin(), other.End());
+        }
+
+        #ifdef __WSTL_CXX11__
+        /// @brief Move constructor
+        /// @param other The map to move from
+        /// @since C++11
+        HashMap(HashMap&& other) : ControlBase(), Base(ControlBase::Control, other.HashFunction(), other.KeyEq()) {
+            this->InsertUnique(MakeMoveIterator(other.Begin()), MakeMoveIterator(other.End()));
+        }
+        #endif
+
+        /// @brief Constructor that initializes the map with a range of elements
+        /// @param first Iterator to the first element in the range
+        /// @param last Iterator to the element following the last element in the range
+        /// @param hasher Hash functor
+        /// @param equal Key equality functor
+        /// @throws `LengthError` if the map's capacity is exceeded
+        template<typename InputIterator>
+        HashMap(InputIterator first, InputIterator last, const HasherType& hasher = HasherType(), const KeyEqualType& equal = KeyEqualType()) :
+            ControlBase(), Base(ControlBase::Control, hasher, equal) {
+            this->Insert(first, last);
+        }
+
+        #if defined(__WSTL_CXX11__) && !defined(__WSTL_NO_INITIALIZERLIST__)
+        /// @brief Constructor that initializes the map with an initializer list
+        /// @param list The initializer list to initialize the map with
+        /// @param hasher Hash functor
+        /// @param equal Key equality functor
+        /// @throws `LengthError` if the map's capacity is exceeded
+        /// @since C++11
+        HashMap(InitializerList<ValueType> list, const HasherType& hasher = HasherType(), const KeyEqualType& equal = KeyEqualType()) :
+            ControlBase(), Base(ControlBase::Control, hasher, equal) {
+            this->Insert(list.Begin(), list.End());
+        }
+        #endif
+
+        /// @brief Copy assignment operator
+        /// @param other The map to copy from
+        HashMap& operator=(const HashMap& other) {
+            Base::operator=(other);
+            return *this;
+        }
+
+        #ifdef __WSTL_CXX11__
+        /// @brief Move assignment operator
+        /// @param other The map to move from
+        /// @since C++11
+        HashMap& operator=(HashMap&& other) {
+            Base::operator=(Move(other));
+            return *this;
+        }
+        #endif
+    };
+
+    template<typename Key, typename T, size_t N, typename Hasher, typename KeyEqual>
+    const __WSTL_CONSTEXPR__ typename HashMap<Key, T, N, Hasher, KeyEqual>::SizeType HashMap<Key, T, N, Hasher, KeyEqual>::StaticSize;
+
+    namespace external {
+        /// @brief Version of hash map that uses external storage
+        /// @tparam Key Type of the keys
+        /// @tparam T Type of the mapped values
+        /// @tparam Hasher Hash functor for the keys
+        /// @tparam KeyEqual Equality functor for the keys
+        /// @details The slots are an array of `SlotType` of `capacity` elements and the control bytes an array of `capacity + ControlPadding` bytes
+        /// @ingroup hash_map
+        template<typename Key, typename T, typename Hasher = Hash<Key>, typename KeyEqual = EqualTo<Key> >
+        class HashMap : public BasicHashMap<Key, T, ExternalStorage<__private::__HashSlot<Pair<const Key, T> > >, Hasher, KeyEqual> {
+        private:
+            typedef BasicHashMap<Key, T, ExternalStorage<__private::__HashSlot<Pair<const Key, T> > >, Hasher, KeyEqual> Base;
+
+        public:
+            typedef typename Base::KeyType KeyType;
+            typedef typename Base::MappedType MappedType;
+            typedef typename Base::ValueType ValueType;
+            typedef typename Base::SizeType SizeType;
+            typedef typename Base::DifferenceType DifferenceType;
+            typedef typename Base::ReferenceType ReferenceType;
+            typedef typename Base::ConstReferenceType ConstReferenceType;
+            typedef typename Base::PointerType PointerType;
+            typedef typename Base::ConstPointerType ConstPointerType;
+
+            typedef typename Base::StorageType StorageType;
+            typedef typename Base::SlotType SlotType;
+            typedef typename Base::HasherType HasherType;
+            typedef typename Base::KeyEqualType KeyEqualType;
+
+            /// @brief Constructor that uses external buffers
+            /// @param slots Pointer to the external slots
+            /// @param control Pointer to the external control bytes
+            /// @param capacity Number of slots
+            /// @param hasher Hash functor
+            /// @param equal Key equality functor
+            HashMap(SlotType* slots, uint8_t* control, SizeType capacity, const HasherType& hasher = HasherType(), const KeyEqualType& equal = KeyEqualType()) :
+                Base(StorageType(slots, capacity), control, hasher, equal) {}
+
+            /// @brief Copy constructor that uses external buffers
+            /// @param other The map to copy from
+            /// @param slots Pointer to the external slots
+            /// @param control Pointer to the external control bytes
+            /// @param capacity Number of slots
+            /// @throws `LengthError` if the map's capacity is exceeded
+            HashMap(const HashMap& other, SlotType* slots, uint8_t* control, SizeType capacity) :
+                Base(StorageType(slots, capacity), control, other.HashFunction(), other.KeyEq()) {
+                this->InsertUnique(other.Begin(), other.End());
+            }
+
+            #ifdef __WSTL_CXX11__
+            /// @brief Move constructor that uses external buffers
+            /// @param other The map to move from
+            /// @param slots Pointer to the external slots
+            /// @param control Pointer to the external control bytes
+            /// @param capacity Number of slots
+            /// @throws `LengthError` if the map's capacity is exceeded
+            /// @since C++11
+            HashMap(HashMap&& other, SlotType* slots, uint8_t* control, SizeType capacity) :
+                Base(StorageType(slots, capacity), control, other.HashFunction(), other.KeyEq()) {
+                this->InsertUnique(MakeMoveIterator(other.Begin()), MakeMoveIterator(other.End()));
+            }
+            #endif
+
+            /// @brief Copy assignment operator
+            /// @param other The map to copy from
+            HashMap& operator=(const HashMap& other) {
+                Base::operator=(other);
+                return *this;
+            }
+
+            #ifdef __WSTL_CXX11__
+            /// @brief Move assignment operator
+            /// @param other The map to move from
+            /// @since C++11
+            HashMap& operator=(HashMap&& other) {
+                Base::operator=(Move(other));
+                return *this;
+            }
+            #endif
+        };
+
+        /// @brief Version of hash map that uses fixed external storage with compile-time known capacity
+        /// @tparam Key Type of the keys
+        /// @tparam T Type of the mapped values
+        /// @tparam N Number of slots
+        /// @tparam Hasher Hash functor for the keys
+        /// @tparam KeyEqual Equality functor for the keys
+        /// @details The slots are an array of `SlotType` of `N` elements and the control bytes an array of `N + ControlPadding` bytes
+        /// @ingroup hash_map
+        template<typename Key, typename T, size_t N, typename Hasher = Hash<Key>, typename KeyEqual = EqualTo<Key> >
+        class FixedHashMap : public BasicHashMap<Key, T, FixedExternalStorage<__private::__HashSlot<Pair<const Key, T> >, N>, Hasher, KeyEqual> {
+        private:
+            typedef BasicHashMap<Key, T, FixedExternalStorage<__private::__HashSlot<Pair<const Key, T> >, N>, Hasher, KeyEqual> Base;
+
+        public:
+            typedef typename Base::KeyType KeyType;
+            typedef typename Base::MappedType MappedType;
+            typedef typename Base::ValueType ValueType;
+            typedef typename Base::SizeType SizeType;
+            typedef typename Base::DifferenceType DifferenceType;
+            typedef typename Base::ReferenceType ReferenceType;
+            typedef typename Base::ConstReferenceType ConstReferenceType;
+            typedef typename Base::PointerType PointerType;
+            typedef typename Base::ConstPointerType ConstPointerType;
+
+            typedef typename Base::StorageType StorageType;
+            typedef typename Base::SlotType SlotType;
+            typedef typename Base::HasherType HasherType;
+            typedef typename Base::KeyEqualType KeyEqualType;
+
+            /// @brief The static size, needed for metaprogramming
+            static const __WSTL_CONSTEXPR__ SizeType StaticSize = N;
+
+            /// @brief Constructor that uses external buffers
+            /// @param slots Pointer to the external slots
+            /// @param control Pointer to the external control bytes
+            /// @param hasher Hash functor
+            /// @param equal Key equality functor
+            FixedHashMap(SlotType* slots, uint8_t* control, const HasherType& hasher = HasherType(), const KeyEqualType& equal = KeyEqualType()) :
+                Base(StorageType(slots), control, hasher, equal) {}
+
+            /// @brief Copy constructor that uses external buffers
+            /// @param other The map to copy from
+            /// @param slots Pointer to the external slots
+            /// @param control Pointer to the external control bytes
+            FixedHashMap(const FixedHashMap& other, SlotType* slots, uint8_t* control) :
+                Base(StorageType(slots), control, other.HashFunction(), other.KeyEq()) {
+                this->InsertUnique(other.Begin(), other.End());
+            }
+
+            #ifdef __WSTL_CXX11__
+            /// @brief Move constructor that uses external buffers
+            /// @param other The map to move from
+            /// @param slots Pointer to the external slots
+            /// @param control Pointer to the external control bytes
+            /// @since C++11
+            FixedHashMap(FixedHashMap&& other, SlotType* slots, uint8_t* control) :
+                Base(StorageType(slots), control, other.HashFunction(), other.KeyEq()) {
+                this->InsertUnique(MakeMoveIterator(other.Begin()), MakeMoveIterator(other.End()));
+            }
+            #endif
+
+            /// @brief Copy assignment operator
+            /// @param other The map to copy from
+            FixedHashMap& operator=(const FixedHashMap& other) {
+                Base::operator=(other);
+                return *this;
+            }
+
+            #ifdef __WSTL_CXX11__
+            /// @brief Move assignment operator
+            /// @param other The map to move from
+            /// @since C++11
+            FixedHashMap& operator=(FixedHashMap&& other) {
+                Base::operator=(Move(other));
+                return *this;
+            }
+            #endif
+        };
+
+        template<typename Key, typename T, size_t N, typename Hasher, typename KeyEqual>
+        const __WSTL_CONSTEXPR__ typename FixedHashMap<Key, T, N, Hasher, KeyEqual>::SizeType FixedHashMap<Key, T, N, Hasher, KeyEqual>::StaticSize;
+    }
+}
+
+#endif
\ No newline at end of file
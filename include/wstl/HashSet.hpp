@@ -0,0 +1,444 @@
+// Part of WardenSTL - https://github.com/WardenHD/WardenSTL
+// Copyright (c) 2025 Artem Bezruchko (WardenHD)
+//
+// Licensed under the MIT License. See LICENSE file for details.
+
+#ifndef __WSTL_HASHSET_HPP__
+#define __WSTL_HASHSET_HPP__
+
+#include "private/Platform.hpp"
+#include "private/HashTable.hpp"
+#include "Container.hpp"
+#include "Hash.hpp"
+#include "Functional.hpp"
+#include "InitializerList.hpp"
+#include "StandardExceptions.hpp"
+#include "Utility.hpp"
+
+
+/// @defgroup hash_set Hash set
+/// @ingroup containers
+/// @brief Open-addressing hash set container
+
+namespace wstl {
+    // Basic hash set
+
+    /// @brief Associative container of unique keys, stored in an open-addressing hash table
+    /// @tparam Key Type of the keys
+    /// @tparam Storage Storage of `SlotType` used by the set
+    /// @tparam Hasher Hash functor for the keys
+    /// @tparam KeyEqual Equality functor for the keys
+    /// @details Uses the same table as `BasicHashMap`, see there for the layout. Elements are
+    /// immutable, since changing a key would move it to another slot
+    /// @ingroup hash_set
+    template<typename Key, typename Storage, typename Hasher = Hash<Key>, typename KeyEqual = EqualTo<Key> >
+    class BasicHashSet : public __private::__HashTable<__private::__HashSetTraits<Key>, Storage, Hasher, KeyEqual> {
+    private:
+        typedef __private::__HashTable<__private::__HashSetTraits<Key>, Storage, Hasher, KeyEqual> Base;
+        typedef typename Base::Probe Probe;
+        typedef Key MutableValueType;
+
+    public:
+        WSTL_STATIC_ASSERT(!IsVoid<Storage>::Value, "Storage must be non-void");
+
+        typedef typename Base::KeyType KeyType;
+        typedef typename Base::ValueType ValueType;
+        typedef typename Base::SizeType SizeType;
+        typedef typename Base::DifferenceType DifferenceType;
+        typedef typename Base::ReferenceType ReferenceType;
+        typedef typename Base::ConstReferenceType ConstReferenceType;
+        typedef typename Base::PointerType PointerType;
+        typedef typename Base::ConstPointerType ConstPointerType;
+
+        typedef typename Base::StorageType StorageType;
+        typedef typename Base::SlotType SlotType;
+        typedef typename Base::HasherType HasherType;
+        typedef typename Base::KeyEqualType KeyEqualType;
+
+        typedef typename Base::Iterator Iterator;
+        typedef typename Base::ConstIterator ConstIterator;
+
+        /// @brief Copy assignment operator
+        /// @param other The set to copy from
+        /// @throws `LengthError` if the set's capacity is exceeded
+        BasicHashSet& operator=(const BasicHashSet& other) {
+            if(this != &other) {
+                this->Clear();
+                this->InsertUnique(other.Begin(), other.End());
+            }
+
+            return *this;
+        }
+
+        #ifdef __WSTL_CXX11__
+        /// @brief Move assignment operator
+        /// @param other The set to move from
+        /// @throws `LengthError` if the set's capacity is exceeded
+        /// @since C++11
+        BasicHashSet& operator=(BasicHashSet&& other) {
+            if(this != &other) {
+                this->Clear();
+                this->InsertUnique(MakeMoveIterator(other.Begin()), MakeMoveIterator(other.End()));
+            }
+
+            return *this;
+        }
+        #endif
+
+        /// @brief Inserts a key if it is not in the set
+        /// @param value The key to insert
+        /// @return Pair of iterator to the key in the set and whether the key was inserted
+        /// @throws `LengthError` if the set is full
+        Pair<Iterator, bool> Insert(const KeyType& value) {
+            const Probe probe = this->Prepare(value);
+            if(probe.Index == this->NoIndex()) return Pair<Iterator, bool>(this->End(), false);
+
+            if(!probe.Found) {
+                ::new(this->RawAt(probe.Index)) MutableValueType(value);
+                this->Commit(probe);
+            }
+
+            return Pair<Iterator, bool>(this->IteratorAt(probe.Index), !probe.Found);
+        }
+
+        #ifdef __WSTL_CXX11__
+        /// @brief Inserts a key if it is not in the set
+        /// @param value The key to insert (rvalue reference)
+        /// @return Pair of iterator to the key in the set and whether the key was inserted
+        /// @throws `LengthError` if the set is full
+        /// @since C++11
+        Pair<Iterator, bool> Insert(KeyType&& value) {
+            const Probe probe = this->Prepare(value);
+            if(probe.Index == this->NoIndex()) return Pair<Iterator, bool>(this->End(), false);
+
+            if(!probe.Found) {
+                ::new(this->RawAt(probe.Index)) MutableValueType(Move(value));
+                this->Commit(probe);
+            }
+
+            return Pair<Iterator, bool>(this->IteratorAt(probe.Index), !probe.Found);
+        }
+        #endif
+
+        /// @brief Inserts a range of keys, skipping keys that are already in the set
+        /// @param first Iterator to the first key in the range
+        /// @param last Iterator to the key following the last key in the range
+        /// @throws `LengthError` if the set is full
+        template<typename InputIterator>
+        void Insert(InputIterator first, InputIterator last) {
+            for(; first != last; ++first) Insert(*first);
+        }
+
+        #if defined(__WSTL_CXX11__) && !defined(__WSTL_NO_INITIALIZERLIST__)
+        /// @brief Inserts keys from an initializer list, skipping keys that are already in the set
+        /// @param list The initializer list to insert
+        /// @throws `LengthError` if the set is full
+        /// @since C++11
+        void Insert(InitializerList<KeyType> list) {
+            Insert(list.Begin(), list.End());
+        }
+
+        /// @brief Constructs a key and inserts it if it is not in the set
+        /// @param ...args The arguments to forward to the constructor of the key
+        /// @return Pair of iterator to the key in the set and whether the key was inserted
+        /// @throws `LengthError` if the set is full
+        /// @since C++11
+        template<typename... Args>
+        Pair<Iterator, bool> Emplace(Args&&... args) {
+            return Insert(KeyType(Forward<Args>(args)...));
+        }
+        #endif
+
+    protected:
+        /// @brief Constructor, only for default-constructible storage
+        /// @param control Control bytes, one per slot and `ControlPadding` more
+        /// @param hasher Hash functor
+        /// @param equal Key equality functor
+        BasicHashSet(uint8_t* control, const HasherType& hasher, const KeyEqualType& equal) : Base(control, hasher, equal) {}
+
+        /// @brief Constructor with custom storage, only for non-default-constructible storage
+        /// @param storage Storage for the slots
+        /// @param control Control bytes, one per slot and `ControlPadding` more
+        /// @param hasher Hash functor
+        /// @param equal Key equality functor
+        BasicHashSet(const StorageType& storage, uint8_t* control, const HasherType& hasher, const KeyEqualType& equal) : Base(storage, control, hasher, equal) {}
+    };
+
+    // Comparison operators
+
+    template<typename Key, typename Storage, typename Hasher, typename KeyEqual>
+    inline bool operator==(const BasicHashSet<Key, Storage, Hasher, KeyEqual>& a, const BasicHashSet<Key, Storage, Hasher, KeyEqual>& b) {
+        if(a.Size() != b.Size()) return false;
+
+        typedef typename BasicHashSet<Key, Storage, Hasher, KeyEqual>::ConstIterator ConstIterator;
+        for(ConstIterator it = a.Begin(); it != a.End(); ++it) if(!b.Contains(*it)) return false;
+
+        return true;
+    }
+
+    template<typename Key, typename Storage, typename Hasher, typename KeyEqual>
+    inline bool operator!=(const BasicHashSet<Key, Storage, Hasher, KeyEqual>& a, const BasicHashSet<Key, Storage, Hasher, KeyEqual>& b) {
+        return !(a == b);
+    }
+
+    // Hash set
+
+    /// @brief Version of hash set with fixed storage, default option
+    /// @tparam Key Type of the keys
+    /// @tparam N Number of slots
+    /// @tparam Hasher Hash functor for the keys
+    /// @tparam KeyEqual Equality functor for the keys
+    /// @ingroup hash_set
+    template<typename Key, size_t N, typename Hasher = Hash<Key>, typename KeyEqual = EqualTo<Key> >
+    class HashSet : private __private::__HashControl<N>,
+        public BasicHashSet<Key, FixedStorage<__private::__HashSlot<const Key>, N>, Hasher, KeyEqual> {
+    private:
+        typedef __private::__HashControl<N> ControlBase;
+        typedef BasicHashSet<Key, FixedStorage<__private::__HashSlot<const Key>, N>, Hasher, KeyEqual> Base;
+
+    public:
+        typedef typename Base::KeyType KeyType;
+        typedef typename Base::ValueType ValueType;
+        typedef typename Base::SizeType SizeType;
+        typedef typename Base::DifferenceType DifferenceType;
+        typedef typename Base::ReferenceType ReferenceType;
+        typedef typename Base::ConstReferenceType ConstReferenceType;
+        typedef typename Base::PointerType PointerType;
+        typedef typename Base::ConstPointerType ConstPointerType;
+
+        typedef typename Base::StorageType StorageType;
+        typedef typename Base::HasherType HasherType;
+        typedef typename Base::KeyEqualType KeyEqualType;
+
+        /// @brief The static size, needed for metaprogramming
+        static const __WSTL_CONSTEXPR__ SizeType StaticSize = N;
+
+        /// @brief Default constructor
+        /// @param hasher Hash functor
+        /// @param equal Key equality functor
+        explicit HashSet(const HasherType& hasher = HasherType(), const KeyEqualType& equal = KeyEqualType()) :
+            ControlBase(), Base(ControlBase::Control, hasher, equal) {}
+
+        /// @brief Copy constructor
+        /// @param other The set to copy from
+        HashSet(const HashSet& other) : ControlBase(), Base(ControlBase::Control, other.HashFunction(), other.KeyEq()) {
+            this->InsertUnique(other.Begin(), other.End());
+        }
+
+        #ifdef __WSTL_CXX11__
+        /// @brief Move constructor
+        /// @param other The set to move from
+        /// @since C++11
+        HashSet(HashSet&& other) : ControlBase(), Base(ControlBase::Control, other.HashFunction(), other.KeyEq()) {
+            this->InsertUnique(MakeMoveIterator(other.Begin()), MakeMoveIterator(other.End()));
+        }
+        #endif
+
+        /// @brief Constructor that initializes the set with a range of elements
+        /// @param first Iterator to the first element in the range
+        /// @param last Iterator to the element following the last element in the range
+        /// @param hasher Hash functor
+        /// @param equal Key equality functor
+        /// @throws `LengthError` if the set's capacity is exceeded
+        template<typename InputIterator>
+        HashSet(InputIterator first, InputIterator last, const HasherType& hasher = HasherType(), const KeyEqualType& equal = KeyEqualType()) :
+            ControlBase(), Base(ControlBase::Control, hasher, equal) {
+            this->Insert(first, last);
+        }
+
+        #if defined(__WSTL_CXX11__) && !defined(__WSTL_NO_INITIALIZERLIST__)
+        /// @brief Constructor that initializes the set with an initializer list
+        /// @param list The initializer list to initialize the set with
+        /// @param hasher Hash functor
+        /// @param equal Key equality functor
+        /// @throws `LengthError` if the set's capacity is exceeded
+        /// @since C++11
+        HashSet(InitializerList<KeyType> list, const HasherType& hasher = HasherType(), const KeyEqualType& equal = KeyEqualType()) :
+            ControlBase(), Base(ControlBase::Control, hasher, equal) {
+            this->Insert(list.Begin(), list.End());
+        }
+        #endif
+
+        /// @brief Copy assignment operator
+        /// @param other The set to copy from
+        HashSet& operator=(const HashSet& other) {
+            Base::operator=(other);
+            return *this;
+        }
+
+        #ifdef __WSTL_CXX11__
+        /// @brief Move assignment operator
+        /// @param other The set to move from
+        /// @since C++11
+        HashSet& operator=(HashSet&& other) {
+            Base::operator=(Move(other));
+            return *this;
+        }
+        #endif
+    };
+
+    template<typename Key, size_t N, typename Hasher, typename KeyEqual>
+    const __WSTL_CONSTEXPR__ typename HashSet<Key, N, Hasher, KeyEqual>::SizeType HashSet<Key, N, Hasher, KeyEqual>::StaticSize;
+
+    namespace external {
+        /// @brief Version of hash set that uses external storage
+        /// @tparam Key Type of the keys
+        /// @tparam Hasher Hash functor for the keys
+        /// @tparam KeyEqual Equality functor for the keys
+        /// @details The slots are an array of `SlotType` of `capacity` elements and the control bytes an array of `capacity + ControlPadding` bytes
+        /// @ingroup hash_set
+        template<typename Key, typename Hasher = Hash<Key>, typename KeyEqual = EqualTo<Key> >
+        class HashSet : public BasicHashSet<Key, ExternalStorage<__private::__HashSlot<const Key> >, Hasher, KeyEqual> {
+        private:
+            typedef BasicHashSet<Key, ExternalStorage<__private::__HashSlot<const Key> >, Hasher, KeyEqual> Base;
+
+        public:
+            typedef typename Base::KeyType KeyType;
+                typedef typename Base::ValueType ValueType;
+            typedef typename Base::SizeType SizeType;
+            typedef typename Base::DifferenceType DifferenceType;
+            typedef typename Base::ReferenceType ReferenceType;
+            typedef typename Base::ConstReferenceType ConstReferenceType;
+            typedef typename Base::PointerType PointerType;
+            typedef typename Base::ConstPointerType ConstPointerType;
+
+            typedef typename Base::StorageType StorageType;
+            typedef typename Base::SlotType SlotType;
+            typedef typename Base::HasherType HasherType;
+            typedef typename Base::KeyEqualType KeyEqualType;
+
+            /// @brief Constructor that uses external buffers
+            /// @param slots Pointer to the external slots
+            /// @param control Pointer to the external control bytes
+            /// @param capacity Number of slots
+            /// @param hasher Hash functor
+            /// @param equal Key equality functor
+            HashSet(SlotType* slots, uint8_t* control, SizeType capacity, const HasherType& hasher = HasherType(), const KeyEqualType& equal = KeyEqualType()) :
+                Base(StorageType(slots, capacity), control, hasher, equal) {}
+
+            /// @brief Copy constructor that uses external buffers
+            /// @param other The set to copy from
+            /// @param slots Pointer to the external slots
+            /// @param control Pointer to the external control bytes
+            /// @param capacity Number of slots
+            /// @throws `LengthError` if the set's capacity is exceeded
+            HashSet(const HashSet& other, SlotType* slots, uint8_t* control, SizeType capacity) :
+                Base(StorageType(slots, capacity), control, other.HashFunction(), other.KeyEq()) {
+                this->InsertUnique(other.Begin(), other.End());
+            }
+
+            #ifdef __WSTL_CXX11__
+            /// @brief Move constructor that uses external buffers
+            /// @param other The set to move from
+            /// @param slots Pointer to the external slots
+            /// @param control Pointer to the external control bytes
+            /// @param capacity Number of slots
+            /// @throws `LengthError` if the set's capacity is exceeded
+            /// @since C++11
+            HashSet(HashSet&& other, SlotType* slots, uint8_t* control, SizeType capacity) :
+                Base(StorageType(slots, capacity), control, other.HashFunction(), other.KeyEq()) {
+                this->InsertUnique(MakeMoveIterator(other.Begin()), MakeMoveIterator(other.End()));
+            }
+            #endif
+
+            /// @brief Copy assignment operator
+            /// @param other The set to copy from
+            HashSet& operator=(const HashSet& other) {
+                Base::operator=(other);
+                return *this;
+            }
+
+            #ifdef __WSTL_CXX11__
+            /// @brief Move assignment operator
+            /// @param other The set to move from
+            /// @since C++11
+            HashSet& operator=(HashSet&& other) {
+                Base::operator=(Move(other));
+                return *this;
+            }
+            #endif
+        };
+
+        /// @brief Version of hash set that uses fixed external storage with compile-time known capacity
+        /// @tparam Key Type of the keys
+        /// @tparam N Number of slots
+        /// @tparam Hasher Hash functor for the keys
+        /// @tparam KeyEqual Equality functor for the keys
+        /// @details The slots are an array of `SlotType` of `N` elements and the control bytes an array of `N + ControlPadding` bytes
+        /// @ingroup hash_set
+        template<typename Key, size_t N, typename Hasher = Hash<Key>, typename KeyEqual = EqualTo<Key> >
+        class FixedHashSet : public BasicHashSet<Key, FixedExternalStorage<__private::__HashSlot<const Key>, N>, Hasher, KeyEqual> {
+        private:
+            typedef BasicHashSet<Key, FixedExternalStorage<__private::__HashSlot<const Key>, N>, Hasher, KeyEqual> Base;
+
+        public:
+            typedef typename Base::KeyType KeyType;
+                typedef typename Base::ValueType ValueType;
+            typedef typename Base::SizeType SizeType;
+            typedef typename Base::DifferenceType DifferenceType;
+            typedef typename Base::ReferenceType ReferenceType;
+            typedef typename Base::ConstReferenceType ConstReferenceType;
+            typedef typename Base::PointerType PointerType;
+            typedef typename Base::ConstPointerType ConstPointerType;
+
+            typedef typename Base::StorageType StorageType;
+            typedef typename Base::SlotType SlotType;
+            typedef typename Base::HasherType HasherType;
+            typedef typename Base::KeyEqualType KeyEqualType;
+
+            /// @brief The static size, needed for metaprogramming
+            static const __WSTL_CONSTEXPR__ SizeType StaticSize = N;
+
+            /// @brief Constructor that uses external buffers
+            /// @param slots Pointer to the external slots
+            /// @param control Pointer to the external control bytes
+            /// @param hasher Hash functor
+            /// @param equal Key equality functor
+            FixedHashSet(SlotType* slots, uint8_t* control, const HasherType& hasher = HasherType(), const KeyEqualType& equal = KeyEqualType()) :
+                Base(StorageType(slots), control, hasher, equal) {}
+
+            /// @brief Copy constructor that uses external buffers
+            /// @param other The set to copy from
+            /// @param slots Pointer to the external slots
+            /// @param control Pointer to the external control bytes
+            FixedHashSet(const FixedHashSet& other, SlotType* slots, uint8_t* control) :
+                Base(StorageType(slots), control, other.HashFunction(), other.KeyEq()) {
+                this->InsertUnique(other.Begin(), other.End());
+            }
+
+            #ifdef __WSTL_CXX11__
+            /// @brief Move constructor that uses external buffers
+            /// @param other The set to move from
+            /// @param slots Pointer to the external slots
+            /// @param control Pointer to the external control bytes
+            /// @since C++11
+            FixedHashSet(FixedHashSet&& other, SlotType* slots, uint8_t* control) :
+                Base(StorageType(slots), control, other.HashFunction(), other.KeyEq()) {
+                this->InsertUnique(MakeMoveIterator(other.Begin()), MakeMoveIterator(other.End()));
+            }
+            #endif
+
+            /// @brief Copy assignment operator
+            /// @param other The set to copy from
+            FixedHashSet& operator=(const FixedHashSet& other) {
+                Base::operator=(other);
+                return *this;
+            }
+
+            #ifdef __WSTL_CXX11__
+            /// @brief Move assignment operator
+            /// @param other The set to move from
+            /// @since C++11
+            FixedHashSet& operator=(FixedHashSet&& other) {
+                Base::operator=(Move(other));
+                return *this;
+            }
+            #endif
+        };
+
+        template<typename Key, size_t N, typename Hasher, typename KeyEqual>
+        const __WSTL_CONSTEXPR__ typename FixedHashSet<Key, N, Hasher, KeyEqual>::SizeType FixedHashSet<Key, N, Hasher, KeyEqual>::StaticSize;
+    }
+}
+
+#endif
\ No newline at end of file
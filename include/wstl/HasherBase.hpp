@@ -8,9 +8,21 @@
 
 #include "private/Platform.hpp"
 #include "Iterator.hpp"
+#include "TypeTraits.hpp"
+#include <stddef.h>
+#include <stdint.h>
 
 
 namespace wstl {
+    namespace __private {
+        /// @brief Checks whether an iterator is a pointer to a contiguous range of bytes
+        template<typename Iterator>
+        struct __IsByteBlockIterator : FalseType {};
+
+        template<typename T>
+        struct __IsByteBlockIterator<T*> : BoolConstant<IsIntegral<T>::Value && sizeof(T) == 1> {};
+    }
+
     /// @brief Base class for hash/checksum algorithms
     /// @tparam Derived The derived class that implements the hashing logic
     /// @tparam THash The type of the hash value, typically an unsigned integer type
@@ -33,11 +45,22 @@ namespace wstl {
         }
 
         /// @brief Appends a range to the hasher
+        /// @details Contiguous byte ranges (pointers, and therefore iterators of `Span`, `Array`
+        /// and `BasicString`) are forwarded to the `AppendBlock` method of the derived class
         /// @param first The beginning of the range
         /// @param last The end of the range
         template<typename InputIterator>
         __WSTL_CONSTEXPR14__ void Append(InputIterator first, InputIterator last) {
-            for(; first != last; ++first) PushBack(*first);
+            AppendRange(first, last, BoolConstant<sizeof(ValueType) == 1 && 
+                __private::__IsByteBlockIterator<InputIterator>::Value>());
+        }
+
+        /// @brief Appends a contiguous block of bytes to the hasher
+        /// @details The derived class may implement `AppendBlock` to process the block in bulk
+        /// @param data Pointer to the beginning of the block
+        /// @param size Size of the block in bytes
+        __WSTL_CONSTEXPR14__ void Append(const uint8_t* data, size_t size) {
+            static_cast<Derived*>(this)->AppendBlock(data, size);
         }
 
         #ifdef __WSTL_CXX11__
@@ -45,7 +68,7 @@ namespace wstl {
         /// @param container The container whose elements will be hashed
         template<typename Container>
         __WSTL_CONSTEXPR14__ void Append(Container&& container) {
-            Append(MakeMoveIterator(container.Begin()), MakeMoveIterator(container.End()));
+            Append(container.Begin(), container.End());
         }
         #else
         /// @brief Appends a container to the hasher
@@ -87,7 +110,30 @@ namespace wstl {
         HashType m_Hash;
 
         /// @brief Default constructor
-        __WSTL_CONSTEXPR14__ HasherBase() {}
+        __WSTL_CONSTEXPR14__ HasherBase() : m_Hash() {}
+
+        /// @brief Default bulk routine, pushes the block byte by byte
+        /// @details Derived classes shadow this method to process the block word at a time
+        /// @param data Pointer to the beginning of the block
+        /// @param size Size of the block in bytes
+        __WSTL_CONSTEXPR14__ void AppendBlock(const uint8_t* data, size_t size) {
+            for(const uint8_t* end = data + size; data != end; ++data) static_cast<Derived*>(this)->PushBack(*data);
+        }
+
+    private:
+        template<typename InputIterator>
+        __WSTL_CONSTEXPR14__ void AppendRange(InputIterator first, InputIterator last, FalseType) {
+            for(; first != last; ++first) PushBack(*first);
+        }
+
+        __WSTL_CONSTEXPR14__ void AppendRange(const uint8_t* first, const uint8_t* last, TrueType) {
+            static_cast<Derived*>(this)->AppendBlock(first, static_cast<size_t>(last - first));
+        }
+
+        template<typename T>
+        void AppendRange(T* first, T* last, TrueType) {
+            static_cast<Derived*>(this)->AppendBlock(reinterpret_cast<const uint8_t*>(first), static_cast<size_t>(last - first));
+        }
     };
 }
 
@@ -0,0 +1,267 @@
+// Part of WardenSTL - https://github.com/WardenHD/WardenSTL
+// Copyright (c) 2025 Artem Bezruchko (WardenHD)
+//
+// Licensed under the MIT License. See LICENSE file for details.
+
+#ifndef __WSTL_HIERARCHICALBITSET_HPP__
+#define __WSTL_HIERARCHICALBITSET_HPP__
+
+#include "private/Platform.hpp"
+#include "StaticAssert.hpp"
+#include "Limits.hpp"
+#include "Bit.hpp"
+#include <stddef.h>
+
+
+namespace wstl {
+    // Hierarchical bitset
+
+    /// @brief Fixed-size sequence of bits with summary levels that find set and cleared bits in constant time
+    /// @tparam N Number of bits, at most the cube of the bits in `size_t`
+    /// @details Bits are stored in native words (leaves). One summary level records which leaves
+    /// have any bit set and which have all bits set, and a root word does the same for the summary
+    /// words. `FindFirst` and `FindNext` inspect at most one word per level, whatever the fill
+    /// level, at the cost of an extra bit of summary per leaf. `Set` and `Reset` update the
+    /// summaries with a few more word operations
+    /// @ingroup bitset
+    template<size_t N>
+    class HierarchicalBitset {
+    public:
+        typedef size_t SizeType;
+        typedef size_t ElementType;
+
+        /// @brief Special constant indicating no position with value `SizeType(-1)`
+        static const __WSTL_CONSTEXPR__ SizeType NoPosition = NumericLimits<SizeType>::Max();
+
+    private:
+        static const __WSTL_CONSTEXPR__ SizeType BitsPerElement = sizeof(ElementType) * 8;
+        static const __WSTL_CONSTEXPR__ ElementType AllSet = NumericLimits<ElementType>::Max();
+        static const __WSTL_CONSTEXPR__ SizeType LeafCount = (N + BitsPerElement - 1) / BitsPerElement;
+        static const __WSTL_CONSTEXPR__ SizeType SummaryCount = (LeafCount + BitsPerElement - 1) / BitsPerElement;
+
+    public:
+        WSTL_STATIC_ASSERT(N != 0, "Hierarchical bitset must not be empty");
+        WSTL_STATIC_ASSERT(SummaryCount <= BitsPerElement, "Hierarchical bitset is too large for three levels");
+
+        /// @brief Default constructor, all bits are cleared
+        HierarchicalBitset() {
+            Reset();
+        }
+
+        /// @brief Gets the number of bits
+        __WSTL_CONSTEXPR__ SizeType Size() const __WSTL_NOEXCEPT__ {
+            return N;
+        }
+
+        /// @brief Gets the value of a bit
+        /// @param position Position of the bit
+        bool Test(SizeType position) const __WSTL_NOEXCEPT__ {
+            return (m_Leaves[position / BitsPerElement] & Bit(position % BitsPerElement)) != 0;
+        }
+
+        /// @brief Gets the value of a bit
+        /// @param position Position of the bit
+        bool operator[](SizeType position) const __WSTL_NOEXCEPT__ {
+            return Test(position);
+        }
+
+        /// @brief Checks if all bits are set
+        bool All() const __WSTL_NOEXCEPT__ {
+            return (m_FullRoot | RootPadding()) == AllSet;
+        }
+
+        /// @brief Checks if any bit is set
+        bool Any() const __WSTL_NOEXCEPT__ {
+            return m_UsedRoot != 0;
+        }
+
+        /// @brief Checks if no bit is set
+        bool None() const __WSTL_NOEXCEPT__ {
+            return m_UsedRoot == 0;
+        }
+
+        /// @brief Sets a bit
+        /// @param position Position of the bit
+        /// @param value Value to set
+        HierarchicalBitset& Set(SizeType position, bool value = true) __WSTL_NOEXCEPT__ {
+            if(!value) return Reset(position);
+
+            const SizeType leaf = position / BitsPerElement;
+            const SizeType summary = leaf / BitsPerElement;
+
+            m_Leaves[leaf] |= Bit(position % BitsPerElement);
+            m_Used[summary] |= Bit(leaf % BitsPerElement);
+            m_UsedRoot |= Bit(summary);
+
+            if((m_Leaves[leaf] | LeafPadding(leaf)) == AllSet) {
+                m_Full[summary] |= Bit(leaf % BitsPerElement);
+                if((m_Full[summary] | SummaryPadding(summary)) == AllSet) m_FullRoot |= Bit(summary);
+            }
+
+            return *this;
+        }
+
+        /// @brief Clears a bit
+        /// @param position Position of the bit
+        HierarchicalBitset& Reset(SizeType position) __WSTL_NOEXCEPT__ {
+            const SizeType leaf = position / BitsPerElement;
+            const SizeType summary = leaf / BitsPerElement;
+
+            m_Leaves[leaf] &= ~Bit(position % BitsPerElement);
+            m_Full[summary] &= ~Bit(leaf % BitsPerElement);
+            m_FullRoot &= ~Bit(summary);
+
+            if(m_Leaves[leaf] == 0) {
+                m_Used[summary] &= ~Bit(leaf % BitsPerElement);
+                if(m_Used[summary] == 0) m_UsedRoot &= ~Bit(summary);
+            }
+
+            return *this;
+        }
+
+        /// @brief Clears all bits
+        HierarchicalBitset& Reset() __WSTL_NOEXCEPT__ {
+            for(SizeType i = 0; i < LeafCount; ++i) m_Leaves[i] = 0;
+
+            for(SizeType i = 0; i < SummaryCount; ++i) {
+                m_Used[i] = 0;
+                m_Full[i] = 0;
+            }
+
+            m_UsedRoot = 0;
+            m_FullRoot = 0;
+            return *this;
+        }
+
+        /// @brief Finds the first bit equal to the given value
+        /// @param value Value of the bit to find
+        /// @return Position of the first occurrence of the specified bit value, or `NoPosition` if not found
+        SizeType FindFirst(bool value) const __WSTL_NOEXCEPT__ {
+            return value ? Find<true>(0) : Find<false>(0);
+        }
+
+        /// @brief Finds the first bit equal to the given value
+        /// @tparam Value Value of the bit to find
+        /// @return Position of the first occurrence of the specified bit value, or `NoPosition` if not found
+        template<bool Value>
+        SizeType FindFirst() const __WSTL_NOEXCEPT__ {
+            return Find<Value>(0);
+        }
+
+        /// @brief Finds the next bit equal to the given value after a position
+        /// @param position Position to start searching after
+        /// @param value Value of the bit to find
+        /// @return Position of the next occurrence of the specified bit value, or `NoPosition` if not found
+        SizeType FindNext(SizeType position, bool value) const __WSTL_NOEXCEPT__ {
+            return value ? Find<true>(position + 1) : Find<false>(position + 1);
+        }
+
+        /// @brief Finds the next bit equal to the given value after a position
+        /// @tparam Value Value of the bit to find
+        /// @param position Position to start searching after
+        /// @return Position of the next occurrence of the specified bit value, or `NoPosition` if not found
+        template<bool Value>
+        SizeType FindNext(SizeType position) const __WSTL_NOEXCEPT__ {
+            return Find<Value>(position + 1);
+        }
+
+        /// @brief Calls a function with the position of every set bit in ascending order
+        /// @param function Unary functor that takes the position
+        /// @return The functor
+        /// @details Empty leaves are skipped through the summary, so the cost depends on the number of set bits
+        template<typename Function>
+        Function ForEachSet(Function function) const {
+            for(ElementType root = m_UsedRoot; root != 0; root &= root - 1) {
+                const SizeType summary = CountRightZero(root);
+
+                for(ElementType used = m_Used[summary]; used != 0; used &= used - 1) {
+                    const SizeType leaf = summary * BitsPerElement + CountRightZero(used);
+
+                    for(ElementType block = m_Leaves[leaf]; block != 0; block &= block - 1)
+                        function(leaf * BitsPerElement + CountRightZero(block));
+                }
+            }
+
+            return function;
+        }
+
+    private:
+        ElementType m_Leaves[LeafCount];
+        // Bit per leaf: any bit set, all bits set
+        ElementType m_Used[SummaryCount];
+        ElementType m_Full[SummaryCount];
+        // Bit per summary word: any bit set, all bits set
+        ElementType m_UsedRoot;
+        ElementType m_FullRoot;
+
+        static ElementType Bit(SizeType position) {
+            return ElementType(1) << position;
+        }
+
+        /// @brief Gets the bits above a position in a word
+        static ElementType Above(SizeType position) {
+            return position + 1 == BitsPerElement ? ElementType(0) : ElementType(AllSet << (position + 1));
+        }
+
+        // Bits past the end count as set, so the last word of a level can be full
+
+        static ElementType LeafPadding(SizeType leaf) {
+            return (leaf == LeafCount - 1 && N % BitsPerElement != 0) ? ElementType(AllSet << (N % BitsPerElement)) : ElementType(0);
+        }
+
+        static ElementType SummaryPadding(SizeType summary) {
+            return (summary == SummaryCount - 1 && LeafCount % BitsPerElement != 0) ? ElementType(AllSet << (LeafCount % BitsPerElement)) : ElementType(0);
+        }
+
+        static ElementType RootPadding() {
+            return SummaryCount % BitsPerElement != 0 ? ElementType(AllSet << (SummaryCount % BitsPerElement)) : ElementType(0);
+        }
+
+        // Words of each level with a bit set where the searched value can be found
+
+        template<bool Value>
+        ElementType Leaf(SizeType leaf) const {
+            return Value ? m_Leaves[leaf] : ElementType(~(m_Leaves[leaf] | LeafPadding(leaf)));
+        }
+
+        template<bool Value>
+        ElementType Summary(SizeType summary) const {
+            return Value ? m_Used[summary] : ElementType(~(m_Full[summary] | SummaryPadding(summary)));
+        }
+
+        template<bool Value>
+        ElementType Root() const {
+            return Value ? m_UsedRoot : ElementType(~(m_FullRoot | RootPadding()));
+        }
+
+        /// @brief Finds the first bit equal to the value at or after a position
+        template<bool Value>
+        SizeType Find(SizeType position) const {
+            if(position >= N) return NoPosition;
+
+            SizeType leaf = position / BitsPerElement;
+            const ElementType block = Leaf<Value>(leaf) & ElementType(AllSet << (position % BitsPerElement));
+            if(block != 0) return leaf * BitsPerElement + CountRightZero(block);
+
+            // Go up until a later word has a match, then down along the lowest matches
+            SizeType summary = leaf / BitsPerElement;
+            ElementType next = Summary<Value>(summary) & Above(leaf % BitsPerElement);
+
+            if(next == 0) {
+                const ElementType root = Root<Value>() & Above(summary);
+                if(root == 0) return NoPosition;
+
+                summary = CountRightZero(root);
+                next = Summary<Value>(summary);
+            }
+
+            leaf = summary * BitsPerElement + CountRightZero(next);
+            return leaf * BitsPerElement + CountRightZero(Leaf<Value>(leaf));
+        }
+    };
+
+    template<size_t N>
+    const __WSTL_CONSTEXPR__ typename HierarchicalBitset<N>::SizeType HierarchicalBitset<N>::NoPosition;
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,253 @@
+// Part of WardenSTL - https://github.com/WardenHD/WardenSTL
+// Copyright (c) 2025 Artem Bezruchko (WardenHD)
+//
+// Licensed under the MIT License. See LICENSE file for details.
+
+#ifndef __WSTL_INPLACEFUNCTION_HPP__
+#define __WSTL_INPLACEFUNCTION_HPP__
+
+#include "private/Platform.hpp"
+#include "TypeTraits.hpp"
+#include "Utility.hpp"
+#include "PlacementNew.hpp"
+#include "NullPointer.hpp"
+#include "StaticAssert.hpp"
+#include "Functional.hpp"
+#include "private/Error.hpp"
+#include <stddef.h>
+
+
+/// @defgroup inplace_function Inplace function
+/// @ingroup functional
+/// @brief Type-erased callable wrapper that stores its target inline
+
+#ifdef __WSTL_CXX11__
+namespace wstl {
+    namespace __private {
+        /// @brief Operations of the callable type stored in an inplace function
+        template<typename Return, typename... Args>
+        struct __InplaceFunctionOperations {
+            Return (*Invoke)(void*, Args&&...);
+            void (*Relocate)(void*, void*);
+            void (*Destroy)(void*);
+        };
+
+        /// @brief Implements the operations of an inplace function for a callable type
+        template<typename Callable, typename Return, typename... Args>
+        struct __InplaceFunctionHandler {
+            static Return Invoke(void* object, Args&&... args) {
+                return static_cast<Return>((*static_cast<Callable*>(object))(Forward<Args>(args)...));
+            }
+
+            static void Relocate(void* to, void* from) {
+                Callable* const source = static_cast<Callable*>(from);
+
+                ::new(to) Callable(Move(*source));
+                source->~Callable();
+            }
+
+            static void Destroy(void* object) {
+                static_cast<Callable*>(object)->~Callable();
+            }
+
+            static const __InplaceFunctionOperations<Return, Args...> Operations;
+        };
+
+        template<typename Callable, typename Return, typename... Args>
+        const __InplaceFunctionOperations<Return, Args...> __InplaceFunctionHandler<Callable, Return, Args...>::Operations = {
+            &__InplaceFunctionHandler::Invoke,
+            &__InplaceFunctionHandler::Relocate,
+            &__InplaceFunctionHandler::Destroy
+        };
+
+        /// @brief Default alignment of the inplace function storage, enough for pointers and scalars
+        struct __InplaceFunctionAlignment {
+            static const size_t PointerAlignment = AlignmentOf<void*>::Value;
+            static const size_t ScalarAlignment = AlignmentOf<double>::Value > AlignmentOf<long long>::Value ?
+                AlignmentOf<double>::Value : AlignmentOf<long long>::Value;
+
+            static const size_t Value = PointerAlignment > ScalarAlignment ? PointerAlignment : ScalarAlignment;
+        };
+
+        template<typename Callable>
+        inline bool __InplaceFunctionIsNull(const Callable&) {
+            return false;
+        }
+
+        template<typename Return, typename... Args>
+        inline bool __InplaceFunctionIsNull(Return (*function)(Args...)) {
+            return function == nullptr;
+        }
+    }
+
+    // Inplace function
+
+    /// @brief Type-erased callable wrapper that stores its target inline
+    /// @tparam Signature The signature of the callable (`int(int, double)`)
+    /// @tparam Capacity Number of bytes available for the callable
+    /// @tparam Alignment Alignment of the storage for the callable
+    /// @details Holds any callable - capturing lambdas, functors, function pointers - that fits in
+    /// `Capacity` bytes, without allocating. The callable is reached through a static table of
+    /// operations for its type, so the wrapper is one pointer larger than `Capacity`. Move-only,
+    /// moving relocates the callable and leaves the source empty
+    /// @ingroup inplace_function
+    /// @since C++11
+    /// @see https://www.open-std.org/jtc1/sc22/wg21/docs/papers/2016/p0352r0.pdf
+    template<typename Signature, size_t Capacity = 3 * sizeof(void*), size_t Alignment = __private::__InplaceFunctionAlignment::Value>
+    class InplaceFunction;
+
+    template<typename Return, typename... Args, size_t Capacity, size_t Alignment>
+    class InplaceFunction<Return(Args...), Capacity, Alignment> {
+    private:
+        typedef __private::__InplaceFunctionOperations<Return, Args...> OperationsType;
+
+        template<typename Callable>
+        struct IsCallable : BoolConstant<!IsSame<typename Decay<Callable>::Type, InplaceFunction>::Value &&
+            !IsSame<typename Decay<Callable>::Type, NullPointerType>::Value> {};
+
+    public:
+        typedef Return ResultType;
+
+        /// @brief Default constructor, creates an empty function
+        InplaceFunction() __WSTL_NOEXCEPT__ : m_Operations(nullptr) {}
+
+        /// @brief Constructor from a null pointer, creates an empty function
+        InplaceFunction(NullPointerType) __WSTL_NOEXCEPT__ : m_Operations(nullptr) {}
+
+        /// @brief Constructor that stores a callable
+        /// @param callable The callable to store, a null function pointer makes the function empty
+        template<typename Callable, typename = typename EnableIf<IsCallable<Callable>::Value>::Type>
+        InplaceFunction(Callable&& callable) : m_Operations(nullptr) {
+            Create(Forward<Callable>(callable));
+        }
+
+        /// @brief Move constructor
+        /// @param other The function to move from, empty afterwards
+        InplaceFunction(InplaceFunction&& other) __WSTL_NOEXCEPT__ : m_Operations(other.m_Operations) {
+            if(m_Operations != nullptr) {
+                m_Operations->Relocate(&m_Storage, &other.m_Storage);
+                other.m_Operations = nullptr;
+            }
+        }
+
+        /// @brief Deleted copy constructor, the stored callable may not be copyable
+        InplaceFunction(const InplaceFunction&) = delete;
+
+        /// @brief Destructor
+        ~InplaceFunction() {
+            Reset();
+        }
+
+        /// @brief Move assignment operator
+        /// @param other The function to move from, empty afterwards
+        InplaceFunction& operator=(InplaceFunction&& other) __WSTL_NOEXCEPT__ {
+            if(this != &other) {
+                Reset();
+
+                if(other.m_Operations != nullptr) {
+                    other.m_Operations->Relocate(&m_Storage, &other.m_Storage);
+                    m_Operations = other.m_Operations;
+                    other.m_Operations = nullptr;
+                }
+            }
+
+            return *this;
+        }
+
+        /// @brief Deleted copy assignment operator, the stored callable may not be copyable
+        InplaceFunction& operator=(const InplaceFunction&) = delete;
+
+        /// @brief Assignment from a null pointer, makes the function empty
+        InplaceFunction& operator=(NullPointerType) __WSTL_NOEXCEPT__ {
+            Reset();
+            return *this;
+        }
+
+        /// @brief Replaces the stored callable
+        /// @param callable The callable to store, a null function pointer makes the function empty
+        template<typename Callable, typename = typename EnableIf<IsCallable<Callable>::Value>::Type>
+        InplaceFunction& operator=(Callable&& callable) {
+            Reset();
+            Create(Forward<Callable>(callable));
+            return *this;
+        }
+
+        /// @brief Calls the stored callable
+        /// @param ...args The arguments to forward to the callable
+        /// @return The result of the call
+        /// @throws `BadFunctionCall` if the function is empty
+        Return operator()(Args... args) const {
+            __WSTL_ASSERT__(m_Operations != nullptr, WSTL_MAKE_EXCEPTION(BadFunctionCall));
+            return m_Operations->Invoke(&m_Storage, Forward<Args>(args)...);
+        }
+
+        /// @brief Checks if the function stores a callable
+        explicit operator bool() const __WSTL_NOEXCEPT__ {
+            return m_Operations != nullptr;
+        }
+
+        /// @brief Destroys the stored callable, the function is empty afterwards
+        void Reset() __WSTL_NOEXCEPT__ {
+            if(m_Operations != nullptr) {
+                m_Operations->Destroy(&m_Storage);
+                m_Operations = nullptr;
+            }
+        }
+
+        /// @brief Swaps the callables of two functions
+        /// @param other The function to swap with
+        void Swap(InplaceFunction& other) __WSTL_NOEXCEPT__ {
+            InplaceFunction temporary(Move(other));
+            other = Move(*this);
+            *this = Move(temporary);
+        }
+
+    private:
+        mutable typename AlignedStorage<Capacity, Alignment>::Type m_Storage;
+        const OperationsType* m_Operations;
+
+        template<typename Callable>
+        void Create(Callable&& callable) {
+            typedef typename Decay<Callable>::Type StoredType;
+
+            WSTL_STATIC_ASSERT(sizeof(StoredType) <= Capacity, "Callable does not fit into the inplace function");
+            WSTL_STATIC_ASSERT(Alignment % AlignmentOf<StoredType>::Value == 0, "Callable is over-aligned for the inplace function");
+
+            if(__private::__InplaceFunctionIsNull(callable)) return;
+
+            ::new(static_cast<void*>(&m_Storage)) StoredType(Forward<Callable>(callable));
+            m_Operations = &__private::__InplaceFunctionHandler<StoredType, Return, Args...>::Operations;
+        }
+    };
+
+    template<typename Return, typename... Args, size_t Capacity, size_t Alignment>
+    inline bool operator==(const InplaceFunction<Return(Args...), Capacity, Alignment>& function, NullPointerType) __WSTL_NOEXCEPT__ {
+        return !function;
+    }
+
+    template<typename Return, typename... Args, size_t Capacity, size_t Alignment>
+    inline bool operator==(NullPointerType, const InplaceFunction<Return(Args...), Capacity, Alignment>& function) __WSTL_NOEXCEPT__ {
+        return !function;
+    }
+
+    template<typename Return, typename... Args, size_t Capacity, size_t Alignment>
+    inline bool operator!=(const InplaceFunction<Return(Args...), Capacity, Alignment>& function, NullPointerType) __WSTL_NOEXCEPT__ {
+        return static_cast<bool>(function);
+    }
+
+    template<typename Return, typename... Args, size_t Capacity, size_t Alignment>
+    inline bool operator!=(NullPointerType, const InplaceFunction<Return(Args...), Capacity, Alignment>& function) __WSTL_NOEXCEPT__ {
+        return static_cast<bool>(function);
+    }
+
+    /// @brief Swaps the callables of two inplace functions
+    /// @param a First function
+    /// @param b Second function
+    template<typename Return, typename... Args, size_t Capacity, size_t Alignment>
+    inline void Swap(InplaceFunction<Return(Args...), Capacity, Alignment>& a, InplaceFunction<Return(Args...), Capacity, Alignment>& b) __WSTL_NOEXCEPT__ {
+        a.Swap(b);
+    }
+}
+#endif
+
+#endif
\ No newline at end of file
@@ -0,0 +1,311 @@
+// Part of WardenSTL - https://github.com/WardenHD/WardenSTL
+// Copyright (c) 2025 Artem Bezruchko (WardenHD)
+//
+// Licensed under the MIT License. See LICENSE file for details.
+
+#ifndef __WSTL_INSTRUMENTATION_HPP__
+#define __WSTL_INSTRUMENTATION_HPP__
+
+#include "private/Platform.hpp"
+#include "NullPointer.hpp"
+#include <stddef.h>
+
+
+/// @defgroup instrumentation Instrumentation
+/// @brief Opt-in counters and trace hooks for sizing fixed capacities
+/// @details With `__WSTL_INSTRUMENTATION__` defined, containers record the peak of `Size()` and
+/// their failed insertions, allocators count allocations, failures and frees, hash tables keep a
+/// histogram of probe lengths and `QuickSort` records its recursion depth. Events can also be forwarded to a `TraceHook`, for example to
+/// SEGGER SystemView or the ITM. Without the define none of it exists and nothing is recorded
+/// @ingroup wstl
+
+// Defines introduced
+
+/// @def __WSTL_INSTRUMENTATION__
+/// @brief If defined, containers, allocators and hash tables record usage statistics
+/// @ingroup instrumentation
+#ifdef __DOXYGEN__
+    #define __WSTL_INSTRUMENTATION__
+#endif
+
+namespace wstl {
+    #ifdef __WSTL_INSTRUMENTATION__
+    // Trace hook
+
+    /// @brief Kind of an instrumentation event
+    /// @ingroup instrumentation
+    enum TraceEvent {
+        /// @brief An allocator returned a block, `Address` and `Size` describe it
+        TRACE_ALLOCATE,
+        /// @brief An allocator could not serve a request of `Size` bytes
+        TRACE_ALLOCATION_FAILURE,
+        /// @brief A block at `Address` was returned to an allocator
+        TRACE_FREE,
+        /// @brief A container with capacity `Size` could not take another element
+        TRACE_CONTAINER_FULL
+    };
+
+    /// @brief Event passed to a trace hook
+    /// @ingroup instrumentation
+    struct TraceRecord {
+        /// @brief Kind of the event
+        TraceEvent Event;
+        /// @brief Allocator or container that reported the event
+        const void* Source;
+        /// @brief Address of the block, null pointer if there is none
+        const void* Address;
+        /// @brief Size in bytes for allocators, capacity for containers
+        size_t Size;
+    };
+
+    /// @brief Interface implemented by the user to receive instrumentation events
+    /// @details The hook is called on the hot path, it should only copy the record to a trace buffer
+    /// @note Requires `__WSTL_INSTRUMENTATION__` to be defined
+    /// @ingroup instrumentation
+    class TraceHook {
+    public:
+        /// @brief Receives an event
+        /// @param record The event
+        virtual void Trace(const TraceRecord& record) = 0;
+
+    protected:
+        ~TraceHook() {}
+    };
+
+    namespace __private {
+        inline TraceHook*& __InstalledTraceHook() {
+            static TraceHook* hook = NullPointer;
+            return hook;
+        }
+
+        inline void __Trace(TraceEvent event, const void* source, const void* address, size_t size) {
+            TraceHook* const hook = __InstalledTraceHook();
+            if(hook == NullPointer) return;
+
+            TraceRecord record;
+            record.Event = event;
+            record.Source = source;
+            record.Address = address;
+            record.Size = size;
+
+            hook->Trace(record);
+        }
+    }
+
+    /// @brief Installs the hook that receives instrumentation events
+    /// @param hook The hook, or null pointer to stop tracing
+    /// @note Requires `__WSTL_INSTRUMENTATION__` to be defined
+    /// @ingroup instrumentation
+    inline void SetTraceHook(TraceHook* hook) {
+        __private::__InstalledTraceHook() = hook;
+    }
+
+    /// @brief Gets the installed trace hook, null pointer if there is none
+    /// @note Requires `__WSTL_INSTRUMENTATION__` to be defined
+    /// @ingroup instrumentation
+    inline TraceHook* GetTraceHook() {
+        return __private::__InstalledTraceHook();
+    }
+
+    // Allocator statistics
+
+    /// @brief Counters kept by every allocator
+    /// @details Failures reported by throwing an exception are not counted
+    /// @note Requires `__WSTL_INSTRUMENTATION__` to be defined
+    /// @ingroup instrumentation
+    struct AllocatorStatistics {
+        /// @brief Number of successful allocations
+        size_t Allocations;
+        /// @brief Number of allocations that returned null pointer
+        size_t Failures;
+        /// @brief Number of freed blocks
+        size_t Frees;
+        /// @brief Largest number of blocks allocated at once
+        size_t PeakLive;
+        /// @brief Sum of the sizes requested by successful allocations
+        size_t RequestedBytes;
+
+        /// @brief Default constructor, zeroes the counters
+        AllocatorStatistics() : Allocations(0), Failures(0), Frees(0), PeakLive(0), RequestedBytes(0) {}
+
+        /// @brief Gets the number of blocks currently allocated
+        size_t Live() const {
+            return Allocations - Frees;
+        }
+    };
+
+    // Sort statistics
+
+    /// @brief Counters kept by `QuickSort`
+    /// @details The depth of a sort is the longest chain of nested partitions, it equals the stack frames
+    /// the recursion needed. Sorts evaluated at compile time are not recorded
+    /// @note Requires `__WSTL_INSTRUMENTATION__` to be defined
+    /// @ingroup instrumentation
+    struct SortStatistics {
+        /// @brief Number of sorts
+        size_t Sorts;
+        /// @brief Recursion depth of the latest sort
+        size_t LastDepth;
+        /// @brief Deepest recursion of any sort
+        size_t DeepestDepth;
+
+        /// @brief Default constructor, zeroes the counters
+        SortStatistics() : Sorts(0), LastDepth(0), DeepestDepth(0) {}
+
+        /// @brief Records a sort
+        /// @param depth Recursion depth of the sort
+        void Record(size_t depth) {
+            ++Sorts;
+            LastDepth = depth;
+            if(depth > DeepestDepth) DeepestDepth = depth;
+        }
+
+        /// @brief Zeroes the counters
+        void Reset() {
+            Sorts = LastDepth = DeepestDepth = 0;
+        }
+    };
+
+    /// @brief Gets the counters of `QuickSort`, shared by all its instantiations
+    /// @note Requires `__WSTL_INSTRUMENTATION__` to be defined
+    /// @ingroup instrumentation
+    inline SortStatistics& QuickSortStatistics() {
+        static SortStatistics statistics;
+        return statistics;
+    }
+
+    // Probe histogram
+
+    /// @brief Histogram of the number of control groups a hash table probed per lookup
+    /// @details Bucket `i` counts lookups that probed `i + 1` groups, the last bucket also counts longer probes.
+    /// Mostly single-group lookups mean the capacity could shrink, a heavy tail means it should grow
+    /// @note Requires `__WSTL_INSTRUMENTATION__` to be defined
+    /// @ingroup instrumentation
+    struct ProbeHistogram {
+        /// @brief Number of buckets
+        static const __WSTL_CONSTEXPR__ size_t BucketCount = 8;
+
+        /// @brief Number of lookups per probe length
+        size_t Buckets[BucketCount];
+        /// @brief Longest probe seen, in groups
+        size_t Longest;
+
+        /// @brief Default constructor, zeroes the buckets
+        ProbeHistogram() {
+            Reset();
+        }
+
+        /// @brief Records a lookup
+        /// @param groups Number of groups probed, at least one
+        void Record(size_t groups) {
+            ++Buckets[groups < BucketCount ? groups - 1 : BucketCount - 1];
+            if(groups > Longest) Longest = groups;
+        }
+
+        /// @brief Gets the number of recorded lookups
+        size_t Count() const {
+            size_t result = 0;
+            for(size_t i = 0; i < BucketCount; ++i) result += Buckets[i];
+
+            return result;
+        }
+
+        /// @brief Zeroes the buckets
+        void Reset() {
+            for(size_t i = 0; i < BucketCount; ++i) Buckets[i] = 0;
+            Longest = 0;
+        }
+    };
+    #endif
+
+    namespace __private {
+        #ifdef __WSTL_INSTRUMENTATION__
+        /// @brief Size of a container that also records its peak and the insertions that failed
+        /// @details Copies take only the size, so assigning or swapping containers keeps each peak
+        template<typename SizeType>
+        class __InstrumentedSize {
+        public:
+            __WSTL_CONSTEXPR__ __InstrumentedSize(SizeType value = 0) : m_Value(value), m_Peak(value), m_Failures(0) {}
+
+            __WSTL_CONSTEXPR__ __InstrumentedSize(const __InstrumentedSize& other) : m_Value(other.m_Value), m_Peak(other.m_Value), m_Failures(0) {}
+
+            __InstrumentedSize& operator=(const __InstrumentedSize& other) {
+                return *this = other.m_Value;
+            }
+
+            __InstrumentedSize& operator=(SizeType value) {
+                m_Value = value;
+                if(m_Value > m_Peak) m_Peak = m_Value;
+
+                return *this;
+            }
+
+            __WSTL_CONSTEXPR__ operator SizeType() const {
+                return m_Value;
+            }
+
+            __InstrumentedSize& operator++() {
+                return *this = m_Value + 1;
+            }
+
+            SizeType operator++(int) {
+                const SizeType result = m_Value;
+                *this = m_Value + 1;
+
+                return result;
+            }
+
+            __InstrumentedSize& operator--() {
+                --m_Value;
+                return *this;
+            }
+
+            SizeType operator--(int) {
+                return m_Value--;
+            }
+
+            __InstrumentedSize& operator+=(SizeType count) {
+                return *this = m_Value + count;
+            }
+
+            __InstrumentedSize& operator-=(SizeType count) {
+                m_Value -= count;
+                return *this;
+            }
+
+            SizeType Peak() const {
+                return m_Peak;
+            }
+
+            void ResetPeak() {
+                m_Peak = m_Value;
+            }
+
+            SizeType Failures() const {
+                return m_Failures;
+            }
+
+            void RecordFailure() {
+                ++m_Failures;
+            }
+
+        private:
+            SizeType m_Value;
+            SizeType m_Peak;
+            SizeType m_Failures;
+        };
+        #endif
+
+        /// @brief Type of the size member of a container, instrumented if `__WSTL_INSTRUMENTATION__` is defined
+        template<typename SizeType>
+        struct __ContainerSize {
+            #ifdef __WSTL_INSTRUMENTATION__
+            typedef __InstrumentedSize<SizeType> Type;
+            #else
+            typedef SizeType Type;
+            #endif
+        };
+    }
+}
+
+#endif
\ No newline at end of file
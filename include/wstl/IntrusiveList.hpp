@@ -0,0 +1,675 @@
+// Part of WardenSTL - https://github.com/WardenHD/WardenSTL
+// Copyright (c) 2025 Artem Bezruchko (WardenHD)
+//
+// Licensed under the MIT License. See LICENSE file for details.
+
+#ifndef __WSTL_INTRUSIVELIST_HPP__
+#define __WSTL_INTRUSIVELIST_HPP__
+
+#include "private/Platform.hpp"
+#include "List.hpp"
+#include "Iterator.hpp"
+#include "Algorithm.hpp"
+#include "Functional.hpp"
+#include "Utility.hpp"
+#include "StandardExceptions.hpp"
+#include "NullPointer.hpp"
+#include "private/Error.hpp"
+#include <stddef.h>
+#include <stdint.h>
+
+
+/// @defgroup intrusive_list Intrusive list
+/// @ingroup containers
+/// @brief A doubly linked list that links objects through a hook stored inside them
+
+namespace wstl {
+    // Intrusive list
+
+    /// @brief A doubly linked list of objects that carry their own links
+    /// @tparam T Type of the linked objects
+    /// @tparam Hook Pointer to the `ListNode` member of `T` that holds the links
+    /// @details The list never allocates, copies or destroys objects, it only links and unlinks
+    /// them, so objects that live in a pool or a static array can be put in a list as they are.
+    /// An object with several hooks can be in several lists at the same time, one per hook.
+    /// A hook that is not in a list has null links, use `IsLinked` to check it. An object must be
+    /// unlinked before it is destroyed or linked into another list through the same hook
+    /// @ingroup intrusive_list
+    ///
+    /// @code
+    /// struct Task {
+    ///     ListNode RunHook;
+    ///     ListNode TimerHook;
+    /// };
+    ///
+    /// IntrusiveList<Task, &Task::RunHook> runQueue;
+    /// IntrusiveList<Task, &Task::TimerHook> timers;
+    /// @endcode
+    template<typename T, ListNode T::* Hook>
+    class IntrusiveList {
+    public:
+        typedef T ValueType;
+        typedef size_t SizeType;
+        typedef ptrdiff_t DifferenceType;
+        typedef ValueType& ReferenceType;
+        typedef const ValueType& ConstReferenceType;
+        typedef ValueType* PointerType;
+        typedef const ValueType* ConstPointerType;
+
+    private:
+        template<bool IsConst>
+        class IntrusiveListIterator : public wstl::Iterator<BidirectionalIteratorTag, typename Conditional<IsConst, const ValueType, ValueType>::Type> {
+        private:
+            typedef wstl::Iterator<BidirectionalIteratorTag, typename Conditional<IsConst, const ValueType, ValueType>::Type> IteratorBase;
+            typedef typename Conditional<IsConst, const ListNode*, ListNode*>::Type NodePointer;
+
+        public:
+            typedef typename IteratorBase::ReferenceType ReferenceType;
+            typedef typename IteratorBase::PointerType PointerType;
+            typedef typename IteratorBase::DifferenceType DifferenceType;
+
+            friend class IntrusiveList;
+            friend class IntrusiveListIterator<!IsConst>;
+
+            /// @brief Default constructor
+            IntrusiveListIterator() : m_Current(NullPointer) {}
+
+            /// @brief Copy constructor
+            /// @param other Iterator to copy from
+            IntrusiveListIterator(const IntrusiveListIterator& other) : m_Current(other.m_Current) {}
+
+            /// @brief Converting constructor from a mutable iterator
+            /// @param other Iterator to convert from
+            template<bool OtherConst>
+            IntrusiveListIterator(const IntrusiveListIterator<OtherConst>& other,
+                typename EnableIf<IsConst && !OtherConst, int>::Type = 0) : m_Current(other.m_Current) {}
+
+            /// @brief Copy assignment operator
+            /// @param other Iterator to assign from
+            IntrusiveListIterator& operator=(const IntrusiveListIterator& other) {
+                m_Current = other.m_Current;
+                return *this;
+            }
+
+            /// @brief Dereference operator
+            /// @details If iterator points to the end, behavior is undefined
+            ReferenceType operator*() const {
+                return *ObjectCast(m_Current);
+            }
+
+            /// @brief Arrow operator
+            /// @details If iterator points to the end, behavior is undefined
+            PointerType operator->() const {
+                return ObjectCast(m_Current);
+            }
+
+            /// @brief Pre-increment operator - moves the iterator forward by one element
+            /// @return Reference to the updated iterator
+            IntrusiveListIterator& operator++() {
+                m_Current = m_Current->Next;
+                return *this;
+            }
+
+            /// @brief Post-increment operator - moves the iterator forward by one element
+            /// @return Copy of the iterator before incrementing
+            IntrusiveListIterator operator++(int) {
+                IntrusiveListIterator original(*this);
+                m_Current = m_Current->Next;
+                return original;
+            }
+
+            /// @brief Pre-decrement operator - moves the iterator backwards by one element
+            /// @return Reference to the updated iterator
+            IntrusiveListIterator& operator--() {
+                m_Current = m_Current->Previous;
+                return *this;
+            }
+
+            /// @brief Post-decrement operator - moves the iterator backwards by one element
+            /// @return Copy of the iterator before decrementing
+            IntrusiveListIterator operator--(int) {
+                IntrusiveListIterator original(*this);
+                m_Current = m_Current->Previous;
+                return original;
+            }
+
+            friend bool operator==(const IntrusiveListIterator& a, const IntrusiveListIterator& b) {
+                return a.m_Current == b.m_Current;
+            }
+
+            friend bool operator!=(const IntrusiveListIterator& a, const IntrusiveListIterator& b) {
+                return a.m_Current != b.m_Current;
+            }
+
+        private:
+            NodePointer m_Current;
+
+            explicit IntrusiveListIterator(NodePointer node) : m_Current(node) {}
+        };
+
+    public:
+        typedef IntrusiveListIterator<false> Iterator;
+        typedef IntrusiveListIterator<true> ConstIterator;
+        typedef wstl::ReverseIterator<Iterator> ReverseIterator;
+        typedef wstl::ReverseIterator<ConstIterator> ConstReverseIterator;
+
+        /// @brief Default constructor, creates an empty list
+        IntrusiveList() : m_CurrentSize(0) {
+            LinkNodes(&m_Sentinel, &m_Sentinel);
+        }
+
+        /// @brief Constructor that links a range of objects
+        /// @param first Iterator to the first object in the range
+        /// @param last Iterator to the object following the last object in the range
+        template<typename InputIterator>
+        IntrusiveList(InputIterator first, InputIterator last) : m_CurrentSize(0) {
+            LinkNodes(&m_Sentinel, &m_Sentinel);
+            Assign(first, last);
+        }
+
+        #ifdef __WSTL_CXX11__
+        /// @brief Move constructor, takes over the objects of the other list
+        /// @param other The list to move from
+        /// @since C++11
+        IntrusiveList(IntrusiveList&& other) : m_CurrentSize(0) {
+            LinkNodes(&m_Sentinel, &m_Sentinel);
+            Splice(End(), other);
+        }
+
+        /// @brief Move assignment operator, unlinks the current objects and takes over the objects of the other list
+        /// @param other The list to move from
+        /// @since C++11
+        IntrusiveList& operator=(IntrusiveList&& other) {
+            if(this != &other) {
+                Clear();
+                Splice(End(), other);
+            }
+
+            return *this;
+        }
+        #endif
+
+        /// @brief Destructor, unlinks all objects
+        ~IntrusiveList() {
+            Clear();
+        }
+
+        /// @brief Unlinks the current objects and links a range of objects
+        /// @param first Iterator to the first object in the range
+        /// @param last Iterator to the object following the last object in the range
+        /// @throws `LogicError` if an object is already linked
+        template<typename InputIterator>
+        void Assign(InputIterator first, InputIterator last) {
+            Clear();
+            for(; first != last; ++first) PushBack(*first);
+        }
+
+        /// @brief Gets the number of linked objects
+        __WSTL_CONSTEXPR__ SizeType Size() const __WSTL_NOEXCEPT__ {
+            return m_CurrentSize;
+        }
+
+        /// @brief Checks if the list is empty
+        __WSTL_CONSTEXPR__ bool Empty() const __WSTL_NOEXCEPT__ {
+            return m_CurrentSize == 0;
+        }
+
+        /// @brief Gets the first object in the list
+        ReferenceType Front() {
+            return *ObjectCast(m_Sentinel.Next);
+        }
+
+        /// @brief Gets the first object in the list
+        ConstReferenceType Front() const {
+            return *ObjectCast(m_Sentinel.Next);
+        }
+
+        /// @brief Gets the last object in the list
+        ReferenceType Back() {
+            return *ObjectCast(m_Sentinel.Previous);
+        }
+
+        /// @brief Gets the last object in the list
+        ConstReferenceType Back() const {
+            return *ObjectCast(m_Sentinel.Previous);
+        }
+
+        /// @brief Gets iterator to the beginning of the list
+        Iterator Begin() {
+            return Iterator(m_Sentinel.Next);
+        }
+
+        /// @brief Gets const iterator to the beginning of the list
+        ConstIterator Begin() const {
+            return ConstIterator(m_Sentinel.Next);
+        }
+
+        /// @brief Gets const iterator to the beginning of the list
+        ConstIterator ConstBegin() const {
+            return ConstIterator(m_Sentinel.Next);
+        }
+
+        /// @brief Gets iterator to the end of the list
+        Iterator End() {
+            return Iterator(&m_Sentinel);
+        }
+
+        /// @brief Gets const iterator to the end of the list
+        ConstIterator End() const {
+            return ConstIterator(&m_Sentinel);
+        }
+
+        /// @brief Gets const iterator to the end of the list
+        ConstIterator ConstEnd() const {
+            return ConstIterator(&m_Sentinel);
+        }
+
+        /// @brief Gets reverse iterator to the beginning of the list
+        ReverseIterator ReverseBegin() {
+            return ReverseIterator(End());
+        }
+
+        /// @brief Gets const reverse iterator to the beginning of the list
+        ConstReverseIterator ReverseBegin() const {
+            return ConstReverseIterator(End());
+        }
+
+        /// @brief Gets const reverse iterator to the beginning of the list
+        ConstReverseIterator ConstReverseBegin() const {
+            return ConstReverseIterator(End());
+        }
+
+        /// @brief Gets reverse iterator to the end of the list
+        ReverseIterator ReverseEnd() {
+            return ReverseIterator(Begin());
+        }
+
+        /// @brief Gets const reverse iterator to the end of the list
+        ConstReverseIterator ReverseEnd() const {
+            return ConstReverseIterator(Begin());
+        }
+
+        /// @brief Gets const reverse iterator to the end of the list
+        ConstReverseIterator ConstReverseEnd() const {
+            return ConstReverseIterator(Begin());
+        }
+
+        /// @brief Gets an iterator to a linked object in constant time
+        /// @param value The object, must be linked into this list
+        static Iterator IteratorTo(ReferenceType value) {
+            return Iterator(&(value.*Hook));
+        }
+
+        /// @brief Gets a const iterator to a linked object in constant time
+        /// @param value The object, must be linked into this list
+        static ConstIterator IteratorTo(ConstReferenceType value) {
+            return ConstIterator(&(value.*Hook));
+        }
+
+        /// @brief Checks if the hook of an object is linked into a list
+        /// @param value The object to check
+        static bool IsLinked(ConstReferenceType value) {
+            return (value.*Hook).Next != NullPointer;
+        }
+
+        /// @brief Unlinks all objects
+        void Clear() {
+            ListNode* node = m_Sentinel.Next;
+
+            while(node != &m_Sentinel) {
+                ListNode* const next = node->Next;
+                ResetNode(node);
+                node = next;
+            }
+
+            LinkNodes(&m_Sentinel, &m_Sentinel);
+            m_CurrentSize = 0;
+        }
+
+        /// @brief Links an object before specified position
+        /// @param position The position to link the object at
+        /// @param value The object to link
+        /// @return Iterator to the linked object
+        /// @throws `LogicError` if the object is already linked
+        Iterator Insert(ConstIterator position, ReferenceType value) {
+            ListNode* const node = &(value.*Hook);
+            __WSTL_ASSERT_RETURNVALUE__(node->Next == NullPointer, WSTL_MAKE_EXCEPTION(LogicError, "Intrusive list object already linked"), Iterator(node));
+
+            LinkNodeBefore(const_cast<ListNode*>(position.m_Current), node);
+            ++m_CurrentSize;
+
+            return Iterator(node);
+        }
+
+        /// @brief Links a range of objects before specified position
+        /// @param position The position to link the objects at
+        /// @param first Iterator to the first object in the range
+        /// @param last Iterator to the object following the last object in the range
+        /// @return Iterator to the first linked object, or `position` if the range is empty
+        /// @throws `LogicError` if an object is already linked
+        template<typename InputIterator>
+        Iterator Insert(ConstIterator position, InputIterator first, InputIterator last) {
+            Iterator result(const_cast<ListNode*>(position.m_Current));
+
+            if(first != last) {
+                result = Insert(position, *first);
+                for(++first; first != last; ++first) Insert(position, *first);
+            }
+
+            return result;
+        }
+
+        /// @brief Unlinks an object at specified position
+        /// @param position The position of the object to unlink
+        /// @return Iterator to the object following the unlinked one
+        Iterator Erase(ConstIterator position) {
+            ListNode* const node = const_cast<ListNode*>(position.m_Current);
+            ListNode* const next = node->Next;
+
+            UnlinkNode(node);
+            --m_CurrentSize;
+
+            return Iterator(next);
+        }
+
+        /// @brief Unlinks a range of objects
+        /// @param first Iterator to the first object in the range to unlink
+        /// @param last Iterator to the object following the last object in the range to unlink
+        /// @return Iterator to the object following the unlinked range
+        Iterator Erase(ConstIterator first, ConstIterator last) {
+            while(first != last) first = Erase(first);
+            return Iterator(const_cast<ListNode*>(last.m_Current));
+        }
+
+        /// @brief Unlinks an object from the list in constant time
+        /// @param value The object to unlink, must be linked into this list
+        void Erase(ReferenceType value) {
+            Erase(IteratorTo(value));
+        }
+
+        /// @brief Links an object at the back of the list
+        /// @param value The object to link
+        /// @throws `LogicError` if the object is already linked
+        void PushBack(ReferenceType value) {
+            Insert(End(), value);
+        }
+
+        /// @brief Links an object at the front of the list
+        /// @param value The object to link
+        /// @throws `LogicError` if the object is already linked
+        void PushFront(ReferenceType value) {
+            Insert(Begin(), value);
+        }
+
+        /// @brief Unlinks the last object
+        /// @throws `LengthError` if the list is empty and `__WSTL_ASSERT_PUSHPOP__` is defined
+        void PopBack() {
+            __WSTL_ASSERT_PUSHPOP_RETURN__(!Empty(), WSTL_MAKE_EXCEPTION(LengthError, "Intrusive list empty"));
+            Erase(ConstIterator(m_Sentinel.Previous));
+        }
+
+        /// @brief Unlinks the first object
+        /// @throws `LengthError` if the list is empty and `__WSTL_ASSERT_PUSHPOP__` is defined
+        void PopFront() {
+            __WSTL_ASSERT_PUSHPOP_RETURN__(!Empty(), WSTL_MAKE_EXCEPTION(LengthError, "Intrusive list empty"));
+            Erase(ConstIterator(m_Sentinel.Next));
+        }
+
+        /// @brief Swaps the objects of two lists
+        /// @param other The list to swap with
+        void Swap(IntrusiveList& other) {
+            IntrusiveList temporary;
+
+            temporary.Splice(temporary.End(), *this);
+            Splice(End(), other);
+            other.Splice(other.End(), temporary);
+        }
+
+        /// @brief Moves all objects of another list before specified position
+        /// @param position The position to splice at
+        /// @param other The list to move the objects from
+        void Splice(ConstIterator position, IntrusiveList& other) {
+            if(this == &other || other.Empty()) return;
+
+            MoveNodeRange(const_cast<ListNode*>(position.m_Current), other.m_Sentinel.Next, &other.m_Sentinel);
+            m_CurrentSize += other.m_CurrentSize;
+            other.m_CurrentSize = 0;
+        }
+
+        /// @brief Moves an object of another list before specified position
+        /// @param position The position to splice at
+        /// @param other The list to move the object from, can be this list
+        /// @param iterator The position of the object to move
+        void Splice(ConstIterator position, IntrusiveList& other, ConstIterator iterator) {
+            ListNode* const node = const_cast<ListNode*>(iterator.m_Current);
+
+            MoveNodeRange(const_cast<ListNode*>(position.m_Current), node, node->Next);
+            --other.m_CurrentSize;
+            ++m_CurrentSize;
+        }
+
+        /// @brief Moves a range of objects of another list before specified position
+        /// @param position The position to splice at, must not lie inside the range
+        /// @param other The list to move the objects from, can be this list
+        /// @param first The position of the first object in the range
+        /// @param last The position following the last object in the range
+        /// @details Constant time when splicing within the same list, otherwise linear in the
+        /// length of the range, which has to be counted
+        void Splice(ConstIterator position, IntrusiveList& other, ConstIterator first, ConstIterator last) {
+            if(first == last) return;
+
+            if(this != &other) {
+                const SizeType count = Distance(first, last);
+                other.m_CurrentSize -= count;
+                m_CurrentSize += count;
+            }
+
+            MoveNodeRange(const_cast<ListNode*>(position.m_Current), const_cast<ListNode*>(first.m_Current),
+                const_cast<ListNode*>(last.m_Current));
+        }
+
+        /// @brief Unlinks all objects equal to a value
+        /// @param value The value to compare with
+        /// @return The number of unlinked objects
+        SizeType Remove(ConstReferenceType value) {
+            const SizeType size = m_CurrentSize;
+
+            for(Iterator it = Begin(); it != End();) {
+                if(*it == value) it = Erase(it);
+                else ++it;
+            }
+
+            return size - m_CurrentSize;
+        }
+
+        /// @brief Unlinks all objects that satisfy a predicate
+        /// @param predicate The unary predicate
+        /// @return The number of unlinked objects
+        template<typename UnaryPredicate>
+        SizeType RemoveIf(UnaryPredicate predicate) {
+            const SizeType size = m_CurrentSize;
+
+            for(Iterator it = Begin(); it != End();) {
+                if(predicate(*it)) it = Erase(it);
+                else ++it;
+            }
+
+            return size - m_CurrentSize;
+        }
+
+        /// @brief Unlinks consecutive objects equal to the object before them
+        /// @return The number of unlinked objects
+        SizeType Unique() {
+            return Unique(EqualTo<ValueType>());
+        }
+
+        /// @brief Unlinks consecutive objects that satisfy a predicate with the object before them
+        /// @param predicate The binary predicate
+        /// @return The number of unlinked objects
+        template<typename BinaryPredicate>
+        SizeType Unique(BinaryPredicate predicate) {
+            if(Empty()) return 0;
+
+            const SizeType size = m_CurrentSize;
+            Iterator previous = Begin();
+
+            for(Iterator it = Next(previous); it != End();) {
+                if(predicate(*previous, *it)) it = Erase(it);
+                else previous = it++;
+            }
+
+            return size - m_CurrentSize;
+        }
+
+        /// @brief Reverses the order of the objects
+        void Reverse() {
+            ListNode* node = &m_Sentinel;
+
+            do {
+                wstl::Swap(node->Previous, node->Next);
+                node = node->Previous;
+            } while(node != &m_Sentinel);
+        }
+
+        /// @brief Merges another sorted list into this sorted list by relinking its objects
+        /// @param other The list to merge, empty afterwards
+        /// @param compare Binary comparator that the lists are sorted by
+        /// @details The merge is stable, objects of this list go before equal objects of the other list
+        template<typename Compare>
+        void Merge(IntrusiveList& other, Compare compare) {
+            if(this == &other) return;
+
+            ListNode* position = m_Sentinel.Next;
+
+            while(!other.Empty()) {
+                ListNode* const node = other.m_Sentinel.Next;
+
+                while(position != &m_Sentinel && !compare(*ObjectCast(node), *ObjectCast(position))) position = position->Next;
+                if(position == &m_Sentinel) break;
+
+                MoveNodeRange(position, node, node->Next);
+                --other.m_CurrentSize;
+                ++m_CurrentSize;
+            }
+
+            Splice(End(), other);
+        }
+
+        /// @brief Merges another sorted list into this sorted list by relinking its objects
+        /// @param other The list to merge, empty afterwards
+        void Merge(IntrusiveList& other) {
+            Merge(other, Less<ValueType>());
+        }
+
+        /// @brief Sorts the objects by relinking them
+        /// @param compare Binary comparator
+        /// @details Stable merge sort, the halves are split off into temporary lists, so the
+        /// recursion depth is logarithmic in the size
+        template<typename Compare>
+        void Sort(Compare compare) {
+            if(m_CurrentSize < 2) return;
+
+            IntrusiveList upper;
+            upper.Splice(upper.End(), *this, Next(Begin(), m_CurrentSize / 2), End());
+
+            Sort(compare);
+            upper.Sort(compare);
+            Merge(upper, compare);
+        }
+
+        /// @brief Sorts the objects in ascending order by relinking them
+        void Sort() {
+            Sort(Less<ValueType>());
+        }
+
+    private:
+        ListNode m_Sentinel;
+        SizeType m_CurrentSize;
+
+        /// @brief Deleted copy constructor, objects can only be linked into one list per hook
+        IntrusiveList(const IntrusiveList&) __WSTL_DELETE__;
+
+        /// @brief Deleted copy assignment operator, objects can only be linked into one list per hook
+        IntrusiveList& operator=(const IntrusiveList&) __WSTL_DELETE__;
+
+        /// @brief Gets the offset of the hook inside the object
+        static size_t HookOffset() {
+            // Any suitably aligned address works, the member pointer only adds an offset to it
+            const uintptr_t base = static_cast<uintptr_t>(AlignmentOf<T>::Value) * 64;
+            return reinterpret_cast<uintptr_t>(&(reinterpret_cast<T*>(base)->*Hook)) - base;
+        }
+
+        static PointerType ObjectCast(ListNode* node) {
+            return reinterpret_cast<PointerType>(reinterpret_cast<unsigned char*>(node) - HookOffset());
+        }
+
+        static ConstPointerType ObjectCast(const ListNode* node) {
+            return reinterpret_cast<ConstPointerType>(reinterpret_cast<const unsigned char*>(node) - HookOffset());
+        }
+
+        static void LinkNodes(ListNode* left, ListNode* right) {
+            left->Next = right;
+            right->Previous = left;
+        }
+
+        static void LinkNodeBefore(ListNode* position, ListNode* node) {
+            LinkNodes(position->Previous, node);
+            LinkNodes(node, position);
+        }
+
+        static void ResetNode(ListNode* node) {
+            node->Previous = NullPointer;
+            node->Next = NullPointer;
+        }
+
+        static void UnlinkNode(ListNode* node) {
+            LinkNodes(node->Previous, node->Next);
+            ResetNode(node);
+        }
+
+        /// @brief Moves the nodes in `[first, last)` before a position
+        static void MoveNodeRange(ListNode* position, ListNode* first, ListNode* last) {
+            if(position == first || position == last) return;
+
+            ListNode* const lastNode = last->Previous;
+
+            LinkNodes(first->Previous, last);
+            LinkNodes(position->Previous, first);
+            LinkNodes(lastNode, position);
+        }
+    };
+
+    // Comparison operators
+
+    template<typename T, ListNode T::* Hook>
+    inline bool operator==(const IntrusiveList<T, Hook>& a, const IntrusiveList<T, Hook>& b) {
+        return (a.Size() == b.Size()) && Equal(a.Begin(), a.End(), b.Begin());
+    }
+
+    template<typename T, ListNode T::* Hook>
+    inline bool operator!=(const IntrusiveList<T, Hook>& a, const IntrusiveList<T, Hook>& b) {
+        return !(a == b);
+    }
+
+    template<typename T, ListNode T::* Hook>
+    inline bool operator<(const IntrusiveList<T, Hook>& a, const IntrusiveList<T, Hook>& b) {
+        return LexicographicalCompare(a.Begin(), a.End(), b.Begin(), b.End());
+    }
+
+    template<typename T, ListNode T::* Hook>
+    inline bool operator<=(const IntrusiveList<T, Hook>& a, const IntrusiveList<T, Hook>& b) {
+        return !(b < a);
+    }
+
+    template<typename T, ListNode T::* Hook>
+    inline bool operator>(const IntrusiveList<T, Hook>& a, const IntrusiveList<T, Hook>& b) {
+        return b < a;
+    }
+
+    template<typename T, ListNode T::* Hook>
+    inline bool operator>=(const IntrusiveList<T, Hook>& a, const IntrusiveList<T, Hook>& b) {
+        return !(a < b);
+    }
+}
+
+#endif
\ No newline at end of file
@@ -10,6 +10,8 @@
 #include "Container.hpp"
 #include "NullPointer.hpp"
 #include "TypeTraits.hpp"
+#include "StandardExceptions.hpp"
+#include "Expected.hpp"
 #include "private/Error.hpp"
 
 
@@ -259,7 +261,7 @@ namespace wstl {
         }
 
         /// @brief Constructor with custom storage, for non-default-constructible storage
-        explicit BasicList(const StorageType& storage) : Base(storage), m_HeadFree(NullPointer) {
+        explicit BasicList(StorageType storage) : Base(__WSTL_MOVE__(storage)), m_HeadFree(NullPointer) {
             Initialize<ValueType>();
         }
 
@@ -282,7 +284,7 @@ namespace wstl {
         /// @param count Number of elements to create
         /// @param storage Storage to use for the list
         /// @throws `LengthError` if `count` exceeds the list's capacity
-        explicit BasicList(SizeType count, const StorageType& storage) : Base(storage), m_HeadFree(NullPointer) {
+        explicit BasicList(SizeType count, StorageType storage) : Base(__WSTL_MOVE__(storage)), m_HeadFree(NullPointer) {
             Initialize<ValueType>();
             __WSTL_ASSERT_RETURN__(count <= this->Capacity(), WSTL_MAKE_EXCEPTION(LengthError, "List overflow"));
 
@@ -305,7 +307,7 @@ namespace wstl {
         /// @param value Value to copy for each element
         /// @param storage Storage to use for the list
         /// @throws `LengthError` if `count` exceeds the list's capacity
-        BasicList(SizeType count, ConstReferenceType value, const StorageType& storage) : Base(storage), m_HeadFree(NullPointer) {
+        BasicList(SizeType count, ConstReferenceType value, StorageType storage) : Base(__WSTL_MOVE__(storage)), m_HeadFree(NullPointer) {
             Initialize<ValueType>();
             __WSTL_ASSERT_RETURN__(count <= this->Capacity(), WSTL_MAKE_EXCEPTION(LengthError, "List overflow"));
 
@@ -330,7 +332,7 @@ namespace wstl {
         /// @param storage Storage to use for the list
         /// @throws `LengthError` if the number of elements in the range exceeds the list's capacity
         template<typename InputIterator>
-        BasicList(InputIterator first, InputIterator last, const StorageType& storage, typename EnableIf<!IsIntegral<InputIterator>::Value, int>::Type = 0) : Base(storage), m_HeadFree(NullPointer) {
+        BasicList(InputIterator first, InputIterator last, StorageType storage, typename EnableIf<!IsIntegral<InputIterator>::Value, int>::Type = 0) : Base(__WSTL_MOVE__(storage)), m_HeadFree(NullPointer) {
             Initialize<ValueType>();
             __WSTL_ASSERT_RETURN__(Distance(first, last) <= this->Capacity(), WSTL_MAKE_EXCEPTION(LengthError, "List overflow"));
         
@@ -353,7 +355,7 @@ namespace wstl {
         /// @param list Initializer list to initialize the list with
         /// @param storage Storage to use for the list
         /// @throws `LengthError` if the number of elements in the initializer list exceeds the list's capacity
-        BasicList(InitializerList<ValueType> list, const StorageType& storage) : Base(storage), m_HeadFree(nullptr) {
+        BasicList(InitializerList<ValueType> list, StorageType storage) : Base(__WSTL_MOVE__(storage)), m_HeadFree(nullptr) {
             Initialize<ValueType>();
             __WSTL_ASSERT_RETURN__(list.Size() <= this->Capacity(), WSTL_MAKE_EXCEPTION(LengthError, "List overflow"));
             
@@ -377,7 +379,7 @@ namespace wstl {
         /// @param other List to copy from
         /// @param storage Storage to use for the list
         /// @throws `LengthError` if the number of elements in `other` exceeds the list's capacity
-        BasicList(const BasicList& other, const StorageType& storage) : Base(storage), m_HeadFree(NullPointer) {
+        BasicList(const BasicList& other, StorageType storage) : Base(__WSTL_MOVE__(storage)), m_HeadFree(NullPointer) {
             Initialize<ValueType>();
             __WSTL_ASSERT_RETURN__(other.Size() <= this->Capacity(), WSTL_MAKE_EXCEPTION(LengthError, "List overflow"));
             
@@ -406,7 +408,7 @@ namespace wstl {
         /// @param storage Storage to use for the list
         /// @throws `LengthError` if the number of elements in `other` exceeds the list's capacity
         /// @since C++11
-        BasicList(BasicList&& other, const StorageType& storage) : Base(storage), m_HeadFree(nullptr) {
+        BasicList(BasicList&& other, StorageType storage) : Base(__WSTL_MOVE__(storage)), m_HeadFree(nullptr) {
             Initialize<ValueType>();
 
             if(this != &other) {
@@ -601,6 +603,7 @@ namespace wstl {
         Iterator Insert(ConstIterator position, ConstReferenceType value) {
             Iterator insert = ToIterator(position);
 
+            if(this->Full()) this->RecordFailure();
             __WSTL_ASSERT_RETURNVALUE__(!this->Full(), WSTL_MAKE_EXCEPTION(LengthError, "List full"), insert);
 
             ListDataNode<ValueType>* const nextFree = DataCast(m_HeadFree->Next);
@@ -625,6 +628,7 @@ namespace wstl {
         Iterator Insert(ConstIterator position, ValueType&& value) {
             Iterator insert = ToIterator(position);
 
+            if(this->Full()) this->RecordFailure();
             __WSTL_ASSERT_RETURNVALUE__(!this->Full(), WSTL_MAKE_EXCEPTION(LengthError, "List full"), insert);
 
             ListDataNode<ValueType>* const nextFree = DataCast(m_HeadFree->Next);
@@ -649,23 +653,14 @@ namespace wstl {
         Iterator Insert(ConstIterator position, SizeType count, ConstReferenceType value) {
             Iterator insert = ToIterator(position);
 
+            if(count > this->Available()) this->RecordFailure();
             __WSTL_ASSERT_RETURNVALUE__(count <= this->Available(), WSTL_MAKE_EXCEPTION(LengthError, "List overflow"), insert);
 
-            ListNode* const result = m_HeadFree;
-            ListDataNode<ValueType>* nextFree;
-
-            this->m_CurrentSize += count;
+            // Construct in the free nodes, which are already chained, then link the chain in one go
+            ListNode* node = m_HeadFree;
+            for(SizeType i = 0; i < count; ++i, node = node->Next) ::new(&(DataCast(node)->Data)) ValueType(value);
 
-            while(count--) {
-                nextFree = DataCast(m_HeadFree->Next);
-
-                ::new(&(m_HeadFree->Data)) ValueType(value);
-                LinkNodeBefore(insert.m_Current, m_HeadFree);
-
-                m_HeadFree = nextFree;
-            }
-            
-            return Iterator(result);
+            return LinkFreeChain(insert.m_Current, count);
         }
 
         /// @brief Inserts a range of elements at the specified position
@@ -680,23 +675,14 @@ namespace wstl {
             Iterator insert = ToIterator(position);
             SizeType count = Distance(first, last);
 
+            if(count > this->Available()) this->RecordFailure();
             __WSTL_ASSERT_RETURNVALUE__(count <= this->Available(), WSTL_MAKE_EXCEPTION(LengthError, "List overflow"), insert);
 
-            ListNode* const result = m_HeadFree;
-            ListDataNode<ValueType>* nextFree;
-
-            this->m_CurrentSize += count;
-
-            for(; first != last; ++first) {
-                nextFree = DataCast(m_HeadFree->Next);
-
-                ::new(&(m_HeadFree->Data)) ValueType(*first);
-                LinkNodeBefore(insert.m_Current, m_HeadFree);
+            // Construct in the free nodes, which are already chained, then link the chain in one go
+            ListNode* node = m_HeadFree;
+            for(; first != last; ++first, node = node->Next) ::new(&(DataCast(node)->Data)) ValueType(*first);
 
-                m_HeadFree = nextFree;
-            }
-            
-            return Iterator(result);
+            return LinkFreeChain(insert.m_Current, count);
         }
 
         #if defined(__WSTL_CXX11__) && !defined(__WSTL_NO_INITIALIZERLIST__)
@@ -709,23 +695,14 @@ namespace wstl {
         Iterator Insert(ConstIterator position, InitializerList<ValueType> list) {
             Iterator insert = ToIterator(position);
 
+            if(list.Size() > this->Available()) this->RecordFailure();
             __WSTL_ASSERT_RETURNVALUE__(list.Size() <= this->Available(), WSTL_MAKE_EXCEPTION(LengthError, "List overflow"), insert);
 
-            ListNode* const result = m_HeadFree;
-            ListDataNode<ValueType>* nextFree;
-
-            this->m_CurrentSize += list.Size();
-
-            for(typename InitializerList<ValueType>::Iterator it = list.Begin(); it != list.End(); ++it) {
-                nextFree = DataCast(m_HeadFree->Next);
+            ListNode* node = m_HeadFree;
+            for(typename InitializerList<ValueType>::Iterator it = list.Begin(); it != list.End(); ++it, node = node->Next)
+                ::new(&(DataCast(node)->Data)) ValueType(*it);
 
-                ::new(&(m_HeadFree->Data)) ValueType(*it);
-                LinkNodeBefore(insert.m_Current, m_HeadFree);
-
-                m_HeadFree = nextFree;
-            }
-            
-            return Iterator(result);
+            return LinkFreeChain(insert.m_Current, list.Size());
         }
         #endif
 
@@ -762,6 +739,7 @@ namespace wstl {
         Iterator Emplace(ConstIterator position, Args&&... args) {
             Iterator insert = ToIterator(position);
 
+            if(this->Full()) this->RecordFailure();
             __WSTL_ASSERT_RETURNVALUE__(!this->Full(), WSTL_MAKE_EXCEPTION(LengthError, "List full"), insert);
 
             ListDataNode<ValueType>* const nextFree = DataCast(m_HeadFree->Next);
@@ -783,6 +761,7 @@ namespace wstl {
         Iterator Emplace(ConstIterator position) {
             Iterator insert = ToIterator(position);
 
+            if(this->Full()) this->RecordFailure();
             __WSTL_ASSERT_RETURNVALUE__(!this->Full(), WSTL_MAKE_EXCEPTION(LengthError, "List full"), insert);
 
             ListDataNode<ValueType>* const nextFree = DataCast(m_HeadFree->Next);
@@ -806,6 +785,7 @@ namespace wstl {
         Iterator Emplace(ConstIterator position, const Arg& arg) {
             Iterator insert = ToIterator(position);
 
+            if(this->Full()) this->RecordFailure();
             __WSTL_ASSERT_RETURNVALUE__(!this->Full(), WSTL_MAKE_EXCEPTION(LengthError, "List full"), insert);
 
             ListDataNode<ValueType>* const nextFree = DataCast(m_HeadFree->Next);
@@ -830,6 +810,7 @@ namespace wstl {
         Iterator Emplace(ConstIterator position, const Arg1& arg1, const Arg2& arg2) {
             Iterator insert = ToIterator(position);
 
+            if(this->Full()) this->RecordFailure();
             __WSTL_ASSERT_RETURNVALUE__(!this->Full(), WSTL_MAKE_EXCEPTION(LengthError, "List full"), insert);
 
             ListDataNode<ValueType>* const nextFree = DataCast(m_HeadFree->Next);
@@ -855,6 +836,7 @@ namespace wstl {
         Iterator Emplace(ConstIterator position, const Arg1& arg1, const Arg2& arg2, const Arg3& arg3) {
             Iterator insert = ToIterator(position);
 
+            if(this->Full()) this->RecordFailure();
             __WSTL_ASSERT_RETURNVALUE__(!this->Full(), WSTL_MAKE_EXCEPTION(LengthError, "List full"), insert);
 
             ListDataNode<ValueType>* const nextFree = DataCast(m_HeadFree->Next);
@@ -886,14 +868,23 @@ namespace wstl {
         /// @param last The position following the last element to erase
         /// @return An iterator to the element following the last erased element
         Iterator Erase(ConstIterator first, ConstIterator last) {
-            Iterator begin = ToIterator(first);
             Iterator end = ToIterator(last);
+            if(first == last) return end;
+
+            ListNode* const head = ToIterator(first).m_Current;
+            ListNode* const tail = end.m_Current->Previous;
 
-            while(begin != end) {
-                ListDataNode<ValueType>* node = DataCast(begin.m_Current);
-                ++begin;
-                DestroyNode(node);
+            // Unlink the whole range, destroy its elements and hand it to the free list as one chain
+            LinkNodes(head->Previous, end.m_Current);
+
+            for(ListNode* node = head; ; node = node->Next) {
+                DataCast(node)->Data.~ValueType();
+                --this->m_CurrentSize;
+                if(node == tail) break;
             }
+
+            tail->Next = m_HeadFree;
+            m_HeadFree = DataCast(head);
             
             return end;
         }
@@ -902,6 +893,7 @@ namespace wstl {
         /// @param value The value of the element to push
         /// @throws `LengthError` if the list is full and `__WSTL_ASSERT_PUSHPOP__` is defined
         void PushBack(ConstReferenceType value) {
+            if(this->Full()) this->RecordFailure();
             __WSTL_ASSERT_PUSHPOP_RETURN__(!this->Full(), WSTL_MAKE_EXCEPTION(LengthError, "List full"));
             CreateBack(value);
         }
@@ -911,6 +903,7 @@ namespace wstl {
         /// @param value The value of the element to push (rvalue reference)
         /// @throws `LengthError` if the list is full and `__WSTL_ASSERT_PUSHPOP__` is defined
         void PushBack(ValueType&& value) {
+            if(this->Full()) this->RecordFailure();
             __WSTL_ASSERT_PUSHPOP_RETURN__(!this->Full(), WSTL_MAKE_EXCEPTION(LengthError, "List full"));
             CreateBack(Move(value));
         }
@@ -923,6 +916,7 @@ namespace wstl {
         /// @since C++11
         template<typename... Args>
         void EmplaceBack(Args&&... args) {
+            if(this->Full()) this->RecordFailure();
             __WSTL_ASSERT_PUSHPOP_RETURN__(!this->Full(), WSTL_MAKE_EXCEPTION(LengthError, "List full"));
 
             ListDataNode<ValueType>* const nextFree = DataCast(m_HeadFree->Next);
@@ -937,6 +931,7 @@ namespace wstl {
         /// @brief Emplaces an element at the back of the list, constructing it in place
         /// @throws `LengthError` if the list is full and `__WSTL_ASSERT_PUSHPOP__` is defined
         void EmplaceBack() {
+            if(this->Full()) this->RecordFailure();
             __WSTL_ASSERT_PUSHPOP_RETURN__(!this->Full(), WSTL_MAKE_EXCEPTION(LengthError, "List full"));
 
             ListDataNode<ValueType>* const nextFree = DataCast(m_HeadFree->Next);
@@ -953,6 +948,7 @@ namespace wstl {
         /// @throws `LengthError` if the list is full and `__WSTL_ASSERT_PUSHPOP__` is defined
         template<typename Arg>
         void EmplaceBack(const Arg& arg) {
+            if(this->Full()) this->RecordFailure();
             __WSTL_ASSERT_PUSHPOP_RETURN__(!this->Full(), WSTL_MAKE_EXCEPTION(LengthError, "List full"));
 
             ListDataNode<ValueType>* const nextFree = DataCast(m_HeadFree->Next);
@@ -970,6 +966,7 @@ namespace wstl {
         /// @throws `LengthError` if the list is full and `__WSTL_ASSERT_PUSHPOP__` is defined
         template<typename Arg1, typename Arg2>
         void EmplaceBack(const Arg1& arg1, const Arg2& arg2) {
+            if(this->Full()) this->RecordFailure();
             __WSTL_ASSERT_PUSHPOP_RETURN__(!this->Full(), WSTL_MAKE_EXCEPTION(LengthError, "List full"));
 
             ListDataNode<ValueType>* const nextFree = DataCast(m_HeadFree->Next);
@@ -988,6 +985,7 @@ namespace wstl {
         /// @throws `LengthError` if the list is full and `__WSTL_ASSERT_PUSHPOP__` is defined
         template<typename Arg1, typename Arg2, typename Arg3>
         void EmplaceBack(const Arg1& arg1, const Arg2& arg2, const Arg3& arg3) {
+            if(this->Full()) this->RecordFailure();
             __WSTL_ASSERT_PUSHPOP_RETURN__(!this->Full(), WSTL_MAKE_EXCEPTION(LengthError, "List full"));
 
             ListDataNode<ValueType>* const nextFree = DataCast(m_HeadFree->Next);
@@ -1030,6 +1028,7 @@ namespace wstl {
         /// @param value The value of the element to push
         /// @throws `LengthError` if the list is full and `__WSTL_ASSERT_PUSHPOP__` is defined
         void PushFront(ConstReferenceType value) {
+            if(this->Full()) this->RecordFailure();
             __WSTL_ASSERT_PUSHPOP_RETURN__(!this->Full(), WSTL_MAKE_EXCEPTION(LengthError, "List full"));
             CreateFront(value);
         }
@@ -1039,6 +1038,7 @@ namespace wstl {
         /// @param value The value of the element to push (rvalue reference)
         /// @throws `LengthError` if the list is full and `__WSTL_ASSERT_PUSHPOP__` is defined
         void PushFront(ValueType&& value) {
+            if(this->Full()) this->RecordFailure();
             __WSTL_ASSERT_PUSHPOP_RETURN__(!this->Full(), WSTL_MAKE_EXCEPTION(LengthError, "List full"));
             CreateFront(Move(value));
         }
@@ -1051,6 +1051,7 @@ namespace wstl {
         /// @since C++11
         template<typename... Args>
         void EmplaceFront(Args&&... args) {
+            if(this->Full()) this->RecordFailure();
             __WSTL_ASSERT_PUSHPOP_RETURN__(!this->Full(), WSTL_MAKE_EXCEPTION(LengthError, "List full"));
 
             ListDataNode<ValueType>* const nextFree = DataCast(m_HeadFree->Next);
@@ -1065,6 +1066,7 @@ namespace wstl {
         /// @brief Emplaces an element at the front of the list, constructing it in place
         /// @throws `LengthError` if the list is full and `__WSTL_ASSERT_PUSHPOP__` is defined
         void EmplaceFront() {
+            if(this->Full()) this->RecordFailure();
             __WSTL_ASSERT_PUSHPOP_RETURN__(!this->Full(), WSTL_MAKE_EXCEPTION(LengthError, "List full"));
 
             ListDataNode<ValueType>* const nextFree = DataCast(m_HeadFree->Next);
@@ -1081,6 +1083,7 @@ namespace wstl {
         /// @throws `LengthError` if the list is full and `__WSTL_ASSERT_PUSHPOP__` is defined
         template<typename Arg>
         void EmplaceFront(const Arg& arg) {
+            if(this->Full()) this->RecordFailure();
             __WSTL_ASSERT_PUSHPOP_RETURN__(!this->Full(), WSTL_MAKE_EXCEPTION(LengthError, "List full"));
 
             ListDataNode<ValueType>* const nextFree = DataCast(m_HeadFree->Next);
@@ -1098,6 +1101,7 @@ namespace wstl {
         /// @throws `LengthError` if the list is full and `__WSTL_ASSERT_PUSHPOP__` is defined
         template<typename Arg1, typename Arg2>
         void EmplaceFront(const Arg1& arg1, const Arg2& arg2) {
+            if(this->Full()) this->RecordFailure();
             __WSTL_ASSERT_PUSHPOP_RETURN__(!this->Full(), WSTL_MAKE_EXCEPTION(LengthError, "List full"));
 
             ListDataNode<ValueType>* const nextFree = DataCast(m_HeadFree->Next);
@@ -1116,6 +1120,7 @@ namespace wstl {
         /// @throws `LengthError` if the list is full and `__WSTL_ASSERT_PUSHPOP__` is defined
         template<typename Arg1, typename Arg2, typename Arg3>
         void EmplaceFront(const Arg1& arg1, const Arg2& arg2, const Arg3& arg3) {
+            if(this->Full()) this->RecordFailure();
             __WSTL_ASSERT_PUSHPOP_RETURN__(!this->Full(), WSTL_MAKE_EXCEPTION(LengthError, "List full"));
 
             ListDataNode<ValueType>* const nextFree = DataCast(m_HeadFree->Next);
@@ -1135,6 +1140,139 @@ namespace wstl {
             DestroyFront();
         }
 
+        /// @brief Pushes an element to the back of the list if there is room, without error handling
+        /// @param value The value of the element to push
+        /// @return Nothing, or `ERROR_CODE_FULL` if the list is full
+        Expected<void> TryPushBack(ConstReferenceType value) {
+            if(this->Full()) {
+                this->RecordFailure();
+                return MakeUnexpected(ERROR_CODE_FULL);
+            }
+
+            CreateBack(value);
+            return Expected<void>();
+        }
+
+        #ifdef __WSTL_CXX11__
+        /// @brief Pushes an element to the back of the list if there is room, without error handling
+        /// @param value The value of the element to push (rvalue reference)
+        /// @return Nothing, or `ERROR_CODE_FULL` if the list is full
+        /// @since C++11
+        Expected<void> TryPushBack(ValueType&& value) {
+            if(this->Full()) {
+                this->RecordFailure();
+                return MakeUnexpected(ERROR_CODE_FULL);
+            }
+
+            CreateBack(Move(value));
+            return Expected<void>();
+        }
+
+        /// @brief Emplaces an element at the back of the list if there is room, without error handling
+        /// @param ...args Arguments to forward to the constructor of the element
+        /// @return Nothing, or `ERROR_CODE_FULL` if the list is full
+        /// @since C++11
+        template<typename... Args>
+        Expected<void> TryEmplaceBack(Args&&... args) {
+            if(this->Full()) {
+                this->RecordFailure();
+                return MakeUnexpected(ERROR_CODE_FULL);
+            }
+
+            EmplaceBack(Forward<Args>(args)...);
+            return Expected<void>();
+        }
+        #endif
+
+        /// @brief Pushes an element to the front of the list if there is room, without error handling
+        /// @param value The value of the element to push
+        /// @return Nothing, or `ERROR_CODE_FULL` if the list is full
+        Expected<void> TryPushFront(ConstReferenceType value) {
+            if(this->Full()) {
+                this->RecordFailure();
+                return MakeUnexpected(ERROR_CODE_FULL);
+            }
+
+            CreateFront(value);
+            return Expected<void>();
+        }
+
+        #ifdef __WSTL_CXX11__
+        /// @brief Pushes an element to the front of the list if there is room, without error handling
+        /// @param value The value of the element to push (rvalue reference)
+        /// @return Nothing, or `ERROR_CODE_FULL` if the list is full
+        /// @since C++11
+        Expected<void> TryPushFront(ValueType&& value) {
+            if(this->Full()) {
+                this->RecordFailure();
+                return MakeUnexpected(ERROR_CODE_FULL);
+            }
+
+            CreateFront(Move(value));
+            return Expected<void>();
+        }
+
+        /// @brief Emplaces an element at the front of the list if there is room, without error handling
+        /// @param ...args Arguments to forward to the constructor of the element
+        /// @return Nothing, or `ERROR_CODE_FULL` if the list is full
+        /// @since C++11
+        template<typename... Args>
+        Expected<void> TryEmplaceFront(Args&&... args) {
+            if(this->Full()) {
+                this->RecordFailure();
+                return MakeUnexpected(ERROR_CODE_FULL);
+            }
+
+            EmplaceFront(Forward<Args>(args)...);
+            return Expected<void>();
+        }
+        #endif
+
+        /// @brief Pops an element from the back of the list if there is one, without error handling
+        /// @return Nothing, or `ERROR_CODE_EMPTY` if the list is empty
+        Expected<void> TryPopBack() {
+            if(this->Empty()) return MakeUnexpected(ERROR_CODE_EMPTY);
+
+            DestroyBack();
+            return Expected<void>();
+        }
+
+        /// @brief Pops an element from the front of the list if there is one, without error handling
+        /// @return Nothing, or `ERROR_CODE_EMPTY` if the list is empty
+        Expected<void> TryPopFront() {
+            if(this->Empty()) return MakeUnexpected(ERROR_CODE_EMPTY);
+
+            DestroyFront();
+            return Expected<void>();
+        }
+
+        /// @brief Inserts an element at the specified position if there is room, without error handling
+        /// @param position The position to insert the element at
+        /// @param value The value of the element to insert
+        /// @return An iterator to the inserted element, or `ERROR_CODE_FULL` if the list is full
+        Expected<Iterator> TryInsert(ConstIterator position, ConstReferenceType value) {
+            if(this->Full()) {
+                this->RecordFailure();
+                return MakeUnexpected(ERROR_CODE_FULL);
+            }
+            return Insert(position, value);
+        }
+
+        #ifdef __WSTL_CXX11__
+        /// @brief Inserts an element at the specified position if there is room, without error handling
+        /// @param position The position to insert the element at
+        /// @param value The value of the element to insert (rvalue reference)
+        /// @return An iterator to the inserted element, or `ERROR_CODE_FULL` if the list is full
+        /// @since C++11
+        Expected<Iterator> TryInsert(ConstIterator position, ValueType&& value) {
+            if(this->Full()) {
+                this->RecordFailure();
+                return MakeUnexpected(ERROR_CODE_FULL);
+            }
+            return Insert(position, Move(value));
+        }
+        #endif
+
         /// @brief Prepends a range of elements to the front of the list
         /// @param range The range to prepend
         /// @throws `LengthError` if list's capacity is exceeded
@@ -1191,6 +1329,40 @@ namespace wstl {
             __Swap<StorageType>(other);
         }
 
+        /// @brief Grows the list into a larger block of nodes drawn from the allocator of its storage
+        /// @param capacity The minimum capacity after the call
+        /// @return `true` if the capacity is at least `capacity` afterwards
+        /// @details Only available for `AllocatorStorage`. Elements are moved to the new block in order
+        /// and the old block is returned to the allocator, all iterators and references are invalidated
+        /// @throws `BadAllocation` if the allocator fails
+        bool Reserve(SizeType capacity) {
+            if(capacity <= this->Capacity()) return true;
+            __WSTL_ASSERT_RETURNVALUE__(this->m_Storage.GetAllocator() != NullPointer, WSTL_MAKE_EXCEPTION(BadAllocation, "List storage has no allocator"), false);
+
+            StorageType grown(*this->m_Storage.GetAllocator(), capacity);
+            if(grown.Capacity < capacity) return false;
+
+            SizeType count = 0;
+            for(ListNode* i = HeadNode(); i != &m_Sentinel; ++count) {
+                ListDataNode<ValueType>* const node = DataCast(i);
+                i = i->Next;
+
+                ::new(&(grown.Data[count].Data)) ValueType(__WSTL_MOVE__(node->Data));
+                node->Data.~ValueType();
+            }
+
+            // Nodes of the new block are linked in order, the rest form the free list
+            LinkNodes(&m_Sentinel, &m_Sentinel);
+            for(SizeType i = 0; i < count; ++i) LinkNodeBefore(&m_Sentinel, &(grown.Data[i]));
+
+            for(SizeType i = count; i < capacity - 1; ++i) grown.Data[i].Next = &(grown.Data[i + 1]);
+            grown.Data[capacity - 1].Next = NullPointer;
+            m_HeadFree = &(grown.Data[count]);
+
+            this->m_Storage.Swap(grown);
+            return true;
+        }
+
         /// @brief Merges another sorted list into this list, providing that it's sorted using a comparator
         /// @param other The list to merge
         /// @param compare Binary comparator to use for merging
@@ -1789,6 +1961,31 @@ namespace wstl {
             LinkNodes(lastElement, position);
         }
 
+        /// @brief Links the first nodes of the free list before a position, as the chain they already form
+        /// @param position The position to link before
+        /// @param count The number of nodes to take, their elements must already be constructed
+        /// @return Iterator to the first linked node, or to `position` if `count` is zero
+        Iterator LinkFreeChain(ListNode* position, SizeType count) {
+            if(count == 0) return Iterator(position);
+
+            ListNode* const first = m_HeadFree;
+            ListNode* last = first;
+
+            // Free nodes are linked forward only
+            for(SizeType i = 1; i < count; ++i) {
+                last->Next->Previous = last;
+                last = last->Next;
+            }
+
+            m_HeadFree = DataCast(last->Next);
+
+            LinkNodes(position->Previous, first);
+            LinkNodes(last, position);
+            this->m_CurrentSize += count;
+
+            return Iterator(first);
+        }
+
         /// @brief Casts a list node to a data node
         /// @param node The node to cast
         static ListDataNode<ValueType>* DataCast(ListNode* node) {
@@ -1853,7 +2050,7 @@ namespace wstl {
         typename EnableIf<!IsTriviallyDestructible<U>::Value, void>::Type Initialize() {
             if(this->m_CurrentSize > 0) {
                 // Call destructors on allocated nodes 
-                for(ListDataNode<ValueType>* i = DataCast(HeadNode()); i != &m_Sentinel; i = i->Next) i->Data.~ValueType();
+                for(ListDataNode<ValueType>* i = DataCast(HeadNode()); i != &m_Sentinel; i = DataCast(i->Next)) i->Data.~ValueType();
 
                 // Connect allocated to free list
                 if(m_HeadFree != NullPointer) TailNode()->Next = m_HeadFree;
@@ -2142,13 +2339,13 @@ namespace wstl {
 
     // Make list
 
-    #ifdef __WSTL_CXX11__
+    #if defined(__WSTL_CXX14__) && !defined(__WSTL_NO_INITIALIZERLIST__)
     /// @brief Makes a list out of the given values, with specified type
     /// @tparam T Type of the elements
     /// @param ...values Values to create the list with
     /// @return A list containing the given values
     /// @ingroup list
-    /// @since C++11
+    /// @since C++14
     template<typename T, typename First, typename... Rest>
     constexpr auto MakeList(First&& first, Rest&&... rest) {
         return List<T, sizeof...(rest) + 1>({ Forward<First>(first), Forward<Rest>(rest)... });
@@ -2158,7 +2355,7 @@ namespace wstl {
     /// @param ...values Values to create the list with
     /// @return A list containing the given values
     /// @ingroup list
-    /// @since C++11
+    /// @since C++14
     template<typename First, typename... Rest>
     constexpr auto MakeList(First&& first, Rest&&... rest) {
         using T = CommonTypeType<First, Rest...>;
@@ -2391,9 +2588,119 @@ namespace wstl {
         template<typename T, typename U1, typename U2, size_t N>
         FixedList(U1, U2, T(&)[N]) -> FixedList<T, N>;
 
+        #ifndef __WSTL_NO_INITIALIZERLIST__
         template<typename T, size_t N>
         FixedList(InitializerList<T>, T(&)[N]) -> FixedList<T, N>;
         #endif
+        #endif
+    }
+
+    namespace allocated {
+        /// @brief Version of the list that draws its storage from an allocator
+        /// @details Elements in storage are stored as nodes, so value type is wrapped in `ListDataNode` type.
+        /// The capacity is chosen at construction and can be raised later with `Reserve`
+        /// @tparam T Type of the elements
+        /// @ingroup list
+        template<typename T>
+        class List : public BasicList<AllocatorStorage<T> > {
+        private:
+            typedef BasicList<AllocatorStorage<T> > Base;
+
+        public:
+            typedef typename Base::ValueType ValueType;
+            typedef typename Base::SizeType SizeType;
+            typedef typename Base::DifferenceType DifferenceType;
+            typedef typename Base::ReferenceType ReferenceType;
+            typedef typename Base::ConstReferenceType ConstReferenceType;
+            typedef typename Base::PointerType PointerType;
+            typedef typename Base::ConstPointerType ConstPointerType;
+
+            typedef typename Base::StorageType StorageType;
+
+            /// @brief Constructor that draws storage from an allocator
+            /// @param allocator The allocator to draw the storage from
+            /// @param capacity Capacity of the list
+            List(Allocator& allocator, SizeType capacity) : Base(StorageType(allocator, capacity)) {}
+
+            /// @brief Copy constructor that draws storage from an allocator
+            /// @param other The list to copy from
+            /// @param allocator The allocator to draw the storage from
+            /// @param capacity Capacity of the list
+            List(const List& other, Allocator& allocator, SizeType capacity) : Base(other, StorageType(allocator, capacity)) {}
+
+            #ifdef __WSTL_CXX11__
+            /// @brief Move constructor that draws storage from an allocator
+            /// @param other The list to move from
+            /// @param allocator The allocator to draw the storage from
+            /// @param capacity Capacity of the list
+            /// @since C++11
+            List(List&& other, Allocator& allocator, SizeType capacity) : Base(Move(other), StorageType(allocator, capacity)) {}
+            #endif
+
+            /// @brief Constructor that initializes the list with a range of elements
+            /// @param first The position of the first element in the range
+            /// @param last The position following the last element in the range
+            /// @param allocator The allocator to draw the storage from
+            /// @param capacity Capacity of the list
+            template<typename InputIterator>
+            List(InputIterator first, InputIterator last, Allocator& allocator, SizeType capacity, 
+                typename EnableIf<!IsIntegral<InputIterator>::Value, int>::Type = 0) : Base(first, last, StorageType(allocator, capacity)) {}
+
+            /// @brief Constructor that initializes the list with a specified number of copies of a value
+            /// @param count The number of copies to create
+            /// @param allocator The allocator to draw the storage from
+            /// @param capacity Capacity of the list
+            explicit List(SizeType count, Allocator& allocator, SizeType capacity) : Base(count, StorageType(allocator, capacity)) {}
+                
+            /// @brief Constructor that initializes the list with a specified number of copies of a value
+            /// @param count The number of copies to create
+            /// @param value The value to copy into the new elements
+            /// @param allocator The allocator to draw the storage from
+            /// @param capacity Capacity of the list
+            List(SizeType count, ConstReferenceType value, Allocator& allocator, SizeType capacity) : Base(count, value, StorageType(allocator, capacity)) {}
+
+            #if defined(__WSTL_CXX11__) && !defined(__WSTL_NO_INITIALIZERLIST__)
+            /// @brief Constructor that initializes the list with an initializer list
+            /// @param list The initializer list to initialize from
+            /// @param allocator The allocator to draw the storage from
+            /// @param capacity Capacity of the list
+            /// @since C++11
+            List(InitializerList<ValueType> list, Allocator& allocator, SizeType capacity) : Base(list, StorageType(allocator, capacity)) {}
+            #endif
+
+            /// @brief Copy assignment operator
+            /// @param other The list to copy from
+            List& operator=(const List& other) {
+                if(this != &other) this->Assign(other.Begin(), other.End());
+                return *this;
+            }
+
+            #ifdef __WSTL_CXX11__
+            /// @brief Move assignment operator
+            /// @param other The list to move from
+            /// @since C++11
+            List& operator=(List&& other) {
+                if(this != &other) {
+                    this->Clear();
+
+                    typename Base::Iterator it = other.Begin();
+                    for(; it != other.End(); ++it) this->CreateBack(Move(*it));
+                }
+
+                return *this;
+            }
+
+            #ifndef __WSTL_NO_INITIALIZERLIST__
+            /// @brief Assignment operator that assigns from an initializer list
+            /// @param list The initializer list to assign from
+            /// @since C++11
+            List& operator=(InitializerList<ValueType> list) {
+                this->Assign(list);
+                return *this;
+            }
+            #endif
+            #endif
+        };
     }
 }
 
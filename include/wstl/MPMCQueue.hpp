@@ -0,0 +1,409 @@
+// Part of WardenSTL - https://github.com/WardenHD/WardenSTL
+// Copyright (c) 2025 Artem Bezruchko (WardenHD)
+//
+// Licensed under the MIT License. See LICENSE file for details.
+
+#ifndef __WSTL_MPMCQUEUE_HPP__
+#define __WSTL_MPMCQUEUE_HPP__
+
+#include "private/Platform.hpp"
+#include "private/Error.hpp"
+#include "Container.hpp"
+#include "Atomic.hpp"
+#include "Span.hpp"
+#include "Algorithm.hpp"
+#include "Utility.hpp"
+#include "StandardExceptions.hpp"
+#include <stddef.h>
+
+
+/// @defgroup mpmc_queue MPMC Queue
+/// @ingroup containers
+/// @brief A lock-free bounded multi-producer multi-consumer queue
+
+namespace wstl {
+    namespace __private {
+        /// @brief Assumed size of a cache line, used to keep the two positions apart
+        static const __WSTL_CONSTEXPR__ size_t __CACHE_LINE_SIZE = 64;
+    }
+
+    // MPMC queue cell
+
+    /// @brief Slot of a multi-producer multi-consumer queue
+    /// @tparam T Type of the element
+    /// @details The sequence number tells which lap of the queue may access the slot next.
+    /// External buffers of MPMC queues must be arrays of cells
+    /// @ingroup mpmc_queue
+    template<typename T>
+    struct MPMCQueueCell {
+        typedef T ValueType;
+
+        Atomic<size_t> Sequence;
+        ValueType Value;
+    };
+
+    // Basic MPMC queue
+
+    /// @brief A bounded queue that is safe for any number of producers and consumers running concurrently
+    /// @tparam Storage The storage type used by the queue, holds `MPMCQueueCell` and its capacity
+    /// must be a power of two and at least 2
+    /// @details Dmitry Vyukov's algorithm: every slot carries a sequence number, so a push or
+    /// a pop claims its slot with one compare-exchange on the shared position and then hands the
+    /// slot over through the sequence with release ordering. A thread that is preempted between
+    /// claiming and releasing a slot delays only the threads that reach that slot, so the queue
+    /// is lock-free in practice but not formally. Elements are assigned into the slots
+    /// @ingroup mpmc_queue
+    /// @see https://www.1024cores.net/home/lock-free-algorithms/queues/bounded-mpmc-queue
+    template<typename Storage>
+    class BasicMPMCQueue {
+    public:
+        WSTL_STATIC_ASSERT(!IsVoid<Storage>::Value, "Storage must be non-void");
+
+        typedef typename Storage::ValueType CellType;
+        typedef typename CellType::ValueType ValueType;
+        typedef typename Storage::SizeType SizeType;
+        typedef ptrdiff_t DifferenceType;
+        typedef ValueType& ReferenceType;
+        typedef const ValueType& ConstReferenceType;
+        typedef ValueType* PointerType;
+        typedef const ValueType* ConstPointerType;
+
+        typedef Storage StorageType;
+
+        /// @brief Gets the number of elements in the queue
+        /// @details The value is only a snapshot while other threads use the queue
+        SizeType Size() const __WSTL_NOEXCEPT__ {
+            const SizeType dequeue = m_DequeuePosition.Load(MEMORY_ORDER_ACQUIRE);
+            const SizeType enqueue = m_EnqueuePosition.Load(MEMORY_ORDER_ACQUIRE);
+            // A pop may complete between the two loads and overtake the snapshot
+            return static_cast<DifferenceType>(enqueue - dequeue) < 0 ? 0 : Min<SizeType>(enqueue - dequeue, Capacity());
+        }
+
+        /// @brief Gets the capacity of the queue
+        __WSTL_CONSTEXPR__ SizeType Capacity() const __WSTL_NOEXCEPT__ {
+            return m_Storage.Capacity;
+        }
+
+        /// @brief Gets the maximum size of the queue
+        __WSTL_CONSTEXPR__ SizeType MaxSize() const __WSTL_NOEXCEPT__ {
+            return m_Storage.Capacity;
+        }
+
+        /// @brief Checks if the queue is empty
+        bool Empty() const __WSTL_NOEXCEPT__ {
+            return Size() == 0;
+        }
+
+        /// @brief Checks if the queue is full
+        bool Full() const __WSTL_NOEXCEPT__ {
+            return Size() == Capacity();
+        }
+
+        // Producers
+
+        /// @brief Tries to push an element to the back of the queue
+        /// @param value Element to push
+        /// @return `true` if the element was pushed, `false` if the queue is full
+        bool TryPush(ConstReferenceType value) {
+            SizeType position;
+            CellType* cell = ClaimPush(position);
+            if(!cell) return false;
+
+            cell->Value = value;
+            cell->Sequence.Store(position + 1, MEMORY_ORDER_RELEASE);
+            return true;
+        }
+
+        #ifdef __WSTL_CXX11__
+        /// @brief Tries to push an element to the back of the queue by moving it
+        /// @param value Element to push
+        /// @return `true` if the element was pushed, `false` if the queue is full
+        /// @since C++11
+        bool TryPush(ValueType&& value) {
+            SizeType position;
+            CellType* cell = ClaimPush(position);
+            if(!cell) return false;
+
+            cell->Value = Move(value);
+            cell->Sequence.Store(position + 1, MEMORY_ORDER_RELEASE);
+            return true;
+        }
+        #endif
+
+        /// @brief Copies as many elements as fit into the queue
+        /// @param data Elements to copy
+        /// @return Number of elements copied
+        /// @details All elements are claimed with a single compare-exchange and stay
+        /// consecutive in the queue
+        template<typename U, size_t Extent>
+        SizeType Write(Span<U, Extent> data) {
+            SizeType position = m_EnqueuePosition.Load(MEMORY_ORDER_RELAXED);
+            SizeType count = 0;
+
+            while(data.Size() != 0) {
+                const DifferenceType difference = static_cast<DifferenceType>(Sequence(position) - position);
+
+                if(difference < 0) return 0;
+                if(difference > 0) {
+                    // Another producer claimed the slot, retry from the new position
+                    position = m_EnqueuePosition.Load(MEMORY_ORDER_RELAXED);
+                    continue;
+                }
+
+                count = 1;
+                while(count < data.Size() && Sequence(position + count) == position + count) ++count;
+                if(m_EnqueuePosition.CompareExchangeWeak(position, position + count, MEMORY_ORDER_RELAXED)) break;
+            }
+
+            for(SizeType i = 0; i < count; ++i) {
+                CellType& cell = m_Storage.Data[(position + i) & Mask()];
+                cell.Value = data[i];
+                cell.Sequence.Store(position + i + 1, MEMORY_ORDER_RELEASE);
+            }
+
+            return count;
+        }
+
+        // Consumers
+
+        /// @brief Tries to pop the front element of the queue
+        /// @param value Receives the popped element
+        /// @return `true` if an element was popped, `false` if the queue is empty
+        bool TryPop(ReferenceType value) {
+            SizeType position;
+            CellType* cell = ClaimPop(position);
+            if(!cell) return false;
+
+            value = __WSTL_MOVE__(cell->Value);
+            cell->Sequence.Store(position + Capacity(), MEMORY_ORDER_RELEASE);
+            return true;
+        }
+
+        /// @brief Tries to pop the front element of the queue and discard it
+        /// @return `true` if an element was popped, `false` if the queue is empty
+        bool TryPop() {
+            SizeType position;
+            CellType* cell = ClaimPop(position);
+            if(!cell) return false;
+
+            cell->Sequence.Store(position + Capacity(), MEMORY_ORDER_RELEASE);
+            return true;
+        }
+
+        /// @brief Moves as many elements as available out of the queue
+        /// @param data Destination of the elements
+        /// @return Number of elements moved
+        /// @details All elements are claimed with a single compare-exchange
+        template<size_t Extent>
+        SizeType Read(Span<ValueType, Extent> data) {
+            SizeType position = m_DequeuePosition.Load(MEMORY_ORDER_RELAXED);
+            SizeType count = 0;
+
+            while(data.Size() != 0) {
+                const DifferenceType difference = static_cast<DifferenceType>(Sequence(position) - (position + 1));
+
+                if(difference < 0) return 0;
+                if(difference > 0) {
+                    // Another consumer claimed the slot, retry from the new position
+                    position = m_DequeuePosition.Load(MEMORY_ORDER_RELAXED);
+                    continue;
+                }
+
+                count = 1;
+                while(count < data.Size() && Sequence(position + count) == position + count + 1) ++count;
+                if(m_DequeuePosition.CompareExchangeWeak(position, position + count, MEMORY_ORDER_RELAXED)) break;
+            }
+
+            for(SizeType i = 0; i < count; ++i) {
+                CellType& cell = m_Storage.Data[(position + i) & Mask()];
+                data[i] = __WSTL_MOVE__(cell.Value);
+                cell.Sequence.Store(position + i + Capacity(), MEMORY_ORDER_RELEASE);
+            }
+
+            return count;
+        }
+
+    protected:
+        /// @brief Protected default constructor
+        /// @details Only available if Storage is default-constructible
+        BasicMPMCQueue() : m_Storage(), m_EnqueuePosition(0), m_DequeuePosition(0) {
+            Initialize();
+        }
+
+        /// @brief Protected constructor with storage parameter
+        /// @param storage The storage to use for the queue
+        BasicMPMCQueue(const Storage& storage) : m_Storage(storage), m_EnqueuePosition(0), m_DequeuePosition(0) {
+            Initialize();
+        }
+
+        /// @brief Protected destructor
+        ~BasicMPMCQueue() {}
+
+    private:
+        Storage m_Storage;
+        // Producers and consumers write different positions, keep them on separate cache lines
+        __WSTL_ALIGNAS__(__private::__CACHE_LINE_SIZE) Atomic<SizeType> m_EnqueuePosition;
+        __WSTL_ALIGNAS__(__private::__CACHE_LINE_SIZE) Atomic<SizeType> m_DequeuePosition;
+
+        /// @brief Deleted copy constructor
+        BasicMPMCQueue(const BasicMPMCQueue&) __WSTL_DELETE__;
+
+        /// @brief Deleted copy assignment operator
+        BasicMPMCQueue& operator=(const BasicMPMCQueue&) __WSTL_DELETE__;
+
+        SizeType Mask() const __WSTL_NOEXCEPT__ {
+            return Capacity() - 1;
+        }
+
+        SizeType Sequence(SizeType position) const {
+            return m_Storage.Data[position & Mask()].Sequence.Load(MEMORY_ORDER_ACQUIRE);
+        }
+
+        CellType* ClaimPush(SizeType& position) {
+            position = m_EnqueuePosition.Load(MEMORY_ORDER_RELAXED);
+
+            for(;;) {
+                CellType& cell = m_Storage.Data[position & Mask()];
+                const DifferenceType difference = static_cast<DifferenceType>(cell.Sequence.Load(MEMORY_ORDER_ACQUIRE) - position);
+
+                if(difference == 0) {
+                    if(m_EnqueuePosition.CompareExchangeWeak(position, position + 1, MEMORY_ORDER_RELAXED)) return &cell;
+                }
+                // The slot still holds an element from the previous lap
+                else if(difference < 0) return __WSTL_NULLPTR__;
+                else position = m_EnqueuePosition.Load(MEMORY_ORDER_RELAXED);
+            }
+        }
+
+        CellType* ClaimPop(SizeType& position) {
+            position = m_DequeuePosition.Load(MEMORY_ORDER_RELAXED);
+
+            for(;;) {
+                CellType& cell = m_Storage.Data[position & Mask()];
+                const DifferenceType difference = static_cast<DifferenceType>(cell.Sequence.Load(MEMORY_ORDER_ACQUIRE) - (position + 1));
+
+                if(difference == 0) {
+                    if(m_DequeuePosition.CompareExchangeWeak(position, position + 1, MEMORY_ORDER_RELAXED)) return &cell;
+                }
+                // The slot has not been filled in this lap yet
+                else if(difference < 0) return __WSTL_NULLPTR__;
+                else position = m_DequeuePosition.Load(MEMORY_ORDER_RELAXED);
+            }
+        }
+
+        void Initialize() {
+            __WSTL_ASSERT_RETURN__(Capacity() >= 2 && (Capacity() & (Capacity() - 1)) == 0,
+                WSTL_MAKE_EXCEPTION(LengthError, "MPMC queue capacity must be a power of two and at least 2"));
+
+            for(SizeType i = 0; i < Capacity(); ++i) m_Storage.Data[i].Sequence.Store(i, MEMORY_ORDER_RELAXED);
+        }
+    };
+
+    // MPMC queue
+
+    /// @brief Version of MPMC queue with fixed storage, default option
+    /// @tparam T Type of the elements
+    /// @tparam N Capacity of the queue, must be a power of two and at least 2
+    /// @ingroup mpmc_queue
+    template<typename T, size_t N>
+    class MPMCQueue : public BasicMPMCQueue<FixedStorage<MPMCQueueCell<T>, N> > {
+    private:
+        typedef BasicMPMCQueue<FixedStorage<MPMCQueueCell<T>, N> > Base;
+
+    public:
+        WSTL_STATIC_ASSERT(N >= 2 && (N & (N - 1)) == 0, "MPMC queue capacity must be a power of two and at least 2");
+
+        typedef typename Base::CellType CellType;
+        typedef typename Base::ValueType ValueType;
+        typedef typename Base::SizeType SizeType;
+        typedef typename Base::DifferenceType DifferenceType;
+        typedef typename Base::ReferenceType ReferenceType;
+        typedef typename Base::ConstReferenceType ConstReferenceType;
+        typedef typename Base::PointerType PointerType;
+        typedef typename Base::ConstPointerType ConstPointerType;
+
+        typedef typename Base::StorageType StorageType;
+
+        /// @brief The static size, needed for metaprogramming
+        static const __WSTL_CONSTEXPR__ SizeType StaticSize = N;
+
+        /// @brief Default constructor
+        MPMCQueue() : Base() {}
+    };
+
+    template<typename T, size_t N>
+    const __WSTL_CONSTEXPR__ typename MPMCQueue<T, N>::SizeType MPMCQueue<T, N>::StaticSize;
+
+    // MPMC queue external
+
+    namespace external {
+        /// @brief Version of MPMC queue that uses external storage
+        /// @tparam T Type of the elements
+        /// @ingroup mpmc_queue
+        template<typename T>
+        class MPMCQueue : public BasicMPMCQueue<ExternalStorage<MPMCQueueCell<T> > > {
+        private:
+            typedef BasicMPMCQueue<ExternalStorage<MPMCQueueCell<T> > > Base;
+
+        public:
+            typedef typename Base::CellType CellType;
+            typedef typename Base::ValueType ValueType;
+            typedef typename Base::SizeType SizeType;
+            typedef typename Base::DifferenceType DifferenceType;
+            typedef typename Base::ReferenceType ReferenceType;
+            typedef typename Base::ConstReferenceType ConstReferenceType;
+            typedef typename Base::PointerType PointerType;
+            typedef typename Base::ConstPointerType ConstPointerType;
+
+            typedef typename Base::StorageType StorageType;
+
+            /// @brief Constructor that uses external buffer
+            /// @param buffer Pointer to the external buffer of cells
+            /// @param capacity Capacity of the external buffer, must be a power of two and at least 2
+            MPMCQueue(CellType* buffer, SizeType capacity) : Base(StorageType(buffer, capacity)) {}
+        };
+
+        /// @brief Version of MPMC queue that uses fixed external storage with compile-time known capacity
+        /// @tparam T Type of the elements
+        /// @tparam N Capacity of the queue, must be a power of two and at least 2
+        /// @ingroup mpmc_queue
+        template<typename T, size_t N>
+        class FixedMPMCQueue : public BasicMPMCQueue<FixedExternalStorage<MPMCQueueCell<T>, N> > {
+        private:
+            typedef BasicMPMCQueue<FixedExternalStorage<MPMCQueueCell<T>, N> > Base;
+
+        public:
+            WSTL_STATIC_ASSERT(N >= 2 && (N & (N - 1)) == 0, "MPMC queue capacity must be a power of two and at least 2");
+
+            typedef typename Base::CellType CellType;
+            typedef typename Base::ValueType ValueType;
+            typedef typename Base::SizeType SizeType;
+            typedef typename Base::DifferenceType DifferenceType;
+            typedef typename Base::ReferenceType ReferenceType;
+            typedef typename Base::ConstReferenceType ConstReferenceType;
+            typedef typename Base::PointerType PointerType;
+            typedef typename Base::ConstPointerType ConstPointerType;
+
+            typedef typename Base::StorageType StorageType;
+
+            /// @brief The static size, needed for metaprogramming
+            static const __WSTL_CONSTEXPR__ SizeType StaticSize = N;
+
+            /// @brief Constructor that uses external buffer
+            /// @param buffer Pointer to the external buffer of cells
+            explicit FixedMPMCQueue(CellType* buffer) : Base(StorageType(buffer)) {}
+        };
+
+        template<typename T, size_t N>
+        const __WSTL_CONSTEXPR__ typename FixedMPMCQueue<T, N>::SizeType FixedMPMCQueue<T, N>::StaticSize;
+
+        // Template deduction guides
+
+        #ifdef __WSTL_CXX17__
+        template<typename T, size_t N>
+        FixedMPMCQueue(MPMCQueueCell<T>(&)[N]) -> FixedMPMCQueue<T, N>;
+        #endif
+    }
+}
+
+#endif
\ No newline at end of file
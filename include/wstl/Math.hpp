@@ -22,6 +22,10 @@
 #include <stdlib.h>
 #endif
 
+#ifdef __WSTL_ARM_DSP__
+#include <arm_acle.h>
+#endif
+
 
 // Defines introduced
 
@@ -170,6 +174,102 @@ namespace wstl {
         return { x / y, x % y };
     }
 
+    // Saturating arithmetic
+
+    namespace __private {
+        template<typename T>
+        __WSTL_CONSTEXPR__ bool __IsNegativeInteger(T value, TrueType) {
+            return value < T(0);
+        }
+
+        template<typename T>
+        __WSTL_CONSTEXPR__ bool __IsNegativeInteger(T, FalseType) {
+            return false;
+        }
+
+        template<typename T>
+        __WSTL_CONSTEXPR14__ T __SaturatingAdd(T x, T y, TrueType) {
+            if(y > 0 ? x > NumericLimits<T>::Max() - y : x < NumericLimits<T>::Min() - y) return y > 0 ? NumericLimits<T>::Max() : NumericLimits<T>::Min();
+            return T(x + y);
+        }
+
+        template<typename T>
+        __WSTL_CONSTEXPR14__ T __SaturatingAdd(T x, T y, FalseType) {
+            const T result = T(x + y);
+            return result < x ? NumericLimits<T>::Max() : result;
+        }
+
+        template<typename T>
+        __WSTL_CONSTEXPR14__ T __SaturatingSubtract(T x, T y, TrueType) {
+            if(y < 0 ? x > NumericLimits<T>::Max() + y : x < NumericLimits<T>::Min() + y) return y < 0 ? NumericLimits<T>::Max() : NumericLimits<T>::Min();
+            return T(x - y);
+        }
+
+        template<typename T>
+        __WSTL_CONSTEXPR14__ T __SaturatingSubtract(T x, T y, FalseType) {
+            return x < y ? T(0) : T(x - y);
+        }
+    }
+
+    /// @brief Converts an integer to another integral type, clamping it to the range of that type
+    /// @tparam T Type to convert to
+    /// @param value The value to convert
+    /// @return The value, or the limit of `T` closest to it
+    /// @details With `__WSTL_ARM_DSP__` defined, narrowing a 32-bit value uses `SSAT` or `USAT`
+    /// @ingroup maths
+    /// @see https://en.cppreference.com/w/cpp/numeric/saturate_cast
+    template<typename T, typename U>
+    __WSTL_NODISCARD__ __WSTL_CONSTEXPR14__
+    inline typename EnableIf<IsIntegral<T>::Value && IsIntegral<U>::Value, T>::Type SaturateCast(U value) {
+        #ifdef __WSTL_ARM_DSP__
+        if(IsSame<U, int32_t>::Value && sizeof(T) < 4 && !__WSTL_IS_CONSTANT_EVALUATED__()) {
+            if(IsSigned<T>::Value) return T(__ssat(int32_t(value), sizeof(T) < 4 ? sizeof(T) * CHAR_BIT : 32));
+            return T(__usat(int32_t(value), sizeof(T) < 4 ? sizeof(T) * CHAR_BIT : 31));
+        }
+        #endif
+
+        if(__private::__IsNegativeInteger(value, IsSigned<U>())) {
+            if(!IsSigned<T>::Value) return T(0);
+            return intmax_t(value) < intmax_t(NumericLimits<T>::Min()) ? NumericLimits<T>::Min() : T(value);
+        }
+
+        return uintmax_t(value) > uintmax_t(NumericLimits<T>::Max()) ? NumericLimits<T>::Max() : T(value);
+    }
+
+    /// @brief Adds two integers, clamping the result to the range of their type
+    /// @param x First value
+    /// @param y Second value
+    /// @return The sum, or the limit of `T` closest to it
+    /// @details With `__WSTL_ARM_DSP__` defined, 32-bit signed addition uses `QADD`
+    /// @ingroup maths
+    /// @see https://en.cppreference.com/w/cpp/numeric/add_sat
+    template<typename T>
+    __WSTL_NODISCARD__ __WSTL_CONSTEXPR14__
+    inline typename EnableIf<IsIntegral<T>::Value, T>::Type SaturatingAdd(T x, T y) {
+        #ifdef __WSTL_ARM_DSP__
+        if(IsSame<T, int32_t>::Value && !__WSTL_IS_CONSTANT_EVALUATED__()) return T(__qadd(int32_t(x), int32_t(y)));
+        #endif
+
+        return __private::__SaturatingAdd(x, y, IsSigned<T>());
+    }
+
+    /// @brief Subtracts two integers, clamping the result to the range of their type
+    /// @param x Value to subtract from
+    /// @param y Value to subtract
+    /// @return The difference, or the limit of `T` closest to it
+    /// @details With `__WSTL_ARM_DSP__` defined, 32-bit signed subtraction uses `QSUB`
+    /// @ingroup maths
+    /// @see https://en.cppreference.com/w/cpp/numeric/sub_sat
+    template<typename T>
+    __WSTL_NODISCARD__ __WSTL_CONSTEXPR14__
+    inline typename EnableIf<IsIntegral<T>::Value, T>::Type SaturatingSubtract(T x, T y) {
+        #ifdef __WSTL_ARM_DSP__
+        if(IsSame<T, int32_t>::Value && !__WSTL_IS_CONSTANT_EVALUATED__()) return T(__qsub(int32_t(x), int32_t(y)));
+        #endif
+
+        return __private::__SaturatingSubtract(x, y, IsSigned<T>());
+    }
+
     // Power
 
     /// @brief Raises a number of integral type to the given power
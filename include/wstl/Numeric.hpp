@@ -12,7 +12,20 @@
 #include "private/Platform.hpp"
 #include "private/Swap.hpp"
 #include "Iterator.hpp"
+#include "TypeTraits.hpp"
 #include "Math.hpp"
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(__WSTL_AVX2__)
+#include <immintrin.h>
+#elif defined(__WSTL_SSE2__)
+#include <emmintrin.h>
+#elif defined(__WSTL_NEON__)
+#include <arm_neon.h>
+#elif defined(__WSTL_HELIUM__)
+#include <arm_mve.h>
+#endif
 
 
 /// @defgroup numeric Numeric
@@ -62,20 +75,509 @@ namespace wstl {
         return initial;
     }
 
+    // Reduce
+
+    namespace __private {
+        template<typename T>
+        struct __NumericPlus {
+            template<typename U>
+            __WSTL_CONSTEXPR__ T operator()(T left, const U& right) const {
+                return __WSTL_MOVE__(left) + right;
+            }
+        };
+
+        template<typename T>
+        struct __NumericMultiplies {
+            template<typename U, typename V>
+            __WSTL_CONSTEXPR__ T operator()(const U& left, const V& right) const {
+                return left * right;
+            }
+        };
+
+        template<typename InputIterator, typename T, typename BinaryOperation>
+        __WSTL_CONSTEXPR14__ T __Reduce(InputIterator first, InputIterator last, T initial, BinaryOperation operation, FalseType) {
+            for(; first != last; ++first) initial = operation(__WSTL_MOVE__(initial), *first);
+            return initial;
+        }
+
+        template<typename RandomAccessIterator, typename T, typename BinaryOperation>
+        __WSTL_CONSTEXPR14__ T __Reduce(RandomAccessIterator first, RandomAccessIterator last, T initial, BinaryOperation operation, TrueType) {
+            // Four independent chains, so an operation does not wait for the result of the one before
+            if(last - first >= 8) {
+                T second(first[1]);
+                T third(first[2]);
+                T fourth(first[3]);
+                initial = operation(__WSTL_MOVE__(initial), first[0]);
+
+                for(first += 4; last - first >= 4; first += 4) {
+                    initial = operation(__WSTL_MOVE__(initial), first[0]);
+                    second = operation(__WSTL_MOVE__(second), first[1]);
+                    third = operation(__WSTL_MOVE__(third), first[2]);
+                    fourth = operation(__WSTL_MOVE__(fourth), first[3]);
+                }
+
+                initial = operation(operation(__WSTL_MOVE__(initial), __WSTL_MOVE__(second)), operation(__WSTL_MOVE__(third), __WSTL_MOVE__(fourth)));
+            }
+
+            for(; first != last; ++first) initial = operation(__WSTL_MOVE__(initial), *first);
+            return initial;
+        }
+
+        template<typename InputIterator, typename T, typename BinaryOperation, typename UnaryOperation>
+        __WSTL_CONSTEXPR14__ T __TransformReduce(InputIterator first, InputIterator last, T initial, BinaryOperation reduce, 
+            UnaryOperation transform, FalseType) {
+            for(; first != last; ++first) initial = reduce(__WSTL_MOVE__(initial), transform(*first));
+            return initial;
+        }
+
+        template<typename RandomAccessIterator, typename T, typename BinaryOperation, typename UnaryOperation>
+        __WSTL_CONSTEXPR14__ T __TransformReduce(RandomAccessIterator first, RandomAccessIterator last, T initial, BinaryOperation reduce, 
+            UnaryOperation transform, TrueType) {
+            if(last - first >= 8) {
+                T second(transform(first[1]));
+                T third(transform(first[2]));
+                T fourth(transform(first[3]));
+                initial = reduce(__WSTL_MOVE__(initial), transform(first[0]));
+
+                for(first += 4; last - first >= 4; first += 4) {
+                    initial = reduce(__WSTL_MOVE__(initial), transform(first[0]));
+                    second = reduce(__WSTL_MOVE__(second), transform(first[1]));
+                    third = reduce(__WSTL_MOVE__(third), transform(first[2]));
+                    fourth = reduce(__WSTL_MOVE__(fourth), transform(first[3]));
+                }
+
+                initial = reduce(reduce(__WSTL_MOVE__(initial), __WSTL_MOVE__(second)), reduce(__WSTL_MOVE__(third), __WSTL_MOVE__(fourth)));
+            }
+
+            for(; first != last; ++first) initial = reduce(__WSTL_MOVE__(initial), transform(*first));
+            return initial;
+        }
+
+        template<typename InputIterator1, typename InputIterator2, typename T, typename BinaryOperation1, typename BinaryOperation2>
+        __WSTL_CONSTEXPR14__ T __TransformReduce(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, T initial, 
+            BinaryOperation1 reduce, BinaryOperation2 transform, FalseType) {
+            for(; first1 != last1; ++first1, ++first2) initial = reduce(__WSTL_MOVE__(initial), transform(*first1, *first2));
+            return initial;
+        }
+
+        template<typename RandomAccessIterator1, typename RandomAccessIterator2, typename T, typename BinaryOperation1, typename BinaryOperation2>
+        __WSTL_CONSTEXPR14__ T __TransformReduce(RandomAccessIterator1 first1, RandomAccessIterator1 last1, RandomAccessIterator2 first2, T initial, 
+            BinaryOperation1 reduce, BinaryOperation2 transform, TrueType) {
+            if(last1 - first1 >= 8) {
+                T second(transform(first1[1], first2[1]));
+                T third(transform(first1[2], first2[2]));
+                T fourth(transform(first1[3], first2[3]));
+                initial = reduce(__WSTL_MOVE__(initial), transform(first1[0], first2[0]));
+
+                for(first1 += 4, first2 += 4; last1 - first1 >= 4; first1 += 4, first2 += 4) {
+                    initial = reduce(__WSTL_MOVE__(initial), transform(first1[0], first2[0]));
+                    second = reduce(__WSTL_MOVE__(second), transform(first1[1], first2[1]));
+                    third = reduce(__WSTL_MOVE__(third), transform(first1[2], first2[2]));
+                    fourth = reduce(__WSTL_MOVE__(fourth), transform(first1[3], first2[3]));
+                }
+
+                initial = reduce(reduce(__WSTL_MOVE__(initial), __WSTL_MOVE__(second)), reduce(__WSTL_MOVE__(third), __WSTL_MOVE__(fourth)));
+            }
+
+            for(; first1 != last1; ++first1, ++first2) initial = reduce(__WSTL_MOVE__(initial), transform(*first1, *first2));
+            return initial;
+        }
+
+        /// @brief Checks if the sum of a range into a `T` has a vector kernel
+        template<typename Iterator, typename T>
+        struct __IsVectorSum : FalseType {};
+
+        /// @brief Checks if the sum of products of two ranges into a `T` has a vector kernel
+        template<typename Iterator1, typename Iterator2, typename T>
+        struct __IsVectorDot : FalseType {};
+
+        #if defined(__WSTL_SSE2__) || defined(__WSTL_NEON__) || defined(__WSTL_HELIUM__)
+        template<typename T>
+        struct __IsVectorSum<T*, int32_t> : IsSame<typename RemoveCV<T>::Type, int32_t> {};
+
+        template<typename T, typename U>
+        struct __IsVectorDot<T*, U*, int32_t> : BoolConstant<IsSame<typename RemoveCV<T>::Type, int16_t>::Value && 
+            IsSame<typename RemoveCV<U>::Type, int16_t>::Value> {};
+
+        #if defined(__WSTL_SSE2__)
+        // Lanes are added as unsigned, so they wrap around like the vector additions did
+        inline int32_t __HorizontalSum(__m128i vector) {
+            uint32_t lanes[4];
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), vector);
+            return static_cast<int32_t>(lanes[0] + lanes[1] + lanes[2] + lanes[3]);
+        }
+
+        inline float __HorizontalSum(__m128 vector) {
+            float lanes[4];
+            _mm_storeu_ps(lanes, vector);
+            return (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+        }
+
+        #ifdef __WSTL_AVX2__
+        inline int32_t __HorizontalSum(__m256i vector) {
+            return __HorizontalSum(_mm_add_epi32(_mm256_castsi256_si128(vector), _mm256_extracti128_si256(vector, 1)));
+        }
+
+        inline float __HorizontalSum(__m256 vector) {
+            return __HorizontalSum(_mm_add_ps(_mm256_castps256_ps128(vector), _mm256_extractf128_ps(vector, 1)));
+        }
+        #endif
+        #endif
+
+        inline int32_t __VectorSum(const int32_t* first, size_t count, int32_t initial) {
+            uint32_t result = static_cast<uint32_t>(initial);
+            size_t i = 0;
+
+            #if defined(__WSTL_SSE2__)
+            #ifdef __WSTL_AVX2__
+            __m256i wide0 = _mm256_setzero_si256();
+            __m256i wide1 = _mm256_setzero_si256();
+
+            for(; i + 16 <= count; i += 16) {
+                wide0 = _mm256_add_epi32(wide0, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first + i)));
+                wide1 = _mm256_add_epi32(wide1, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first + i + 8)));
+            }
+
+            result += static_cast<uint32_t>(__HorizontalSum(_mm256_add_epi32(wide0, wide1)));
+            #endif
+            __m128i sum0 = _mm_setzero_si128();
+            __m128i sum1 = _mm_setzero_si128();
+
+            for(; i + 8 <= count; i += 8) {
+                sum0 = _mm_add_epi32(sum0, _mm_loadu_si128(reinterpret_cast<const __m128i*>(first + i)));
+                sum1 = _mm_add_epi32(sum1, _mm_loadu_si128(reinterpret_cast<const __m128i*>(first + i + 4)));
+            }
+
+            result += static_cast<uint32_t>(__HorizontalSum(_mm_add_epi32(sum0, sum1)));
+            #elif defined(__WSTL_NEON__)
+            int32x4_t sum0 = vdupq_n_s32(0);
+            int32x4_t sum1 = vdupq_n_s32(0);
+
+            for(; i + 8 <= count; i += 8) {
+                sum0 = vaddq_s32(sum0, vld1q_s32(first + i));
+                sum1 = vaddq_s32(sum1, vld1q_s32(first + i + 4));
+            }
+
+            result += static_cast<uint32_t>(vaddvq_s32(vaddq_s32(sum0, sum1)));
+            #elif defined(__WSTL_HELIUM__)
+            int32x4_t sum0 = vdupq_n_s32(0);
+            int32x4_t sum1 = vdupq_n_s32(0);
+
+            for(; i + 8 <= count; i += 8) {
+                sum0 = vaddq_s32(sum0, vld1q_s32(first + i));
+                sum1 = vaddq_s32(sum1, vld1q_s32(first + i + 4));
+            }
+
+            result += static_cast<uint32_t>(vaddvq_s32(vaddq_s32(sum0, sum1)));
+            #endif
+
+            for(; i < count; ++i) result += static_cast<uint32_t>(first[i]);
+            return static_cast<int32_t>(result);
+        }
+
+        inline int32_t __VectorDot(const int16_t* first1, const int16_t* first2, size_t count, int32_t initial) {
+            uint32_t result = static_cast<uint32_t>(initial);
+            size_t i = 0;
+
+            #if defined(__WSTL_SSE2__)
+            #ifdef __WSTL_AVX2__
+            __m256i wide0 = _mm256_setzero_si256();
+            __m256i wide1 = _mm256_setzero_si256();
+
+            for(; i + 32 <= count; i += 32) {
+                wide0 = _mm256_add_epi32(wide0, _mm256_madd_epi16(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(first1 + i)), 
+                    _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first2 + i))));
+                wide1 = _mm256_add_epi32(wide1, _mm256_madd_epi16(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(first1 + i + 16)), 
+                    _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first2 + i + 16))));
+            }
+
+            result += static_cast<uint32_t>(__HorizontalSum(_mm256_add_epi32(wide0, wide1)));
+            #endif
+            __m128i sum0 = _mm_setzero_si128();
+            __m128i sum1 = _mm_setzero_si128();
+
+            // Multiplies pairs of 16-bit lanes and adds adjacent products into 32-bit lanes
+            for(; i + 16 <= count; i += 16) {
+                sum0 = _mm_add_epi32(sum0, _mm_madd_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(first1 + i)), 
+                    _mm_loadu_si128(reinterpret_cast<const __m128i*>(first2 + i))));
+                sum1 = _mm_add_epi32(sum1, _mm_madd_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(first1 + i + 8)), 
+                    _mm_loadu_si128(reinterpret_cast<const __m128i*>(first2 + i + 8))));
+            }
+
+            result += static_cast<uint32_t>(__HorizontalSum(_mm_add_epi32(sum0, sum1)));
+            #elif defined(__WSTL_NEON__)
+            int32x4_t sum0 = vdupq_n_s32(0);
+            int32x4_t sum1 = vdupq_n_s32(0);
+
+            for(; i + 8 <= count; i += 8) {
+                const int16x8_t left = vld1q_s16(first1 + i);
+                const int16x8_t right = vld1q_s16(first2 + i);
+
+                sum0 = vmlal_s16(sum0, vget_low_s16(left), vget_low_s16(right));
+                sum1 = vmlal_high_s16(sum1, left, right);
+            }
+
+            result += static_cast<uint32_t>(vaddvq_s32(vaddq_s32(sum0, sum1)));
+            #elif defined(__WSTL_HELIUM__)
+            int32_t sum0 = 0;
+            int32_t sum1 = 0;
+
+            // Multiply-accumulate across the lanes into a scalar, two chains let the beats overlap
+            for(; i + 16 <= count; i += 16) {
+                sum0 = vmladavaq_s16(sum0, vld1q_s16(first1 + i), vld1q_s16(first2 + i));
+                sum1 = vmladavaq_s16(sum1, vld1q_s16(first1 + i + 8), vld1q_s16(first2 + i + 8));
+            }
+
+            result += static_cast<uint32_t>(sum0) + static_cast<uint32_t>(sum1);
+            #endif
+
+            for(; i < count; ++i) result += static_cast<uint32_t>(int32_t(first1[i]) * int32_t(first2[i]));
+            return static_cast<int32_t>(result);
+        }
+        #endif
+
+        #if defined(__WSTL_SSE2__) || defined(__WSTL_NEON__) || defined(__WSTL_HELIUM_FLOAT__)
+        template<typename T>
+        struct __IsVectorSum<T*, float> : IsSame<typename RemoveCV<T>::Type, float> {};
+
+        template<typename T, typename U>
+        struct __IsVectorDot<T*, U*, float> : BoolConstant<IsSame<typename RemoveCV<T>::Type, float>::Value && 
+            IsSame<typename RemoveCV<U>::Type, float>::Value> {};
+
+        inline float __VectorSum(const float* first, size_t count, float initial) {
+            float result = 0;
+            size_t i = 0;
+
+            #if defined(__WSTL_SSE2__)
+            #ifdef __WSTL_AVX2__
+            __m256 wide0 = _mm256_setzero_ps();
+            __m256 wide1 = _mm256_setzero_ps();
+
+            for(; i + 16 <= count; i += 16) {
+                wide0 = _mm256_add_ps(wide0, _mm256_loadu_ps(first + i));
+                wide1 = _mm256_add_ps(wide1, _mm256_loadu_ps(first + i + 8));
+            }
+
+            result += __HorizontalSum(_mm256_add_ps(wide0, wide1));
+            #endif
+            __m128 sum0 = _mm_setzero_ps();
+            __m128 sum1 = _mm_setzero_ps();
+
+            for(; i + 8 <= count; i += 8) {
+                sum0 = _mm_add_ps(sum0, _mm_loadu_ps(first + i));
+                sum1 = _mm_add_ps(sum1, _mm_loadu_ps(first + i + 4));
+            }
+
+            result += __HorizontalSum(_mm_add_ps(sum0, sum1));
+            #elif defined(__WSTL_NEON__)
+            float32x4_t sum0 = vdupq_n_f32(0);
+            float32x4_t sum1 = vdupq_n_f32(0);
+
+            for(; i + 8 <= count; i += 8) {
+                sum0 = vaddq_f32(sum0, vld1q_f32(first + i));
+                sum1 = vaddq_f32(sum1, vld1q_f32(first + i + 4));
+            }
+
+            result += vaddvq_f32(vaddq_f32(sum0, sum1));
+            #elif defined(__WSTL_HELIUM_FLOAT__)
+            float32x4_t sum0 = vdupq_n_f32(0);
+            float32x4_t sum1 = vdupq_n_f32(0);
+
+            for(; i + 8 <= count; i += 8) {
+                sum0 = vaddq_f32(sum0, vld1q_f32(first + i));
+                sum1 = vaddq_f32(sum1, vld1q_f32(first + i + 4));
+            }
+
+            sum0 = vaddq_f32(sum0, sum1);
+            result += (vgetq_lane_f32(sum0, 0) + vgetq_lane_f32(sum0, 1)) + (vgetq_lane_f32(sum0, 2) + vgetq_lane_f32(sum0, 3));
+            #endif
+
+            for(; i < count; ++i) result += first[i];
+            return initial + result;
+        }
+
+        inline float __VectorDot(const float* first1, const float* first2, size_t count, float initial) {
+            float result = 0;
+            size_t i = 0;
+
+            #if defined(__WSTL_SSE2__)
+            #ifdef __WSTL_AVX2__
+            __m256 wide0 = _mm256_setzero_ps();
+            __m256 wide1 = _mm256_setzero_ps();
+
+            for(; i + 16 <= count; i += 16) {
+                wide0 = _mm256_add_ps(wide0, _mm256_mul_ps(_mm256_loadu_ps(first1 + i), _mm256_loadu_ps(first2 + i)));
+                wide1 = _mm256_add_ps(wide1, _mm256_mul_ps(_mm256_loadu_ps(first1 + i + 8), _mm256_loadu_ps(first2 + i + 8)));
+            }
+
+            result += __HorizontalSum(_mm256_add_ps(wide0, wide1));
+            #endif
+            __m128 sum0 = _mm_setzero_ps();
+            __m128 sum1 = _mm_setzero_ps();
+
+            for(; i + 8 <= count; i += 8) {
+                sum0 = _mm_add_ps(sum0, _mm_mul_ps(_mm_loadu_ps(first1 + i), _mm_loadu_ps(first2 + i)));
+                sum1 = _mm_add_ps(sum1, _mm_mul_ps(_mm_loadu_ps(first1 + i + 4), _mm_loadu_ps(first2 + i + 4)));
+            }
+
+            result += __HorizontalSum(_mm_add_ps(sum0, sum1));
+            #elif defined(__WSTL_NEON__)
+            float32x4_t sum0 = vdupq_n_f32(0);
+            float32x4_t sum1 = vdupq_n_f32(0);
+
+            for(; i + 8 <= count; i += 8) {
+                sum0 = vfmaq_f32(sum0, vld1q_f32(first1 + i), vld1q_f32(first2 + i));
+                sum1 = vfmaq_f32(sum1, vld1q_f32(first1 + i + 4), vld1q_f32(first2 + i + 4));
+            }
+
+            result += vaddvq_f32(vaddq_f32(sum0, sum1));
+            #elif defined(__WSTL_HELIUM_FLOAT__)
+            float32x4_t sum0 = vdupq_n_f32(0);
+            float32x4_t sum1 = vdupq_n_f32(0);
+
+            for(; i + 8 <= count; i += 8) {
+                sum0 = vfmaq_f32(sum0, vld1q_f32(first1 + i), vld1q_f32(first2 + i));
+                sum1 = vfmaq_f32(sum1, vld1q_f32(first1 + i + 4), vld1q_f32(first2 + i + 4));
+            }
+
+            sum0 = vaddq_f32(sum0, sum1);
+            result += (vgetq_lane_f32(sum0, 0) + vgetq_lane_f32(sum0, 1)) + (vgetq_lane_f32(sum0, 2) + vgetq_lane_f32(sum0, 3));
+            #endif
+
+            for(; i < count; ++i) result += first1[i] * first2[i];
+            return initial + result;
+        }
+        #endif
+
+        template<typename InputIterator, typename T>
+        __WSTL_CONSTEXPR14__ T __ReduceSum(InputIterator first, InputIterator last, T initial, FalseType) {
+            return __Reduce(first, last, initial, __NumericPlus<T>(), IsRandomAccessIterator<InputIterator>());
+        }
+
+        template<typename InputIterator1, typename InputIterator2, typename T>
+        __WSTL_CONSTEXPR14__ T __DotProduct(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, T initial, FalseType) {
+            return __TransformReduce(first1, last1, first2, initial, __NumericPlus<T>(), __NumericMultiplies<T>(), 
+                BoolConstant<IsRandomAccessIterator<InputIterator1>::Value && IsRandomAccessIterator<InputIterator2>::Value>());
+        }
+
+        #if defined(__WSTL_SSE2__) || defined(__WSTL_NEON__) || defined(__WSTL_HELIUM__)
+        template<typename T, typename U>
+        __WSTL_CONSTEXPR14__ U __ReduceSum(T* first, T* last, U initial, TrueType) {
+            if(__WSTL_IS_CONSTANT_EVALUATED__()) return __ReduceSum(first, last, initial, FalseType());
+            return __VectorSum(first, static_cast<size_t>(last - first), initial);
+        }
+
+        template<typename T, typename U, typename V>
+        __WSTL_CONSTEXPR14__ V __DotProduct(T* first1, T* last1, U* first2, V initial, TrueType) {
+            if(__WSTL_IS_CONSTANT_EVALUATED__()) return __DotProduct(first1, last1, first2, initial, FalseType());
+            return __VectorDot(first1, first2, static_cast<size_t>(last1 - first1), initial);
+        }
+        #endif
+    }
+
+    /// @brief Sums the values in a range in any order
+    /// @param first Iterator to the initial position in the range
+    /// @param last Iterator to the final position in the range
+    /// @param initial Initial value to start with
+    /// @return The sum of the values in the range
+    /// @details Unlike `Accumulate`, the additions may be regrouped. Random access ranges are summed
+    /// with four independent accumulators, and with `__WSTL_USE_SIMD__` defined, `float` and `int32_t`
+    /// arrays are summed with vector instructions. Floating point sums may differ from `Accumulate`
+    /// in the last bits
+    /// @ingroup numeric
+    /// @see https://en.cppreference.com/w/cpp/algorithm/reduce
+    template<typename InputIterator, typename T>
+    __WSTL_CONSTEXPR14__ T Reduce(InputIterator first, InputIterator last, T initial) {
+        return __private::__ReduceSum(first, last, initial, __private::__IsVectorSum<InputIterator, T>());
+    }
+
+    /// @brief Combines the values in a range with an operation in any order
+    /// @param first Iterator to the initial position in the range
+    /// @param last Iterator to the final position in the range
+    /// @param initial Initial value to start with
+    /// @param operation Binary operation function object, must be associative and commutative
+    /// @return The combined value
+    /// @details Random access ranges are reduced with four independent accumulators
+    /// @ingroup numeric
+    /// @see https://en.cppreference.com/w/cpp/algorithm/reduce
+    template<typename InputIterator, typename T, typename BinaryOperation>
+    __WSTL_CONSTEXPR14__ T Reduce(InputIterator first, InputIterator last, T initial, BinaryOperation operation) {
+        return __private::__Reduce(first, last, initial, operation, IsRandomAccessIterator<InputIterator>());
+    }
+
     // Inner product
 
+    namespace __private {
+        /// @brief Checks if an inner product gives the same result in any order, which holds for integers
+        /// summed in the unsigned type of the same width, as such sums wrap around. Excludes `bool`,
+        /// which saturates instead
+        template<typename Iterator1, typename Iterator2, typename T>
+        struct __IsExactDotProduct : BoolConstant<IsRandomAccessIterator<Iterator1>::Value && IsRandomAccessIterator<Iterator2>::Value && 
+            IsIntegral<typename IteratorTraits<Iterator1>::ValueType>::Value && IsIntegral<typename IteratorTraits<Iterator2>::ValueType>::Value && 
+            IsIntegral<T>::Value && !IsSame<T, bool>::Value> {};
+
+        /// @brief Adds two values of an unsigned type, wrapping around on overflow
+        template<typename T>
+        struct __WrappingPlus {
+            __WSTL_CONSTEXPR__ T operator()(T left, T right) const {
+                return static_cast<T>(left + right);
+            }
+        };
+
+        /// @brief Multiplies two values and converts the product to an unsigned type
+        template<typename T>
+        struct __WrappingMultiplies {
+            template<typename U, typename V>
+            __WSTL_CONSTEXPR__ T operator()(const U& left, const V& right) const {
+                return static_cast<T>(left * right);
+            }
+        };
+
+        /// @brief Sums the products with four accumulators of the unsigned type of the same width as `T`,
+        /// so that regrouping the sum cannot overflow where summing from left to right would not
+        template<typename RandomAccessIterator1, typename RandomAccessIterator2, typename T>
+        __WSTL_CONSTEXPR14__ T __WrappingDotProduct(RandomAccessIterator1 first1, RandomAccessIterator1 last1, RandomAccessIterator2 first2, T initial, FalseType) {
+            typedef typename MakeUnsigned<T>::Type UnsignedType;
+            return static_cast<T>(__TransformReduce(first1, last1, first2, static_cast<UnsignedType>(initial),
+                __WrappingPlus<UnsignedType>(), __WrappingMultiplies<UnsignedType>(), TrueType()));
+        }
+
+        #if defined(__WSTL_SSE2__) || defined(__WSTL_NEON__) || defined(__WSTL_HELIUM__)
+        // The vector kernels already add their lanes as unsigned
+        template<typename T, typename U, typename V>
+        __WSTL_CONSTEXPR14__ V __WrappingDotProduct(T* first1, T* last1, U* first2, V initial, TrueType) {
+            return __DotProduct(first1, last1, first2, initial, TrueType());
+        }
+        #endif
+
+        template<typename InputIterator1, typename InputIterator2, typename T>
+        __WSTL_CONSTEXPR14__ T __InnerProduct(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, T initial, FalseType) {
+            for(; first1 != last1; ++first1, ++first2) initial = __WSTL_MOVE__(initial) + (*first1 * *first2);
+            return initial;
+        }
+
+        template<typename RandomAccessIterator1, typename RandomAccessIterator2, typename T>
+        __WSTL_CONSTEXPR14__ T __InnerProduct(RandomAccessIterator1 first1, RandomAccessIterator1 last1, RandomAccessIterator2 first2, T initial, TrueType) {
+            return __WrappingDotProduct(first1, last1, first2, initial, __IsVectorDot<RandomAccessIterator1, RandomAccessIterator2, T>());
+        }
+    }
+
     /// @brief Computes the inner product (sum of products) of two ranges
     /// @param first1 Iterator to the initial position in the first range
     /// @param last1 Iterator to the final position in the first range
     /// @param first2 Iterator to the initial position in the second range
     /// @param initial Initial value to start with
     /// @return The inner product of the two ranges
+    /// @details Integer products of random access ranges are summed with four independent accumulators
+    /// of the unsigned type of the same width, which gives the same result as summing from left to right.
+    /// With `__WSTL_USE_SIMD__` defined, arrays of `int16_t` into `int32_t` use the vector kernel of
+    /// `TransformReduce`. Floating point products are summed from left to right, use `TransformReduce`
+    /// to sum them faster
     /// @ingroup numeric
     /// @see https://en.cppreference.com/w/cpp/algorithm/inner_product
     template<typename InputIterator1, typename InputIterator2, typename T>
     __WSTL_CONSTEXPR14__ T InnerProduct(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, T initial) {
-        for(; first1 != last1; ++first1, ++first2) initial = __WSTL_MOVE__(initial) + (*first1 * *first2);
-        return initial;
+        return __private::__InnerProduct(first1, last1, first2, initial, __private::__IsExactDotProduct<InputIterator1, InputIterator2, T>());
     }
 
     /// @brief Computes the inner product (sum of products) of two ranges
@@ -95,6 +597,57 @@ namespace wstl {
         return initial;
     }
 
+    // Transform reduce
+
+    /// @brief Computes the sum of products of two ranges in any order
+    /// @param first1 Iterator to the initial position in the first range
+    /// @param last1 Iterator to the final position in the first range
+    /// @param first2 Iterator to the initial position in the second range
+    /// @param initial Initial value to start with
+    /// @return The sum of the products
+    /// @details Random access ranges are summed with four independent accumulators, and with
+    /// `__WSTL_USE_SIMD__` defined, arrays of `float` into `float` and of `int16_t` into `int32_t`
+    /// with vector multiply-accumulate instructions
+    /// @ingroup numeric
+    /// @see https://en.cppreference.com/w/cpp/algorithm/transform_reduce
+    template<typename InputIterator1, typename InputIterator2, typename T>
+    __WSTL_CONSTEXPR14__ T TransformReduce(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, T initial) {
+        return __private::__DotProduct(first1, last1, first2, initial, __private::__IsVectorDot<InputIterator1, InputIterator2, T>());
+    }
+
+    /// @brief Transforms pairs of elements of two ranges and combines the results in any order
+    /// @param first1 Iterator to the initial position in the first range
+    /// @param last1 Iterator to the final position in the first range
+    /// @param first2 Iterator to the initial position in the second range
+    /// @param initial Initial value to start with
+    /// @param reduce Binary operation that combines the results, must be associative and commutative
+    /// @param transform Binary operation applied to the pairs of elements
+    /// @return The combined value
+    /// @details Random access ranges are reduced with four independent accumulators
+    /// @ingroup numeric
+    /// @see https://en.cppreference.com/w/cpp/algorithm/transform_reduce
+    template<typename InputIterator1, typename InputIterator2, typename T, typename BinaryOperation1, typename BinaryOperation2>
+    __WSTL_CONSTEXPR14__ T TransformReduce(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, T initial, 
+        BinaryOperation1 reduce, BinaryOperation2 transform) {
+        return __private::__TransformReduce(first1, last1, first2, initial, reduce, transform, 
+            BoolConstant<IsRandomAccessIterator<InputIterator1>::Value && IsRandomAccessIterator<InputIterator2>::Value>());
+    }
+
+    /// @brief Transforms the elements of a range and combines the results in any order
+    /// @param first Iterator to the initial position in the range
+    /// @param last Iterator to the final position in the range
+    /// @param initial Initial value to start with
+    /// @param reduce Binary operation that combines the results, must be associative and commutative
+    /// @param transform Unary operation applied to the elements
+    /// @return The combined value
+    /// @details Random access ranges are reduced with four independent accumulators
+    /// @ingroup numeric
+    /// @see https://en.cppreference.com/w/cpp/algorithm/transform_reduce
+    template<typename InputIterator, typename T, typename BinaryOperation, typename UnaryOperation>
+    __WSTL_CONSTEXPR14__ T TransformReduce(InputIterator first, InputIterator last, T initial, BinaryOperation reduce, UnaryOperation transform) {
+        return __private::__TransformReduce(first, last, initial, reduce, transform, IsRandomAccessIterator<InputIterator>());
+    }
+
     // Adjacent difference
 
     /// @brief Computes the difference between adjacent elements in a range
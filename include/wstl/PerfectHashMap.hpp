@@ -0,0 +1,258 @@
+// Part of WardenSTL - https://github.com/WardenHD/WardenSTL
+// Copyright (c) 2025 Artem Bezruchko (WardenHD)
+//
+// Licensed under the MIT License. See LICENSE file for details.
+
+#ifndef __WSTL_PERFECTHASHMAP_HPP__
+#define __WSTL_PERFECTHASHMAP_HPP__
+
+#include "private/Platform.hpp"
+#include "private/Error.hpp"
+#include "hash/FNV1.hpp"
+#include "Functional.hpp"
+#include "Utility.hpp"
+#include "TypeTraits.hpp"
+#include "Limits.hpp"
+#include "StandardExceptions.hpp"
+#include "StaticAssert.hpp"
+#include "NullPointer.hpp"
+#include <stddef.h>
+#include <stdint.h>
+
+
+/// @defgroup perfect_hash_map Perfect hash map
+/// @ingroup containers
+/// @brief Constant map with a minimal perfect hash built at compile time
+
+namespace wstl {
+    namespace __private {
+        /// @brief Finalizer of MurmurHash3, spreads every input bit over the whole word
+        __WSTL_CONSTEXPR14__ inline uint64_t __PerfectHashMix(uint64_t value) {
+            value ^= value >> 33;
+            value *= 0xFF51AFD7ED558CCDULL;
+            value ^= value >> 33;
+            value *= 0xC4CEB9FE1A85EC53ULL;
+            return value ^ (value >> 33);
+        }
+
+        /// @brief Hashes the bytes of an integral key, least significant first
+        template<typename Hasher, typename Key>
+        __WSTL_CONSTEXPR14__ typename Hasher::HashType __PerfectHashKey(const Key& key, TrueType) {
+            Hasher hasher;
+            for(size_t i = 0; i < sizeof(Key); ++i) hasher.PushBack(uint8_t(uint64_t(key) >> (8 * i)));
+
+            return hasher.Value();
+        }
+
+        /// @brief Hashes the bytes of the characters of a string key
+        template<typename Hasher, typename Key>
+        __WSTL_CONSTEXPR14__ typename Hasher::HashType __PerfectHashKey(const Key& key, FalseType) {
+            Hasher hasher;
+
+            for(typename Key::ConstIterator it = key.Begin(); it != key.End(); ++it) {
+                for(size_t i = 0; i < sizeof(*it); ++i) hasher.PushBack(uint8_t(uint64_t(*it) >> (8 * i)));
+            }
+
+            return hasher.Value();
+        }
+    }
+
+    // Perfect hash map
+
+    /// @brief Constant associative container whose keys are placed by a minimal perfect hash
+    /// @tparam Key Type of the keys, an integral type or a string type such as `StringView`
+    /// @tparam T Type of the mapped values
+    /// @tparam N Number of keys
+    /// @tparam Hasher Byte hasher from `wstl::hash` with at least 32 bits of output, hashes the keys
+    /// @tparam KeyEqual Equality functor for the keys
+    /// @details The map is built once from a list of distinct keys, at compile time when it is
+    /// `constexpr` (C++14), and is never modified, so a `static constexpr` map lives in read-only
+    /// memory. The table uses the hash-and-displace method (CHD): keys are split by their hash into
+    /// buckets of about four, then, largest bucket first, each bucket gets the smallest
+    /// displacement that sends all its keys to free slots. There are exactly `N` slots, one per
+    /// key. A lookup hashes the key once, mixes the hash with the displacement of its bucket to get
+    /// the slot, and compares one key
+    /// @ingroup perfect_hash_map
+    ///
+    /// @code
+    /// typedef void (*Command)(StringView arguments);
+    ///
+    /// static __WSTL_CONSTEXPR14__ PerfectHashMap<StringView, Command, 3> Commands = MakePerfectHashMap<StringView, Command>({
+    ///     { "help", &Help }, { "reset", &Reset }, { "status", &Status }
+    /// });
+    ///
+    /// if(const Command* command = Commands.Find(name)) (*command)(arguments);
+    /// @endcode
+    /// @see https://cmph.sourceforge.net/papers/esa09.pdf
+    template<typename Key, typename T, size_t N, typename Hasher = hash::FNV1a_64, typename KeyEqual = EqualTo<Key> >
+    class PerfectHashMap {
+    public:
+        WSTL_STATIC_ASSERT(N > 0, "Map must have a key");
+        WSTL_STATIC_ASSERT(sizeof(typename Hasher::HashType) >= 4, "Hash must have at least 32 bits");
+
+        typedef Key KeyType;
+        typedef T MappedType;
+        typedef Pair<Key, T> ValueType;
+        typedef size_t SizeType;
+        typedef const ValueType& ConstReferenceType;
+        typedef const ValueType* ConstPointerType;
+        typedef const ValueType* ConstIterator;
+
+        /// @brief Average number of keys in a bucket
+        static const __WSTL_CONSTEXPR__ SizeType BucketLoad = 4;
+
+        /// @brief Number of buckets, each has one displacement
+        static const __WSTL_CONSTEXPR__ SizeType BucketCount = (N + BucketLoad - 1) / BucketLoad;
+
+        /// @brief Builds the map
+        /// @param entries Keys and their mapped values, the keys must be distinct
+        /// @throws `LogicError` if two keys are equal or have the same hash
+        __WSTL_CONSTEXPR14__ explicit PerfectHashMap(const ValueType (&entries)[N]) : m_Entries(), m_Displacements() {
+            uint64_t hashes[N] = {};
+            SizeType buckets[N] = {};
+            SizeType sizes[BucketCount] = {};
+
+            for(SizeType i = 0; i < N; ++i) {
+                hashes[i] = Hash(entries[i].First);
+                buckets[i] = Bucket(hashes[i]);
+                ++sizes[buckets[i]];
+
+                for(SizeType j = 0; j < i; ++j) {
+                    __WSTL_ASSERT_RETURN__(hashes[i] != hashes[j], WSTL_MAKE_EXCEPTION(LogicError, "Perfect hash map keys must be distinct"));
+                }
+            }
+
+            // Place the largest buckets first, while most slots are free
+            SizeType order[BucketCount] = {};
+            for(SizeType i = 0; i < BucketCount; ++i) {
+                SizeType j = i;
+
+                for(; j > 0 && sizes[order[j - 1]] < sizes[i]; --j) order[j] = order[j - 1];
+                order[j] = i;
+            }
+
+            bool used[N] = {};
+            SizeType members[N] = {};
+            SizeType slots[N] = {};
+
+            for(SizeType i = 0; i < BucketCount && sizes[order[i]] > 0; ++i) {
+                const SizeType bucket = order[i];
+                SizeType count = 0;
+
+                for(SizeType j = 0; j < N; ++j) {
+                    if(buckets[j] == bucket) members[count++] = j;
+                }
+
+                uint32_t displacement = 0;
+
+                for(;; ++displacement) {
+                    __WSTL_ASSERT_RETURN__(displacement != NumericLimits<uint32_t>::Max(), WSTL_MAKE_EXCEPTION(LogicError, "Perfect hash map could not be built"));
+                    bool placed = true;
+
+                    for(SizeType j = 0; j < count && placed; ++j) {
+                        slots[j] = Slot(hashes[members[j]], displacement);
+                        placed = !used[slots[j]];
+
+                        for(SizeType k = 0; k < j && placed; ++k) placed = slots[k] != slots[j];
+                    }
+
+                    if(placed) break;
+                }
+
+                m_Displacements[bucket] = displacement;
+
+                for(SizeType j = 0; j < count; ++j) {
+                    used[slots[j]] = true;
+                    m_Entries[slots[j]].First = entries[members[j]].First;
+                    m_Entries[slots[j]].Second = entries[members[j]].Second;
+                }
+            }
+        }
+
+        /// @brief Finds the value mapped to a key
+        /// @param key Key to search for
+        /// @return Pointer to the mapped value, or null pointer if the key is not in the map
+        __WSTL_NODISCARD__ __WSTL_CONSTEXPR14__ const T* Find(const Key& key) const {
+            const ValueType& entry = m_Entries[IndexOf(key)];
+            return KeyEqual()(entry.First, key) ? &entry.Second : NullPointer;
+        }
+
+        /// @brief Gets the value mapped to a key with checking
+        /// @param key Key to search for
+        /// @return Reference to the mapped value
+        /// @throws `OutOfRange` if the key is not in the map
+        __WSTL_NODISCARD__ __WSTL_CONSTEXPR14__ const T& At(const Key& key) const {
+            const ValueType& entry = m_Entries[IndexOf(key)];
+            __WSTL_ASSERT__(KeyEqual()(entry.First, key), WSTL_MAKE_EXCEPTION(OutOfRange, "Key not found"));
+
+            return entry.Second;
+        }
+
+        /// @brief Checks whether the map contains a key
+        /// @param key Key to search for
+        __WSTL_NODISCARD__ __WSTL_CONSTEXPR14__ bool Contains(const Key& key) const {
+            return KeyEqual()(m_Entries[IndexOf(key)].First, key);
+        }
+
+        /// @brief Gets the slot a key would be stored in
+        /// @param key Key to search for
+        /// @return Index in [0, N), unique for every key of the map, which makes it usable to index
+        /// parallel arrays; other keys give the index of some key of the map
+        __WSTL_NODISCARD__ __WSTL_CONSTEXPR14__ SizeType IndexOf(const Key& key) const {
+            const uint64_t hash = Hash(key);
+            return Slot(hash, m_Displacements[Bucket(hash)]);
+        }
+
+        /// @brief Gets the iterator to the beginning of the map, entries are in slot order
+        __WSTL_NODISCARD__ __WSTL_CONSTEXPR__ ConstIterator Begin() const __WSTL_NOEXCEPT__ {
+            return m_Entries;
+        }
+
+        /// @brief Gets the iterator to the end of the map
+        __WSTL_NODISCARD__ __WSTL_CONSTEXPR__ ConstIterator End() const __WSTL_NOEXCEPT__ {
+            return m_Entries + N;
+        }
+
+        /// @brief Gets the number of elements
+        __WSTL_NODISCARD__ __WSTL_CONSTEXPR__ SizeType Size() const __WSTL_NOEXCEPT__ {
+            return N;
+        }
+
+        /// @brief Checks whether the map is empty, which it never is
+        __WSTL_NODISCARD__ __WSTL_CONSTEXPR__ bool Empty() const __WSTL_NOEXCEPT__ {
+            return false;
+        }
+
+    private:
+        ValueType m_Entries[N];
+        uint32_t m_Displacements[BucketCount];
+
+        static __WSTL_CONSTEXPR14__ uint64_t Hash(const Key& key) {
+            return __private::__PerfectHashMix(uint64_t(__private::__PerfectHashKey<Hasher>(key, IsIntegral<Key>())));
+        }
+
+        static __WSTL_CONSTEXPR14__ SizeType Bucket(uint64_t hash) {
+            return SizeType(((hash & 0xFFFFFFFFULL) * BucketCount) >> 32);
+        }
+
+        static __WSTL_CONSTEXPR14__ SizeType Slot(uint64_t hash, uint32_t displacement) {
+            return SizeType(((__private::__PerfectHashMix(hash ^ (displacement * 0x9E3779B97F4A7C15ULL)) >> 32) * N) >> 32);
+        }
+    };
+
+    template<typename Key, typename T, size_t N, typename Hasher, typename KeyEqual>
+    const __WSTL_CONSTEXPR__ typename PerfectHashMap<Key, T, N, Hasher, KeyEqual>::SizeType PerfectHashMap<Key, T, N, Hasher, KeyEqual>::BucketLoad;
+
+    template<typename Key, typename T, size_t N, typename Hasher, typename KeyEqual>
+    const __WSTL_CONSTEXPR__ typename PerfectHashMap<Key, T, N, Hasher, KeyEqual>::SizeType PerfectHashMap<Key, T, N, Hasher, KeyEqual>::BucketCount;
+
+    /// @brief Builds a perfect hash map, deducing the number of keys
+    /// @param entries Keys and their mapped values, the keys must be distinct
+    /// @ingroup perfect_hash_map
+    template<typename Key, typename T, typename Hasher = hash::FNV1a_64, size_t N>
+    __WSTL_CONSTEXPR14__ PerfectHashMap<Key, T, N, Hasher> MakePerfectHashMap(const Pair<Key, T> (&entries)[N]) {
+        return PerfectHashMap<Key, T, N, Hasher>(entries);
+    }
+}
+
+#endif
@@ -8,13 +8,16 @@
 
 #include "private/Platform.hpp"
 #include "Container.hpp"
+#include "Atomic.hpp"
 #include "PlacementNew.hpp"
 #include "StandardExceptions.hpp"
+#include "Expected.hpp"
 #include "NullPointer.hpp"
 #include "BoundedIterator.hpp"
 #include "private/Error.hpp"
 #include "private/Swap.hpp"
 #include "Bitset.hpp"
+#include "HierarchicalBitset.hpp"
 #include <stddef.h>
 
 
@@ -161,6 +164,7 @@ namespace wstl {
         /// @brief Allocates new object from the pool
         /// @return Pointer to the object
         PointerType Allocate() {
+            if(m_Next == NullPointer) this->RecordFailure();
             __WSTL_ASSERT_RETURNVALUE__(m_Next != NullPointer, WSTL_MAKE_EXCEPTION(LengthError, "Intrusive pool is full"), NullPointer);
 
             PointerType result = m_Next;
@@ -223,6 +227,30 @@ namespace wstl {
         }
         #endif
 
+        /// @brief Allocates new object from the pool if there is room, without error handling
+        /// @return Pointer to the object, or `ERROR_CODE_FULL` if the pool is full
+        Expected<PointerType> TryAllocate() {
+            if(m_Next == NullPointer) {
+                this->RecordFailure();
+                return MakeUnexpected(ERROR_CODE_FULL);
+            }
+
+            return Allocate();
+        }
+
+        #ifdef __WSTL_CXX11__
+        /// @brief Allocates and constructs new object in the pool if there is room, without error handling
+        /// @param ...args Arguments to forward to the constructor of the object
+        /// @return Pointer to the object, or `ERROR_CODE_FULL` if the pool is full
+        /// @since C++11
+        template<typename... Args>
+        Expected<PointerType> TryCreate(Args&&... args) {
+            Expected<PointerType> item = TryAllocate();
+            if(item.HasValue()) ::new(*item) ValueType(Forward<Args>(args)...);
+            return item;
+        }
+        #endif
+
         /// @brief Releases object back to the pool
         /// @param value Pointer to the object
         void Release(ConstPointerType const value) {
@@ -393,13 +421,461 @@ namespace wstl {
         #endif
     }
 
+    // Basic concurrent intrusive pool
+
+    namespace __private {
+        /// @brief Number of low bits of the free list head that hold the index, the rest hold the tag
+        static const __WSTL_CONSTEXPR__ size_t __CONCURRENT_POOL_INDEX_BITS = sizeof(size_t) * 4;
+
+        /// @brief Index that marks the end of the free list
+        static const __WSTL_CONSTEXPR__ size_t __CONCURRENT_POOL_NULL_INDEX = (size_t(1) << __CONCURRENT_POOL_INDEX_BITS) - 1;
+    }
+
+    /// @brief Intrusive pool that can be used from several threads and interrupts without a lock
+    /// @tparam Storage Storage type for the pool
+    /// @details The free list is a Treiber stack threaded through the free objects by index.
+    /// Its head packs the index of the first free object with a tag that changes on every
+    /// operation, so a compare-exchange fails when the head was popped and pushed back in
+    /// between (the ABA problem). The index takes half of `size_t`, which limits the capacity
+    /// to 65534 objects on 32-bit targets. `Allocate`, `Create`, `Release`, `Destroy`, `Size`
+    /// and `Contains` are thread-safe. Iteration and `Clear` require that no other thread uses the pool
+    /// @ingroup pool
+    template<typename Storage>
+    class BasicConcurrentIntrusivePool {
+    public:
+        WSTL_STATIC_ASSERT(!IsVoid<Storage>::Value, "Storage must be non-void");
+
+        typedef typename Storage::ValueType ValueType;
+        typedef typename Storage::SizeType SizeType;
+        typedef ptrdiff_t DifferenceType;
+        typedef ValueType& ReferenceType;
+        typedef const ValueType& ConstReferenceType;
+        typedef ValueType* PointerType;
+        typedef const ValueType* ConstPointerType;
+
+        typedef Storage StorageType;
+
+        WSTL_STATIC_ASSERT(sizeof(ValueType) >= sizeof(Atomic<SizeType>), "Type is too small to be used with concurrent intrusive pool");
+        WSTL_STATIC_ASSERT(AlignmentOf<ValueType>::Value >= AlignmentOf<Atomic<SizeType> >::Value, "Type is not aligned enough to be used with concurrent intrusive pool");
+
+    private:
+        template<bool IsConst>
+        class ConcurrentIntrusivePoolIterator {
+        public:
+            typedef typename Conditional<IsConst, const BasicConcurrentIntrusivePool::ValueType, BasicConcurrentIntrusivePool::ValueType>::Type ValueType;
+            typedef ForwardIteratorTag IteratorCategory;
+            typedef typename Conditional<IsConst, BasicConcurrentIntrusivePool::ConstReferenceType, BasicConcurrentIntrusivePool::ReferenceType>::Type ReferenceType;
+            typedef typename Conditional<IsConst, BasicConcurrentIntrusivePool::ConstPointerType, BasicConcurrentIntrusivePool::PointerType>::Type PointerType;
+            typedef ptrdiff_t DifferenceType;
+
+            friend class BasicConcurrentIntrusivePool;
+
+            ReferenceType operator*() const {
+                return *m_Current;
+            }
+
+            PointerType operator->() const {
+                return m_Current;
+            }
+
+            ConcurrentIntrusivePoolIterator& operator++() {
+                ++m_Current;
+                FindAllocated();
+                return *this;
+            }
+
+            ConcurrentIntrusivePoolIterator operator++(int) {
+                ConcurrentIntrusivePoolIterator original(*this);
+                ++(*this);
+                return original;
+            }
+
+            friend bool operator==(const ConcurrentIntrusivePoolIterator& a, const ConcurrentIntrusivePoolIterator& b) {
+                return a.m_Current == b.m_Current;
+            }
+
+            friend bool operator!=(const ConcurrentIntrusivePoolIterator& a, const ConcurrentIntrusivePoolIterator& b) {
+                return !(a == b);
+            }
+
+        private:
+            typedef typename Conditional<IsConst, const BasicConcurrentIntrusivePool*, BasicConcurrentIntrusivePool*>::Type PoolType;
+
+            PointerType m_Current;
+            PoolType m_Pool;
+
+            ConcurrentIntrusivePoolIterator(PoolType pool, PointerType start) : m_Current(start), m_Pool(pool) {
+                FindAllocated();
+            }
+
+            void FindAllocated() {
+                while(m_Current < m_Pool->m_Storage.Data + m_Pool->Capacity() && m_Pool->IsFree(m_Current)) ++m_Current;
+            }
+        };
+
+    public:
+        typedef ConcurrentIntrusivePoolIterator<false> Iterator;
+        typedef ConcurrentIntrusivePoolIterator<true> ConstIterator;
+
+        /// @brief Default constructor
+        BasicConcurrentIntrusivePool() : m_Storage(), m_Head(0), m_Size(0) {
+            Initialize();
+        }
+
+        /// @brief Constructor with storage, only for non-default-constructible storage
+        /// @param storage Storage to use for the pool
+        explicit BasicConcurrentIntrusivePool(const Storage& storage) : m_Storage(storage), m_Head(0), m_Size(0) {
+            Initialize();
+        }
+
+        /// @brief Destructor
+        ~BasicConcurrentIntrusivePool() {
+            DestroyAll(IsTriviallyDestructible<ValueType>());
+        }
+
+        /// @brief Gets the number of allocated objects
+        /// @details The value is only a snapshot while other threads use the pool
+        SizeType Size() const __WSTL_NOEXCEPT__ {
+            return m_Size.Load(MEMORY_ORDER_RELAXED);
+        }
+
+        /// @brief Gets the capacity of the pool
+        __WSTL_CONSTEXPR__ SizeType Capacity() const __WSTL_NOEXCEPT__ {
+            return m_Storage.Capacity;
+        }
+
+        /// @brief Gets the maximum size of the pool
+        __WSTL_CONSTEXPR__ SizeType MaxSize() const __WSTL_NOEXCEPT__ {
+            return m_Storage.Capacity;
+        }
+
+        /// @brief Checks if no objects are allocated
+        bool Empty() const __WSTL_NOEXCEPT__ {
+            return Size() == 0;
+        }
+
+        /// @brief Checks if all objects are allocated
+        bool Full() const __WSTL_NOEXCEPT__ {
+            return Size() == Capacity();
+        }
+
+        /// @brief Gets the number of objects that can still be allocated
+        SizeType Available() const __WSTL_NOEXCEPT__ {
+            return Capacity() - Size();
+        }
+
+        /// @brief Gets iterator to the beginning of the pool that iterates only allocated objects
+        Iterator Begin() {
+            return Iterator(this, m_Storage.Data);
+        }
+
+        /// @brief Gets const iterator to the beginning of the pool that iterates only allocated objects
+        ConstIterator Begin() const {
+            return ConstIterator(this, m_Storage.Data);
+        }
+
+        /// @brief Gets const iterator to the beginning of the pool that iterates only allocated objects
+        ConstIterator ConstBegin() const {
+            return ConstIterator(this, m_Storage.Data);
+        }
+
+        /// @brief Gets iterator to the end of the pool
+        Iterator End() {
+            return Iterator(this, m_Storage.Data + Capacity());
+        }
+
+        /// @brief Gets const iterator to the end of the pool
+        ConstIterator End() const {
+            return ConstIterator(this, m_Storage.Data + Capacity());
+        }
+
+        /// @brief Gets const iterator to the end of the pool
+        ConstIterator ConstEnd() const {
+            return ConstIterator(this, m_Storage.Data + Capacity());
+        }
+
+        /// @brief Allocates new object from the pool
+        /// @return Pointer to the object
+        PointerType Allocate() {
+            SizeType head = m_Head.Load(MEMORY_ORDER_ACQUIRE);
+            SizeType index;
+
+            do {
+                index = Index(head);
+                __WSTL_ASSERT_RETURNVALUE__(index != __private::__CONCURRENT_POOL_NULL_INDEX,
+                    WSTL_MAKE_EXCEPTION(LengthError, "Concurrent intrusive pool is full"), NullPointer);
+
+                // The object may be taken meanwhile, then the link is stale and the exchange fails on the tag
+            } while(!m_Head.CompareExchangeWeak(head, Pack(Link(index).Load(MEMORY_ORDER_RELAXED), head),
+                MEMORY_ORDER_ACQUIRE, MEMORY_ORDER_ACQUIRE));
+
+            m_Size.FetchAdd(1, MEMORY_ORDER_RELAXED);
+            return m_Storage.Data + index;
+        }
+
+        #ifdef __WSTL_CXX11__
+        /// @brief Allocates and constructs new object in the pool with given arguments
+        /// @param ...args Arguments to forward to the constructor of the object
+        /// @return Pointer to the object
+        template<typename... Args>
+        PointerType Create(Args&&... args) {
+            PointerType item = Allocate();
+            if(item) ::new(item) ValueType(Forward<Args>(args)...);
+            return item;
+        }
+        #else
+        /// @brief Allocates and constructs new object in the pool
+        /// @return Pointer to the object
+        PointerType Create() {
+            PointerType item = Allocate();
+            if(item) ::new(item) ValueType();
+            return item;
+        }
+
+        /// @brief Allocates and constructs new object in the pool
+        /// @param arg Argument to forward to the constructor of the object
+        /// @return Pointer to the object
+        template<typename Arg>
+        PointerType Create(const Arg& arg) {
+            PointerType item = Allocate();
+            if(item) ::new(item) ValueType(arg);
+            return item;
+        }
+
+        /// @brief Allocates and constructs new object in the pool with two arguments
+        /// @param arg1 First argument to forward to the constructor of the object
+        /// @param arg2 Second argument to forward to the constructor of the object
+        /// @return Pointer to the object
+        template<typename Arg1, typename Arg2>
+        PointerType Create(const Arg1& arg1, const Arg2& arg2) {
+            PointerType item = Allocate();
+            if(item) ::new(item) ValueType(arg1, arg2);
+            return item;
+        }
+
+        /// @brief Allocates and constructs new object in the pool with three arguments
+        /// @param arg1 First argument to forward to the constructor of the object
+        /// @param arg2 Second argument to forward to the constructor of the object
+        /// @param arg3 Third argument to forward to the constructor of the object
+        /// @return Pointer to the object
+        template<typename Arg1, typename Arg2, typename Arg3>
+        PointerType Create(const Arg1& arg1, const Arg2& arg2, const Arg3& arg3) {
+            PointerType item = Allocate();
+            if(item) ::new(item) ValueType(arg1, arg2, arg3);
+            return item;
+        }
+        #endif
+
+        /// @brief Releases object back to the pool
+        /// @param value Pointer to the object
+        void Release(ConstPointerType const value) {
+            __WSTL_ASSERT_RETURN__(Contains(value), WSTL_MAKE_EXCEPTION(OutOfRange, "Pointer not in the concurrent intrusive pool range"));
+
+            const SizeType index = static_cast<SizeType>(value - m_Storage.Data);
+            SizeType head = m_Head.Load(MEMORY_ORDER_RELAXED);
+
+            do Link(index).Store(Index(head), MEMORY_ORDER_RELAXED);
+            while(!m_Head.CompareExchangeWeak(head, Pack(index, head), MEMORY_ORDER_RELEASE, MEMORY_ORDER_RELAXED));
+
+            m_Size.FetchSub(1, MEMORY_ORDER_RELAXED);
+        }
+
+        /// @brief Destroys object and releases it back to the pool
+        /// @param value Pointer to the object
+        void Destroy(ConstPointerType const value) {
+            value->~ValueType();
+            Release(value);
+        }
+
+        /// @brief Reinitializes the pool, destroying all objects
+        /// @details Not thread-safe
+        void Clear() {
+            DestroyAll(IsTriviallyDestructible<ValueType>());
+            Initialize();
+        }
+
+        /// @brief Checks whether the pool contains the given pointer inside
+        bool Contains(ConstPointerType const value) const {
+            return value >= m_Storage.Data && value < m_Storage.Data + Capacity();
+        }
+
+    private:
+        Storage m_Storage;
+        Atomic<SizeType> m_Head;
+        Atomic<SizeType> m_Size;
+
+        /// @brief Deleted copy constructor
+        BasicConcurrentIntrusivePool(const BasicConcurrentIntrusivePool&) __WSTL_DELETE__;
+
+        /// @brief Deleted copy assignment operator
+        BasicConcurrentIntrusivePool& operator=(const BasicConcurrentIntrusivePool&) __WSTL_DELETE__;
+
+        static SizeType Index(SizeType head) {
+            return head & __private::__CONCURRENT_POOL_NULL_INDEX;
+        }
+
+        /// @brief Makes a new head from an index and the tag of the old head, incrementing the tag
+        static SizeType Pack(SizeType index, SizeType head) {
+            return (head & ~SizeType(__private::__CONCURRENT_POOL_NULL_INDEX)) + (SizeType(1) << __private::__CONCURRENT_POOL_INDEX_BITS) + index;
+        }
+
+        /// @brief Gets the link to the next free object, stored in place of a free object
+        Atomic<SizeType>& Link(SizeType index) const {
+            return *reinterpret_cast<Atomic<SizeType>*>(const_cast<PointerType>(m_Storage.Data + index));
+        }
+
+        void Initialize() {
+            __WSTL_ASSERT_RETURN__(Capacity() != 0 && Capacity() < __private::__CONCURRENT_POOL_NULL_INDEX,
+                WSTL_MAKE_EXCEPTION(LengthError, "Concurrent intrusive pool capacity is out of range"));
+
+            for(SizeType i = 0; i < Capacity(); ++i) ::new(m_Storage.Data + i) Atomic<SizeType>(i + 1 < Capacity() ? i + 1 : __private::__CONCURRENT_POOL_NULL_INDEX);
+
+            m_Size.Store(0, MEMORY_ORDER_RELAXED);
+            m_Head.Store(Pack(0, m_Head.Load(MEMORY_ORDER_RELAXED)), MEMORY_ORDER_RELEASE);
+        }
+
+        void DestroyAll(TrueType) {}
+
+        void DestroyAll(FalseType) {
+            for(Iterator it = Begin(); it != End(); ++it) it->~ValueType();
+        }
+
+        /// @brief Checks whether the given pointer is in the free list
+        bool IsFree(ConstPointerType value) const {
+            SizeType index = Index(m_Head.Load(MEMORY_ORDER_ACQUIRE));
+
+            while(index != __private::__CONCURRENT_POOL_NULL_INDEX) {
+                if(m_Storage.Data + index == value) return true;
+                index = Link(index).Load(MEMORY_ORDER_RELAXED);
+            }
+
+            return false;
+        }
+    };
+
+    // Fixed-size concurrent intrusive pool
+
+    /// @brief Fixed-size intrusive pool that can be used from several threads and interrupts without a lock
+    /// @tparam T Object type to store
+    /// @tparam N Maximum number of objects in the pool
+    /// @ingroup pool
+    template<typename T, size_t N>
+    class ConcurrentIntrusivePool : public BasicConcurrentIntrusivePool<FixedStorage<T, N> > {
+    private:
+        typedef BasicConcurrentIntrusivePool<FixedStorage<T, N> > Base;
+
+    public:
+        WSTL_STATIC_ASSERT(N != 0 && N < __private::__CONCURRENT_POOL_NULL_INDEX, "Concurrent intrusive pool capacity is out of range");
+
+        typedef typename Base::ValueType ValueType;
+        typedef typename Base::SizeType SizeType;
+        typedef typename Base::DifferenceType DifferenceType;
+        typedef typename Base::ReferenceType ReferenceType;
+        typedef typename Base::ConstReferenceType ConstReferenceType;
+        typedef typename Base::PointerType PointerType;
+        typedef typename Base::ConstPointerType ConstPointerType;
+
+        typedef typename Base::StorageType StorageType;
+
+        /// @brief The static size, needed for metaprogramming
+        static const __WSTL_CONSTEXPR__ SizeType StaticSize = N;
+
+        /// @brief Default constructor
+        ConcurrentIntrusivePool() : Base() {}
+    };
+
+    template<typename T, size_t N>
+    const __WSTL_CONSTEXPR__ typename ConcurrentIntrusivePool<T, N>::SizeType ConcurrentIntrusivePool<T, N>::StaticSize;
+
+    // External concurrent intrusive pool
+
+    namespace external {
+        /// @brief Version of concurrent intrusive pool that uses external storage
+        /// @tparam T Type of the elements
+        /// @ingroup pool
+        template<typename T>
+        class ConcurrentIntrusivePool : public BasicConcurrentIntrusivePool<ExternalStorage<T> > {
+        private:
+            typedef BasicConcurrentIntrusivePool<ExternalStorage<T> > Base;
+
+        public:
+            typedef typename Base::ValueType ValueType;
+            typedef typename Base::SizeType SizeType;
+            typedef typename Base::DifferenceType DifferenceType;
+            typedef typename Base::ReferenceType ReferenceType;
+            typedef typename Base::ConstReferenceType ConstReferenceType;
+            typedef typename Base::PointerType PointerType;
+            typedef typename Base::ConstPointerType ConstPointerType;
+
+            typedef typename Base::StorageType StorageType;
+
+            /// @brief Constructor
+            /// @param buffer Pointer to the external buffer
+            /// @param capacity The capacity of the external buffer
+            ConcurrentIntrusivePool(T* buffer, SizeType capacity) : Base(StorageType(buffer, capacity)) {}
+        };
+
+        /// @brief Version of concurrent intrusive pool that uses fixed external storage with compile-time known capacity
+        /// @tparam T Type of the elements
+        /// @tparam N Capacity of the pool
+        /// @ingroup pool
+        template<typename T, size_t N>
+        class FixedConcurrentIntrusivePool : public BasicConcurrentIntrusivePool<FixedExternalStorage<T, N> > {
+        private:
+            typedef BasicConcurrentIntrusivePool<FixedExternalStorage<T, N> > Base;
+
+        public:
+            WSTL_STATIC_ASSERT(N != 0 && N < __private::__CONCURRENT_POOL_NULL_INDEX, "Concurrent intrusive pool capacity is out of range");
+
+            typedef typename Base::ValueType ValueType;
+            typedef typename Base::SizeType SizeType;
+            typedef typename Base::DifferenceType DifferenceType;
+            typedef typename Base::ReferenceType ReferenceType;
+            typedef typename Base::ConstReferenceType ConstReferenceType;
+            typedef typename Base::PointerType PointerType;
+            typedef typename Base::ConstPointerType ConstPointerType;
+
+            typedef typename Base::StorageType StorageType;
+
+            /// @brief The static size, needed for metaprogramming
+            static const __WSTL_CONSTEXPR__ SizeType StaticSize = N;
+
+            /// @brief Constructor
+            /// @param buffer Pointer to the external buffer
+            explicit FixedConcurrentIntrusivePool(T* buffer) : Base(StorageType(buffer)) {}
+        };
+
+        template<typename T, size_t N>
+        const __WSTL_CONSTEXPR__ typename FixedConcurrentIntrusivePool<T, N>::SizeType FixedConcurrentIntrusivePool<T, N>::StaticSize;
+
+        // Template deduction guide
+
+        #ifdef __WSTL_CXX17__
+        template<typename T, size_t N>
+        FixedConcurrentIntrusivePool(T(&)[N]) -> FixedConcurrentIntrusivePool<T, N>;
+        #endif
+    }
+
     // Indexed pool
 
+    namespace __private {
+        /// @brief Capacity above which indexed pools track occupancy with `HierarchicalBitset` by default
+        static const __WSTL_CONSTEXPR__ size_t __INDEXED_POOL_HIERARCHY_THRESHOLD = 1024;
+
+        template<size_t N>
+        struct __IndexedPoolIndices {
+            typedef typename Conditional<(N > __INDEXED_POOL_HIERARCHY_THRESHOLD), HierarchicalBitset<N>, Bitset<N, __BitsetWord> >::Type Type;
+        };
+    }
+
     /// @brief Indexed pool that stores objects and free list using bitset
     /// @tparam T Object type to store
     /// @tparam N Maximum number of objects in the pool
+    /// @tparam Indices Bitset type that tracks allocated objects, `Bitset` or `HierarchicalBitset`.
+    /// Large pools default to `HierarchicalBitset`, so allocation and iteration cost a few word
+    /// operations whatever the fill level. Small pools default to the more compact `Bitset`
     /// @ingroup pool
-    template<typename T, size_t N>
+    template<typename T, size_t N, typename Indices = typename __private::__IndexedPoolIndices<N>::Type>
     class IndexedPool : public TypedContainerBase<FixedStorage<T, N>> {
     private:
         typedef TypedContainerBase<FixedStorage<T, N>> Base; 
@@ -517,10 +993,13 @@ namespace wstl {
         /// @brief Allocates new object from the pool
         /// @return Pointer to the object
         PointerType Allocate() {
+            if(this->Full()) this->RecordFailure();
             __WSTL_ASSERT_RETURNVALUE__(!this->Full(), WSTL_MAKE_EXCEPTION(LengthError, "Indexed pool is full"), NullPointer);
 
-            PointerType result = (this->m_Storage.Data + this->m_CurrentSize);
-            m_Indices.Set(this->m_CurrentSize);
+            // Released objects leave holes, so the first free slot is not always at the size
+            const SizeType index = m_Indices.template FindFirst<false>();
+            PointerType result = (this->m_Storage.Data + index);
+            m_Indices.Set(index);
             ++this->m_CurrentSize;
 
             return result;
@@ -579,6 +1058,30 @@ namespace wstl {
         }
         #endif
 
+        /// @brief Allocates new object from the pool if there is room, without error handling
+        /// @return Pointer to the object, or `ERROR_CODE_FULL` if the pool is full
+        Expected<PointerType> TryAllocate() {
+            if(this->Full()) {
+                this->RecordFailure();
+                return MakeUnexpected(ERROR_CODE_FULL);
+            }
+
+            return Allocate();
+        }
+
+        #ifdef __WSTL_CXX11__
+        /// @brief Allocates and constructs new object in the pool if there is room, without error handling
+        /// @param ...args Arguments to forward to the constructor of the object
+        /// @return Pointer to the object, or `ERROR_CODE_FULL` if the pool is full
+        /// @since C++11
+        template<typename... Args>
+        Expected<PointerType> TryCreate(Args&&... args) {
+            Expected<PointerType> item = TryAllocate();
+            if(item.HasValue()) ::new(*item) ValueType(Forward<Args>(args)...);
+            return item;
+        }
+        #endif
+
         /// @brief Releases object back to the pool
         /// @param value Pointer to the object
         void Release(ConstPointerType const value) {
@@ -607,7 +1110,7 @@ namespace wstl {
         }
 
     private:
-        Bitset<N> m_Indices;
+        Indices m_Indices;
 
         /// @brief Initializes the pool: does not call destructors
         template<typename U>
@@ -625,8 +1128,8 @@ namespace wstl {
         }
     };
 
-    template<typename T, size_t N>
-    const __WSTL_CONSTEXPR__ typename IndexedPool<T, N>::SizeType IndexedPool<T, N>::StaticSize;
+    template<typename T, size_t N, typename Indices>
+    const __WSTL_CONSTEXPR__ typename IndexedPool<T, N, Indices>::SizeType IndexedPool<T, N, Indices>::StaticSize;
 }
 
 #endif
\ No newline at end of file
@@ -0,0 +1,81 @@
+// Part of WardenSTL - https://github.com/WardenHD/WardenSTL
+// Copyright (c) 2025 Artem Bezruchko (WardenHD)
+//
+// Licensed under the MIT License. See LICENSE file for details.
+
+#ifndef __WSTL_POOLALLOCATOR_HPP__
+#define __WSTL_POOLALLOCATOR_HPP__
+
+#include "Allocator.hpp"
+#include "Pool.hpp"
+#include "TypeTraits.hpp"
+#include "NullPointer.hpp"
+#include "private/Error.hpp"
+#include <stddef.h>
+
+
+namespace wstl {
+    // Pool allocator
+
+    /// @brief Allocator that serves blocks of one size from an `IntrusivePool`
+    /// @tparam BlockSize Size of a block, requests up to this size are served
+    /// @tparam N Number of blocks
+    /// @details `Allocate` and `Free` take constant time. A request larger than `BlockSize`
+    /// or made when all blocks are in use fails and returns a null pointer. Useful where
+    /// an `Allocator` is needed for objects of similar size, such as coroutine frames
+    /// @ingroup allocator
+    template<size_t BlockSize, size_t N>
+    class PoolAllocator : public Allocator {
+    private:
+        typedef typename AlignedStorage<BlockSize < sizeof(void*) ? sizeof(void*) : BlockSize, DefaultAlignment>::Type Block;
+
+    public:
+        /// @brief Default constructor
+        PoolAllocator() : m_Pool() {}
+
+        /// @copydoc Allocator::Allocate(size_t)
+        virtual void* Allocate(size_t size) __WSTL_OVERRIDE__ {
+            void* const result = size <= BlockSize && !m_Pool.Full() ? static_cast<void*>(m_Pool.Allocate()) : NullPointer;
+            RecordAllocation(size, result);
+
+            return result;
+        }
+
+        /// @copydoc Allocator::TryAllocate(size_t)
+        virtual Expected<void*> TryAllocate(size_t size) __WSTL_OVERRIDE__ {
+            void* const result = Allocate(size);
+            if(result == NullPointer) return MakeUnexpected(size > BlockSize ? ERROR_CODE_TOO_LARGE : ERROR_CODE_OUT_OF_MEMORY);
+
+            return result;
+        }
+
+        /// @copydoc Allocator::Free(void*)
+        /// @details Null pointers are ignored
+        virtual void Free(void* address) __WSTL_OVERRIDE__ {
+            if(address == NullPointer) return;
+
+            m_Pool.Release(static_cast<Block*>(address));
+            RecordFree(address);
+        }
+
+        /// @brief Gets the size of a block
+        __WSTL_CONSTEXPR__ size_t MaximumSize() const __WSTL_NOEXCEPT__ {
+            return BlockSize;
+        }
+
+        /// @brief Gets the number of blocks in use
+        size_t Used() const __WSTL_NOEXCEPT__ {
+            return m_Pool.Size();
+        }
+
+        /// @brief Gets the number of blocks
+        __WSTL_CONSTEXPR__ size_t Capacity() const __WSTL_NOEXCEPT__ {
+            return N;
+        }
+
+    private:
+        IntrusivePool<Block, N> m_Pool;
+    };
+}
+
+#endif
@@ -0,0 +1,661 @@
+// Part of WardenSTL - https://github.com/WardenHD/WardenSTL
+// Copyright (c) 2025 Artem Bezruchko (WardenHD)
+//
+// Licensed under the MIT License. See LICENSE file for details.
+
+#ifndef __WSTL_PRIORITYQUEUE_HPP__
+#define __WSTL_PRIORITYQUEUE_HPP__
+
+#include "private/Platform.hpp"
+#include "private/Error.hpp"
+#include "Vector.hpp"
+#include "Functional.hpp"
+#include "Utility.hpp"
+#include "StaticAssert.hpp"
+#include "StandardExceptions.hpp"
+#include <stddef.h>
+
+
+/// @defgroup priority_queue Priority queue
+/// @ingroup containers
+/// @brief A queue that always gives access to its greatest element, kept as a d-ary heap
+
+namespace wstl {
+    namespace __private {
+        /// @brief Moves a value up from a hole in a d-ary heap until its parent is not less than it
+        template<size_t Arity, typename RandomAccessIterator, typename SizeType, typename T, typename Compare>
+        void __DaryHeapSiftUp(RandomAccessIterator first, SizeType hole, T& value, Compare& compare) {
+            while(hole > 0) {
+                const SizeType parent = (hole - 1) / Arity;
+                if(!compare(first[parent], value)) break;
+
+                first[hole] = __WSTL_MOVE__(first[parent]);
+                hole = parent;
+            }
+
+            first[hole] = __WSTL_MOVE__(value);
+        }
+
+        /// @brief Moves a value down from a hole in a d-ary heap until no child is greater than it
+        template<size_t Arity, typename RandomAccessIterator, typename SizeType, typename T, typename Compare>
+        void __DaryHeapSiftDown(RandomAccessIterator first, SizeType size, SizeType hole, T& value, Compare& compare) {
+            for(;;) {
+                const SizeType child = hole * Arity + 1;
+                if(child >= size) break;
+
+                const SizeType last = size - child > Arity ? child + Arity : size;
+                SizeType greatest = child;
+
+                for(SizeType i = child + 1; i < last; ++i) if(compare(first[greatest], first[i])) greatest = i;
+                if(!compare(value, first[greatest])) break;
+
+                first[hole] = __WSTL_MOVE__(first[greatest]);
+                hole = greatest;
+            }
+
+            first[hole] = __WSTL_MOVE__(value);
+        }
+
+        /// @brief Arranges a range into a d-ary heap, sifting down from the last parent
+        template<size_t Arity, typename RandomAccessIterator, typename SizeType, typename Compare>
+        void __MakeDaryHeap(RandomAccessIterator first, SizeType size, Compare& compare) {
+            if(size < 2) return;
+
+            for(SizeType parent = (size - 2) / Arity + 1; parent-- > 0;) {
+                typename IteratorTraits<RandomAccessIterator>::ValueType value(__WSTL_MOVE__(first[parent]));
+                __DaryHeapSiftDown<Arity>(first, size, parent, value, compare);
+            }
+        }
+    }
+
+    // Priority queue adaptor
+
+    /// @brief Priority queue adaptor that keeps a d-ary heap in a specified container
+    /// @details Container is expected to support the following methods with usual semantics:
+    /// - `operator[]`
+    /// - `Back()`
+    /// - `PushBack()`
+    /// - `PopBack()`
+    /// - `Full()`
+    ///
+    /// Every node has `Arity` children, so the tree is `log2(Arity)` times shallower than a binary heap.
+    /// Pushing does fewer comparisons the higher the arity, popping compares all children of each node
+    /// on the way down, which stay in one cache line for small elements. The default of 2 is the classic
+    /// binary heap of `PushHeap` and `PopHeap`, which measured faster for push/pop of small elements;
+    /// a higher arity can pay off for push-heavy workloads or expensive comparisons
+    /// @tparam Container The container type to use
+    /// @tparam Compare Ordering of the elements, `Top()` is an element that no other is greater than
+    /// @tparam Arity Number of children of a node, at least 2
+    /// @ingroup priority_queue
+    /// @see https://en.cppreference.com/w/cpp/container/priority_queue
+    template<typename Container, typename Compare = Less<typename Container::ValueType>, size_t Arity = 2>
+    class PriorityQueueAdaptor {
+    public:
+        WSTL_STATIC_ASSERT(Arity >= 2, "Heap arity must be at least 2");
+
+        typedef Container ContainerType;
+        typedef Compare CompareType;
+        typedef typename Container::ValueType ValueType;
+        typedef typename Container::SizeType SizeType;
+        typedef typename Container::ReferenceType ReferenceType;
+        typedef typename Container::ConstReferenceType ConstReferenceType;
+
+        /// @brief Number of children of a node
+        static const __WSTL_CONSTEXPR__ size_t HeapArity = Arity;
+
+        /// @brief Default constructor
+        PriorityQueueAdaptor() : m_Container(), m_Compare() {}
+
+        /// @brief Constructor with a custom ordering
+        /// @param compare The ordering of the elements
+        explicit PriorityQueueAdaptor(const Compare& compare) : m_Container(), m_Compare(compare) {}
+
+        /// @brief Constructor that arranges the elements of a given container into a heap
+        /// @param compare The ordering of the elements
+        /// @param container The container to initialize the queue with
+        PriorityQueueAdaptor(const Compare& compare, const Container& container) : m_Container(container), m_Compare(compare) {
+            __private::__MakeDaryHeap<Arity>(&m_Container[0], m_Container.Size(), m_Compare);
+        }
+
+        /// @brief Copy constructor
+        /// @param other The queue to copy from
+        PriorityQueueAdaptor(const PriorityQueueAdaptor& other) : m_Container(other.m_Container), m_Compare(other.m_Compare) {}
+
+        #ifdef __WSTL_CXX11__
+        /// @brief Constructor that arranges the elements of a given container into a heap
+        /// @param compare The ordering of the elements
+        /// @param container The container to initialize the queue with (rvalue reference)
+        /// @since C++11
+        PriorityQueueAdaptor(const Compare& compare, Container&& container) : m_Container(Move(container)), m_Compare(compare) {
+            __private::__MakeDaryHeap<Arity>(&m_Container[0], m_Container.Size(), m_Compare);
+        }
+
+        /// @brief Move constructor
+        /// @param other The queue to move from
+        /// @since C++11
+        PriorityQueueAdaptor(PriorityQueueAdaptor&& other) : m_Container(Move(other.m_Container)), m_Compare(Move(other.m_Compare)) {}
+
+        /// @brief Constructor that creates the container in-place with provided arguments
+        /// @param compare The ordering of the elements
+        /// @param ...args Arguments to forward to the constructor of the container
+        /// @since C++11
+        template<typename... Args>
+        PriorityQueueAdaptor(const Compare& compare, InPlaceType, Args&&... args) : m_Container(Forward<Args>(args)...), m_Compare(compare) {}
+        #else
+        /// @brief Constructor that creates the container in-place with provided arguments
+        /// @param compare The ordering of the elements
+        /// @param arg Argument to pass to the constructor of the container
+        template<typename Arg>
+        PriorityQueueAdaptor(const Compare& compare, InPlaceType, const Arg& arg) : m_Container(arg), m_Compare(compare) {}
+
+        /// @brief Constructor that creates the container in-place with provided arguments
+        /// @param compare The ordering of the elements
+        /// @param arg1 First argument to pass to the constructor of the container
+        /// @param arg2 Second argument to pass to the constructor of the container
+        template<typename Arg1, typename Arg2>
+        PriorityQueueAdaptor(const Compare& compare, InPlaceType, const Arg1& arg1, const Arg2& arg2) : m_Container(arg1, arg2), m_Compare(compare) {}
+        #endif
+
+        /// @brief Copy assignment operator
+        /// @param other The queue to copy from
+        PriorityQueueAdaptor& operator=(const PriorityQueueAdaptor& other) {
+            m_Container = other.m_Container;
+            m_Compare = other.m_Compare;
+            return *this;
+        }
+
+        #ifdef __WSTL_CXX11__
+        /// @brief Move assignment operator
+        /// @param other The queue to move from
+        /// @since C++11
+        PriorityQueueAdaptor& operator=(PriorityQueueAdaptor&& other) {
+            m_Container = Move(other.m_Container);
+            m_Compare = Move(other.m_Compare);
+            return *this;
+        }
+        #endif
+
+        /// @brief Returns a const reference to the greatest element, the queue must not be empty
+        ConstReferenceType Top() const {
+            return m_Container[0];
+        }
+
+        /// @brief Checks whether the queue is empty
+        bool Empty() const {
+            return m_Container.Empty();
+        }
+
+        /// @brief Checks whether the queue is full
+        bool Full() const {
+            return m_Container.Full();
+        }
+
+        /// @brief Returns the number of elements in the queue
+        SizeType Size() const {
+            return m_Container.Size();
+        }
+
+        /// @brief Returns the maximum number of elements the queue can hold
+        SizeType Capacity() const {
+            return m_Container.Capacity();
+        }
+
+        /// @brief Inserts an element
+        /// @param value The value to insert
+        /// @throws `LengthError` if the queue is full
+        void Push(ConstReferenceType value) {
+            __WSTL_ASSERT_RETURN__(!Full(), WSTL_MAKE_EXCEPTION(LengthError, "Priority queue full"));
+
+            m_Container.PushBack(value);
+            SiftUpBack();
+        }
+
+        #ifdef __WSTL_CXX11__
+        /// @brief Inserts an element
+        /// @param value The value to insert (rvalue reference)
+        /// @throws `LengthError` if the queue is full
+        /// @since C++11
+        void Push(ValueType&& value) {
+            __WSTL_ASSERT_RETURN__(!Full(), WSTL_MAKE_EXCEPTION(LengthError, "Priority queue full"));
+
+            m_Container.PushBack(Move(value));
+            SiftUpBack();
+        }
+
+        /// @brief Constructs an element in-place and inserts it
+        /// @param ...args Arguments to forward to the constructor of the element
+        /// @throws `LengthError` if the queue is full
+        /// @since C++11
+        template<typename... Args>
+        void Emplace(Args&&... args) {
+            __WSTL_ASSERT_RETURN__(!Full(), WSTL_MAKE_EXCEPTION(LengthError, "Priority queue full"));
+
+            m_Container.EmplaceBack(Forward<Args>(args)...);
+            SiftUpBack();
+        }
+        #endif
+
+        /// @brief Inserts the elements of a range, rebuilding the heap once if that is cheaper
+        /// @param first The beginning of the range
+        /// @param last The end of the range
+        /// @throws `LengthError` if the range does not fit, the elements that fit are inserted
+        template<typename InputIterator>
+        void Push(InputIterator first, InputIterator last) {
+            const SizeType before = Size();
+
+            for(; first != last && !Full(); ++first) m_Container.PushBack(*first);
+
+            // Sifting each new element up costs log n, rebuilding costs n for the whole heap
+            if(Size() - before > before / 4) __private::__MakeDaryHeap<Arity>(&m_Container[0], Size(), m_Compare);
+            else for(SizeType i = before; i < Size(); ++i) {
+                ValueType value(__WSTL_MOVE__(m_Container[i]));
+                __private::__DaryHeapSiftUp<Arity>(&m_Container[0], i, value, m_Compare);
+            }
+
+            // Reported once the heap holds again, so the queue stays usable
+            __WSTL_ASSERT_RETURN__(first == last, WSTL_MAKE_EXCEPTION(LengthError, "Priority queue full"));
+        }
+
+        /// @brief Removes the greatest element, does nothing if the queue is empty
+        void Pop() {
+            if(Empty()) return;
+
+            ValueType value(__WSTL_MOVE__(m_Container.Back()));
+            m_Container.PopBack();
+
+            if(!Empty()) __private::__DaryHeapSiftDown<Arity>(&m_Container[0], Size(), SizeType(0), value, m_Compare);
+        }
+
+        /// @brief Replaces the greatest element with a value, cheaper than `Pop` followed by `Push`
+        /// @param value The value to insert, the queue must not be empty
+        void Replace(ConstReferenceType value) {
+            ValueType copy(value);
+            __private::__DaryHeapSiftDown<Arity>(&m_Container[0], Size(), SizeType(0), copy, m_Compare);
+        }
+
+        /// @brief Removes all elements
+        void Clear() {
+            m_Container.Clear();
+        }
+
+        /// @brief Swaps content of two queues
+        /// @param other The queue to swap with
+        void Swap(PriorityQueueAdaptor& other) {
+            m_Container.Swap(other.m_Container);
+            wstl::Swap(m_Compare, other.m_Compare);
+        }
+
+        /// @brief Gets the underlying container, its elements are in heap order
+        const Container& GetContainer() const {
+            return m_Container;
+        }
+
+    protected:
+        Container m_Container;
+        Compare m_Compare;
+
+    private:
+        void SiftUpBack() {
+            ValueType value(__WSTL_MOVE__(m_Container.Back()));
+            __private::__DaryHeapSiftUp<Arity>(&m_Container[0], Size() - 1, value, m_Compare);
+        }
+    };
+
+    template<typename Container, typename Compare, size_t Arity>
+    const __WSTL_CONSTEXPR__ size_t PriorityQueueAdaptor<Container, Compare, Arity>::HeapArity;
+
+    // Convenience wrappers
+
+    /// @brief Small wrapper for `PriorityQueueAdaptor` that works with a fixed-size container
+    /// @tparam T The type of elements stored in the queue
+    /// @tparam N The maximum number of elements the queue can hold
+    /// @tparam Compare Ordering of the elements, `Less` keeps the greatest on top
+    /// @tparam Arity Number of children of a node, at least 2
+    /// @tparam Container The container type to use (defaults to `Vector<T, N>`)
+    /// @ingroup priority_queue
+    template<typename T, size_t N, typename Compare = Less<T>, size_t Arity = 2, typename Container = Vector<T, N> >
+    class PriorityQueue : public PriorityQueueAdaptor<Container, Compare, Arity> {
+    private:
+        typedef PriorityQueueAdaptor<Container, Compare, Arity> Base;
+
+    public:
+        typedef typename Base::ContainerType ContainerType;
+        typedef typename Base::ValueType ValueType;
+        typedef typename Base::SizeType SizeType;
+        typedef typename Base::ReferenceType ReferenceType;
+        typedef typename Base::ConstReferenceType ConstReferenceType;
+
+        /// @brief The static size, needed for metaprogramming
+        static const __WSTL_CONSTEXPR__ SizeType StaticSize = N;
+
+        /// @brief Default constructor
+        /// @param compare The ordering of the elements
+        explicit PriorityQueue(const Compare& compare = Compare()) : Base(compare) {}
+
+        /// @brief Constructor that arranges the elements of a range into a heap
+        /// @param first The beginning of the range
+        /// @param last The end of the range
+        /// @param compare The ordering of the elements
+        template<typename InputIterator>
+        PriorityQueue(InputIterator first, InputIterator last, const Compare& compare = Compare()) : Base(compare) {
+            this->Push(first, last);
+        }
+
+        /// @brief Copy constructor
+        /// @param other The queue to copy from
+        PriorityQueue(const PriorityQueue& other) : Base(other) {}
+
+        /// @brief Copy assignment operator
+        /// @param other The queue to copy from
+        PriorityQueue& operator=(const PriorityQueue& other) {
+            Base::operator=(other);
+            return *this;
+        }
+    };
+
+    template<typename T, size_t N, typename Compare, size_t Arity, typename Container>
+    const __WSTL_CONSTEXPR__ typename PriorityQueue<T, N, Compare, Arity, Container>::SizeType PriorityQueue<T, N, Compare, Arity, Container>::StaticSize;
+
+    namespace external {
+        /// @brief Small wrapper for `PriorityQueueAdaptor` that works with a container with external storage
+        /// @tparam T The type of elements stored in the queue
+        /// @tparam Compare Ordering of the elements, `Less` keeps the greatest on top
+        /// @tparam Arity Number of children of a node, at least 2
+        /// @tparam Container The type of the underlying container to use (defaults to `Vector<T>`)
+        /// @ingroup priority_queue
+        template<typename T, typename Compare = Less<T>, size_t Arity = 2, typename Container = Vector<T> >
+        class PriorityQueue : public PriorityQueueAdaptor<Container, Compare, Arity> {
+        private:
+            typedef PriorityQueueAdaptor<Container, Compare, Arity> Base;
+
+        public:
+            typedef typename Base::ContainerType ContainerType;
+            typedef typename Base::ValueType ValueType;
+            typedef typename Base::SizeType SizeType;
+            typedef typename Base::ReferenceType ReferenceType;
+            typedef typename Base::ConstReferenceType ConstReferenceType;
+
+            /// @brief Constructor that initializes the queue with an external buffer
+            /// @param buffer Pointer to the external buffer
+            /// @param capacity Capacity of the external buffer
+            /// @param compare The ordering of the elements
+            PriorityQueue(T* buffer, SizeType capacity, const Compare& compare = Compare()) : Base(compare, InPlaceType(), buffer, capacity) {}
+
+            /// @brief Copy constructor
+            /// @param other The queue to copy from
+            PriorityQueue(const PriorityQueue& other) : Base(other) {}
+
+            /// @brief Copy assignment operator
+            /// @param other The queue to copy from
+            PriorityQueue& operator=(const PriorityQueue& other) {
+                Base::operator=(other);
+                return *this;
+            }
+        };
+
+        /// @brief Small wrapper for `PriorityQueueAdaptor` that works with a fixed-size container with external storage
+        /// @tparam T The type of elements stored in the queue
+        /// @tparam N The maximum number of elements the queue can hold
+        /// @tparam Compare Ordering of the elements, `Less` keeps the greatest on top
+        /// @tparam Arity Number of children of a node, at least 2
+        /// @tparam Container The type of the underlying container to use (defaults to `FixedVector<T, N>`)
+        /// @ingroup priority_queue
+        template<typename T, size_t N, typename Compare = Less<T>, size_t Arity = 2, typename Container = FixedVector<T, N> >
+        class FixedPriorityQueue : public PriorityQueueAdaptor<Container, Compare, Arity> {
+        private:
+            typedef PriorityQueueAdaptor<Container, Compare, Arity> Base;
+
+        public:
+            typedef typename Base::ContainerType ContainerType;
+            typedef typename Base::ValueType ValueType;
+            typedef typename Base::SizeType SizeType;
+            typedef typename Base::ReferenceType ReferenceType;
+            typedef typename Base::ConstReferenceType ConstReferenceType;
+
+            /// @brief The static size, needed for metaprogramming
+            static const __WSTL_CONSTEXPR__ SizeType StaticSize = N;
+
+            /// @brief Constructor that initializes the queue with an external buffer
+            /// @param buffer Pointer to the external buffer
+            /// @param compare The ordering of the elements
+            explicit FixedPriorityQueue(T* buffer, const Compare& compare = Compare()) : Base(compare, InPlaceType(), buffer) {}
+
+            /// @brief Copy constructor
+            /// @param other The queue to copy from
+            FixedPriorityQueue(const FixedPriorityQueue& other) : Base(other) {}
+
+            /// @brief Copy assignment operator
+            /// @param other The queue to copy from
+            FixedPriorityQueue& operator=(const FixedPriorityQueue& other) {
+                Base::operator=(other);
+                return *this;
+            }
+        };
+
+        template<typename T, size_t N, typename Compare, size_t Arity, typename Container>
+        const __WSTL_CONSTEXPR__ typename FixedPriorityQueue<T, N, Compare, Arity, Container>::SizeType FixedPriorityQueue<T, N, Compare, Arity, Container>::StaticSize;
+    }
+
+    // Indexed priority queue
+
+    /// @brief Fixed-capacity priority queue whose elements can be changed or removed through handles
+    /// @tparam T The type of elements stored in the queue, must be default-constructible
+    /// @tparam N The maximum number of elements the queue can hold
+    /// @tparam Compare Ordering of the elements, `Less` keeps the greatest on top, `Greater` the smallest
+    /// @tparam Arity Number of children of a node, at least 2
+    /// @details `Push` returns a handle that stays valid until the element is popped or erased, wherever
+    /// the element moves in the heap. `Update`, `DecreaseKey` and `Erase` find the element through the
+    /// handle in O(1) and restore the heap in O(log n), which is what Dijkstra's algorithm and
+    /// earliest-deadline-first schedulers need instead of a linear scan. Handles are indices below `N`,
+    /// so they can also index user arrays of per-element data
+    /// @ingroup priority_queue
+    template<typename T, size_t N, typename Compare = Less<T>, size_t Arity = 2>
+    class IndexedPriorityQueue {
+    public:
+        WSTL_STATIC_ASSERT(Arity >= 2, "Heap arity must be at least 2");
+        WSTL_STATIC_ASSERT(N > 0, "Queue must not be empty");
+
+        typedef T ValueType;
+        typedef size_t SizeType;
+        typedef const T& ConstReferenceType;
+        typedef Compare CompareType;
+
+        /// @brief Handle of an element
+        typedef size_t HandleType;
+
+        /// @brief Handle returned when no element could be inserted
+        static const __WSTL_CONSTEXPR__ HandleType NoHandle = N;
+
+        /// @brief Number of children of a node
+        static const __WSTL_CONSTEXPR__ size_t HeapArity = Arity;
+
+        /// @brief Default constructor
+        /// @param compare The ordering of the elements
+        explicit IndexedPriorityQueue(const Compare& compare = Compare()) : m_Compare(compare) {
+            Clear();
+        }
+
+        /// @brief Returns a const reference to the greatest element, the queue must not be empty
+        ConstReferenceType Top() const {
+            return m_Heap[0].Value;
+        }
+
+        /// @brief Returns the handle of the greatest element, the queue must not be empty
+        HandleType TopHandle() const {
+            return m_Heap[0].Handle;
+        }
+
+        /// @brief Checks whether the queue is empty
+        bool Empty() const {
+            return m_Size == 0;
+        }
+
+        /// @brief Checks whether the queue is full
+        bool Full() const {
+            return m_Size == N;
+        }
+
+        /// @brief Returns the number of elements in the queue
+        SizeType Size() const {
+            return m_Size;
+        }
+
+        /// @brief Returns the maximum number of elements the queue can hold
+        __WSTL_CONSTEXPR__ SizeType Capacity() const {
+            return N;
+        }
+
+        /// @brief Checks whether a handle refers to an element in the queue
+        /// @param handle The handle to check
+        bool Contains(HandleType handle) const {
+            return handle < N && m_Positions[handle] < N;
+        }
+
+        /// @brief Gets the element of a handle
+        /// @param handle Handle of an element in the queue
+        ConstReferenceType operator[](HandleType handle) const {
+            return m_Heap[m_Positions[handle]].Value;
+        }
+
+        /// @brief Inserts an element
+        /// @param value The value to insert
+        /// @return Handle of the element, `NoHandle` if the queue is full
+        /// @throws `LengthError` if the queue is full
+        HandleType Push(ConstReferenceType value) {
+            __WSTL_ASSERT_RETURNVALUE__(!Full(), WSTL_MAKE_EXCEPTION(LengthError, "Indexed priority queue full"), NoHandle);
+
+            const HandleType handle = m_FreeHandle;
+            m_FreeHandle = m_Positions[handle] - N;
+
+            Node node;
+            node.Value = value;
+            node.Handle = handle;
+
+            SiftUp(m_Size++, node);
+            return handle;
+        }
+
+        /// @brief Removes the greatest element, does nothing if the queue is empty
+        void Pop() {
+            if(!Empty()) RemoveAt(0);
+        }
+
+        /// @brief Removes the element of a handle, does nothing if the handle is not in the queue
+        /// @param handle The handle of the element
+        void Erase(HandleType handle) {
+            if(Contains(handle)) RemoveAt(m_Positions[handle]);
+        }
+
+        /// @brief Changes the value of an element, moving it up or down as needed
+        /// @param handle Handle of an element in the queue
+        /// @param value The new value
+        /// @throws `OutOfRange` if the handle is not in the queue
+        void Update(HandleType handle, ConstReferenceType value) {
+            __WSTL_ASSERT_RETURN__(Contains(handle), WSTL_MAKE_EXCEPTION(OutOfRange, "Indexed priority queue handle not in queue"));
+
+            const SizeType position = m_Positions[handle];
+            const bool up = m_Compare(m_Heap[position].Value, value);
+
+            Node node;
+            node.Value = value;
+            node.Handle = handle;
+
+            if(up) SiftUp(position, node);
+            else SiftDown(position, node);
+        }
+
+        /// @brief Changes the value of an element to one that is not ordered before it, which only moves it toward the top
+        /// @details With `Greater` as the ordering, so the smallest element is on top, this lowers the key
+        /// as in Dijkstra's algorithm. It skips the comparison that `Update` needs to pick a direction
+        /// @param handle Handle of an element in the queue
+        /// @param value The new value
+        /// @throws `OutOfRange` if the handle is not in the queue
+        void DecreaseKey(HandleType handle, ConstReferenceType value) {
+            __WSTL_ASSERT_RETURN__(Contains(handle), WSTL_MAKE_EXCEPTION(OutOfRange, "Indexed priority queue handle not in queue"));
+
+            Node node;
+            node.Value = value;
+            node.Handle = handle;
+
+            SiftUp(m_Positions[handle], node);
+        }
+
+        /// @brief Removes all elements and releases all handles
+        void Clear() {
+            m_Size = 0;
+            m_FreeHandle = 0;
+
+            // Free handles are chained through their positions, offset by N so they never look valid
+            for(SizeType i = 0; i < N; ++i) m_Positions[i] = N + i + 1;
+        }
+
+    private:
+        struct Node {
+            T Value;
+            HandleType Handle;
+        };
+
+        Node m_Heap[N];
+        SizeType m_Positions[N];
+        SizeType m_Size;
+        HandleType m_FreeHandle;
+        Compare m_Compare;
+
+        void Place(SizeType position, Node& node) {
+            m_Heap[position] = __WSTL_MOVE__(node);
+            m_Positions[m_Heap[position].Handle] = position;
+        }
+
+        void SiftUp(SizeType hole, Node& node) {
+            while(hole > 0) {
+                const SizeType parent = (hole - 1) / Arity;
+                if(!m_Compare(m_Heap[parent].Value, node.Value)) break;
+
+                Place(hole, m_Heap[parent]);
+                hole = parent;
+            }
+
+            Place(hole, node);
+        }
+
+        void SiftDown(SizeType hole, Node& node) {
+            for(;;) {
+                const SizeType child = hole * Arity + 1;
+                if(child >= m_Size) break;
+
+                const SizeType last = m_Size - child > Arity ? child + Arity : m_Size;
+                SizeType greatest = child;
+
+                for(SizeType i = child + 1; i < last; ++i) if(m_Compare(m_Heap[greatest].Value, m_Heap[i].Value)) greatest = i;
+                if(!m_Compare(node.Value, m_Heap[greatest].Value)) break;
+
+                Place(hole, m_Heap[greatest]);
+                hole = greatest;
+            }
+
+            Place(hole, node);
+        }
+
+        void RemoveAt(SizeType position) {
+            const HandleType handle = m_Heap[position].Handle;
+            m_Positions[handle] = N + m_FreeHandle;
+            m_FreeHandle = handle;
+
+            if(--m_Size == position) return;
+
+            // The last element fills the hole and may need to go either way
+            Node node = __WSTL_MOVE__(m_Heap[m_Size]);
+
+            if(position > 0 && m_Compare(m_Heap[(position - 1) / Arity].Value, node.Value)) SiftUp(position, node);
+            else SiftDown(position, node);
+        }
+    };
+
+    template<typename T, size_t N, typename Compare, size_t Arity>
+    const __WSTL_CONSTEXPR__ typename IndexedPriorityQueue<T, N, Compare, Arity>::HandleType IndexedPriorityQueue<T, N, Compare, Arity>::NoHandle;
+
+    template<typename T, size_t N, typename Compare, size_t Arity>
+    const __WSTL_CONSTEXPR__ size_t IndexedPriorityQueue<T, N, Compare, Arity>::HeapArity;
+}
+
+#endif
@@ -0,0 +1,170 @@
+// Part of WardenSTL - https://github.com/WardenHD/WardenSTL
+// Copyright (c) 2025 Artem Bezruchko (WardenHD)
+//
+// Licensed under the MIT License. See LICENSE file for details.
+
+#ifndef __WSTL_RADIXSORT_HPP__
+#define __WSTL_RADIXSORT_HPP__
+
+#include "private/Platform.hpp"
+#include "private/Error.hpp"
+#include "TypeTraits.hpp"
+#include "Iterator.hpp"
+#include "Functional.hpp"
+#include "Algorithm.hpp"
+#include "Array.hpp"
+#include "Span.hpp"
+#include "StandardExceptions.hpp"
+#include <stddef.h>
+#include <stdint.h>
+
+
+namespace wstl {
+    // Radix sort
+
+    namespace __private {
+        template<size_t Size>
+        struct __RadixUnsigned;
+
+        template<>
+        struct __RadixUnsigned<1> { typedef uint8_t Type; };
+
+        template<>
+        struct __RadixUnsigned<2> { typedef uint16_t Type; };
+
+        template<>
+        struct __RadixUnsigned<4> { typedef uint32_t Type; };
+
+        template<>
+        struct __RadixUnsigned<8> { typedef uint64_t Type; };
+
+        /// @brief Maps a key to an unsigned integer that orders the same way
+        template<typename T, bool = IsFloatingPoint<T>::Value, bool = IsSigned<T>::Value>
+        struct __RadixKey {
+            WSTL_STATIC_ASSERT(IsIntegral<T>::Value, "Radix sort keys must be integral or floating point");
+            typedef typename __RadixUnsigned<sizeof(T)>::Type Type;
+
+            static __WSTL_CONSTEXPR__ Type Get(T key) {
+                return static_cast<Type>(key);
+            }
+        };
+
+        template<typename T>
+        struct __RadixKey<T, false, true> {
+            typedef typename __RadixUnsigned<sizeof(T)>::Type Type;
+
+            // Flipping the sign bit moves negative values below positive ones
+            static __WSTL_CONSTEXPR__ Type Get(T key) {
+                return static_cast<Type>(static_cast<Type>(key) ^ (Type(1) << (sizeof(Type) * 8 - 1)));
+            }
+        };
+
+        template<typename T, bool Signed>
+        struct __RadixKey<T, true, Signed> {
+            typedef typename __RadixUnsigned<sizeof(T)>::Type Type;
+
+            // Negative values get all bits flipped to reverse their order, positive ones only the sign bit
+            static __WSTL_CONSTEXPR14__ Type Get(T key) {
+                Type bits = 0;
+                const unsigned char* source = reinterpret_cast<const unsigned char*>(&key);
+                unsigned char* destination = reinterpret_cast<unsigned char*>(&bits);
+                for(size_t i = 0; i < sizeof(Type); ++i) destination[i] = source[i];
+
+                const Type sign = Type(1) << (sizeof(Type) * 8 - 1);
+                return (bits & sign) ? static_cast<Type>(~bits) : static_cast<Type>(bits | sign);
+            }
+        };
+
+        template<typename T>
+        __WSTL_CONSTEXPR14__
+        inline size_t __RadixDigit(const T& key, unsigned shift) {
+            return static_cast<size_t>((__RadixKey<T>::Get(key) >> shift) & 0xFFU);
+        }
+
+        template<typename InputIterator, typename Projection>
+        __WSTL_CONSTEXPR14__
+        void __RadixHistogram(InputIterator first, InputIterator last, Array<size_t, 256>& count, unsigned shift, Projection& projection) {
+            count.Fill(0);
+            for(; first != last; ++first) ++count[__RadixDigit(projection(*first), shift)];
+        }
+
+        template<typename InputIterator, typename OutputIterator, typename Projection>
+        __WSTL_CONSTEXPR14__
+        void __RadixScatter(InputIterator first, InputIterator last, OutputIterator destination,
+            Array<size_t, 256>& count, unsigned shift, Projection& projection) {
+            // Turn counts into starting offsets
+            size_t offset = 0;
+            for(size_t i = 0; i < 256; ++i) {
+                size_t current = count[i];
+                count[i] = offset;
+                offset += current;
+            }
+
+            for(; first != last; ++first) {
+                size_t digit = __RadixDigit(projection(*first), shift);
+                *(destination + count[digit]++) = __WSTL_MOVE__(*first);
+            }
+        }
+
+        template<typename RandomAccessIterator, typename T, typename Projection>
+        __WSTL_CONSTEXPR14__
+        void __RadixSort(RandomAccessIterator first, RandomAccessIterator last, T* buffer, Projection& projection) {
+            const size_t n = static_cast<size_t>(last - first);
+            if(n <= 1) return;
+
+            Array<size_t, 256> count = {{ 0 }};
+            bool inBuffer = false;
+
+            for(unsigned shift = 0; shift < sizeof(projection(*first)) * 8; shift += 8) {
+                if(inBuffer) __RadixHistogram(buffer, buffer + n, count, shift, projection);
+                else __RadixHistogram(first, last, count, shift, projection);
+
+                // All keys share this digit, the pass would not change anything
+                if(count[__RadixDigit(projection(inBuffer ? *buffer : *first), shift)] == n) continue;
+
+                if(inBuffer) __RadixScatter(buffer, buffer + n, first, count, shift, projection);
+                else __RadixScatter(first, last, buffer, count, shift, projection);
+
+                inBuffer = !inBuffer;
+            }
+
+            if(inBuffer) Move(buffer, buffer + n, first);
+        }
+    }
+
+    /// @brief Sorts a range by a key taken from each element using LSD radix sort
+    /// @param first Iterator to the beginning of the range
+    /// @param last Iterator to the end of the range
+    /// @param buffer Scratch buffer, must be at least as big as the range
+    /// @param projection Unary functor that returns the integral or floating point key of an element
+    /// @details The sort is stable and takes one pass over the range per byte of the key,
+    /// passes where all keys share the same digit are skipped. 8-bit digits keep the histogram
+    /// at 256 counters on the stack, no memory is allocated
+    /// @throws `LengthError` if the buffer is smaller than the range
+    /// @ingroup algorithm
+    template<typename RandomAccessIterator, typename T, size_t Extent, typename Projection>
+    __WSTL_CONSTEXPR14__
+    void RadixSort(RandomAccessIterator first, RandomAccessIterator last, Span<T, Extent> buffer, Projection projection) {
+        WSTL_STATIC_ASSERT((IsSame<T, typename IteratorTraits<RandomAccessIterator>::ValueType>::Value), "Buffer must hold the value type of the range");
+        __WSTL_ASSERT_RETURN__(buffer.Size() >= static_cast<size_t>(Distance(first, last)), WSTL_MAKE_EXCEPTION(LengthError, "Radix sort buffer is smaller than the range"));
+
+        __private::__RadixSort(first, last, buffer.Data(), projection);
+    }
+
+    /// @brief Sorts a range of integral or floating point values into ascending order using LSD radix sort
+    /// @param first Iterator to the beginning of the range
+    /// @param last Iterator to the end of the range
+    /// @param buffer Scratch buffer, must be at least as big as the range
+    /// @details The sort is stable and takes one pass over the range per byte of the value,
+    /// passes where all values share the same digit are skipped. Negative zero is ordered before
+    /// positive zero, NaNs are ordered by their bits
+    /// @throws `LengthError` if the buffer is smaller than the range
+    /// @ingroup algorithm
+    template<typename RandomAccessIterator, typename T, size_t Extent>
+    __WSTL_CONSTEXPR14__
+    inline void RadixSort(RandomAccessIterator first, RandomAccessIterator last, Span<T, Extent> buffer) {
+        RadixSort(first, last, buffer, Identity<typename IteratorTraits<RandomAccessIterator>::ValueType>());
+    }
+}
+
+#endif
\ No newline at end of file
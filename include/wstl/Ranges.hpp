@@ -0,0 +1,1079 @@
+// Part of WardenSTL - https://github.com/WardenHD/WardenSTL
+// Copyright (c) 2025 Artem Bezruchko (WardenHD)
+//
+// Licensed under the MIT License. See LICENSE file for details.
+
+#ifndef __WSTL_RANGES_HPP__
+#define __WSTL_RANGES_HPP__
+
+#include "private/Platform.hpp"
+#include "private/AddressOf.hpp"
+#include "TypeTraits.hpp"
+#include "Iterator.hpp"
+#include "Utility.hpp"
+#include "StaticAssert.hpp"
+#include "NullPointer.hpp"
+#include <stddef.h>
+
+
+/// @defgroup ranges Ranges
+/// @ingroup iterator
+/// @brief Lazy views that filter, transform and slice ranges without copying them
+///
+/// A view holds the iterators of the range it adapts, or the view it adapts, and computes its
+/// elements while it is iterated. Stacking views gives a pipeline that runs as one loop over
+/// the source, with no buffer between the stages and no allocation. Views do not own elements,
+/// so the source container must outlive them. Adaptors are nested as functions, and in C++11
+/// they can also be chained with `|`
+///
+/// @code
+/// // C++98
+/// TransformView<FilterView<SubRange<const uint32_t*>, bool(*)(uint32_t)>, Scaler> scaled =
+///     Transform(Filter(samples, IsValid), Scaler());
+/// uint32_t sum = Accumulate(scaled.Begin(), scaled.End(), 0U);
+///
+/// // C++11
+/// auto scaled = samples | Filter(IsValid) | Transform(Scale) | Take(64);
+/// uint32_t sum = Accumulate(scaled.Begin(), scaled.End(), 0U);
+/// @endcode
+
+namespace wstl {
+    // View base
+
+    /// @brief Base class of views, marks types that are cheap to copy and refer to their elements
+    /// @ingroup ranges
+    /// @see https://en.cppreference.com/w/cpp/ranges/view
+    struct ViewBase {};
+
+    /// @brief Checks whether a type is a view
+    /// @tparam T Type to check
+    /// @ingroup ranges
+    template<typename T>
+    struct IsView : IsBaseOf<ViewBase, typename RemoveCV<T>::Type> {};
+
+    #ifdef __WSTL_CXX17__
+    /// @copydoc IsView
+    /// @since C++17
+    template<typename T>
+    inline constexpr bool IsViewVariable = IsView<T>::Value;
+    #endif
+
+    // Sub range
+
+    /// @brief View of the elements between two iterators
+    /// @tparam T Type of the iterators
+    /// @ingroup ranges
+    /// @see https://en.cppreference.com/w/cpp/ranges/subrange
+    template<typename T>
+    class SubRange : public ViewBase {
+    public:
+        typedef T Iterator;
+        typedef T ConstIterator;
+        typedef typename IteratorTraits<T>::ValueType ValueType;
+        typedef typename IteratorTraits<T>::DifferenceType DifferenceType;
+        typedef size_t SizeType;
+
+        /// @brief Default constructor, creates an empty range
+        __WSTL_CONSTEXPR__ SubRange() : m_First(), m_Last() {}
+
+        /// @brief Constructor
+        /// @param first Iterator to the first element
+        /// @param last Iterator past the last element
+        __WSTL_CONSTEXPR__ SubRange(Iterator first, Iterator last) : m_First(first), m_Last(last) {}
+
+        /// @brief Gets an iterator to the first element
+        __WSTL_CONSTEXPR__ Iterator Begin() const {
+            return m_First;
+        }
+
+        /// @copydoc Begin
+        __WSTL_CONSTEXPR__ Iterator ConstBegin() const {
+            return m_First;
+        }
+
+        /// @brief Gets an iterator past the last element
+        __WSTL_CONSTEXPR__ Iterator End() const {
+            return m_Last;
+        }
+
+        /// @copydoc End
+        __WSTL_CONSTEXPR__ Iterator ConstEnd() const {
+            return m_Last;
+        }
+
+        /// @brief Checks if the range has no elements
+        __WSTL_NODISCARD__ __WSTL_CONSTEXPR__ bool Empty() const {
+            return m_First == m_Last;
+        }
+
+        /// @brief Gets the number of elements, linear for iterators that are not random access
+        __WSTL_NODISCARD__ SizeType Size() const {
+            return static_cast<SizeType>(Distance(m_First, m_Last));
+        }
+
+    private:
+        Iterator m_First;
+        Iterator m_Last;
+    };
+
+    namespace __private {
+        /// @brief Gets the iterator type of a range
+        template<typename Range>
+        struct __RangeIterator {
+            typedef typename Range::Iterator Type;
+        };
+
+        template<typename Range>
+        struct __RangeIterator<const Range> {
+            typedef typename Range::ConstIterator Type;
+        };
+
+        template<typename T, size_t N>
+        struct __RangeIterator<T[N]> {
+            typedef T* Type;
+        };
+
+        template<typename T, size_t N>
+        struct __RangeIterator<const T[N]> {
+            typedef const T* Type;
+        };
+
+        /// @brief Gets the view adapted by a view adaptor: views are copied, other ranges are
+        /// referred to by a `SubRange`
+        template<typename Range, bool = IsView<Range>::Value>
+        struct __ViewOf {
+            typedef SubRange<typename __RangeIterator<Range>::Type> Type;
+
+            static Type Make(Range& range) {
+                return Type(wstl::Begin(range), wstl::End(range));
+            }
+        };
+
+        template<typename Range>
+        struct __ViewOf<Range, true> {
+            typedef typename RemoveCV<Range>::Type Type;
+
+            static const Type& Make(const Range& range) {
+                return range;
+            }
+        };
+
+        /// @brief Advances an iterator by up to `count` steps, stopping at `last`
+        template<typename Iterator, typename Difference>
+        inline Iterator __BoundedNext(Iterator first, Iterator last, Difference count, RandomAccessIteratorTag) {
+            const Difference remaining = static_cast<Difference>(last - first);
+            return first + (count < remaining ? count : remaining);
+        }
+
+        template<typename Iterator, typename Difference>
+        inline Iterator __BoundedNext(Iterator first, Iterator last, Difference count, InputIteratorTag) {
+            for(; count > 0 && first != last; --count) ++first;
+            return first;
+        }
+
+        template<typename Iterator, typename Difference>
+        inline Iterator __BoundedNext(Iterator first, Iterator last, Difference count) {
+            return __BoundedNext(first, last, count, typename IteratorTraits<Iterator>::IteratorCategory());
+        }
+    }
+
+    /// @brief Gets a range as a view, a view is returned as is
+    /// @param range Container, array or view
+    /// @ingroup ranges
+    template<typename Range>
+    inline typename __private::__ViewOf<Range>::Type All(Range& range) {
+        return __private::__ViewOf<Range>::Make(range);
+    }
+
+    /// @copydoc All(Range&)
+    template<typename Range>
+    inline typename __private::__ViewOf<const Range>::Type All(const Range& range) {
+        return __private::__ViewOf<const Range>::Make(range);
+    }
+
+    // Transform view
+
+    /// @brief View of the results of a function applied to each element of a range
+    /// @tparam View Adapted view
+    /// @tparam Function Unary function, in C++98 a function pointer or a functor with `ResultType`
+    /// @details The function is called every time an element is dereferenced. The iterator has the
+    /// category of the adapted one, so a transformed array is still random access
+    /// @ingroup ranges
+    /// @see https://en.cppreference.com/w/cpp/ranges/transform_view
+    template<typename View, typename Function>
+    class TransformView : public ViewBase {
+    private:
+        typedef typename __private::__RangeIterator<const View>::Type BaseIterator;
+
+    public:
+        #ifdef __WSTL_CXX11__
+        typedef typename ResultOf<const Function&(typename IteratorTraits<BaseIterator>::ReferenceType)>::Type ReferenceType;
+        #else
+        typedef typename ResultOf<Function>::Type ReferenceType;
+        #endif
+
+        typedef typename RemoveCVReference<ReferenceType>::Type ValueType;
+        typedef typename IteratorTraits<BaseIterator>::DifferenceType DifferenceType;
+
+        /// @brief Iterator that applies the function on dereference
+        class Iterator : public wstl::Iterator<typename IteratorTraits<BaseIterator>::IteratorCategory, ValueType,
+            DifferenceType, const ValueType*, ReferenceType> {
+        public:
+            /// @brief Default constructor
+            Iterator() : m_Function(NullPointer), m_Current() {}
+
+            /// @brief Constructor
+            /// @param function Function to apply, must outlive the iterator
+            /// @param current Iterator of the adapted view
+            Iterator(const Function* function, BaseIterator current) : m_Function(function), m_Current(current) {}
+
+            /// @brief Gets the iterator of the adapted view
+            BaseIterator Base() const {
+                return m_Current;
+            }
+
+            ReferenceType operator*() const {
+                return (*m_Function)(*m_Current);
+            }
+
+            ReferenceType operator[](DifferenceType n) const {
+                return (*m_Function)(m_Current[n]);
+            }
+
+            Iterator& operator++() {
+                ++m_Current;
+                return *this;
+            }
+
+            Iterator operator++(int) {
+                Iterator original(*this);
+                ++m_Current;
+                return original;
+            }
+
+            Iterator& operator--() {
+                --m_Current;
+                return *this;
+            }
+
+            Iterator operator--(int) {
+                Iterator original(*this);
+                --m_Current;
+                return original;
+            }
+
+            Iterator& operator+=(DifferenceType n) {
+                m_Current += n;
+                return *this;
+            }
+
+            Iterator& operator-=(DifferenceType n) {
+                m_Current -= n;
+                return *this;
+            }
+
+            friend Iterator operator+(const Iterator& iterator, DifferenceType n) {
+                return Iterator(iterator.m_Function, iterator.m_Current + n);
+            }
+
+            friend Iterator operator+(DifferenceType n, const Iterator& iterator) {
+                return Iterator(iterator.m_Function, iterator.m_Current + n);
+            }
+
+            friend Iterator operator-(const Iterator& iterator, DifferenceType n) {
+                return Iterator(iterator.m_Function, iterator.m_Current - n);
+            }
+
+            friend DifferenceType operator-(const Iterator& a, const Iterator& b) {
+                return a.m_Current - b.m_Current;
+            }
+
+            friend bool operator==(const Iterator& a, const Iterator& b) {
+                return a.m_Current == b.m_Current;
+            }
+
+            friend bool operator!=(const Iterator& a, const Iterator& b) {
+                return !(a.m_Current == b.m_Current);
+            }
+
+            friend bool operator<(const Iterator& a, const Iterator& b) {
+                return a.m_Current < b.m_Current;
+            }
+
+        private:
+            const Function* m_Function;
+            BaseIterator m_Current;
+        };
+
+        typedef Iterator ConstIterator;
+
+        /// @brief Constructor
+        /// @param view View to adapt
+        /// @param function Function to apply to the elements
+        TransformView(const View& view, const Function& function) : m_View(view), m_Function(function) {}
+
+        /// @brief Gets an iterator to the first element
+        Iterator Begin() const {
+            return Iterator(&m_Function, m_View.Begin());
+        }
+
+        /// @copydoc Begin
+        Iterator ConstBegin() const {
+            return Begin();
+        }
+
+        /// @brief Gets an iterator past the last element
+        Iterator End() const {
+            return Iterator(&m_Function, m_View.End());
+        }
+
+        /// @copydoc End
+        Iterator ConstEnd() const {
+            return End();
+        }
+
+        /// @brief Checks if the view has no elements
+        __WSTL_NODISCARD__ bool Empty() const {
+            return m_View.Begin() == m_View.End();
+        }
+
+    private:
+        View m_View;
+        Function m_Function;
+    };
+
+    /// @brief Creates a view of the results of a function applied to each element of a range
+    /// @param range Container, array or view to adapt
+    /// @param function Unary function
+    /// @ingroup ranges
+    template<typename Range, typename Function>
+    inline TransformView<typename __private::__ViewOf<Range>::Type, Function> Transform(Range& range, Function function) {
+        return TransformView<typename __private::__ViewOf<Range>::Type, Function>(All(range), function);
+    }
+
+    /// @copydoc Transform(Range&, Function)
+    template<typename Range, typename Function>
+    inline TransformView<typename __private::__ViewOf<const Range>::Type, Function> Transform(const Range& range, Function function) {
+        return TransformView<typename __private::__ViewOf<const Range>::Type, Function>(All(range), function);
+    }
+
+    // Filter view
+
+    /// @brief View of the elements of a range that satisfy a predicate
+    /// @tparam View Adapted view
+    /// @tparam Predicate Unary predicate
+    /// @details Incrementing skips elements until the predicate holds, so `Begin` walks to the
+    /// first match on every call. The iterator is a forward iterator
+    /// @ingroup ranges
+    /// @see https://en.cppreference.com/w/cpp/ranges/filter_view
+    template<typename View, typename Predicate>
+    class FilterView : public ViewBase {
+    private:
+        typedef typename __private::__RangeIterator<const View>::Type BaseIterator;
+
+    public:
+        typedef typename IteratorTraits<BaseIterator>::ValueType ValueType;
+        typedef typename IteratorTraits<BaseIterator>::ReferenceType ReferenceType;
+        typedef typename IteratorTraits<BaseIterator>::PointerType PointerType;
+        typedef typename IteratorTraits<BaseIterator>::DifferenceType DifferenceType;
+
+        /// @brief Forward iterator over the matching elements
+        class Iterator : public wstl::Iterator<ForwardIteratorTag, ValueType, DifferenceType, PointerType, ReferenceType> {
+        public:
+            /// @brief Default constructor
+            Iterator() : m_Predicate(NullPointer), m_Current(), m_Last() {}
+
+            /// @brief Constructor, moves to the first match at or after `current`
+            /// @param predicate Predicate to test, must outlive the iterator
+            /// @param current Iterator of the adapted view
+            /// @param last End iterator of the adapted view
+            Iterator(const Predicate* predicate, BaseIterator current, BaseIterator last) :
+                m_Predicate(predicate), m_Current(current), m_Last(last) {
+                    Satisfy();
+                }
+
+            /// @brief Gets the iterator of the adapted view
+            BaseIterator Base() const {
+                return m_Current;
+            }
+
+            ReferenceType operator*() const {
+                return *m_Current;
+            }
+
+            PointerType operator->() const {
+                return AddressOf(*m_Current);
+            }
+
+            Iterator& operator++() {
+                ++m_Current;
+                Satisfy();
+                return *this;
+            }
+
+            Iterator operator++(int) {
+                Iterator original(*this);
+                ++*this;
+                return original;
+            }
+
+            friend bool operator==(const Iterator& a, const Iterator& b) {
+                return a.m_Current == b.m_Current;
+            }
+
+            friend bool operator!=(const Iterator& a, const Iterator& b) {
+                return !(a.m_Current == b.m_Current);
+            }
+
+        private:
+            const Predicate* m_Predicate;
+            BaseIterator m_Current;
+            BaseIterator m_Last;
+
+            void Satisfy() {
+                while(m_Current != m_Last && !(*m_Predicate)(*m_Current)) ++m_Current;
+            }
+        };
+
+        typedef Iterator ConstIterator;
+
+        /// @brief Constructor
+        /// @param view View to adapt
+        /// @param predicate Predicate the elements must satisfy
+        FilterView(const View& view, const Predicate& predicate) : m_View(view), m_Predicate(predicate) {}
+
+        /// @brief Gets an iterator to the first matching element
+        Iterator Begin() const {
+            return Iterator(&m_Predicate, m_View.Begin(), m_View.End());
+        }
+
+        /// @copydoc Begin
+        Iterator ConstBegin() const {
+            return Begin();
+        }
+
+        /// @brief Gets an iterator past the last element
+        Iterator End() const {
+            return Iterator(&m_Predicate, m_View.End(), m_View.End());
+        }
+
+        /// @copydoc End
+        Iterator ConstEnd() const {
+            return End();
+        }
+
+        /// @brief Checks if no element matches
+        __WSTL_NODISCARD__ bool Empty() const {
+            return Begin() == End();
+        }
+
+    private:
+        View m_View;
+        Predicate m_Predicate;
+    };
+
+    /// @brief Creates a view of the elements of a range that satisfy a predicate
+    /// @param range Container, array or view to adapt
+    /// @param predicate Unary predicate
+    /// @ingroup ranges
+    template<typename Range, typename Predicate>
+    inline FilterView<typename __private::__ViewOf<Range>::Type, Predicate> Filter(Range& range, Predicate predicate) {
+        return FilterView<typename __private::__ViewOf<Range>::Type, Predicate>(All(range), predicate);
+    }
+
+    /// @copydoc Filter(Range&, Predicate)
+    template<typename Range, typename Predicate>
+    inline FilterView<typename __private::__ViewOf<const Range>::Type, Predicate> Filter(const Range& range, Predicate predicate) {
+        return FilterView<typename __private::__ViewOf<const Range>::Type, Predicate>(All(range), predicate);
+    }
+
+    // Take view
+
+    /// @brief View of the first elements of a range
+    /// @tparam View Adapted view
+    /// @details Over a random access view, the iterators are those of the adapted view and the end
+    /// is found once, so a loop over the view is a plain loop over the source. Otherwise the
+    /// iterator counts the elements left
+    /// @ingroup ranges
+    /// @see https://en.cppreference.com/w/cpp/ranges/take_view
+    template<typename View>
+    class TakeView : public ViewBase {
+    private:
+        typedef typename __private::__RangeIterator<const View>::Type BaseIterator;
+        static const __WSTL_CONSTEXPR__ bool IsRandomAccess = IsRandomAccessIterator<BaseIterator>::Value;
+
+    public:
+        typedef typename IteratorTraits<BaseIterator>::ValueType ValueType;
+        typedef typename IteratorTraits<BaseIterator>::ReferenceType ReferenceType;
+        typedef typename IteratorTraits<BaseIterator>::PointerType PointerType;
+        typedef typename IteratorTraits<BaseIterator>::DifferenceType DifferenceType;
+        typedef size_t SizeType;
+
+        /// @brief Forward iterator that stops after a number of elements
+        class CountedIterator : public wstl::Iterator<ForwardIteratorTag, ValueType, DifferenceType, PointerType, ReferenceType> {
+        public:
+            /// @brief Default constructor
+            CountedIterator() : m_Current(), m_Remaining(0) {}
+
+            /// @brief Constructor
+            /// @param current Iterator of the adapted view
+            /// @param remaining Number of elements left
+            CountedIterator(BaseIterator current, SizeType remaining) : m_Current(current), m_Remaining(remaining) {}
+
+            /// @brief Gets the iterator of the adapted view
+            BaseIterator Base() const {
+                return m_Current;
+            }
+
+            ReferenceType operator*() const {
+                return *m_Current;
+            }
+
+            PointerType operator->() const {
+                return AddressOf(*m_Current);
+            }
+
+            CountedIterator& operator++() {
+                ++m_Current;
+                --m_Remaining;
+                return *this;
+            }
+
+            CountedIterator operator++(int) {
+                CountedIterator original(*this);
+                ++*this;
+                return original;
+            }
+
+            /// @details Iterators are equal at the same position, or when both have no elements left
+            friend bool operator==(const CountedIterator& a, const CountedIterator& b) {
+                return a.m_Current == b.m_Current || (a.m_Remaining == 0 && b.m_Remaining == 0);
+            }
+
+            friend bool operator!=(const CountedIterator& a, const CountedIterator& b) {
+                return !(a == b);
+            }
+
+        private:
+            BaseIterator m_Current;
+            SizeType m_Remaining;
+        };
+
+        typedef typename Conditional<IsRandomAccess, BaseIterator, CountedIterator>::Type Iterator;
+        typedef Iterator ConstIterator;
+
+        /// @brief Constructor
+        /// @param view View to adapt
+        /// @param count Maximum number of elements
+        TakeView(const View& view, SizeType count) : m_View(view), m_Count(count) {}
+
+        /// @brief Gets an iterator to the first element
+        Iterator Begin() const {
+            return Begin(BoolConstant<IsRandomAccess>());
+        }
+
+        /// @copydoc Begin
+        Iterator ConstBegin() const {
+            return Begin();
+        }
+
+        /// @brief Gets an iterator past the last element
+        Iterator End() const {
+            return End(BoolConstant<IsRandomAccess>());
+        }
+
+        /// @copydoc End
+        Iterator ConstEnd() const {
+            return End();
+        }
+
+        /// @brief Checks if the view has no elements
+        __WSTL_NODISCARD__ bool Empty() const {
+            return m_Count == 0 || m_View.Begin() == m_View.End();
+        }
+
+    private:
+        View m_View;
+        SizeType m_Count;
+
+        BaseIterator Begin(TrueType) const {
+            return m_View.Begin();
+        }
+
+        BaseIterator End(TrueType) const {
+            return __private::__BoundedNext(m_View.Begin(), m_View.End(), static_cast<DifferenceType>(m_Count));
+        }
+
+        CountedIterator Begin(FalseType) const {
+            return CountedIterator(m_View.Begin(), m_Count);
+        }
+
+        CountedIterator End(FalseType) const {
+            return CountedIterator(m_View.End(), 0);
+        }
+    };
+
+    template<typename View>
+    const __WSTL_CONSTEXPR__ bool TakeView<View>::IsRandomAccess;
+
+    /// @brief Creates a view of the first elements of a range
+    /// @param range Container, array or view to adapt
+    /// @param count Maximum number of elements
+    /// @ingroup ranges
+    template<typename Range>
+    inline TakeView<typename __private::__ViewOf<Range>::Type> Take(Range& range, size_t count) {
+        return TakeView<typename __private::__ViewOf<Range>::Type>(All(range), count);
+    }
+
+    /// @copydoc Take(Range&, size_t)
+    template<typename Range>
+    inline TakeView<typename __private::__ViewOf<const Range>::Type> Take(const Range& range, size_t count) {
+        return TakeView<typename __private::__ViewOf<const Range>::Type>(All(range), count);
+    }
+
+    // Stride view
+
+    /// @brief View of every n-th element of a range, starting with the first
+    /// @tparam View Adapted view
+    /// @ingroup ranges
+    /// @see https://en.cppreference.com/w/cpp/ranges/stride_view
+    template<typename View>
+    class StrideView : public ViewBase {
+    private:
+        typedef typename __private::__RangeIterator<const View>::Type BaseIterator;
+
+    public:
+        typedef typename IteratorTraits<BaseIterator>::ValueType ValueType;
+        typedef typename IteratorTraits<BaseIterator>::ReferenceType ReferenceType;
+        typedef typename IteratorTraits<BaseIterator>::PointerType PointerType;
+        typedef typename IteratorTraits<BaseIterator>::DifferenceType DifferenceType;
+
+        /// @brief Forward iterator that steps over several elements at once
+        class Iterator : public wstl::Iterator<ForwardIteratorTag, ValueType, DifferenceType, PointerType, ReferenceType> {
+        public:
+            /// @brief Default constructor
+            Iterator() : m_Current(), m_Last(), m_Stride(1) {}
+
+            /// @brief Constructor
+            /// @param current Iterator of the adapted view
+            /// @param last End iterator of the adapted view
+            /// @param stride Number of elements to step over
+            Iterator(BaseIterator current, BaseIterator last, DifferenceType stride) : m_Current(current), m_Last(last), m_Stride(stride) {}
+
+            /// @brief Gets the iterator of the adapted view
+            BaseIterator Base() const {
+                return m_Current;
+            }
+
+            ReferenceType operator*() const {
+                return *m_Current;
+            }
+
+            PointerType operator->() const {
+                return AddressOf(*m_Current);
+            }
+
+            Iterator& operator++() {
+                m_Current = __private::__BoundedNext(m_Current, m_Last, m_Stride);
+                return *this;
+            }
+
+            Iterator operator++(int) {
+                Iterator original(*this);
+                ++*this;
+                return original;
+            }
+
+            friend bool operator==(const Iterator& a, const Iterator& b) {
+                return a.m_Current == b.m_Current;
+            }
+
+            friend bool operator!=(const Iterator& a, const Iterator& b) {
+                return !(a.m_Current == b.m_Current);
+            }
+
+        private:
+            BaseIterator m_Current;
+            BaseIterator m_Last;
+            DifferenceType m_Stride;
+        };
+
+        typedef Iterator ConstIterator;
+
+        /// @brief Constructor
+        /// @param view View to adapt
+        /// @param stride Number of elements to step over, must be positive
+        StrideView(const View& view, DifferenceType stride) : m_View(view), m_Stride(stride) {}
+
+        /// @brief Gets an iterator to the first element
+        Iterator Begin() const {
+            return Iterator(m_View.Begin(), m_View.End(), m_Stride);
+        }
+
+        /// @copydoc Begin
+        Iterator ConstBegin() const {
+            return Begin();
+        }
+
+        /// @brief Gets an iterator past the last element
+        Iterator End() const {
+            return Iterator(m_View.End(), m_View.End(), m_Stride);
+        }
+
+        /// @copydoc End
+        Iterator ConstEnd() const {
+            return End();
+        }
+
+        /// @brief Checks if the view has no elements
+        __WSTL_NODISCARD__ bool Empty() const {
+            return m_View.Begin() == m_View.End();
+        }
+
+    private:
+        View m_View;
+        DifferenceType m_Stride;
+    };
+
+    /// @brief Creates a view of every n-th element of a range
+    /// @param range Container, array or view to adapt
+    /// @param stride Number of elements to step over, must be positive
+    /// @ingroup ranges
+    template<typename Range>
+    inline StrideView<typename __private::__ViewOf<Range>::Type> Stride(Range& range, ptrdiff_t stride) {
+        return StrideView<typename __private::__ViewOf<Range>::Type>(All(range), stride);
+    }
+
+    /// @copydoc Stride(Range&, ptrdiff_t)
+    template<typename Range>
+    inline StrideView<typename __private::__ViewOf<const Range>::Type> Stride(const Range& range, ptrdiff_t stride) {
+        return StrideView<typename __private::__ViewOf<const Range>::Type>(All(range), stride);
+    }
+
+    // Chunk view
+
+    /// @brief View of a range split into consecutive chunks of the same size, the last one may be shorter
+    /// @tparam View Adapted view
+    /// @details Each chunk is a `SubRange` of the adapted view, made when the iterator is dereferenced
+    /// @ingroup ranges
+    /// @see https://en.cppreference.com/w/cpp/ranges/chunk_view
+    template<typename View>
+    class ChunkView : public ViewBase {
+    private:
+        typedef typename __private::__RangeIterator<const View>::Type BaseIterator;
+
+    public:
+        typedef SubRange<BaseIterator> ValueType;
+        typedef ValueType ReferenceType;
+        typedef typename IteratorTraits<BaseIterator>::DifferenceType DifferenceType;
+
+        /// @brief Forward iterator over the chunks
+        class Iterator : public wstl::Iterator<ForwardIteratorTag, ValueType, DifferenceType, const ValueType*, ReferenceType> {
+        public:
+            /// @brief Default constructor
+            Iterator() : m_Current(), m_Last(), m_Size(1) {}
+
+            /// @brief Constructor
+            /// @param current Iterator to the first element of the chunk
+            /// @param last End iterator of the adapted view
+            /// @param size Number of elements in a chunk
+            Iterator(BaseIterator current, BaseIterator last, DifferenceType size) : m_Current(current), m_Last(last), m_Size(size) {}
+
+            /// @brief Gets the iterator of the adapted view
+            BaseIterator Base() const {
+                return m_Current;
+            }
+
+            ReferenceType operator*() const {
+                return ValueType(m_Current, __private::__BoundedNext(m_Current, m_Last, m_Size));
+            }
+
+            Iterator& operator++() {
+                m_Current = __private::__BoundedNext(m_Current, m_Last, m_Size);
+                return *this;
+            }
+
+            Iterator operator++(int) {
+                Iterator original(*this);
+                ++*this;
+                return original;
+            }
+
+            friend bool operator==(const Iterator& a, const Iterator& b) {
+                return a.m_Current == b.m_Current;
+            }
+
+            friend bool operator!=(const Iterator& a, const Iterator& b) {
+                return !(a.m_Current == b.m_Current);
+            }
+
+        private:
+            BaseIterator m_Current;
+            BaseIterator m_Last;
+            DifferenceType m_Size;
+        };
+
+        typedef Iterator ConstIterator;
+
+        /// @brief Constructor
+        /// @param view View to adapt
+        /// @param size Number of elements in a chunk, must be positive
+        ChunkView(const View& view, DifferenceType size) : m_View(view), m_Size(size) {}
+
+        /// @brief Gets an iterator to the first chunk
+        Iterator Begin() const {
+            return Iterator(m_View.Begin(), m_View.End(), m_Size);
+        }
+
+        /// @copydoc Begin
+        Iterator ConstBegin() const {
+            return Begin();
+        }
+
+        /// @brief Gets an iterator past the last chunk
+        Iterator End() const {
+            return Iterator(m_View.End(), m_View.End(), m_Size);
+        }
+
+        /// @copydoc End
+        Iterator ConstEnd() const {
+            return End();
+        }
+
+        /// @brief Checks if the view has no chunks
+        __WSTL_NODISCARD__ bool Empty() const {
+            return m_View.Begin() == m_View.End();
+        }
+
+    private:
+        View m_View;
+        DifferenceType m_Size;
+    };
+
+    /// @brief Creates a view of a range split into chunks
+    /// @param range Container, array or view to adapt
+    /// @param size Number of elements in a chunk, must be positive
+    /// @ingroup ranges
+    template<typename Range>
+    inline ChunkView<typename __private::__ViewOf<Range>::Type> Chunk(Range& range, ptrdiff_t size) {
+        return ChunkView<typename __private::__ViewOf<Range>::Type>(All(range), size);
+    }
+
+    /// @copydoc Chunk(Range&, ptrdiff_t)
+    template<typename Range>
+    inline ChunkView<typename __private::__ViewOf<const Range>::Type> Chunk(const Range& range, ptrdiff_t size) {
+        return ChunkView<typename __private::__ViewOf<const Range>::Type>(All(range), size);
+    }
+
+    // Zip view
+
+    /// @brief View of pairs of the elements at the same position in two ranges
+    /// @tparam View1 First adapted view
+    /// @tparam View2 Second adapted view
+    /// @details Dereferencing gives a `Pair` of the references of both elements, so assigning to
+    /// its members writes through to the ranges. The view ends with the shorter range
+    /// @ingroup ranges
+    /// @see https://en.cppreference.com/w/cpp/ranges/zip_view
+    template<typename View1, typename View2>
+    class ZipView : public ViewBase {
+    private:
+        typedef typename __private::__RangeIterator<const View1>::Type BaseIterator1;
+        typedef typename __private::__RangeIterator<const View2>::Type BaseIterator2;
+
+    public:
+        typedef Pair<typename IteratorTraits<BaseIterator1>::ValueType, typename IteratorTraits<BaseIterator2>::ValueType> ValueType;
+        typedef Pair<typename IteratorTraits<BaseIterator1>::ReferenceType, typename IteratorTraits<BaseIterator2>::ReferenceType> ReferenceType;
+        typedef typename IteratorTraits<BaseIterator1>::DifferenceType DifferenceType;
+
+        /// @brief Forward iterator over both ranges in step
+        class Iterator : public wstl::Iterator<ForwardIteratorTag, ValueType, DifferenceType, const ValueType*, ReferenceType> {
+        public:
+            /// @brief Default constructor
+            Iterator() : m_First(), m_Second() {}
+
+            /// @brief Constructor
+            /// @param first Iterator of the first view
+            /// @param second Iterator of the second view
+            Iterator(BaseIterator1 first, BaseIterator2 second) : m_First(first), m_Second(second) {}
+
+            ReferenceType operator*() const {
+                return ReferenceType(*m_First, *m_Second);
+            }
+
+            Iterator& operator++() {
+                ++m_First;
+                ++m_Second;
+                return *this;
+            }
+
+            Iterator operator++(int) {
+                Iterator original(*this);
+                ++*this;
+                return original;
+            }
+
+            /// @details Iterators are equal when either of their positions is, which ends
+            /// the view with the shorter range
+            friend bool operator==(const Iterator& a, const Iterator& b) {
+                return a.m_First == b.m_First || a.m_Second == b.m_Second;
+            }
+
+            friend bool operator!=(const Iterator& a, const Iterator& b) {
+                return !(a == b);
+            }
+
+        private:
+            BaseIterator1 m_First;
+            BaseIterator2 m_Second;
+        };
+
+        typedef Iterator ConstIterator;
+
+        /// @brief Constructor
+        /// @param first First view to adapt
+        /// @param second Second view to adapt
+        ZipView(const View1& first, const View2& second) : m_First(first), m_Second(second) {}
+
+        /// @brief Gets an iterator to the first pair
+        Iterator Begin() const {
+            return Iterator(m_First.Begin(), m_Second.Begin());
+        }
+
+        /// @copydoc Begin
+        Iterator ConstBegin() const {
+            return Begin();
+        }
+
+        /// @brief Gets an iterator past the last pair
+        Iterator End() const {
+            return Iterator(m_First.End(), m_Second.End());
+        }
+
+        /// @copydoc End
+        Iterator ConstEnd() const {
+            return End();
+        }
+
+        /// @brief Checks if the view has no pairs
+        __WSTL_NODISCARD__ bool Empty() const {
+            return m_First.Begin() == m_First.End() || m_Second.Begin() == m_Second.End();
+        }
+
+    private:
+        View1 m_First;
+        View2 m_Second;
+    };
+
+    /// @brief Creates a view of pairs of the elements of two ranges
+    /// @param first First container, array or view
+    /// @param second Second container, array or view
+    /// @ingroup ranges
+    template<typename Range1, typename Range2>
+    inline ZipView<typename __private::__ViewOf<Range1>::Type, typename __private::__ViewOf<Range2>::Type> Zip(Range1& first, Range2& second) {
+        return ZipView<typename __private::__ViewOf<Range1>::Type, typename __private::__ViewOf<Range2>::Type>(All(first), All(second));
+    }
+
+    /// @copydoc Zip(Range1&, Range2&)
+    template<typename Range1, typename Range2>
+    inline ZipView<typename __private::__ViewOf<const Range1>::Type, typename __private::__ViewOf<const Range2>::Type> Zip(const Range1& first, const Range2& second) {
+        return ZipView<typename __private::__ViewOf<const Range1>::Type, typename __private::__ViewOf<const Range2>::Type>(All(first), All(second));
+    }
+
+    // Pipe syntax
+
+    #ifdef __WSTL_CXX11__
+    namespace __private {
+        /// @brief Adaptor waiting for its range, created by an adaptor function without one and applied by `|`
+        template<typename Adaptor, typename Argument>
+        struct __RangeClosure {
+            Argument Value;
+
+            template<typename Range>
+            friend auto operator|(Range&& range, const __RangeClosure& closure) -> decltype(Adaptor::Apply(range, closure.Value)) {
+                WSTL_STATIC_ASSERT(IsView<RemoveReferenceType<Range> >::Value || IsLValueReference<Range>::Value,
+                    "Views do not own elements, a temporary container would not outlive the view");
+                return Adaptor::Apply(range, closure.Value);
+            }
+        };
+
+        struct __TransformAdaptor {
+            template<typename Range, typename Function>
+            static auto Apply(Range& range, const Function& function) -> decltype(Transform(range, function)) {
+                return Transform(range, function);
+            }
+        };
+
+        struct __FilterAdaptor {
+            template<typename Range, typename Predicate>
+            static auto Apply(Range& range, const Predicate& predicate) -> decltype(Filter(range, predicate)) {
+                return Filter(range, predicate);
+            }
+        };
+
+        struct __TakeAdaptor {
+            template<typename Range>
+            static auto Apply(Range& range, size_t count) -> decltype(Take(range, count)) {
+                return Take(range, count);
+            }
+        };
+
+        struct __StrideAdaptor {
+            template<typename Range>
+            static auto Apply(Range& range, ptrdiff_t stride) -> decltype(Stride(range, stride)) {
+                return Stride(range, stride);
+            }
+        };
+
+        struct __ChunkAdaptor {
+            template<typename Range>
+            static auto Apply(Range& range, ptrdiff_t size) -> decltype(Chunk(range, size)) {
+                return Chunk(range, size);
+            }
+        };
+    }
+
+    /// @brief Creates a transform adaptor for the pipe syntax, `range | Transform(function)`
+    /// @param function Unary function
+    /// @ingroup ranges
+    /// @since C++11
+    template<typename Function>
+    inline __private::__RangeClosure<__private::__TransformAdaptor, Function> Transform(Function function) {
+        return { function };
+    }
+
+    /// @brief Creates a filter adaptor for the pipe syntax, `range | Filter(predicate)`
+    /// @param predicate Unary predicate
+    /// @ingroup ranges
+    /// @since C++11
+    template<typename Predicate>
+    inline __private::__RangeClosure<__private::__FilterAdaptor, Predicate> Filter(Predicate predicate) {
+        return { predicate };
+    }
+
+    /// @brief Creates a take adaptor for the pipe syntax, `range | Take(count)`
+    /// @param count Maximum number of elements
+    /// @ingroup ranges
+    /// @since C++11
+    inline __private::__RangeClosure<__private::__TakeAdaptor, size_t> Take(size_t count) {
+        return { count };
+    }
+
+    /// @brief Creates a stride adaptor for the pipe syntax, `range | Stride(stride)`
+    /// @param stride Number of elements to step over, must be positive
+    /// @ingroup ranges
+    /// @since C++11
+    inline __private::__RangeClosure<__private::__StrideAdaptor, ptrdiff_t> Stride(ptrdiff_t stride) {
+        return { stride };
+    }
+
+    /// @brief Creates a chunk adaptor for the pipe syntax, `range | Chunk(size)`
+    /// @param size Number of elements in a chunk, must be positive
+    /// @ingroup ranges
+    /// @since C++11
+    inline __private::__RangeClosure<__private::__ChunkAdaptor, ptrdiff_t> Chunk(ptrdiff_t size) {
+        return { size };
+    }
+    #endif
+}
+
+#endif
@@ -0,0 +1,373 @@
+// Part of WardenSTL - https://github.com/WardenHD/WardenSTL
+// Copyright (c) 2025 Artem Bezruchko (WardenHD)
+//
+// Licensed under the MIT License. See LICENSE file for details.
+
+#ifndef __WSTL_RINGBUFFER_HPP__
+#define __WSTL_RINGBUFFER_HPP__
+
+#include "private/Platform.hpp"
+#include "private/Error.hpp"
+#include "Container.hpp"
+#include "Atomic.hpp"
+#include "Span.hpp"
+#include "Algorithm.hpp"
+#include "Utility.hpp"
+#include "StandardExceptions.hpp"
+#include <stddef.h>
+
+
+/// @defgroup ring_buffer Ring Buffer
+/// @ingroup containers
+/// @brief A lock-free single-producer single-consumer circular buffer
+
+namespace wstl {
+    // Basic ring buffer
+
+    /// @brief A circular buffer that is safe for one producer and one consumer running concurrently,
+    /// for example an interrupt handler and a task
+    /// @tparam Storage The storage type used by the ring buffer, its capacity must be a power of two
+    /// @details Both indices run freely and are masked on access, so the whole capacity is usable.
+    /// Each side writes only its own index and publishes it with release ordering, no locks
+    /// or interrupt masking is needed. Elements are assigned into the slots of the storage.
+    /// `Push`, `Write`, `WriteRegion` and `Commit` may only be called by the producer,
+    /// `Pop`, `Front`, `Read`, `ReadRegion`, `Consume` and `Clear` only by the consumer
+    /// @ingroup ring_buffer
+    template<typename Storage>
+    class BasicRingBuffer {
+    public:
+        WSTL_STATIC_ASSERT(!IsVoid<Storage>::Value, "Storage must be non-void");
+
+        typedef typename Storage::ValueType ValueType;
+        typedef typename Storage::SizeType SizeType;
+        typedef ptrdiff_t DifferenceType;
+        typedef ValueType& ReferenceType;
+        typedef const ValueType& ConstReferenceType;
+        typedef ValueType* PointerType;
+        typedef const ValueType* ConstPointerType;
+
+        typedef Storage StorageType;
+
+        /// @brief Gets the number of elements in the ring buffer
+        /// @details The value is exact on either side, elsewhere it is a snapshot
+        SizeType Size() const __WSTL_NOEXCEPT__ {
+            const SizeType read = m_ReadIndex.Load(MEMORY_ORDER_ACQUIRE);
+            return m_WriteIndex.Load(MEMORY_ORDER_ACQUIRE) - read;
+        }
+
+        /// @brief Gets the capacity of the ring buffer
+        __WSTL_CONSTEXPR__ SizeType Capacity() const __WSTL_NOEXCEPT__ {
+            return m_Storage.Capacity;
+        }
+
+        /// @brief Gets the maximum size of the ring buffer
+        __WSTL_CONSTEXPR__ SizeType MaxSize() const __WSTL_NOEXCEPT__ {
+            return m_Storage.Capacity;
+        }
+
+        /// @brief Checks if the ring buffer is empty
+        bool Empty() const __WSTL_NOEXCEPT__ {
+            return Size() == 0;
+        }
+
+        /// @brief Checks if the ring buffer is full
+        bool Full() const __WSTL_NOEXCEPT__ {
+            return Size() == Capacity();
+        }
+
+        /// @brief Gets the available space in the ring buffer
+        SizeType Available() const __WSTL_NOEXCEPT__ {
+            return Capacity() - Size();
+        }
+
+        // Producer
+
+        /// @brief Pushes an element to the back of the ring buffer
+        /// @param value Element to push
+        /// @return `true` if the element was pushed, `false` if the ring buffer is full
+        bool Push(ConstReferenceType value) {
+            const SizeType write = m_WriteIndex.Load(MEMORY_ORDER_RELAXED);
+            if(write - m_ReadIndex.Load(MEMORY_ORDER_ACQUIRE) == Capacity()) return false;
+
+            m_Storage.Data[write & Mask()] = value;
+            m_WriteIndex.Store(write + 1, MEMORY_ORDER_RELEASE);
+            return true;
+        }
+
+        #ifdef __WSTL_CXX11__
+        /// @brief Pushes an element to the back of the ring buffer by moving it
+        /// @param value Element to push
+        /// @return `true` if the element was pushed, `false` if the ring buffer is full
+        /// @since C++11
+        bool Push(ValueType&& value) {
+            const SizeType write = m_WriteIndex.Load(MEMORY_ORDER_RELAXED);
+            if(write - m_ReadIndex.Load(MEMORY_ORDER_ACQUIRE) == Capacity()) return false;
+
+            m_Storage.Data[write & Mask()] = Move(value);
+            m_WriteIndex.Store(write + 1, MEMORY_ORDER_RELEASE);
+            return true;
+        }
+        #endif
+
+        /// @brief Copies as many elements as fit into the ring buffer
+        /// @param data Elements to copy
+        /// @return Number of elements copied
+        template<typename U, size_t Extent>
+        SizeType Write(Span<U, Extent> data) {
+            const SizeType write = m_WriteIndex.Load(MEMORY_ORDER_RELAXED);
+            const SizeType count = Min<SizeType>(data.Size(), Capacity() - (write - m_ReadIndex.Load(MEMORY_ORDER_ACQUIRE)));
+
+            // The free space wraps at most once
+            const SizeType offset = write & Mask();
+            const SizeType first = Min<SizeType>(count, Capacity() - offset);
+
+            Copy(data.Data(), data.Data() + first, m_Storage.Data + offset);
+            Copy(data.Data() + first, data.Data() + count, m_Storage.Data);
+
+            m_WriteIndex.Store(write + count, MEMORY_ORDER_RELEASE);
+            return count;
+        }
+
+        /// @brief Gets the contiguous free region after the last element
+        /// @return Span of free slots that can be filled in place, for example by DMA.
+        /// It may be shorter than `Available()` when the free space wraps around
+        Span<ValueType> WriteRegion() {
+            const SizeType write = m_WriteIndex.Load(MEMORY_ORDER_RELAXED);
+            const SizeType free = Capacity() - (write - m_ReadIndex.Load(MEMORY_ORDER_ACQUIRE));
+            const SizeType offset = write & Mask();
+
+            return Span<ValueType>(m_Storage.Data + offset, Min<SizeType>(free, Capacity() - offset));
+        }
+
+        /// @brief Publishes elements written into the region returned by `WriteRegion`
+        /// @param count Number of elements written
+        void Commit(SizeType count) {
+            const SizeType write = m_WriteIndex.Load(MEMORY_ORDER_RELAXED);
+            __WSTL_ASSERT_RETURN__(count <= Capacity() - (write - m_ReadIndex.Load(MEMORY_ORDER_ACQUIRE)),
+                WSTL_MAKE_EXCEPTION(LengthError, "Ring buffer commit is larger than the free space"));
+
+            m_WriteIndex.Store(write + count, MEMORY_ORDER_RELEASE);
+        }
+
+        // Consumer
+
+        /// @brief Gets the front element of the ring buffer
+        /// @details The ring buffer must not be empty
+        ReferenceType Front() {
+            return m_Storage.Data[m_ReadIndex.Load(MEMORY_ORDER_RELAXED) & Mask()];
+        }
+
+        /// @brief Gets the front element of the ring buffer
+        /// @details The ring buffer must not be empty
+        ConstReferenceType Front() const {
+            return m_Storage.Data[m_ReadIndex.Load(MEMORY_ORDER_RELAXED) & Mask()];
+        }
+
+        /// @brief Pops an element from the front of the ring buffer
+        /// @param value Variable to move the element into
+        /// @return `true` if an element was popped, `false` if the ring buffer is empty
+        bool Pop(ReferenceType value) {
+            const SizeType read = m_ReadIndex.Load(MEMORY_ORDER_RELAXED);
+            if(m_WriteIndex.Load(MEMORY_ORDER_ACQUIRE) == read) return false;
+
+            value = __WSTL_MOVE__(m_Storage.Data[read & Mask()]);
+            m_ReadIndex.Store(read + 1, MEMORY_ORDER_RELEASE);
+            return true;
+        }
+
+        /// @brief Pops an element from the front of the ring buffer, discarding it
+        /// @return `true` if an element was popped, `false` if the ring buffer is empty
+        bool Pop() {
+            const SizeType read = m_ReadIndex.Load(MEMORY_ORDER_RELAXED);
+            if(m_WriteIndex.Load(MEMORY_ORDER_ACQUIRE) == read) return false;
+
+            m_ReadIndex.Store(read + 1, MEMORY_ORDER_RELEASE);
+            return true;
+        }
+
+        /// @brief Copies as many elements as available out of the ring buffer
+        /// @param data Destination for the elements
+        /// @return Number of elements copied
+        template<size_t Extent>
+        SizeType Read(Span<ValueType, Extent> data) {
+            const SizeType read = m_ReadIndex.Load(MEMORY_ORDER_RELAXED);
+            const SizeType count = Min<SizeType>(data.Size(), m_WriteIndex.Load(MEMORY_ORDER_ACQUIRE) - read);
+
+            const SizeType offset = read & Mask();
+            const SizeType first = Min<SizeType>(count, Capacity() - offset);
+
+            Copy(m_Storage.Data + offset, m_Storage.Data + offset + first, data.Data());
+            Copy(m_Storage.Data, m_Storage.Data + (count - first), data.Data() + first);
+
+            m_ReadIndex.Store(read + count, MEMORY_ORDER_RELEASE);
+            return count;
+        }
+
+        /// @brief Gets the contiguous region of elements from the front
+        /// @return Span of elements that can be processed in place. It may be shorter
+        /// than `Size()` when the elements wrap around
+        Span<ValueType> ReadRegion() {
+            const SizeType read = m_ReadIndex.Load(MEMORY_ORDER_RELAXED);
+            const SizeType used = m_WriteIndex.Load(MEMORY_ORDER_ACQUIRE) - read;
+            const SizeType offset = read & Mask();
+
+            return Span<ValueType>(m_Storage.Data + offset, Min<SizeType>(used, Capacity() - offset));
+        }
+
+        /// @brief Releases elements processed from the region returned by `ReadRegion`
+        /// @param count Number of elements processed
+        void Consume(SizeType count) {
+            const SizeType read = m_ReadIndex.Load(MEMORY_ORDER_RELAXED);
+            __WSTL_ASSERT_RETURN__(count <= m_WriteIndex.Load(MEMORY_ORDER_ACQUIRE) - read,
+                WSTL_MAKE_EXCEPTION(LengthError, "Ring buffer consume is larger than the size"));
+
+            m_ReadIndex.Store(read + count, MEMORY_ORDER_RELEASE);
+        }
+
+        /// @brief Discards all elements currently in the ring buffer
+        void Clear() {
+            m_ReadIndex.Store(m_WriteIndex.Load(MEMORY_ORDER_ACQUIRE), MEMORY_ORDER_RELEASE);
+        }
+
+    protected:
+        /// @brief Protected default constructor
+        /// @details Only available if Storage is default-constructible
+        BasicRingBuffer() : m_Storage(), m_WriteIndex(0), m_ReadIndex(0) {
+            CheckCapacity();
+        }
+
+        /// @brief Protected constructor with storage parameter
+        /// @param storage The storage to use for the ring buffer
+        BasicRingBuffer(const Storage& storage) : m_Storage(storage), m_WriteIndex(0), m_ReadIndex(0) {
+            CheckCapacity();
+        }
+
+        /// @brief Protected destructor
+        ~BasicRingBuffer() {}
+
+    private:
+        Storage m_Storage;
+        Atomic<SizeType> m_WriteIndex;
+        Atomic<SizeType> m_ReadIndex;
+
+        /// @brief Deleted copy constructor
+        BasicRingBuffer(const BasicRingBuffer&) __WSTL_DELETE__;
+
+        /// @brief Deleted copy assignment operator
+        BasicRingBuffer& operator=(const BasicRingBuffer&) __WSTL_DELETE__;
+
+        SizeType Mask() const __WSTL_NOEXCEPT__ {
+            return Capacity() - 1;
+        }
+
+        void CheckCapacity() {
+            __WSTL_ASSERT__(Capacity() != 0 && (Capacity() & (Capacity() - 1)) == 0,
+                WSTL_MAKE_EXCEPTION(LengthError, "Ring buffer capacity must be a power of two"));
+        }
+    };
+
+    // Ring buffer
+
+    /// @brief Version of ring buffer with fixed storage, default option
+    /// @tparam T Type of the elements
+    /// @tparam N Capacity of the ring buffer, must be a power of two
+    /// @ingroup ring_buffer
+    template<typename T, size_t N>
+    class RingBuffer : public BasicRingBuffer<FixedStorage<T, N> > {
+    private:
+        typedef BasicRingBuffer<FixedStorage<T, N> > Base;
+
+    public:
+        WSTL_STATIC_ASSERT(N != 0 && (N & (N - 1)) == 0, "Ring buffer capacity must be a power of two");
+
+        typedef typename Base::ValueType ValueType;
+        typedef typename Base::SizeType SizeType;
+        typedef typename Base::DifferenceType DifferenceType;
+        typedef typename Base::ReferenceType ReferenceType;
+        typedef typename Base::ConstReferenceType ConstReferenceType;
+        typedef typename Base::PointerType PointerType;
+        typedef typename Base::ConstPointerType ConstPointerType;
+
+        typedef typename Base::StorageType StorageType;
+
+        /// @brief The static size, needed for metaprogramming
+        static const __WSTL_CONSTEXPR__ SizeType StaticSize = N;
+
+        /// @brief Default constructor
+        RingBuffer() : Base() {}
+    };
+
+    template<typename T, size_t N>
+    const __WSTL_CONSTEXPR__ typename RingBuffer<T, N>::SizeType RingBuffer<T, N>::StaticSize;
+
+    // Ring buffer external
+
+    namespace external {
+        /// @brief Version of ring buffer that uses external storage
+        /// @tparam T Type of the elements
+        /// @ingroup ring_buffer
+        template<typename T>
+        class RingBuffer : public BasicRingBuffer<ExternalStorage<T> > {
+        private:
+            typedef BasicRingBuffer<ExternalStorage<T> > Base;
+
+        public:
+            typedef typename Base::ValueType ValueType;
+            typedef typename Base::SizeType SizeType;
+            typedef typename Base::DifferenceType DifferenceType;
+            typedef typename Base::ReferenceType ReferenceType;
+            typedef typename Base::ConstReferenceType ConstReferenceType;
+            typedef typename Base::PointerType PointerType;
+            typedef typename Base::ConstPointerType ConstPointerType;
+
+            typedef typename Base::StorageType StorageType;
+
+            /// @brief Constructor that uses external buffer
+            /// @param buffer Pointer to the external buffer
+            /// @param capacity Capacity of the external buffer, must be a power of two
+            RingBuffer(T* buffer, SizeType capacity) : Base(StorageType(buffer, capacity)) {}
+        };
+
+        /// @brief Version of ring buffer that uses fixed external storage with compile-time known capacity
+        /// @tparam T Type of the elements
+        /// @tparam N Capacity of the ring buffer, must be a power of two
+        /// @ingroup ring_buffer
+        template<typename T, size_t N>
+        class FixedRingBuffer : public BasicRingBuffer<FixedExternalStorage<T, N> > {
+        private:
+            typedef BasicRingBuffer<FixedExternalStorage<T, N> > Base;
+
+        public:
+            WSTL_STATIC_ASSERT(N != 0 && (N & (N - 1)) == 0, "Ring buffer capacity must be a power of two");
+
+            typedef typename Base::ValueType ValueType;
+            typedef typename Base::SizeType SizeType;
+            typedef typename Base::DifferenceType DifferenceType;
+            typedef typename Base::ReferenceType ReferenceType;
+            typedef typename Base::ConstReferenceType ConstReferenceType;
+            typedef typename Base::PointerType PointerType;
+            typedef typename Base::ConstPointerType ConstPointerType;
+
+            typedef typename Base::StorageType StorageType;
+
+            /// @brief The static size, needed for metaprogramming
+            static const __WSTL_CONSTEXPR__ SizeType StaticSize = N;
+
+            /// @brief Constructor that uses external buffer
+            /// @param buffer Pointer to the external buffer
+            explicit FixedRingBuffer(T* buffer) : Base(StorageType(buffer)) {}
+        };
+
+        template<typename T, size_t N>
+        const __WSTL_CONSTEXPR__ typename FixedRingBuffer<T, N>::SizeType FixedRingBuffer<T, N>::StaticSize;
+
+        // Template deduction guides
+
+        #ifdef __WSTL_CXX17__
+        template<typename T, size_t N>
+        FixedRingBuffer(T(&)[N]) -> FixedRingBuffer<T, N>;
+        #endif
+    }
+}
+
+#endif
\ No newline at end of file
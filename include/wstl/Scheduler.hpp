@@ -0,0 +1,862 @@
+// Part of WardenSTL - https://github.com/WardenHD/WardenSTL
+// Copyright (c) 2025 Artem Bezruchko (WardenHD)
+//
+// Licensed under the MIT License. See LICENSE file for details.
+
+#ifndef __WSTL_SCHEDULER_HPP__
+#define __WSTL_SCHEDULER_HPP__
+
+#include "private/Platform.hpp"
+#include "private/Error.hpp"
+#include "IntrusiveList.hpp"
+#include "TimerWheel.hpp"
+#include "Allocator.hpp"
+#include "StandardExceptions.hpp"
+#include "Utility.hpp"
+#include "NullPointer.hpp"
+#include "PlacementNew.hpp"
+#include <stddef.h>
+
+#if defined(__WSTL_CXX20__) && defined(__cpp_impl_coroutine)
+#include <coroutine>
+#endif
+
+
+/// @defgroup scheduler Scheduler
+/// @ingroup utilities
+/// @brief Runs many stackless tasks cooperatively on one thread
+
+// Protothreads
+
+/// @brief Starts the body of a protothread, must be the first statement of the function
+/// @param state The `ProtothreadState` of the protothread
+/// @details A protothread is a function that returns a `ProtothreadStatus` and resumes where it
+/// left off on the next call, using the `switch` trick of Duff's device. Its local variables are
+/// not kept between calls, state must live in members, and the body must not contain `switch`
+/// statements of its own
+/// @ingroup scheduler
+#define WSTL_PT_BEGIN(state) switch((state).Line) { case 0:
+
+/// @brief Ends the body of a protothread, later calls return `PROTOTHREAD_EXITED` at once
+/// @param state The `ProtothreadState` of the protothread
+/// @ingroup scheduler
+#define WSTL_PT_END(state) } (state).Line = ::wstl::ProtothreadState::ExitedLine; return ::wstl::PROTOTHREAD_EXITED
+
+/// @brief Returns from a protothread, the next call continues after this statement
+/// @param state The `ProtothreadState` of the protothread
+/// @ingroup scheduler
+#define WSTL_PT_YIELD(state) do { (state).Line = __LINE__; return ::wstl::PROTOTHREAD_YIELDED; case __LINE__:; } while(0)
+
+/// @brief Returns from a protothread until a condition holds, it is checked again on every call
+/// @param state The `ProtothreadState` of the protothread
+/// @param condition The condition to wait for
+/// @ingroup scheduler
+#define WSTL_PT_WAIT_UNTIL(state, condition) do { (state).Line = __LINE__; __WSTL_FALLTHROUGH__; case __LINE__: if(!(condition)) return ::wstl::PROTOTHREAD_WAITING; } while(0)
+
+/// @brief Finishes a protothread early
+/// @param state The `ProtothreadState` of the protothread
+/// @ingroup scheduler
+#define WSTL_PT_EXIT(state) do { (state).Line = ::wstl::ProtothreadState::ExitedLine; return ::wstl::PROTOTHREAD_EXITED; } while(0)
+
+/// @brief Waits until an event of a scheduler is set, the protothread is resumed when it is
+/// @param state A `Scheduler::Protothread`
+/// @param event The `Event` to wait for
+/// @ingroup scheduler
+#define WSTL_PT_AWAIT(state, event) WSTL_PT_WAIT_UNTIL(state, (event).Await(state))
+
+/// @brief Suspends a protothread of a scheduler for a number of ticks
+/// @param state A `Scheduler::Protothread`
+/// @param ticks The number of ticks to sleep
+/// @ingroup scheduler
+#define WSTL_PT_SLEEP(state, ticks) do { (state).Sleep(ticks); WSTL_PT_WAIT_UNTIL(state, !(state).Sleeping()); } while(0)
+
+namespace wstl {
+    /// @brief Result of a call to a protothread
+    /// @ingroup scheduler
+    enum ProtothreadStatus {
+        /// @brief Waiting for a condition, the protothread must be called again once it may hold
+        PROTOTHREAD_WAITING,
+        /// @brief Gave way to others, the protothread can be called again at once
+        PROTOTHREAD_YIELDED,
+        /// @brief Finished
+        PROTOTHREAD_EXITED
+    };
+
+    /// @brief Resume point of a protothread, kept by the `WSTL_PT_` macros
+    /// @ingroup scheduler
+    ///
+    /// @code
+    /// class Blinker {
+    /// public:
+    ///     ProtothreadStatus Run() {
+    ///         WSTL_PT_BEGIN(m_State);
+    ///         for(;;) {
+    ///             Toggle();
+    ///             WSTL_PT_WAIT_UNTIL(m_State, Elapsed() >= 500);
+    ///         }
+    ///         WSTL_PT_END(m_State);
+    ///     }
+    ///
+    /// private:
+    ///     ProtothreadState m_State;
+    /// };
+    /// @endcode
+    class ProtothreadState {
+    public:
+        /// @brief Line the protothread continues from once it has finished
+        static const __WSTL_CONSTEXPR__ unsigned int ExitedLine = ~0U;
+
+        /// @brief Default constructor, the protothread starts from the beginning
+        ProtothreadState() : Line(0) {}
+
+        /// @brief Makes the protothread start from the beginning on the next call
+        void Restart() {
+            Line = 0;
+        }
+
+        /// @brief Checks if the protothread has finished
+        bool Exited() const {
+            return Line == ExitedLine;
+        }
+
+        /// @brief Source line the protothread continues from, 0 at the beginning
+        unsigned int Line;
+    };
+}
+
+#ifdef __WSTL_CXX11__
+namespace wstl {
+    class SchedulerBase;
+    class Event;
+
+    // Runnable
+
+    /// @brief Something a scheduler can resume, such as a protothread or a suspended coroutine
+    /// @details It carries its own links into the ready queue and into the waiters of an event,
+    /// so scheduling never allocates. It unlinks itself from both when destroyed
+    /// @ingroup scheduler
+    class Runnable {
+    public:
+        /// @brief Function that resumes the runnable
+        typedef void (*ResumeFunction)(Runnable&);
+
+        /// @brief Constructor
+        /// @param resume Function the scheduler calls to resume the runnable
+        explicit Runnable(ResumeFunction resume) : m_Resume(resume), m_Scheduler(NullPointer), m_Event(NullPointer) {}
+
+        /// @brief Destructor, removes the runnable from the ready queue and the waiters of an event
+        ~Runnable() {
+            Cancel();
+        }
+
+        /// @brief Puts the runnable into the ready queue of the scheduler it was last posted to
+        void Wake();
+
+        /// @brief Removes the runnable from the ready queue and the waiters of an event
+        void Cancel();
+
+        /// @brief Checks if the runnable is in a ready queue
+        bool Ready() const {
+            return m_ReadyHook.Next != NullPointer;
+        }
+
+        /// @brief Checks if the runnable waits for an event
+        bool Waiting() const {
+            return m_Event != NullPointer;
+        }
+
+        /// @brief Gets the scheduler the runnable was last posted to, null pointer if none
+        SchedulerBase* GetScheduler() const {
+            return m_Scheduler;
+        }
+
+    protected:
+        ListNode m_ReadyHook;
+        ListNode m_WaitHook;
+        ResumeFunction m_Resume;
+        SchedulerBase* m_Scheduler;
+        Event* m_Event;
+
+    private:
+        friend class SchedulerBase;
+        friend class Event;
+
+        Runnable(const Runnable&) = delete;
+        Runnable& operator=(const Runnable&) = delete;
+    };
+
+    // Event
+
+    /// @brief Flag that runnables can wait for, setting it resumes all of them
+    /// @details The flag stays set until `Reset`, waiting for a set event does not suspend
+    /// @ingroup scheduler
+    class Event {
+    public:
+        /// @brief Default constructor, creates a cleared event
+        Event() : m_Set(false) {}
+
+        /// @brief Destructor, forgets all waiters without resuming them
+        ~Event() {
+            while(!m_Waiters.Empty()) {
+                m_Waiters.Front().m_Event = NullPointer;
+                m_Waiters.PopFront();
+            }
+        }
+
+        /// @brief Checks if the event is set
+        bool IsSet() const {
+            return m_Set;
+        }
+
+        /// @brief Sets the event and puts all waiters into the ready queues of their schedulers
+        void Set() {
+            m_Set = true;
+
+            while(!m_Waiters.Empty()) {
+                Runnable& waiter = m_Waiters.Front();
+                m_Waiters.PopFront();
+
+                waiter.m_Event = NullPointer;
+                waiter.Wake();
+            }
+        }
+
+        /// @brief Clears the event
+        void Reset() {
+            m_Set = false;
+        }
+
+        /// @brief Checks if the event is set, and makes a runnable wait for it if not
+        /// @param runnable The runnable to resume when the event is set
+        /// @return `true` if the event is set
+        bool Await(Runnable& runnable) {
+            if(m_Set) return true;
+
+            if(runnable.m_Event == NullPointer) {
+                runnable.m_Event = this;
+                m_Waiters.PushBack(runnable);
+            }
+
+            return false;
+        }
+
+        /// @brief Stops a runnable from waiting for the event
+        /// @param runnable The runnable, does nothing if it is not waiting for this event
+        void Remove(Runnable& runnable) {
+            if(runnable.m_Event != this) return;
+
+            m_Waiters.Erase(runnable);
+            runnable.m_Event = NullPointer;
+        }
+
+        #if defined(__WSTL_CXX20__) && defined(__cpp_impl_coroutine)
+        /// @brief Awaiter that suspends a `Task` until the event is set
+        /// @since C++20
+        class Awaiter {
+        public:
+            explicit Awaiter(Event& event) : m_Event(event), m_Waiter(NullPointer) {}
+
+            ~Awaiter() {
+                if(m_Waiter != NullPointer) m_Event.Remove(*m_Waiter);
+            }
+
+            bool await_ready() const noexcept {
+                return m_Event.IsSet();
+            }
+
+            template<typename Promise>
+            void await_suspend(std::coroutine_handle<Promise> handle) {
+                m_Waiter = &handle.promise();
+                m_Event.Await(*m_Waiter);
+            }
+
+            void await_resume() const noexcept {}
+
+        private:
+            Event& m_Event;
+            Runnable* m_Waiter;
+        };
+
+        /// @brief Suspends a `Task` until the event is set
+        /// @since C++20
+        Awaiter operator co_await() {
+            return Awaiter(*this);
+        }
+        #endif
+
+    private:
+        IntrusiveList<Runnable, &Runnable::m_WaitHook> m_Waiters;
+        bool m_Set;
+
+        Event(const Event&) = delete;
+        Event& operator=(const Event&) = delete;
+    };
+
+    #if defined(__WSTL_CXX20__) && defined(__cpp_impl_coroutine)
+    template<typename T>
+    class Task;
+    #endif
+
+    // Scheduler base
+
+    /// @brief Ready queue of a scheduler, independent of its timer wheel
+    /// @details The queue is an intrusive list of runnables, so it is bounded by the number of
+    /// runnables that exist and posting never fails or allocates
+    /// @ingroup scheduler
+    class SchedulerBase {
+    public:
+        typedef size_t SizeType;
+
+        /// @brief Default constructor
+        SchedulerBase() {}
+
+        /// @brief Puts a runnable at the back of the ready queue, does nothing if it is there already
+        /// @param runnable The runnable to resume
+        void Post(Runnable& runnable) {
+            runnable.m_Scheduler = this;
+            if(!runnable.Ready()) m_Ready.PushBack(runnable);
+        }
+
+        /// @brief Resumes the runnable at the front of the ready queue
+        /// @return `true` if a runnable was resumed, `false` if the queue is empty
+        bool RunOne() {
+            if(m_Ready.Empty()) return false;
+
+            Runnable& runnable = m_Ready.Front();
+            m_Ready.PopFront();
+            runnable.m_Resume(runnable);
+
+            return true;
+        }
+
+        /// @brief Resumes the runnables that are ready, those posted meanwhile wait for the next call
+        /// @return The number of runnables resumed
+        SizeType Run() {
+            SizeType count = m_Ready.Size();
+            const SizeType result = count;
+
+            while(count-- > 0 && RunOne()) {}
+            return result;
+        }
+
+        /// @brief Checks if no runnable is ready
+        bool Idle() const {
+            return m_Ready.Empty();
+        }
+
+        /// @brief Gets the number of ready runnables
+        SizeType Size() const {
+            return m_Ready.Size();
+        }
+
+        /// @brief Starts a protothread or another runnable, it runs when the scheduler reaches it
+        /// @param runnable The runnable, it must stay alive until it finishes or is cancelled
+        void Spawn(Runnable& runnable) {
+            Post(runnable);
+        }
+
+        #if defined(__WSTL_CXX20__) && defined(__cpp_impl_coroutine)
+        /// @brief Starts a task, it runs when the scheduler reaches it
+        /// @param task The task, it must stay alive until it is done
+        /// @since C++20
+        template<typename T>
+        void Spawn(Task<T>& task);
+
+        /// @brief Awaiter that puts a `Task` at the back of the ready queue
+        /// @since C++20
+        class YieldAwaiter {
+        public:
+            explicit YieldAwaiter(SchedulerBase& scheduler) : m_Scheduler(scheduler) {}
+
+            bool await_ready() const noexcept {
+                return false;
+            }
+
+            template<typename Promise>
+            void await_suspend(std::coroutine_handle<Promise> handle) {
+                m_Scheduler.Post(handle.promise());
+            }
+
+            void await_resume() const noexcept {}
+
+        private:
+            SchedulerBase& m_Scheduler;
+        };
+
+        /// @brief Lets the other ready tasks run before continuing
+        /// @since C++20
+        YieldAwaiter Yield() {
+            return YieldAwaiter(*this);
+        }
+        #endif
+
+    private:
+        friend class Runnable;
+
+        IntrusiveList<Runnable, &Runnable::m_ReadyHook> m_Ready;
+
+        SchedulerBase(const SchedulerBase&) = delete;
+        SchedulerBase& operator=(const SchedulerBase&) = delete;
+    };
+
+    inline void Runnable::Wake() {
+        if(m_Scheduler != NullPointer) m_Scheduler->Post(*this);
+    }
+
+    inline void Runnable::Cancel() {
+        if(Ready()) m_Scheduler->m_Ready.Erase(*this);
+        if(m_Event != NullPointer) m_Event->Remove(*this);
+    }
+
+    // Scheduler
+
+    /// @brief Cooperative scheduler of stackless tasks with a timer wheel for sleeping
+    /// @tparam Wheel The `TimerWheel` used for sleeps and timeouts
+    /// @details Tasks are protothreads derived from `Scheduler::Protothread`, or `Task` coroutines
+    /// in C++20. Each keeps only its own small state instead of a stack, so dozens of protocol
+    /// state machines can share one thread. The main loop calls `Run` and `Advance`, and can sleep
+    /// for `TicksUntilNext` ticks when the scheduler is idle
+    /// @ingroup scheduler
+    ///
+    /// @code
+    /// typedef Scheduler<> Executor;
+    ///
+    /// class Poller : public Executor::Protothread<Poller> {
+    /// public:
+    ///     ProtothreadStatus Run() {
+    ///         WSTL_PT_BEGIN(*this);
+    ///         for(;;) {
+    ///             WSTL_PT_AWAIT(*this, DataReady);
+    ///             DataReady.Reset();
+    ///             Process();
+    ///             WSTL_PT_SLEEP(*this, 10);
+    ///         }
+    ///         WSTL_PT_END(*this);
+    ///     }
+    /// };
+    ///
+    /// Executor executor;
+    /// Poller poller;
+    /// executor.Spawn(poller);
+    ///
+    /// for(;;) {
+    ///     executor.Run();
+    ///     executor.Advance(ElapsedTicks());
+    /// }
+    /// @endcode
+    /// @since C++11
+    template<typename Wheel = TimerWheel<64, 3> >
+    class Scheduler : public SchedulerBase {
+    public:
+        typedef Wheel WheelType;
+        typedef typename Wheel::TickType TickType;
+        typedef typename Wheel::Timer TimerType;
+
+        /// @brief Base of protothreads that run on the scheduler
+        /// @tparam Derived The derived class, its `ProtothreadStatus Run()` is called on every resume
+        /// @details A protothread that yields is put back into the ready queue, one that waits is
+        /// resumed by `WSTL_PT_AWAIT`, `WSTL_PT_SLEEP` or an explicit `Wake`
+        template<typename Derived>
+        class Protothread : public Runnable, public ProtothreadState {
+        public:
+            /// @brief Default constructor
+            Protothread() : Runnable(&Resume) {
+                m_Timer.SetCallback([this] { Wake(); });
+            }
+
+            /// @brief Destructor, cancels a sleep in progress
+            ~Protothread() {
+                if(Sleeping()) Owner().m_Wheel.Cancel(m_Timer);
+            }
+
+            /// @brief Starts a sleep, the protothread is woken after a number of ticks
+            /// @param ticks The number of ticks to sleep
+            /// @throws `LogicError` if the protothread was never posted to a scheduler
+            void Sleep(TickType ticks) {
+                __WSTL_ASSERT_RETURN__(m_Scheduler != NullPointer, WSTL_MAKE_EXCEPTION(LogicError, "Protothread sleeps before it is spawned"));
+                Owner().m_Wheel.Schedule(m_Timer, ticks);
+            }
+
+            /// @brief Checks if a sleep is in progress
+            bool Sleeping() const {
+                return m_Timer.Scheduled();
+            }
+
+        private:
+            TimerType m_Timer;
+
+            Scheduler& Owner() const {
+                return *static_cast<Scheduler*>(m_Scheduler);
+            }
+
+            static void Resume(Runnable& runnable) {
+                Protothread& self = static_cast<Protothread&>(runnable);
+                if(static_cast<Derived&>(self).Run() == PROTOTHREAD_YIELDED) self.Wake();
+            }
+        };
+
+        /// @brief Default constructor
+        Scheduler() : SchedulerBase(), m_Wheel() {}
+
+        /// @brief Moves the timer wheel a tick forward, waking the sleeps that end
+        void Tick() {
+            m_Wheel.Tick();
+        }
+
+        /// @brief Moves the timer wheel a number of ticks forward, waking the sleeps that end
+        /// @param ticks The number of ticks
+        void Advance(TickType ticks) {
+            m_Wheel.Advance(ticks);
+        }
+
+        /// @brief Gets the number of ticks until the timer wheel next needs to advance, 0 if no sleep is in progress
+        TickType TicksUntilNext() const {
+            return m_Wheel.TicksUntilNext();
+        }
+
+        /// @brief Gets the timer wheel, it can hold other timers too
+        WheelType& Timers() {
+            return m_Wheel;
+        }
+
+        #if defined(__WSTL_CXX20__) && defined(__cpp_impl_coroutine)
+        /// @brief Awaiter that suspends a `Task` for a number of ticks
+        /// @since C++20
+        class SleepAwaiter {
+        public:
+            SleepAwaiter(Scheduler& scheduler, TickType ticks) : m_Scheduler(scheduler), m_Ticks(ticks) {}
+
+            ~SleepAwaiter() {
+                m_Scheduler.m_Wheel.Cancel(m_Timer);
+            }
+
+            bool await_ready() const noexcept {
+                return false;
+            }
+
+            template<typename Promise>
+            void await_suspend(std::coroutine_handle<Promise> handle) {
+                Runnable* const waiter = &handle.promise();
+
+                m_Timer.SetCallback([waiter] { waiter->Wake(); });
+                m_Scheduler.m_Wheel.Schedule(m_Timer, m_Ticks);
+            }
+
+            void await_resume() const noexcept {}
+
+        private:
+            Scheduler& m_Scheduler;
+            TickType m_Ticks;
+            TimerType m_Timer;
+        };
+
+        /// @brief Suspends a `Task` for a number of ticks
+        /// @param ticks The number of ticks
+        /// @since C++20
+        SleepAwaiter Sleep(TickType ticks) {
+            return SleepAwaiter(*this, ticks);
+        }
+        #endif
+
+    private:
+        WheelType m_Wheel;
+    };
+}
+
+#if defined(__WSTL_CXX20__) && defined(__cpp_impl_coroutine)
+// Without exceptions a failed frame allocation returns a null pointer, which requires a non-throwing operator new
+#ifdef __WSTL_EXCEPTIONS__
+    #define __WSTL_TASK_NOEXCEPT__
+#else
+    #define __WSTL_TASK_NOEXCEPT__ noexcept
+#endif
+
+namespace wstl {
+    namespace __private {
+        /// @brief Part of the promise of a `Task` that does not depend on its result
+        class __TaskPromiseBase : public Runnable {
+        public:
+            __TaskPromiseBase() : Runnable(&ResumeTask) {}
+
+            std::suspend_always initial_suspend() const noexcept {
+                return {};
+            }
+
+            struct FinalAwaiter {
+                bool await_ready() const noexcept {
+                    return false;
+                }
+
+                template<typename Promise>
+                std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> handle) noexcept {
+                    const std::coroutine_handle<> continuation = handle.promise().m_Continuation;
+                    return continuation ? continuation : std::noop_coroutine();
+                }
+
+                void await_resume() const noexcept {}
+            };
+
+            FinalAwaiter final_suspend() const noexcept {
+                return {};
+            }
+
+            void unhandled_exception() {
+                #ifdef __WSTL_EXCEPTIONS__
+                throw;
+                #endif
+            }
+
+            /// Frames start with the allocator that freed them, padded to keep the frame aligned
+            template<typename... Args>
+            static void* operator new(size_t size, Allocator& allocator, Args&...) __WSTL_TASK_NOEXCEPT__ {
+                return AllocateFrame(size, allocator);
+            }
+
+            template<typename Class, typename... Args>
+            static void* operator new(size_t size, Class&, Allocator& allocator, Args&...) __WSTL_TASK_NOEXCEPT__ {
+                return AllocateFrame(size, allocator);
+            }
+
+            static void operator delete(void* frame, size_t) noexcept {
+                unsigned char* const block = static_cast<unsigned char*>(frame) - HeaderSize;
+                (*reinterpret_cast<Allocator**>(block))->Free(block);
+            }
+
+            /// Makes the task run on the scheduler of the task that awaits it and continue that one when done
+            void Attach(__TaskPromiseBase& parent, std::coroutine_handle<> continuation) {
+                m_Scheduler = parent.m_Scheduler;
+                m_Continuation = continuation;
+            }
+
+        protected:
+            std::coroutine_handle<> m_Handle;
+
+        private:
+            static const size_t HeaderSize = (sizeof(Allocator*) + DefaultAlignment - 1) / DefaultAlignment * DefaultAlignment;
+
+            std::coroutine_handle<> m_Continuation;
+
+            static void* AllocateFrame(size_t size, Allocator& allocator) __WSTL_TASK_NOEXCEPT__ {
+                unsigned char* const block = static_cast<unsigned char*>(allocator.Allocate(size + HeaderSize));
+                __WSTL_ASSERT_RETURNVALUE__(block != NullPointer, WSTL_MAKE_EXCEPTION(BadAllocation, "Task frame allocation failed"), NullPointer);
+
+                *reinterpret_cast<Allocator**>(block) = &allocator;
+                return block + HeaderSize;
+            }
+
+            static void ResumeTask(Runnable& runnable) {
+                static_cast<__TaskPromiseBase&>(runnable).m_Handle.resume();
+            }
+        };
+
+        /// @brief Promise of a `Task` that keeps its result
+        template<typename T>
+        class __TaskPromise : public __TaskPromiseBase {
+        public:
+            __TaskPromise() : m_HasValue(false) {}
+
+            ~__TaskPromise() {
+                if(m_HasValue) Value().~T();
+            }
+
+            Task<T> get_return_object() noexcept;
+
+            #ifndef __WSTL_EXCEPTIONS__
+            static Task<T> get_return_object_on_allocation_failure() noexcept;
+            #endif
+
+            template<typename U>
+            void return_value(U&& value) {
+                ::new(m_Storage) T(Forward<U>(value));
+                m_HasValue = true;
+            }
+
+            T& Result() {
+                return Value();
+            }
+
+            T Take() {
+                return Move(Value());
+            }
+
+        private:
+            alignas(T) unsigned char m_Storage[sizeof(T)];
+            bool m_HasValue;
+
+            T& Value() {
+                return *reinterpret_cast<T*>(m_Storage);
+            }
+        };
+
+        template<>
+        class __TaskPromise<void> : public __TaskPromiseBase {
+        public:
+            Task<void> get_return_object() noexcept;
+
+            #ifndef __WSTL_EXCEPTIONS__
+            static Task<void> get_return_object_on_allocation_failure() noexcept;
+            #endif
+
+            void return_void() const noexcept {}
+
+            void Result() const noexcept {}
+
+            void Take() const noexcept {}
+        };
+    }
+
+    // Task
+
+    /// @brief Coroutine that runs on a `Scheduler` and can be awaited by other tasks
+    /// @tparam T The type of the result, `void` for none
+    /// @details A task starts suspended and runs once it is spawned on a scheduler or awaited by
+    /// another task, which continues when it finishes. Inside, `co_await` accepts an `Event`, the
+    /// `Sleep` and `Yield` of the scheduler and other tasks. The task owns its frame and destroys
+    /// it, cancelling any wait in progress, when the task object is destroyed.
+    ///
+    /// Frames never come from the heap: the first parameter of a task coroutine, or the first after
+    /// the object for member functions, must be an `Allocator&` that the frame is allocated from,
+    /// for example a `PoolAllocator`. When the allocation fails without exceptions enabled, the
+    /// coroutine returns a task that is not `Valid`. Awaiting such a task reports `BadAllocation`
+    /// and leaves the awaiting task suspended, as there is no result to continue it with
+    /// @ingroup scheduler
+    ///
+    /// @code
+    /// Task<int> ReadFrame(Allocator& allocator, Link& link) {
+    ///     co_await link.Received;
+    ///     co_return link.Frame();
+    /// }
+    ///
+    /// Task<void> Session(Allocator& allocator, Executor& executor, Link& link) {
+    ///     for(;;) {
+    ///         const int frame = co_await ReadFrame(allocator, link);
+    ///         Handle(frame);
+    ///         co_await executor.Sleep(5);
+    ///     }
+    /// }
+    /// @endcode
+    /// @since C++20
+    template<typename T = void>
+    class Task {
+    public:
+        typedef __private::__TaskPromise<T> promise_type;
+        typedef std::coroutine_handle<promise_type> HandleType;
+
+        /// @brief Default constructor, creates a task without a coroutine
+        Task() noexcept : m_Handle() {}
+
+        /// @brief Move constructor
+        /// @param other The task to move from, without a coroutine afterwards
+        Task(Task&& other) noexcept : m_Handle(other.m_Handle) {
+            other.m_Handle = HandleType();
+        }
+
+        /// @brief Destructor, destroys the coroutine frame
+        ~Task() {
+            if(m_Handle) m_Handle.destroy();
+        }
+
+        /// @brief Move assignment operator
+        /// @param other The task to move from, without a coroutine afterwards
+        Task& operator=(Task&& other) noexcept {
+            if(this != &other) {
+                if(m_Handle) m_Handle.destroy();
+
+                m_Handle = other.m_Handle;
+                other.m_Handle = HandleType();
+            }
+
+            return *this;
+        }
+
+        /// @brief Checks if the task has a coroutine
+        bool Valid() const noexcept {
+            return static_cast<bool>(m_Handle);
+        }
+
+        /// @brief Checks if the coroutine has finished
+        bool Done() const noexcept {
+            return m_Handle && m_Handle.done();
+        }
+
+        /// @brief Gets the result, the task must be done
+        decltype(auto) Result() {
+            return m_Handle.promise().Result();
+        }
+
+        /// @brief Awaiter that runs the task and continues the awaiting task with its result
+        class Awaiter {
+        public:
+            explicit Awaiter(HandleType handle) noexcept : m_Handle(handle) {}
+
+            bool await_ready() const noexcept {
+                return m_Handle && m_Handle.done();
+            }
+
+            /// @throws `BadAllocation` if the task has no coroutine
+            template<typename Promise>
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> parent) {
+                __WSTL_ASSERT_RETURNVALUE__(m_Handle, WSTL_MAKE_EXCEPTION(BadAllocation, "Awaited task has no coroutine"), std::noop_coroutine());
+
+                m_Handle.promise().Attach(parent.promise(), parent);
+                return m_Handle;
+            }
+
+            decltype(auto) await_resume() {
+                return m_Handle.promise().Take();
+            }
+
+        private:
+            HandleType m_Handle;
+        };
+
+        /// @brief Runs the task from another task, which continues with its result
+        Awaiter operator co_await() const noexcept {
+            return Awaiter(m_Handle);
+        }
+
+    private:
+        friend class __private::__TaskPromise<T>;
+        friend class SchedulerBase;
+
+        HandleType m_Handle;
+
+        explicit Task(HandleType handle) noexcept : m_Handle(handle) {}
+
+        Task(const Task&) = delete;
+        Task& operator=(const Task&) = delete;
+    };
+
+    namespace __private {
+        template<typename T>
+        Task<T> __TaskPromise<T>::get_return_object() noexcept {
+            m_Handle = std::coroutine_handle<__TaskPromise>::from_promise(*this);
+            return Task<T>(std::coroutine_handle<__TaskPromise>::from_promise(*this));
+        }
+
+        inline Task<void> __TaskPromise<void>::get_return_object() noexcept {
+            m_Handle = std::coroutine_handle<__TaskPromise>::from_promise(*this);
+            return Task<void>(std::coroutine_handle<__TaskPromise>::from_promise(*this));
+        }
+
+        #ifndef __WSTL_EXCEPTIONS__
+        template<typename T>
+        Task<T> __TaskPromise<T>::get_return_object_on_allocation_failure() noexcept {
+            return Task<T>();
+        }
+
+        inline Task<void> __TaskPromise<void>::get_return_object_on_allocation_failure() noexcept {
+            return Task<void>();
+        }
+        #endif
+    }
+
+    template<typename T>
+    void SchedulerBase::Spawn(Task<T>& task) {
+        if(task.m_Handle) Post(task.m_Handle.promise());
+    }
+}
+#endif
+#endif
+
+#endif
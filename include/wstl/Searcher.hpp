@@ -0,0 +1,250 @@
+// Part of WardenSTL - https://github.com/WardenHD/WardenSTL
+// Copyright (c) 2025 Artem Bezruchko (WardenHD)
+//
+// Licensed under the MIT License. See LICENSE file for details.
+
+#ifndef __WSTL_SEARCHER_HPP__
+#define __WSTL_SEARCHER_HPP__
+
+#include "private/Platform.hpp"
+#include "TypeTraits.hpp"
+#include "Iterator.hpp"
+#include "Utility.hpp"
+#include "Functional.hpp"
+#include "Algorithm.hpp"
+#include "Limits.hpp"
+#include <stddef.h>
+#include <stdint.h>
+
+
+namespace wstl {
+    namespace __private {
+        /// @brief Needle length from which string `Find` switches to `BoyerMooreHorspoolSearcher`.
+        /// Shorter needles do not skip enough to pay for the table
+        static const __WSTL_CONSTEXPR__ size_t __SEARCHER_THRESHOLD = 8;
+    }
+
+    // Default searcher
+
+    /// @brief Searcher that looks for a sequence with the naive `Search` algorithm
+    /// @tparam ForwardIterator Iterator type of the sequence
+    /// @tparam BinaryPredicate Predicate used to compare elements
+    /// @ingroup functional
+    /// @see https://en.cppreference.com/w/cpp/utility/functional/default_searcher
+    template<typename ForwardIterator, typename BinaryPredicate = EqualTo<> >
+    class DefaultSearcher {
+    public:
+        /// @brief Constructor
+        /// @param first Iterator to the beginning of the sequence
+        /// @param last Iterator to the end of the sequence
+        /// @param predicate Predicate used to compare elements
+        __WSTL_CONSTEXPR14__ DefaultSearcher(ForwardIterator first, ForwardIterator last, BinaryPredicate predicate = BinaryPredicate()) :
+            m_First(first), m_Last(last), m_Predicate(predicate) {}
+
+        /// @brief Searches for the sequence in a range
+        /// @param first Iterator to the beginning of the range
+        /// @param last Iterator to the end of the range
+        /// @return Pair of iterators to the beginning and the end of the first occurence,
+        /// or a pair of `last` if not found
+        template<typename ForwardIterator2>
+        __WSTL_CONSTEXPR14__ Pair<ForwardIterator2, ForwardIterator2> operator()(ForwardIterator2 first, ForwardIterator2 last) const {
+            ForwardIterator2 result = Search(first, last, m_First, m_Last, m_Predicate);
+            if(result == last) return Pair<ForwardIterator2, ForwardIterator2>(last, last);
+
+            ForwardIterator2 end = result;
+            Advance(end, Distance(m_First, m_Last));
+            return Pair<ForwardIterator2, ForwardIterator2>(result, end);
+        }
+
+    private:
+        ForwardIterator m_First;
+        ForwardIterator m_Last;
+        BinaryPredicate m_Predicate;
+    };
+
+    // Boyer-Moore-Horspool searcher
+
+    /// @brief Searcher that looks for a sequence with the Boyer-Moore-Horspool algorithm
+    /// @tparam RandomAccessIterator Iterator type of the sequence, its value type must be integral
+    /// @tparam Skip Type of the skip table entries, shifts longer than its maximum are clamped
+    /// @details The skip table has 256 entries indexed by the low byte of an element and lives
+    /// inside the searcher, so no memory is allocated and the caller decides where it is stored.
+    /// Elements that share the low byte share an entry, which only makes shifts shorter.
+    /// Construct the searcher once and reuse it to search many ranges. Average time is
+    /// sublinear in the length of the range, the worst case is O(n*m)
+    /// @ingroup functional
+    /// @see https://en.cppreference.com/w/cpp/utility/functional/boyer_moore_horspool_searcher
+    template<typename RandomAccessIterator, typename Skip = size_t>
+    class BoyerMooreHorspoolSearcher {
+    public:
+        WSTL_STATIC_ASSERT(IsIntegral<typename IteratorTraits<RandomAccessIterator>::ValueType>::Value, "Searched elements must be integral");
+        WSTL_STATIC_ASSERT(IsIntegral<Skip>::Value && !IsSigned<Skip>::Value, "Skip type must be an unsigned integral");
+
+        /// @brief Constructor, builds the skip table
+        /// @param first Iterator to the beginning of the sequence
+        /// @param last Iterator to the end of the sequence
+        BoyerMooreHorspoolSearcher(RandomAccessIterator first, RandomAccessIterator last) : m_First(first), m_Last(last) {
+            const size_t length = static_cast<size_t>(last - first);
+            const Skip full = Clamp(length);
+
+            for(size_t i = 0; i < 256; ++i) m_Table[i] = full;
+            // Later positions overwrite earlier ones with a shorter shift
+            for(size_t i = 0; i + 1 < length; ++i) m_Table[Key(first[i])] = Clamp(length - 1 - i);
+        }
+
+        /// @brief Searches for the sequence in a range
+        /// @param first Iterator to the beginning of the range
+        /// @param last Iterator to the end of the range
+        /// @return Pair of iterators to the beginning and the end of the first occurence,
+        /// or a pair of `last` if not found
+        template<typename RandomAccessIterator2>
+        Pair<RandomAccessIterator2, RandomAccessIterator2> operator()(RandomAccessIterator2 first, RandomAccessIterator2 last) const {
+            const ptrdiff_t length = m_Last - m_First;
+            if(length == 0) return Pair<RandomAccessIterator2, RandomAccessIterator2>(first, first);
+
+            const ptrdiff_t back = length - 1;
+            for(; last - first >= length; first += m_Table[Key(first[back])]) {
+                if(first[back] == m_First[back] && Equal(m_First, m_First + back, first))
+                    return Pair<RandomAccessIterator2, RandomAccessIterator2>(first, first + length);
+            }
+
+            return Pair<RandomAccessIterator2, RandomAccessIterator2>(last, last);
+        }
+
+    private:
+        RandomAccessIterator m_First;
+        RandomAccessIterator m_Last;
+        Skip m_Table[256];
+
+        template<typename T>
+        static size_t Key(const T& value) {
+            return static_cast<size_t>(value) & 0xFFU;
+        }
+
+        static Skip Clamp(size_t shift) {
+            return shift > static_cast<size_t>(NumericLimits<Skip>::Max()) ? NumericLimits<Skip>::Max() : static_cast<Skip>(shift);
+        }
+    };
+
+    // Two-Way searcher
+
+    /// @brief Searcher that looks for a sequence with the Two-Way algorithm by Crochemore and Perrin
+    /// @tparam RandomAccessIterator Iterator type of the sequence, its elements must be comparable with `<`
+    /// @details The constructor splits the sequence at its critical factorization and
+    /// finds its period, the searcher keeps only these two numbers. Searching takes
+    /// linear time in the lengths of both ranges and O(1) extra space
+    /// @ingroup functional
+    /// @see https://en.wikipedia.org/wiki/Two-way_string-matching_algorithm
+    template<typename RandomAccessIterator>
+    class TwoWaySearcher {
+    public:
+        /// @brief Constructor, computes the critical factorization
+        /// @param first Iterator to the beginning of the sequence
+        /// @param last Iterator to the end of the sequence
+        __WSTL_CONSTEXPR14__ TwoWaySearcher(RandomAccessIterator first, RandomAccessIterator last) :
+            m_First(first), m_Last(last), m_Critical(0), m_Period(1), m_Memory(0) {
+            const ptrdiff_t length = last - first;
+            if(length == 0) return;
+
+            ptrdiff_t period = 1;
+            ptrdiff_t periodReversed = 1;
+            ptrdiff_t suffix = MaximalSuffix(first, length, false, period);
+            ptrdiff_t suffixReversed = MaximalSuffix(first, length, true, periodReversed);
+
+            // The later of the two suffixes gives the critical factorization
+            if(suffixReversed > suffix) {
+                suffix = suffixReversed;
+                period = periodReversed;
+            }
+
+            m_Critical = suffix;
+
+            // The left part repeats within the period, the search remembers the matched prefix
+            if(Equal(first, first + (suffix + 1), first + period)) {
+                m_Period = period;
+                m_Memory = length - period;
+            }
+            else {
+                m_Period = (suffix + 1 > length - suffix - 1 ? suffix + 1 : length - suffix - 1) + 1;
+                m_Memory = 0;
+            }
+        }
+
+        /// @brief Searches for the sequence in a range
+        /// @param first Iterator to the beginning of the range
+        /// @param last Iterator to the end of the range
+        /// @return Pair of iterators to the beginning and the end of the first occurence,
+        /// or a pair of `last` if not found
+        template<typename RandomAccessIterator2>
+        __WSTL_CONSTEXPR14__ Pair<RandomAccessIterator2, RandomAccessIterator2> operator()(RandomAccessIterator2 first, RandomAccessIterator2 last) const {
+            const ptrdiff_t length = m_Last - m_First;
+            if(length == 0) return Pair<RandomAccessIterator2, RandomAccessIterator2>(first, first);
+
+            ptrdiff_t memory = 0;
+
+            while(last - first >= length) {
+                // Match the right part first
+                ptrdiff_t i = m_Critical + 1 > memory ? m_Critical + 1 : memory;
+                while(i < length && m_First[i] == first[i]) ++i;
+
+                if(i < length) {
+                    first += i - m_Critical;
+                    memory = 0;
+                    continue;
+                }
+
+                // Then the left part, down to the already matched prefix
+                i = m_Critical + 1;
+                while(i > memory && m_First[i - 1] == first[i - 1]) --i;
+                if(i <= memory) return Pair<RandomAccessIterator2, RandomAccessIterator2>(first, first + length);
+
+                first += m_Period;
+                memory = m_Memory;
+            }
+
+            return Pair<RandomAccessIterator2, RandomAccessIterator2>(last, last);
+        }
+
+    private:
+        RandomAccessIterator m_First;
+        RandomAccessIterator m_Last;
+        ptrdiff_t m_Critical;
+        ptrdiff_t m_Period;
+        ptrdiff_t m_Memory;
+
+        /// @brief Finds the maximal suffix of the sequence for the normal or the reversed order
+        /// @return Index of the last element before the suffix, `-1` if the suffix is the whole sequence
+        static __WSTL_CONSTEXPR14__ ptrdiff_t MaximalSuffix(RandomAccessIterator sequence, ptrdiff_t length, bool reversed, ptrdiff_t& period) {
+            ptrdiff_t suffix = -1;
+            ptrdiff_t current = 0;
+            ptrdiff_t offset = 1;
+            period = 1;
+
+            while(current + offset < length) {
+                const typename IteratorTraits<RandomAccessIterator>::ValueType& a = sequence[current + offset];
+                const typename IteratorTraits<RandomAccessIterator>::ValueType& b = sequence[suffix + offset];
+
+                if(a == b) {
+                    if(offset == period) {
+                        current += period;
+                        offset = 1;
+                    }
+                    else ++offset;
+                }
+                else if(reversed ? (b < a) : (a < b)) {
+                    current += offset;
+                    offset = 1;
+                    period = current - suffix;
+                }
+                else {
+                    suffix = current++;
+                    offset = period = 1;
+                }
+            }
+
+            return suffix;
+        }
+    };
+}
+
+#endif
\ No newline at end of file
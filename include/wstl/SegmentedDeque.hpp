@@ -0,0 +1,1308 @@
+// Part of WardenSTL - https://github.com/WardenHD/WardenSTL
+// Copyright (c) 2025 Artem Bezruchko (WardenHD)
+//
+// Licensed under the MIT License. See LICENSE file for details.
+
+#ifndef __WSTL_SEGMENTEDDEQUE_HPP__
+#define __WSTL_SEGMENTEDDEQUE_HPP__
+
+#include "private/Platform.hpp"
+#include "Container.hpp"
+#include "Iterator.hpp"
+#include "InitializerList.hpp"
+#include "StandardExceptions.hpp"
+#include "PlacementNew.hpp"
+#include "Algorithm.hpp"
+#include "Allocator.hpp"
+#include "Pool.hpp"
+#include "Span.hpp"
+#include "NullPointer.hpp"
+#include "private/Error.hpp"
+#include <stddef.h>
+
+
+/// @defgroup segmented_deque Segmented deque
+/// @ingroup containers
+/// @brief A double-ended queue that stores its elements in fixed-size blocks
+
+namespace wstl {
+    namespace __private {
+        template<size_t N, bool = (N >= 2)>
+        struct __SegmentedFloorPowerOfTwo {
+            static const __WSTL_CONSTEXPR__ size_t Value = 2 * __SegmentedFloorPowerOfTwo<N / 2>::Value;
+        };
+
+        template<size_t N>
+        struct __SegmentedFloorPowerOfTwo<N, false> {
+            static const __WSTL_CONSTEXPR__ size_t Value = 1;
+        };
+
+        /// @brief Default number of elements in a block: as many as fit 256 bytes, at least 4, rounded down to a power of two
+        template<typename T>
+        struct __SegmentedDequeBlockSize {
+            static const __WSTL_CONSTEXPR__ size_t Value = __SegmentedFloorPowerOfTwo<(256 / sizeof(T) > 4 ? 256 / sizeof(T) : 4)>::Value;
+        };
+
+        /// @brief Uninitialized block of elements, big enough to hold the free list link of a pool
+        template<typename T, size_t BlockSize>
+        union __SegmentedDequeBlock {
+            typename AlignedStorage<sizeof(T) * BlockSize, AlignmentOf<T>::Value>::Type Data;
+            void* Next;
+        };
+
+        /// @brief Allocator that hands out the blocks of a fixed-size segmented deque from an intrusive pool
+        template<typename T, size_t BlockSize, size_t N>
+        class __SegmentedDequeBlockPool : public Allocator {
+        public:
+            typedef __SegmentedDequeBlock<T, BlockSize> BlockType;
+
+            virtual void* Allocate(size_t size) __WSTL_OVERRIDE__ {
+                void* const result = size > sizeof(BlockType) || m_Pool.Full() ? NullPointer : static_cast<void*>(m_Pool.Allocate());
+                RecordAllocation(size, result);
+
+                return result;
+            }
+
+            virtual void Free(void* address) __WSTL_OVERRIDE__ {
+                if(address == NullPointer) return;
+
+                m_Pool.Release(static_cast<BlockType*>(address));
+                RecordFree(address);
+            }
+
+        private:
+            IntrusivePool<BlockType, N> m_Pool;
+        };
+    }
+
+    // Basic segmented deque
+
+    /// @brief A double-ended queue that keeps its elements in fixed-size blocks drawn from an allocator
+    /// @tparam T Type of the elements
+    /// @tparam BlockSize Number of elements in a block, a power of two
+    /// @tparam Storage The storage type of the block map, its value type must be `T*`
+    /// @details The map is a ring of block pointers, together they form a ring of
+    /// `map capacity * BlockSize` element slots. A block is drawn from the allocator when the first
+    /// element lands in it and returned when its last element leaves, one emptied block is kept as
+    /// a spare so that pushing and popping across a block boundary does not hit the allocator every time.
+    /// Pushing and popping at either end never moves other elements, so references and pointers to
+    /// elements stay valid until the element itself is removed - only `Insert` and `Erase` in the middle
+    /// shift elements, and they move the shorter side. Each block holds a contiguous run of elements,
+    /// `SegmentFrom` and `ForEachSegment` expose those runs to algorithms that work on plain arrays
+    /// @ingroup segmented_deque
+    /// @see https://en.cppreference.com/w/cpp/container/deque
+    template<typename T, size_t BlockSize, typename Storage>
+    class BasicSegmentedDeque {
+    public:
+        WSTL_STATIC_ASSERT(BlockSize != 0 && (BlockSize & (BlockSize - 1)) == 0, "Block size must be a power of two");
+        WSTL_STATIC_ASSERT((IsSame<typename Storage::ValueType, T*>::Value), "Storage must hold block pointers");
+
+        typedef T ValueType;
+        typedef typename Storage::SizeType SizeType;
+        typedef ptrdiff_t DifferenceType;
+        typedef ValueType& ReferenceType;
+        typedef const ValueType& ConstReferenceType;
+        typedef ValueType* PointerType;
+        typedef const ValueType* ConstPointerType;
+
+        typedef Storage StorageType;
+
+        /// @brief Number of elements in a block
+        static const __WSTL_CONSTEXPR__ SizeType SegmentSize = BlockSize;
+
+    private:
+        template<bool IsConst>
+        class SegmentedDequeIterator : public wstl::Iterator<RandomAccessIteratorTag, typename Conditional<IsConst, const T, T>::Type> {
+        private:
+            typedef typename Conditional<IsConst, const BasicSegmentedDeque*, BasicSegmentedDeque*>::Type DequeType;
+            typedef wstl::Iterator<RandomAccessIteratorTag, typename Conditional<IsConst, const T, T>::Type> IteratorBase;
+
+        public:
+            typedef typename IteratorBase::ReferenceType ReferenceType;
+            typedef typename IteratorBase::PointerType PointerType;
+            typedef typename IteratorBase::DifferenceType DifferenceType;
+
+            friend class BasicSegmentedDeque;
+            friend class SegmentedDequeIterator<!IsConst>;
+
+            /// @brief Default constructor
+            SegmentedDequeIterator() : m_Deque(NullPointer), m_CurrentIndex(0) {}
+
+            /// @brief Copy constructor
+            /// @param other Iterator to copy from
+            SegmentedDequeIterator(const SegmentedDequeIterator& other) : m_Deque(other.m_Deque), m_CurrentIndex(other.m_CurrentIndex) {}
+
+            /// @brief Converting constructor from a mutable iterator
+            /// @param other Iterator to convert from
+            template<bool OtherConst>
+            SegmentedDequeIterator(const SegmentedDequeIterator<OtherConst>& other,
+                typename EnableIf<IsConst && !OtherConst, int>::Type = 0) : m_Deque(other.m_Deque), m_CurrentIndex(other.m_CurrentIndex) {}
+
+            /// @brief Copy assignment operator
+            /// @param other Iterator to assign from
+            SegmentedDequeIterator& operator=(const SegmentedDequeIterator& other) {
+                m_Deque = other.m_Deque;
+                m_CurrentIndex = other.m_CurrentIndex;
+                return *this;
+            }
+
+            /// @brief Dereference operator
+            ReferenceType operator*() const {
+                return *m_Deque->Slot(m_Deque->Physical(m_CurrentIndex));
+            }
+
+            /// @brief Arrow operator
+            PointerType operator->() const {
+                return m_Deque->Slot(m_Deque->Physical(m_CurrentIndex));
+            }
+
+            /// @brief Pre-increment operator - moves the iterator forward by one element
+            /// @return Reference to the updated iterator
+            SegmentedDequeIterator& operator++() {
+                ++m_CurrentIndex;
+                return *this;
+            }
+
+            /// @brief Post-increment operator - moves the iterator forward by one element
+            /// @return Copy of the iterator before incrementing
+            SegmentedDequeIterator operator++(int) {
+                SegmentedDequeIterator original(*this);
+                ++m_CurrentIndex;
+                return original;
+            }
+
+            /// @brief Pre-decrement operator - moves the iterator backwards by one element
+            /// @return Reference to the updated iterator
+            SegmentedDequeIterator& operator--() {
+                --m_CurrentIndex;
+                return *this;
+            }
+
+            /// @brief Post-decrement operator - moves the iterator backwards by one element
+            /// @return Copy of the iterator before decrementing
+            SegmentedDequeIterator operator--(int) {
+                SegmentedDequeIterator original(*this);
+                --m_CurrentIndex;
+                return original;
+            }
+
+            /// @brief Addition operator - moves the iterator forward by a given offset
+            /// @param offset The offset to add (negative for backward movement)
+            /// @return Reference to the updated iterator
+            SegmentedDequeIterator& operator+=(DifferenceType offset) {
+                m_CurrentIndex += offset;
+                return *this;
+            }
+
+            /// @brief Subtraction operator - moves the iterator backwards by a given offset
+            /// @param offset The offset to subtract (negative for forward movement)
+            /// @return Reference to the updated iterator
+            SegmentedDequeIterator& operator-=(DifferenceType offset) {
+                m_CurrentIndex -= offset;
+                return *this;
+            }
+
+            /// @brief Access operator - allows access to the element at the given offset
+            /// @param i Offset of the element to access
+            ReferenceType operator[](DifferenceType i) const {
+                return *m_Deque->Slot(m_Deque->Physical(m_CurrentIndex + i));
+            }
+
+            friend SegmentedDequeIterator operator+(const SegmentedDequeIterator& x, DifferenceType offset) {
+                SegmentedDequeIterator result(x);
+                result += offset;
+                return result;
+            }
+
+            friend SegmentedDequeIterator operator+(DifferenceType offset, const SegmentedDequeIterator& x) {
+                SegmentedDequeIterator result(x);
+                result += offset;
+                return result;
+            }
+
+            friend SegmentedDequeIterator operator-(const SegmentedDequeIterator& x, DifferenceType offset) {
+                SegmentedDequeIterator result(x);
+                result -= offset;
+                return result;
+            }
+
+            /// @brief Subtraction operator, makes sense only when both iterators belong to the same deque
+            friend DifferenceType operator-(const SegmentedDequeIterator& a, const SegmentedDequeIterator& b) {
+                return DifferenceType(a.m_CurrentIndex) - DifferenceType(b.m_CurrentIndex);
+            }
+
+            friend bool operator==(const SegmentedDequeIterator& a, const SegmentedDequeIterator& b) {
+                return (a.m_Deque == b.m_Deque) && (a.m_CurrentIndex == b.m_CurrentIndex);
+            }
+
+            friend bool operator!=(const SegmentedDequeIterator& a, const SegmentedDequeIterator& b) {
+                return !(a == b);
+            }
+
+            friend bool operator<(const SegmentedDequeIterator& a, const SegmentedDequeIterator& b) {
+                return a.m_CurrentIndex < b.m_CurrentIndex;
+            }
+
+            friend bool operator<=(const SegmentedDequeIterator& a, const SegmentedDequeIterator& b) {
+                return !(b < a);
+            }
+
+            friend bool operator>(const SegmentedDequeIterator& a, const SegmentedDequeIterator& b) {
+                return b < a;
+            }
+
+            friend bool operator>=(const SegmentedDequeIterator& a, const SegmentedDequeIterator& b) {
+                return !(a < b);
+            }
+
+            /// @brief Gets the position of the element in the deque
+            SizeType Index() const {
+                return m_CurrentIndex;
+            }
+
+        private:
+            DequeType m_Deque;
+            SizeType m_CurrentIndex;
+
+            SegmentedDequeIterator(DequeType deque, SizeType index) : m_Deque(deque), m_CurrentIndex(index) {}
+        };
+
+    public:
+        typedef SegmentedDequeIterator<false> Iterator;
+        typedef SegmentedDequeIterator<true> ConstIterator;
+        typedef wstl::ReverseIterator<Iterator> ReverseIterator;
+        typedef wstl::ReverseIterator<ConstIterator> ConstReverseIterator;
+
+        /// @brief Destructor, returns all blocks to the allocator
+        ~BasicSegmentedDeque() {
+            Release();
+        }
+
+        /// @brief Copy assignment operator
+        /// @param other The deque to copy from
+        /// @throws `LengthError` if the other deque does not fit
+        BasicSegmentedDeque& operator=(const BasicSegmentedDeque& other) {
+            if(this != &other) Assign(other.Begin(), other.End());
+            return *this;
+        }
+
+        /// @brief Gets the number of elements in the deque
+        __WSTL_CONSTEXPR__ SizeType Size() const __WSTL_NOEXCEPT__ {
+            return m_CurrentSize;
+        }
+
+        /// @brief Gets the number of element slots in the block map
+        __WSTL_CONSTEXPR__ SizeType Capacity() const __WSTL_NOEXCEPT__ {
+            return m_Storage.Capacity * BlockSize;
+        }
+
+        /// @brief Gets the maximum size of the deque
+        __WSTL_CONSTEXPR__ SizeType MaxSize() const __WSTL_NOEXCEPT__ {
+            return Capacity();
+        }
+
+        /// @brief Checks if the deque is empty
+        __WSTL_CONSTEXPR__ bool Empty() const __WSTL_NOEXCEPT__ {
+            return m_CurrentSize == 0;
+        }
+
+        /// @brief Checks if the deque is full
+        __WSTL_CONSTEXPR__ bool Full() const __WSTL_NOEXCEPT__ {
+            return m_CurrentSize == Capacity();
+        }
+
+        /// @brief Gets the number of elements that can still be added
+        __WSTL_CONSTEXPR__ SizeType Available() const __WSTL_NOEXCEPT__ {
+            return Capacity() - m_CurrentSize;
+        }
+
+        /// @brief Assigns a range of elements to the deque
+        /// @param first Iterator to the first element in the range
+        /// @param last Iterator to the element following the last element in the range
+        /// @throws `LengthError` if the range does not fit
+        template<typename InputIterator>
+        typename EnableIf<!IsIntegral<InputIterator>::Value, void>::Type Assign(InputIterator first, InputIterator last) {
+            Clear();
+            for(; first != last; ++first) {
+                __WSTL_ASSERT_RETURN__(!Full(), WSTL_MAKE_EXCEPTION(LengthError, "Segmented deque full"));
+                EmplaceBack(*first);
+            }
+        }
+
+        /// @brief Assigns a number of copies of a value to the deque
+        /// @param count The number of elements
+        /// @param value The value to fill the deque with
+        /// @throws `LengthError` if the count exceeds the capacity
+        void Assign(SizeType count, ConstReferenceType value) {
+            __WSTL_ASSERT_RETURN__(count <= Capacity(), WSTL_MAKE_EXCEPTION(LengthError, "Segmented deque full"));
+
+            Clear();
+            while(m_CurrentSize < count) EmplaceBack(value);
+        }
+
+        #if defined(__WSTL_CXX11__) && !defined(__WSTL_NO_INITIALIZERLIST__)
+        /// @brief Assigns an initializer list to the deque
+        /// @param list The initializer list to assign
+        /// @throws `LengthError` if the list does not fit
+        /// @since C++11
+        void Assign(InitializerList<ValueType> list) {
+            Assign(list.Begin(), list.End());
+        }
+        #endif
+
+        /// @brief Gets the element at the specified position in the deque
+        /// @param position The position of the element to access
+        /// @throws `OutOfRange` if the position is out of range
+        ReferenceType At(SizeType position) {
+            __WSTL_ASSERT__(position < m_CurrentSize, WSTL_MAKE_EXCEPTION(OutOfRange, "Segmented deque index out of range"));
+            return *Slot(Physical(position));
+        }
+
+        /// @brief Gets the element at the specified position in the deque
+        /// @param position The position of the element to access
+        /// @throws `OutOfRange` if the position is out of range
+        ConstReferenceType At(SizeType position) const {
+            __WSTL_ASSERT__(position < m_CurrentSize, WSTL_MAKE_EXCEPTION(OutOfRange, "Segmented deque index out of range"));
+            return *Slot(Physical(position));
+        }
+
+        /// @brief Access operator
+        /// @param index The index of the element to access
+        ReferenceType operator[](SizeType index) {
+            return *Slot(Physical(index));
+        }
+
+        /// @brief Const access operator
+        /// @param index The index of the element to access
+        ConstReferenceType operator[](SizeType index) const {
+            return *Slot(Physical(index));
+        }
+
+        /// @brief Gets the first element in the deque
+        ReferenceType Front() {
+            return *Slot(m_Start);
+        }
+
+        /// @brief Gets the first element in the deque
+        ConstReferenceType Front() const {
+            return *Slot(m_Start);
+        }
+
+        /// @brief Gets the last element in the deque
+        ReferenceType Back() {
+            return *Slot(Physical(m_CurrentSize - 1));
+        }
+
+        /// @brief Gets the last element in the deque
+        ConstReferenceType Back() const {
+            return *Slot(Physical(m_CurrentSize - 1));
+        }
+
+        /// @brief Gets iterator to the beginning of the deque
+        Iterator Begin() {
+            return Iterator(this, 0);
+        }
+
+        /// @brief Gets const iterator to the beginning of the deque
+        ConstIterator Begin() const {
+            return ConstIterator(this, 0);
+        }
+
+        /// @brief Gets const iterator to the beginning of the deque
+        ConstIterator ConstBegin() const {
+            return ConstIterator(this, 0);
+        }
+
+        /// @brief Gets iterator to the end of the deque
+        Iterator End() {
+            return Iterator(this, m_CurrentSize);
+        }
+
+        /// @brief Gets const iterator to the end of the deque
+        ConstIterator End() const {
+            return ConstIterator(this, m_CurrentSize);
+        }
+
+        /// @brief Gets const iterator to the end of the deque
+        ConstIterator ConstEnd() const {
+            return ConstIterator(this, m_CurrentSize);
+        }
+
+        /// @brief Gets reverse iterator to the beginning of the deque
+        ReverseIterator ReverseBegin() {
+            return ReverseIterator(End());
+        }
+
+        /// @brief Gets const reverse iterator to the beginning of the deque
+        ConstReverseIterator ReverseBegin() const {
+            return ConstReverseIterator(End());
+        }
+
+        /// @brief Gets const reverse iterator to the beginning of the deque
+        ConstReverseIterator ConstReverseBegin() const {
+            return ConstReverseIterator(End());
+        }
+
+        /// @brief Gets reverse iterator to the end of the deque
+        ReverseIterator ReverseEnd() {
+            return ReverseIterator(Begin());
+        }
+
+        /// @brief Gets const reverse iterator to the end of the deque
+        ConstReverseIterator ReverseEnd() const {
+            return ConstReverseIterator(Begin());
+        }
+
+        /// @brief Gets const reverse iterator to the end of the deque
+        ConstReverseIterator ConstReverseEnd() const {
+            return ConstReverseIterator(Begin());
+        }
+
+        /// @brief Gets the contiguous run of elements that starts at the given position
+        /// @param position The position of the first element of the run
+        /// @return Span reaching to the end of the block or the end of the deque, whichever comes first,
+        /// empty if the position is not less than the size
+        Span<ValueType> SegmentFrom(SizeType position) {
+            if(position >= m_CurrentSize) return Span<ValueType>();
+
+            const SizeType physical = Physical(position);
+            return Span<ValueType>(Slot(physical), RunLength(physical, position));
+        }
+
+        /// @copydoc SegmentFrom(SizeType)
+        Span<const ValueType> SegmentFrom(SizeType position) const {
+            if(position >= m_CurrentSize) return Span<const ValueType>();
+
+            const SizeType physical = Physical(position);
+            return Span<const ValueType>(Slot(physical), RunLength(physical, position));
+        }
+
+        /// @brief Calls a function on every contiguous run of elements, front to back
+        /// @param function Function that takes a `Span` of elements
+        /// @return The function
+        template<typename Function>
+        Function ForEachSegment(Function function) {
+            for(SizeType position = 0; position < m_CurrentSize;) {
+                Span<ValueType> segment = SegmentFrom(position);
+                function(segment);
+                position += segment.Size();
+            }
+
+            return function;
+        }
+
+        /// @copydoc ForEachSegment(Function)
+        template<typename Function>
+        Function ForEachSegment(Function function) const {
+            for(SizeType position = 0; position < m_CurrentSize;) {
+                Span<const ValueType> segment = SegmentFrom(position);
+                function(segment);
+                position += segment.Size();
+            }
+
+            return function;
+        }
+
+        /// @brief Removes all elements and returns their blocks
+        /// @details The spare block is kept, use `ShrinkToFit` to return it too
+        void Clear() {
+            while(m_CurrentSize > 0) DestroyBack();
+
+            for(SizeType i = 0; i < m_Storage.Capacity; ++i) {
+                if(m_Storage.Data[i] != NullPointer) FreeBlock(i);
+            }
+
+            m_Start = 0;
+        }
+
+        /// @brief Returns the spare block to the allocator
+        void ShrinkToFit() {
+            if(m_Spare != NullPointer) {
+                m_Allocator->Free(m_Spare);
+                m_Spare = NullPointer;
+            }
+        }
+
+        /// @brief Inserts an element at specified position in the deque
+        /// @param position The position to insert the element at
+        /// @param value The value to insert
+        /// @return Iterator to the newly inserted element
+        /// @throws `LengthError` if the deque is full
+        /// @details Elements on the shorter side of the position are moved by one
+        Iterator Insert(ConstIterator position, ConstReferenceType value) {
+            ValueType copy(value);
+            return InsertValue(position.m_CurrentIndex, copy);
+        }
+
+        #ifdef __WSTL_CXX11__
+        /// @brief Inserts an element at specified position in the deque
+        /// @param position The position to insert the element at
+        /// @param value The value to insert (rvalue reference)
+        /// @return Iterator to the newly inserted element
+        /// @throws `LengthError` if the deque is full
+        /// @since C++11
+        Iterator Insert(ConstIterator position, ValueType&& value) {
+            return InsertValue(position.m_CurrentIndex, value);
+        }
+
+        /// @brief Emplaces an element at specified position in the deque
+        /// @param position The position to emplace the element at
+        /// @param ...args The arguments to forward to the constructor of the element
+        /// @return Iterator to the newly emplaced element
+        /// @throws `LengthError` if the deque is full
+        /// @since C++11
+        template<typename... Args>
+        Iterator Emplace(ConstIterator position, Args&&... args) {
+            ValueType value(Forward<Args>(args)...);
+            return InsertValue(position.m_CurrentIndex, value);
+        }
+        #endif
+
+        /// @brief Erases an element at specified position in the deque
+        /// @param position The position of the element to erase
+        /// @return Iterator to the element following the erased element
+        /// @throws `OutOfRange` if the position is out of range
+        /// @details Elements on the shorter side of the position are moved by one
+        Iterator Erase(ConstIterator position) {
+            return Erase(position, position + 1);
+        }
+
+        /// @brief Erases a range of elements from the deque
+        /// @param first Iterator to the first element in the range to erase
+        /// @param last Iterator to the element following the last element in the range to erase
+        /// @return Iterator to the first element following the erased range
+        /// @throws `OutOfRange` if the range is out of bounds
+        Iterator Erase(ConstIterator first, ConstIterator last) {
+            const SizeType index = first.m_CurrentIndex;
+            const SizeType count = last.m_CurrentIndex - index;
+
+            __WSTL_ASSERT_RETURNVALUE__(first <= last && last.m_CurrentIndex <= m_CurrentSize,
+                WSTL_MAKE_EXCEPTION(OutOfRange, "Segmented deque range out of bounds"), End());
+
+            if(index < m_CurrentSize - index - count) {
+                // Move the front elements over the range
+                MoveBackward(Begin(), Begin() + index, Begin() + index + count);
+                for(SizeType i = 0; i < count; ++i) DestroyFront();
+            }
+            else {
+                // Move the back elements over the range
+                Move(Begin() + index + count, End(), Begin() + index);
+                for(SizeType i = 0; i < count; ++i) DestroyBack();
+            }
+
+            return Iterator(this, index);
+        }
+
+        /// @brief Pushes an element to the back of the deque
+        /// @param value The value to push to the back
+        /// @throws `LengthError` if the deque is full and `__WSTL_ASSERT_PUSHPOP__` is defined
+        /// @throws `BadAllocation` if a block cannot be drawn from the allocator
+        void PushBack(ConstReferenceType value) {
+            EmplaceBack(value);
+        }
+
+        #ifdef __WSTL_CXX11__
+        /// @brief Pushes an element to the back of the deque
+        /// @param value The value to push to the back (rvalue reference)
+        /// @throws `LengthError` if the deque is full and `__WSTL_ASSERT_PUSHPOP__` is defined
+        /// @throws `BadAllocation` if a block cannot be drawn from the allocator
+        /// @since C++11
+        void PushBack(ValueType&& value) {
+            EmplaceBack(__WSTL_MOVE__(value));
+        }
+
+        /// @brief Emplaces an element at the back of the deque, constructing it in place
+        /// @param ...args The arguments to forward to the constructor of the element
+        /// @throws `LengthError` if the deque is full and `__WSTL_ASSERT_PUSHPOP__` is defined
+        /// @throws `BadAllocation` if a block cannot be drawn from the allocator
+        /// @since C++11
+        template<typename... Args>
+        void EmplaceBack(Args&&... args) {
+            __WSTL_ASSERT_PUSHPOP_RETURN__(!Full(), WSTL_MAKE_EXCEPTION(LengthError, "Segmented deque full"));
+
+            PointerType slot = Acquire(Physical(m_CurrentSize));
+            if(slot == NullPointer) return;
+
+            ::new(slot) ValueType(Forward<Args>(args)...);
+            ++m_CurrentSize;
+        }
+        #else
+        /// @brief Emplaces an element at the back of the deque, constructing it in place
+        /// @throws `LengthError` if the deque is full and `__WSTL_ASSERT_PUSHPOP__` is defined
+        /// @throws `BadAllocation` if a block cannot be drawn from the allocator
+        void EmplaceBack() {
+            __WSTL_ASSERT_PUSHPOP_RETURN__(!Full(), WSTL_MAKE_EXCEPTION(LengthError, "Segmented deque full"));
+
+            PointerType slot = Acquire(Physical(m_CurrentSize));
+            if(slot == NullPointer) return;
+
+            ::new(slot) ValueType();
+            ++m_CurrentSize;
+        }
+
+        /// @brief Emplaces an element at the back of the deque, constructing it in place
+        /// @param arg The argument to pass to the constructor of the element
+        /// @throws `LengthError` if the deque is full and `__WSTL_ASSERT_PUSHPOP__` is defined
+        /// @throws `BadAllocation` if a block cannot be drawn from the allocator
+        template<typename Arg>
+        void EmplaceBack(const Arg& arg) {
+            __WSTL_ASSERT_PUSHPOP_RETURN__(!Full(), WSTL_MAKE_EXCEPTION(LengthError, "Segmented deque full"));
+
+            PointerType slot = Acquire(Physical(m_CurrentSize));
+            if(slot == NullPointer) return;
+
+            ::new(slot) ValueType(arg);
+            ++m_CurrentSize;
+        }
+
+        /// @brief Emplaces an element at the back of the deque, constructing it in place
+        /// @param arg1 The first argument to pass to the constructor of the element
+        /// @param arg2 The second argument to pass to the constructor of the element
+        /// @throws `LengthError` if the deque is full and `__WSTL_ASSERT_PUSHPOP__` is defined
+        /// @throws `BadAllocation` if a block cannot be drawn from the allocator
+        template<typename Arg1, typename Arg2>
+        void EmplaceBack(const Arg1& arg1, const Arg2& arg2) {
+            __WSTL_ASSERT_PUSHPOP_RETURN__(!Full(), WSTL_MAKE_EXCEPTION(LengthError, "Segmented deque full"));
+
+            PointerType slot = Acquire(Physical(m_CurrentSize));
+            if(slot == NullPointer) return;
+
+            ::new(slot) ValueType(arg1, arg2);
+            ++m_CurrentSize;
+        }
+
+        /// @brief Emplaces an element at the back of the deque, constructing it in place
+        /// @param arg1 The first argument to pass to the constructor of the element
+        /// @param arg2 The second argument to pass to the constructor of the element
+        /// @param arg3 The third argument to pass to the constructor of the element
+        /// @throws `LengthError` if the deque is full and `__WSTL_ASSERT_PUSHPOP__` is defined
+        /// @throws `BadAllocation` if a block cannot be drawn from the allocator
+        template<typename Arg1, typename Arg2, typename Arg3>
+        void EmplaceBack(const Arg1& arg1, const Arg2& arg2, const Arg3& arg3) {
+            __WSTL_ASSERT_PUSHPOP_RETURN__(!Full(), WSTL_MAKE_EXCEPTION(LengthError, "Segmented deque full"));
+
+            PointerType slot = Acquire(Physical(m_CurrentSize));
+            if(slot == NullPointer) return;
+
+            ::new(slot) ValueType(arg1, arg2, arg3);
+            ++m_CurrentSize;
+        }
+        #endif
+
+        /// @brief Pops the last element from the deque
+        /// @throws `OutOfRange` if the deque is empty and `__WSTL_ASSERT_PUSHPOP__` is defined
+        void PopBack() {
+            __WSTL_ASSERT_PUSHPOP_RETURN__(!Empty(), WSTL_MAKE_EXCEPTION(OutOfRange, "Segmented deque empty"));
+            DestroyBack();
+        }
+
+        /// @brief Pushes an element to the front of the deque
+        /// @param value The value to push to the front
+        /// @throws `LengthError` if the deque is full and `__WSTL_ASSERT_PUSHPOP__` is defined
+        /// @throws `BadAllocation` if a block cannot be drawn from the allocator
+        void PushFront(ConstReferenceType value) {
+            EmplaceFront(value);
+        }
+
+        #ifdef __WSTL_CXX11__
+        /// @brief Pushes an element to the front of the deque
+        /// @param value The value to push to the front (rvalue reference)
+        /// @throws `LengthError` if the deque is full and `__WSTL_ASSERT_PUSHPOP__` is defined
+        /// @throws `BadAllocation` if a block cannot be drawn from the allocator
+        /// @since C++11
+        void PushFront(ValueType&& value) {
+            EmplaceFront(__WSTL_MOVE__(value));
+        }
+
+        /// @brief Emplaces an element at the front of the deque, constructing it in place
+        /// @param ...args The arguments to forward to the constructor of the element
+        /// @throws `LengthError` if the deque is full and `__WSTL_ASSERT_PUSHPOP__` is defined
+        /// @throws `BadAllocation` if a block cannot be drawn from the allocator
+        /// @since C++11
+        template<typename... Args>
+        void EmplaceFront(Args&&... args) {
+            __WSTL_ASSERT_PUSHPOP_RETURN__(!Full(), WSTL_MAKE_EXCEPTION(LengthError, "Segmented deque full"));
+
+            const SizeType position = Previous(m_Start);
+            PointerType slot = Acquire(position);
+            if(slot == NullPointer) return;
+
+            ::new(slot) ValueType(Forward<Args>(args)...);
+            m_Start = position;
+            ++m_CurrentSize;
+        }
+        #else
+        /// @brief Emplaces an element at the front of the deque, constructing it in place
+        /// @throws `LengthError` if the deque is full and `__WSTL_ASSERT_PUSHPOP__` is defined
+        /// @throws `BadAllocation` if a block cannot be drawn from the allocator
+        void EmplaceFront() {
+            __WSTL_ASSERT_PUSHPOP_RETURN__(!Full(), WSTL_MAKE_EXCEPTION(LengthError, "Segmented deque full"));
+
+            const SizeType position = Previous(m_Start);
+            PointerType slot = Acquire(position);
+            if(slot == NullPointer) return;
+
+            ::new(slot) ValueType();
+            m_Start = position;
+            ++m_CurrentSize;
+        }
+
+        /// @brief Emplaces an element at the front of the deque, constructing it in place
+        /// @param arg The argument to pass to the constructor of the element
+        /// @throws `LengthError` if the deque is full and `__WSTL_ASSERT_PUSHPOP__` is defined
+        /// @throws `BadAllocation` if a block cannot be drawn from the allocator
+        template<typename Arg>
+        void EmplaceFront(const Arg& arg) {
+            __WSTL_ASSERT_PUSHPOP_RETURN__(!Full(), WSTL_MAKE_EXCEPTION(LengthError, "Segmented deque full"));
+
+            const SizeType position = Previous(m_Start);
+            PointerType slot = Acquire(position);
+            if(slot == NullPointer) return;
+
+            ::new(slot) ValueType(arg);
+            m_Start = position;
+            ++m_CurrentSize;
+        }
+
+        /// @brief Emplaces an element at the front of the deque, constructing it in place
+        /// @param arg1 The first argument to pass to the constructor of the element
+        /// @param arg2 The second argument to pass to the constructor of the element
+        /// @throws `LengthError` if the deque is full and `__WSTL_ASSERT_PUSHPOP__` is defined
+        /// @throws `BadAllocation` if a block cannot be drawn from the allocator
+        template<typename Arg1, typename Arg2>
+        void EmplaceFront(const Arg1& arg1, const Arg2& arg2) {
+            __WSTL_ASSERT_PUSHPOP_RETURN__(!Full(), WSTL_MAKE_EXCEPTION(LengthError, "Segmented deque full"));
+
+            const SizeType position = Previous(m_Start);
+            PointerType slot = Acquire(position);
+            if(slot == NullPointer) return;
+
+            ::new(slot) ValueType(arg1, arg2);
+            m_Start = position;
+            ++m_CurrentSize;
+        }
+
+        /// @brief Emplaces an element at the front of the deque, constructing it in place
+        /// @param arg1 The first argument to pass to the constructor of the element
+        /// @param arg2 The second argument to pass to the constructor of the element
+        /// @param arg3 The third argument to pass to the constructor of the element
+        /// @throws `LengthError` if the deque is full and `__WSTL_ASSERT_PUSHPOP__` is defined
+        /// @throws `BadAllocation` if a block cannot be drawn from the allocator
+        template<typename Arg1, typename Arg2, typename Arg3>
+        void EmplaceFront(const Arg1& arg1, const Arg2& arg2, const Arg3& arg3) {
+            __WSTL_ASSERT_PUSHPOP_RETURN__(!Full(), WSTL_MAKE_EXCEPTION(LengthError, "Segmented deque full"));
+
+            const SizeType position = Previous(m_Start);
+            PointerType slot = Acquire(position);
+            if(slot == NullPointer) return;
+
+            ::new(slot) ValueType(arg1, arg2, arg3);
+            m_Start = position;
+            ++m_CurrentSize;
+        }
+        #endif
+
+        /// @brief Pops the first element from the deque
+        /// @throws `OutOfRange` if the deque is empty and `__WSTL_ASSERT_PUSHPOP__` is defined
+        void PopFront() {
+            __WSTL_ASSERT_PUSHPOP_RETURN__(!Empty(), WSTL_MAKE_EXCEPTION(OutOfRange, "Segmented deque empty"));
+            DestroyFront();
+        }
+
+        /// @brief Resizes the deque, appending default-constructed elements or removing elements from the back
+        /// @param count The new size of the deque
+        /// @throws `LengthError` if the count exceeds the capacity
+        void Resize(SizeType count) {
+            __WSTL_ASSERT_RETURN__(count <= Capacity(), WSTL_MAKE_EXCEPTION(LengthError, "Segmented deque full"));
+
+            while(m_CurrentSize > count) DestroyBack();
+            while(m_CurrentSize < count) EmplaceBack();
+        }
+
+        /// @brief Resizes the deque, appending copies of a value or removing elements from the back
+        /// @param count The new size of the deque
+        /// @param value The value to append
+        /// @throws `LengthError` if the count exceeds the capacity
+        void Resize(SizeType count, ConstReferenceType value) {
+            __WSTL_ASSERT_RETURN__(count <= Capacity(), WSTL_MAKE_EXCEPTION(LengthError, "Segmented deque full"));
+
+            while(m_CurrentSize > count) DestroyBack();
+            while(m_CurrentSize < count) EmplaceBack(value);
+        }
+
+    protected:
+        /// @brief Constructor for default-constructible map storage
+        /// @param allocator The allocator to draw blocks from, it must outlive the deque
+        explicit BasicSegmentedDeque(Allocator& allocator) : m_Storage(), m_CurrentSize(0), m_Start(0),
+            m_Allocator(&allocator), m_Spare(NullPointer) {
+            Initialize();
+        }
+
+        /// @brief Constructor with map storage
+        /// @param storage The storage of the block map
+        /// @param allocator The allocator to draw blocks from, it must outlive the deque
+        BasicSegmentedDeque(StorageType storage, Allocator& allocator) : m_Storage(__WSTL_MOVE__(storage)), m_CurrentSize(0),
+            m_Start(0), m_Allocator(&allocator), m_Spare(NullPointer) {
+            Initialize();
+        }
+
+        /// @brief Destroys all elements and returns every block, including the spare one
+        /// @details Variants that own their allocator call it before the allocator is destroyed
+        void Release() {
+            Clear();
+            ShrinkToFit();
+        }
+
+    private:
+        StorageType m_Storage;
+        SizeType m_CurrentSize;
+        SizeType m_Start;
+        Allocator* m_Allocator;
+        PointerType m_Spare;
+
+        /// @brief Deleted copy constructor, variants copy through assignment
+        BasicSegmentedDeque(const BasicSegmentedDeque&) __WSTL_DELETE__;
+
+        /// @brief Clears the block map
+        void Initialize() {
+            for(SizeType i = 0; i < m_Storage.Capacity; ++i) m_Storage.Data[i] = NullPointer;
+        }
+
+        /// @brief Converts a logical index to a slot in the ring
+        SizeType Physical(SizeType index) const {
+            SizeType position = m_Start + index;
+            if(position >= Capacity()) position -= Capacity();
+            return position;
+        }
+
+        /// @brief Gets the slot in the ring before the given one
+        SizeType Previous(SizeType position) const {
+            return (position == 0 ? Capacity() : position) - 1;
+        }
+
+        /// @brief Gets the element storage at a slot of an allocated block
+        PointerType Slot(SizeType position) const {
+            return m_Storage.Data[position / BlockSize] + (position & (BlockSize - 1));
+        }
+
+        /// @brief Gets the number of elements from a slot to the end of its run
+        SizeType RunLength(SizeType physical, SizeType position) const {
+            const SizeType block = BlockSize - (physical & (BlockSize - 1));
+            const SizeType remaining = m_CurrentSize - position;
+            return block < remaining ? block : remaining;
+        }
+
+        /// @brief Gets the element storage at a slot, drawing its block first if needed
+        /// @return Null pointer if the block could not be drawn
+        PointerType Acquire(SizeType position) {
+            PointerType& block = m_Storage.Data[position / BlockSize];
+
+            if(block == NullPointer) {
+                if(m_Spare != NullPointer) {
+                    block = m_Spare;
+                    m_Spare = NullPointer;
+                }
+                else {
+                    block = static_cast<PointerType>(m_Allocator->Allocate(sizeof(ValueType) * BlockSize));
+                    __WSTL_ASSERT_RETURNVALUE__(block != NullPointer, WSTL_MAKE_EXCEPTION(BadAllocation, "Segmented deque block allocation failed"), NullPointer);
+                }
+            }
+
+            return block + (position & (BlockSize - 1));
+        }
+
+        /// @brief Takes a block out of the map, keeping it as the spare or returning it to the allocator
+        void FreeBlock(SizeType block) {
+            if(m_Spare == NullPointer) m_Spare = m_Storage.Data[block];
+            else m_Allocator->Free(m_Storage.Data[block]);
+
+            m_Storage.Data[block] = NullPointer;
+        }
+
+        /// @brief Frees a block that no element lives in any more
+        /// @details Only the blocks of the first and last element can be shared with the removed one
+        void ReleaseIfUnused(SizeType block) {
+            if(m_CurrentSize != 0 && (m_Start / BlockSize == block || Physical(m_CurrentSize - 1) / BlockSize == block)) return;
+            FreeBlock(block);
+        }
+
+        /// @brief Destroys the last element
+        void DestroyBack() {
+            const SizeType position = Physical(m_CurrentSize - 1);
+
+            Slot(position)->~ValueType();
+            --m_CurrentSize;
+            ReleaseIfUnused(position / BlockSize);
+        }
+
+        /// @brief Destroys the first element
+        void DestroyFront() {
+            const SizeType position = m_Start;
+
+            Slot(position)->~ValueType();
+            m_Start = Physical(1);
+            --m_CurrentSize;
+            ReleaseIfUnused(position / BlockSize);
+        }
+
+        /// @brief Inserts a value at a position by moving the shorter side
+        /// @param index The position to insert at
+        /// @param value The value to move in
+        Iterator InsertValue(SizeType index, ValueType& value) {
+            __WSTL_ASSERT_RETURNVALUE__(!Full(), WSTL_MAKE_EXCEPTION(LengthError, "Segmented deque full"), End());
+            __WSTL_ASSERT_RETURNVALUE__(index <= m_CurrentSize, WSTL_MAKE_EXCEPTION(OutOfRange, "Segmented deque index out of range"), End());
+
+            const SizeType size = m_CurrentSize;
+
+            if(index == 0) EmplaceFront(__WSTL_MOVE__(value));
+            else if(index == size) EmplaceBack(__WSTL_MOVE__(value));
+            else if(index < size - index) {
+                // Shift the front elements towards the front
+                EmplaceFront(__WSTL_MOVE__(Front()));
+                if(m_CurrentSize == size) return End();
+
+                Move(Begin() + 2, Begin() + index + 1, Begin() + 1);
+                (*this)[index] = __WSTL_MOVE__(value);
+            }
+            else {
+                // Shift the back elements towards the back
+                EmplaceBack(__WSTL_MOVE__(Back()));
+                if(m_CurrentSize == size) return End();
+
+                MoveBackward(Begin() + index, End() - 2, End() - 1);
+                (*this)[index] = __WSTL_MOVE__(value);
+            }
+
+            return m_CurrentSize == size ? End() : Iterator(this, index);
+        }
+    };
+
+    template<typename T, size_t BlockSize, typename Storage>
+    const __WSTL_CONSTEXPR__ typename BasicSegmentedDeque<T, BlockSize, Storage>::SizeType BasicSegmentedDeque<T, BlockSize, Storage>::SegmentSize;
+
+    // Comparison operators
+
+    template<typename T, size_t BlockSize, typename Storage>
+    inline bool operator==(const BasicSegmentedDeque<T, BlockSize, Storage>& a, const BasicSegmentedDeque<T, BlockSize, Storage>& b) {
+        return (a.Size() == b.Size()) && Equal(a.Begin(), a.End(), b.Begin());
+    }
+
+    template<typename T, size_t BlockSize, typename Storage>
+    inline bool operator!=(const BasicSegmentedDeque<T, BlockSize, Storage>& a, const BasicSegmentedDeque<T, BlockSize, Storage>& b) {
+        return !(a == b);
+    }
+
+    template<typename T, size_t BlockSize, typename Storage>
+    inline bool operator<(const BasicSegmentedDeque<T, BlockSize, Storage>& a, const BasicSegmentedDeque<T, BlockSize, Storage>& b) {
+        return LexicographicalCompare(a.Begin(), a.End(), b.Begin(), b.End());
+    }
+
+    template<typename T, size_t BlockSize, typename Storage>
+    inline bool operator<=(const BasicSegmentedDeque<T, BlockSize, Storage>& a, const BasicSegmentedDeque<T, BlockSize, Storage>& b) {
+        return !(b < a);
+    }
+
+    template<typename T, size_t BlockSize, typename Storage>
+    inline bool operator>(const BasicSegmentedDeque<T, BlockSize, Storage>& a, const BasicSegmentedDeque<T, BlockSize, Storage>& b) {
+        return b < a;
+    }
+
+    template<typename T, size_t BlockSize, typename Storage>
+    inline bool operator>=(const BasicSegmentedDeque<T, BlockSize, Storage>& a, const BasicSegmentedDeque<T, BlockSize, Storage>& b) {
+        return !(a < b);
+    }
+
+    // Segmented deque
+
+    /// @brief Version of segmented deque that draws its blocks from an internal intrusive pool
+    /// @tparam T Type of the elements
+    /// @tparam N Capacity of the deque, rounded up to a whole number of blocks
+    /// @tparam BlockSize Number of elements in a block, a power of two
+    /// @ingroup segmented_deque
+    template<typename T, size_t N, size_t BlockSize = __private::__SegmentedDequeBlockSize<T>::Value>
+    class SegmentedDeque : public BasicSegmentedDeque<T, BlockSize, FixedStorage<T*, (N + BlockSize - 1) / BlockSize> > {
+    private:
+        typedef BasicSegmentedDeque<T, BlockSize, FixedStorage<T*, (N + BlockSize - 1) / BlockSize> > Base;
+
+    public:
+        typedef typename Base::ValueType ValueType;
+        typedef typename Base::SizeType SizeType;
+        typedef typename Base::DifferenceType DifferenceType;
+        typedef typename Base::ReferenceType ReferenceType;
+        typedef typename Base::ConstReferenceType ConstReferenceType;
+        typedef typename Base::PointerType PointerType;
+        typedef typename Base::ConstPointerType ConstPointerType;
+
+        typedef typename Base::StorageType StorageType;
+
+        /// @brief The static size, needed for metaprogramming
+        static const __WSTL_CONSTEXPR__ SizeType StaticSize = (N + BlockSize - 1) / BlockSize * BlockSize;
+
+        /// @brief Default constructor
+        SegmentedDeque() : Base(m_Pool) {}
+
+        /// @brief Destructor
+        ~SegmentedDeque() {
+            this->Release();
+        }
+
+        /// @brief Copy constructor
+        /// @param other The deque to copy from
+        SegmentedDeque(const SegmentedDeque& other) : Base(m_Pool) {
+            this->Assign(other.Begin(), other.End());
+        }
+
+        #ifdef __WSTL_CXX11__
+        /// @brief Move constructor
+        /// @param other The deque to move from
+        /// @since C++11
+        SegmentedDeque(SegmentedDeque&& other) : Base(m_Pool) {
+            this->Assign(MakeMoveIterator(other.Begin()), MakeMoveIterator(other.End()));
+        }
+        #endif
+
+        /// @brief Constructor that initializes the deque with a range of elements
+        /// @param first Iterator to the first element in the range
+        /// @param last Iterator to the element following the last element in the range
+        template<typename InputIterator>
+        SegmentedDeque(InputIterator first, InputIterator last, typename EnableIf<!IsIntegral<InputIterator>::Value, int>::Type = 0) : Base(m_Pool) {
+            this->Assign(first, last);
+        }
+
+        /// @brief Constructor that initializes the deque with a number of default-constructed elements
+        /// @param count The number of elements to create
+        explicit SegmentedDeque(SizeType count) : Base(m_Pool) {
+            this->Resize(count);
+        }
+
+        /// @brief Constructor that initializes the deque with a number of copies of a value
+        /// @param count The number of elements to create
+        /// @param value The value to fill the deque with
+        SegmentedDeque(SizeType count, ConstReferenceType value) : Base(m_Pool) {
+            this->Assign(count, value);
+        }
+
+        #if defined(__WSTL_CXX11__) && !defined(__WSTL_NO_INITIALIZERLIST__)
+        /// @brief Constructor that initializes the deque with an initializer list
+        /// @param list The initializer list to initialize the deque with
+        /// @since C++11
+        SegmentedDeque(InitializerList<ValueType> list) : Base(m_Pool) {
+            this->Assign(list);
+        }
+        #endif
+
+        /// @brief Copy assignment operator
+        /// @param other The deque to copy from
+        SegmentedDeque& operator=(const SegmentedDeque& other) {
+            if(this != &other) this->Assign(other.Begin(), other.End());
+            return *this;
+        }
+
+        #ifdef __WSTL_CXX11__
+        /// @brief Move assignment operator
+        /// @param other The deque to move from
+        /// @since C++11
+        SegmentedDeque& operator=(SegmentedDeque&& other) {
+            if(this != &other) this->Assign(MakeMoveIterator(other.Begin()), MakeMoveIterator(other.End()));
+            return *this;
+        }
+
+        #ifndef __WSTL_NO_INITIALIZERLIST__
+        /// @brief Assignment operator that assigns from an initializer list
+        /// @param list The initializer list to assign from
+        /// @since C++11
+        SegmentedDeque& operator=(InitializerList<ValueType> list) {
+            this->Assign(list);
+            return *this;
+        }
+        #endif
+        #endif
+
+    private:
+        __private::__SegmentedDequeBlockPool<T, BlockSize, (N + BlockSize - 1) / BlockSize> m_Pool;
+    };
+
+    template<typename T, size_t N, size_t BlockSize>
+    const __WSTL_CONSTEXPR__ typename SegmentedDeque<T, N, BlockSize>::SizeType SegmentedDeque<T, N, BlockSize>::StaticSize;
+
+    // Segmented deque external
+
+    namespace external {
+        /// @brief Version of segmented deque that uses an external block map and draws blocks from an allocator
+        /// @tparam T Type of the elements
+        /// @tparam BlockSize Number of elements in a block, a power of two
+        /// @ingroup segmented_deque
+        template<typename T, size_t BlockSize = __private::__SegmentedDequeBlockSize<T>::Value>
+        class SegmentedDeque : public BasicSegmentedDeque<T, BlockSize, ExternalStorage<T*> > {
+        private:
+            typedef BasicSegmentedDeque<T, BlockSize, ExternalStorage<T*> > Base;
+
+        public:
+            typedef typename Base::ValueType ValueType;
+            typedef typename Base::SizeType SizeType;
+            typedef typename Base::DifferenceType DifferenceType;
+            typedef typename Base::ReferenceType ReferenceType;
+            typedef typename Base::ConstReferenceType ConstReferenceType;
+            typedef typename Base::PointerType PointerType;
+            typedef typename Base::ConstPointerType ConstPointerType;
+
+            typedef typename Base::StorageType StorageType;
+
+            /// @brief Constructor
+            /// @param map Pointer to the external block map
+            /// @param blocks Number of entries in the block map, the capacity is `blocks * BlockSize`
+            /// @param allocator The allocator to draw blocks from
+            SegmentedDeque(T** map, SizeType blocks, Allocator& allocator) : Base(StorageType(map, blocks), allocator) {}
+
+            /// @brief Copy constructor that uses an external block map
+            /// @param other The deque to copy from
+            /// @param map Pointer to the external block map
+            /// @param blocks Number of entries in the block map
+            /// @param allocator The allocator to draw blocks from
+            SegmentedDeque(const SegmentedDeque& other, T** map, SizeType blocks, Allocator& allocator) : Base(StorageType(map, blocks), allocator) {
+                this->Assign(other.Begin(), other.End());
+            }
+
+            /// @brief Constructor that initializes the deque with a range of elements
+            /// @param first Iterator to the first element in the range
+            /// @param last Iterator to the element following the last element in the range
+            /// @param map Pointer to the external block map
+            /// @param blocks Number of entries in the block map
+            /// @param allocator The allocator to draw blocks from
+            template<typename InputIterator>
+            SegmentedDeque(InputIterator first, InputIterator last, T** map, SizeType blocks, Allocator& allocator) : Base(StorageType(map, blocks), allocator) {
+                this->Assign(first, last);
+            }
+
+            /// @brief Constructor that initializes the deque with a number of copies of a value
+            /// @param count The number of elements to create
+            /// @param value The value to fill the deque with
+            /// @param map Pointer to the external block map
+            /// @param blocks Number of entries in the block map
+            /// @param allocator The allocator to draw blocks from
+            SegmentedDeque(SizeType count, ConstReferenceType value, T** map, SizeType blocks, Allocator& allocator) : Base(StorageType(map, blocks), allocator) {
+                this->Assign(count, value);
+            }
+
+            #if defined(__WSTL_CXX11__) && !defined(__WSTL_NO_INITIALIZERLIST__)
+            /// @brief Constructor that initializes the deque with an initializer list
+            /// @param list The initializer list to initialize the deque with
+            /// @param map Pointer to the external block map
+            /// @param blocks Number of entries in the block map
+            /// @param allocator The allocator to draw blocks from
+            /// @since C++11
+            SegmentedDeque(InitializerList<ValueType> list, T** map, SizeType blocks, Allocator& allocator) : Base(StorageType(map, blocks), allocator) {
+                this->Assign(list);
+            }
+            #endif
+
+            /// @brief Copy assignment operator
+            /// @param other The deque to copy from
+            SegmentedDeque& operator=(const SegmentedDeque& other) {
+                if(this != &other) this->Assign(other.Begin(), other.End());
+                return *this;
+            }
+
+            #ifdef __WSTL_CXX11__
+            /// @brief Move assignment operator
+            /// @param other The deque to move from
+            /// @since C++11
+            SegmentedDeque& operator=(SegmentedDeque&& other) {
+                if(this != &other) this->Assign(MakeMoveIterator(other.Begin()), MakeMoveIterator(other.End()));
+                return *this;
+            }
+            #endif
+        };
+    }
+
+    namespace allocated {
+        /// @brief Version of segmented deque that draws both its block map and its blocks from an allocator
+        /// @tparam T Type of the elements
+        /// @tparam BlockSize Number of elements in a block, a power of two
+        /// @ingroup segmented_deque
+        template<typename T, size_t BlockSize = __private::__SegmentedDequeBlockSize<T>::Value>
+        class SegmentedDeque : public BasicSegmentedDeque<T, BlockSize, AllocatorStorage<T*> > {
+        private:
+            typedef BasicSegmentedDeque<T, BlockSize, AllocatorStorage<T*> > Base;
+
+        public:
+            typedef typename Base::ValueType ValueType;
+            typedef typename Base::SizeType SizeType;
+            typedef typename Base::DifferenceType DifferenceType;
+            typedef typename Base::ReferenceType ReferenceType;
+            typedef typename Base::ConstReferenceType ConstReferenceType;
+            typedef typename Base::PointerType PointerType;
+            typedef typename Base::ConstPointerType ConstPointerType;
+
+            typedef typename Base::StorageType StorageType;
+
+            /// @brief Constructor
+            /// @param allocator The allocator to draw the map and the blocks from
+            /// @param capacity Capacity of the deque, rounded up to a whole number of blocks
+            SegmentedDeque(Allocator& allocator, SizeType capacity) : Base(StorageType(allocator, Blocks(capacity)), allocator) {}
+
+            /// @brief Copy constructor that draws storage from an allocator
+            /// @param other The deque to copy from
+            /// @param allocator The allocator to draw the map and the blocks from
+            /// @param capacity Capacity of the deque, rounded up to a whole number of blocks
+            SegmentedDeque(const SegmentedDeque& other, Allocator& allocator, SizeType capacity) : Base(StorageType(allocator, Blocks(capacity)), allocator) {
+                this->Assign(other.Begin(), other.End());
+            }
+
+            /// @brief Constructor that initializes the deque with a range of elements
+            /// @param first Iterator to the first element in the range
+            /// @param last Iterator to the element following the last element in the range
+            /// @param allocator The allocator to draw the map and the blocks from
+            /// @param capacity Capacity of the deque, rounded up to a whole number of blocks
+            template<typename InputIterator>
+            SegmentedDeque(InputIterator first, InputIterator last, Allocator& allocator, SizeType capacity,
+                typename EnableIf<!IsIntegral<InputIterator>::Value, int>::Type = 0) : Base(StorageType(allocator, Blocks(capacity)), allocator) {
+                this->Assign(first, last);
+            }
+
+            /// @brief Constructor that initializes the deque with a number of copies of a value
+            /// @param count The number of elements to create
+            /// @param value The value to fill the deque with
+            /// @param allocator The allocator to draw the map and the blocks from
+            /// @param capacity Capacity of the deque, rounded up to a whole number of blocks
+            SegmentedDeque(SizeType count, ConstReferenceType value, Allocator& allocator, SizeType capacity) : Base(StorageType(allocator, Blocks(capacity)), allocator) {
+                this->Assign(count, value);
+            }
+
+            #if defined(__WSTL_CXX11__) && !defined(__WSTL_NO_INITIALIZERLIST__)
+            /// @brief Constructor that initializes the deque with an initializer list
+            /// @param list The initializer list to initialize the deque with
+            /// @param allocator The allocator to draw the map and the blocks from
+            /// @param capacity Capacity of the deque, rounded up to a whole number of blocks
+            /// @since C++11
+            SegmentedDeque(InitializerList<ValueType> list, Allocator& allocator, SizeType capacity) : Base(StorageType(allocator, Blocks(capacity)), allocator) {
+                this->Assign(list);
+            }
+            #endif
+
+            /// @brief Copy assignment operator
+            /// @param other The deque to copy from
+            SegmentedDeque& operator=(const SegmentedDeque& other) {
+                if(this != &other) this->Assign(other.Begin(), other.End());
+                return *this;
+            }
+
+            #ifdef __WSTL_CXX11__
+            /// @brief Move assignment operator
+            /// @param other The deque to move from
+            /// @since C++11
+            SegmentedDeque& operator=(SegmentedDeque&& other) {
+                if(this != &other) this->Assign(MakeMoveIterator(other.Begin()), MakeMoveIterator(other.End()));
+                return *this;
+            }
+            #endif
+
+        private:
+            static SizeType Blocks(SizeType capacity) {
+                return (capacity + BlockSize - 1) / BlockSize;
+            }
+        };
+    }
+}
+
+#endif
\ No newline at end of file
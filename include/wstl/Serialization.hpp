@@ -0,0 +1,537 @@
+// Part of WardenSTL - https://github.com/WardenHD/WardenSTL
+// Copyright (c) 2025 Artem Bezruchko (WardenHD)
+//
+// Licensed under the MIT License. See LICENSE file for details.
+
+#ifndef __WSTL_SERIALIZATION_HPP__
+#define __WSTL_SERIALIZATION_HPP__
+
+#include "private/Platform.hpp"
+#include "TypeTraits.hpp"
+#include "Bit.hpp"
+#include "Byte.hpp"
+#include "Span.hpp"
+#include "Array.hpp"
+#include "Tuple.hpp"
+#include <stddef.h>
+#include <stdint.h>
+
+
+/// @defgroup serialization Serialization
+/// @brief Encoding of values into byte buffers with a fixed byte order
+/// @ingroup utilities
+/// @since C++11
+
+#ifdef __WSTL_CXX11__
+namespace wstl {
+    namespace __private {
+        /// @brief Unsigned integer with the given size, the bits of a serialized scalar
+        template<size_t Size>
+        struct __SerializedWord {};
+
+        template<>
+        struct __SerializedWord<1> { typedef uint8_t Type; };
+
+        template<>
+        struct __SerializedWord<2> { typedef uint16_t Type; };
+
+        template<>
+        struct __SerializedWord<4> { typedef uint32_t Type; };
+
+        template<>
+        struct __SerializedWord<8> { typedef uint64_t Type; };
+
+        template<typename T, bool = IsArray<T>::Value || IsClass<T>::Value>
+        struct __IsSerializedScalar : BoolConstant<(IsArithmetic<T>::Value || IsEnum<T>::Value) &&
+            (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8)> {};
+
+        template<typename T>
+        struct __IsSerializedScalar<T, true> : FalseType {};
+
+        /// @brief Copies a fixed number of bytes, which compilers turn into a single load or store
+        template<size_t Size>
+        inline void __SerializedCopy(void* destination, const void* source) {
+            #if defined(__WSTL_GCC__) || defined(__WSTL_CLANG__)
+            __builtin_memcpy(destination, source, Size);
+            #else
+            for(size_t i = 0; i < Size; ++i) static_cast<unsigned char*>(destination)[i] = static_cast<const unsigned char*>(source)[i];
+            #endif
+        }
+
+        template<Endian Order, typename T>
+        inline void __SerializedStore(Byte* destination, const T& value) {
+            typename __SerializedWord<sizeof(T)>::Type word;
+            __SerializedCopy<sizeof(T)>(&word, &value);
+
+            if(Order != Endian::Native) word = ByteSwap(word);
+            __SerializedCopy<sizeof(T)>(destination, &word);
+        }
+
+        template<Endian Order, typename T>
+        inline void __SerializedLoad(const Byte* source, T& value) {
+            typename __SerializedWord<sizeof(T)>::Type word;
+            __SerializedCopy<sizeof(T)>(&word, source);
+
+            if(Order != Endian::Native) word = ByteSwap(word);
+            __SerializedCopy<sizeof(T)>(&value, &word);
+        }
+
+        /// @brief Longest LEB128 encoding of a 64-bit value
+        static const __WSTL_CONSTEXPR__ size_t __VARINT_MAXIMUM_SIZE = 10;
+    }
+
+    // Serialized size
+
+    /// @brief Gets the number of bytes a value of a type takes when serialized
+    /// @tparam T Type of the value: an arithmetic type or an enumeration of 1, 2, 4 or 8 bytes,
+    /// or an `Array`, built-in array or `Tuple` of such types
+    /// @details The size is known at compile time, so `BinaryWriter::Write` and `BinaryReader::Read`
+    /// check the bounds of the buffer once for all their arguments
+    /// @ingroup serialization
+    template<typename T, typename = void>
+    struct SerializedSize;
+
+    template<typename T>
+    struct SerializedSize<T, EnableIfType<__private::__IsSerializedScalar<T>::Value>> : IntegralConstant<size_t, sizeof(T)> {};
+
+    template<typename T>
+    struct SerializedSize<const T, EnableIfType<!__private::__IsSerializedScalar<T>::Value>> : SerializedSize<T> {};
+
+    template<typename T, size_t N>
+    struct SerializedSize<T[N]> : IntegralConstant<size_t, N * SerializedSize<T>::Value> {};
+
+    template<typename T, size_t N>
+    struct SerializedSize<Array<T, N>> : IntegralConstant<size_t, N * SerializedSize<T>::Value> {};
+
+    template<>
+    struct SerializedSize<Tuple<>> : IntegralConstant<size_t, 0> {};
+
+    template<typename Head, typename... Tail>
+    struct SerializedSize<Tuple<Head, Tail...>> : IntegralConstant<size_t,
+        SerializedSize<RemoveReferenceType<Head>>::Value + SerializedSize<Tuple<Tail...>>::Value> {};
+
+    namespace __private {
+        template<typename... Types>
+        struct __SerializedSizeSum : SerializedSize<Tuple<Types...>> {};
+    }
+
+    #ifdef __WSTL_CXX17__
+    /// @copydoc SerializedSize
+    /// @since C++17
+    template<typename T>
+    inline constexpr size_t SerializedSizeVariable = SerializedSize<T>::Value;
+    #endif
+
+    // Zigzag encoding
+
+    /// @brief Maps a signed integer to an unsigned one so that values close to zero stay small
+    /// @param value The value, 0, -1, 1, -2 become 0, 1, 2, 3
+    /// @ingroup serialization
+    __WSTL_NODISCARD__ __WSTL_CONSTEXPR__ inline uint64_t ZigzagEncode(int64_t value) __WSTL_NOEXCEPT__ {
+        return (uint64_t(value) << 1) ^ (value < 0 ? ~uint64_t(0) : uint64_t(0));
+    }
+
+    /// @brief Reverses `ZigzagEncode`
+    /// @param value The encoded value
+    /// @ingroup serialization
+    __WSTL_NODISCARD__ __WSTL_CONSTEXPR__ inline int64_t ZigzagDecode(uint64_t value) __WSTL_NOEXCEPT__ {
+        return int64_t((value >> 1) ^ (uint64_t(0) - (value & 1)));
+    }
+
+    // Binary writer
+
+    /// @brief Writes values into a byte buffer in a fixed byte order
+    /// @tparam Order Byte order of multi-byte values, and order of packed bits: least significant
+    /// bit first for `Endian::Little` and most significant bit first for `Endian::Big`
+    /// @details Scalars are copied as they are when `Order` is the native order and byte swapped
+    /// otherwise. `Write` checks that all its arguments fit once, using `SerializedSize`, then
+    /// stores them without further checks. Varints use LEB128, signed varints zigzag encoding.
+    /// Bit fields are collected with `WriteBits` and stored once a byte is complete, the first
+    /// byte-wise write after them pads the last byte with zeros. A write that does not fit returns
+    /// `false` and leaves the writer unchanged
+    /// @ingroup serialization
+    ///
+    /// @code
+    /// Array<Byte, 8> frame;
+    /// BinaryWriter<Endian::Big> writer(frame);
+    ///
+    /// writer.WriteBits(mode, 3);
+    /// writer.WriteBits(fault, 1);
+    /// writer.Write(uint16_t(rpm), int16_t(torque), temperature); // one bounds check
+    /// @endcode
+    /// @since C++11
+    template<Endian Order = Endian::Little>
+    class BinaryWriter {
+    public:
+        /// @brief Constructor
+        /// @param buffer Buffer to write into
+        explicit BinaryWriter(Span<Byte> buffer) : m_First(buffer.Data()), m_Current(buffer.Data()),
+            m_Last(buffer.Data() + buffer.Size()), m_Bits(0), m_BitCount(0) {}
+
+        /// @brief Writes values, with one bounds check for all of them
+        /// @param ...values Values to write, types that `SerializedSize` supports
+        /// @return `true` if all the values fit and were written, `false` if none were
+        template<typename... Types>
+        bool Write(const Types&... values) {
+            if(!Reserve(__private::__SerializedSizeSum<Types...>::Value)) return false;
+
+            const int expand[] = { 0, (Put(values), 0)... };
+            (void) expand;
+
+            return true;
+        }
+
+        /// @brief Writes raw bytes
+        /// @param bytes Bytes to write
+        /// @return `true` if the bytes fit and were written
+        bool WriteBytes(Span<const Byte> bytes) {
+            if(!Reserve(bytes.Size())) return false;
+
+            for(size_t i = 0; i < bytes.Size(); ++i) m_Current[i] = bytes[i];
+            m_Current += bytes.Size();
+
+            return true;
+        }
+
+        /// @brief Writes an unsigned integer as a LEB128 varint, 7 bits per byte
+        /// @param value Value to write
+        /// @return `true` if the encoding fit and was written
+        bool WriteVarint(uint64_t value) {
+            size_t size = 1;
+            for(uint64_t rest = value >> 7; rest != 0; rest >>= 7) ++size;
+
+            if(!Reserve(size)) return false;
+
+            for(; value >= 0x80; value >>= 7) *m_Current++ = Byte(value | 0x80);
+            *m_Current++ = Byte(value);
+
+            return true;
+        }
+
+        /// @brief Writes a signed integer as a zigzag encoded LEB128 varint
+        /// @param value Value to write
+        /// @return `true` if the encoding fit and was written
+        bool WriteSignedVarint(int64_t value) {
+            return WriteVarint(ZigzagEncode(value));
+        }
+
+        /// @brief Writes the low bits of a value as a bit field
+        /// @param value Value to take the bits from, higher bits are ignored
+        /// @param count Number of bits, up to 64
+        /// @return `true` if the bytes the field completes fit and were written
+        bool WriteBits(uint64_t value, size_t count) {
+            if(count > 32) {
+                // Keep the accumulator from overflowing, the halves go in field order
+                const size_t high = count - 32;
+
+                if(size_t(m_Last - m_Current) < (m_BitCount + count) / 8) return false;
+                if(Order == Endian::Big) return WriteBits(value >> 32, high) && WriteBits(value, 32);
+                return WriteBits(value, 32) && WriteBits(value >> 32, high);
+            }
+
+            if(size_t(m_Last - m_Current) < (m_BitCount + count) / 8) return false;
+            if(count < 64) value &= (uint64_t(1) << count) - 1;
+
+            if(Order == Endian::Big) {
+                m_Bits = (m_Bits << count) | value;
+                m_BitCount += count;
+
+                for(; m_BitCount >= 8; m_BitCount -= 8) *m_Current++ = Byte(m_Bits >> (m_BitCount - 8));
+            }
+            else {
+                m_Bits |= value << m_BitCount;
+                m_BitCount += count;
+
+                for(; m_BitCount >= 8; m_BitCount -= 8, m_Bits >>= 8) *m_Current++ = Byte(m_Bits);
+            }
+
+            return true;
+        }
+
+        /// @brief Stores the pending bit fields, padding the last byte with zeros
+        /// @return `true` if the byte fit or there were no pending bits
+        bool AlignToByte() {
+            return Reserve(0);
+        }
+
+        /// @brief Gets the number of bytes written, not counting pending bit fields
+        size_t Size() const __WSTL_NOEXCEPT__ {
+            return size_t(m_Current - m_First);
+        }
+
+        /// @brief Gets the number of bytes left in the buffer
+        size_t Remaining() const __WSTL_NOEXCEPT__ {
+            return size_t(m_Last - m_Current);
+        }
+
+        /// @brief Gets the bytes written, not counting pending bit fields
+        Span<Byte> Written() const __WSTL_NOEXCEPT__ {
+            return Span<Byte>(m_First, Size());
+        }
+
+        /// @brief Starts writing at the beginning of the buffer again
+        void Reset() __WSTL_NOEXCEPT__ {
+            m_Current = m_First;
+            m_Bits = 0;
+            m_BitCount = 0;
+        }
+
+    private:
+        Byte* m_First;
+        Byte* m_Current;
+        Byte* m_Last;
+        uint64_t m_Bits;
+        size_t m_BitCount;
+
+        /// Makes room for a byte-wise write, storing pending bits first
+        bool Reserve(size_t size) {
+            const size_t pending = m_BitCount > 0 ? 1 : 0;
+            if(size_t(m_Last - m_Current) < size + pending) return false;
+
+            if(pending != 0) {
+                *m_Current++ = Order == Endian::Big ? Byte(m_Bits << (8 - m_BitCount)) : Byte(m_Bits);
+                m_Bits = 0;
+                m_BitCount = 0;
+            }
+
+            return true;
+        }
+
+        template<typename T>
+        EnableIfType<__private::__IsSerializedScalar<T>::Value> Put(const T& value) {
+            __private::__SerializedStore<Order>(m_Current, value);
+            m_Current += sizeof(T);
+        }
+
+        template<typename T, size_t N>
+        void Put(const T (&values)[N]) {
+            for(size_t i = 0; i < N; ++i) Put(values[i]);
+        }
+
+        template<typename T, size_t N>
+        void Put(const Array<T, N>& values) {
+            for(size_t i = 0; i < N; ++i) Put(values[i]);
+        }
+
+        template<typename... Types>
+        void Put(const Tuple<Types...>& values) {
+            PutTuple(values, MakeIndexSequence<sizeof...(Types)>());
+        }
+
+        template<typename... Types, size_t... Indices>
+        void PutTuple(const Tuple<Types...>& values, IndexSequence<Indices...>) {
+            const int expand[] = { 0, (Put(Get<Indices>(values)), 0)... };
+            (void) expand;
+        }
+    };
+
+    // Binary reader
+
+    /// @brief Reads values from a byte buffer in a fixed byte order
+    /// @tparam Order Byte order of multi-byte values, and order of packed bits, as for `BinaryWriter`
+    /// @details The counterpart of `BinaryWriter`. `Read` checks that all its arguments are in the
+    /// buffer once, then loads them without further checks. The first byte-wise read after bit
+    /// fields skips the rest of their last byte. A read past the end of the buffer, or of a varint
+    /// longer than 64 bits, returns `false` and leaves the reader and the arguments unchanged
+    /// @ingroup serialization
+    ///
+    /// @code
+    /// BinaryReader<Endian::Big> reader(frame);
+    ///
+    /// uint8_t mode, fault;
+    /// uint16_t rpm;
+    /// int16_t torque;
+    /// float temperature;
+    ///
+    /// if(!reader.ReadBits(mode, 3) || !reader.ReadBits(fault, 1) || !reader.Read(rpm, torque, temperature)) return;
+    /// @endcode
+    /// @since C++11
+    template<Endian Order = Endian::Little>
+    class BinaryReader {
+    public:
+        /// @brief Constructor
+        /// @param buffer Buffer to read from
+        explicit BinaryReader(Span<const Byte> buffer) : m_First(buffer.Data()), m_Current(buffer.Data()),
+            m_Last(buffer.Data() + buffer.Size()), m_Bits(0), m_BitCount(0) {}
+
+        /// @brief Reads values, with one bounds check for all of them
+        /// @param ...values Values to read into, types that `SerializedSize` supports
+        /// @return `true` if all the values were in the buffer and were read, `false` if none were
+        template<typename... Types>
+        bool Read(Types&... values) {
+            if(Remaining() < __private::__SerializedSizeSum<Types...>::Value) return false;
+            AlignToByte();
+
+            const int expand[] = { 0, (Take(values), 0)... };
+            (void) expand;
+
+            return true;
+        }
+
+        /// @brief Reads raw bytes
+        /// @param bytes Buffer to read into, filled completely
+        /// @return `true` if the bytes were in the buffer and were read
+        bool ReadBytes(Span<Byte> bytes) {
+            if(Remaining() < bytes.Size()) return false;
+            AlignToByte();
+
+            for(size_t i = 0; i < bytes.Size(); ++i) bytes[i] = m_Current[i];
+            m_Current += bytes.Size();
+
+            return true;
+        }
+
+        /// @brief Skips bytes
+        /// @param count Number of bytes to skip
+        /// @return `true` if the bytes were in the buffer and were skipped
+        bool Skip(size_t count) {
+            if(Remaining() < count) return false;
+
+            AlignToByte();
+            m_Current += count;
+
+            return true;
+        }
+
+        /// @brief Reads an unsigned integer encoded as a LEB128 varint
+        /// @param value Value to read into
+        /// @return `true` if a complete varint of at most 64 bits was read
+        bool ReadVarint(uint64_t& value) {
+            const Byte* current = m_Current;
+            const size_t available = Remaining() < __private::__VARINT_MAXIMUM_SIZE ? Remaining() : __private::__VARINT_MAXIMUM_SIZE;
+            uint64_t result = 0;
+
+            for(size_t i = 0; i < available; ++i) {
+                const uint64_t octet = ToInteger<uint64_t>(*current++);
+
+                // The tenth byte holds the last bit of a 64-bit value
+                if(i == __private::__VARINT_MAXIMUM_SIZE - 1 && octet > 1) return false;
+                result |= (octet & 0x7F) << (7 * i);
+
+                if(octet < 0x80) {
+                    value = result;
+                    m_Current = current;
+                    m_Bits = 0;
+                    m_BitCount = 0;
+
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        /// @brief Reads a signed integer encoded as a zigzag encoded LEB128 varint
+        /// @param value Value to read into
+        /// @return `true` if a complete varint of at most 64 bits was read
+        bool ReadSignedVarint(int64_t& value) {
+            uint64_t encoded;
+            if(!ReadVarint(encoded)) return false;
+
+            value = ZigzagDecode(encoded);
+            return true;
+        }
+
+        /// @brief Reads a bit field
+        /// @param value Value to read into, an unsigned integer wide enough for the field
+        /// @param count Number of bits, up to 64
+        /// @return `true` if the bits were in the buffer and were read
+        template<typename T>
+        EnableIfType<IsIntegral<T>::Value && IsUnsigned<T>::Value, bool> ReadBits(T& value, size_t count) {
+            if(count > m_BitCount && Remaining() < (count - m_BitCount + 7) / 8) return false;
+
+            uint64_t result = 0;
+
+            if(count > 32) {
+                uint64_t low = 0;
+                const size_t high = count - 32;
+
+                if(Order == Endian::Big) {
+                    ReadBits(result, high);
+                    ReadBits(low, 32);
+                    result = (result << 32) | low;
+                }
+                else {
+                    ReadBits(low, 32);
+                    ReadBits(result, high);
+                    result = (result << 32) | low;
+                }
+            }
+            else if(Order == Endian::Big) {
+                for(; m_BitCount < count; m_BitCount += 8) m_Bits = (m_Bits << 8) | ToInteger<uint64_t>(*m_Current++);
+
+                m_BitCount -= count;
+                result = (m_Bits >> m_BitCount) & ((uint64_t(1) << count) - 1);
+            }
+            else {
+                for(; m_BitCount < count; m_BitCount += 8) m_Bits |= ToInteger<uint64_t>(*m_Current++) << m_BitCount;
+
+                result = m_Bits & ((uint64_t(1) << count) - 1);
+                m_Bits >>= count;
+                m_BitCount -= count;
+            }
+
+            value = T(result);
+            return true;
+        }
+
+        /// @brief Skips the rest of the byte the last bit field ended in
+        void AlignToByte() __WSTL_NOEXCEPT__ {
+            m_Bits = 0;
+            m_BitCount = 0;
+        }
+
+        /// @brief Gets the number of bytes read
+        size_t Size() const __WSTL_NOEXCEPT__ {
+            return size_t(m_Current - m_First);
+        }
+
+        /// @brief Gets the number of bytes left in the buffer
+        size_t Remaining() const __WSTL_NOEXCEPT__ {
+            return size_t(m_Last - m_Current);
+        }
+
+        /// @brief Starts reading at the beginning of the buffer again
+        void Reset() __WSTL_NOEXCEPT__ {
+            m_Current = m_First;
+            AlignToByte();
+        }
+
+    private:
+        const Byte* m_First;
+        const Byte* m_Current;
+        const Byte* m_Last;
+        uint64_t m_Bits;
+        size_t m_BitCount;
+
+        template<typename T>
+        EnableIfType<__private::__IsSerializedScalar<T>::Value> Take(T& value) {
+            __private::__SerializedLoad<Order>(m_Current, value);
+            m_Current += sizeof(T);
+        }
+
+        template<typename T, size_t N>
+        void Take(T (&values)[N]) {
+            for(size_t i = 0; i < N; ++i) Take(values[i]);
+        }
+
+        template<typename T, size_t N>
+        void Take(Array<T, N>& values) {
+            for(size_t i = 0; i < N; ++i) Take(values[i]);
+        }
+
+        template<typename... Types>
+        void Take(Tuple<Types...>& values) {
+            TakeTuple(values, MakeIndexSequence<sizeof...(Types)>());
+        }
+
+        template<typename... Types, size_t... Indices>
+        void TakeTuple(Tuple<Types...>& values, IndexSequence<Indices...>) {
+            const int expand[] = { 0, (Take(Get<Indices>(values)), 0)... };
+            (void) expand;
+        }
+    };
+}
+#endif
+
+#endif
@@ -0,0 +1,196 @@
+// Part of WardenSTL - https://github.com/WardenHD/WardenSTL
+// Copyright (c) 2025 Artem Bezruchko (WardenHD)
+//
+// Licensed under the MIT License. See LICENSE file for details.
+
+#ifndef __WSTL_SLABALLOCATOR_HPP__
+#define __WSTL_SLABALLOCATOR_HPP__
+
+#include "Allocator.hpp"
+#include "NullPointer.hpp"
+#include "StaticAssert.hpp"
+#include "Bit.hpp"
+#include "private/Error.hpp"
+#include <stddef.h>
+#include <stdint.h>
+
+
+namespace wstl {
+    namespace __private {
+        template<size_t N>
+        struct __SlabLog2 {
+            static const __WSTL_CONSTEXPR__ size_t Value = 1 + __SlabLog2<N / 2>::Value;
+        };
+
+        template<>
+        struct __SlabLog2<1> {
+            static const __WSTL_CONSTEXPR__ size_t Value = 0;
+        };
+    }
+
+    // Slab allocator
+
+    /// @brief Allocator that serves power-of-two size classes from pages of a user-supplied arena
+    /// @tparam MinimumSize Size of the smallest class, a power of two that fits a pointer
+    /// @tparam MaximumSize Size of the largest class, a power of two
+    /// @tparam PageSize Size of a page, a power of two not smaller than `MaximumSize`
+    /// @details The arena is split into pages that are handed to a size class when it runs out
+    /// of blocks, and a page map at the start of the arena records the class of each page. Every
+    /// class keeps an intrusive free list of released blocks, like `BasicIntrusivePool`, and carves
+    /// new blocks from its current page one at a time, so `Allocate` and `Free` take constant time.
+    /// Blocks carry no header and are aligned to their class size up to `MaximumSize`. Pages are
+    /// never returned from a class, so memory freed in one class cannot be reused by another
+    /// @ingroup allocator
+    template<size_t MinimumSize = 8, size_t MaximumSize = 256, size_t PageSize = 1024>
+    class SlabAllocator : public Allocator {
+    public:
+        WSTL_STATIC_ASSERT(MinimumSize >= sizeof(void*) && (MinimumSize & (MinimumSize - 1)) == 0, "Minimum size must be a power of two that fits a pointer");
+        WSTL_STATIC_ASSERT(MaximumSize >= MinimumSize && (MaximumSize & (MaximumSize - 1)) == 0, "Maximum size must be a power of two not smaller than the minimum size");
+        WSTL_STATIC_ASSERT(PageSize >= MaximumSize && (PageSize & (PageSize - 1)) == 0, "Page size must be a power of two not smaller than the maximum size");
+
+        /// @brief Number of size classes
+        static const __WSTL_CONSTEXPR__ size_t ClassCount = __private::__SlabLog2<MaximumSize>::Value - __private::__SlabLog2<MinimumSize>::Value + 1;
+
+        WSTL_STATIC_ASSERT(ClassCount < 255, "Too many size classes");
+
+        /// @brief Constructor
+        /// @param base The base address of the arena
+        /// @param limit The size of the arena
+        SlabAllocator(void* base, size_t limit) : m_PageMap(reinterpret_cast<uint8_t*>(base)), m_Pages(NullPointer), m_PageCount(0), m_UsedPages(0) {
+            const uintptr_t begin = reinterpret_cast<uintptr_t>(base);
+            size_t count = limit / (PageSize + 1);
+
+            // Shrink until the page map and the aligned pages fit
+            for(; count != 0; --count) {
+                const uintptr_t pages = (begin + count + MaximumSize - 1) & ~uintptr_t(MaximumSize - 1);
+                if(pages + count * PageSize <= begin + limit) {
+                    m_Pages = reinterpret_cast<uint8_t*>(pages);
+                    break;
+                }
+            }
+
+            m_PageCount = count;
+            Reset();
+        }
+
+        /// @copydoc Allocator::Allocate(size_t)
+        /// @details Sizes are rounded up to the next class, zero is treated as the smallest class
+        virtual void* Allocate(size_t size) __WSTL_OVERRIDE__ {
+            const Expected<void*> result = TryAllocate(size);
+
+            if(!result.HasValue()) {
+                __WSTL_ASSERT_RETURNVALUE__(result.Error() != ERROR_CODE_TOO_LARGE, WSTL_MAKE_EXCEPTION(BadAllocation, "SlabAllocator: Allocation exceeds the largest class"), NullPointer);
+                __WSTL_THROW_RETURNVALUE__(WSTL_MAKE_EXCEPTION(BadAllocation, "SlabAllocator: Out of pages"), NullPointer);
+            }
+
+            return *result;
+        }
+
+        /// @copydoc Allocator::TryAllocate(size_t)
+        /// @details Fails with `ERROR_CODE_TOO_LARGE` above the largest class and with
+        /// `ERROR_CODE_OUT_OF_MEMORY` when the class has no free block and no page is left
+        virtual Expected<void*> TryAllocate(size_t size) __WSTL_OVERRIDE__ {
+            const Expected<void*> result = Carve(size);
+            RecordAllocation(size, result.ValueOr(NullPointer));
+
+            return result;
+        }
+
+        /// @copydoc Allocator::Free(void*)
+        /// @details The class is looked up in the page map, null pointers are ignored
+        virtual void Free(void* address) __WSTL_OVERRIDE__ {
+            if(address == NullPointer) return;
+            __WSTL_ASSERT_RETURN__(Owns(address), WSTL_MAKE_EXCEPTION(BadAllocation, "SlabAllocator: Address is not in the arena"));
+
+            Class& sizeClass = m_Classes[m_PageMap[(static_cast<uint8_t*>(address) - m_Pages) / PageSize]];
+            *reinterpret_cast<void**>(address) = sizeClass.FreeList;
+            sizeClass.FreeList = address;
+
+            RecordFree(address);
+        }
+
+        /// @brief Checks whether the address lies in a page handed out by the allocator
+        /// @param address The address to check
+        bool Owns(const void* address) const {
+            const uint8_t* bytes = static_cast<const uint8_t*>(address);
+            return m_Pages != NullPointer && bytes >= m_Pages && bytes < m_Pages + m_UsedPages * PageSize;
+        }
+
+        /// @brief Releases all blocks and pages at once
+        void Reset() {
+            for(size_t i = 0; i < ClassCount; ++i) {
+                m_Classes[i].FreeList = NullPointer;
+                m_Classes[i].Cursor = NullPointer;
+                m_Classes[i].End = NullPointer;
+            }
+
+            m_UsedPages = 0;
+        }
+
+        /// @brief Gets the block size of a class
+        /// @param index Index of the class, from `0` to `ClassCount - 1`
+        static __WSTL_CONSTEXPR__ size_t ClassSize(size_t index) {
+            return MinimumSize << index;
+        }
+
+        /// @brief Gets the index of the class that serves the given size
+        /// @param size Requested size, at most `MaximumSize`
+        static size_t ClassOf(size_t size) {
+            return size <= MinimumSize ? 0 : BitWidth(size - 1) - __private::__SlabLog2<MinimumSize>::Value;
+        }
+
+        /// @brief Gets the number of pages in the arena
+        size_t PageCount() const {
+            return m_PageCount;
+        }
+
+        /// @brief Gets the number of pages not yet handed to a class
+        size_t FreePages() const {
+            return m_PageCount - m_UsedPages;
+        }
+
+    private:
+        struct Class {
+            void* FreeList;
+            uint8_t* Cursor;
+            uint8_t* End;
+        };
+
+        Class m_Classes[ClassCount];
+        uint8_t* m_PageMap;
+        uint8_t* m_Pages;
+        size_t m_PageCount;
+        size_t m_UsedPages;
+
+        Expected<void*> Carve(size_t size) {
+            if(size > MaximumSize) return MakeUnexpected(ERROR_CODE_TOO_LARGE);
+
+            const size_t index = ClassOf(size);
+            Class& sizeClass = m_Classes[index];
+
+            if(sizeClass.FreeList) {
+                void* result = sizeClass.FreeList;
+                sizeClass.FreeList = *reinterpret_cast<void**>(result);
+                return result;
+            }
+
+            if(sizeClass.Cursor == sizeClass.End) {
+                if(m_UsedPages >= m_PageCount) return MakeUnexpected(ERROR_CODE_OUT_OF_MEMORY);
+
+                m_PageMap[m_UsedPages] = static_cast<uint8_t>(index);
+                sizeClass.Cursor = m_Pages + m_UsedPages * PageSize;
+                sizeClass.End = sizeClass.Cursor + PageSize;
+                ++m_UsedPages;
+            }
+
+            void* result = sizeClass.Cursor;
+            sizeClass.Cursor += ClassSize(index);
+            return result;
+        }
+    };
+
+    template<size_t MinimumSize, size_t MaximumSize, size_t PageSize>
+    const __WSTL_CONSTEXPR__ size_t SlabAllocator<MinimumSize, MaximumSize, PageSize>::ClassCount;
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,365 @@
+// Part of WardenSTL - https://github.com/WardenHD/WardenSTL
+// Copyright (c) 2025 Artem Bezruchko (WardenHD)
+//
+// Licensed under the MIT License. See LICENSE file for details.
+
+#ifndef __WSTL_SLIDINGWINDOW_HPP__
+#define __WSTL_SLIDINGWINDOW_HPP__
+
+#include "private/Platform.hpp"
+#include "Iterator.hpp"
+#include "CircularIterator.hpp"
+#include "Functional.hpp"
+#include "StaticAssert.hpp"
+#include <stddef.h>
+
+
+/// @defgroup sliding_window Sliding window
+/// @ingroup statistics
+/// @brief Aggregates over the last `N` values in O(1) amortized time per value
+
+namespace wstl {
+    namespace __private {
+        /// @brief Moves a circular iterator over the storage of one object to the same place in another
+        template<typename T>
+        CircularIterator<T*> __RebaseCircular(const CircularIterator<T*>& iterator, const T* from, T* to, size_t size) {
+            return CircularIterator<T*>(to, to + size, to + (iterator.Current() - from));
+        }
+
+        /// @brief Sliding minimum or maximum kept as a monotonic queue of candidates
+        /// @details A value that is not better than a newer one can never be the answer again,
+        /// so each push drops such values from the back, and the front expires when it leaves the window.
+        /// Every value is pushed and dropped once, which makes both O(1) amortized
+        template<typename T, size_t N, typename Compare>
+        class __MonotonicWindow {
+        public:
+            WSTL_STATIC_ASSERT(N > 0, "Window must not be empty");
+
+            typedef T ValueType;
+            typedef size_t SizeType;
+
+            __MonotonicWindow() : m_Front(m_Candidates, m_Candidates + N), m_Back(m_Candidates, m_Candidates + N),
+                m_Candidate(0), m_Pushed(0), m_Oldest(0), m_Compare() {}
+
+            __MonotonicWindow(const __MonotonicWindow& other) {
+                Assign(other);
+            }
+
+            __MonotonicWindow& operator=(const __MonotonicWindow& other) {
+                if(this != &other) Assign(other);
+                return *this;
+            }
+
+            void PushBack(const T& value) {
+                if(Full()) PopFront();
+
+                while(m_Candidate != 0) {
+                    CircularIterator<Candidate*> last = m_Back;
+                    --last;
+
+                    if(m_Compare(last->Value, value)) break;
+
+                    m_Back = last;
+                    --m_Candidate;
+                }
+
+                m_Back->Value = value;
+                m_Back->Sequence = m_Pushed++;
+                ++m_Back;
+                ++m_Candidate;
+            }
+
+            void PopFront() {
+                if(Empty()) return;
+
+                if(m_Front->Sequence == m_Oldest) {
+                    ++m_Front;
+                    --m_Candidate;
+                }
+
+                ++m_Oldest;
+            }
+
+            void Clear() {
+                m_Front = m_Back = CircularIterator<Candidate*>(m_Candidates, m_Candidates + N);
+                m_Candidate = 0;
+                m_Pushed = m_Oldest = 0;
+            }
+
+            SizeType Size() const {
+                return m_Pushed - m_Oldest;
+            }
+
+            bool Empty() const {
+                return m_Pushed == m_Oldest;
+            }
+
+            bool Full() const {
+                return Size() == N;
+            }
+
+            T Value() const {
+                return Empty() ? T() : m_Front->Value;
+            }
+
+        private:
+            struct Candidate {
+                T Value;
+                SizeType Sequence;
+            };
+
+            Candidate m_Candidates[N];
+            CircularIterator<Candidate*> m_Front;
+            CircularIterator<Candidate*> m_Back;
+            SizeType m_Candidate;
+            SizeType m_Pushed;
+            SizeType m_Oldest;
+            Compare m_Compare;
+
+            void Assign(const __MonotonicWindow& other) {
+                for(SizeType i = 0; i < N; ++i) m_Candidates[i] = other.m_Candidates[i];
+
+                m_Front = __RebaseCircular(other.m_Front, other.m_Candidates, m_Candidates, N);
+                m_Back = __RebaseCircular(other.m_Back, other.m_Candidates, m_Candidates, N);
+                m_Candidate = other.m_Candidate;
+                m_Pushed = other.m_Pushed;
+                m_Oldest = other.m_Oldest;
+                m_Compare = other.m_Compare;
+            }
+        };
+    }
+
+    // Sliding window
+
+    /// @brief Aggregate of the last `N` values under an associative operation
+    /// @tparam T Type of the values
+    /// @tparam N Number of values in the window
+    /// @tparam Operation Associative binary functor, such as `Plus`, `Multiplies` or `BitwiseOr`
+    /// @details Uses the two-stack queue: new values are folded into a running result of the back
+    /// stack, older values sit in a front stack that stores every suffix result. When the front runs
+    /// out, the back is turned into a new front in one pass. Each value is folded twice in total, so
+    /// `PushBack` is O(1) amortized and `Value` is one application of the operation, instead of
+    /// rescanning the window. The operation need not be invertible or commutative, values are combined
+    /// oldest first. Storage is two rings of `N` values walked with `CircularIterator`.
+    /// `Minimum` and `Maximum` select a monotonic queue instead, see the specializations
+    /// @ingroup sliding_window
+    template<typename T, size_t N, typename Operation = Plus<T> >
+    class SlidingWindow {
+    public:
+        WSTL_STATIC_ASSERT(N > 0, "Window must not be empty");
+
+        typedef T ValueType;
+        typedef size_t SizeType;
+        typedef Operation OperationType;
+        typedef BackInsertIterator<SlidingWindow> InsertIterator;
+
+        /// @brief Default constructor, creates an empty window
+        /// @param operation The operation to aggregate with
+        explicit SlidingWindow(const Operation& operation = Operation()) : m_Front(m_Values, m_Values + N),
+            m_Back(m_Values, m_Values + N), m_Size(0), m_FrontSize(0), m_BackResult(), m_Operation(operation) {}
+
+        /// @brief Copy constructor
+        /// @param other The window to copy from
+        SlidingWindow(const SlidingWindow& other) : m_Operation(other.m_Operation) {
+            Assign(other);
+        }
+
+        /// @brief Copy assignment operator
+        /// @param other The window to copy from
+        SlidingWindow& operator=(const SlidingWindow& other) {
+            if(this != &other) {
+                m_Operation = other.m_Operation;
+                Assign(other);
+            }
+
+            return *this;
+        }
+
+        /// @brief Adds a value, dropping the oldest one if the window is full
+        /// @param value The value to add
+        void PushBack(const T& value) {
+            if(m_Size == N) PopFront();
+
+            *m_Back = value;
+            m_BackResult = m_Size == m_FrontSize ? value : m_Operation(m_BackResult, value);
+
+            ++m_Back;
+            ++m_Size;
+        }
+
+        /// @brief Drops the oldest value, does nothing if the window is empty
+        void PopFront() {
+            if(m_Size == 0) return;
+            if(m_FrontSize == 0) Flip();
+
+            ++m_Front;
+            --m_FrontSize;
+            --m_Size;
+        }
+
+        /// @brief Adds the values of a range
+        /// @param first The beginning of the range
+        /// @param last The end of the range
+        template<typename InputIterator>
+        void Append(InputIterator first, InputIterator last) {
+            for(; first != last; ++first) PushBack(*first);
+        }
+
+        /// @brief Removes all values
+        void Clear() {
+            m_Front = m_Back = CircularIterator<T*>(m_Values, m_Values + N);
+            m_Size = m_FrontSize = 0;
+        }
+
+        /// @brief Returns a back insert iterator that pushes the assigned values
+        InsertIterator Inserter() {
+            return InsertIterator(*this);
+        }
+
+        /// @brief Gets the number of values in the window
+        SizeType Size() const {
+            return m_Size;
+        }
+
+        /// @brief Gets the number of values the window holds
+        __WSTL_CONSTEXPR__ SizeType Capacity() const {
+            return N;
+        }
+
+        /// @brief Checks if the window is empty
+        bool Empty() const {
+            return m_Size == 0;
+        }
+
+        /// @brief Checks if the window holds `N` values
+        bool Full() const {
+            return m_Size == N;
+        }
+
+        /// @brief Gets the operation applied to all values in the window, oldest first
+        /// @return The aggregate, a value-initialized `T` if the window is empty
+        T Value() const {
+            if(m_FrontSize == 0) return m_Size == 0 ? T() : m_BackResult;
+
+            const T& front = m_Results[&*m_Front - m_Values];
+            return m_Size == m_FrontSize ? front : m_Operation(front, m_BackResult);
+        }
+
+        /// @brief Gets the oldest value, the window must not be empty
+        const T& Front() const {
+            return *m_Front;
+        }
+
+        /// @brief Gets the newest value, the window must not be empty
+        const T& Back() const {
+            CircularIterator<T*> last = m_Back;
+            return *--last;
+        }
+
+    private:
+        T m_Values[N];
+        T m_Results[N];
+        CircularIterator<T*> m_Front;
+        CircularIterator<T*> m_Back;
+        SizeType m_Size;
+        SizeType m_FrontSize;
+        T m_BackResult;
+        Operation m_Operation;
+
+        /// @brief Turns all values into the front stack, each one storing the result from it to the newest value
+        void Flip() {
+            CircularIterator<T*> i = m_Back;
+            --i;
+
+            T result = *i;
+            m_Results[&*i - m_Values] = result;
+
+            for(SizeType n = 1; n < m_Size; ++n) {
+                --i;
+                result = m_Operation(*i, result);
+                m_Results[&*i - m_Values] = result;
+            }
+
+            m_FrontSize = m_Size;
+        }
+
+        void Assign(const SlidingWindow& other) {
+            for(SizeType i = 0; i < N; ++i) {
+                m_Values[i] = other.m_Values[i];
+                m_Results[i] = other.m_Results[i];
+            }
+
+            m_Front = __private::__RebaseCircular(other.m_Front, other.m_Values, m_Values, N);
+            m_Back = __private::__RebaseCircular(other.m_Back, other.m_Values, m_Values, N);
+            m_Size = other.m_Size;
+            m_FrontSize = other.m_FrontSize;
+            m_BackResult = other.m_BackResult;
+        }
+    };
+
+    /// @brief Minimum of the last `N` values
+    /// @details Keeps a monotonic queue of the values that may still become the minimum, `PushBack`
+    /// is O(1) amortized and `Value` is O(1). The window does not keep the values themselves
+    /// @ingroup sliding_window
+    template<typename T, size_t N>
+    class SlidingWindow<T, N, Minimum<T> > : public __private::__MonotonicWindow<T, N, Less<T> > {
+    public:
+        typedef Minimum<T> OperationType;
+        typedef BackInsertIterator<SlidingWindow> InsertIterator;
+
+        /// @brief Default constructor, creates an empty window
+        SlidingWindow() {}
+
+        /// @brief Adds the values of a range
+        /// @param first The beginning of the range
+        /// @param last The end of the range
+        template<typename InputIterator>
+        void Append(InputIterator first, InputIterator last) {
+            for(; first != last; ++first) this->PushBack(*first);
+        }
+
+        /// @brief Returns a back insert iterator that pushes the assigned values
+        InsertIterator Inserter() {
+            return InsertIterator(*this);
+        }
+
+        /// @brief Gets the number of values the window holds
+        __WSTL_CONSTEXPR__ size_t Capacity() const {
+            return N;
+        }
+    };
+
+    /// @brief Maximum of the last `N` values
+    /// @details Keeps a monotonic queue of the values that may still become the maximum, `PushBack`
+    /// is O(1) amortized and `Value` is O(1). The window does not keep the values themselves
+    /// @ingroup sliding_window
+    template<typename T, size_t N>
+    class SlidingWindow<T, N, Maximum<T> > : public __private::__MonotonicWindow<T, N, Greater<T> > {
+    public:
+        typedef Maximum<T> OperationType;
+        typedef BackInsertIterator<SlidingWindow> InsertIterator;
+
+        /// @brief Default constructor, creates an empty window
+        SlidingWindow() {}
+
+        /// @brief Adds the values of a range
+        /// @param first The beginning of the range
+        /// @param last The end of the range
+        template<typename InputIterator>
+        void Append(InputIterator first, InputIterator last) {
+            for(; first != last; ++first) this->PushBack(*first);
+        }
+
+        /// @brief Returns a back insert iterator that pushes the assigned values
+        InsertIterator Inserter() {
+            return InsertIterator(*this);
+        }
+
+        /// @brief Gets the number of values the window holds
+        __WSTL_CONSTEXPR__ size_t Capacity() const {
+            return N;
+        }
+    };
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,397 @@
+// Part of WardenSTL - https://github.com/WardenHD/WardenSTL
+// Copyright (c) 2025 Artem Bezruchko (WardenHD)
+//
+// Licensed under the MIT License. See LICENSE file for details.
+
+#ifndef __WSTL_SOAARRAY_HPP__
+#define __WSTL_SOAARRAY_HPP__
+
+#include "private/Platform.hpp"
+#include "private/Error.hpp"
+#include "Tuple.hpp"
+#include "Array.hpp"
+#include "Span.hpp"
+#include "Iterator.hpp"
+#include "NullPointer.hpp"
+#include "StandardExceptions.hpp"
+#include <stddef.h>
+
+
+/// @defgroup soa_array SoA array
+/// @brief A fixed size array of records that stores each field in its own contiguous array
+/// @ingroup containers
+/// @since C++11
+
+#ifdef __WSTL_CXX11__
+namespace wstl {
+    namespace __private {
+        /// @brief Random access iterator over the records of a `SoAArray`, by index
+        /// @tparam Container The array, const for constant iterators
+        /// @tparam Reference Proxy reference of the array, a `Tuple` of references
+        template<typename Container, typename Reference>
+        class __SoAIterator : public wstl::Iterator<RandomAccessIteratorTag, typename Container::ValueType, ptrdiff_t, void, Reference> {
+        public:
+            typedef typename Container::ValueType ValueType;
+            typedef RandomAccessIteratorTag IteratorCategory;
+            typedef Reference ReferenceType;
+            typedef void PointerType;
+            typedef ptrdiff_t DifferenceType;
+
+            __WSTL_CONSTEXPR14__ __SoAIterator() : m_Container(NullPointer), m_Index(0) {}
+
+            __WSTL_CONSTEXPR14__ __SoAIterator(Container* container, size_t index) : m_Container(container), m_Index(index) {}
+
+            template<typename UContainer, typename UReference, EnableIfType<IsConvertible<UContainer*, Container*>::Value, int> = 0>
+            __WSTL_CONSTEXPR14__ __SoAIterator(const __SoAIterator<UContainer, UReference>& other) : m_Container(other.m_Container), m_Index(other.m_Index) {}
+
+            __WSTL_CONSTEXPR14__ ReferenceType operator*() const {
+                return (*m_Container)[m_Index];
+            }
+
+            __WSTL_CONSTEXPR14__ ReferenceType operator[](DifferenceType offset) const {
+                return (*m_Container)[m_Index + offset];
+            }
+
+            __WSTL_CONSTEXPR14__ __SoAIterator& operator++() {
+                ++m_Index;
+                return *this;
+            }
+
+            __WSTL_CONSTEXPR14__ __SoAIterator operator++(int) {
+                __SoAIterator original(*this);
+                ++m_Index;
+                return original;
+            }
+
+            __WSTL_CONSTEXPR14__ __SoAIterator& operator--() {
+                --m_Index;
+                return *this;
+            }
+
+            __WSTL_CONSTEXPR14__ __SoAIterator operator--(int) {
+                __SoAIterator original(*this);
+                --m_Index;
+                return original;
+            }
+
+            __WSTL_CONSTEXPR14__ __SoAIterator& operator+=(DifferenceType offset) {
+                m_Index += offset;
+                return *this;
+            }
+
+            __WSTL_CONSTEXPR14__ __SoAIterator& operator-=(DifferenceType offset) {
+                m_Index -= offset;
+                return *this;
+            }
+
+            __WSTL_CONSTEXPR14__ __SoAIterator operator+(DifferenceType offset) const {
+                return __SoAIterator(m_Container, m_Index + offset);
+            }
+
+            __WSTL_CONSTEXPR14__ __SoAIterator operator-(DifferenceType offset) const {
+                return __SoAIterator(m_Container, m_Index - offset);
+            }
+
+            friend __WSTL_CONSTEXPR14__ __SoAIterator operator+(DifferenceType offset, const __SoAIterator& iterator) {
+                return iterator + offset;
+            }
+
+            /// @brief Gets the index of the record the iterator points to
+            __WSTL_CONSTEXPR14__ size_t Index() const {
+                return m_Index;
+            }
+
+            template<typename UContainer, typename UReference>
+            __WSTL_CONSTEXPR14__ DifferenceType operator-(const __SoAIterator<UContainer, UReference>& other) const {
+                return DifferenceType(m_Index) - DifferenceType(other.m_Index);
+            }
+
+            template<typename UContainer, typename UReference>
+            __WSTL_CONSTEXPR14__ bool operator==(const __SoAIterator<UContainer, UReference>& other) const {
+                return m_Index == other.m_Index;
+            }
+
+            template<typename UContainer, typename UReference>
+            __WSTL_CONSTEXPR14__ bool operator!=(const __SoAIterator<UContainer, UReference>& other) const {
+                return m_Index != other.m_Index;
+            }
+
+            template<typename UContainer, typename UReference>
+            __WSTL_CONSTEXPR14__ bool operator<(const __SoAIterator<UContainer, UReference>& other) const {
+                return m_Index < other.m_Index;
+            }
+
+            template<typename UContainer, typename UReference>
+            __WSTL_CONSTEXPR14__ bool operator<=(const __SoAIterator<UContainer, UReference>& other) const {
+                return m_Index <= other.m_Index;
+            }
+
+            template<typename UContainer, typename UReference>
+            __WSTL_CONSTEXPR14__ bool operator>(const __SoAIterator<UContainer, UReference>& other) const {
+                return m_Index > other.m_Index;
+            }
+
+            template<typename UContainer, typename UReference>
+            __WSTL_CONSTEXPR14__ bool operator>=(const __SoAIterator<UContainer, UReference>& other) const {
+                return m_Index >= other.m_Index;
+            }
+
+        private:
+            Container* m_Container;
+            size_t m_Index;
+
+            template<typename, typename>
+            friend class __SoAIterator;
+        };
+    }
+
+    // SoA array
+
+    /// @brief Fixed size array of records whose fields are stored as separate arrays
+    /// @tparam N Number of records
+    /// @tparam ...Types Types of the fields of a record
+    /// @details A structure of arrays: field `I` of all records is one contiguous `Array`, so an
+    /// algorithm that reads one field moves only that field through the cache, and the column can
+    /// be handed to vectorized kernels as a `Span`. Records are read and written through proxy
+    /// references, a `Tuple` of references to the fields, which `Get` and assignment from a `Tuple`
+    /// of values work on. Iterators are random access iterators over these proxies. Algorithms that
+    /// swap elements, such as `Sort`, need real references and do not work on them
+    /// @ingroup soa_array
+    ///
+    /// @code
+    /// SoAArray<256, uint32_t, float, float> tracks; // timestamp, x, y
+    ///
+    /// tracks[0] = MakeTuple(1000u, 0.5f, 1.5f);
+    ///
+    /// Span<uint32_t, 256> timestamps = tracks.Column<0>();
+    /// const uint32_t* late = FindIf(timestamps.Begin(), timestamps.End(), IsLate);
+    /// float x = Get<1>(tracks[late - timestamps.Begin()]);
+    /// @endcode
+    /// @since C++11
+    template<size_t N, typename... Types>
+    class SoAArray {
+    public:
+        WSTL_STATIC_ASSERT(sizeof...(Types) > 0, "Record must have a field");
+
+        typedef Tuple<Types...> ValueType;
+        typedef size_t SizeType;
+        typedef ptrdiff_t DifferenceType;
+        typedef Tuple<Types&...> ReferenceType;
+        typedef Tuple<const Types&...> ConstReferenceType;
+        typedef __private::__SoAIterator<SoAArray, ReferenceType> Iterator;
+        typedef __private::__SoAIterator<const SoAArray, ConstReferenceType> ConstIterator;
+        typedef wstl::ReverseIterator<Iterator> ReverseIterator;
+        typedef wstl::ReverseIterator<ConstIterator> ConstReverseIterator;
+
+        /// @brief Type of the field with the given index
+        template<size_t I>
+        using ColumnType = TupleElementType<I, ValueType>;
+
+        /// @brief The static size, needed for metaprogramming
+        static const __WSTL_CONSTEXPR__ SizeType StaticSize = N;
+
+        /// @brief Number of fields of a record
+        static const __WSTL_CONSTEXPR__ SizeType ColumnCount = sizeof...(Types);
+
+        /// @brief Returns a reference to the record at the specified index with bounds checking
+        /// @param index Index of the record to return
+        /// @return Tuple of references to the fields of the record
+        /// @throws `OutOfRange` if the index is out of range
+        __WSTL_NODISCARD__ __WSTL_CONSTEXPR14__ ReferenceType At(SizeType index) {
+            __WSTL_ASSERT__(index < N, WSTL_MAKE_EXCEPTION(OutOfRange));
+            return (*this)[index];
+        }
+
+        /// @brief Returns a const reference to the record at the specified index with bounds checking
+        /// @param index Index of the record to return
+        /// @return Tuple of const references to the fields of the record
+        /// @throws `OutOfRange` if the index is out of range
+        __WSTL_NODISCARD__ __WSTL_CONSTEXPR14__ ConstReferenceType At(SizeType index) const {
+            __WSTL_ASSERT__(index < N, WSTL_MAKE_EXCEPTION(OutOfRange));
+            return (*this)[index];
+        }
+
+        /// @brief Access operator
+        /// @param index Index of the record to return
+        /// @return Tuple of references to the fields of the record
+        __WSTL_NODISCARD__ __WSTL_CONSTEXPR14__ ReferenceType operator[](SizeType index) {
+            return Record<ReferenceType>(*this, index, MakeIndexSequence<ColumnCount>());
+        }
+
+        /// @brief Access operator
+        /// @param index Index of the record to return
+        /// @return Tuple of const references to the fields of the record
+        __WSTL_NODISCARD__ __WSTL_CONSTEXPR14__ ConstReferenceType operator[](SizeType index) const {
+            return Record<ConstReferenceType>(*this, index, MakeIndexSequence<ColumnCount>());
+        }
+
+        /// @brief Gets reference to the first record
+        __WSTL_NODISCARD__ __WSTL_CONSTEXPR14__ ReferenceType Front() {
+            return (*this)[0];
+        }
+
+        /// @brief Gets const reference to the first record
+        __WSTL_NODISCARD__ __WSTL_CONSTEXPR14__ ConstReferenceType Front() const {
+            return (*this)[0];
+        }
+
+        /// @brief Gets reference to the last record
+        __WSTL_NODISCARD__ __WSTL_CONSTEXPR14__ ReferenceType Back() {
+            return (*this)[N - 1];
+        }
+
+        /// @brief Gets const reference to the last record
+        __WSTL_NODISCARD__ __WSTL_CONSTEXPR14__ ConstReferenceType Back() const {
+            return (*this)[N - 1];
+        }
+
+        /// @brief Gets the field with the given index of all records
+        /// @tparam I Index of the field
+        /// @return Span over the contiguous array of the field
+        template<size_t I>
+        __WSTL_NODISCARD__ __WSTL_CONSTEXPR14__ Span<ColumnType<I>, N> Column() __WSTL_NOEXCEPT__ {
+            return Span<ColumnType<I>, N>(Data<I>(), N);
+        }
+
+        /// @brief Gets the field with the given index of all records
+        /// @tparam I Index of the field
+        /// @return Span over the contiguous array of the field
+        template<size_t I>
+        __WSTL_NODISCARD__ __WSTL_CONSTEXPR14__ Span<const ColumnType<I>, N> Column() const __WSTL_NOEXCEPT__ {
+            return Span<const ColumnType<I>, N>(Data<I>(), N);
+        }
+
+        /// @brief Gets the data pointer of the field with the given index
+        /// @tparam I Index of the field
+        template<size_t I>
+        __WSTL_NODISCARD__ __WSTL_CONSTEXPR14__ ColumnType<I>* Data() __WSTL_NOEXCEPT__ {
+            return Get<I>(m_Columns).Data();
+        }
+
+        /// @brief Gets the const data pointer of the field with the given index
+        /// @tparam I Index of the field
+        template<size_t I>
+        __WSTL_NODISCARD__ __WSTL_CONSTEXPR14__ const ColumnType<I>* Data() const __WSTL_NOEXCEPT__ {
+            return Get<I>(m_Columns).Data();
+        }
+
+        /// @brief Gets the iterator to the beginning of the array
+        __WSTL_NODISCARD__ __WSTL_CONSTEXPR14__ Iterator Begin() __WSTL_NOEXCEPT__ {
+            return Iterator(this, 0);
+        }
+
+        /// @brief Gets the iterator to the beginning of the array
+        __WSTL_NODISCARD__ __WSTL_CONSTEXPR14__ ConstIterator Begin() const __WSTL_NOEXCEPT__ {
+            return ConstIterator(this, 0);
+        }
+
+        /// @brief Gets the const iterator to the beginning of the array
+        __WSTL_NODISCARD__ __WSTL_CONSTEXPR14__ ConstIterator ConstBegin() const __WSTL_NOEXCEPT__ {
+            return ConstIterator(this, 0);
+        }
+
+        /// @brief Gets the iterator to the end of the array
+        __WSTL_NODISCARD__ __WSTL_CONSTEXPR14__ Iterator End() __WSTL_NOEXCEPT__ {
+            return Iterator(this, N);
+        }
+
+        /// @brief Gets the iterator to the end of the array
+        __WSTL_NODISCARD__ __WSTL_CONSTEXPR14__ ConstIterator End() const __WSTL_NOEXCEPT__ {
+            return ConstIterator(this, N);
+        }
+
+        /// @brief Gets the const iterator to the end of the array
+        __WSTL_NODISCARD__ __WSTL_CONSTEXPR14__ ConstIterator ConstEnd() const __WSTL_NOEXCEPT__ {
+            return ConstIterator(this, N);
+        }
+
+        /// @brief Gets the reverse iterator to the beginning of the array
+        __WSTL_NODISCARD__ __WSTL_CONSTEXPR14__ ReverseIterator ReverseBegin() __WSTL_NOEXCEPT__ {
+            return ReverseIterator(End());
+        }
+
+        /// @brief Gets the reverse iterator to the beginning of the array
+        __WSTL_NODISCARD__ __WSTL_CONSTEXPR14__ ConstReverseIterator ReverseBegin() const __WSTL_NOEXCEPT__ {
+            return ConstReverseIterator(End());
+        }
+
+        /// @brief Gets the const reverse iterator to the beginning of the array
+        __WSTL_NODISCARD__ __WSTL_CONSTEXPR14__ ConstReverseIterator ConstReverseBegin() const __WSTL_NOEXCEPT__ {
+            return ConstReverseIterator(End());
+        }
+
+        /// @brief Gets the reverse iterator to the end of the array
+        __WSTL_NODISCARD__ __WSTL_CONSTEXPR14__ ReverseIterator ReverseEnd() __WSTL_NOEXCEPT__ {
+            return ReverseIterator(Begin());
+        }
+
+        /// @brief Gets the reverse iterator to the end of the array
+        __WSTL_NODISCARD__ __WSTL_CONSTEXPR14__ ConstReverseIterator ReverseEnd() const __WSTL_NOEXCEPT__ {
+            return ConstReverseIterator(Begin());
+        }
+
+        /// @brief Gets the const reverse iterator to the end of the array
+        __WSTL_NODISCARD__ __WSTL_CONSTEXPR14__ ConstReverseIterator ConstReverseEnd() const __WSTL_NOEXCEPT__ {
+            return ConstReverseIterator(Begin());
+        }
+
+        /// @brief Checks whether the array is empty
+        __WSTL_NODISCARD__ __WSTL_CONSTEXPR__ bool Empty() const __WSTL_NOEXCEPT__ {
+            return N == 0;
+        }
+
+        /// @brief Gets the number of records
+        __WSTL_NODISCARD__ __WSTL_CONSTEXPR__ SizeType Size() const __WSTL_NOEXCEPT__ {
+            return N;
+        }
+
+        /// @brief Gets the maximum number of records
+        __WSTL_NODISCARD__ __WSTL_CONSTEXPR__ SizeType MaxSize() const __WSTL_NOEXCEPT__ {
+            return N;
+        }
+
+        /// @brief Fills every record with the specified value, one field at a time
+        /// @param value Record to fill with
+        __WSTL_CONSTEXPR14__ void Fill(const ValueType& value) {
+            FillColumns(value, MakeIndexSequence<ColumnCount>());
+        }
+
+        /// @brief Swaps the contents of the array with another array
+        /// @param other Array to swap with
+        __WSTL_CONSTEXPR14__ void Swap(SoAArray& other) {
+            m_Columns.Swap(other.m_Columns);
+        }
+
+    private:
+        Tuple<Array<Types, N>...> m_Columns;
+
+        template<typename Reference, typename Self, size_t... Indices>
+        static __WSTL_CONSTEXPR14__ Reference Record(Self& self, SizeType index, IndexSequence<Indices...>) {
+            return Reference(Get<Indices>(self.m_Columns)[index]...);
+        }
+
+        template<size_t... Indices>
+        __WSTL_CONSTEXPR14__ void FillColumns(const ValueType& value, IndexSequence<Indices...>) {
+            const int expand[] = { (Get<Indices>(m_Columns).Fill(Get<Indices>(value)), 0)... };
+            (void) expand;
+        }
+    };
+
+    template<size_t N, typename... Types>
+    const __WSTL_CONSTEXPR__ typename SoAArray<N, Types...>::SizeType SoAArray<N, Types...>::StaticSize;
+
+    template<size_t N, typename... Types>
+    const __WSTL_CONSTEXPR__ typename SoAArray<N, Types...>::SizeType SoAArray<N, Types...>::ColumnCount;
+
+    /// @brief Swaps the contents of two arrays
+    /// @param a First array
+    /// @param b Second array
+    /// @ingroup soa_array
+    template<size_t N, typename... Types>
+    __WSTL_CONSTEXPR14__ inline void Swap(SoAArray<N, Types...>& a, SoAArray<N, Types...>& b) {
+        a.Swap(b);
+    }
+}
+#endif
+
+#endif
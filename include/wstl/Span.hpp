@@ -15,6 +15,7 @@
 #include "Limits.hpp"
 #include "TypeTraits.hpp"
 #include "Iterator.hpp"
+#include "Algorithm.hpp"
 #include "CircularIterator.hpp"
 #include "Byte.hpp"
 #include "StandardExceptions.hpp"
@@ -682,9 +683,12 @@ namespace wstl {
     // Hash specialization
 
     template<typename T, size_t Extent>
-    struct Hash<Span<T, Extent> > {
-        __WSTL_CONSTEXPR14__ size_t operator()(const Span<T>& view) {
-            return __private::__GenericHash<size_t>(reinterpret_cast<const uint8_t*>(view.Data()), reinterpret_cast<const uint8_t*>(view.Data()) + view.Size());
+    struct Hash<Span<T, Extent> > : __private::__SeededHash {
+        Hash() : __SeededHash(0) {}
+        explicit Hash(size_t seed) : __SeededHash(seed) {}
+
+        size_t operator()(const Span<T, Extent>& view) const {
+            return HashBytes(view.Data(), view.SizeBytes());
         }
     };
 
@@ -729,6 +733,65 @@ namespace wstl {
         WSTL_STATIC_ASSERT(!IsConst<T>::Value, "Span<T> must be of non-const type");
         return Span<Byte, (N == DynamicExtent) ? DynamicExtent : (N * sizeof(T))>(reinterpret_cast<Byte*>(span.Data()), span.SizeBytes());
     }
+
+    // Merge sort with scratch memory
+
+    /// @brief Sorts a range using bottom-up merge sort algorithm and a comparator, with caller-supplied scratch memory
+    /// @param first Iterator to the beginning of the range
+    /// @param last Iterator to the end of the range
+    /// @param buffer Scratch buffer, only the shorter run of each merge is moved into it
+    /// @param compare Binary comparator to use for sorting
+    /// @details With a buffer of at least half of the range size the sort takes O(n log n) time 
+    /// and does not recurse at all. Merges that do not fit into a smaller buffer are done in place
+    /// @ingroup algorithm
+    template<typename RandomAccessIterator, typename T, size_t Extent, typename Compare>
+    __WSTL_CONSTEXPR14__
+    inline void MergeSort(RandomAccessIterator first, RandomAccessIterator last, Span<T, Extent> buffer, Compare compare) {
+        WSTL_STATIC_ASSERT((IsSame<T, typename IteratorTraits<RandomAccessIterator>::ValueType>::Value), "Buffer must hold the value type of the range");
+        __private::__MergeSort(first, last, buffer.Data(), buffer.Size(), compare);
+    }
+
+    /// @brief Sorts a range into ascending order using bottom-up merge sort algorithm, with caller-supplied scratch memory
+    /// @param first Iterator to the beginning of the range
+    /// @param last Iterator to the end of the range
+    /// @param buffer Scratch buffer, only the shorter run of each merge is moved into it
+    /// @details With a buffer of at least half of the range size the sort takes O(n log n) time 
+    /// and does not recurse at all. Merges that do not fit into a smaller buffer are done in place
+    /// @ingroup algorithm
+    template<typename RandomAccessIterator, typename T, size_t Extent>
+    __WSTL_CONSTEXPR14__
+    inline void MergeSort(RandomAccessIterator first, RandomAccessIterator last, Span<T, Extent> buffer) {
+        MergeSort(first, last, buffer, Less<typename IteratorTraits<RandomAccessIterator>::ValueType>());
+    }
+
+    // Stable sort with scratch memory
+
+    /// @brief Sorts a range using a comparator and scratch memory, preserving order between equal elements. 
+    /// Uses merge sort algorithm internally
+    /// @param first Iterator to the beginning of the range
+    /// @param last Iterator to the end of the range
+    /// @param buffer Scratch buffer, half of the range size is enough for O(n log n) time
+    /// @param compare Binary comparator to use for sorting
+    /// @ingroup algorithm
+    /// @see https://en.cppreference.com/w/cpp/algorithm/stable_sort
+    template<typename RandomAccessIterator, typename T, size_t Extent, typename Compare>
+    __WSTL_CONSTEXPR14__
+    inline void StableSort(RandomAccessIterator first, RandomAccessIterator last, Span<T, Extent> buffer, Compare compare) {
+        MergeSort(first, last, buffer, compare);
+    }
+
+    /// @brief Sorts a range into ascending order using scratch memory, preserving order between equal elements. 
+    /// Uses merge sort algorithm internally
+    /// @param first Iterator to the beginning of the range
+    /// @param last Iterator to the end of the range
+    /// @param buffer Scratch buffer, half of the range size is enough for O(n log n) time
+    /// @ingroup algorithm
+    /// @see https://en.cppreference.com/w/cpp/algorithm/stable_sort
+    template<typename RandomAccessIterator, typename T, size_t Extent>
+    __WSTL_CONSTEXPR14__
+    inline void StableSort(RandomAccessIterator first, RandomAccessIterator last, Span<T, Extent> buffer) {
+        MergeSort(first, last, buffer);
+    }
 }
 
 #endif
\ No newline at end of file
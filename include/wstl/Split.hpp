@@ -0,0 +1,352 @@
+// Part of WardenSTL - https://github.com/WardenHD/WardenSTL
+// Copyright (c) 2025 Artem Bezruchko (WardenHD)
+//
+// Licensed under the MIT License. See LICENSE file for details.
+
+#ifndef __WSTL_SPLIT_HPP__
+#define __WSTL_SPLIT_HPP__
+
+#include "private/Platform.hpp"
+#include "TypeTraits.hpp"
+#include "Iterator.hpp"
+#include "NullPointer.hpp"
+#include "Limits.hpp"
+#include "CharacterTraits.hpp"
+#include "StringView.hpp"
+#include "Bitset.hpp"
+#include <stddef.h>
+
+
+/// @defgroup split Split
+/// @ingroup string_view
+/// @brief Lazy splitting of string views into fields without copying
+
+namespace wstl {
+    // Split options
+
+    /// @brief Options of `Split` and `SplitN`
+    /// @ingroup split
+    enum SplitOptions {
+        /// @brief Every delimiter ends a field, so adjacent delimiters produce empty fields
+        SPLIT_KEEP_EMPTY = 0,
+        /// @brief Runs of delimiters count as one and empty fields are not produced, as for whitespace
+        SPLIT_SKIP_EMPTY = 1
+    };
+
+    // Split view
+
+    /// @brief Range of the fields of a string view separated by delimiters
+    /// @tparam T Character type
+    /// @tparam Traits Character traits class
+    /// @details The range is created by `Split`, `SplitN` or `SplitCSV`. Its iterator yields
+    /// `BasicStringView` slices of the original text, nothing is copied or allocated.
+    /// The delimiters are put into a 256-bit table once, when the range is constructed, so
+    /// each character is checked with one table lookup and the whole text is scanned once.
+    /// Wider characters are looked up by their low byte and confirmed against the delimiters,
+    /// which then must outlive the range. Iterators refer to the range, so it must outlive them.
+    /// A non-empty text with `n` delimiters has `n + 1` fields, an empty text has none
+    /// @ingroup split
+    template<typename T, typename Traits = CharacterTraits<T> >
+    class SplitView {
+    public:
+        typedef BasicStringView<T, Traits> ViewType;
+        typedef size_t SizeType;
+
+        /// @brief Forward iterator over the fields
+        class Iterator : public wstl::Iterator<ForwardIteratorTag, ViewType, ptrdiff_t, const ViewType*, const ViewType&> {
+        public:
+            friend class SplitView;
+
+            /// @brief Default constructor, creates an end iterator
+            Iterator() : m_Owner(NullPointer), m_Start(NullPointer), m_Next(NullPointer), m_Field(), m_Count(0), m_Quoted(false) {}
+
+            /// @brief Dereference operator
+            /// @return The current field
+            /// @details If iterator points to the end, behavior is undefined
+            const ViewType& operator*() const {
+                return m_Field;
+            }
+
+            /// @brief Arrow operator
+            /// @details If iterator points to the end, behavior is undefined
+            const ViewType* operator->() const {
+                return &m_Field;
+            }
+
+            /// @brief Pre-increment operator - moves to the next field
+            /// @return Reference to the updated iterator
+            Iterator& operator++() {
+                m_Owner->Next(*this);
+                return *this;
+            }
+
+            /// @brief Post-increment operator - moves to the next field
+            /// @return Copy of the iterator before incrementing
+            Iterator operator++(int) {
+                Iterator original(*this);
+                m_Owner->Next(*this);
+                return original;
+            }
+
+            /// @brief Checks if the current field was enclosed in quotes, only set by `SplitCSV`
+            /// @details The quotes are not part of the field, but doubled quotes inside it are,
+            /// `UnescapeQuotes` collapses them
+            bool Quoted() const {
+                return m_Quoted;
+            }
+
+            /// @brief Gets the zero-based index of the current field
+            SizeType Index() const {
+                return m_Count - 1;
+            }
+
+            friend bool operator==(const Iterator& a, const Iterator& b) {
+                return a.m_Start == b.m_Start;
+            }
+
+            friend bool operator!=(const Iterator& a, const Iterator& b) {
+                return !(a == b);
+            }
+
+        private:
+            const SplitView* m_Owner;
+            const T* m_Start;
+            const T* m_Next;
+            ViewType m_Field;
+            SizeType m_Count;
+            bool m_Quoted;
+        };
+
+        typedef Iterator ConstIterator;
+
+        /// @brief Constructor from a set of delimiters
+        /// @param view Text to split
+        /// @param delimiters Characters that separate the fields
+        /// @param limit Maximum number of fields, the last one holds the rest of the text
+        /// @param options Whether empty fields are produced
+        /// @param quote Character that encloses fields containing delimiters, `0` for none
+        SplitView(const ViewType& view, const ViewType& delimiters, SizeType limit = NumericLimits<SizeType>::Max(),
+            SplitOptions options = SPLIT_KEEP_EMPTY, T quote = T()) : m_View(view), m_Delimiters(delimiters),
+            m_Table(), m_Limit(limit), m_Single(), m_Quote(quote), m_SkipEmpty(options == SPLIT_SKIP_EMPTY) {
+                for(SizeType i = 0; i < delimiters.Size(); ++i) m_Table.Set(Index(delimiters[i]));
+            }
+
+        /// @brief Constructor from a single delimiter
+        /// @param view Text to split
+        /// @param delimiter Character that separates the fields
+        /// @param limit Maximum number of fields, the last one holds the rest of the text
+        /// @param options Whether empty fields are produced
+        /// @param quote Character that encloses fields containing the delimiter, `0` for none
+        SplitView(const ViewType& view, T delimiter, SizeType limit = NumericLimits<SizeType>::Max(),
+            SplitOptions options = SPLIT_KEEP_EMPTY, T quote = T()) : m_View(view), m_Delimiters(),
+            m_Table(), m_Limit(limit), m_Single(delimiter), m_Quote(quote), m_SkipEmpty(options == SPLIT_SKIP_EMPTY) {
+                m_Table.Set(Index(delimiter));
+            }
+
+        /// @brief Gets an iterator to the first field
+        Iterator Begin() const {
+            Iterator iterator;
+            iterator.m_Owner = this;
+
+            if(!m_View.Empty() && m_Limit != 0) {
+                iterator.m_Next = m_View.Data();
+                Next(iterator);
+            }
+
+            return iterator;
+        }
+
+        /// @copydoc Begin
+        Iterator ConstBegin() const {
+            return Begin();
+        }
+
+        /// @brief Gets an iterator past the last field
+        Iterator End() const {
+            Iterator iterator;
+            iterator.m_Owner = this;
+
+            return iterator;
+        }
+
+        /// @copydoc End
+        Iterator ConstEnd() const {
+            return End();
+        }
+
+        /// @brief Checks if there are no fields
+        bool Empty() const {
+            return Begin() == End();
+        }
+
+        /// @brief Checks if a character is one of the delimiters
+        /// @param ch Character to check
+        bool IsDelimiter(T ch) const {
+            if(!m_Table[Index(ch)]) return false;
+            if(sizeof(T) == 1) return true;
+
+            return m_Delimiters.Data() != NullPointer ?
+                Traits::Find(m_Delimiters.Data(), m_Delimiters.Size(), ch) != NullPointer : Traits::Equal(ch, m_Single);
+        }
+
+    private:
+        ViewType m_View;
+        ViewType m_Delimiters;
+        Bitset<256> m_Table;
+        SizeType m_Limit;
+        T m_Single;
+        T m_Quote;
+        bool m_SkipEmpty;
+
+        static SizeType Index(T ch) {
+            return static_cast<SizeType>(ch) & 0xFF;
+        }
+
+        /// @brief Finds the first delimiter at or after `first`
+        const T* FindDelimiter(const T* first, const T* last) const {
+            while(first != last && !IsDelimiter(*first)) ++first;
+            return first;
+        }
+
+        /// @brief Moves an iterator to the field starting at its next position, or to the end
+        void Next(Iterator& iterator) const {
+            const T* first = iterator.m_Next;
+            const T* const last = m_View.Data() + m_View.Size();
+
+            if(first != NullPointer && m_SkipEmpty) {
+                while(first != last && IsDelimiter(*first)) ++first;
+                if(first == last) first = NullPointer;
+            }
+
+            iterator.m_Start = first;
+            iterator.m_Quoted = false;
+            if(first == NullPointer) return;
+
+            ++iterator.m_Count;
+
+            if(iterator.m_Count == m_Limit) {
+                iterator.m_Field = ViewType(first, last - first);
+                iterator.m_Next = NullPointer;
+                return;
+            }
+
+            const T* end;
+            const T* delimiter;
+
+            if(m_Quote != T() && first != last && Traits::Equal(*first, m_Quote)) {
+                // Quoted field, a doubled quote stands for one quote and does not end it
+                end = first + 1;
+
+                for(;;) {
+                    while(end != last && !Traits::Equal(*end, m_Quote)) ++end;
+                    if(end == last || end + 1 == last || !Traits::Equal(end[1], m_Quote)) break;
+                    end += 2;
+                }
+
+                iterator.m_Field = ViewType(first + 1, end - first - 1);
+                iterator.m_Quoted = true;
+                delimiter = end == last ? last : FindDelimiter(end + 1, last);
+            }
+            else {
+                end = FindDelimiter(first, last);
+                iterator.m_Field = ViewType(first, end - first);
+                delimiter = end;
+            }
+
+            iterator.m_Next = delimiter == last ? NullPointer : delimiter + 1;
+        }
+    };
+
+    // Split
+
+    /// @brief Splits a text at any of the delimiters
+    /// @param view Text to split
+    /// @param delimiters Characters that separate the fields
+    /// @param options Whether empty fields are produced
+    /// @return Range of the fields
+    /// @ingroup split
+    template<typename T, typename Traits>
+    inline SplitView<T, Traits> Split(const BasicStringView<T, Traits>& view,
+        const typename TypeIdentity<BasicStringView<T, Traits> >::Type& delimiters, SplitOptions options = SPLIT_KEEP_EMPTY) {
+            return SplitView<T, Traits>(view, delimiters, NumericLimits<size_t>::Max(), options);
+        }
+
+    /// @brief Splits a text at a delimiter
+    /// @param view Text to split
+    /// @param delimiter Character that separates the fields
+    /// @param options Whether empty fields are produced
+    /// @return Range of the fields
+    /// @ingroup split
+    template<typename T, typename Traits>
+    inline SplitView<T, Traits> Split(const BasicStringView<T, Traits>& view, T delimiter, SplitOptions options = SPLIT_KEEP_EMPTY) {
+        return SplitView<T, Traits>(view, delimiter, NumericLimits<size_t>::Max(), options);
+    }
+
+    // Split N
+
+    /// @brief Splits a text at any of the delimiters into at most `count` fields
+    /// @param view Text to split
+    /// @param delimiters Characters that separate the fields
+    /// @param count Maximum number of fields, the last one holds the rest of the text unsplit
+    /// @param options Whether empty fields are produced
+    /// @return Range of the fields
+    /// @ingroup split
+    template<typename T, typename Traits>
+    inline SplitView<T, Traits> SplitN(const BasicStringView<T, Traits>& view,
+        const typename TypeIdentity<BasicStringView<T, Traits> >::Type& delimiters, size_t count, SplitOptions options = SPLIT_KEEP_EMPTY) {
+            return SplitView<T, Traits>(view, delimiters, count, options);
+        }
+
+    /// @brief Splits a text at a delimiter into at most `count` fields
+    /// @param view Text to split
+    /// @param delimiter Character that separates the fields
+    /// @param count Maximum number of fields, the last one holds the rest of the text unsplit
+    /// @param options Whether empty fields are produced
+    /// @return Range of the fields
+    /// @ingroup split
+    template<typename T, typename Traits>
+    inline SplitView<T, Traits> SplitN(const BasicStringView<T, Traits>& view, T delimiter, size_t count, SplitOptions options = SPLIT_KEEP_EMPTY) {
+        return SplitView<T, Traits>(view, delimiter, count, options);
+    }
+
+    // Split CSV
+
+    /// @brief Splits a line of comma-separated values, fields may be enclosed in quotes
+    /// @param view Line to split
+    /// @param delimiter Character that separates the fields (default is `,`)
+    /// @param quote Character that encloses fields (default is `"`)
+    /// @return Range of the fields
+    /// @details A field that starts with a quote ends at the next single quote and may contain
+    /// delimiters, two quotes in a row stand for one quote. The field excludes the enclosing quotes,
+    /// `SplitView::Iterator::Quoted` tells it was quoted and `UnescapeQuotes` collapses doubled quotes.
+    /// Text between the closing quote and the next delimiter is dropped, an unclosed quote runs
+    /// to the end of the line
+    /// @ingroup split
+    template<typename T, typename Traits>
+    inline SplitView<T, Traits> SplitCSV(const BasicStringView<T, Traits>& view, T delimiter = T(','), T quote = T('"')) {
+        return SplitView<T, Traits>(view, delimiter, NumericLimits<size_t>::Max(), SPLIT_KEEP_EMPTY, quote);
+    }
+
+    // Unescape quotes
+
+    /// @brief Copies a quoted field, replacing each doubled quote by one
+    /// @tparam OutputIterator Type of the output iterator
+    /// @param field Field from `SplitCSV` that was enclosed in quotes
+    /// @param output Iterator to write the characters to
+    /// @param quote Character that enclosed the field (default is `"`)
+    /// @return Iterator past the last character written
+    /// @ingroup split
+    template<typename T, typename Traits, typename OutputIterator>
+    OutputIterator UnescapeQuotes(const BasicStringView<T, Traits>& field, OutputIterator output, T quote = T('"')) {
+        for(size_t i = 0; i < field.Size(); ++i) {
+            *output = field[i];
+            ++output;
+
+            if(Traits::Equal(field[i], quote) && i + 1 < field.Size() && Traits::Equal(field[i + 1], quote)) ++i;
+        }
+
+        return output;
+    }
+}
+
+#endif
\ No newline at end of file
@@ -1,23 +1,933 @@
+// Part of WardenSTL - https://github.com/WardenHD/WardenSTL
+// Copyright (c) 2025 Artem Bezruchko (WardenHD)
+//
+// Licensed under the MIT License. See LICENSE file for details.
+
 #ifndef __WSTL_STATISTICS_HPP__
 #define __WSTL_STATISTICS_HPP__
 
 #include "private/Platform.hpp"
+#include "TypeTraits.hpp"
+#include "Iterator.hpp"
+#include "Utility.hpp"
+#include "StaticAssert.hpp"
+#include "Algorithm.hpp"
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __WSTL_MATH_SUPPORT__
+#include <math.h>
+#endif
+
 
+/// @defgroup statistics Statistics
+/// @ingroup numeric
+/// @brief Single-pass accumulators of statistics over streams of values
 
 namespace wstl {
-    /// TODO: Mean
-    /// TODO: Median
+    namespace __private {
+        /// @brief Square root by Newton's method, for types without a library square root such as fixed-point
+        /// @details Starts above the root, where the iteration decreases steadily, and stops once it does not
+        template<typename T>
+        T __StatisticsSquareRoot(T value) {
+            if(!(value > T(0))) return T(0);
+
+            T root = value > T(1) ? value : T(1);
+
+            for(int i = 0; i < 128; ++i) {
+                const T next = (root + value / root) / T(2);
+                if(!(next < root)) break;
+
+                root = next;
+            }
+
+            return root;
+        }
+
+        #ifdef __WSTL_MATH_SUPPORT__
+        inline float __StatisticsSquareRoot(float value) {
+            return value > 0.0f ? sqrtf(value) : 0.0f;
+        }
+
+        inline double __StatisticsSquareRoot(double value) {
+            return value > 0.0 ? sqrt(value) : 0.0;
+        }
+
+        inline long double __StatisticsSquareRoot(long double value) {
+            return value > 0.0L ? sqrtl(value) : 0.0L;
+        }
+        #else
+        /// @brief Square root of a double, the first guess halves the exponent so a few steps are enough
+        inline double __StatisticsSquareRoot(double value) {
+            if(!(value > 0.0) || value != value || value - value != 0.0) return value > 0.0 ? value : 0.0;
+
+            union {
+                double Value;
+                uint64_t Bits;
+            } guess;
+
+            guess.Value = value;
+            guess.Bits = (guess.Bits >> 1) + (uint64_t(1023) << 51);
+
+            double root = guess.Value;
+
+            for(int i = 0; i < 8; ++i) {
+                const double next = 0.5 * (root + value / root);
+                if(next == root) break;
+
+                root = next;
+            }
+
+            return root;
+        }
+
+        inline float __StatisticsSquareRoot(float value) {
+            return static_cast<float>(__StatisticsSquareRoot(static_cast<double>(value)));
+        }
+
+        inline long double __StatisticsSquareRoot(long double value) {
+            if(!(value > 0.0L)) return 0.0L;
+
+            const long double root = __StatisticsSquareRoot(static_cast<double>(value));
+            return root == 0.0L ? root : 0.5L * (root + value / root);
+        }
+        #endif
+    }
+
+    // Running statistics
+
+    /// @brief Accumulates the count, mean, central moments, minimum and maximum of a stream of values
+    /// @tparam T Type used for the values and the accumulators, such as `float`, `double` or a fixed-point
+    /// type with arithmetic and comparison operators and a conversion from integers
+    /// @tparam Moments Highest central moment kept: 1 for the mean, 2 for the variance, 3 for the skewness
+    /// and 4 for the kurtosis. Each one makes `PushBack` a little more expensive
+    /// @details Values are folded in one at a time with Welford's update and the higher-moment
+    /// extension of Pébay, so nothing is buffered and the result does not suffer from the
+    /// cancellation of naive sums of powers. Accumulators filled separately, for example one per core
+    /// or interrupt, can be combined with `Merge`. Like the hashers it has `PushBack` and `Inserter`,
+    /// so `Copy(first, last, statistics.Inserter())` feeds a range
+    /// @ingroup statistics
+    /// @see https://en.wikipedia.org/wiki/Algorithms_for_calculating_variance
+    template<typename T = double, size_t Moments = 4>
+    class RunningStatistics {
+    public:
+        WSTL_STATIC_ASSERT(Moments >= 1 && Moments <= 4, "Moments must be between 1 and 4");
+
+        typedef T ValueType;
+        typedef size_t SizeType;
+        typedef BackInsertIterator<RunningStatistics> InsertIterator;
+
+        /// @brief Default constructor, creates an empty accumulator
+        RunningStatistics() : m_Count(0), m_Mean(0), m_M2(0), m_M3(0), m_M4(0), m_Minimum(0), m_Maximum(0) {}
+
+        /// @brief Adds a value
+        /// @param value The value to add
+        void PushBack(const T& value) {
+            if(m_Count == 0) m_Minimum = m_Maximum = value;
+            else if(value < m_Minimum) m_Minimum = value;
+            else if(m_Maximum < value) m_Maximum = value;
+
+            // Merge of the accumulated values with a single one, whose own moments are zero
+            const T previous = static_cast<T>(m_Count);
+            ++m_Count;
+
+            const T invCount = T(1) / static_cast<T>(m_Count);
+            const T delta = value - m_Mean;
+            const T deltaN = delta * invCount;
+
+            m_Mean = m_Mean + deltaN;
+            if(Moments < 2) return;
+
+            const T term = delta * deltaN * previous;
+            const T fraction = previous * invCount;
+
+            if(Moments >= 4) m_M4 = m_M4 + term * delta * delta * (fraction * fraction - fraction * invCount + invCount * invCount)
+                + T(6) * deltaN * deltaN * m_M2 - T(4) * deltaN * m_M3;
+            if(Moments >= 3) m_M3 = m_M3 + term * delta * (fraction - invCount) - T(3) * deltaN * m_M2;
+
+            m_M2 = m_M2 + term;
+        }
+
+        /// @brief Adds the values of a range
+        /// @param first The beginning of the range
+        /// @param last The end of the range
+        template<typename InputIterator>
+        void Append(InputIterator first, InputIterator last) {
+            for(; first != last; ++first) PushBack(*first);
+        }
+
+        /// @brief Adds the values accumulated by another accumulator
+        /// @param other The accumulator to merge, it is not modified
+        /// @details The result is the same, up to rounding, as if all values had been pushed into one accumulator
+        void Merge(const RunningStatistics& other) {
+            if(other.m_Count == 0) return;
+            if(m_Count == 0) {
+                *this = other;
+                return;
+            }
+
+            if(other.m_Minimum < m_Minimum) m_Minimum = other.m_Minimum;
+            if(m_Maximum < other.m_Maximum) m_Maximum = other.m_Maximum;
+
+            const T countA = static_cast<T>(m_Count);
+            const T total = static_cast<T>(m_Count + other.m_Count);
+            const T fractionA = countA / total;
+            const T fractionB = static_cast<T>(other.m_Count) / total;
+            const T delta = other.m_Mean - m_Mean;
+
+            m_Count += other.m_Count;
+            m_Mean = m_Mean + delta * fractionB;
+            if(Moments < 2) return;
+
+            // Terms are scaled by the fractions of the two counts so that fixed-point types do not overflow
+            const T delta2 = delta * delta;
+            const T term = delta2 * countA * fractionB;
+
+            if(Moments >= 4) m_M4 = m_M4 + other.m_M4 + term * delta2 * (fractionA * fractionA - fractionA * fractionB + fractionB * fractionB)
+                + T(6) * delta2 * (fractionA * fractionA * other.m_M2 + fractionB * fractionB * m_M2)
+                + T(4) * delta * (fractionA * other.m_M3 - fractionB * m_M3);
+            if(Moments >= 3) m_M3 = m_M3 + other.m_M3 + term * delta * (fractionA - fractionB)
+                + T(3) * delta * (fractionA * other.m_M2 - fractionB * m_M2);
+
+            m_M2 = m_M2 + other.m_M2 + term;
+        }
+
+        /// @brief Removes all values
+        void Reset() {
+            *this = RunningStatistics();
+        }
+
+        /// @brief Returns a back insert iterator that pushes the assigned values
+        InsertIterator Inserter() {
+            return InsertIterator(*this);
+        }
+
+        /// @brief Gets the number of values
+        SizeType Count() const {
+            return m_Count;
+        }
+
+        /// @brief Checks if no values were added
+        bool Empty() const {
+            return m_Count == 0;
+        }
+
+        /// @brief Gets the arithmetic mean, zero if empty
+        T Mean() const {
+            return m_Mean;
+        }
+
+        /// @brief Gets the population variance, zero if empty
+        T Variance() const {
+            WSTL_STATIC_ASSERT(Moments >= 2, "Variance requires at least 2 moments");
+            return m_Count == 0 ? T(0) : m_M2 / static_cast<T>(m_Count);
+        }
+
+        /// @brief Gets the unbiased sample variance, zero for less than two values
+        T SampleVariance() const {
+            WSTL_STATIC_ASSERT(Moments >= 2, "Variance requires at least 2 moments");
+            return m_Count < 2 ? T(0) : m_M2 / static_cast<T>(m_Count - 1);
+        }
+
+        /// @brief Gets the population standard deviation, zero if empty
+        T StandardDeviation() const {
+            return __private::__StatisticsSquareRoot(Variance());
+        }
+
+        /// @brief Gets the sample standard deviation, zero for less than two values
+        T SampleStandardDeviation() const {
+            return __private::__StatisticsSquareRoot(SampleVariance());
+        }
+
+        /// @brief Gets the population skewness, zero if the variance is zero
+        T Skewness() const {
+            WSTL_STATIC_ASSERT(Moments >= 3, "Skewness requires at least 3 moments");
+
+            const T variance = Variance();
+            if(!(variance > T(0))) return T(0);
+
+            return m_M3 / static_cast<T>(m_Count) / (variance * __private::__StatisticsSquareRoot(variance));
+        }
+
+        /// @brief Gets the population excess kurtosis, zero for a normal distribution and if the variance is zero
+        T Kurtosis() const {
+            WSTL_STATIC_ASSERT(Moments >= 4, "Kurtosis requires 4 moments");
+
+            const T variance = Variance();
+            if(!(variance > T(0))) return T(0);
+
+            return m_M4 / static_cast<T>(m_Count) / (variance * variance) - T(3);
+        }
+
+        /// @brief Gets the smallest value, zero if empty
+        T Minimum() const {
+            return m_Minimum;
+        }
+
+        /// @brief Gets the largest value, zero if empty
+        T Maximum() const {
+            return m_Maximum;
+        }
+
+        /// @brief Gets the difference between the largest and the smallest value, zero if empty
+        T Range() const {
+            return m_Maximum - m_Minimum;
+        }
+
+    private:
+        SizeType m_Count;
+        T m_Mean;
+        T m_M2;
+        T m_M3;
+        T m_M4;
+        T m_Minimum;
+        T m_Maximum;
+    };
+
+    // Running covariance
+
+    /// @brief Accumulates the means, variances and covariance of a stream of pairs of values
+    /// @tparam T Type used for the values and the accumulators, such as `float`, `double` or a fixed-point type
+    /// @details Uses the paired form of Welford's update, accumulators can be combined with `Merge`.
+    /// `Inserter` accepts `Pair<T, T>`, so two zipped ranges or a range of pairs can be copied into it
+    /// @ingroup statistics
+    /// @see https://en.wikipedia.org/wiki/Algorithms_for_calculating_variance#Covariance
+    template<typename T = double>
+    class RunningCovariance {
+    public:
+        typedef Pair<T, T> ValueType;
+        typedef size_t SizeType;
+        typedef BackInsertIterator<RunningCovariance> InsertIterator;
+
+        /// @brief Default constructor, creates an empty accumulator
+        RunningCovariance() : m_Count(0), m_MeanX(0), m_MeanY(0), m_M2X(0), m_M2Y(0), m_Comoment(0) {}
+
+        /// @brief Adds a pair of values
+        /// @param x The first value
+        /// @param y The second value
+        void PushBack(const T& x, const T& y) {
+            ++m_Count;
+
+            const T invCount = T(1) / static_cast<T>(m_Count);
+            const T deltaX = x - m_MeanX;
+            const T deltaY = y - m_MeanY;
+
+            m_MeanX = m_MeanX + deltaX * invCount;
+            m_MeanY = m_MeanY + deltaY * invCount;
+
+            m_M2X = m_M2X + deltaX * (x - m_MeanX);
+            m_M2Y = m_M2Y + deltaY * (y - m_MeanY);
+            m_Comoment = m_Comoment + deltaX * (y - m_MeanY);
+        }
+
+        /// @brief Adds a pair of values
+        /// @param value The pair, `First` is `x` and `Second` is `y`
+        void PushBack(const ValueType& value) {
+            PushBack(value.First, value.Second);
+        }
+
+        /// @brief Adds the pairs of values of a range
+        /// @param first The beginning of the range
+        /// @param last The end of the range
+        template<typename InputIterator>
+        void Append(InputIterator first, InputIterator last) {
+            for(; first != last; ++first) PushBack(*first);
+        }
+
+        /// @brief Adds the pairs of values of two ranges
+        /// @param firstX The beginning of the range of first values
+        /// @param lastX The end of the range of first values
+        /// @param firstY The beginning of the range of second values, at least as long as the first range
+        template<typename InputIterator1, typename InputIterator2>
+        void Append(InputIterator1 firstX, InputIterator1 lastX, InputIterator2 firstY) {
+            for(; firstX != lastX; ++firstX, ++firstY) PushBack(*firstX, *firstY);
+        }
+
+        /// @brief Adds the pairs accumulated by another accumulator
+        /// @param other The accumulator to merge, it is not modified
+        void Merge(const RunningCovariance& other) {
+            if(other.m_Count == 0) return;
+            if(m_Count == 0) {
+                *this = other;
+                return;
+            }
+
+            const T countA = static_cast<T>(m_Count);
+            const T fractionB = static_cast<T>(other.m_Count) / static_cast<T>(m_Count + other.m_Count);
+            const T deltaX = other.m_MeanX - m_MeanX;
+            const T deltaY = other.m_MeanY - m_MeanY;
+            const T scale = countA * fractionB;
+
+            m_Count += other.m_Count;
+            m_MeanX = m_MeanX + deltaX * fractionB;
+            m_MeanY = m_MeanY + deltaY * fractionB;
+
+            m_M2X = m_M2X + other.m_M2X + deltaX * deltaX * scale;
+            m_M2Y = m_M2Y + other.m_M2Y + deltaY * deltaY * scale;
+            m_Comoment = m_Comoment + other.m_Comoment + deltaX * deltaY * scale;
+        }
+
+        /// @brief Removes all values
+        void Reset() {
+            *this = RunningCovariance();
+        }
+
+        /// @brief Returns a back insert iterator that pushes the assigned pairs
+        InsertIterator Inserter() {
+            return InsertIterator(*this);
+        }
+
+        /// @brief Gets the number of pairs
+        SizeType Count() const {
+            return m_Count;
+        }
+
+        /// @brief Checks if no pairs were added
+        bool Empty() const {
+            return m_Count == 0;
+        }
+
+        /// @brief Gets the mean of the first values
+        T MeanX() const {
+            return m_MeanX;
+        }
+
+        /// @brief Gets the mean of the second values
+        T MeanY() const {
+            return m_MeanY;
+        }
+
+        /// @brief Gets the population variance of the first values
+        T VarianceX() const {
+            return m_Count == 0 ? T(0) : m_M2X / static_cast<T>(m_Count);
+        }
+
+        /// @brief Gets the population variance of the second values
+        T VarianceY() const {
+            return m_Count == 0 ? T(0) : m_M2Y / static_cast<T>(m_Count);
+        }
+
+        /// @brief Gets the population covariance, zero if empty
+        T Covariance() const {
+            return m_Count == 0 ? T(0) : m_Comoment / static_cast<T>(m_Count);
+        }
+
+        /// @brief Gets the unbiased sample covariance, zero for less than two pairs
+        T SampleCovariance() const {
+            return m_Count < 2 ? T(0) : m_Comoment / static_cast<T>(m_Count - 1);
+        }
+
+        /// @brief Gets the Pearson correlation coefficient, zero if either variance is zero
+        T Correlation() const {
+            const T product = m_M2X * m_M2Y;
+            if(!(product > T(0))) return T(0);
+
+            return m_Comoment / __private::__StatisticsSquareRoot(product);
+        }
+
+    private:
+        SizeType m_Count;
+        T m_MeanX;
+        T m_MeanY;
+        T m_M2X;
+        T m_M2Y;
+        T m_Comoment;
+    };
+
+    // P-square quantile
+
+    /// @brief Estimates one quantile of a stream of values with five markers
+    /// @tparam T Type of the values, such as `float`, `double` or a fixed-point type
+    /// @details The P² algorithm of Jain and Chlamtac keeps the minimum, the maximum, the wanted
+    /// quantile and two quantiles halfway to it. Each value moves the marker positions and adjusts
+    /// the heights of the inner markers with a parabolic fit, so insertion is O(1) and the state
+    /// is a few words. The estimate is exact for up to five values and converges as more arrive,
+    /// but two estimators cannot be merged, use `TDigest` for that. Marker positions are kept
+    /// in `double`
+    /// @ingroup statistics
+    /// @see https://www.cse.wustl.edu/~jain/papers/ftp/psqr.pdf
+    template<typename T = double>
+    class P2Quantile {
+    public:
+        typedef T ValueType;
+        typedef size_t SizeType;
+        typedef BackInsertIterator<P2Quantile> InsertIterator;
+
+        /// @brief Constructor
+        /// @param probability The quantile to estimate, between 0 and 1 (default is the median)
+        explicit P2Quantile(double probability = 0.5) : m_Probability(probability), m_Count(0) {
+            for(int i = 0; i < 5; ++i) {
+                m_Heights[i] = T(0);
+                m_Positions[i] = i + 1;
+            }
+
+            m_Increments[0] = 0.0;
+            m_Increments[1] = probability / 2.0;
+            m_Increments[2] = probability;
+            m_Increments[3] = (1.0 + probability) / 2.0;
+            m_Increments[4] = 1.0;
+
+            for(int i = 0; i < 5; ++i) m_Desired[i] = 1.0 + 4.0 * m_Increments[i];
+        }
+
+        /// @brief Adds a value
+        /// @param value The value to add
+        void PushBack(const T& value) {
+            if(m_Count < 5) {
+                // The first values are kept sorted and give the exact answer
+                SizeType i = m_Count++;
+                for(; i > 0 && value < m_Heights[i - 1]; --i) m_Heights[i] = m_Heights[i - 1];
+                m_Heights[i] = value;
+
+                return;
+            }
+
+            ++m_Count;
+
+            int cell;
+            if(value < m_Heights[0]) {
+                m_Heights[0] = value;
+                cell = 0;
+            }
+            else if(!(value < m_Heights[4])) {
+                m_Heights[4] = value;
+                cell = 3;
+            }
+            else for(cell = 0; !(value < m_Heights[cell + 1]); ++cell) {}
+
+            for(int i = cell + 1; i < 5; ++i) ++m_Positions[i];
+            for(int i = 0; i < 5; ++i) m_Desired[i] += m_Increments[i];
+
+            for(int i = 1; i < 4; ++i) {
+                const double offset = m_Desired[i] - static_cast<double>(m_Positions[i]);
+
+                if((offset >= 1.0 && m_Positions[i + 1] - m_Positions[i] > 1) || (offset <= -1.0 && m_Positions[i] - m_Positions[i - 1] > 1)) {
+                    const int step = offset >= 1.0 ? 1 : -1;
+                    const T height = Parabolic(i, step);
+
+                    if(m_Heights[i - 1] < height && height < m_Heights[i + 1]) m_Heights[i] = height;
+                    else m_Heights[i] = Linear(i, step);
+
+                    m_Positions[i] += step;
+                }
+            }
+        }
+
+        /// @brief Adds the values of a range
+        /// @param first The beginning of the range
+        /// @param last The end of the range
+        template<typename InputIterator>
+        void Append(InputIterator first, InputIterator last) {
+            for(; first != last; ++first) PushBack(*first);
+        }
+
+        /// @brief Removes all values, the quantile stays the same
+        void Reset() {
+            *this = P2Quantile(m_Probability);
+        }
+
+        /// @brief Returns a back insert iterator that pushes the assigned values
+        InsertIterator Inserter() {
+            return InsertIterator(*this);
+        }
+
+        /// @brief Gets the number of values
+        SizeType Count() const {
+            return m_Count;
+        }
+
+        /// @brief Gets the estimated quantile
+        double Probability() const {
+            return m_Probability;
+        }
+
+        /// @brief Gets the estimate of the quantile, zero if empty
+        T Value() const {
+            if(m_Count == 0) return T(0);
+            if(m_Count <= 5) return m_Heights[static_cast<SizeType>(m_Probability * static_cast<double>(m_Count - 1) + 0.5)];
+
+            return m_Heights[2];
+        }
+
+        /// @brief Gets the smallest value, zero if empty
+        T Minimum() const {
+            return m_Heights[0];
+        }
+
+        /// @brief Gets the largest value, zero if empty
+        T Maximum() const {
+            return m_Count < 5 ? m_Heights[m_Count == 0 ? 0 : m_Count - 1] : m_Heights[4];
+        }
+
+    private:
+        T m_Heights[5];
+        ptrdiff_t m_Positions[5];
+        double m_Desired[5];
+        double m_Increments[5];
+        double m_Probability;
+        SizeType m_Count;
+
+        T Parabolic(int i, int step) const {
+            const T below = static_cast<T>(m_Positions[i] - m_Positions[i - 1]);
+            const T above = static_cast<T>(m_Positions[i + 1] - m_Positions[i]);
+            const T d = static_cast<T>(step);
+
+            return m_Heights[i] + d / static_cast<T>(m_Positions[i + 1] - m_Positions[i - 1]) *
+                ((below + d) * (m_Heights[i + 1] - m_Heights[i]) / above + (above - d) * (m_Heights[i] - m_Heights[i - 1]) / below);
+        }
+
+        T Linear(int i, int step) const {
+            return m_Heights[i] + static_cast<T>(step) * (m_Heights[i + step] - m_Heights[i]) /
+                static_cast<T>(m_Positions[i + step] - m_Positions[i]);
+        }
+    };
+
+    // T-digest
+
+    namespace __private {
+        /// @brief Sine and cosine of an angle between 0 and pi by their Taylor series
+        inline void __TDigestSineCosine(double angle, double& sine, double& cosine) {
+            const double square = angle * angle;
+            double sineTerm = angle, cosineTerm = 1.0;
+
+            sine = sineTerm;
+            cosine = cosineTerm;
+
+            for(int n = 1; n <= 12; ++n) {
+                sineTerm *= -square / ((2 * n) * (2 * n + 1));
+                cosineTerm *= -square / ((2 * n - 1) * (2 * n));
+
+                sine += sineTerm;
+                cosine += cosineTerm;
+            }
+        }
+    }
+
+    /// @brief Mergeable quantile sketch that keeps a fixed number of weighted centroids
+    /// @tparam T Type of the values, such as `float` or `double`, it must be constructible from `double`
+    /// @tparam Compression Accuracy parameter, the digest keeps at most `Compression + 1` centroids
+    /// @tparam BufferSize Number of values collected before they are merged into the centroids
+    /// @details This is the merging t-digest of Dunning with the arcsine scale function. Values go
+    /// into a buffer in O(1); a full buffer is sorted together with the centroids and neighbours are
+    /// combined while their span stays within one unit of the scale, which makes centroids small near
+    /// the tails. A centroid around quantile `q` holds at most `2 * pi / Compression * sqrt(q * (1 - q))`
+    /// of all values, which bounds the rank error of `Quantile`. All storage is inside the object,
+    /// digests filled separately can be combined with `Merge`. Ranks are computed in `double`
+    /// @ingroup statistics
+    /// @see https://arxiv.org/abs/1902.04023
+    template<typename T = double, size_t Compression = 100, size_t BufferSize = Compression>
+    class TDigest {
+    public:
+        WSTL_STATIC_ASSERT(Compression >= 2, "Compression must be at least 2");
+        WSTL_STATIC_ASSERT(BufferSize > 0, "Buffer must not be empty");
+
+        typedef T ValueType;
+        typedef size_t SizeType;
+        typedef BackInsertIterator<TDigest> InsertIterator;
+
+        /// @brief Default constructor, creates an empty digest
+        TDigest() : m_Size(0), m_Merged(0), m_Count(0), m_Minimum(0), m_Maximum(0) {}
+
+        /// @brief Adds a value
+        /// @param value The value to add
+        void PushBack(const T& value) {
+            Add(value, 1);
+        }
+
+        /// @brief Adds a value that occurred several times
+        /// @param value The value to add
+        /// @param weight The number of occurrences
+        void PushBack(const T& value, SizeType weight) {
+            if(weight != 0) Add(value, weight);
+        }
+
+        /// @brief Adds the values of a range
+        /// @param first The beginning of the range
+        /// @param last The end of the range
+        template<typename InputIterator>
+        void Append(InputIterator first, InputIterator last) {
+            for(; first != last; ++first) PushBack(*first);
+        }
+
+        /// @brief Adds the values summarized by another digest
+        /// @param other The digest to merge, it is not modified
+        void Merge(const TDigest& other) {
+            if(other.m_Count == 0) return;
+
+            // Adding to itself would read the centroids while they grow and get compressed
+            if(&other == this) {
+                for(SizeType i = 0; i < m_Size; ++i) m_Centroids[i].Weight *= 2;
+                m_Count *= 2;
+                return;
+            }
+
+            const T minimum = m_Count == 0 || other.m_Minimum < m_Minimum ? other.m_Minimum : m_Minimum;
+            const T maximum = m_Count == 0 || m_Maximum < other.m_Maximum ? other.m_Maximum : m_Maximum;
+
+            for(SizeType i = 0; i < other.m_Size; ++i) Add(other.m_Centroids[i].Mean, other.m_Centroids[i].Weight);
+
+            m_Minimum = minimum;
+            m_Maximum = maximum;
+        }
+
+        /// @brief Removes all values
+        void Reset() {
+            m_Size = m_Merged = m_Count = 0;
+            m_Minimum = m_Maximum = T(0);
+        }
+
+        /// @brief Returns a back insert iterator that pushes the assigned values
+        InsertIterator Inserter() {
+            return InsertIterator(*this);
+        }
+
+        /// @brief Gets the number of values
+        SizeType Count() const {
+            return m_Count;
+        }
+
+        /// @brief Checks if no values were added
+        bool Empty() const {
+            return m_Count == 0;
+        }
+
+        /// @brief Gets the smallest value, zero if empty
+        T Minimum() const {
+            return m_Minimum;
+        }
+
+        /// @brief Gets the largest value, zero if empty
+        T Maximum() const {
+            return m_Maximum;
+        }
+
+        /// @brief Merges the buffered values into the centroids
+        /// @details Called automatically when the buffer is full and before queries
+        void Compress() {
+            if(m_Merged == m_Size) return;
+
+            Sort(m_Centroids, m_Centroids + m_Size, CompareMeans);
+
+            double sine, cosine;
+            __private::__TDigestSineCosine(6.283185307179586 / static_cast<double>(Compression), sine, cosine);
+
+            const double total = static_cast<double>(m_Count);
+            SizeType output = 0;
+            SizeType before = 0;
+            Centroid current = m_Centroids[0];
+            double limit = Limit(0.0, sine, cosine);
+
+            for(SizeType i = 1; i < m_Size; ++i) {
+                const SizeType weight = current.Weight + m_Centroids[i].Weight;
+
+                // The guard on the output keeps the centroid count bounded even under rounding
+                if(static_cast<double>(before + weight) / total <= limit || output == Compression) {
+                    current.Mean = current.Mean + static_cast<T>(static_cast<double>(m_Centroids[i].Weight) / static_cast<double>(weight)) *
+                        (m_Centroids[i].Mean - current.Mean);
+                    current.Weight = weight;
+                }
+                else {
+                    m_Centroids[output++] = current;
+                    before += current.Weight;
+                    limit = Limit(static_cast<double>(before) / total, sine, cosine);
+                    current = m_Centroids[i];
+                }
+            }
+
+            m_Centroids[output++] = current;
+            m_Size = m_Merged = output;
+        }
+
+        /// @brief Estimates a quantile
+        /// @param probability The quantile, between 0 and 1
+        /// @return The estimate, zero if empty
+        /// @details Interpolates linearly between the centers of neighbouring centroids, the minimum and the maximum
+        T Quantile(double probability) {
+            if(m_Count == 0) return T(0);
+
+            Compress();
+
+            const double total = static_cast<double>(m_Count);
+            const double index = (probability < 0.0 ? 0.0 : probability > 1.0 ? 1.0 : probability) * total;
+
+            double previousPosition = 0.0;
+            T previousValue = m_Minimum;
+            double before = 0.0;
+
+            for(SizeType i = 0; i < m_Size; ++i) {
+                const double weight = static_cast<double>(m_Centroids[i].Weight);
+                const double position = before + weight / 2.0;
+
+                if(index < position) return Interpolate(previousValue, m_Centroids[i].Mean, (index - previousPosition) / (position - previousPosition));
+
+                previousPosition = position;
+                previousValue = m_Centroids[i].Mean;
+                before += weight;
+            }
+
+            return total > previousPosition ? Interpolate(previousValue, m_Maximum, (index - previousPosition) / (total - previousPosition)) : m_Maximum;
+        }
+
+        /// @brief Estimates the median
+        T Median() {
+            return Quantile(0.5);
+        }
+
+        /// @brief Estimates the difference between the third and the first quartile
+        T InterquartileRange() {
+            return Quantile(0.75) - Quantile(0.25);
+        }
+
+    private:
+        struct Centroid {
+            T Mean;
+            SizeType Weight;
+        };
+
+        static const SizeType Capacity = Compression + 1 + BufferSize;
+
+        Centroid m_Centroids[Capacity];
+        SizeType m_Size;
+        SizeType m_Merged;
+        SizeType m_Count;
+        T m_Minimum;
+        T m_Maximum;
+
+        static bool CompareMeans(const Centroid& a, const Centroid& b) {
+            return a.Mean < b.Mean;
+        }
+
+        static T Interpolate(const T& a, const T& b, double fraction) {
+            return a + static_cast<T>(fraction) * (b - a);
+        }
+
+        /// @brief Gets the largest quantile a centroid starting at `quantile` may reach,
+        /// one unit further on the scale `Compression / (2 * pi) * asin(2 * q - 1)`
+        static double Limit(double quantile, double sine, double cosine) {
+            const double x = 2.0 * quantile - 1.0;
+            if(x >= cosine) return 1.0;
+
+            return (x * cosine + 2.0 * __private::__StatisticsSquareRoot(quantile * (1.0 - quantile)) * sine + 1.0) / 2.0;
+        }
+
+        void Add(const T& value, SizeType weight) {
+            if(m_Count == 0) m_Minimum = m_Maximum = value;
+            else if(value < m_Minimum) m_Minimum = value;
+            else if(m_Maximum < value) m_Maximum = value;
+
+            if(m_Size == Capacity) Compress();
+
+            m_Centroids[m_Size].Mean = value;
+            m_Centroids[m_Size].Weight = weight;
+            ++m_Size;
+            m_Count += weight;
+        }
+    };
+
+    template<typename T, size_t Compression, size_t BufferSize>
+    const size_t TDigest<T, Compression, BufferSize>::Capacity;
+
+    // Sliding median
+
+    /// @brief Exact median and quantiles of the last `N` values
+    /// @tparam T Type of the values
+    /// @tparam N Number of values in the window
+    /// @details The window is a ring buffer, a query copies it into a scratch array inside the object
+    /// and selects the order statistics with `NthElement`, so it costs O(N) time and no allocation.
+    /// Suited to small windows where an exact answer is needed, `TDigest` summarizes long streams
+    /// @ingroup statistics
+    template<typename T, size_t N>
+    class SlidingMedian {
+    public:
+        WSTL_STATIC_ASSERT(N > 0, "Window must not be empty");
+
+        typedef T ValueType;
+        typedef size_t SizeType;
+        typedef BackInsertIterator<SlidingMedian> InsertIterator;
+
+        /// @brief Default constructor, creates an empty window
+        SlidingMedian() : m_Window(), m_Scratch(), m_Start(0), m_Size(0) {}
+
+        /// @brief Adds a value, dropping the oldest one if the window is full
+        /// @param value The value to add
+        void PushBack(const T& value) {
+            if(m_Size < N) m_Window[(m_Start + m_Size++) % N] = value;
+            else {
+                m_Window[m_Start] = value;
+                m_Start = (m_Start + 1) % N;
+            }
+        }
+
+        /// @brief Adds the values of a range
+        /// @param first The beginning of the range
+        /// @param last The end of the range
+        template<typename InputIterator>
+        void Append(InputIterator first, InputIterator last) {
+            for(; first != last; ++first) PushBack(*first);
+        }
+
+        /// @brief Removes all values
+        void Reset() {
+            m_Start = 0;
+            m_Size = 0;
+        }
+
+        /// @brief Returns a back insert iterator that pushes the assigned values
+        InsertIterator Inserter() {
+            return InsertIterator(*this);
+        }
+
+        /// @brief Gets the number of values in the window
+        SizeType Count() const {
+            return m_Size;
+        }
+
+        /// @brief Gets a value in the window
+        /// @param index Index of the value, 0 is the oldest
+        const T& At(SizeType index) const {
+            return m_Window[(m_Start + index) % N];
+        }
+
+        /// @brief Computes a quantile of the window
+        /// @param probability The quantile, between 0 and 1
+        /// @return The quantile interpolated between the two closest values, zero if empty
+        T Quantile(double probability) {
+            const SizeType size = m_Size;
+            if(size == 0) return T(0);
+
+            const double position = (probability < 0.0 ? 0.0 : probability > 1.0 ? 1.0 : probability) * static_cast<double>(size - 1);
+            const SizeType index = static_cast<SizeType>(position);
+            const double fraction = position - static_cast<double>(index);
+
+            // Copy the two runs of the ring, the order does not matter for the selection
+            const SizeType head = Min(size, N - m_Start);
+            T* const last = Copy(m_Window, m_Window + (size - head), Copy(m_Window + m_Start, m_Window + m_Start + head, m_Scratch));
+            NthElement(m_Scratch, m_Scratch + index, last);
+
+            if(fraction == 0.0 || index + 1 == size) return m_Scratch[index];
+
+            const T& upper = *MinElement(m_Scratch + index + 1, last);
+            return m_Scratch[index] + static_cast<T>(fraction) * (upper - m_Scratch[index]);
+        }
+
+        /// @brief Computes the median of the window, the mean of the two middle values for an even count
+        T Median() {
+            return Quantile(0.5);
+        }
+
+        /// @brief Computes the difference between the third and the first quartile of the window
+        T InterquartileRange() {
+            return Quantile(0.75) - Quantile(0.25);
+        }
+
+    private:
+        T m_Window[N];
+        T m_Scratch[N];
+        SizeType m_Start;
+        SizeType m_Size;
+    };
+
     /// TODO: Mode
-    /// TODO: Variance
-    /// TODO: Standard deviation
-    /// TODO: Covariance
-    /// TODO: Correlation
-    /// TODO: Skewness
-    /// TODO: Kurtosis
-    /// TODO: Interquartile range
-    /// TODO: Percentile
-    /// TODO: Quartile
-    /// TODO: Range
 }
 
 #endif
\ No newline at end of file
@@ -1,21 +1,479 @@
-// #ifndef __WSTL_STREAMBUFFER_HPP__
-// #define __WSTL_STREAMBUFFER_HPP__
+// Part of WardenSTL - https://github.com/WardenHD/WardenSTL
+// Copyright (c) 2025 Artem Bezruchko (WardenHD)
+//
+// Licensed under the MIT License. See LICENSE file for details.
 
-// #include "CharacterTraits.hpp"
+#ifndef __WSTL_STREAMBUFFER_HPP__
+#define __WSTL_STREAMBUFFER_HPP__
 
+#include "private/Platform.hpp"
+#include "CharacterTraits.hpp"
+#include "Span.hpp"
+#include "Byte.hpp"
+#include "RingBuffer.hpp"
+#include "Algorithm.hpp"
+#include "TypeTraits.hpp"
+#include "NullPointer.hpp"
+#include <stddef.h>
 
-// namespace wstl {
-//     template<typename Character, typename Traits = CharacterTraits<Character> >
-//     class BasicStreamBuffer {
-//     public:
-//         typedef Character CharacterType;
-//         typedef Traits TraitsType;
-//         typedef typename TraitsType::IntegerType IntegerType;
-//         typedef typename TraitsType::OffsetType OffsetType;
-//         typedef typename TraitsType::PositionTypw PositionType;
 
-        
-//     };
-// }
+/// @defgroup stream_buffer Stream buffer
+/// @ingroup strings
+/// @brief Character streams over get and put areas
 
-// #endif
\ No newline at end of file
+namespace wstl {
+    // Basic stream buffer
+
+    /// @brief Base of character stream buffers, reads from a get area and writes to a put area
+    /// @tparam Character Type of the characters
+    /// @tparam Traits Character traits
+    /// @details Each area is a range of characters given by three pointers, the derived class
+    /// refills the get area in `Underflow` and drains the put area in `Overflow`. Single characters
+    /// and bulk transfers that fit the current area are handled inline without virtual calls,
+    /// bulk transfers copy whole regions with `Traits::Copy`. `ReadRegion` and `WriteRegion` give
+    /// direct access to the areas, so data can be parsed or produced in place. Seeking is not supported
+    /// @ingroup stream_buffer
+    /// @see https://en.cppreference.com/w/cpp/io/basic_streambuf
+    template<typename Character, typename Traits = CharacterTraits<Character> >
+    class BasicStreamBuffer {
+    public:
+        typedef Character CharacterType;
+        typedef Traits TraitsType;
+        typedef typename TraitsType::IntegerType IntegerType;
+        typedef typename TraitsType::OffsetType OffsetType;
+        typedef typename TraitsType::PositionType PositionType;
+        typedef size_t SizeType;
+
+        /// @brief Destructor
+        virtual ~BasicStreamBuffer() {}
+
+        // Get area
+
+        /// @brief Gets the number of characters that can be read without refilling the get area
+        SizeType InAvailable() const {
+            return static_cast<SizeType>(m_GetEnd - m_GetCurrent);
+        }
+
+        /// @brief Reads the next character without extracting it
+        /// @return The character, or `Traits::EOF()` if no more characters are available
+        IntegerType Sgetc() {
+            return m_GetCurrent < m_GetEnd ? ToInteger(*m_GetCurrent) : Underflow();
+        }
+
+        /// @brief Extracts the next character
+        /// @return The character, or `Traits::EOF()` if no more characters are available
+        IntegerType Sbumpc() {
+            return m_GetCurrent < m_GetEnd ? ToInteger(*m_GetCurrent++) : Uflow();
+        }
+
+        /// @brief Skips the next character and reads the one after it without extracting it
+        /// @return The character, or `Traits::EOF()` if no more characters are available
+        IntegerType Snextc() {
+            return Sbumpc() == TraitsType::EOF() ? TraitsType::EOF() : Sgetc();
+        }
+
+        /// @brief Extracts a number of characters
+        /// @param string Destination for the characters
+        /// @param count Number of characters to extract
+        /// @return Number of characters extracted
+        SizeType Sgetn(CharacterType* string, SizeType count) {
+            if(count <= InAvailable()) {
+                TraitsType::Copy(string, m_GetCurrent, count);
+                m_GetCurrent += count;
+                return count;
+            }
+
+            return XSgetn(string, count);
+        }
+
+        /// @brief Puts a character back into the get area
+        /// @param c The character to put back
+        /// @return The character, or `Traits::EOF()` if it cannot be put back
+        IntegerType Sputbackc(CharacterType c) {
+            if(m_GetBegin < m_GetCurrent && TraitsType::Equal(m_GetCurrent[-1], c)) return ToInteger(*--m_GetCurrent);
+            return PBackFail(ToInteger(c));
+        }
+
+        /// @brief Moves the get area back by one character
+        /// @return The character moved back to, or `Traits::EOF()` if there is none
+        IntegerType Sungetc() {
+            if(m_GetBegin < m_GetCurrent) return ToInteger(*--m_GetCurrent);
+            return PBackFail(TraitsType::EOF());
+        }
+
+        /// @brief Gets the characters that can be read in place, refilling the get area if it is empty
+        /// @return Span of the readable characters, empty if no more characters are available
+        Span<const CharacterType> ReadRegion() {
+            if(m_GetCurrent == m_GetEnd) Underflow();
+            return Span<const CharacterType>(m_GetCurrent, InAvailable());
+        }
+
+        /// @brief Extracts characters read in place from the region returned by `ReadRegion`
+        /// @param count Number of characters to extract, at most `InAvailable()`
+        void Consume(SizeType count) {
+            m_GetCurrent += Min(count, InAvailable());
+        }
+
+        // Put area
+
+        /// @brief Writes a character
+        /// @param c The character to write
+        /// @return The character, or `Traits::EOF()` if it could not be written
+        IntegerType Sputc(CharacterType c) {
+            if(m_PutCurrent < m_PutEnd) {
+                *m_PutCurrent++ = c;
+                return ToInteger(c);
+            }
+
+            return Overflow(ToInteger(c));
+        }
+
+        /// @brief Writes a number of characters
+        /// @param string The characters to write
+        /// @param count Number of characters to write
+        /// @return Number of characters written
+        SizeType Sputn(const CharacterType* string, SizeType count) {
+            if(count <= static_cast<SizeType>(m_PutEnd - m_PutCurrent)) {
+                TraitsType::Copy(m_PutCurrent, string, count);
+                m_PutCurrent += count;
+                return count;
+            }
+
+            return XSputn(string, count);
+        }
+
+        /// @brief Gets the space that can be written in place, draining the put area if it is full
+        /// @return Span of the writable characters, empty if no more characters can be written
+        Span<CharacterType> WriteRegion() {
+            if(m_PutCurrent == m_PutEnd) Overflow(TraitsType::EOF());
+            return Span<CharacterType>(m_PutCurrent, static_cast<SizeType>(m_PutEnd - m_PutCurrent));
+        }
+
+        /// @brief Marks characters written in place into the region returned by `WriteRegion` as written
+        /// @param count Number of characters written
+        void Commit(SizeType count) {
+            m_PutCurrent += Min(count, static_cast<SizeType>(m_PutEnd - m_PutCurrent));
+        }
+
+        /// @brief Synchronizes the buffer with its target
+        /// @return `0` on success, `-1` on failure
+        int Pubsync() {
+            return Sync();
+        }
+
+    protected:
+        /// @brief Default constructor, both areas are empty
+        BasicStreamBuffer() : m_GetBegin(NullPointer), m_GetCurrent(NullPointer), m_GetEnd(NullPointer),
+            m_PutBegin(NullPointer), m_PutCurrent(NullPointer), m_PutEnd(NullPointer) {}
+
+        /// @brief Gets the beginning of the get area
+        CharacterType* Eback() const {
+            return m_GetBegin;
+        }
+
+        /// @brief Gets the current position in the get area
+        CharacterType* Gptr() const {
+            return m_GetCurrent;
+        }
+
+        /// @brief Gets the end of the get area
+        CharacterType* Egptr() const {
+            return m_GetEnd;
+        }
+
+        /// @brief Advances the current position in the get area
+        /// @param count Number of characters to advance by, may be negative
+        void Gbump(int count) {
+            m_GetCurrent += count;
+        }
+
+        /// @brief Sets the get area
+        /// @param begin Beginning of the area
+        /// @param current Current position
+        /// @param end End of the area
+        void Setg(CharacterType* begin, CharacterType* current, CharacterType* end) {
+            m_GetBegin = begin;
+            m_GetCurrent = current;
+            m_GetEnd = end;
+        }
+
+        /// @brief Gets the beginning of the put area
+        CharacterType* Pbase() const {
+            return m_PutBegin;
+        }
+
+        /// @brief Gets the current position in the put area
+        CharacterType* Pptr() const {
+            return m_PutCurrent;
+        }
+
+        /// @brief Gets the end of the put area
+        CharacterType* Epptr() const {
+            return m_PutEnd;
+        }
+
+        /// @brief Advances the current position in the put area
+        /// @param count Number of characters to advance by, may be negative
+        void Pbump(int count) {
+            m_PutCurrent += count;
+        }
+
+        /// @brief Sets the put area, the current position is its beginning
+        /// @param begin Beginning of the area
+        /// @param end End of the area
+        void Setp(CharacterType* begin, CharacterType* end) {
+            m_PutBegin = begin;
+            m_PutCurrent = begin;
+            m_PutEnd = end;
+        }
+
+        /// @brief Refills the get area when it is empty
+        /// @return The next character without extracting it, or `Traits::EOF()` if there is none
+        virtual IntegerType Underflow() {
+            return TraitsType::EOF();
+        }
+
+        /// @brief Refills the get area when it is empty and extracts the next character
+        /// @return The extracted character, or `Traits::EOF()` if there is none
+        virtual IntegerType Uflow() {
+            if(Underflow() == TraitsType::EOF()) return TraitsType::EOF();
+            return ToInteger(*m_GetCurrent++);
+        }
+
+        /// @brief Extracts a number of characters, refilling the get area as needed
+        /// @param string Destination for the characters
+        /// @param count Number of characters to extract
+        /// @return Number of characters extracted
+        virtual SizeType XSgetn(CharacterType* string, SizeType count) {
+            SizeType done = 0;
+
+            while(done < count) {
+                if(m_GetCurrent == m_GetEnd && Underflow() == TraitsType::EOF()) break;
+
+                const SizeType chunk = Min(count - done, InAvailable());
+                TraitsType::Copy(string + done, m_GetCurrent, chunk);
+                m_GetCurrent += chunk;
+                done += chunk;
+            }
+
+            return done;
+        }
+
+        /// @brief Writes a number of characters, draining the put area as needed
+        /// @param string The characters to write
+        /// @param count Number of characters to write
+        /// @return Number of characters written
+        virtual SizeType XSputn(const CharacterType* string, SizeType count) {
+            SizeType done = 0;
+
+            while(done < count) {
+                if(m_PutCurrent == m_PutEnd) {
+                    // Overflow writes the character it is given
+                    if(Overflow(ToInteger(string[done])) == TraitsType::EOF()) break;
+                    ++done;
+                    continue;
+                }
+
+                const SizeType chunk = Min(count - done, static_cast<SizeType>(m_PutEnd - m_PutCurrent));
+                TraitsType::Copy(m_PutCurrent, string + done, chunk);
+                m_PutCurrent += chunk;
+                done += chunk;
+            }
+
+            return done;
+        }
+
+        /// @brief Drains the put area when it is full and writes a character
+        /// @param c The character to write, or `Traits::EOF()` to only drain
+        /// @return A value other than `Traits::EOF()` on success
+        virtual IntegerType Overflow(IntegerType c = TraitsType::EOF()) {
+            (void) c;
+            return TraitsType::EOF();
+        }
+
+        /// @brief Puts a character back when the get area does not allow it
+        /// @param c The character to put back, or `Traits::EOF()` to only move back
+        /// @return A value other than `Traits::EOF()` on success
+        virtual IntegerType PBackFail(IntegerType c = TraitsType::EOF()) {
+            (void) c;
+            return TraitsType::EOF();
+        }
+
+        /// @brief Synchronizes the buffer with its target
+        /// @return `0` on success, `-1` on failure
+        virtual int Sync() {
+            return 0;
+        }
+
+        /// @brief Converts a character to the integer type without sign extension, so it never equals `Traits::EOF()`
+        static IntegerType ToInteger(CharacterType c) {
+            return sizeof(CharacterType) == 1 ? static_cast<IntegerType>(static_cast<unsigned char>(c)) : static_cast<IntegerType>(c);
+        }
+
+    private:
+        CharacterType* m_GetBegin;
+        CharacterType* m_GetCurrent;
+        CharacterType* m_GetEnd;
+        CharacterType* m_PutBegin;
+        CharacterType* m_PutCurrent;
+        CharacterType* m_PutEnd;
+
+        /// @brief Deleted copy constructor
+        BasicStreamBuffer(const BasicStreamBuffer&) __WSTL_DELETE__;
+
+        /// @brief Deleted copy assignment operator
+        BasicStreamBuffer& operator=(const BasicStreamBuffer&) __WSTL_DELETE__;
+    };
+
+    typedef BasicStreamBuffer<char> StreamBuffer;
+    typedef BasicStreamBuffer<wchar_t> WideStreamBuffer;
+
+    // Span stream buffer
+
+    /// @brief Stream buffer over an existing buffer, characters written to it become readable
+    /// @tparam Character Type of the characters
+    /// @tparam Traits Character traits
+    /// @details The put area covers the free part of the buffer and the get area the written part,
+    /// so a receive buffer can be parsed in place and a transmit buffer filled without copying.
+    /// The class is final, so calls through it are not dispatched virtually
+    /// @ingroup stream_buffer
+    template<typename Character, typename Traits = CharacterTraits<Character> >
+    class BasicSpanStreamBuffer __WSTL_FINAL__ : public BasicStreamBuffer<Character, Traits> {
+    private:
+        typedef BasicStreamBuffer<Character, Traits> Base;
+
+    public:
+        typedef typename Base::CharacterType CharacterType;
+        typedef typename Base::TraitsType TraitsType;
+        typedef typename Base::IntegerType IntegerType;
+        typedef typename Base::SizeType SizeType;
+
+        /// @brief Constructor that wraps a buffer
+        /// @param buffer The buffer to read from and write to
+        /// @param size Number of characters at the beginning of the buffer that are already written
+        explicit BasicSpanStreamBuffer(Span<CharacterType> buffer, SizeType size = 0) {
+            Reset(buffer, size);
+        }
+
+        #ifdef __WSTL_CXX11__
+        /// @brief Constructor that wraps a byte buffer
+        /// @param buffer The buffer to read from and write to
+        /// @param size Number of bytes at the beginning of the buffer that are already written
+        /// @since C++11
+        template<typename U = CharacterType, typename = typename EnableIf<sizeof(U) == 1>::Type>
+        explicit BasicSpanStreamBuffer(Span<Byte> buffer, SizeType size = 0) {
+            Reset(Span<CharacterType>(reinterpret_cast<CharacterType*>(buffer.Data()), buffer.Size()), size);
+        }
+        #endif
+
+        /// @brief Wraps another buffer
+        /// @param buffer The buffer to read from and write to
+        /// @param size Number of characters at the beginning of the buffer that are already written
+        void Reset(Span<CharacterType> buffer, SizeType size = 0) {
+            size = Min(size, buffer.Size());
+
+            this->Setp(buffer.Data(), buffer.Data() + buffer.Size());
+            this->Pbump(static_cast<int>(size));
+            this->Setg(buffer.Data(), buffer.Data(), buffer.Data() + size);
+        }
+
+        /// @brief Gets the whole buffer
+        Span<CharacterType> Buffer() const {
+            return Span<CharacterType>(this->Pbase(), static_cast<SizeType>(this->Epptr() - this->Pbase()));
+        }
+
+        /// @brief Gets the characters written so far, including the ones already read
+        Span<CharacterType> Written() const {
+            return Span<CharacterType>(this->Pbase(), static_cast<SizeType>(this->Pptr() - this->Pbase()));
+        }
+
+    protected:
+        /// @brief Makes the characters written since the last refill readable
+        IntegerType Underflow() __WSTL_OVERRIDE__ {
+            if(this->Egptr() < this->Pptr()) this->Setg(this->Eback(), this->Gptr(), this->Pptr());
+            return this->Gptr() < this->Egptr() ? Base::ToInteger(*this->Gptr()) : TraitsType::EOF();
+        }
+    };
+
+    typedef BasicSpanStreamBuffer<char> SpanStreamBuffer;
+    typedef BasicSpanStreamBuffer<wchar_t> WideSpanStreamBuffer;
+
+    // Ring stream buffer
+
+    /// @brief Stream buffer over a single-producer single-consumer ring buffer
+    /// @tparam Ring The ring buffer type, such as `RingBuffer<char, 256>`
+    /// @tparam Traits Character traits
+    /// @details The get area is the contiguous region returned by `ReadRegion` of the ring and the
+    /// put area the one returned by `WriteRegion`, so both are accessed in place. Characters read
+    /// are released to the ring when the get area is refilled, characters written are published
+    /// when the put area is drained or on `Pubsync`. The get side acts as the consumer of the ring
+    /// and the put side as its producer, each may only be used from the context that owns that role
+    /// @ingroup stream_buffer
+    template<typename Ring, typename Traits = CharacterTraits<typename Ring::ValueType> >
+    class RingStreamBuffer __WSTL_FINAL__ : public BasicStreamBuffer<typename Ring::ValueType, Traits> {
+    private:
+        typedef BasicStreamBuffer<typename Ring::ValueType, Traits> Base;
+
+    public:
+        typedef typename Base::CharacterType CharacterType;
+        typedef typename Base::TraitsType TraitsType;
+        typedef typename Base::IntegerType IntegerType;
+        typedef typename Base::SizeType SizeType;
+
+        /// @brief Constructor that wraps a ring buffer
+        /// @param ring The ring buffer to read from and write to
+        explicit RingStreamBuffer(Ring& ring) : m_Ring(ring) {}
+
+        /// @brief Destructor, releases the characters read and publishes the characters written
+        ~RingStreamBuffer() {
+            if(this->Gptr() != this->Eback()) m_Ring.Consume(static_cast<SizeType>(this->Gptr() - this->Eback()));
+            if(this->Pptr() != this->Pbase()) m_Ring.Commit(static_cast<SizeType>(this->Pptr() - this->Pbase()));
+        }
+
+        /// @brief Gets the ring buffer
+        Ring& Buffer() const {
+            return m_Ring;
+        }
+
+    protected:
+        /// @brief Releases the characters read and takes the next readable region of the ring
+        IntegerType Underflow() __WSTL_OVERRIDE__ {
+            m_Ring.Consume(static_cast<SizeType>(this->Gptr() - this->Eback()));
+
+            Span<CharacterType> region = m_Ring.ReadRegion();
+            this->Setg(region.Data(), region.Data(), region.Data() + region.Size());
+
+            return region.Empty() ? TraitsType::EOF() : Base::ToInteger(region[0]);
+        }
+
+        /// @brief Publishes the characters written and takes the next writable region of the ring
+        IntegerType Overflow(IntegerType c = TraitsType::EOF()) __WSTL_OVERRIDE__ {
+            Publish();
+
+            if(c == TraitsType::EOF()) return TraitsType::NotEOF(c);
+            if(this->Pptr() == this->Epptr()) return TraitsType::EOF();
+
+            *this->Pptr() = TraitsType::ToCharacterType(c);
+            this->Pbump(1);
+            return c;
+        }
+
+        /// @brief Publishes the characters written
+        int Sync() __WSTL_OVERRIDE__ {
+            Publish();
+            return 0;
+        }
+
+    private:
+        Ring& m_Ring;
+
+        void Publish() {
+            m_Ring.Commit(static_cast<SizeType>(this->Pptr() - this->Pbase()));
+
+            Span<CharacterType> region = m_Ring.WriteRegion();
+            this->Setp(region.Data(), region.Data() + region.Size());
+        }
+    };
+}
+
+#endif
\ No newline at end of file
@@ -233,16 +233,22 @@ namespace wstl {
     // Hash specialization
 
     template<typename Derived, typename Traits>
-    struct Hash<BasicString<Derived, char, Traits> > {
+    struct Hash<BasicString<Derived, char, Traits> > : __private::__SeededHash {
+        Hash() : __SeededHash(0) {}
+        explicit Hash(size_t seed) : __SeededHash(seed) {}
+
         size_t operator()(const BasicString<Derived, char, Traits>& string) const {
-            return __private::__GenericHash<size_t>(reinterpret_cast<const uint8_t*>(string.Data()), reinterpret_cast<const uint8_t*>(string.Data() + string.Size()));
+            return HashBytes(string.Data(), string.Size());
         }
     };
 
     template<size_t N>
-    struct Hash<String<N> > {
+    struct Hash<String<N> > : __private::__SeededHash {
+        Hash() : __SeededHash(0) {}
+        explicit Hash(size_t seed) : __SeededHash(seed) {}
+
         size_t operator()(const String<N>& string) const {
-            return __private::__GenericHash<size_t>(reinterpret_cast<const uint8_t*>(string.Data()), reinterpret_cast<const uint8_t*>(string.Data() + string.Size()));
+            return HashBytes(string.Data(), string.Size());
         }
     };
 
@@ -511,16 +517,22 @@ namespace wstl {
     // Hash specialization
 
     template<typename Derived, typename Traits>
-    struct Hash<BasicString<Derived, wchar_t, Traits> > {
+    struct Hash<BasicString<Derived, wchar_t, Traits> > : __private::__SeededHash {
+        Hash() : __SeededHash(0) {}
+        explicit Hash(size_t seed) : __SeededHash(seed) {}
+
         size_t operator()(const BasicString<Derived, wchar_t, Traits>& string) const {
-            return __private::__GenericHash<size_t>(reinterpret_cast<const uint8_t*>(string.Data()), reinterpret_cast<const uint8_t*>(string.Data() + string.Size()));
+            return HashBytes(string.Data(), string.Size() * sizeof(wchar_t));
         }
     };
 
     template<size_t N>
-    struct Hash<WideString<N> > {
+    struct Hash<WideString<N> > : __private::__SeededHash {
+        Hash() : __SeededHash(0) {}
+        explicit Hash(size_t seed) : __SeededHash(seed) {}
+
         size_t operator()(const WideString<N>& string) const {
-            return __private::__GenericHash<size_t>(reinterpret_cast<const uint8_t*>(string.Data()), reinterpret_cast<const uint8_t*>(string.Data() + string.Size()));
+            return HashBytes(string.Data(), string.Size() * sizeof(wchar_t));
         }
     };
 
@@ -791,16 +803,22 @@ namespace wstl {
     // Hash specialization
 
     template<typename Derived, typename Traits>
-    struct Hash<BasicString<Derived, char16_t, Traits> > {
+    struct Hash<BasicString<Derived, char16_t, Traits> > : __private::__SeededHash {
+        Hash() : __SeededHash(0) {}
+        explicit Hash(size_t seed) : __SeededHash(seed) {}
+
         size_t operator()(const BasicString<Derived, char16_t, Traits>& string) const {
-            return __private::__GenericHash<size_t>(reinterpret_cast<const uint8_t*>(string.Data()), reinterpret_cast<const uint8_t*>(string.Data() + string.Size()));
+            return HashBytes(string.Data(), string.Size() * sizeof(char16_t));
         }
     };
 
     template<size_t N>
-    struct Hash<U16String<N> > {
+    struct Hash<U16String<N> > : __private::__SeededHash {
+        Hash() : __SeededHash(0) {}
+        explicit Hash(size_t seed) : __SeededHash(seed) {}
+
         size_t operator()(const U16String<N>& string) const {
-            return __private::__GenericHash<size_t>(reinterpret_cast<const uint8_t*>(string.Data()), reinterpret_cast<const uint8_t*>(string.Data() + string.Size()));
+            return HashBytes(string.Data(), string.Size() * sizeof(char16_t));
         }
     };
 
@@ -1069,16 +1087,22 @@ namespace wstl {
     // Hash specialization
 
     template<typename Derived, typename Traits>
-    struct Hash<BasicString<Derived, char32_t, Traits> > {
+    struct Hash<BasicString<Derived, char32_t, Traits> > : __private::__SeededHash {
+        Hash() : __SeededHash(0) {}
+        explicit Hash(size_t seed) : __SeededHash(seed) {}
+
         size_t operator()(const BasicString<Derived, char32_t, Traits>& string) const {
-            return __private::__GenericHash<size_t>(reinterpret_cast<const uint8_t*>(string.Data()), reinterpret_cast<const uint8_t*>(string.Data() + string.Size()));
+            return HashBytes(string.Data(), string.Size() * sizeof(char32_t));
         }
     };
 
     template<size_t N>
-    struct Hash<U32String<N> > {
+    struct Hash<U32String<N> > : __private::__SeededHash {
+        Hash() : __SeededHash(0) {}
+        explicit Hash(size_t seed) : __SeededHash(seed) {}
+
         size_t operator()(const U32String<N>& string) const {
-            return __private::__GenericHash<size_t>(reinterpret_cast<const uint8_t*>(string.Data()), reinterpret_cast<const uint8_t*>(string.Data() + string.Size()));
+            return HashBytes(string.Data(), string.Size() * sizeof(char32_t));
         }
     };
 
@@ -1349,16 +1373,22 @@ namespace wstl {
     // Hash specialization
 
     template<typename Derived, typename Traits>
-    struct Hash<BasicString<Derived, char8_t, Traits> > {
+    struct Hash<BasicString<Derived, char8_t, Traits> > : __private::__SeededHash {
+        Hash() : __SeededHash(0) {}
+        explicit Hash(size_t seed) : __SeededHash(seed) {}
+
         size_t operator()(const BasicString<Derived, char8_t, Traits>& string) const {
-            return __private::__GenericHash<size_t>(reinterpret_cast<const uint8_t*>(string.Data()), reinterpret_cast<const uint8_t*>(string.Data() + string.Size()));
+            return HashBytes(string.Data(), string.Size() * sizeof(char8_t));
         }
     };
 
     template<size_t N>
-    struct Hash<U8String<N> > {
+    struct Hash<U8String<N> > : __private::__SeededHash {
+        Hash() : __SeededHash(0) {}
+        explicit Hash(size_t seed) : __SeededHash(seed) {}
+
         size_t operator()(const U8String<N>& string) const {
-            return __private::__GenericHash<size_t>(reinterpret_cast<const uint8_t*>(string.Data()), reinterpret_cast<const uint8_t*>(string.Data() + string.Size()));
+            return HashBytes(string.Data(), string.Size() * sizeof(char8_t));
         }
     };
 
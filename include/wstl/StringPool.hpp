@@ -0,0 +1,296 @@
+// Part of WardenSTL - https://github.com/WardenHD/WardenSTL
+// Copyright (c) 2025 Artem Bezruchko (WardenHD)
+//
+// Licensed under the MIT License. See LICENSE file for details.
+
+#ifndef __WSTL_STRINGPOOL_HPP__
+#define __WSTL_STRINGPOOL_HPP__
+
+#include "private/Platform.hpp"
+#include "private/Error.hpp"
+#include "CharacterTraits.hpp"
+#include "StringView.hpp"
+#include "HashSet.hpp"
+#include "Hash.hpp"
+#include "TypeTraits.hpp"
+#include "StandardExceptions.hpp"
+#include "StaticAssert.hpp"
+#include "NullPointer.hpp"
+#include <stddef.h>
+#include <stdint.h>
+
+
+/// @defgroup string_pool String pool
+/// @ingroup containers
+/// @brief Interning of strings into a fixed arena, with integer handles
+
+namespace wstl {
+    // Interned string
+
+    /// @brief Handle of a string interned in a `StringPool`
+    /// @tparam Index Unsigned integer type of the handle
+    /// @details Two handles from the same pool are equal exactly when their strings are equal, so
+    /// comparing and hashing them costs one integer operation. The default handle is null and
+    /// refers to no string
+    /// @ingroup string_pool
+    template<typename Index>
+    class BasicInternedString {
+    public:
+        WSTL_STATIC_ASSERT(IsUnsigned<Index>::Value, "Index must be unsigned");
+
+        typedef Index IndexType;
+
+        /// @brief Default constructor, creates a null handle
+        __WSTL_CONSTEXPR__ BasicInternedString() __WSTL_NOEXCEPT__ : m_Index(0) {}
+
+        /// @brief Constructor from the raw value of a handle
+        /// @param index Value returned by `Value`, handles are normally obtained from a pool
+        __WSTL_CONSTEXPR__ explicit BasicInternedString(Index index) __WSTL_NOEXCEPT__ : m_Index(index) {}
+
+        /// @brief Gets the raw value of the handle, `0` for a null handle
+        __WSTL_NODISCARD__ __WSTL_CONSTEXPR__ Index Value() const __WSTL_NOEXCEPT__ {
+            return m_Index;
+        }
+
+        /// @brief Checks whether the handle refers to a string
+        __WSTL_NODISCARD__ __WSTL_CONSTEXPR__ bool Valid() const __WSTL_NOEXCEPT__ {
+            return m_Index != 0;
+        }
+
+    private:
+        Index m_Index;
+    };
+
+    // Comparison operators
+
+    template<typename Index>
+    __WSTL_CONSTEXPR__ inline bool operator==(const BasicInternedString<Index>& a, const BasicInternedString<Index>& b) __WSTL_NOEXCEPT__ {
+        return a.Value() == b.Value();
+    }
+
+    template<typename Index>
+    __WSTL_CONSTEXPR__ inline bool operator!=(const BasicInternedString<Index>& a, const BasicInternedString<Index>& b) __WSTL_NOEXCEPT__ {
+        return a.Value() != b.Value();
+    }
+
+    /// @brief Orders handles by the order their strings were interned in, not alphabetically
+    template<typename Index>
+    __WSTL_CONSTEXPR__ inline bool operator<(const BasicInternedString<Index>& a, const BasicInternedString<Index>& b) __WSTL_NOEXCEPT__ {
+        return a.Value() < b.Value();
+    }
+
+    /// @brief Handle of a string interned in a pool of up to 65534 strings
+    /// @ingroup string_pool
+    typedef BasicInternedString<uint16_t> InternedString;
+
+    /// @brief Handle of a string interned in a pool of more than 65534 strings
+    /// @ingroup string_pool
+    typedef BasicInternedString<uint32_t> InternedString32;
+
+    // Hash function
+
+    template<typename Index>
+    struct Hash<BasicInternedString<Index> > {
+        size_t operator()(const BasicInternedString<Index>& string) const {
+            return static_cast<size_t>(string.Value());
+        }
+    };
+
+    // Basic string pool
+
+    /// @brief Arena of unique strings, each identified by a small integer handle
+    /// @tparam T Character type
+    /// @tparam Capacity Number of characters in the arena, each string also takes a null terminator
+    /// @tparam MaxStrings Maximum number of distinct strings
+    /// @tparam Traits Character traits
+    /// @details Characters of all strings are copied once, one after another, into a single array,
+    /// like a `BumpAllocator` that never frees. A `HashSet` of handles finds a string that is
+    /// already in the pool, so interning the same characters again returns the same handle. After
+    /// that, strings are compared and hashed by handle, and `View` gives their characters without
+    /// a copy. Strings stay in the pool until `Clear`. Handles are `InternedString` when
+    /// `MaxStrings` fits in 16 bits, otherwise `InternedString32`. The pool refers to itself, so it
+    /// cannot be copied
+    /// @ingroup string_pool
+    ///
+    /// @code
+    /// static StringPool<1024, 64> Topics;
+    ///
+    /// const InternedString status = Topics.Intern("sensors/status");
+    /// if(Topics.Intern(topic) == status) ...
+    /// @endcode
+    template<typename T, size_t Capacity, size_t MaxStrings, typename Traits = CharacterTraits<T> >
+    class BasicStringPool {
+    public:
+        WSTL_STATIC_ASSERT(Capacity > 0 && MaxStrings > 0, "Pool must have capacity");
+        WSTL_STATIC_ASSERT(MaxStrings < 0xFFFFFFFFUL, "Too many strings for a 32-bit handle");
+
+        typedef T ValueType;
+        typedef Traits TraitsType;
+        typedef size_t SizeType;
+        typedef BasicStringView<T, Traits> ViewType;
+        typedef BasicInternedString<typename Conditional<(MaxStrings < 0xFFFF), uint16_t, uint32_t>::Type> InternedType;
+
+        /// @brief Number of slots of the hash set, keeps its load under 80%
+        static const __WSTL_CONSTEXPR__ SizeType SlotCount = MaxStrings + (MaxStrings + 3) / 4;
+
+        /// @brief Constructor, creates an empty pool
+        BasicStringPool() : m_Count(0), m_Handles(StringHash(this), StringEqual(this)) {
+            m_Offsets[0] = 0;
+        }
+
+        /// @brief Interns a string
+        /// @param string String to intern
+        /// @return Handle of the string, the same for equal strings
+        /// @throws `LengthError` if the string is new and the arena or the handles are exhausted,
+        /// a null handle is returned then
+        InternedType Intern(const ViewType& string) {
+            const InternedType found = Find(string);
+            if(found.Valid()) return found;
+
+            const SizeType used = m_Offsets[m_Count];
+            __WSTL_ASSERT_RETURNVALUE__(m_Count < MaxStrings, WSTL_MAKE_EXCEPTION(LengthError, "StringPool: Too many strings"), InternedType());
+            __WSTL_ASSERT_RETURNVALUE__(string.Size() < Capacity - used, WSTL_MAKE_EXCEPTION(LengthError, "StringPool: Arena is full"), InternedType());
+
+            Traits::Copy(m_Characters + used, string.Data(), string.Size());
+            m_Characters[used + string.Size()] = T();
+
+            m_Offsets[m_Count + 1] = static_cast<OffsetType>(used + string.Size() + 1);
+            const IndexType index = static_cast<IndexType>(++m_Count);
+            m_Handles.Insert(index);
+
+            return InternedType(index);
+        }
+
+        /// @brief Finds a string without interning it
+        /// @param string String to search for
+        /// @return Handle of the string, or a null handle if it is not in the pool
+        __WSTL_NODISCARD__ InternedType Find(const ViewType& string) const {
+            typename HandleSet::ConstIterator it = m_Handles.Find(string);
+
+            return it == m_Handles.End() ? InternedType() : InternedType(*it);
+        }
+
+        /// @brief Gets the characters of an interned string
+        /// @param string Handle from this pool
+        /// @return View of the string, empty for a null handle
+        __WSTL_NODISCARD__ ViewType View(InternedType string) const {
+            __WSTL_ASSERT_RETURNVALUE__(string.Value() <= m_Count, WSTL_MAKE_EXCEPTION(OutOfRange, "StringPool: Handle out of range"), ViewType());
+            return string.Valid() ? Resolve(string.Value()) : ViewType();
+        }
+
+        /// @brief Gets the null-terminated characters of an interned string
+        /// @param string Handle from this pool, must be valid
+        __WSTL_NODISCARD__ const T* CStr(InternedType string) const {
+            __WSTL_ASSERT_RETURNVALUE__(string.Valid() && string.Value() <= m_Count, WSTL_MAKE_EXCEPTION(OutOfRange, "StringPool: Handle out of range"), NullPointer);
+            return m_Characters + m_Offsets[string.Value() - 1];
+        }
+
+        /// @brief Checks whether a string is in the pool
+        /// @param string String to search for
+        __WSTL_NODISCARD__ bool Contains(const ViewType& string) const {
+            return Find(string).Valid();
+        }
+
+        /// @brief Removes all strings, handles from before become invalid
+        void Clear() {
+            m_Handles.Clear();
+            m_Count = 0;
+        }
+
+        /// @brief Gets the number of strings
+        __WSTL_NODISCARD__ SizeType Size() const __WSTL_NOEXCEPT__ {
+            return m_Count;
+        }
+
+        /// @brief Gets the maximum number of strings
+        __WSTL_NODISCARD__ __WSTL_CONSTEXPR__ SizeType MaxSize() const __WSTL_NOEXCEPT__ {
+            return MaxStrings;
+        }
+
+        /// @brief Checks whether the pool has no strings
+        __WSTL_NODISCARD__ bool Empty() const __WSTL_NOEXCEPT__ {
+            return m_Count == 0;
+        }
+
+        /// @brief Gets the number of characters in use, including null terminators
+        __WSTL_NODISCARD__ SizeType Used() const __WSTL_NOEXCEPT__ {
+            return m_Offsets[m_Count];
+        }
+
+        /// @brief Gets the number of characters left
+        __WSTL_NODISCARD__ SizeType Available() const __WSTL_NOEXCEPT__ {
+            return Capacity - m_Offsets[m_Count];
+        }
+
+    private:
+        typedef typename InternedType::IndexType IndexType;
+        typedef typename Conditional<(Capacity <= 0xFFFF), uint16_t, uint32_t>::Type OffsetType;
+
+        /// @brief Hashes the string a handle refers to, or a string searched for
+        struct StringHash {
+            typedef int IsTransparent;
+
+            const BasicStringPool* Pool;
+
+            explicit StringHash(const BasicStringPool* pool) : Pool(pool) {}
+
+            size_t operator()(IndexType index) const {
+                return operator()(Pool->Resolve(index));
+            }
+
+            size_t operator()(const ViewType& string) const {
+                return __private::__GenericHash<size_t>(reinterpret_cast<const uint8_t*>(string.Data()), reinterpret_cast<const uint8_t*>(string.Data() + string.Size()));
+            }
+        };
+
+        /// @brief Compares the strings two handles refer to, or a handle with a string searched for
+        struct StringEqual {
+            typedef int IsTransparent;
+
+            const BasicStringPool* Pool;
+
+            explicit StringEqual(const BasicStringPool* pool) : Pool(pool) {}
+
+            bool operator()(IndexType a, IndexType b) const {
+                return operator()(a, Pool->Resolve(b));
+            }
+
+            bool operator()(IndexType index, const ViewType& string) const {
+                const ViewType stored = Pool->Resolve(index);
+                return stored.Size() == string.Size() && Traits::Compare(stored.Data(), string.Data(), stored.Size()) == 0;
+            }
+        };
+
+        typedef HashSet<IndexType, SlotCount, StringHash, StringEqual> HandleSet;
+
+        T m_Characters[Capacity];
+        OffsetType m_Offsets[MaxStrings + 1];
+        SizeType m_Count;
+        HandleSet m_Handles;
+
+        /// @brief Gets the string of a handle
+        ViewType Resolve(IndexType index) const {
+            return ViewType(m_Characters + m_Offsets[index - 1], m_Offsets[index] - m_Offsets[index - 1] - 1);
+        }
+
+        /// @brief Deleted copy constructor
+        BasicStringPool(const BasicStringPool&) __WSTL_DELETE__;
+
+        /// @brief Deleted copy assignment operator
+        BasicStringPool& operator=(const BasicStringPool&) __WSTL_DELETE__;
+    };
+
+    template<typename T, size_t Capacity, size_t MaxStrings, typename Traits>
+    const __WSTL_CONSTEXPR__ typename BasicStringPool<T, Capacity, MaxStrings, Traits>::SizeType BasicStringPool<T, Capacity, MaxStrings, Traits>::SlotCount;
+
+    // String pool
+
+    /// @brief String pool of `char`
+    /// @tparam Capacity Number of characters in the arena, each string also takes a null terminator
+    /// @tparam MaxStrings Maximum number of distinct strings
+    /// @ingroup string_pool
+    template<size_t Capacity, size_t MaxStrings>
+    class StringPool : public BasicStringPool<char, Capacity, MaxStrings> {};
+}
+
+#endif
@@ -7,6 +7,7 @@
 #include "Limits.hpp"
 #include "Memory.hpp"
 #include "Hash.hpp"
+#include "Searcher.hpp"
 
 #include <stdint.h>
 
@@ -314,6 +315,13 @@ namespace wstl {
         __WSTL_CONSTEXPR14__ SizeType Find(const T* string, SizeType position, SizeType count) const {
             if(position + count > Size()) return NoPosition;
 
+            if(count >= __private::__SEARCHER_THRESHOLD && !__WSTL_IS_CONSTANT_EVALUATED__()) {
+                const T* end = Data() + Size();
+                const T* result = BoyerMooreHorspoolSearcher<const T*, uint8_t>(string, string + count)(Data() + position, end).First;
+
+                return result == end ? NoPosition : static_cast<SizeType>(result - Data());
+            }
+
             ConstIterator iterator = Search(Begin() + position, End(), string, string + count);
             if(iterator == End()) return NoPosition;
 
@@ -327,10 +335,10 @@ namespace wstl {
         __WSTL_CONSTEXPR14__ SizeType Find(T ch, SizeType position = 0) const __WSTL_NOEXCEPT__ {
             if(position + 1 > Size()) return NoPosition;
 
-            ConstIterator iterator = wstl::Find(Begin() + position, End(), ch);
-            if(iterator == End()) return NoPosition;
+            const T* pointer = TraitsType::Find(m_Data + position, Size() - position, ch);
+            if(pointer == 0) return NoPosition;
 
-            return Distance(Begin(), iterator);
+            return static_cast<SizeType>(pointer - m_Data);
         }
 
         /// @brief Finds the first occurrence of a substring
@@ -402,12 +410,7 @@ namespace wstl {
         /// @param position Position to start the search from (default is 0)
         /// @return The position of the first occurrence, or `NoPosition` if not found
         __WSTL_CONSTEXPR14__ SizeType FindFirstOf(T ch, SizeType position = 0) const __WSTL_NOEXCEPT__ {
-            if(position < Size()) {
-                for(size_t i = position; i < this->Size(); ++i) 
-                    if(m_Data[i] == ch) return i;
-            }
-
-            return NoPosition;
+            return Find(ch, position);
         }
 
         /// @brief Finds the first occurrence of any character from a C-style string
@@ -801,40 +804,55 @@ namespace wstl {
     // Hash function
 
     template<>
-    struct Hash<StringView> {
+    struct Hash<StringView> : __private::__SeededHash {
+        Hash() : __SeededHash(0) {}
+        explicit Hash(size_t seed) : __SeededHash(seed) {}
+
         size_t operator()(const StringView& view) const {
-            return __private::__GenericHash<size_t>(reinterpret_cast<const uint8_t*>(view.Data()), reinterpret_cast<const uint8_t*>(view.Data() + view.Size()));
+            return HashBytes(view.Data(), view.Size());
         }
     };
 
     template<>
-    struct Hash<WideStringView> {
+    struct Hash<WideStringView> : __private::__SeededHash {
+        Hash() : __SeededHash(0) {}
+        explicit Hash(size_t seed) : __SeededHash(seed) {}
+
         size_t operator()(const WideStringView& view) const {
-            return __private::__GenericHash<size_t>(reinterpret_cast<const uint8_t*>(view.Data()), reinterpret_cast<const uint8_t*>(view.Data() + view.Size()));
+            return HashBytes(view.Data(), view.Size() * sizeof(wchar_t));
         }
     };
 
     #ifdef __WSTL_CXX11__
     template<>
-    struct Hash<U16StringView> {
+    struct Hash<U16StringView> : __private::__SeededHash {
+        Hash() : __SeededHash(0) {}
+        explicit Hash(size_t seed) : __SeededHash(seed) {}
+
         size_t operator()(const U16StringView& view) const {
-            return __private::__GenericHash<size_t>(reinterpret_cast<const uint8_t*>(view.Data()), reinterpret_cast<const uint8_t*>(view.Data() + view.Size()));
+            return HashBytes(view.Data(), view.Size() * sizeof(char16_t));
         }
     };
 
     template<>
-    struct Hash<U32StringView> {
+    struct Hash<U32StringView> : __private::__SeededHash {
+        Hash() : __SeededHash(0) {}
+        explicit Hash(size_t seed) : __SeededHash(seed) {}
+
         size_t operator()(const U32StringView& view) const {
-            return __private::__GenericHash<size_t>(reinterpret_cast<const uint8_t*>(view.Data()), reinterpret_cast<const uint8_t*>(view.Data() + view.Size()));
+            return HashBytes(view.Data(), view.Size() * sizeof(char32_t));
         }
     };
     #endif
 
     #ifdef __WSTL_CXX20__
     template<>
-    struct Hash<U8StringView> {
+    struct Hash<U8StringView> : __private::__SeededHash {
+        Hash() : __SeededHash(0) {}
+        explicit Hash(size_t seed) : __SeededHash(seed) {}
+
         size_t operator()(const U8StringView& view) const {
-            return __private::__GenericHash<size_t>(reinterpret_cast<const uint8_t*>(view.Data()), reinterpret_cast<const uint8_t*>(view.Data() + view.Size()));
+            return HashBytes(view.Data(), view.Size() * sizeof(char8_t));
         }
     };
     #endif
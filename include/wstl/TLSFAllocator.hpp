@@ -0,0 +1,283 @@
+// Part of WardenSTL - https://github.com/WardenHD/WardenSTL
+// Copyright (c) 2025 Artem Bezruchko (WardenHD)
+//
+// Licensed under the MIT License. See LICENSE file for details.
+
+#ifndef __WSTL_TLSFALLOCATOR_HPP__
+#define __WSTL_TLSFALLOCATOR_HPP__
+
+#include "Allocator.hpp"
+#include "NullPointer.hpp"
+#include "Bit.hpp"
+#include "private/Error.hpp"
+#include <stddef.h>
+#include <stdint.h>
+
+
+namespace wstl {
+    namespace __private {
+        /// @brief Log2 of the alignment of blocks returned by `TLSFAllocator`
+        static const __WSTL_CONSTEXPR__ size_t __TLSF_ALIGNMENT_LOG2 = 3;
+
+        /// @brief Log2 of the number of second-level lists per first-level range
+        static const __WSTL_CONSTEXPR__ size_t __TLSF_SECOND_LEVEL_LOG2 = 4;
+
+        /// @brief Log2 of the largest block size, 1 GiB on 32-bit targets and 4 GiB on 64-bit ones
+        static const __WSTL_CONSTEXPR__ size_t __TLSF_MAXIMUM_LOG2 = sizeof(size_t) >= 8 ? 32 : 30;
+    }
+
+    // TLSF allocator
+
+    /// @brief Allocator with Two-Level Segregated Fit over a caller-provided region
+    /// @details Free blocks are kept in lists segregated by size: the first level splits
+    /// sizes by powers of two and the second level splits every power of two into 16 ranges.
+    /// Two bitmaps record which lists are non-empty, so a fitting list is found with one
+    /// `CountRightZero` per level, and `Allocate` and `Free` take constant time in the worst
+    /// case, independent of the number of blocks. Freed blocks are merged with free neighbours
+    /// immediately. Each block has a header of two pointers, payloads are aligned to 8 bytes.
+    /// Requests are rounded up to the next list boundary, wasting at most 1/16 of the block
+    /// @ingroup allocator
+    /// @see http://www.gii.upv.es/tlsf/
+    class TLSFAllocator : public Allocator {
+    public:
+        /// @brief Constructor
+        /// @param base The base address of the region
+        /// @param limit The size of the region
+        TLSFAllocator(void* base, size_t limit) : m_Begin(NullPointer), m_End(NullPointer) {
+            const uintptr_t begin = (reinterpret_cast<uintptr_t>(base) + ALIGNMENT - 1) & ~uintptr_t(ALIGNMENT - 1);
+            const uintptr_t end = (reinterpret_cast<uintptr_t>(base) + limit) & ~uintptr_t(ALIGNMENT - 1);
+
+            m_FirstLevel = 0;
+            for(size_t i = 0; i < FIRST_LEVEL_COUNT; ++i) {
+                m_SecondLevel[i] = 0;
+                for(size_t j = 0; j < SECOND_LEVEL_COUNT; ++j) m_Heads[i][j] = NullPointer;
+            }
+
+            // Room for one block and the sentinel that ends the region
+            if(end < begin || end - begin < 2 * HEADER_SIZE + MINIMUM_SIZE) return;
+
+            size_t size = end - begin - 2 * HEADER_SIZE;
+            if(size >= MAXIMUM_SIZE) size = MAXIMUM_SIZE - ALIGNMENT;
+
+            m_Begin = reinterpret_cast<uint8_t*>(begin);
+
+            Block* block = reinterpret_cast<Block*>(begin);
+            block->Physical = NullPointer;
+            block->Size = size | FREE;
+
+            Block* sentinel = Next(block);
+            sentinel->Physical = block;
+            sentinel->Size = 0;
+            m_End = reinterpret_cast<uint8_t*>(sentinel);
+
+            Insert(block);
+        }
+
+        /// @copydoc Allocator::Allocate(size_t)
+        virtual void* Allocate(size_t size) __WSTL_OVERRIDE__ {
+            const Expected<void*> result = TryAllocate(size);
+
+            if(!result.HasValue()) {
+                __WSTL_ASSERT_RETURNVALUE__(result.Error() != ERROR_CODE_TOO_LARGE, WSTL_MAKE_EXCEPTION(BadAllocation, "TLSFAllocator: Allocation is too large"), NullPointer);
+                __WSTL_THROW_RETURNVALUE__(WSTL_MAKE_EXCEPTION(BadAllocation, "TLSFAllocator: Out of memory"), NullPointer);
+            }
+
+            return *result;
+        }
+
+        /// @copydoc Allocator::TryAllocate(size_t)
+        /// @details Fails with `ERROR_CODE_TOO_LARGE` if the size cannot be mapped to a list and with
+        /// `ERROR_CODE_OUT_OF_MEMORY` if no free block is large enough
+        virtual Expected<void*> TryAllocate(size_t size) __WSTL_OVERRIDE__ {
+            const Expected<void*> result = Acquire(size);
+            RecordAllocation(size, result.ValueOr(NullPointer));
+
+            return result;
+        }
+
+        /// @copydoc Allocator::Free(void*)
+        /// @details Null pointers are ignored
+        virtual void Free(void* address) __WSTL_OVERRIDE__ {
+            if(address == NullPointer) return;
+            __WSTL_ASSERT_RETURN__(Owns(address), WSTL_MAKE_EXCEPTION(BadAllocation, "TLSFAllocator: Address is not in the region"));
+
+            Block* block = reinterpret_cast<Block*>(static_cast<uint8_t*>(address) - HEADER_SIZE);
+            __WSTL_ASSERT_RETURN__(!IsFree(block), WSTL_MAKE_EXCEPTION(BadAllocation, "TLSFAllocator: Block is already free"));
+
+            Block* previous = block->Physical;
+            if(previous && IsFree(previous)) {
+                Remove(previous);
+                previous->Size = SizeOf(previous) + HEADER_SIZE + SizeOf(block);
+                block = previous;
+            }
+
+            Block* next = Next(block);
+            if(IsFree(next)) {
+                Remove(next);
+                block->Size = SizeOf(block) + HEADER_SIZE + SizeOf(next);
+            }
+
+            block->Size |= FREE;
+            Next(block)->Physical = block;
+            Insert(block);
+            RecordFree(address);
+        }
+
+        /// @brief Checks whether the address lies in the region managed by the allocator
+        /// @param address The address to check
+        bool Owns(const void* address) const {
+            const uint8_t* bytes = static_cast<const uint8_t*>(address);
+            return m_Begin != NullPointer && bytes >= m_Begin + HEADER_SIZE && bytes < m_End;
+        }
+
+        /// @brief Gets the usable size of an allocated block, at least the requested size
+        /// @param address Address returned by `Allocate`
+        static size_t BlockSize(const void* address) {
+            return SizeOf(reinterpret_cast<const Block*>(static_cast<const uint8_t*>(address) - HEADER_SIZE));
+        }
+
+    private:
+        Expected<void*> Acquire(size_t size) {
+            if(size >= MAXIMUM_SIZE / 2) return MakeUnexpected(ERROR_CODE_TOO_LARGE);
+
+            size = (size + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+            if(size < MINIMUM_SIZE) size = MINIMUM_SIZE;
+
+            // Round up to the next list, so any block found there is large enough
+            size_t firstLevel, secondLevel;
+            Mapping(size >= SMALL_SIZE ? size + (size_t(1) << (BitWidth(size) - 1 - __private::__TLSF_SECOND_LEVEL_LOG2)) - 1 : size, firstLevel, secondLevel);
+
+            Block* block = FindSuitable(firstLevel, secondLevel);
+            if(block == NullPointer) return MakeUnexpected(ERROR_CODE_OUT_OF_MEMORY);
+
+            Remove(block, firstLevel, secondLevel);
+
+            // Return the tail to the free lists if it can hold a block
+            const size_t remaining = SizeOf(block) - size;
+            if(remaining >= HEADER_SIZE + MINIMUM_SIZE) {
+                block->Size = size;
+
+                Block* rest = Next(block);
+                rest->Physical = block;
+                rest->Size = (remaining - HEADER_SIZE) | FREE;
+                Next(rest)->Physical = rest;
+
+                Insert(rest);
+            }
+            else block->Size = SizeOf(block);
+
+            return Payload(block);
+        }
+
+        struct Block {
+            /// @brief Previous block in memory, null for the first one
+            Block* Physical;
+            /// @brief Size of the payload, the lowest bit is set if the block is free
+            size_t Size;
+            // Only valid in free blocks, they overlap the payload
+            Block* NextFree;
+            Block* PreviousFree;
+        };
+
+        static const size_t ALIGNMENT = size_t(1) << __private::__TLSF_ALIGNMENT_LOG2;
+        static const size_t HEADER_SIZE = (2 * sizeof(void*) + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+        static const size_t MINIMUM_SIZE = (2 * sizeof(void*) + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+        static const size_t FREE = 1;
+
+        static const size_t SECOND_LEVEL_COUNT = size_t(1) << __private::__TLSF_SECOND_LEVEL_LOG2;
+        static const size_t FIRST_LEVEL_SHIFT = __private::__TLSF_SECOND_LEVEL_LOG2 + __private::__TLSF_ALIGNMENT_LOG2;
+        static const size_t FIRST_LEVEL_COUNT = __private::__TLSF_MAXIMUM_LOG2 - FIRST_LEVEL_SHIFT + 1;
+        /// @brief Blocks below this size share the first level and are split linearly
+        static const size_t SMALL_SIZE = size_t(1) << FIRST_LEVEL_SHIFT;
+        static const size_t MAXIMUM_SIZE = size_t(1) << __private::__TLSF_MAXIMUM_LOG2;
+
+        uint8_t* m_Begin;
+        uint8_t* m_End;
+        uint32_t m_FirstLevel;
+        uint32_t m_SecondLevel[FIRST_LEVEL_COUNT];
+        Block* m_Heads[FIRST_LEVEL_COUNT][SECOND_LEVEL_COUNT];
+
+        static size_t SizeOf(const Block* block) {
+            return block->Size & ~FREE;
+        }
+
+        static bool IsFree(const Block* block) {
+            return (block->Size & FREE) != 0;
+        }
+
+        static void* Payload(Block* block) {
+            return reinterpret_cast<uint8_t*>(block) + HEADER_SIZE;
+        }
+
+        static Block* Next(Block* block) {
+            return reinterpret_cast<Block*>(reinterpret_cast<uint8_t*>(block) + HEADER_SIZE + SizeOf(block));
+        }
+
+        /// @brief Gets the indices of the list that holds blocks of the given size
+        static void Mapping(size_t size, size_t& firstLevel, size_t& secondLevel) {
+            if(size < SMALL_SIZE) {
+                firstLevel = 0;
+                secondLevel = size / (SMALL_SIZE / SECOND_LEVEL_COUNT);
+            }
+            else {
+                const size_t highest = BitWidth(size) - 1;
+                secondLevel = (size >> (highest - __private::__TLSF_SECOND_LEVEL_LOG2)) ^ SECOND_LEVEL_COUNT;
+                firstLevel = highest - FIRST_LEVEL_SHIFT + 1;
+            }
+        }
+
+        /// @brief Finds a non-empty list at or above the given one and updates the indices to it
+        Block* FindSuitable(size_t& firstLevel, size_t& secondLevel) const {
+            if(firstLevel >= FIRST_LEVEL_COUNT) return NullPointer;
+
+            uint32_t secondMap = m_SecondLevel[firstLevel] & (~uint32_t(0) << secondLevel);
+
+            if(secondMap == 0) {
+                const uint32_t firstMap = m_FirstLevel & (~uint32_t(0) << (firstLevel + 1));
+                if(firstMap == 0) return NullPointer;
+
+                firstLevel = CountRightZero(firstMap);
+                secondMap = m_SecondLevel[firstLevel];
+            }
+
+            secondLevel = CountRightZero(secondMap);
+            return m_Heads[firstLevel][secondLevel];
+        }
+
+        void Insert(Block* block) {
+            size_t firstLevel, secondLevel;
+            Mapping(SizeOf(block), firstLevel, secondLevel);
+
+            Block*& head = m_Heads[firstLevel][secondLevel];
+            block->NextFree = head;
+            block->PreviousFree = NullPointer;
+            if(head) head->PreviousFree = block;
+            head = block;
+
+            m_FirstLevel |= uint32_t(1) << firstLevel;
+            m_SecondLevel[firstLevel] |= uint32_t(1) << secondLevel;
+        }
+
+        void Remove(Block* block) {
+            size_t firstLevel, secondLevel;
+            Mapping(SizeOf(block), firstLevel, secondLevel);
+            Remove(block, firstLevel, secondLevel);
+        }
+
+        void Remove(Block* block, size_t firstLevel, size_t secondLevel) {
+            if(block->NextFree) block->NextFree->PreviousFree = block->PreviousFree;
+
+            if(block->PreviousFree) block->PreviousFree->NextFree = block->NextFree;
+            else {
+                m_Heads[firstLevel][secondLevel] = block->NextFree;
+
+                if(block->NextFree == NullPointer) {
+                    m_SecondLevel[firstLevel] &= ~(uint32_t(1) << secondLevel);
+                    if(m_SecondLevel[firstLevel] == 0) m_FirstLevel &= ~(uint32_t(1) << firstLevel);
+                }
+            }
+        }
+    };
+}
+
+#endif
\ No newline at end of file
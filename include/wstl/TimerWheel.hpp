@@ -0,0 +1,319 @@
+// Part of WardenSTL - https://github.com/WardenHD/WardenSTL
+// Copyright (c) 2025 Artem Bezruchko (WardenHD)
+//
+// Licensed under the MIT License. See LICENSE file for details.
+
+#ifndef __WSTL_TIMERWHEEL_HPP__
+#define __WSTL_TIMERWHEEL_HPP__
+
+#include "private/Platform.hpp"
+#include "private/Error.hpp"
+#include "IntrusiveList.hpp"
+#include "InplaceFunction.hpp"
+#include "Bit.hpp"
+#include "StaticAssert.hpp"
+#include "StandardExceptions.hpp"
+#include <stddef.h>
+#include <stdint.h>
+
+
+/// @defgroup timer_wheel Timer wheel
+/// @ingroup utilities
+/// @brief Schedules many timeouts with constant-time insertion and expiry
+
+#ifdef __WSTL_CXX11__
+namespace wstl {
+    namespace __private {
+        template<size_t N>
+        struct __TimerWheelLog2 {
+            static const __WSTL_CONSTEXPR__ size_t Value = 1 + __TimerWheelLog2<N / 2>::Value;
+        };
+
+        template<>
+        struct __TimerWheelLog2<1> {
+            static const __WSTL_CONSTEXPR__ size_t Value = 0;
+        };
+    }
+
+    // Timer wheel
+
+    /// @brief Hierarchical timing wheel with `Levels` levels of `N` slots each
+    /// @tparam N Number of slots in a level, a power of two
+    /// @tparam Levels Number of levels, the longest delay is `N` to the power of `Levels` minus one ticks
+    /// @tparam Callback Type of the callable stored in a timer, called without arguments
+    /// @details A slot of level `L` covers `N` to the power of `L` ticks. A timer goes into the lowest
+    /// level whose range covers its delay, in the slot of its expiry tick, so `Schedule` and `Cancel`
+    /// only link or unlink it. Every tick runs the timers in one slot of the first level. When the first
+    /// level wraps around, the timers of the next slot of the second level are cascaded down, and
+    /// so on up the levels, which makes `Tick` amortized O(1). Every level keeps a bitmap of its
+    /// non-empty slots, so `TicksUntilNext` finds the next wake-up with a few `CountRightZero` calls
+    /// and `Advance` skips idle stretches at once.
+    ///
+    /// Timers are owned by the caller and linked into slots through an intrusive hook, the wheel never
+    /// allocates. A timer must be cancelled before it is destroyed. Callbacks run after their timer is
+    /// unlinked, so they may schedule it again to make it periodic
+    /// @ingroup timer_wheel
+    ///
+    /// @code
+    /// typedef TimerWheel<64, 3> Wheel;
+    ///
+    /// Wheel wheel;
+    /// Wheel::Timer retransmit([] { SendAgain(); });
+    ///
+    /// wheel.Schedule(retransmit, 200);
+    /// // From the tick interrupt or after waking up from idle
+    /// wheel.Advance(elapsed);
+    /// @endcode
+    /// @since C++11
+    template<size_t N, size_t Levels, typename Callback = InplaceFunction<void()> >
+    class TimerWheel {
+    public:
+        WSTL_STATIC_ASSERT(N >= 2 && (N & (N - 1)) == 0, "Timer wheel slot count must be a power of two");
+        WSTL_STATIC_ASSERT(Levels > 0, "Timer wheel must have at least one level");
+        WSTL_STATIC_ASSERT(__private::__TimerWheelLog2<N>::Value * Levels <= 32, "Timer wheel range must fit in the tick type");
+
+        typedef uint32_t TickType;
+        typedef size_t SizeType;
+        typedef Callback CallbackType;
+
+        /// @brief A timeout that can be scheduled on the wheel
+        class Timer {
+        public:
+            /// @brief Default constructor, creates a timer without a callback
+            Timer() : m_Callback(), m_Expiry(0), m_Bucket(0) {}
+
+            /// @brief Constructor that stores a callback
+            /// @param callback The callable to run when the timer expires
+            explicit Timer(CallbackType&& callback) : m_Callback(Move(callback)), m_Expiry(0), m_Bucket(0) {}
+
+            /// @brief Replaces the callback, the timer must not be scheduled
+            /// @param callback The callable to run when the timer expires
+            void SetCallback(CallbackType&& callback) {
+                m_Callback = Move(callback);
+            }
+
+            /// @brief Checks if the timer is scheduled on a wheel
+            bool Scheduled() const {
+                return m_Hook.Next != NullPointer;
+            }
+
+            /// @brief Gets the tick the timer expires at, meaningful only while it is scheduled
+            TickType Expiry() const {
+                return m_Expiry;
+            }
+
+        private:
+            friend class TimerWheel;
+
+            ListNode m_Hook;
+            CallbackType m_Callback;
+            TickType m_Expiry;
+            SizeType m_Bucket;
+
+            Timer(const Timer&) = delete;
+            Timer& operator=(const Timer&) = delete;
+        };
+
+        /// @brief The longest delay a timer can be scheduled with
+        static const __WSTL_CONSTEXPR__ TickType MaximumDelay = TickType((uint64_t(1) << (__private::__TimerWheelLog2<N>::Value * Levels)) - 1);
+
+        /// @brief Default constructor, creates an empty wheel at tick 0
+        TimerWheel() : m_Now(0), m_Size(0) {
+            for(SizeType i = 0; i < Levels * WordCount; ++i) m_Bitmaps[i] = 0;
+        }
+
+        /// @brief Gets the current tick
+        TickType Now() const {
+            return m_Now;
+        }
+
+        /// @brief Gets the number of scheduled timers
+        SizeType Size() const {
+            return m_Size;
+        }
+
+        /// @brief Checks if no timer is scheduled
+        bool Empty() const {
+            return m_Size == 0;
+        }
+
+        /// @brief Schedules a timer to expire after a number of ticks
+        /// @param timer The timer to schedule, must not be scheduled already
+        /// @param delay The number of ticks from now, 0 is treated as 1 and longer than `MaximumDelay` as `MaximumDelay`
+        /// @throws `LogicError` if the timer is already scheduled
+        void Schedule(Timer& timer, TickType delay) {
+            __WSTL_ASSERT_RETURN__(!timer.Scheduled(), WSTL_MAKE_EXCEPTION(LogicError, "Timer already scheduled"));
+
+            if(delay == 0) delay = 1;
+            else if(delay > MaximumDelay) delay = MaximumDelay;
+
+            timer.m_Expiry = m_Now + delay;
+            Link(timer);
+            ++m_Size;
+        }
+
+        /// @brief Cancels a timer, does nothing if it is not scheduled
+        /// @param timer The timer to cancel, must not be scheduled on another wheel
+        void Cancel(Timer& timer) {
+            if(!timer.Scheduled()) return;
+
+            Unlink(timer);
+            --m_Size;
+        }
+
+        /// @brief Moves to the next tick and runs the timers that expire on it
+        void Tick() {
+            ++m_Now;
+
+            // A level is cascaded when the one below wraps around, its timers land in lower slots that come up later
+            SizeType index = m_Now & Mask;
+            for(SizeType level = 1; index == 0 && level < Levels; ++level) {
+                index = (m_Now >> (level * Shift)) & Mask;
+                Cascade(level * N + index);
+            }
+
+            BucketType& bucket = m_Buckets[m_Now & Mask];
+
+            while(!bucket.Empty()) {
+                Timer& timer = bucket.Front();
+                Unlink(timer);
+                --m_Size;
+
+                if(timer.m_Callback) timer.m_Callback();
+            }
+        }
+
+        /// @brief Moves a number of ticks forward, running every timer that expires on the way
+        /// @details Stretches without expiries or cascades are skipped in one step, so this is cheap
+        /// to call after waking up from a tickless idle period
+        /// @param ticks The number of ticks to move
+        void Advance(TickType ticks) {
+            while(ticks > 0) {
+                const TickType next = TicksUntilNext();
+
+                if(next == 0 || next > ticks) {
+                    m_Now += ticks;
+                    return;
+                }
+
+                m_Now += next - 1;
+                ticks -= next;
+                Tick();
+            }
+        }
+
+        /// @brief Gets the number of ticks until the wheel next needs a `Tick`
+        /// @details This is when the earliest timer expires or, if a timer on a higher level comes
+        /// first, when it is cascaded, which is never later than its expiry. A tickless system can
+        /// sleep this long and then call `Advance`, and compute the value again
+        /// @return The number of ticks, at least 1, or 0 if no timer is scheduled
+        TickType TicksUntilNext() const {
+            if(Empty()) return 0;
+
+            TickType result = 0;
+
+            for(SizeType level = 0; level < Levels; ++level) {
+                const SizeType shift = level * Shift;
+                const SizeType index = (m_Now >> shift) & Mask;
+                const SizeType distance = NextSlot(level, (index + 1) & Mask) + 1;
+
+                if(distance > N) continue;
+
+                // The slot comes up when the lower levels wrap around into it
+                const TickType when = TickType((((m_Now >> shift) + distance) << shift) - m_Now);
+                if(result == 0 || when < result) result = when;
+            }
+
+            return result;
+        }
+
+        /// @brief Cancels all timers without running them
+        void Clear() {
+            for(SizeType i = 0; i < Levels * N; ++i) {
+                while(!m_Buckets[i].Empty()) Unlink(m_Buckets[i].Front());
+            }
+
+            m_Size = 0;
+        }
+
+    private:
+        typedef IntrusiveList<Timer, &Timer::m_Hook> BucketType;
+
+        static const __WSTL_CONSTEXPR__ SizeType Shift = __private::__TimerWheelLog2<N>::Value;
+        static const __WSTL_CONSTEXPR__ SizeType Mask = N - 1;
+        static const __WSTL_CONSTEXPR__ SizeType WordBits = N < 64 ? N : 64;
+        static const __WSTL_CONSTEXPR__ SizeType WordCount = N / WordBits;
+
+        BucketType m_Buckets[Levels * N];
+        uint64_t m_Bitmaps[Levels * WordCount];
+        TickType m_Now;
+        SizeType m_Size;
+
+        void Link(Timer& timer) {
+            const TickType delta = timer.m_Expiry - m_Now;
+
+            SizeType level = 0;
+            while(level + 1 < Levels && (delta >> ((level + 1) * Shift)) != 0) ++level;
+
+            const SizeType bucket = level * N + ((timer.m_Expiry >> (level * Shift)) & Mask);
+
+            timer.m_Bucket = bucket;
+            m_Buckets[bucket].PushBack(timer);
+            m_Bitmaps[bucket / WordBits] |= uint64_t(1) << (bucket % WordBits);
+        }
+
+        void Unlink(Timer& timer) {
+            BucketType& bucket = m_Buckets[timer.m_Bucket];
+            bucket.Erase(timer);
+
+            if(bucket.Empty()) m_Bitmaps[timer.m_Bucket / WordBits] &= ~(uint64_t(1) << (timer.m_Bucket % WordBits));
+        }
+
+        void Cascade(SizeType index) {
+            BucketType& bucket = m_Buckets[index];
+
+            while(!bucket.Empty()) {
+                Timer& timer = bucket.Front();
+                Unlink(timer);
+                Link(timer);
+            }
+        }
+
+        /// Distance from a slot to the first non-empty slot of a level at or after it, wrapping around, `N` if none
+        SizeType NextSlot(SizeType level, SizeType start) const {
+            const uint64_t* bitmap = m_Bitmaps + level * WordCount;
+
+            for(SizeType scanned = 0; scanned < N;) {
+                const SizeType slot = (start + scanned) & Mask;
+                const uint64_t bits = bitmap[slot / WordBits] >> (slot % WordBits);
+
+                if(bits != 0) {
+                    const SizeType distance = scanned + CountRightZero(bits);
+                    return distance < N ? distance : N;
+                }
+
+                scanned += WordBits - slot % WordBits;
+            }
+
+            return N;
+        }
+    };
+
+    template<size_t N, size_t Levels, typename Callback>
+    const __WSTL_CONSTEXPR__ typename TimerWheel<N, Levels, Callback>::TickType TimerWheel<N, Levels, Callback>::MaximumDelay;
+
+    template<size_t N, size_t Levels, typename Callback>
+    const __WSTL_CONSTEXPR__ typename TimerWheel<N, Levels, Callback>::SizeType TimerWheel<N, Levels, Callback>::Shift;
+
+    template<size_t N, size_t Levels, typename Callback>
+    const __WSTL_CONSTEXPR__ typename TimerWheel<N, Levels, Callback>::SizeType TimerWheel<N, Levels, Callback>::Mask;
+
+    template<size_t N, size_t Levels, typename Callback>
+    const __WSTL_CONSTEXPR__ typename TimerWheel<N, Levels, Callback>::SizeType TimerWheel<N, Levels, Callback>::WordBits;
+
+    template<size_t N, size_t Levels, typename Callback>
+    const __WSTL_CONSTEXPR__ typename TimerWheel<N, Levels, Callback>::SizeType TimerWheel<N, Levels, Callback>::WordCount;
+}
+#endif
+
+#endif
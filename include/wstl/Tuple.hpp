@@ -73,12 +73,12 @@ namespace wstl {
 
             template<typename Head, typename... Tail>
             static inline __WSTL_CONSTEXPR14__ Head&& Get(Tuple<Head, Tail...>&& tuple) __WSTL_NOEXCEPT__ {
-                return Move(tuple.m_Head);
+                return Forward<Head>(tuple.m_Head);
             }
 
             template<typename Head, typename... Tail>
             static inline __WSTL_CONSTEXPR14__ const Head&& Get(const Tuple<Head, Tail...>&& tuple) __WSTL_NOEXCEPT__ {
-                return Move(tuple.m_Head);
+                return static_cast<const Head&&>(tuple.m_Head);
             }
         };
 
@@ -293,7 +293,7 @@ namespace wstl {
         Conjunction<IsAssignable<Head&, UHead>, IsAssignable<Tail&, UTail>...>::Value, int> = 0>
         __WSTL_CONSTEXPR14__ Tuple& operator=(Tuple<UHead, UTail...>&& other) __WSTL_NOEXCEPT__ {
             m_Head = Forward<UHead>(other.m_Head);
-            m_Tail = Forward<UTail...>(other.m_Tail);
+            m_Tail = Forward<Tuple<UTail...>>(other.m_Tail);
             return *this;
         }
         
@@ -384,7 +384,7 @@ namespace wstl {
 
     /// @copydoc Get(Tuple<Types...>&)
     template<size_t Index, typename... Types>
-    __WSTL_CONSTEXPR14__ inline TupleElementType<Index, Tuple<Types...>>& Get(const Tuple<Types...>& tuple) __WSTL_NOEXCEPT__ {
+    __WSTL_CONSTEXPR14__ inline const TupleElementType<Index, Tuple<Types...>>& Get(const Tuple<Types...>& tuple) __WSTL_NOEXCEPT__ {
         WSTL_STATIC_ASSERT(Index < sizeof...(Types), "Index out of bounds");
         return __private::__TupleGet<Index>::Get(tuple);
     }
@@ -2199,6 +2199,26 @@ namespace wstl {
     inline constexpr bool IsTriviallyCopyableVariable = IsTriviallyCopyable<T>::Value;
     #endif
 
+    // Is trivially relocatable
+
+    /// @brief Checks whether an object of the type can be moved to another address by copying its
+    /// bytes, after which the original is treated as destroyed
+    /// @tparam T Type to check
+    /// @details True for scalar and trivially copyable types. Containers use it to shift and relocate
+    /// elements with `memmove` instead of moving and destroying them one by one. Specialize it as
+    /// `TrueType` for a type that has a non-trivial copy or destructor but holds no pointer into
+    /// itself, such as a handle that releases a resource on destruction
+    /// @ingroup type_traits
+    template<typename T>
+    struct IsTriviallyRelocatable : BoolConstant<IsScalar<T>::Value || IsTriviallyCopyable<T>::Value> {};
+
+    #ifdef __WSTL_CXX17__
+    /// @copydoc IsTriviallyRelocatable
+    /// @since C++17
+    template<typename T>
+    inline constexpr bool IsTriviallyRelocatableVariable = IsTriviallyRelocatable<T>::Value;
+    #endif
+
     // Is lvalue reference
 
     namespace __private {
@@ -0,0 +1,1516 @@
+// Part of WardenSTL - https://github.com/WardenHD/WardenSTL
+// Copyright (c) 2025 Artem Bezruchko (WardenHD)
+//
+// Licensed under the MIT License. See LICENSE file for details.
+
+#ifndef __WSTL_UNROLLEDLIST_HPP__
+#define __WSTL_UNROLLEDLIST_HPP__
+
+#include "private/Platform.hpp"
+#include "Container.hpp"
+#include "List.hpp"
+#include "Iterator.hpp"
+#include "InitializerList.hpp"
+#include "StandardExceptions.hpp"
+#include "PlacementNew.hpp"
+#include "Algorithm.hpp"
+#include "Span.hpp"
+#include "NullPointer.hpp"
+#include "private/Error.hpp"
+#include <stddef.h>
+#include <stdint.h>
+
+
+/// @defgroup unrolled_list Unrolled list
+/// @ingroup containers
+/// @brief A doubly linked list whose nodes hold several elements each
+
+namespace wstl {
+    namespace __private {
+        /// @brief Smallest unsigned type that can count up to `K` elements
+        template<size_t K>
+        struct __UnrolledListCount {
+            typedef typename Conditional<(K < 256), uint8_t, typename Conditional<(K < 65536), uint16_t, size_t>::Type>::Type Type;
+        };
+    }
+
+    // Unrolled list node
+
+    /// @brief Node type of the unrolled list, holds up to `K` elements and their count
+    /// @tparam T Type of the elements
+    /// @tparam K Number of elements in a node
+    /// @ingroup unrolled_list
+    template<typename T, size_t K>
+    struct UnrolledListNode : ListNode {
+        typedef typename __private::__UnrolledListCount<K>::Type CountType;
+
+        UnrolledListNode() : ListNode(), Count(0) {}
+
+        CountType Count;
+        typename AlignedStorage<sizeof(T) * K, AlignmentOf<T>::Value>::Type Data;
+    };
+
+    // Basic unrolled list
+
+    /// @brief A doubly linked list whose nodes hold up to `K` elements each
+    /// @tparam Storage The storage type used by the list, its nodes are stored as `UnrolledListNode`
+    /// @tparam K Number of elements in a node
+    /// @details Nodes are taken from and returned to a free list threaded through the storage, like
+    /// `BasicList` does, but each one carries `K` elements, so the links cost two pointers per `K`
+    /// elements and traversal walks contiguous runs. Inserting into a full node splits it in half
+    /// and an erase that leaves a node less than half full merges it with a neighbour that has room.
+    /// When no node is free, the elements are packed into as few nodes as possible, so a storage of
+    /// `M` nodes always fits `(M - 1) * K` elements. Inserting or erasing moves the elements behind
+    /// the position inside its node, so iterators and references into that node are invalidated,
+    /// those into other nodes stay valid unless the list had to be packed
+    /// @ingroup unrolled_list
+    /// @see https://en.wikipedia.org/wiki/Unrolled_linked_list
+    template<typename Storage, size_t K>
+    class BasicUnrolledList {
+    public:
+        WSTL_STATIC_ASSERT(!IsVoid<Storage>::Value, "Storage must be non-void");
+        WSTL_STATIC_ASSERT(K != 0, "Node must hold at least one element");
+
+        typedef typename Storage::ValueType ValueType;
+        typedef typename Storage::SizeType SizeType;
+        typedef ptrdiff_t DifferenceType;
+        typedef ValueType& ReferenceType;
+        typedef const ValueType& ConstReferenceType;
+        typedef ValueType* PointerType;
+        typedef const ValueType* ConstPointerType;
+
+        typedef UnrolledListNode<ValueType, K> NodeType;
+        typedef typename StorageTraits<Storage>::template Rebind<NodeType>::Other StorageType;
+
+        /// @brief Number of elements in a node
+        static const __WSTL_CONSTEXPR__ SizeType NodeSize = K;
+
+    private:
+        template<bool IsConst>
+        class UnrolledListIterator : public wstl::Iterator<BidirectionalIteratorTag, typename Conditional<IsConst, const ValueType, ValueType>::Type> {
+        private:
+            typedef wstl::Iterator<BidirectionalIteratorTag, typename Conditional<IsConst, const ValueType, ValueType>::Type> IteratorBase;
+            typedef typename Conditional<IsConst, const ListNode*, ListNode*>::Type NodePointer;
+
+        public:
+            typedef typename IteratorBase::ReferenceType ReferenceType;
+            typedef typename IteratorBase::PointerType PointerType;
+            typedef typename IteratorBase::DifferenceType DifferenceType;
+
+            friend class BasicUnrolledList;
+            friend class UnrolledListIterator<!IsConst>;
+
+            /// @brief Default constructor
+            UnrolledListIterator() : m_Node(NullPointer), m_Index(0) {}
+
+            /// @brief Copy constructor
+            /// @param other Iterator to copy from
+            UnrolledListIterator(const UnrolledListIterator& other) : m_Node(other.m_Node), m_Index(other.m_Index) {}
+
+            /// @brief Converting constructor from a mutable iterator
+            /// @param other Iterator to convert from
+            template<bool OtherConst>
+            UnrolledListIterator(const UnrolledListIterator<OtherConst>& other,
+                typename EnableIf<IsConst && !OtherConst, int>::Type = 0) : m_Node(other.m_Node), m_Index(other.m_Index) {}
+
+            /// @brief Copy assignment operator
+            /// @param other Iterator to assign from
+            UnrolledListIterator& operator=(const UnrolledListIterator& other) {
+                m_Node = other.m_Node;
+                m_Index = other.m_Index;
+                return *this;
+            }
+
+            /// @brief Dereference operator
+            /// @details If iterator points to the end, behavior is undefined
+            ReferenceType operator*() const {
+                return Elements(m_Node)[m_Index];
+            }
+
+            /// @brief Arrow operator
+            /// @details If iterator points to the end, behavior is undefined
+            PointerType operator->() const {
+                return Elements(m_Node) + m_Index;
+            }
+
+            /// @brief Pre-increment operator - moves the iterator forward by one element
+            /// @return Reference to the updated iterator
+            UnrolledListIterator& operator++() {
+                if(++m_Index == static_cast<SizeType>(NodeCast(m_Node)->Count)) {
+                    m_Node = m_Node->Next;
+                    m_Index = 0;
+                }
+
+                return *this;
+            }
+
+            /// @brief Post-increment operator - moves the iterator forward by one element
+            /// @return Copy of the iterator before incrementing
+            UnrolledListIterator operator++(int) {
+                UnrolledListIterator original(*this);
+                ++*this;
+                return original;
+            }
+
+            /// @brief Pre-decrement operator - moves the iterator backwards by one element
+            /// @return Reference to the updated iterator
+            UnrolledListIterator& operator--() {
+                if(m_Index == 0) {
+                    m_Node = m_Node->Previous;
+                    m_Index = NodeCast(m_Node)->Count;
+                }
+
+                --m_Index;
+                return *this;
+            }
+
+            /// @brief Post-decrement operator - moves the iterator backwards by one element
+            /// @return Copy of the iterator before decrementing
+            UnrolledListIterator operator--(int) {
+                UnrolledListIterator original(*this);
+                --*this;
+                return original;
+            }
+
+            friend bool operator==(const UnrolledListIterator& a, const UnrolledListIterator& b) {
+                return a.m_Node == b.m_Node && a.m_Index == b.m_Index;
+            }
+
+            friend bool operator!=(const UnrolledListIterator& a, const UnrolledListIterator& b) {
+                return !(a == b);
+            }
+
+        private:
+            NodePointer m_Node;
+            SizeType m_Index;
+
+            UnrolledListIterator(NodePointer node, SizeType index) : m_Node(node), m_Index(index) {}
+        };
+
+    public:
+        typedef UnrolledListIterator<false> Iterator;
+        typedef UnrolledListIterator<true> ConstIterator;
+        typedef wstl::ReverseIterator<Iterator> ReverseIterator;
+        typedef wstl::ReverseIterator<ConstIterator> ConstReverseIterator;
+
+        /// @brief Destructor
+        ~BasicUnrolledList() {
+            Clear();
+        }
+
+        /// @brief Copy assignment operator
+        /// @param other The list to copy from
+        /// @throws `LengthError` if the other list does not fit
+        BasicUnrolledList& operator=(const BasicUnrolledList& other) {
+            if(this != &other) Assign(other.Begin(), other.End());
+            return *this;
+        }
+
+        /// @brief Gets the number of elements in the list
+        __WSTL_CONSTEXPR__ SizeType Size() const __WSTL_NOEXCEPT__ {
+            return m_CurrentSize;
+        }
+
+        /// @brief Gets the number of elements the list is guaranteed to fit
+        __WSTL_CONSTEXPR__ SizeType Capacity() const __WSTL_NOEXCEPT__ {
+            return m_Storage.Capacity == 0 ? 0 : (m_Storage.Capacity - 1) * K;
+        }
+
+        /// @brief Gets the maximum size of the list
+        __WSTL_CONSTEXPR__ SizeType MaxSize() const __WSTL_NOEXCEPT__ {
+            return Capacity();
+        }
+
+        /// @brief Checks if the list is empty
+        __WSTL_CONSTEXPR__ bool Empty() const __WSTL_NOEXCEPT__ {
+            return m_CurrentSize == 0;
+        }
+
+        /// @brief Checks if the list is full
+        __WSTL_CONSTEXPR__ bool Full() const __WSTL_NOEXCEPT__ {
+            return m_CurrentSize >= Capacity();
+        }
+
+        /// @brief Gets the number of elements that can still be added
+        __WSTL_CONSTEXPR__ SizeType Available() const __WSTL_NOEXCEPT__ {
+            return Full() ? 0 : Capacity() - m_CurrentSize;
+        }
+
+        /// @brief Gets the number of nodes in use
+        SizeType NodeCount() const {
+            return m_NodeCount;
+        }
+
+        /// @brief Gets the number of nodes in the storage
+        SizeType NodeCapacity() const {
+            return m_Storage.Capacity;
+        }
+
+        /// @brief Assigns a number of copies of a value to the list
+        /// @param count The number of elements
+        /// @param value The value to fill the list with
+        /// @throws `LengthError` if the count exceeds the capacity
+        void Assign(SizeType count, ConstReferenceType value) {
+            __WSTL_ASSERT_RETURN__(count <= Capacity(), WSTL_MAKE_EXCEPTION(LengthError, "Unrolled list overflow"));
+
+            Clear();
+            while(m_CurrentSize < count) EmplaceBack(value);
+        }
+
+        /// @brief Assigns a range of elements to the list
+        /// @param first Iterator to the first element in the range
+        /// @param last Iterator to the element following the last element in the range
+        /// @throws `LengthError` if the range does not fit
+        template<typename InputIterator>
+        typename EnableIf<!IsIntegral<InputIterator>::Value, void>::Type Assign(InputIterator first, InputIterator last) {
+            Clear();
+            for(; first != last; ++first) {
+                __WSTL_ASSERT_RETURN__(!Full(), WSTL_MAKE_EXCEPTION(LengthError, "Unrolled list overflow"));
+                EmplaceBack(*first);
+            }
+        }
+
+        #if defined(__WSTL_CXX11__) && !defined(__WSTL_NO_INITIALIZERLIST__)
+        /// @brief Assigns an initializer list to the list
+        /// @param list The initializer list to assign
+        /// @throws `LengthError` if the list does not fit
+        /// @since C++11
+        void Assign(InitializerList<ValueType> list) {
+            Assign(list.Begin(), list.End());
+        }
+        #endif
+
+        /// @brief Gets the first element in the list
+        ReferenceType Front() {
+            return Elements(HeadNode())[0];
+        }
+
+        /// @brief Gets the first element in the list
+        ConstReferenceType Front() const {
+            return Elements(HeadNode())[0];
+        }
+
+        /// @brief Gets the last element in the list
+        ReferenceType Back() {
+            return Elements(TailNode())[NodeCast(TailNode())->Count - 1];
+        }
+
+        /// @brief Gets the last element in the list
+        ConstReferenceType Back() const {
+            return Elements(TailNode())[NodeCast(TailNode())->Count - 1];
+        }
+
+        /// @brief Gets iterator to the beginning of the list
+        Iterator Begin() {
+            return Iterator(HeadNode(), 0);
+        }
+
+        /// @brief Gets const iterator to the beginning of the list
+        ConstIterator Begin() const {
+            return ConstIterator(HeadNode(), 0);
+        }
+
+        /// @brief Gets const iterator to the beginning of the list
+        ConstIterator ConstBegin() const {
+            return ConstIterator(HeadNode(), 0);
+        }
+
+        /// @brief Gets iterator to the end of the list
+        Iterator End() {
+            return Iterator(&m_Sentinel, 0);
+        }
+
+        /// @brief Gets const iterator to the end of the list
+        ConstIterator End() const {
+            return ConstIterator(&m_Sentinel, 0);
+        }
+
+        /// @brief Gets const iterator to the end of the list
+        ConstIterator ConstEnd() const {
+            return ConstIterator(&m_Sentinel, 0);
+        }
+
+        /// @brief Gets reverse iterator to the beginning of the list
+        ReverseIterator ReverseBegin() {
+            return ReverseIterator(End());
+        }
+
+        /// @brief Gets const reverse iterator to the beginning of the list
+        ConstReverseIterator ReverseBegin() const {
+            return ConstReverseIterator(End());
+        }
+
+        /// @brief Gets const reverse iterator to the beginning of the list
+        ConstReverseIterator ConstReverseBegin() const {
+            return ConstReverseIterator(End());
+        }
+
+        /// @brief Gets reverse iterator to the end of the list
+        ReverseIterator ReverseEnd() {
+            return ReverseIterator(Begin());
+        }
+
+        /// @brief Gets const reverse iterator to the end of the list
+        ConstReverseIterator ReverseEnd() const {
+            return ConstReverseIterator(Begin());
+        }
+
+        /// @brief Gets const reverse iterator to the end of the list
+        ConstReverseIterator ConstReverseEnd() const {
+            return ConstReverseIterator(Begin());
+        }
+
+        /// @brief Calls a function on the elements of every node, front to back
+        /// @param function Function that takes a `Span` of elements
+        /// @return The function
+        template<typename Function>
+        Function ForEachSegment(Function function) {
+            for(ListNode* i = HeadNode(); i != &m_Sentinel; i = i->Next) function(Span<ValueType>(Elements(i), NodeCast(i)->Count));
+            return function;
+        }
+
+        /// @copydoc ForEachSegment(Function)
+        template<typename Function>
+        Function ForEachSegment(Function function) const {
+            for(const ListNode* i = HeadNode(); i != &m_Sentinel; i = i->Next) function(Span<const ValueType>(Elements(i), NodeCast(i)->Count));
+            return function;
+        }
+
+        /// @brief Removes all elements and returns their nodes to the free list
+        void Clear() {
+            while(HeadNode() != &m_Sentinel) {
+                NodeType* const node = NodeCast(HeadNode());
+                Destroy(Elements(node), node->Count);
+                m_CurrentSize -= node->Count;
+                FreeNode(node);
+            }
+        }
+
+        /// @brief Packs the elements into as few nodes as possible and returns the rest to the free list
+        /// @details Invalidates all iterators and references
+        void Compact() {
+            if(Empty()) return;
+
+            ListNode* write = HeadNode();
+            SizeType written = 0;
+
+            for(ListNode* read = HeadNode(); read != &m_Sentinel; read = read->Next) {
+                const SizeType count = NodeCast(read)->Count;
+
+                for(SizeType i = 0; i < count; ++i) {
+                    if(written == K) {
+                        write = write->Next;
+                        written = 0;
+                    }
+
+                    if(write != read || written != i) Relocate(Elements(read) + i, Elements(write) + written);
+                    ++written;
+                }
+            }
+
+            // Nodes before the write position are full, the ones after it were emptied
+            for(ListNode* i = HeadNode(); i != write; i = i->Next) NodeCast(i)->Count = static_cast<typename NodeType::CountType>(K);
+            NodeCast(write)->Count = static_cast<typename NodeType::CountType>(written);
+
+            while(write->Next != &m_Sentinel) FreeNode(NodeCast(write->Next));
+        }
+
+        /// @brief Inserts an element at specified position in the list
+        /// @param position The position to insert the element at
+        /// @param value The value to insert
+        /// @return Iterator to the newly inserted element
+        /// @throws `LengthError` if the list is full
+        Iterator Insert(ConstIterator position, ConstReferenceType value) {
+            return Emplace(position, value);
+        }
+
+        #ifdef __WSTL_CXX11__
+        /// @brief Inserts an element at specified position in the list
+        /// @param position The position to insert the element at
+        /// @param value The value to insert (rvalue reference)
+        /// @return Iterator to the newly inserted element
+        /// @throws `LengthError` if the list is full
+        /// @since C++11
+        Iterator Insert(ConstIterator position, ValueType&& value) {
+            return Emplace(position, Move(value));
+        }
+        #endif
+
+        /// @brief Inserts a number of copies of a value at specified position in the list
+        /// @param position The position to insert the elements at
+        /// @param count The number of elements to insert
+        /// @param value The value to insert
+        /// @return Iterator to the first inserted element, or `position` if the count is zero
+        /// @throws `LengthError` if the elements do not fit
+        Iterator Insert(ConstIterator position, SizeType count, ConstReferenceType value) {
+            __WSTL_ASSERT_RETURNVALUE__(count <= Available(), WSTL_MAKE_EXCEPTION(LengthError, "Unrolled list overflow"), ToIterator(position));
+
+            // Later insertions may split or pack the node of the first one, so remember it as an offset
+            const SizeType offset = OffsetOf(position.m_Node, position.m_Index);
+            for(SizeType i = 0; i < count; ++i) position = ++Emplace(position, value);
+
+            return IteratorAt(offset);
+        }
+
+        /// @brief Inserts a range of elements at specified position in the list
+        /// @param position The position to insert the elements at
+        /// @param first Iterator to the first element in the range
+        /// @param last Iterator to the element following the last element in the range
+        /// @return Iterator to the first inserted element, or `position` if the range is empty
+        /// @throws `LengthError` if the elements do not fit
+        template<typename InputIterator>
+        typename EnableIf<!IsIntegral<InputIterator>::Value, Iterator>::Type
+        Insert(ConstIterator position, InputIterator first, InputIterator last) {
+            // Later insertions may split or pack the node of the first one, so remember it as an offset
+            const SizeType offset = OffsetOf(position.m_Node, position.m_Index);
+
+            for(; first != last; ++first) {
+                __WSTL_ASSERT_RETURNVALUE__(!Full(), WSTL_MAKE_EXCEPTION(LengthError, "Unrolled list overflow"), IteratorAt(offset));
+                position = ++Emplace(position, *first);
+            }
+
+            return IteratorAt(offset);
+        }
+
+        #if defined(__WSTL_CXX11__) && !defined(__WSTL_NO_INITIALIZERLIST__)
+        /// @brief Inserts an initializer list at specified position in the list
+        /// @param position The position to insert the elements at
+        /// @param list The initializer list to insert
+        /// @return Iterator to the first inserted element, or `position` if the list is empty
+        /// @throws `LengthError` if the elements do not fit
+        /// @since C++11
+        Iterator Insert(ConstIterator position, InitializerList<ValueType> list) {
+            return Insert(position, list.Begin(), list.End());
+        }
+        #endif
+
+        #ifdef __WSTL_CXX11__
+        /// @brief Emplaces an element at specified position in the list, constructing it in place
+        /// @param position The position to emplace the element at
+        /// @param ...args The arguments to forward to the constructor of the element
+        /// @return Iterator to the newly emplaced element
+        /// @throws `LengthError` if the list is full
+        /// @since C++11
+        template<typename... Args>
+        Iterator Emplace(ConstIterator position, Args&&... args) {
+            __WSTL_ASSERT_RETURNVALUE__(!Full(), WSTL_MAKE_EXCEPTION(LengthError, "Unrolled list full"), ToIterator(position));
+
+            ListNode* node = const_cast<ListNode*>(position.m_Node);
+            SizeType index = position.m_Index;
+
+            // The arguments may refer to elements of the list, which are moved by making room
+            ValueType value(Forward<Args>(args)...);
+
+            PointerType slot = MakeRoom(node, index);
+            ::new(slot) ValueType(Move(value));
+            Commit(node);
+
+            return Iterator(node, index);
+        }
+        #else
+        /// @brief Emplaces an element at specified position in the list, constructing it in place
+        /// @param position The position to emplace the element at
+        /// @return Iterator to the newly emplaced element
+        /// @throws `LengthError` if the list is full
+        Iterator Emplace(ConstIterator position) {
+            __WSTL_ASSERT_RETURNVALUE__(!Full(), WSTL_MAKE_EXCEPTION(LengthError, "Unrolled list full"), ToIterator(position));
+
+            ListNode* node = const_cast<ListNode*>(position.m_Node);
+            SizeType index = position.m_Index;
+
+            PointerType slot = MakeRoom(node, index);
+            ::new(slot) ValueType();
+            Commit(node);
+
+            return Iterator(node, index);
+        }
+
+        /// @brief Emplaces an element at specified position in the list, constructing it in place
+        /// @param position The position to emplace the element at
+        /// @param arg The argument to pass to the constructor of the element
+        /// @return Iterator to the newly emplaced element
+        /// @throws `LengthError` if the list is full
+        template<typename Arg>
+        Iterator Emplace(ConstIterator position, const Arg& arg) {
+            __WSTL_ASSERT_RETURNVALUE__(!Full(), WSTL_MAKE_EXCEPTION(LengthError, "Unrolled list full"), ToIterator(position));
+
+            ListNode* node = const_cast<ListNode*>(position.m_Node);
+            SizeType index = position.m_Index;
+
+            // The argument may refer to an element of the list, which is moved by making room
+            const ValueType value(arg);
+
+            PointerType slot = MakeRoom(node, index);
+            ::new(slot) ValueType(value);
+            Commit(node);
+
+            return Iterator(node, index);
+        }
+
+        /// @brief Emplaces an element at specified position in the list, constructing it in place
+        /// @param position The position to emplace the element at
+        /// @param arg1 The first argument to pass to the constructor of the element
+        /// @param arg2 The second argument to pass to the constructor of the element
+        /// @return Iterator to the newly emplaced element
+        /// @throws `LengthError` if the list is full
+        template<typename Arg1, typename Arg2>
+        Iterator Emplace(ConstIterator position, const Arg1& arg1, const Arg2& arg2) {
+            __WSTL_ASSERT_RETURNVALUE__(!Full(), WSTL_MAKE_EXCEPTION(LengthError, "Unrolled list full"), ToIterator(position));
+
+            ListNode* node = const_cast<ListNode*>(position.m_Node);
+            SizeType index = position.m_Index;
+
+            const ValueType value(arg1, arg2);
+
+            PointerType slot = MakeRoom(node, index);
+            ::new(slot) ValueType(value);
+            Commit(node);
+
+            return Iterator(node, index);
+        }
+
+        /// @brief Emplaces an element at specified position in the list, constructing it in place
+        /// @param position The position to emplace the element at
+        /// @param arg1 The first argument to pass to the constructor of the element
+        /// @param arg2 The second argument to pass to the constructor of the element
+        /// @param arg3 The third argument to pass to the constructor of the element
+        /// @return Iterator to the newly emplaced element
+        /// @throws `LengthError` if the list is full
+        template<typename Arg1, typename Arg2, typename Arg3>
+        Iterator Emplace(ConstIterator position, const Arg1& arg1, const Arg2& arg2, const Arg3& arg3) {
+            __WSTL_ASSERT_RETURNVALUE__(!Full(), WSTL_MAKE_EXCEPTION(LengthError, "Unrolled list full"), ToIterator(position));
+
+            ListNode* node = const_cast<ListNode*>(position.m_Node);
+            SizeType index = position.m_Index;
+
+            const ValueType value(arg1, arg2, arg3);
+
+            PointerType slot = MakeRoom(node, index);
+            ::new(slot) ValueType(value);
+            Commit(node);
+
+            return Iterator(node, index);
+        }
+        #endif
+
+        /// @brief Erases an element at specified position in the list
+        /// @param position The position of the element to erase
+        /// @return Iterator to the element following the erased element
+        Iterator Erase(ConstIterator position) {
+            return EraseAt(NodeCast(const_cast<ListNode*>(position.m_Node)), position.m_Index);
+        }
+
+        /// @brief Erases a range of elements from the list
+        /// @param first Iterator to the first element in the range to erase
+        /// @param last Iterator to the element following the last element in the range to erase
+        /// @return Iterator to the first element following the erased range
+        Iterator Erase(ConstIterator first, ConstIterator last) {
+            Iterator result = ToIterator(first);
+            for(SizeType count = Distance(first, last); count > 0; --count) result = Erase(result);
+
+            return result;
+        }
+
+        /// @brief Pushes an element to the back of the list
+        /// @param value The value to push to the back
+        /// @throws `LengthError` if the list is full and `__WSTL_ASSERT_PUSHPOP__` is defined
+        void PushBack(ConstReferenceType value) {
+            __WSTL_ASSERT_PUSHPOP_RETURN__(!Full(), WSTL_MAKE_EXCEPTION(LengthError, "Unrolled list full"));
+            Emplace(End(), value);
+        }
+
+        #ifdef __WSTL_CXX11__
+        /// @brief Pushes an element to the back of the list
+        /// @param value The value to push to the back (rvalue reference)
+        /// @throws `LengthError` if the list is full and `__WSTL_ASSERT_PUSHPOP__` is defined
+        /// @since C++11
+        void PushBack(ValueType&& value) {
+            __WSTL_ASSERT_PUSHPOP_RETURN__(!Full(), WSTL_MAKE_EXCEPTION(LengthError, "Unrolled list full"));
+            Emplace(End(), Move(value));
+        }
+
+        /// @brief Emplaces an element at the back of the list, constructing it in place
+        /// @param ...args The arguments to forward to the constructor of the element
+        /// @throws `LengthError` if the list is full and `__WSTL_ASSERT_PUSHPOP__` is defined
+        /// @since C++11
+        template<typename... Args>
+        void EmplaceBack(Args&&... args) {
+            __WSTL_ASSERT_PUSHPOP_RETURN__(!Full(), WSTL_MAKE_EXCEPTION(LengthError, "Unrolled list full"));
+            Emplace(End(), Forward<Args>(args)...);
+        }
+        #else
+        /// @brief Emplaces an element at the back of the list, constructing it in place
+        /// @throws `LengthError` if the list is full and `__WSTL_ASSERT_PUSHPOP__` is defined
+        void EmplaceBack() {
+            __WSTL_ASSERT_PUSHPOP_RETURN__(!Full(), WSTL_MAKE_EXCEPTION(LengthError, "Unrolled list full"));
+            Emplace(End());
+        }
+
+        /// @brief Emplaces an element at the back of the list, constructing it in place
+        /// @param arg The argument to pass to the constructor of the element
+        /// @throws `LengthError` if the list is full and `__WSTL_ASSERT_PUSHPOP__` is defined
+        template<typename Arg>
+        void EmplaceBack(const Arg& arg) {
+            __WSTL_ASSERT_PUSHPOP_RETURN__(!Full(), WSTL_MAKE_EXCEPTION(LengthError, "Unrolled list full"));
+            Emplace(End(), arg);
+        }
+
+        /// @brief Emplaces an element at the back of the list, constructing it in place
+        /// @param arg1 The first argument to pass to the constructor of the element
+        /// @param arg2 The second argument to pass to the constructor of the element
+        /// @throws `LengthError` if the list is full and `__WSTL_ASSERT_PUSHPOP__` is defined
+        template<typename Arg1, typename Arg2>
+        void EmplaceBack(const Arg1& arg1, const Arg2& arg2) {
+            __WSTL_ASSERT_PUSHPOP_RETURN__(!Full(), WSTL_MAKE_EXCEPTION(LengthError, "Unrolled list full"));
+            Emplace(End(), arg1, arg2);
+        }
+
+        /// @brief Emplaces an element at the back of the list, constructing it in place
+        /// @param arg1 The first argument to pass to the constructor of the element
+        /// @param arg2 The second argument to pass to the constructor of the element
+        /// @param arg3 The third argument to pass to the constructor of the element
+        /// @throws `LengthError` if the list is full and `__WSTL_ASSERT_PUSHPOP__` is defined
+        template<typename Arg1, typename Arg2, typename Arg3>
+        void EmplaceBack(const Arg1& arg1, const Arg2& arg2, const Arg3& arg3) {
+            __WSTL_ASSERT_PUSHPOP_RETURN__(!Full(), WSTL_MAKE_EXCEPTION(LengthError, "Unrolled list full"));
+            Emplace(End(), arg1, arg2, arg3);
+        }
+        #endif
+
+        /// @brief Pops the last element from the list
+        /// @throws `OutOfRange` if the list is empty and `__WSTL_ASSERT_PUSHPOP__` is defined
+        void PopBack() {
+            __WSTL_ASSERT_PUSHPOP_RETURN__(!Empty(), WSTL_MAKE_EXCEPTION(OutOfRange, "Unrolled list empty"));
+
+            NodeType* const tail = NodeCast(TailNode());
+            EraseAt(tail, tail->Count - 1);
+        }
+
+        /// @brief Pushes an element to the front of the list
+        /// @param value The value to push to the front
+        /// @throws `LengthError` if the list is full and `__WSTL_ASSERT_PUSHPOP__` is defined
+        void PushFront(ConstReferenceType value) {
+            __WSTL_ASSERT_PUSHPOP_RETURN__(!Full(), WSTL_MAKE_EXCEPTION(LengthError, "Unrolled list full"));
+            Emplace(Begin(), value);
+        }
+
+        #ifdef __WSTL_CXX11__
+        /// @brief Pushes an element to the front of the list
+        /// @param value The value to push to the front (rvalue reference)
+        /// @throws `LengthError` if the list is full and `__WSTL_ASSERT_PUSHPOP__` is defined
+        /// @since C++11
+        void PushFront(ValueType&& value) {
+            __WSTL_ASSERT_PUSHPOP_RETURN__(!Full(), WSTL_MAKE_EXCEPTION(LengthError, "Unrolled list full"));
+            Emplace(Begin(), Move(value));
+        }
+
+        /// @brief Emplaces an element at the front of the list, constructing it in place
+        /// @param ...args The arguments to forward to the constructor of the element
+        /// @throws `LengthError` if the list is full and `__WSTL_ASSERT_PUSHPOP__` is defined
+        /// @since C++11
+        template<typename... Args>
+        void EmplaceFront(Args&&... args) {
+            __WSTL_ASSERT_PUSHPOP_RETURN__(!Full(), WSTL_MAKE_EXCEPTION(LengthError, "Unrolled list full"));
+            Emplace(Begin(), Forward<Args>(args)...);
+        }
+        #else
+        /// @brief Emplaces an element at the front of the list, constructing it in place
+        /// @throws `LengthError` if the list is full and `__WSTL_ASSERT_PUSHPOP__` is defined
+        void EmplaceFront() {
+            __WSTL_ASSERT_PUSHPOP_RETURN__(!Full(), WSTL_MAKE_EXCEPTION(LengthError, "Unrolled list full"));
+            Emplace(Begin());
+        }
+
+        /// @brief Emplaces an element at the front of the list, constructing it in place
+        /// @param arg The argument to pass to the constructor of the element
+        /// @throws `LengthError` if the list is full and `__WSTL_ASSERT_PUSHPOP__` is defined
+        template<typename Arg>
+        void EmplaceFront(const Arg& arg) {
+            __WSTL_ASSERT_PUSHPOP_RETURN__(!Full(), WSTL_MAKE_EXCEPTION(LengthError, "Unrolled list full"));
+            Emplace(Begin(), arg);
+        }
+
+        /// @brief Emplaces an element at the front of the list, constructing it in place
+        /// @param arg1 The first argument to pass to the constructor of the element
+        /// @param arg2 The second argument to pass to the constructor of the element
+        /// @throws `LengthError` if the list is full and `__WSTL_ASSERT_PUSHPOP__` is defined
+        template<typename Arg1, typename Arg2>
+        void EmplaceFront(const Arg1& arg1, const Arg2& arg2) {
+            __WSTL_ASSERT_PUSHPOP_RETURN__(!Full(), WSTL_MAKE_EXCEPTION(LengthError, "Unrolled list full"));
+            Emplace(Begin(), arg1, arg2);
+        }
+
+        /// @brief Emplaces an element at the front of the list, constructing it in place
+        /// @param arg1 The first argument to pass to the constructor of the element
+        /// @param arg2 The second argument to pass to the constructor of the element
+        /// @param arg3 The third argument to pass to the constructor of the element
+        /// @throws `LengthError` if the list is full and `__WSTL_ASSERT_PUSHPOP__` is defined
+        template<typename Arg1, typename Arg2, typename Arg3>
+        void EmplaceFront(const Arg1& arg1, const Arg2& arg2, const Arg3& arg3) {
+            __WSTL_ASSERT_PUSHPOP_RETURN__(!Full(), WSTL_MAKE_EXCEPTION(LengthError, "Unrolled list full"));
+            Emplace(Begin(), arg1, arg2, arg3);
+        }
+        #endif
+
+        /// @brief Pops the first element from the list
+        /// @throws `OutOfRange` if the list is empty and `__WSTL_ASSERT_PUSHPOP__` is defined
+        void PopFront() {
+            __WSTL_ASSERT_PUSHPOP_RETURN__(!Empty(), WSTL_MAKE_EXCEPTION(OutOfRange, "Unrolled list empty"));
+            EraseAt(NodeCast(HeadNode()), 0);
+        }
+
+        /// @brief Resizes the list, appending default-constructed elements or removing elements from the back
+        /// @param count The new size of the list
+        /// @throws `LengthError` if the count exceeds the capacity
+        void Resize(SizeType count) {
+            __WSTL_ASSERT_RETURN__(count <= Capacity(), WSTL_MAKE_EXCEPTION(LengthError, "Unrolled list overflow"));
+
+            while(m_CurrentSize > count) PopBack();
+            while(m_CurrentSize < count) EmplaceBack();
+        }
+
+        /// @brief Resizes the list, appending copies of a value or removing elements from the back
+        /// @param count The new size of the list
+        /// @param value The value to append
+        /// @throws `LengthError` if the count exceeds the capacity
+        void Resize(SizeType count, ConstReferenceType value) {
+            __WSTL_ASSERT_RETURN__(count <= Capacity(), WSTL_MAKE_EXCEPTION(LengthError, "Unrolled list overflow"));
+
+            while(m_CurrentSize > count) PopBack();
+            while(m_CurrentSize < count) EmplaceBack(value);
+        }
+
+        /// @brief Moves the elements of another list to the specified position, leaving the other list empty
+        /// @param position The position to splice at
+        /// @param other The list to splice from
+        /// @throws `LengthError` if the elements do not fit
+        void Splice(ConstIterator position, BasicUnrolledList& other) {
+            if(this == &other) return;
+            __WSTL_ASSERT_RETURN__(other.Size() <= Available(), WSTL_MAKE_EXCEPTION(LengthError, "Unrolled list overflow"));
+
+            Insert(position, MakeMoveIterator(other.Begin()), MakeMoveIterator(other.End()));
+            other.Clear();
+        }
+
+        /// @brief Moves a range of elements to the specified position
+        /// @param position The position to splice at, must not lie inside the range
+        /// @param other The list to splice from
+        /// @param first The position of the first element in the range
+        /// @param last The position following the last element in the range
+        /// @throws `LengthError` if the elements do not fit, or if the list is spliced into itself
+        /// and there are no spare nodes to split the range boundaries with, even after packing it
+        /// @details Splicing within the same list splits the nodes at the range boundaries and at the
+        /// position, then relinks whole nodes, so only the elements of the split nodes are moved.
+        /// If too few nodes are free for the splits, the list is packed first like `Compact`
+        void Splice(ConstIterator position, BasicUnrolledList& other, ConstIterator first, ConstIterator last) {
+            if(first == last) return;
+
+            if(this != &other) {
+                __WSTL_ASSERT_RETURN__(SizeType(Distance(first, last)) <= Available(), WSTL_MAKE_EXCEPTION(LengthError, "Unrolled list overflow"));
+
+                Insert(position, MakeMoveIterator(other.ToIterator(first)), MakeMoveIterator(other.ToIterator(last)));
+                other.Erase(first, last);
+                return;
+            }
+
+            Iterator from = ToIterator(first);
+            Iterator to = ToIterator(last);
+            Iterator at = ToIterator(position);
+
+            if(NodeCapacity() - m_NodeCount < SplitCount(from, to, at)) {
+                // Packing moves the elements, so remember the positions as offsets
+                const SizeType fromOffset = OffsetOf(from.m_Node, from.m_Index);
+                const SizeType toOffset = OffsetOf(to.m_Node, to.m_Index);
+                const SizeType atOffset = OffsetOf(at.m_Node, at.m_Index);
+
+                Compact();
+                from = IteratorAt(fromOffset);
+                to = IteratorAt(toOffset);
+                at = IteratorAt(atOffset);
+
+                __WSTL_ASSERT_RETURN__(NodeCapacity() - m_NodeCount >= SplitCount(from, to, at), WSTL_MAKE_EXCEPTION(LengthError, "Unrolled list has no spare node"));
+            }
+
+            if(!Split(from, to, at) || !Split(to, from, at) || !Split(at, from, to)) return;
+
+            MoveNodeRange(at.m_Node, from.m_Node, to.m_Node);
+        }
+
+        /// @brief Removes all elements equal to a value
+        /// @param value The value to remove
+        /// @return The number of removed elements
+        SizeType Remove(ConstReferenceType value) {
+            const SizeType size = m_CurrentSize;
+
+            for(Iterator it = Begin(); it != End();) {
+                if(*it == value) it = Erase(it);
+                else ++it;
+            }
+
+            return size - m_CurrentSize;
+        }
+
+        /// @brief Removes all elements that satisfy a predicate
+        /// @param predicate The unary predicate
+        /// @return The number of removed elements
+        template<typename UnaryPredicate>
+        SizeType RemoveIf(UnaryPredicate predicate) {
+            const SizeType size = m_CurrentSize;
+
+            for(Iterator it = Begin(); it != End();) {
+                if(predicate(*it)) it = Erase(it);
+                else ++it;
+            }
+
+            return size - m_CurrentSize;
+        }
+
+        /// @brief Reverses the order of the elements
+        /// @details Reverses the elements inside every node and the order of the nodes, no element
+        /// changes its node
+        void Reverse() {
+            ListNode* node = &m_Sentinel;
+
+            do {
+                if(node != &m_Sentinel) wstl::Reverse(Elements(node), Elements(node) + NodeCast(node)->Count);
+
+                Swap(node->Previous, node->Next);
+                node = node->Previous;
+            } while(node != &m_Sentinel);
+        }
+
+        /// @brief Removes consecutive duplicate elements
+        /// @return The number of removed elements
+        SizeType Unique() {
+            return Unique(EqualTo<ValueType>());
+        }
+
+        /// @brief Removes consecutive elements that satisfy a predicate with the element before them
+        /// @param predicate The binary predicate
+        /// @return The number of removed elements
+        template<typename BinaryPredicate>
+        SizeType Unique(BinaryPredicate predicate) {
+            if(Empty()) return 0;
+
+            const SizeType size = m_CurrentSize;
+            Iterator previous = Begin();
+
+            for(Iterator it = Next(Begin()); it != End();) {
+                if(predicate(*previous, *it)) {
+                    // Erasing may move the previous element when nodes merge
+                    it = Erase(it);
+                    previous = Previous(it);
+                }
+                else previous = it++;
+            }
+
+            return size - m_CurrentSize;
+        }
+
+    protected:
+        /// @brief Default constructor, only for default-constructible storage
+        BasicUnrolledList() : m_Storage(), m_CurrentSize(0), m_NodeCount(0), m_HeadFree(NullPointer) {
+            Initialize();
+        }
+
+        /// @brief Constructor with storage, only for non-default-constructible storage
+        /// @param storage The storage of the nodes
+        explicit BasicUnrolledList(StorageType storage) : m_Storage(__WSTL_MOVE__(storage)), m_CurrentSize(0), m_NodeCount(0), m_HeadFree(NullPointer) {
+            Initialize();
+        }
+
+    private:
+        StorageType m_Storage;
+        SizeType m_CurrentSize;
+        SizeType m_NodeCount;
+        NodeType* m_HeadFree;
+        ListNode m_Sentinel;
+
+        /// @brief Deleted copy constructor, variants copy through assignment
+        BasicUnrolledList(const BasicUnrolledList&) __WSTL_DELETE__;
+
+        static NodeType* NodeCast(ListNode* node) {
+            return static_cast<NodeType*>(node);
+        }
+
+        static const NodeType* NodeCast(const ListNode* node) {
+            return static_cast<const NodeType*>(node);
+        }
+
+        static PointerType Elements(ListNode* node) {
+            return reinterpret_cast<PointerType>(&NodeCast(node)->Data);
+        }
+
+        static ConstPointerType Elements(const ListNode* node) {
+            return reinterpret_cast<ConstPointerType>(&NodeCast(node)->Data);
+        }
+
+        ListNode* HeadNode() {
+            return m_Sentinel.Next;
+        }
+
+        const ListNode* HeadNode() const {
+            return m_Sentinel.Next;
+        }
+
+        ListNode* TailNode() {
+            return m_Sentinel.Previous;
+        }
+
+        const ListNode* TailNode() const {
+            return m_Sentinel.Previous;
+        }
+
+        Iterator ToIterator(ConstIterator iterator) {
+            return Iterator(const_cast<ListNode*>(iterator.m_Node), iterator.m_Index);
+        }
+
+        static void LinkNodes(ListNode* left, ListNode* right) {
+            left->Next = right;
+            right->Previous = left;
+        }
+
+        static void LinkNodeBefore(ListNode* position, ListNode* node) {
+            LinkNodes(position->Previous, node);
+            LinkNodes(node, position);
+        }
+
+        /// @brief Moves the nodes in `[first, last)` before a position
+        static void MoveNodeRange(ListNode* position, ListNode* first, ListNode* last) {
+            if(position == first || position == last) return;
+
+            ListNode* const lastNode = last->Previous;
+
+            LinkNodes(first->Previous, last);
+            LinkNodes(position->Previous, first);
+            LinkNodes(lastNode, position);
+        }
+
+        /// @brief Threads the free list through the storage and empties the node list
+        void Initialize() {
+            for(SizeType i = 0; i + 1 < m_Storage.Capacity; ++i) m_Storage.Data[i].Next = &m_Storage.Data[i + 1];
+            if(m_Storage.Capacity != 0) {
+                m_Storage.Data[m_Storage.Capacity - 1].Next = NullPointer;
+                m_HeadFree = &m_Storage.Data[0];
+            }
+
+            LinkNodes(&m_Sentinel, &m_Sentinel);
+        }
+
+        /// @brief Takes a node from the free list
+        /// @return Null pointer if no node is free
+        NodeType* TakeNode() {
+            NodeType* const node = m_HeadFree;
+            if(node == NullPointer) return NullPointer;
+
+            m_HeadFree = NodeCast(node->Next);
+            node->Count = 0;
+            ++m_NodeCount;
+
+            return node;
+        }
+
+        /// @brief Unlinks an empty node and returns it to the free list
+        void FreeNode(NodeType* node) {
+            LinkNodes(node->Previous, node->Next);
+
+            node->Next = m_HeadFree;
+            m_HeadFree = node;
+            --m_NodeCount;
+        }
+
+        /// @brief Moves an element into uninitialized memory and destroys the original
+        static void Relocate(PointerType from, PointerType to) {
+            ::new(static_cast<void*>(to)) ValueType(__WSTL_MOVE__(*from));
+            from->~ValueType();
+        }
+
+        /// @brief Moves elements into uninitialized memory that lies before them or in another node
+        static void RelocateForward(PointerType from, SizeType count, PointerType to) {
+            for(SizeType i = 0; i < count; ++i) Relocate(from + i, to + i);
+        }
+
+        static void Destroy(PointerType first, SizeType count) {
+            for(SizeType i = 0; i < count; ++i) first[i].~ValueType();
+        }
+
+        /// @brief Makes a free slot for a new element before a position
+        /// @param node The node of the position, updated to the node of the slot
+        /// @param index The index of the position, updated to the index of the slot
+        /// @return Pointer to the uninitialized slot
+        PointerType MakeRoom(ListNode*& node, SizeType& index) {
+            if(node == &m_Sentinel || index == 0) {
+                // Appending to the node before the position fills nodes in order
+                ListNode* const previous = node->Previous;
+                if(previous != &m_Sentinel && NodeCast(previous)->Count < K) {
+                    node = previous;
+                    index = NodeCast(previous)->Count;
+                    return Elements(previous) + index;
+                }
+
+                if(node == &m_Sentinel || NodeCast(node)->Count == K) {
+                    NodeType* const fresh = TakeSpareNode(node, index);
+                    if(fresh == NullPointer) return MakeRoom(node, index);
+
+                    LinkNodeBefore(node, fresh);
+                    node = fresh;
+                    index = 0;
+                    return Elements(fresh);
+                }
+            }
+            else if(NodeCast(node)->Count == K) {
+                NodeType* const fresh = TakeSpareNode(node, index);
+                if(fresh == NullPointer) return MakeRoom(node, index);
+
+                // Move the upper half into a new node after this one
+                const SizeType half = K / 2;
+                RelocateForward(Elements(node) + half, K - half, Elements(fresh));
+                fresh->Count = static_cast<typename NodeType::CountType>(K - half);
+                NodeCast(node)->Count = static_cast<typename NodeType::CountType>(half);
+                LinkNodeBefore(node->Next, fresh);
+
+                if(index > half) {
+                    node = fresh;
+                    index -= half;
+                }
+            }
+
+            // Shift the elements behind the position to free the slot
+            PointerType const elements = Elements(node);
+            for(SizeType i = NodeCast(node)->Count; i > index; --i) Relocate(elements + i - 1, elements + i);
+
+            return elements + index;
+        }
+
+        /// @brief Takes a node from the free list, packs the list when none is left
+        /// @return Null pointer if the list was packed, the position is updated then
+        NodeType* TakeSpareNode(ListNode*& node, SizeType& index) {
+            NodeType* const fresh = TakeNode();
+            if(fresh != NullPointer) return fresh;
+
+            // Remember the position as an offset, packing moves the elements
+            const SizeType offset = OffsetOf(node, index);
+
+            Compact();
+
+            const Iterator position = IteratorAt(offset);
+            node = position.m_Node;
+            index = position.m_Index;
+
+            return NullPointer;
+        }
+
+        /// @brief Gets the number of elements before a position
+        SizeType OffsetOf(const ListNode* node, SizeType index) const {
+            for(const ListNode* i = HeadNode(); i != node; i = i->Next) index += NodeCast(i)->Count;
+            return index;
+        }
+
+        /// @brief Gets the position with a number of elements before it
+        Iterator IteratorAt(SizeType offset) {
+            ListNode* node = HeadNode();
+            for(; node != &m_Sentinel && offset >= NodeCast(node)->Count; node = node->Next) offset -= NodeCast(node)->Count;
+
+            return Iterator(node, offset);
+        }
+
+        /// @brief Accounts for the element constructed in the slot returned by `MakeRoom`
+        void Commit(ListNode* node) {
+            ++NodeCast(node)->Count;
+            ++m_CurrentSize;
+        }
+
+        /// @brief Erases an element and merges its node with a neighbour if it becomes sparse
+        Iterator EraseAt(NodeType* node, SizeType index) {
+            PointerType const elements = Elements(node);
+            SizeType count = node->Count;
+
+            elements[index].~ValueType();
+            RelocateForward(elements + index + 1, count - index - 1, elements + index);
+            node->Count = static_cast<typename NodeType::CountType>(--count);
+            --m_CurrentSize;
+
+            if(count == 0) {
+                ListNode* const next = node->Next;
+                FreeNode(node);
+                return Iterator(next, 0);
+            }
+
+            if(count < K / 2) {
+                ListNode* const next = node->Next;
+                ListNode* const previous = node->Previous;
+
+                if(next != &m_Sentinel && count + NodeCast(next)->Count <= K) {
+                    // Pull the next node in
+                    RelocateForward(Elements(next), NodeCast(next)->Count, elements + count);
+                    node->Count = static_cast<typename NodeType::CountType>(count + NodeCast(next)->Count);
+                    FreeNode(NodeCast(next));
+                }
+                else if(previous != &m_Sentinel && count + NodeCast(previous)->Count <= K) {
+                    // Push this node into the previous one
+                    const SizeType offset = NodeCast(previous)->Count;
+
+                    RelocateForward(elements, count, Elements(previous) + offset);
+                    NodeCast(previous)->Count = static_cast<typename NodeType::CountType>(offset + count);
+                    FreeNode(node);
+
+                    return index + offset < offset + count ? Iterator(previous, index + offset) : Iterator(previous->Next, 0);
+                }
+            }
+
+            return index < node->Count ? Iterator(node, index) : Iterator(node->Next, 0);
+        }
+
+        /// @brief Counts the distinct positions that do not start a node, each takes a spare node to split at
+        static SizeType SplitCount(const Iterator& first, const Iterator& last, const Iterator& position) {
+            return SizeType(first.m_Index != 0) + SizeType(last.m_Index != 0 && last != first) + SizeType(position.m_Index != 0 && position != first && position != last);
+        }
+
+        /// @brief Splits the node of an iterator so that it points to the start of a node
+        /// @param iterator The iterator to split at, updated to the new node
+        /// @param a Another iterator that is updated if it points behind the split
+        /// @param b Another iterator that is updated if it points behind the split
+        /// @return `false` if no spare node was left
+        bool Split(Iterator& iterator, Iterator& a, Iterator& b) {
+            if(iterator.m_Index == 0) return true;
+
+            NodeType* const fresh = TakeNode();
+            __WSTL_ASSERT_RETURNVALUE__(fresh != NullPointer, WSTL_MAKE_EXCEPTION(LengthError, "Unrolled list has no spare node"), false);
+
+            ListNode* const node = iterator.m_Node;
+            const SizeType index = iterator.m_Index;
+            const SizeType moved = NodeCast(node)->Count - index;
+
+            RelocateForward(Elements(node) + index, moved, Elements(fresh));
+            fresh->Count = static_cast<typename NodeType::CountType>(moved);
+            NodeCast(node)->Count = static_cast<typename NodeType::CountType>(index);
+            LinkNodeBefore(node->Next, fresh);
+
+            if(a.m_Node == node && a.m_Index >= index) a = Iterator(fresh, a.m_Index - index);
+            if(b.m_Node == node && b.m_Index >= index) b = Iterator(fresh, b.m_Index - index);
+            iterator = Iterator(fresh, 0);
+
+            return true;
+        }
+    };
+
+    template<typename Storage, size_t K>
+    const __WSTL_CONSTEXPR__ typename BasicUnrolledList<Storage, K>::SizeType BasicUnrolledList<Storage, K>::NodeSize;
+
+    // Comparison operators
+
+    template<typename Storage, size_t K>
+    inline bool operator==(const BasicUnrolledList<Storage, K>& a, const BasicUnrolledList<Storage, K>& b) {
+        return (a.Size() == b.Size()) && Equal(a.Begin(), a.End(), b.Begin());
+    }
+
+    template<typename Storage, size_t K>
+    inline bool operator!=(const BasicUnrolledList<Storage, K>& a, const BasicUnrolledList<Storage, K>& b) {
+        return !(a == b);
+    }
+
+    template<typename Storage, size_t K>
+    inline bool operator<(const BasicUnrolledList<Storage, K>& a, const BasicUnrolledList<Storage, K>& b) {
+        return LexicographicalCompare(a.Begin(), a.End(), b.Begin(), b.End());
+    }
+
+    template<typename Storage, size_t K>
+    inline bool operator<=(const BasicUnrolledList<Storage, K>& a, const BasicUnrolledList<Storage, K>& b) {
+        return !(b < a);
+    }
+
+    template<typename Storage, size_t K>
+    inline bool operator>(const BasicUnrolledList<Storage, K>& a, const BasicUnrolledList<Storage, K>& b) {
+        return b < a;
+    }
+
+    template<typename Storage, size_t K>
+    inline bool operator>=(const BasicUnrolledList<Storage, K>& a, const BasicUnrolledList<Storage, K>& b) {
+        return !(a < b);
+    }
+
+    // Unrolled list
+
+    /// @brief Version of the unrolled list with fixed storage, default option
+    /// @tparam T Type of the elements
+    /// @tparam K Number of elements in a node
+    /// @tparam N Capacity of the list, rounded up to a whole number of nodes
+    /// @details One node more than the capacity needs is reserved, so that a full node can always be split
+    /// @ingroup unrolled_list
+    template<typename T, size_t K, size_t N>
+    class UnrolledList : public BasicUnrolledList<FixedStorage<T, (N + K - 1) / K + 1>, K> {
+    private:
+        typedef BasicUnrolledList<FixedStorage<T, (N + K - 1) / K + 1>, K> Base;
+
+    public:
+        typedef typename Base::ValueType ValueType;
+        typedef typename Base::SizeType SizeType;
+        typedef typename Base::DifferenceType DifferenceType;
+        typedef typename Base::ReferenceType ReferenceType;
+        typedef typename Base::ConstReferenceType ConstReferenceType;
+        typedef typename Base::PointerType PointerType;
+        typedef typename Base::ConstPointerType ConstPointerType;
+
+        typedef typename Base::StorageType StorageType;
+
+        /// @brief The static size, needed for metaprogramming
+        static const __WSTL_CONSTEXPR__ SizeType StaticSize = (N + K - 1) / K * K;
+
+        /// @brief Default constructor
+        UnrolledList() : Base() {}
+
+        /// @brief Copy constructor
+        /// @param other The list to copy from
+        UnrolledList(const UnrolledList& other) : Base() {
+            this->Assign(other.Begin(), other.End());
+        }
+
+        #ifdef __WSTL_CXX11__
+        /// @brief Move constructor
+        /// @param other The list to move from
+        /// @since C++11
+        UnrolledList(UnrolledList&& other) : Base() {
+            this->Assign(MakeMoveIterator(other.Begin()), MakeMoveIterator(other.End()));
+        }
+        #endif
+
+        /// @brief Constructor that initializes the list with a range of elements
+        /// @param first Iterator to the first element in the range
+        /// @param last Iterator to the element following the last element in the range
+        template<typename InputIterator>
+        UnrolledList(InputIterator first, InputIterator last, typename EnableIf<!IsIntegral<InputIterator>::Value, int>::Type = 0) : Base() {
+            this->Assign(first, last);
+        }
+
+        /// @brief Constructor that initializes the list with a number of default-constructed elements
+        /// @param count The number of elements to create
+        explicit UnrolledList(SizeType count) : Base() {
+            this->Resize(count);
+        }
+
+        /// @brief Constructor that initializes the list with a number of copies of a value
+        /// @param count The number of elements to create
+        /// @param value The value to fill the list with
+        UnrolledList(SizeType count, ConstReferenceType value) : Base() {
+            this->Assign(count, value);
+        }
+
+        #if defined(__WSTL_CXX11__) && !defined(__WSTL_NO_INITIALIZERLIST__)
+        /// @brief Constructor that initializes the list with an initializer list
+        /// @param list The initializer list to initialize the list with
+        /// @since C++11
+        UnrolledList(InitializerList<ValueType> list) : Base() {
+            this->Assign(list);
+        }
+        #endif
+
+        /// @brief Copy assignment operator
+        /// @param other The list to copy from
+        UnrolledList& operator=(const UnrolledList& other) {
+            if(this != &other) this->Assign(other.Begin(), other.End());
+            return *this;
+        }
+
+        #ifdef __WSTL_CXX11__
+        /// @brief Move assignment operator
+        /// @param other The list to move from
+        /// @since C++11
+        UnrolledList& operator=(UnrolledList&& other) {
+            if(this != &other) this->Assign(MakeMoveIterator(other.Begin()), MakeMoveIterator(other.End()));
+            return *this;
+        }
+
+        #ifndef __WSTL_NO_INITIALIZERLIST__
+        /// @brief Assignment operator that assigns from an initializer list
+        /// @param list The initializer list to assign from
+        /// @since C++11
+        UnrolledList& operator=(InitializerList<ValueType> list) {
+            this->Assign(list);
+            return *this;
+        }
+        #endif
+        #endif
+    };
+
+    template<typename T, size_t K, size_t N>
+    const __WSTL_CONSTEXPR__ typename UnrolledList<T, K, N>::SizeType UnrolledList<T, K, N>::StaticSize;
+
+    // Unrolled list external
+
+    namespace external {
+        /// @brief Version of the unrolled list that uses an external buffer of nodes
+        /// @tparam T Type of the elements
+        /// @tparam K Number of elements in a node
+        /// @details A buffer of `M` nodes fits `(M - 1) * K` elements
+        /// @ingroup unrolled_list
+        template<typename T, size_t K>
+        class UnrolledList : public BasicUnrolledList<ExternalStorage<T>, K> {
+        private:
+            typedef BasicUnrolledList<ExternalStorage<T>, K> Base;
+
+        public:
+            typedef typename Base::ValueType ValueType;
+            typedef typename Base::SizeType SizeType;
+            typedef typename Base::DifferenceType DifferenceType;
+            typedef typename Base::ReferenceType ReferenceType;
+            typedef typename Base::ConstReferenceType ConstReferenceType;
+            typedef typename Base::PointerType PointerType;
+            typedef typename Base::ConstPointerType ConstPointerType;
+
+            typedef typename Base::StorageType StorageType;
+            typedef typename Base::NodeType NodeType;
+
+            /// @brief Constructor that uses an external buffer of nodes
+            /// @param buffer Pointer to the external buffer
+            /// @param nodes Number of nodes in the buffer
+            UnrolledList(NodeType* buffer, SizeType nodes) : Base(StorageType(buffer, nodes)) {}
+
+            /// @brief Copy constructor that uses an external buffer of nodes
+            /// @param other The list to copy from
+            /// @param buffer Pointer to the external buffer
+            /// @param nodes Number of nodes in the buffer
+            UnrolledList(const UnrolledList& other, NodeType* buffer, SizeType nodes) : Base(StorageType(buffer, nodes)) {
+                this->Assign(other.Begin(), other.End());
+            }
+
+            /// @brief Constructor that initializes the list with a range of elements
+            /// @param first Iterator to the first element in the range
+            /// @param last Iterator to the element following the last element in the range
+            /// @param buffer Pointer to the external buffer
+            /// @param nodes Number of nodes in the buffer
+            template<typename InputIterator>
+            UnrolledList(InputIterator first, InputIterator last, NodeType* buffer, SizeType nodes,
+                typename EnableIf<!IsIntegral<InputIterator>::Value, int>::Type = 0) : Base(StorageType(buffer, nodes)) {
+                this->Assign(first, last);
+            }
+
+            /// @brief Constructor that initializes the list with a number of copies of a value
+            /// @param count The number of elements to create
+            /// @param value The value to fill the list with
+            /// @param buffer Pointer to the external buffer
+            /// @param nodes Number of nodes in the buffer
+            UnrolledList(SizeType count, ConstReferenceType value, NodeType* buffer, SizeType nodes) : Base(StorageType(buffer, nodes)) {
+                this->Assign(count, value);
+            }
+
+            #if defined(__WSTL_CXX11__) && !defined(__WSTL_NO_INITIALIZERLIST__)
+            /// @brief Constructor that initializes the list with an initializer list
+            /// @param list The initializer list to initialize the list with
+            /// @param buffer Pointer to the external buffer
+            /// @param nodes Number of nodes in the buffer
+            /// @since C++11
+            UnrolledList(InitializerList<ValueType> list, NodeType* buffer, SizeType nodes) : Base(StorageType(buffer, nodes)) {
+                this->Assign(list);
+            }
+            #endif
+
+            /// @brief Copy assignment operator
+            /// @param other The list to copy from
+            UnrolledList& operator=(const UnrolledList& other) {
+                if(this != &other) this->Assign(other.Begin(), other.End());
+                return *this;
+            }
+
+            #ifdef __WSTL_CXX11__
+            /// @brief Move assignment operator
+            /// @param other The list to move from
+            /// @since C++11
+            UnrolledList& operator=(UnrolledList&& other) {
+                if(this != &other) this->Assign(MakeMoveIterator(other.Begin()), MakeMoveIterator(other.End()));
+                return *this;
+            }
+            #endif
+        };
+    }
+
+    namespace allocated {
+        /// @brief Version of the unrolled list that draws its nodes from an allocator
+        /// @tparam T Type of the elements
+        /// @tparam K Number of elements in a node
+        /// @ingroup unrolled_list
+        template<typename T, size_t K>
+        class UnrolledList : public BasicUnrolledList<AllocatorStorage<T>, K> {
+        private:
+            typedef BasicUnrolledList<AllocatorStorage<T>, K> Base;
+
+        public:
+            typedef typename Base::ValueType ValueType;
+            typedef typename Base::SizeType SizeType;
+            typedef typename Base::DifferenceType DifferenceType;
+            typedef typename Base::ReferenceType ReferenceType;
+            typedef typename Base::ConstReferenceType ConstReferenceType;
+            typedef typename Base::PointerType PointerType;
+            typedef typename Base::ConstPointerType ConstPointerType;
+
+            typedef typename Base::StorageType StorageType;
+
+            /// @brief Constructor that draws the nodes from an allocator
+            /// @param allocator The allocator to draw the nodes from
+            /// @param capacity Capacity of the list, rounded up to a whole number of nodes
+            UnrolledList(Allocator& allocator, SizeType capacity) : Base(StorageType(allocator, Nodes(capacity))) {}
+
+            /// @brief Copy constructor that draws the nodes from an allocator
+            /// @param other The list to copy from
+            /// @param allocator The allocator to draw the nodes from
+            /// @param capacity Capacity of the list, rounded up to a whole number of nodes
+            UnrolledList(const UnrolledList& other, Allocator& allocator, SizeType capacity) : Base(StorageType(allocator, Nodes(capacity))) {
+                this->Assign(other.Begin(), other.End());
+            }
+
+            /// @brief Constructor that initializes the list with a range of elements
+            /// @param first Iterator to the first element in the range
+            /// @param last Iterator to the element following the last element in the range
+            /// @param allocator The allocator to draw the nodes from
+            /// @param capacity Capacity of the list, rounded up to a whole number of nodes
+            template<typename InputIterator>
+            UnrolledList(InputIterator first, InputIterator last, Allocator& allocator, SizeType capacity,
+                typename EnableIf<!IsIntegral<InputIterator>::Value, int>::Type = 0) : Base(StorageType(allocator, Nodes(capacity))) {
+                this->Assign(first, last);
+            }
+
+            /// @brief Constructor that initializes the list with a number of copies of a value
+            /// @param count The number of elements to create
+            /// @param value The value to fill the list with
+            /// @param allocator The allocator to draw the nodes from
+            /// @param capacity Capacity of the list, rounded up to a whole number of nodes
+            UnrolledList(SizeType count, ConstReferenceType value, Allocator& allocator, SizeType capacity) : Base(StorageType(allocator, Nodes(capacity))) {
+                this->Assign(count, value);
+            }
+
+            #if defined(__WSTL_CXX11__) && !defined(__WSTL_NO_INITIALIZERLIST__)
+            /// @brief Constructor that initializes the list with an initializer list
+            /// @param list The initializer list to initialize the list with
+            /// @param allocator The allocator to draw the nodes from
+            /// @param capacity Capacity of the list, rounded up to a whole number of nodes
+            /// @since C++11
+            UnrolledList(InitializerList<ValueType> list, Allocator& allocator, SizeType capacity) : Base(StorageType(allocator, Nodes(capacity))) {
+                this->Assign(list);
+            }
+            #endif
+
+            /// @brief Copy assignment operator
+            /// @param other The list to copy from
+            UnrolledList& operator=(const UnrolledList& other) {
+                if(this != &other) this->Assign(other.Begin(), other.End());
+                return *this;
+            }
+
+            #ifdef __WSTL_CXX11__
+            /// @brief Move assignment operator
+            /// @param other The list to move from
+            /// @since C++11
+            UnrolledList& operator=(UnrolledList&& other) {
+                if(this != &other) this->Assign(MakeMoveIterator(other.Begin()), MakeMoveIterator(other.End()));
+                return *this;
+            }
+            #endif
+
+        private:
+            static SizeType Nodes(SizeType capacity) {
+                return (capacity + K - 1) / K + 1;
+            }
+        };
+    }
+}
+
+#endif
\ No newline at end of file
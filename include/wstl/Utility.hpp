@@ -148,8 +148,8 @@ namespace wstl {
         /// @brief Move constructor - moves from pair of the same types
         /// @param other Pair to move from
         /// @since C++11
-        __WSTL_CONSTEXPR14__ Pair(Pair&& other) : First(Move(other.First)), 
-            Second(Move(other.Second)) {}
+        __WSTL_CONSTEXPR14__ Pair(Pair&& other) : First(Forward<T1>(other.First)), 
+            Second(Forward<T2>(other.Second)) {}
 
         /// @brief Templated move constructor - moves from pair of potentially different types
         /// @param other Pair to move from
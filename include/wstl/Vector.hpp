@@ -0,0 +1,1399 @@
+// Part of WardenSTL - https://github.com/WardenHD/WardenSTL
+// Copyright (c) 2025 Artem Bezruchko (WardenHD)
+//
+// Licensed under the MIT License. See LICENSE file for full details.
+
+#ifndef __WSTL_VECTOR_HPP__
+#define __WSTL_VECTOR_HPP__
+
+#include "private/Platform.hpp"
+#include "Container.hpp"
+#include "Iterator.hpp"
+#include "InitializerList.hpp"
+#include "StandardExceptions.hpp"
+#include "PlacementNew.hpp"
+#include "Algorithm.hpp"
+
+
+/// @defgroup vector Vector
+/// @ingroup containers
+/// @brief A contiguous sequence container
+
+namespace wstl {
+    // Basic vector
+
+    /// @brief A sequence container that stores its elements contiguously
+    /// @tparam Storage The storage type used by the vector
+    /// @details Iterators are plain pointers, so algorithms over ranges of trivially copyable
+    /// elements take their `memmove` paths. If the storage is growable (see `StorageTraits::IsGrowable`),
+    /// the vector moves into a block twice as large when it runs out of room, otherwise exceeding
+    /// the capacity is an error. Growing invalidates all iterators and references
+    /// @ingroup vector
+    /// @see https://en.cppreference.com/w/cpp/container/vector
+    template<typename Storage>
+    class BasicVector : public TypedContainerBase<Storage> {
+    private:
+        typedef TypedContainerBase<Storage> Base;
+
+    public:
+        WSTL_STATIC_ASSERT(!IsVoid<Storage>::Value, "Storage must be non-void");
+
+        typedef typename Storage::ValueType ValueType;
+        typedef typename Storage::SizeType SizeType;
+        typedef typename Base::DifferenceType DifferenceType;
+        typedef typename Base::ReferenceType ReferenceType;
+        typedef typename Base::ConstReferenceType ConstReferenceType;
+        typedef typename Base::PointerType PointerType;
+        typedef typename Base::ConstPointerType ConstPointerType;
+
+        typedef typename Base::StorageType StorageType;
+
+        typedef PointerType Iterator;
+        typedef ConstPointerType ConstIterator;
+        typedef wstl::ReverseIterator<Iterator> ReverseIterator;
+        typedef wstl::ReverseIterator<ConstIterator> ConstReverseIterator;
+
+        /// @brief Default constructor, only for default-constructible storage
+        BasicVector() : Base() {}
+
+        /// @brief Constructor with custom storage, only for non-default-constructible storage
+        /// @param storage Storage to use for the vector
+        explicit BasicVector(StorageType storage) : Base(__WSTL_MOVE__(storage)) {}
+
+        /// @brief Destructor
+        ~BasicVector() {
+            Clear();
+        }
+
+        /// @brief Copy constructor
+        /// @param other The vector to copy from
+        /// @throws `LengthError` if the copied vector's size exceeds the vector's capacity
+        BasicVector(const BasicVector& other) : Base() {
+            Assign(other.Begin(), other.End());
+        }
+
+        /// @brief Copy constructor with custom storage, only for non-default-constructible storage
+        /// @param other The vector to copy from
+        /// @param storage Storage to use for the vector
+        /// @throws `LengthError` if the copied vector's size exceeds the vector's capacity
+        BasicVector(const BasicVector& other, StorageType storage) : Base(__WSTL_MOVE__(storage)) {
+            Assign(other.Begin(), other.End());
+        }
+
+        #ifdef __WSTL_CXX11__
+        /// @brief Move constructor
+        /// @param other The vector to move from
+        /// @throws `LengthError` if the moved vector's size exceeds the vector's capacity
+        /// @since C++11
+        BasicVector(BasicVector&& other) : Base() {
+            Assign(MakeMoveIterator(other.Begin()), MakeMoveIterator(other.End()));
+        }
+
+        /// @brief Move constructor with custom storage, only for non-default-constructible storage
+        /// @param other The vector to move from
+        /// @param storage Storage to use for the vector
+        /// @throws `LengthError` if the moved vector's size exceeds the vector's capacity
+        /// @since C++11
+        BasicVector(BasicVector&& other, StorageType storage) : Base(__WSTL_MOVE__(storage)) {
+            Assign(MakeMoveIterator(other.Begin()), MakeMoveIterator(other.End()));
+        }
+        #endif
+
+        /// @brief Constructor that initializes the vector with a range of elements
+        /// @param first Iterator to the first element in the range
+        /// @param last Iterator to the element following the last element in the range
+        /// @throws `LengthError` if the range size exceeds the vector's capacity
+        template<typename InputIterator>
+        BasicVector(InputIterator first, InputIterator last, typename EnableIf<!IsIntegral<InputIterator>::Value, int>::Type = 0) : Base() {
+            Assign(first, last);
+        }
+
+        /// @brief Constructor that initializes the vector with a range of elements and custom storage,
+        /// only for non-default-constructible storage
+        /// @param first Iterator to the first element in the range
+        /// @param last Iterator to the element following the last element in the range
+        /// @param storage Storage to use for the vector
+        /// @throws `LengthError` if the range size exceeds the vector's capacity
+        template<typename InputIterator>
+        BasicVector(InputIterator first, InputIterator last, StorageType storage, typename EnableIf<!IsIntegral<InputIterator>::Value, int>::Type = 0) : Base(__WSTL_MOVE__(storage)) {
+            Assign(first, last);
+        }
+
+        /// @brief Constructor that initializes the vector with a specific number of default-constructed elements
+        /// @param count The number of elements to initialize the vector with
+        /// @throws `LengthError` if count exceeds the vector's capacity
+        explicit BasicVector(SizeType count) : Base() {
+            Resize(count);
+        }
+
+        /// @brief Constructor that initializes the vector with a specific number of default-constructed elements and custom storage,
+        /// only for non-default-constructible storage
+        /// @param count The number of elements to initialize the vector with
+        /// @param storage Storage to use for the vector
+        /// @throws `LengthError` if count exceeds the vector's capacity
+        explicit BasicVector(SizeType count, StorageType storage) : Base(__WSTL_MOVE__(storage)) {
+            Resize(count);
+        }
+
+        /// @brief Constructor that initializes the vector with a specific number of elements
+        /// @param count The number of elements to initialize the vector with
+        /// @param value The value to initialize each element with
+        /// @throws `LengthError` if count exceeds the vector's capacity
+        BasicVector(SizeType count, ConstReferenceType value) : Base() {
+            Assign(count, value);
+        }
+
+        /// @brief Constructor that initializes the vector with a specific number of elements and custom storage,
+        /// only for non-default-constructible storage
+        /// @param count The number of elements to initialize the vector with
+        /// @param value The value to initialize each element with
+        /// @param storage Storage to use for the vector
+        /// @throws `LengthError` if count exceeds the vector's capacity
+        BasicVector(SizeType count, ConstReferenceType value, StorageType storage) : Base(__WSTL_MOVE__(storage)) {
+            Assign(count, value);
+        }
+
+        #if defined(__WSTL_CXX11__) && !defined(__WSTL_NO_INITIALIZERLIST__)
+        /// @brief Constructor that initializes the vector with an initializer list
+        /// @param list The initializer list to initialize the vector with
+        /// @throws `LengthError` if list size exceeds the vector's capacity
+        /// @since C++11
+        BasicVector(InitializerList<ValueType> list) : Base() {
+            Assign(list.Begin(), list.End());
+        }
+
+        /// @brief Constructor that initializes the vector with an initializer list and custom storage,
+        /// only for non-default-constructible storage
+        /// @param list The initializer list to initialize the vector with
+        /// @param storage Storage to use for the vector
+        /// @throws `LengthError` if list size exceeds the vector's capacity
+        /// @since C++11
+        BasicVector(InitializerList<ValueType> list, StorageType storage) : Base(__WSTL_MOVE__(storage)) {
+            Assign(list.Begin(), list.End());
+        }
+        #endif
+
+        /// @brief Copy assignment operator
+        /// @param other The vector to copy from
+        /// @throws `LengthError` if the copied vector's size exceeds the vector's capacity
+        BasicVector& operator=(const BasicVector& other) {
+            if(this != &other) Assign(other.Begin(), other.End());
+            return *this;
+        }
+
+        #ifdef __WSTL_CXX11__
+        /// @brief Move assignment operator
+        /// @param other The vector to move from
+        /// @throws `LengthError` if the moved vector's size exceeds the vector's capacity
+        /// @since C++11
+        BasicVector& operator=(BasicVector&& other) {
+            if(this != &other) Assign(MakeMoveIterator(other.Begin()), MakeMoveIterator(other.End()));
+            return *this;
+        }
+
+        #ifndef __WSTL_NO_INITIALIZERLIST__
+        /// @brief Assignment operator
+        /// @param list The initializer list to assign to the vector
+        /// @throws `LengthError` if list size exceeds the vector's capacity
+        /// @since C++11
+        BasicVector& operator=(InitializerList<ValueType> list) {
+            Assign(list.Begin(), list.End());
+            return *this;
+        }
+        #endif
+        #endif
+
+        /// @brief Assigns a range of elements to the vector
+        /// @param first Iterator to the first element in the range
+        /// @param last Iterator to the element following the last element in the range
+        /// @throws `LengthError` if the vector's capacity is exceeded
+        template<typename InputIterator>
+        typename EnableIf<!IsIntegral<InputIterator>::Value, void>::Type Assign(InputIterator first, InputIterator last) {
+            Clear();
+
+            const SizeType count = static_cast<SizeType>(Distance(first, last));
+            if(!Accommodate(count)) return;
+
+            ConstructRange(Data(), first, last);
+            this->m_CurrentSize = count;
+        }
+
+        /// @brief Assigns a specific number of elements to the vector
+        /// @param count The number of elements to assign
+        /// @param value The value to assign to each element
+        /// @throws `LengthError` if the vector's capacity is exceeded
+        void Assign(SizeType count, ConstReferenceType value) {
+            // The value may be an element of the vector
+            const ValueType copy(value);
+            Clear();
+
+            if(!Accommodate(count)) return;
+
+            UninitializedFillInRange(Data(), count, copy);
+            this->m_CurrentSize = count;
+        }
+
+        #if defined(__WSTL_CXX11__) && !defined(__WSTL_NO_INITIALIZERLIST__)
+        /// @brief Assigns an initializer list to the vector
+        /// @param list The initializer list to assign to the vector
+        /// @throws `LengthError` if list size exceeds the vector's capacity
+        /// @since C++11
+        void Assign(InitializerList<ValueType> list) {
+            Assign(list.Begin(), list.End());
+        }
+        #endif
+
+        /// @brief Assigns a range of elements to the vector
+        /// @param range The range to assign to the vector
+        /// @throws `LengthError` if the vector's capacity is exceeded
+        template<typename Range>
+        inline void AssignRange(const Range& range) {
+            Assign(wstl::Begin(range), wstl::End(range));
+        }
+
+        #ifdef __WSTL_CXX11__
+        /// @brief Assigns elements to the vector by moving them from range
+        /// @param range The range to move the elements from
+        /// @throws `LengthError` if the vector's capacity is exceeded
+        /// @since C++11
+        template<typename Range>
+        inline void AssignRange(Range&& range) {
+            Assign(MakeMoveIterator(wstl::Begin(range)),
+                MakeMoveIterator(wstl::End(range)));
+        }
+        #endif
+
+        /// @brief Gets the element at the specified position in the vector
+        /// @param position The position of the element to access
+        /// @throws `OutOfRange` if the position is out of range
+        ReferenceType At(SizeType position) {
+            __WSTL_ASSERT__(position < this->m_CurrentSize, WSTL_MAKE_EXCEPTION(OutOfRange, "Vector index out of range"));
+            return this->m_Storage.Data[position];
+        }
+
+        /// @brief Gets the element at the specified position in the vector
+        /// @param position The position of the element to access
+        /// @throws `OutOfRange` if the position is out of range
+        ConstReferenceType At(SizeType position) const {
+            __WSTL_ASSERT__(position < this->m_CurrentSize, WSTL_MAKE_EXCEPTION(OutOfRange, "Vector index out of range"));
+            return this->m_Storage.Data[position];
+        }
+
+        /// @brief Access operator
+        /// @param index The index of the element to access
+        ReferenceType operator[](SizeType index) {
+            return this->m_Storage.Data[index];
+        }
+
+        /// @brief Const access operator
+        /// @param index The index of the element to access
+        ConstReferenceType operator[](SizeType index) const {
+            return this->m_Storage.Data[index];
+        }
+
+        /// @brief Gets the first element of the vector
+        ReferenceType Front() {
+            return this->m_Storage.Data[0];
+        }
+
+        /// @brief Gets the first element of the vector
+        ConstReferenceType Front() const {
+            return this->m_Storage.Data[0];
+        }
+
+        /// @brief Gets the last element of the vector
+        ReferenceType Back() {
+            return this->m_Storage.Data[this->m_CurrentSize - 1];
+        }
+
+        /// @brief Gets the last element of the vector
+        ConstReferenceType Back() const {
+            return this->m_Storage.Data[this->m_CurrentSize - 1];
+        }
+
+        /// @brief Gets pointer to the underlying array
+        PointerType Data() __WSTL_NOEXCEPT__ {
+            return this->m_Storage.Data;
+        }
+
+        /// @brief Gets const pointer to the underlying array
+        ConstPointerType Data() const __WSTL_NOEXCEPT__ {
+            return this->m_Storage.Data;
+        }
+
+        /// @brief Gets iterator to the beginning of the vector
+        Iterator Begin() {
+            return Data();
+        }
+
+        /// @brief Gets const iterator to the beginning of the vector
+        ConstIterator Begin() const {
+            return Data();
+        }
+
+        /// @brief Gets const iterator to the beginning of the vector
+        ConstIterator ConstBegin() const {
+            return Data();
+        }
+
+        /// @brief Gets iterator to the end of the vector
+        Iterator End() {
+            return Data() + this->m_CurrentSize;
+        }
+
+        /// @brief Gets const iterator to the end of the vector
+        ConstIterator End() const {
+            return Data() + this->m_CurrentSize;
+        }
+
+        /// @brief Gets const iterator to the end of the vector
+        ConstIterator ConstEnd() const {
+            return Data() + this->m_CurrentSize;
+        }
+
+        /// @brief Gets reverse iterator to the beginning of the vector
+        ReverseIterator ReverseBegin() {
+            return ReverseIterator(End());
+        }
+
+        /// @brief Gets const reverse iterator to the beginning of the vector
+        ConstReverseIterator ReverseBegin() const {
+            return ConstReverseIterator(End());
+        }
+
+        /// @brief Gets const reverse iterator to the beginning of the vector
+        ConstReverseIterator ConstReverseBegin() const {
+            return ConstReverseIterator(End());
+        }
+
+        /// @brief Gets reverse iterator to the end of the vector
+        ReverseIterator ReverseEnd() {
+            return ReverseIterator(Begin());
+        }
+
+        /// @brief Gets const reverse iterator to the end of the vector
+        ConstReverseIterator ReverseEnd() const {
+            return ConstReverseIterator(Begin());
+        }
+
+        /// @brief Gets const reverse iterator to the end of the vector
+        ConstReverseIterator ConstReverseEnd() const {
+            return ConstReverseIterator(Begin());
+        }
+
+        /// @brief Makes sure the vector can hold the given number of elements without growing
+        /// @param capacity The minimum capacity after the call
+        /// @return `true` if the capacity is at least `capacity` afterwards
+        /// @throws `LengthError` if the storage is not growable and too small,
+        /// `BadAllocation` if the allocator of a growable storage fails
+        bool Reserve(SizeType capacity) {
+            if(capacity <= this->Capacity()) return true;
+            return Grow<StorageType>(capacity, capacity);
+        }
+
+        /// @brief Clears the vector, removing all elements
+        void Clear() {
+            Destroy(Begin(), End());
+            this->m_CurrentSize = 0;
+        }
+
+        /// @brief Inserts an element at specified position in the vector
+        /// @param position The position to insert the element at
+        /// @param value The value to insert
+        /// @return Iterator to the newly inserted element
+        /// @throws `LengthError` if the vector is full
+        Iterator Insert(ConstIterator position, ConstReferenceType value) {
+            const SizeType index = static_cast<SizeType>(position - Begin());
+
+            // The value may be an element of the vector, which is moved by opening the gap
+            const ValueType copy(value);
+            if(OpenGap(index, 1)) ::new(static_cast<void*>(Data() + index)) ValueType(__WSTL_MOVE__(copy));
+
+            return Begin() + index;
+        }
+
+        #ifdef __WSTL_CXX11__
+        /// @brief Inserts an element at specified position in the vector
+        /// @param position The position to insert the element at
+        /// @param value The value to insert (rvalue reference)
+        /// @return Iterator to the newly inserted element
+        /// @throws `LengthError` if the vector is full
+        /// @since C++11
+        Iterator Insert(ConstIterator position, ValueType&& value) {
+            return Emplace(position, Move(value));
+        }
+        #endif
+
+        /// @brief Inserts multiple elements at specified position in the vector
+        /// @param position The position to insert the elements at
+        /// @param count The number of elements to insert
+        /// @param value The value to insert
+        /// @return Iterator to the first inserted element
+        /// @throws `LengthError` if the vector is full
+        Iterator Insert(ConstIterator position, SizeType count, ConstReferenceType value) {
+            const SizeType index = static_cast<SizeType>(position - Begin());
+
+            const ValueType copy(value);
+            if(OpenGap(index, count)) UninitializedFillInRange(Data() + index, count, copy);
+
+            return Begin() + index;
+        }
+
+        /// @brief Inserts a range of elements at specified position in the vector
+        /// @param position The position to insert the elements at
+        /// @param first Iterator to the first element in the range
+        /// @param last Iterator to the element following the last element in the range
+        /// @return Iterator to the first inserted element
+        /// @throws `LengthError` if the vector is full
+        template<typename InputIterator>
+        typename EnableIf<!IsIntegral<InputIterator>::Value, Iterator>::Type
+        Insert(ConstIterator position, InputIterator first, InputIterator last) {
+            const SizeType index = static_cast<SizeType>(position - Begin());
+            const SizeType count = static_cast<SizeType>(Distance(first, last));
+
+            if(OpenGap(index, count)) ConstructRange(Data() + index, first, last);
+
+            return Begin() + index;
+        }
+
+        #if defined(__WSTL_CXX11__) && !defined(__WSTL_NO_INITIALIZERLIST__)
+        /// @brief Inserts elements from an initializer list at specified position in the vector
+        /// @param position The position to insert the elements at
+        /// @param list The initializer list to insert
+        /// @return Iterator to the first inserted element
+        /// @throws `LengthError` if the vector is full
+        /// @since C++11
+        Iterator Insert(ConstIterator position, InitializerList<ValueType> list) {
+            return Insert(position, list.Begin(), list.End());
+        }
+        #endif
+
+        /// @brief Inserts a range of elements at specified position in the vector
+        /// @param position The position to insert the elements at
+        /// @param range The range to insert
+        /// @return Iterator to the first inserted element
+        /// @throws `LengthError` if the vector is full
+        template<typename Range>
+        inline Iterator InsertRange(ConstIterator position, const Range& range) {
+            return Insert(position, wstl::Begin(range), wstl::End(range));
+        }
+
+        #ifdef __WSTL_CXX11__
+        /// @brief Inserts elements at specified position in the vector by moving them from range
+        /// @param position The position to insert the elements at
+        /// @param range The range to move the elements from
+        /// @return Iterator to the first inserted element
+        /// @throws `LengthError` if the vector is full
+        /// @since C++11
+        template<typename Range>
+        inline Iterator InsertRange(ConstIterator position, Range&& range) {
+            return Insert(position, MakeMoveIterator(wstl::Begin(range)), MakeMoveIterator(wstl::End(range)));
+        }
+        #endif
+
+        #ifdef __WSTL_CXX11__
+        /// @brief Emplaces an element at specified position in the vector, constructing it in place
+        /// @param position The position to emplace the element at
+        /// @param ...args The arguments to forward to the constructor of the element
+        /// @return Iterator to the newly emplaced element
+        /// @throws `LengthError` if the vector is full
+        /// @since C++11
+        template<typename... Args>
+        Iterator Emplace(ConstIterator position, Args&&... args) {
+            const SizeType index = static_cast<SizeType>(position - Begin());
+
+            if(index == this->m_CurrentSize) EmplaceBack(Forward<Args>(args)...);
+            else {
+                // The arguments may refer to elements, which are moved by opening the gap
+                ValueType value(Forward<Args>(args)...);
+                if(OpenGap(index, 1)) ::new(static_cast<void*>(Data() + index)) ValueType(Move(value));
+            }
+
+            return Begin() + index;
+        }
+
+        #else
+        /// @brief Emplaces an element at specified position in the vector, constructing it in place
+        /// @param position The position to emplace the element at
+        /// @return Iterator to the newly emplaced element
+        /// @throws `LengthError` if the vector is full
+        Iterator Emplace(ConstIterator position) {
+            const SizeType index = static_cast<SizeType>(position - Begin());
+            if(OpenGap(index, 1)) ::new(static_cast<void*>(Data() + index)) ValueType();
+            return Begin() + index;
+        }
+
+        /// @brief Emplaces an element at specified position in the vector, constructing it in place
+        /// @param position The position to emplace the element at
+        /// @param arg The argument to pass to the constructor of the element
+        /// @return Iterator to the newly emplaced element
+        /// @throws `LengthError` if the vector is full
+        template<typename Arg>
+        Iterator Emplace(ConstIterator position, const Arg& arg) {
+            return Insert(position, ValueType(arg));
+        }
+
+        /// @brief Emplaces an element at specified position in the vector, constructing it in place
+        /// @param position The position to emplace the element at
+        /// @param arg1 First argument to pass to the constructor of the element
+        /// @param arg2 Second argument to pass to the constructor of the element
+        /// @return Iterator to the newly emplaced element
+        /// @throws `LengthError` if the vector is full
+        template<typename Arg1, typename Arg2>
+        Iterator Emplace(ConstIterator position, const Arg1& arg1, const Arg2& arg2) {
+            return Insert(position, ValueType(arg1, arg2));
+        }
+
+        /// @brief Emplaces an element at specified position in the vector, constructing it in place
+        /// @param position The position to emplace the element at
+        /// @param arg1 First argument to pass to the constructor of the element
+        /// @param arg2 Second argument to pass to the constructor of the element
+        /// @param arg3 Third argument to pass to the constructor of the element
+        /// @return Iterator to the newly emplaced element
+        /// @throws `LengthError` if the vector is full
+        template<typename Arg1, typename Arg2, typename Arg3>
+        Iterator Emplace(ConstIterator position, const Arg1& arg1, const Arg2& arg2, const Arg3& arg3) {
+            return Insert(position, ValueType(arg1, arg2, arg3));
+        }
+        #endif
+
+        /// @brief Erases an element at specified position in the vector
+        /// @param position The position of the element to erase
+        /// @return Iterator to the element following the erased element
+        Iterator Erase(ConstIterator position) {
+            return Erase(position, position + 1);
+        }
+
+        /// @brief Erases a range of elements from the vector
+        /// @param first Iterator to the first element in the range to erase
+        /// @param last Iterator to the element following the last element in the range to erase
+        /// @return Iterator to the first element following the erased range
+        Iterator Erase(ConstIterator first, ConstIterator last) {
+            Iterator result = Begin() + (first - Begin());
+            const SizeType count = static_cast<SizeType>(last - first);
+
+            if(count != 0) {
+                Destroy(result, result + count);
+                __private::__Relocate(result + count, static_cast<size_t>(End() - result) - count, result);
+                this->m_CurrentSize -= count;
+            }
+
+            return result;
+        }
+
+        /// @brief Pushes an element to the back of the vector
+        /// @param value The value to push to the back
+        /// @throws `LengthError` if the vector is full
+        void PushBack(ConstReferenceType value) {
+            if(this->Full()) {
+                // The value may be an element of the vector, which is moved by growing
+                const ValueType copy(value);
+                if(!Accommodate(1)) return;
+                ::new(static_cast<void*>(End())) ValueType(__WSTL_MOVE__(copy));
+            }
+            else ::new(static_cast<void*>(End())) ValueType(value);
+
+            ++this->m_CurrentSize;
+        }
+
+        #ifdef __WSTL_CXX11__
+        /// @brief Pushes an element to the back of the vector
+        /// @param value The value to push to the back (rvalue reference)
+        /// @throws `LengthError` if the vector is full
+        /// @since C++11
+        void PushBack(ValueType&& value) {
+            EmplaceBack(Move(value));
+        }
+        #endif
+
+        #ifdef __WSTL_CXX11__
+        /// @brief Emplaces an element at the back of the vector, constructing it in place
+        /// @param ...args The arguments to forward to the constructor of the element
+        /// @throws `LengthError` if the vector is full
+        /// @since C++11
+        template<typename... Args>
+        void EmplaceBack(Args&&... args) {
+            if(this->Full()) {
+                // The arguments may refer to elements, which are moved by growing
+                ValueType value(Forward<Args>(args)...);
+                if(!Accommodate(1)) return;
+                ::new(static_cast<void*>(End())) ValueType(Move(value));
+            }
+            else ::new(static_cast<void*>(End())) ValueType(Forward<Args>(args)...);
+
+            ++this->m_CurrentSize;
+        }
+
+        #else
+        /// @brief Emplaces an element at the back of the vector, constructing it in place
+        /// @throws `LengthError` if the vector is full
+        void EmplaceBack() {
+            if(!Accommodate(1)) return;
+
+            ::new(static_cast<void*>(End())) ValueType();
+            ++this->m_CurrentSize;
+        }
+
+        /// @brief Emplaces an element at the back of the vector, constructing it in place
+        /// @param arg The argument to pass to the constructor of the element
+        /// @throws `LengthError` if the vector is full
+        template<typename Arg>
+        void EmplaceBack(const Arg& arg) {
+            if(this->Full()) PushBack(ValueType(arg));
+            else {
+                ::new(static_cast<void*>(End())) ValueType(arg);
+                ++this->m_CurrentSize;
+            }
+        }
+
+        /// @brief Emplaces an element at the back of the vector, constructing it in place
+        /// @param arg1 First argument to pass to the constructor of the element
+        /// @param arg2 Second argument to pass to the constructor of the element
+        /// @throws `LengthError` if the vector is full
+        template<typename Arg1, typename Arg2>
+        void EmplaceBack(const Arg1& arg1, const Arg2& arg2) {
+            if(this->Full()) PushBack(ValueType(arg1, arg2));
+            else {
+                ::new(static_cast<void*>(End())) ValueType(arg1, arg2);
+                ++this->m_CurrentSize;
+            }
+        }
+
+        /// @brief Emplaces an element at the back of the vector, constructing it in place
+        /// @param arg1 First argument to pass to the constructor of the element
+        /// @param arg2 Second argument to pass to the constructor of the element
+        /// @param arg3 Third argument to pass to the constructor of the element
+        /// @throws `LengthError` if the vector is full
+        template<typename Arg1, typename Arg2, typename Arg3>
+        void EmplaceBack(const Arg1& arg1, const Arg2& arg2, const Arg3& arg3) {
+            if(this->Full()) PushBack(ValueType(arg1, arg2, arg3));
+            else {
+                ::new(static_cast<void*>(End())) ValueType(arg1, arg2, arg3);
+                ++this->m_CurrentSize;
+            }
+        }
+        #endif
+
+        /// @brief Appends a range of elements to the back of the vector
+        /// @param range The range to append the elements from
+        /// @throws `LengthError` if the vector is full
+        template<typename Range>
+        inline void AppendRange(const Range& range) {
+            Insert(End(), wstl::Begin(range), wstl::End(range));
+        }
+
+        #ifdef __WSTL_CXX11__
+        /// @brief Appends elements to the back of the vector by moving them from range
+        /// @param range The range to append the elements from
+        /// @throws `LengthError` if the vector is full
+        /// @since C++11
+        template<typename Range>
+        inline void AppendRange(Range&& range) {
+            Insert(End(), MakeMoveIterator(wstl::Begin(range)),
+                MakeMoveIterator(wstl::End(range)));
+        }
+        #endif
+
+        /// @brief Pops the last element from the vector
+        /// @throws `OutOfRange` if the vector is empty and `__WSTL_ASSERT_PUSHPOP__` is defined
+        void PopBack() {
+            __WSTL_ASSERT_PUSHPOP_RETURN__(!this->Empty(), WSTL_MAKE_EXCEPTION(OutOfRange, "Vector empty"));
+
+            --this->m_CurrentSize;
+            End()->~ValueType();
+        }
+
+        /// @brief Resizes the vector to the specified size, default-constructing new elements
+        /// @param count The new size of the vector
+        /// @throws `LengthError` if the vector's capacity is exceeded
+        void Resize(SizeType count) {
+            if(count < this->m_CurrentSize) Destroy(Begin() + count, End());
+            else {
+                if(!Accommodate(count - this->m_CurrentSize)) return;
+                for(Iterator it = End(); it != Begin() + count; ++it) ::new(static_cast<void*>(it)) ValueType();
+            }
+
+            this->m_CurrentSize = count;
+        }
+
+        /// @brief Resizes the vector to the specified size, filling new elements with a specified value
+        /// @param count The new size of the vector
+        /// @param value The value to fill new elements with
+        /// @throws `LengthError` if the vector's capacity is exceeded
+        void Resize(SizeType count, ConstReferenceType value) {
+            if(count < this->m_CurrentSize) Destroy(Begin() + count, End());
+            else {
+                const ValueType copy(value);
+                if(!Accommodate(count - this->m_CurrentSize)) return;
+                UninitializedFill(End(), Begin() + count, copy);
+            }
+
+            this->m_CurrentSize = count;
+        }
+
+        /// @brief Swaps content of two vectors
+        /// @param other The vector to swap with
+        /// @throws `LengthError` if the storage of either vector cannot hold the elements of the other
+        void Swap(BasicVector& other) {
+            __Swap<StorageType>(other);
+        }
+
+    protected:
+        /// @brief Makes room for more elements, growing the storage if it supports it
+        /// @param count The number of elements to make room for
+        /// @return `true` if the vector can hold `count` more elements
+        bool Accommodate(SizeType count) {
+            const SizeType required = this->m_CurrentSize + count;
+            if(required <= this->Capacity()) return true;
+
+            const SizeType doubled = this->Capacity() * 2;
+            return Grow<StorageType>(required, doubled > required ? doubled : required);
+        }
+
+    private:
+        /// @brief Moves the elements into a larger block, version for growable storage types
+        /// @param required The minimum capacity
+        /// @param preferred The capacity to try first
+        template<typename U>
+        typename EnableIf<StorageTraits<U>::IsGrowable, bool>::Type Grow(SizeType required, SizeType preferred) {
+            if(preferred != required && this->m_Storage.Reallocate(preferred, this->m_CurrentSize)) return true;
+            if(this->m_Storage.Reallocate(required, this->m_CurrentSize)) return true;
+
+            this->RecordFailure();
+            return false;
+        }
+
+        /// @brief Reports the overflow, version for fixed storage types
+        template<typename U>
+        typename EnableIf<!StorageTraits<U>::IsGrowable, bool>::Type Grow(SizeType, SizeType) {
+            this->RecordFailure();
+            __WSTL_THROW_RETURNVALUE__(WSTL_MAKE_EXCEPTION(LengthError, "Vector overflow"), false);
+        }
+
+        /// @brief Moves the elements at and after an index further back, leaving uninitialized slots
+        /// @param index The index of the first slot of the gap
+        /// @param count The number of slots in the gap
+        /// @return `true` if the gap was opened
+        bool OpenGap(SizeType index, SizeType count) {
+            if(count == 0) return true;
+            if(!Accommodate(count)) return false;
+
+            RelocateBackward(Begin() + index, End(), End() + count, BoolConstant<IsTriviallyRelocatable<ValueType>::Value>());
+            this->m_CurrentSize += count;
+            return true;
+        }
+
+        /// @brief Moves elements into uninitialized memory from the back, general version
+        static void RelocateBackward(PointerType first, PointerType last, PointerType resultLast, FalseType) {
+            while(last != first) {
+                --last;
+                --resultLast;
+
+                ::new(static_cast<void*>(resultLast)) ValueType(__WSTL_MOVE__(*last));
+                last->~ValueType();
+            }
+        }
+
+        /// @brief Moves elements into uninitialized memory from the back, trivially relocatable version
+        static void RelocateBackward(PointerType first, PointerType last, PointerType resultLast, TrueType) {
+            __private::__Relocate(first, static_cast<size_t>(last - first), resultLast - (last - first), TrueType());
+        }
+
+        /// @brief Constructs copies of a range in uninitialized memory
+        template<typename InputIterator>
+        static void ConstructRange(PointerType destination, InputIterator first, InputIterator last) {
+            ConstructRange(destination, first, last, __private::__IsBitwiseCopyable<InputIterator, PointerType>());
+        }
+
+        template<typename InputIterator>
+        static void ConstructRange(PointerType destination, InputIterator first, InputIterator last, FalseType) {
+            for(; first != last; ++first, ++destination) ::new(static_cast<void*>(destination)) ValueType(*first);
+        }
+
+        template<typename InputIterator>
+        static void ConstructRange(PointerType destination, InputIterator first, InputIterator last, TrueType) {
+            Copy(first, last, destination);
+        }
+
+        /// @brief Swaps the contents of two vectors, version for swappable storage types: just swaps the storage and size
+        /// @param other The vector to swap with
+        template<typename U>
+        typename EnableIf<StorageTraits<U>::IsSwappable, void>::Type __Swap(BasicVector& other) {
+            wstl::Swap(this->m_Storage, other.m_Storage);
+            wstl::Swap(this->m_CurrentSize, other.m_CurrentSize);
+        }
+
+        /// @brief Swaps the contents of two vectors, version for non-swappable storage types: swaps elements one by one
+        /// @param other The vector to swap with
+        template<typename U>
+        typename EnableIf<!StorageTraits<U>::IsSwappable, void>::Type __Swap(BasicVector& other) {
+            BasicVector& longer = this->m_CurrentSize >= other.m_CurrentSize ? *this : other;
+            BasicVector& shorter = this->m_CurrentSize >= other.m_CurrentSize ? other : *this;
+            const SizeType common = shorter.m_CurrentSize;
+
+            if(!shorter.Accommodate(longer.m_CurrentSize - common)) return;
+
+            SwapRanges(longer.Begin(), longer.Begin() + common, shorter.Begin());
+            __private::__Relocate(longer.Begin() + common, longer.m_CurrentSize - common, shorter.Begin() + common);
+            wstl::Swap(this->m_CurrentSize, other.m_CurrentSize);
+        }
+    };
+
+    // Comparison operators
+
+    template<typename Storage>
+    inline bool operator==(const BasicVector<Storage>& a, const BasicVector<Storage>& b) {
+        return (a.Size() == b.Size()) && Equal(a.Begin(), a.End(), b.Begin());
+    }
+
+    template<typename Storage>
+    inline bool operator!=(const BasicVector<Storage>& a, const BasicVector<Storage>& b) {
+        return !(a == b);
+    }
+
+    template<typename Storage>
+    inline bool operator<(const BasicVector<Storage>& a, const BasicVector<Storage>& b) {
+        return LexicographicalCompare(a.Begin(), a.End(), b.Begin(), b.End());
+    }
+
+    template<typename Storage>
+    inline bool operator<=(const BasicVector<Storage>& a, const BasicVector<Storage>& b) {
+        return !(b < a);
+    }
+
+    template<typename Storage>
+    inline bool operator>(const BasicVector<Storage>& a, const BasicVector<Storage>& b) {
+        return b < a;
+    }
+
+    template<typename Storage>
+    inline bool operator>=(const BasicVector<Storage>& a, const BasicVector<Storage>& b) {
+        return !(a < b);
+    }
+
+    // Vector
+
+    /// @brief Version of vector with fixed storage, default option
+    /// @tparam T Type of the elements
+    /// @tparam N Capacity of the vector
+    /// @ingroup vector
+    template<typename T, size_t N>
+    class Vector : public BasicVector<FixedStorage<T, N> > {
+    private:
+        typedef BasicVector<FixedStorage<T, N> > Base;
+
+    public:
+        typedef typename Base::ValueType ValueType;
+        typedef typename Base::SizeType SizeType;
+        typedef typename Base::DifferenceType DifferenceType;
+        typedef typename Base::ReferenceType ReferenceType;
+        typedef typename Base::ConstReferenceType ConstReferenceType;
+        typedef typename Base::PointerType PointerType;
+        typedef typename Base::ConstPointerType ConstPointerType;
+
+        typedef typename Base::StorageType StorageType;
+
+        /// @brief The static size, needed for metaprogramming
+        static const __WSTL_CONSTEXPR__ SizeType StaticSize = N;
+
+        /// @brief Default constructor
+        Vector() : Base() {}
+
+        /// @brief Copy constructor
+        /// @param other The vector to copy from
+        Vector(const Vector& other) : Base(other) {}
+
+        #ifdef __WSTL_CXX11__
+        /// @brief Move constructor
+        /// @param other The vector to move from
+        /// @since C++11
+        Vector(Vector&& other) : Base(Move(other)) {}
+        #endif
+
+        /// @brief Constructor that initializes the vector with a range of elements
+        /// @param first Iterator to the first element in the range
+        /// @param last Iterator to the element following the last element in the range
+        template<typename InputIterator>
+        Vector(InputIterator first, InputIterator last, typename EnableIf<!IsIntegral<InputIterator>::Value, int>::Type = 0) : Base(first, last) {}
+
+        /// @brief Constructor that initializes the vector with a number of default-constructed elements
+        /// @param count The number of elements to create
+        explicit Vector(SizeType count) : Base(count) {}
+
+        /// @brief Constructor that initializes the vector with a number of copies of a value
+        /// @param count The number of elements to create
+        /// @param value The value to fill the vector with
+        Vector(SizeType count, ConstReferenceType value) : Base(count, value) {}
+
+        #if defined(__WSTL_CXX11__) && !defined(__WSTL_NO_INITIALIZERLIST__)
+        /// @brief Constructor that initializes the vector with an initializer list
+        /// @param list The initializer list to initialize the vector with
+        /// @since C++11
+        Vector(InitializerList<ValueType> list) : Base(list) {}
+        #endif
+
+        /// @brief Copy assignment operator
+        /// @param other The vector to copy from
+        Vector& operator=(const Vector& other) {
+            Base::operator=(other);
+            return *this;
+        }
+
+        #ifdef __WSTL_CXX11__
+        /// @brief Move assignment operator
+        /// @param other The vector to move from
+        /// @since C++11
+        Vector& operator=(Vector&& other) {
+            Base::operator=(Move(other));
+            return *this;
+        }
+
+        #ifndef __WSTL_NO_INITIALIZERLIST__
+        /// @brief Assignment operator that assigns from an initializer list
+        /// @param list The initializer list to assign from
+        /// @since C++11
+        Vector& operator=(InitializerList<ValueType> list) {
+            this->Assign(list);
+            return *this;
+        }
+        #endif
+        #endif
+    };
+
+    template<typename T, size_t N>
+    const __WSTL_CONSTEXPR__ typename Vector<T, N>::SizeType Vector<T, N>::StaticSize;
+
+    // Template deduction guides
+
+    #ifdef __WSTL_CXX17__
+    template<typename T, typename... U>
+    Vector(T, U...) -> Vector<T, sizeof...(U) + 1>;
+    #endif
+
+    // Small vector
+
+    /// @brief Version of vector that keeps up to `N` elements inline and spills to an allocator past that
+    /// @tparam T Type of the elements
+    /// @tparam N Number of elements held inline
+    /// @details Once spilled, the elements stay in allocated memory, which grows by doubling
+    /// @ingroup vector
+    template<typename T, size_t N>
+    class SmallVector : public BasicVector<SmallStorage<T, N> > {
+    private:
+        typedef BasicVector<SmallStorage<T, N> > Base;
+
+    public:
+        typedef typename Base::ValueType ValueType;
+        typedef typename Base::SizeType SizeType;
+        typedef typename Base::DifferenceType DifferenceType;
+        typedef typename Base::ReferenceType ReferenceType;
+        typedef typename Base::ConstReferenceType ConstReferenceType;
+        typedef typename Base::PointerType PointerType;
+        typedef typename Base::ConstPointerType ConstPointerType;
+
+        typedef typename Base::StorageType StorageType;
+
+        /// @brief The static size, needed for metaprogramming
+        static const __WSTL_CONSTEXPR__ SizeType StaticSize = N;
+
+        /// @brief Constructor
+        /// @param allocator The allocator to spill to
+        explicit SmallVector(Allocator& allocator) : Base(StorageType(allocator)) {}
+
+        /// @brief Copy constructor, spills to the same allocator as the other vector
+        /// @param other The vector to copy from
+        SmallVector(const SmallVector& other) : Base(other, StorageType(*other.m_Storage.GetAllocator())) {}
+
+        /// @brief Copy constructor that spills to a given allocator
+        /// @param other The vector to copy from
+        /// @param allocator The allocator to spill to
+        SmallVector(const SmallVector& other, Allocator& allocator) : Base(other, StorageType(allocator)) {}
+
+        #ifdef __WSTL_CXX11__
+        /// @brief Move constructor, spills to the same allocator as the other vector
+        /// @param other The vector to move from
+        /// @since C++11
+        SmallVector(SmallVector&& other) : Base(Move(other), StorageType(*other.m_Storage.GetAllocator())) {}
+        #endif
+
+        /// @brief Constructor that initializes the vector with a range of elements
+        /// @param first Iterator to the first element in the range
+        /// @param last Iterator to the element following the last element in the range
+        /// @param allocator The allocator to spill to
+        template<typename InputIterator>
+        SmallVector(InputIterator first, InputIterator last, Allocator& allocator,
+            typename EnableIf<!IsIntegral<InputIterator>::Value, int>::Type = 0) : Base(first, last, StorageType(allocator)) {}
+
+        /// @brief Constructor that initializes the vector with a number of default-constructed elements
+        /// @param count The number of elements to create
+        /// @param allocator The allocator to spill to
+        SmallVector(SizeType count, Allocator& allocator) : Base(count, StorageType(allocator)) {}
+
+        /// @brief Constructor that initializes the vector with a number of copies of a value
+        /// @param count The number of elements to create
+        /// @param value The value to fill the vector with
+        /// @param allocator The allocator to spill to
+        SmallVector(SizeType count, ConstReferenceType value, Allocator& allocator) : Base(count, value, StorageType(allocator)) {}
+
+        #if defined(__WSTL_CXX11__) && !defined(__WSTL_NO_INITIALIZERLIST__)
+        /// @brief Constructor that initializes the vector with an initializer list
+        /// @param list The initializer list to initialize the vector with
+        /// @param allocator The allocator to spill to
+        /// @since C++11
+        SmallVector(InitializerList<ValueType> list, Allocator& allocator) : Base(list, StorageType(allocator)) {}
+        #endif
+
+        /// @brief Copy assignment operator
+        /// @param other The vector to copy from
+        SmallVector& operator=(const SmallVector& other) {
+            Base::operator=(other);
+            return *this;
+        }
+
+        #ifdef __WSTL_CXX11__
+        /// @brief Move assignment operator
+        /// @param other The vector to move from
+        /// @since C++11
+        SmallVector& operator=(SmallVector&& other) {
+            Base::operator=(Move(other));
+            return *this;
+        }
+
+        #ifndef __WSTL_NO_INITIALIZERLIST__
+        /// @brief Assignment operator that assigns from an initializer list
+        /// @param list The initializer list to assign from
+        /// @since C++11
+        SmallVector& operator=(InitializerList<ValueType> list) {
+            this->Assign(list);
+            return *this;
+        }
+        #endif
+        #endif
+
+        /// @brief Checks whether the elements are still held inline
+        bool IsInline() const {
+            return this->m_Storage.IsInline();
+        }
+    };
+
+    template<typename T, size_t N>
+    const __WSTL_CONSTEXPR__ typename SmallVector<T, N>::SizeType SmallVector<T, N>::StaticSize;
+
+    namespace external {
+        /// @brief Version of vector that uses external storage
+        /// @tparam T Type of the elements
+        /// @ingroup vector
+        template<typename T>
+        class Vector : public BasicVector<ExternalStorage<T> > {
+        private:
+            typedef BasicVector<ExternalStorage<T> > Base;
+
+        public:
+            typedef typename Base::ValueType ValueType;
+            typedef typename Base::SizeType SizeType;
+            typedef typename Base::DifferenceType DifferenceType;
+            typedef typename Base::ReferenceType ReferenceType;
+            typedef typename Base::ConstReferenceType ConstReferenceType;
+            typedef typename Base::PointerType PointerType;
+            typedef typename Base::ConstPointerType ConstPointerType;
+
+            typedef typename Base::StorageType StorageType;
+
+            /// @brief Constructor that uses external buffer
+            /// @param buffer Pointer to the external buffer
+            /// @param capacity Capacity of the external buffer
+            Vector(T* buffer, SizeType capacity) : Base(StorageType(buffer, capacity)) {}
+
+            /// @brief Copy constructor that uses external buffer
+            /// @param other The vector to copy from
+            /// @param buffer Pointer to the external buffer
+            /// @param capacity Capacity of the external buffer
+            Vector(const Vector& other, T* buffer, SizeType capacity) : Base(other, StorageType(buffer, capacity)) {}
+
+            #ifdef __WSTL_CXX11__
+            /// @brief Move constructor that uses external buffer
+            /// @param other The vector to move from
+            /// @param buffer Pointer to the external buffer
+            /// @param capacity Capacity of the external buffer
+            /// @since C++11
+            Vector(Vector&& other, T* buffer, SizeType capacity) : Base(Move(other), StorageType(buffer, capacity)) {}
+            #endif
+
+            /// @brief Constructor that initializes the vector with a range of elements
+            /// @param first Iterator to the first element in the range
+            /// @param last Iterator to the element following the last element in the range
+            /// @param buffer Pointer to the external buffer
+            /// @param capacity Capacity of the external buffer
+            template<typename InputIterator>
+            Vector(InputIterator first, InputIterator last, T* buffer, SizeType capacity,
+                typename EnableIf<!IsIntegral<InputIterator>::Value, int>::Type = 0) : Base(first, last, StorageType(buffer, capacity)) {}
+
+            /// @brief Constructor that initializes the vector with a number of default-constructed elements
+            /// @param count The number of elements to create
+            /// @param buffer Pointer to the external buffer
+            /// @param capacity Capacity of the external buffer
+            Vector(SizeType count, T* buffer, SizeType capacity) : Base(count, StorageType(buffer, capacity)) {}
+
+            /// @brief Constructor that initializes the vector with a number of copies of a value
+            /// @param count The number of elements to create
+            /// @param value The value to fill the vector with
+            /// @param buffer Pointer to the external buffer
+            /// @param capacity Capacity of the external buffer
+            Vector(SizeType count, ConstReferenceType value, T* buffer, SizeType capacity) : Base(count, value, StorageType(buffer, capacity)) {}
+
+            #if defined(__WSTL_CXX11__) && !defined(__WSTL_NO_INITIALIZERLIST__)
+            /// @brief Constructor that initializes the vector with an initializer list
+            /// @param list The initializer list to initialize the vector with
+            /// @param buffer Pointer to the external buffer
+            /// @param capacity Capacity of the external buffer
+            /// @since C++11
+            Vector(InitializerList<ValueType> list, T* buffer, SizeType capacity) : Base(list, StorageType(buffer, capacity)) {}
+            #endif
+
+            /// @brief Copy assignment operator
+            /// @param other The vector to copy from
+            Vector& operator=(const Vector& other) {
+                Base::operator=(other);
+                return *this;
+            }
+
+            #ifdef __WSTL_CXX11__
+            /// @brief Move assignment operator
+            /// @param other The vector to move from
+            /// @since C++11
+            Vector& operator=(Vector&& other) {
+                Base::operator=(Move(other));
+                return *this;
+            }
+
+            #ifndef __WSTL_NO_INITIALIZERLIST__
+            /// @brief Assignment operator that assigns from an initializer list
+            /// @param list The initializer list to assign from
+            /// @since C++11
+            Vector& operator=(InitializerList<ValueType> list) {
+                this->Assign(list);
+                return *this;
+            }
+            #endif
+            #endif
+        };
+
+        /// @brief Version of vector that uses fixed external storage with compile-time known capacity
+        /// @tparam T Type of the elements
+        /// @tparam N Capacity of the vector
+        /// @ingroup vector
+        template<typename T, size_t N>
+        class FixedVector : public BasicVector<FixedExternalStorage<T, N> > {
+        private:
+            typedef BasicVector<FixedExternalStorage<T, N> > Base;
+
+        public:
+            typedef typename Base::ValueType ValueType;
+            typedef typename Base::SizeType SizeType;
+            typedef typename Base::DifferenceType DifferenceType;
+            typedef typename Base::ReferenceType ReferenceType;
+            typedef typename Base::ConstReferenceType ConstReferenceType;
+            typedef typename Base::PointerType PointerType;
+            typedef typename Base::ConstPointerType ConstPointerType;
+
+            typedef typename Base::StorageType StorageType;
+
+            /// @brief The static size, needed for metaprogramming
+            static const __WSTL_CONSTEXPR__ SizeType StaticSize = N;
+
+            /// @brief Constructor that uses external buffer
+            /// @param buffer Pointer to the external buffer
+            explicit FixedVector(T* buffer) : Base(StorageType(buffer)) {}
+
+            /// @brief Copy constructor that uses external buffer
+            /// @param other The vector to copy from
+            /// @param buffer Pointer to the external buffer
+            FixedVector(const FixedVector& other, T* buffer) : Base(other, StorageType(buffer)) {}
+
+            #ifdef __WSTL_CXX11__
+            /// @brief Move constructor that uses external buffer
+            /// @param other The vector to move from
+            /// @param buffer Pointer to the external buffer
+            /// @since C++11
+            FixedVector(FixedVector&& other, T* buffer) : Base(Move(other), StorageType(buffer)) {}
+            #endif
+
+            /// @brief Constructor that initializes the vector with a range of elements
+            /// @param first Iterator to the first element in the range
+            /// @param last Iterator to the element following the last element in the range
+            /// @param buffer Pointer to the external buffer
+            template<typename InputIterator>
+            FixedVector(InputIterator first, InputIterator last, T* buffer,
+                typename EnableIf<!IsIntegral<InputIterator>::Value, int>::Type = 0) : Base(first, last, StorageType(buffer)) {}
+
+            /// @brief Constructor that initializes the vector with a number of default-constructed elements
+            /// @param count The number of elements to create
+            /// @param buffer Pointer to the external buffer
+            FixedVector(SizeType count, T* buffer) : Base(count, StorageType(buffer)) {}
+
+            /// @brief Constructor that initializes the vector with a number of copies of a value
+            /// @param count The number of elements to create
+            /// @param value The value to fill the vector with
+            /// @param buffer Pointer to the external buffer
+            FixedVector(SizeType count, ConstReferenceType value, T* buffer) : Base(count, value, StorageType(buffer)) {}
+
+            #if defined(__WSTL_CXX11__) && !defined(__WSTL_NO_INITIALIZERLIST__)
+            /// @brief Constructor that initializes the vector with an initializer list
+            /// @param list The initializer list to initialize the vector with
+            /// @param buffer Pointer to the external buffer
+            /// @since C++11
+            FixedVector(InitializerList<ValueType> list, T* buffer) : Base(list, StorageType(buffer)) {}
+            #endif
+
+            /// @brief Copy assignment operator
+            /// @param other The vector to copy from
+            FixedVector& operator=(const FixedVector& other) {
+                Base::operator=(other);
+                return *this;
+            }
+
+            #ifdef __WSTL_CXX11__
+            /// @brief Move assignment operator
+            /// @param other The vector to move from
+            /// @since C++11
+            FixedVector& operator=(FixedVector&& other) {
+                Base::operator=(Move(other));
+                return *this;
+            }
+
+            #ifndef __WSTL_NO_INITIALIZERLIST__
+            /// @brief Assignment operator that assigns from an initializer list
+            /// @param list The initializer list to assign from
+            /// @since C++11
+            FixedVector& operator=(InitializerList<ValueType> list) {
+                this->Assign(list);
+                return *this;
+            }
+            #endif
+            #endif
+        };
+
+        template<typename T, size_t N>
+        const __WSTL_CONSTEXPR__ typename FixedVector<T, N>::SizeType FixedVector<T, N>::StaticSize;
+
+        // Template deduction guides
+
+        #ifdef __WSTL_CXX17__
+        template<typename T, size_t N>
+        FixedVector(T(&)[N]) -> FixedVector<T, N>;
+
+        template<typename T, typename U, size_t N>
+        FixedVector(U, T(&)[N]) -> FixedVector<T, N>;
+
+        template<typename T, typename U1, typename U2, size_t N>
+        FixedVector(U1, U2, T(&)[N]) -> FixedVector<T, N>;
+
+        #ifndef __WSTL_NO_INITIALIZERLIST__
+        template<typename T, size_t N>
+        FixedVector(InitializerList<T>, T(&)[N]) -> FixedVector<T, N>;
+        #endif
+        #endif
+    }
+
+    namespace allocated {
+        /// @brief Version of vector that draws its storage from an allocator and grows by doubling
+        /// @tparam T Type of the elements
+        /// @ingroup vector
+        template<typename T>
+        class Vector : public BasicVector<AllocatorStorage<T> > {
+        private:
+            typedef BasicVector<AllocatorStorage<T> > Base;
+
+        public:
+            typedef typename Base::ValueType ValueType;
+            typedef typename Base::SizeType SizeType;
+            typedef typename Base::DifferenceType DifferenceType;
+            typedef typename Base::ReferenceType ReferenceType;
+            typedef typename Base::ConstReferenceType ConstReferenceType;
+            typedef typename Base::PointerType PointerType;
+            typedef typename Base::ConstPointerType ConstPointerType;
+
+            typedef typename Base::StorageType StorageType;
+
+            /// @brief Constructor that draws storage from an allocator
+            /// @param allocator The allocator to draw the storage from
+            /// @param capacity Initial capacity of the vector
+            Vector(Allocator& allocator, SizeType capacity) : Base(StorageType(allocator, capacity)) {}
+
+            /// @brief Copy constructor that draws storage from an allocator
+            /// @param other The vector to copy from
+            /// @param allocator The allocator to draw the storage from
+            /// @param capacity Initial capacity of the vector
+            Vector(const Vector& other, Allocator& allocator, SizeType capacity) : Base(other, StorageType(allocator, capacity)) {}
+
+            #ifdef __WSTL_CXX11__
+            /// @brief Move constructor that draws storage from an allocator
+            /// @param other The vector to move from
+            /// @param allocator The allocator to draw the storage from
+            /// @param capacity Initial capacity of the vector
+            /// @since C++11
+            Vector(Vector&& other, Allocator& allocator, SizeType capacity) : Base(Move(other), StorageType(allocator, capacity)) {}
+            #endif
+
+            /// @brief Constructor that initializes the vector with a range of elements
+            /// @param first Iterator to the first element in the range
+            /// @param last Iterator to the element following the last element in the range
+            /// @param allocator The allocator to draw the storage from
+            /// @param capacity Initial capacity of the vector
+            template<typename InputIterator>
+            Vector(InputIterator first, InputIterator last, Allocator& allocator, SizeType capacity,
+                typename EnableIf<!IsIntegral<InputIterator>::Value, int>::Type = 0) : Base(first, last, StorageType(allocator, capacity)) {}
+
+            /// @brief Constructor that initializes the vector with a number of default-constructed elements
+            /// @param count The number of elements to create
+            /// @param allocator The allocator to draw the storage from
+            /// @param capacity Initial capacity of the vector
+            Vector(SizeType count, Allocator& allocator, SizeType capacity) : Base(count, StorageType(allocator, capacity)) {}
+
+            /// @brief Constructor that initializes the vector with a number of copies of a value
+            /// @param count The number of elements to create
+            /// @param value The value to fill the vector with
+            /// @param allocator The allocator to draw the storage from
+            /// @param capacity Initial capacity of the vector
+            Vector(SizeType count, ConstReferenceType value, Allocator& allocator, SizeType capacity) : Base(count, value, StorageType(allocator, capacity)) {}
+
+            #if defined(__WSTL_CXX11__) && !defined(__WSTL_NO_INITIALIZERLIST__)
+            /// @brief Constructor that initializes the vector with an initializer list
+            /// @param list The initializer list to initialize the vector with
+            /// @param allocator The allocator to draw the storage from
+            /// @param capacity Initial capacity of the vector
+            /// @since C++11
+            Vector(InitializerList<ValueType> list, Allocator& allocator, SizeType capacity) : Base(list, StorageType(allocator, capacity)) {}
+            #endif
+
+            /// @brief Copy assignment operator
+            /// @param other The vector to copy from
+            Vector& operator=(const Vector& other) {
+                Base::operator=(other);
+                return *this;
+            }
+
+            #ifdef __WSTL_CXX11__
+            /// @brief Move assignment operator
+            /// @param other The vector to move from
+            /// @since C++11
+            Vector& operator=(Vector&& other) {
+                Base::operator=(Move(other));
+                return *this;
+            }
+
+            #ifndef __WSTL_NO_INITIALIZERLIST__
+            /// @brief Assignment operator that assigns from an initializer list
+            /// @param list The initializer list to assign from
+            /// @since C++11
+            Vector& operator=(InitializerList<ValueType> list) {
+                this->Assign(list);
+                return *this;
+            }
+            #endif
+            #endif
+        };
+    }
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,240 @@
+// Part of WardenSTL - https://github.com/WardenHD/WardenSTL
+// Copyright (c) 2025 Artem Bezruchko (WardenHD)
+//
+// Licensed under the MIT License. See LICENSE file for details.
+
+#ifndef __WSTL_WORKSTEALINGPOOL_HPP__
+#define __WSTL_WORKSTEALINGPOOL_HPP__
+
+#include "private/Platform.hpp"
+#include "Execution.hpp"
+#include "Atomic.hpp"
+#include "StaticAssert.hpp"
+#include "NullPointer.hpp"
+#include <stddef.h>
+
+
+#ifdef __WSTL_PARALLEL__
+namespace wstl {
+    namespace __private {
+        /// @brief One call of `ParallelBackend::Execute`, shared by the tasks it splits into
+        struct __ParallelExecution {
+            ParallelBackend::TaskFunction Function;
+            void* Context;
+            size_t Grain;
+            Atomic<size_t> Remaining;
+        };
+
+        /// @brief Range of indices of an execution, the unit of work in the deques
+        struct __ParallelTask {
+            __ParallelExecution* Execution;
+            size_t Begin;
+            size_t End;
+        };
+
+        /// @brief Chase-Lev work-stealing deque of fixed capacity
+        /// @details The owner pushes and pops at the bottom, other workers steal from the top.
+        /// Slots are atomic words, so a thief that loses the race for a slot only reads stale values
+        /// @see https://fzn.fr/readings/ppopp13.pdf
+        template<size_t Capacity>
+        class __WorkStealingDeque {
+        public:
+            WSTL_STATIC_ASSERT(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "Deque capacity must be a power of two");
+
+            __WorkStealingDeque() : m_Top(0), m_Bottom(0) {}
+
+            bool Push(const __ParallelTask& task) {
+                const ptrdiff_t bottom = m_Bottom.Load(MEMORY_ORDER_RELAXED);
+                const ptrdiff_t top = m_Top.Load(MEMORY_ORDER_ACQUIRE);
+
+                if(bottom - top >= ptrdiff_t(Capacity)) return false;
+
+                Write(bottom, task);
+                m_Bottom.Store(bottom + 1, MEMORY_ORDER_RELEASE);
+
+                return true;
+            }
+
+            bool Pop(__ParallelTask& task) {
+                const ptrdiff_t bottom = m_Bottom.Load(MEMORY_ORDER_RELAXED) - 1;
+                m_Bottom.Store(bottom, MEMORY_ORDER_RELAXED);
+                AtomicThreadFence(MEMORY_ORDER_SEQ_CST);
+                ptrdiff_t top = m_Top.Load(MEMORY_ORDER_RELAXED);
+
+                if(top > bottom) {
+                    m_Bottom.Store(bottom + 1, MEMORY_ORDER_RELAXED);
+                    return false;
+                }
+
+                Read(bottom, task);
+                if(top < bottom) return true;
+
+                // Last task, race the thieves for it
+                const bool won = m_Top.CompareExchangeStrong(top, top + 1, MEMORY_ORDER_SEQ_CST, MEMORY_ORDER_RELAXED);
+                m_Bottom.Store(bottom + 1, MEMORY_ORDER_RELAXED);
+
+                return won;
+            }
+
+            bool Steal(__ParallelTask& task) {
+                ptrdiff_t top = m_Top.Load(MEMORY_ORDER_ACQUIRE);
+                AtomicThreadFence(MEMORY_ORDER_SEQ_CST);
+                const ptrdiff_t bottom = m_Bottom.Load(MEMORY_ORDER_ACQUIRE);
+
+                if(top >= bottom) return false;
+
+                Read(top, task);
+                return m_Top.CompareExchangeStrong(top, top + 1, MEMORY_ORDER_SEQ_CST, MEMORY_ORDER_RELAXED);
+            }
+
+        private:
+            struct Slot {
+                Atomic<__ParallelExecution*> Execution;
+                Atomic<size_t> Begin;
+                Atomic<size_t> End;
+            };
+
+            Atomic<ptrdiff_t> m_Top;
+            Atomic<ptrdiff_t> m_Bottom;
+            Slot m_Slots[Capacity];
+
+            void Write(ptrdiff_t index, const __ParallelTask& task) {
+                Slot& slot = m_Slots[size_t(index) & (Capacity - 1)];
+                slot.Execution.Store(task.Execution, MEMORY_ORDER_RELAXED);
+                slot.Begin.Store(task.Begin, MEMORY_ORDER_RELAXED);
+                slot.End.Store(task.End, MEMORY_ORDER_RELAXED);
+            }
+
+            void Read(ptrdiff_t index, __ParallelTask& task) const {
+                const Slot& slot = m_Slots[size_t(index) & (Capacity - 1)];
+                task.Execution = slot.Execution.Load(MEMORY_ORDER_RELAXED);
+                task.Begin = slot.Begin.Load(MEMORY_ORDER_RELAXED);
+                task.End = slot.End.Load(MEMORY_ORDER_RELAXED);
+            }
+        };
+    }
+
+    // Work-stealing pool
+
+    /// @brief Parallel backend that balances tasks between workers with work-stealing deques
+    /// @tparam Workers Number of workers, including the thread that calls `Execute`
+    /// @tparam DequeCapacity Number of tasks a worker can hold, a power of two
+    /// @details The pool does not create threads, the platform does: worker 0 is the thread that
+    /// calls `Execute`, and threads 1 to `Workers - 1` each call `Work` with their index. Every worker
+    /// owns a Chase-Lev deque. A task covering many indices is split in halves, the worker keeps
+    /// one half and pushes the other to the bottom of its deque, where idle workers steal it from
+    /// the top, so the work spreads out in O(log n) steps and stays balanced when tasks take uneven
+    /// time. While a worker waits for its execution to finish, it runs other tasks, so algorithms
+    /// may call `Execute` again from inside a task. Task functions must not throw
+    /// @ingroup execution
+    ///
+    /// @code
+    /// static WorkStealingPool<4> pool(&sched_yield);
+    ///
+    /// for(size_t i = 1; i < 4; ++i) StartThread([i] { pool.Work(i); });
+    /// SetParallelBackend(&pool);
+    ///
+    /// Sort(execution::Parallel, samples.Begin(), samples.End());
+    /// @endcode
+    /// @since C++11
+    template<size_t Workers, size_t DequeCapacity = 256>
+    class WorkStealingPool : public ParallelBackend {
+    public:
+        WSTL_STATIC_ASSERT(Workers > 0, "Pool must have a worker");
+
+        /// @brief Function called by a worker that found nothing to do, such as `sched_yield`
+        typedef void (*IdleFunction)();
+
+        /// @brief Constructor
+        /// @param idle Function called when a worker finds no task, null pointer to spin
+        explicit WorkStealingPool(IdleFunction idle = NullPointer) : m_Stopped(false), m_Idle(idle) {}
+
+        /// @copydoc ParallelBackend::Concurrency()
+        virtual size_t Concurrency() const __WSTL_OVERRIDE__ {
+            return Workers;
+        }
+
+        /// @copydoc ParallelBackend::Execute(TaskFunction, void*, size_t, size_t)
+        /// @details Must be called from worker 0 or from inside a task
+        virtual void Execute(TaskFunction function, void* context, size_t count, size_t grain) __WSTL_OVERRIDE__ {
+            if(count == 0) return;
+
+            __private::__ParallelExecution execution;
+            execution.Function = function;
+            execution.Context = context;
+            execution.Grain = grain > 0 ? grain : 1;
+            execution.Remaining.Store(count, MEMORY_ORDER_RELAXED);
+
+            const size_t worker = CurrentWorker();
+
+            __private::__ParallelTask root = { &execution, 0, count };
+            RunTask(worker, root);
+
+            while(execution.Remaining.Load(MEMORY_ORDER_ACQUIRE) != 0) {
+                if(!RunNext(worker)) Idle();
+            }
+        }
+
+        /// @brief Runs tasks on a worker thread until `Stop` is called
+        /// @param worker Index of the worker, from 1 to `Workers - 1`
+        void Work(size_t worker) {
+            CurrentWorker() = worker;
+
+            while(!m_Stopped.Load(MEMORY_ORDER_ACQUIRE)) {
+                if(!RunNext(worker)) Idle();
+            }
+        }
+
+        /// @brief Makes `Work` return on all worker threads once their current task is done
+        void Stop() {
+            m_Stopped.Store(true, MEMORY_ORDER_RELEASE);
+        }
+
+    private:
+        __private::__WorkStealingDeque<DequeCapacity> m_Deques[Workers];
+        Atomic<bool> m_Stopped;
+        IdleFunction m_Idle;
+
+        static size_t& CurrentWorker() {
+            static thread_local size_t worker = 0;
+            return worker;
+        }
+
+        void Idle() const {
+            if(m_Idle != NullPointer) m_Idle();
+        }
+
+        bool RunNext(size_t worker) {
+            __private::__ParallelTask task;
+
+            if(!m_Deques[worker].Pop(task)) {
+                bool stolen = false;
+
+                for(size_t i = 1; i < Workers && !stolen; ++i) stolen = m_Deques[(worker + i) % Workers].Steal(task);
+                if(!stolen) return false;
+            }
+
+            RunTask(worker, task);
+            return true;
+        }
+
+        void RunTask(size_t worker, __private::__ParallelTask task) {
+            __private::__ParallelExecution& execution = *task.Execution;
+
+            // Split off the upper half while the task is large, a full deque keeps the rest here
+            while(task.End - task.Begin > execution.Grain) {
+                const size_t middle = task.Begin + (task.End - task.Begin) / 2;
+                const __private::__ParallelTask upper = { &execution, middle, task.End };
+
+                if(!m_Deques[worker].Push(upper)) break;
+                task.End = middle;
+            }
+
+            execution.Function(execution.Context, task.Begin, task.End);
+            execution.Remaining.FetchSub(task.End - task.Begin, MEMORY_ORDER_RELEASE);
+        }
+    };
+}
+#endif
+
+#endif
@@ -79,6 +79,20 @@ namespace wstl {
         private:
             friend Base;
 
+            /// @brief Appends a block of bytes to the hasher
+            /// @param data Pointer to the block
+            /// @param size Size of the block in bytes
+            __WSTL_CONSTEXPR14__ void AppendBlock(const uint8_t* data, size_t size) {
+                HashType hash = this->m_Hash;
+
+                for(const uint8_t* end = data + size; data != end; ++data) {
+                    hash *= Constants::PRIME;
+                    hash ^= *data;
+                }
+
+                this->m_Hash = hash;
+            }
+
             /// @brief Finalizes the hash computation, does nothing
             __WSTL_CONSTEXPR14__ void Finalize() {}
         };
@@ -138,6 +152,20 @@ namespace wstl {
         private:
             friend Base;
 
+            /// @brief Appends a block of bytes to the hasher
+            /// @param data Pointer to the block
+            /// @param size Size of the block in bytes
+            __WSTL_CONSTEXPR14__ void AppendBlock(const uint8_t* data, size_t size) {
+                HashType hash = this->m_Hash;
+
+                for(const uint8_t* end = data + size; data != end; ++data) {
+                    hash ^= *data;
+                    hash *= Constants::PRIME;
+                }
+
+                this->m_Hash = hash;
+            }
+
             /// @brief Finalizes the hash computation, does nothing
             __WSTL_CONSTEXPR14__ void Finalize() {}
         };
@@ -62,6 +62,24 @@ namespace wstl {
 
             friend Base;
 
+            /// @brief Appends a block of bytes to the hasher
+            /// @param data Pointer to the block
+            /// @param size Size of the block in bytes
+            /// @throws `LogicError` if the hasher is already finalized
+            __WSTL_CONSTEXPR14__ void AppendBlock(const uint8_t* data, size_t size) {
+                __WSTL_ASSERT_RETURN__(!m_IsFinalized, WSTL_MAKE_EXCEPTION(LogicError, "Cannot add value to finalized Jenkins hash"));
+
+                HashType hash = m_Hash;
+
+                for(const uint8_t* end = data + size; data != end; ++data) {
+                    hash += *data;
+                    hash += (hash << 10);
+                    hash ^= (hash >> 6);
+                }
+
+                m_Hash = hash;
+            }
+
             /// @brief Finalizes the hash value
             __WSTL_CONSTEXPR14__ void Finalize() {
                 if(!m_IsFinalized) {
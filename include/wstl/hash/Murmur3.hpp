@@ -62,17 +62,10 @@ namespace wstl {
             __WSTL_CONSTEXPR14__ void PushBack(ValueType value) {
                 __WSTL_ASSERT_RETURN__(!m_IsFinalized, WSTL_MAKE_EXCEPTION(LogicError, "Cannot add value to finalized Murmur3 hash"));
 
-                m_Block |= value << (m_BlockSize * 8);
+                m_Block |= HashType(value) << (m_BlockSize * 8);
                 
                 if(++m_BlockSize == 4) {
-                    m_Block *= CONSTANT1;
-                    m_Block = RotateLeft(m_Block, ROTATE1);
-                    m_Block *= CONSTANT2;
-
-                    this->m_Hash ^= m_Block;
-                    this->m_Hash = RotateLeft(this->m_Hash, ROTATE2);
-                    this->m_Hash = (this->m_Hash * MULTIPLY) + ADD;
-
+                    this->m_Hash = MixBlock(this->m_Hash, m_Block);
                     m_Block = 0;
                     m_BlockSize = 0;
                 }
@@ -89,6 +82,44 @@ namespace wstl {
 
             friend Base;
 
+            /// @brief Mixes a complete 4-byte block into the hash
+            /// @param hash The current hash value
+            /// @param block The block to mix
+            /// @return The new hash value
+            static __WSTL_CONSTEXPR14__ HashType MixBlock(HashType hash, HashType block) {
+                block *= CONSTANT1;
+                block = RotateLeft(block, ROTATE1);
+                block *= CONSTANT2;
+
+                hash ^= block;
+                hash = RotateLeft(hash, ROTATE2);
+                return (hash * MULTIPLY) + ADD;
+            }
+
+            /// @brief Appends a block of bytes to the hasher
+            /// @details Whole 4-byte blocks are read directly from the input instead of being rebuilt byte by byte
+            /// @param data Pointer to the block
+            /// @param size Size of the block in bytes
+            /// @throws `LogicError` if the hasher is already finalized
+            __WSTL_CONSTEXPR14__ void AppendBlock(const uint8_t* data, size_t size) {
+                __WSTL_ASSERT_RETURN__(!m_IsFinalized, WSTL_MAKE_EXCEPTION(LogicError, "Cannot add value to finalized Murmur3 hash"));
+
+                for(; size > 0 && m_BlockSize != 0; --size) PushBack(*data++);
+
+                HashType hash = this->m_Hash;
+                const uint8_t* const end = data + (size & ~size_t(3U));
+
+                for(; data != end; data += 4) {
+                    hash = MixBlock(hash, HashType(data[0]) | (HashType(data[1]) << 8) | 
+                        (HashType(data[2]) << 16) | (HashType(data[3]) << 24));
+                }
+
+                this->m_Hash = hash;
+                m_CharCount += static_cast<HashType>(size & ~size_t(3U));
+
+                for(size &= 3U; size > 0; --size) PushBack(*data++);
+            }
+
             /// @brief Finalizes the hash value
             __WSTL_CONSTEXPR14__ void Finalize() {
                 if(!m_IsFinalized) {
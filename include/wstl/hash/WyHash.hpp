@@ -0,0 +1,283 @@
+// Part of WardenSTL - https://github.com/WardenHD/WardenSTL
+// Copyright (c) 2025 Artem Bezruchko (WardenHD)
+//
+// This file is based on wyhash (final version 3) by Wang Yi
+// from https://github.com/wangyi-fudan/wyhash, released into the public domain.
+//
+// Licensed under the MIT License. See LICENSE file for details.
+
+#ifndef __WSTL_WYHASH_HPP__
+#define __WSTL_WYHASH_HPP__
+
+#include "../private/Platform.hpp"
+#include "../private/Error.hpp"
+#include "../HasherBase.hpp"
+#include "../StandardExceptions.hpp"
+#include <stddef.h>
+#include <stdint.h>
+
+
+namespace wstl {
+    namespace __private {
+        /// @brief Multiplies two 64-bit values, `a` gets the lower and `b` the upper half of the product
+        __WSTL_CONSTEXPR14__ inline void __WyMultiply(uint64_t& a, uint64_t& b) {
+            #ifdef __SIZEOF_INT128__
+            __extension__ typedef unsigned __int128 ProductType;
+            const ProductType product = static_cast<ProductType>(a) * b;
+
+            a = static_cast<uint64_t>(product);
+            b = static_cast<uint64_t>(product >> 64);
+            #else
+            const uint64_t aHigh = a >> 32, aLow = a & 0xFFFFFFFFULL;
+            const uint64_t bHigh = b >> 32, bLow = b & 0xFFFFFFFFULL;
+            const uint64_t highLow = aHigh * bLow, lowHigh = aLow * bHigh, lowLow = aLow * bLow;
+
+            const uint64_t partial = lowLow + (highLow << 32);
+            uint64_t carry = partial < lowLow;
+            const uint64_t low = partial + (lowHigh << 32);
+            carry += low < partial;
+
+            a = low;
+            b = aHigh * bHigh + (highLow >> 32) + (lowHigh >> 32) + carry;
+            #endif
+        }
+
+        /// @brief Folds the 128-bit product of two values into 64 bits
+        __WSTL_CONSTEXPR14__ inline uint64_t __WyMix(uint64_t a, uint64_t b) {
+            __WyMultiply(a, b);
+            return a ^ b;
+        }
+
+        __WSTL_CONSTEXPR14__ inline uint64_t __WyRead8(const uint8_t* p) {
+            return uint64_t(p[0]) | (uint64_t(p[1]) << 8) | (uint64_t(p[2]) << 16) | (uint64_t(p[3]) << 24) |
+                (uint64_t(p[4]) << 32) | (uint64_t(p[5]) << 40) | (uint64_t(p[6]) << 48) | (uint64_t(p[7]) << 56);
+        }
+
+        __WSTL_CONSTEXPR14__ inline uint64_t __WyRead4(const uint8_t* p) {
+            return uint64_t(p[0]) | (uint64_t(p[1]) << 8) | (uint64_t(p[2]) << 16) | (uint64_t(p[3]) << 24);
+        }
+    }
+
+    namespace hash {
+        /// @brief wyhash hash function implementation
+        /// @details Consumes the input 48 bytes at a time in three independent lanes, each mixing
+        /// 16 bytes with a single 64x64-bit multiplication, so long keys cost a fraction of a
+        /// multiplication per byte instead of one per byte like FNV-1a. Keys of up to 16 bytes take
+        /// two reads and two multiplications. The seed changes every hash, which makes the keys
+        /// that collide unpredictable to someone who does not know it. `Hash` is the one-shot form
+        /// used by `Hash` of strings, spans and bitsets when `__WSTL_FAST_HASH__` is defined; the
+        /// incremental form buffers up to 64 bytes and gives the same value
+        /// @ingroup hash
+        /// @see https://github.com/wangyi-fudan/wyhash
+        class WyHash : public HasherBase<WyHash, uint64_t, uint8_t> {
+        private:
+            typedef HasherBase<WyHash, uint64_t, uint8_t> Base;
+
+        public:
+            typedef Base::HashType HashType;
+            typedef Base::ValueType ValueType;
+
+            /// @brief Default constructor
+            /// @param seed Initial seed value for the hash, defaults to 0
+            __WSTL_CONSTEXPR14__ explicit WyHash(uint64_t seed = 0) : m_Seed(seed), m_State(), m_Lane1(), m_Lane2(),
+                m_Length(), m_Buffer(), m_Buffered(), m_HasBlocks(), m_IsFinalized() {
+                Reset();
+            }
+
+            /// @brief Constructor that initializes the hasher with a range of values
+            /// @param first The beginning of the range
+            /// @param last The end of the range
+            /// @param seed Initial seed value for the hash, defaults to 0
+            template<typename Iterator>
+            __WSTL_CONSTEXPR14__ WyHash(Iterator first, Iterator last, uint64_t seed = 0) : m_Seed(seed), m_State(), m_Lane1(), m_Lane2(),
+                m_Length(), m_Buffer(), m_Buffered(), m_HasBlocks(), m_IsFinalized() {
+                WSTL_STATIC_ASSERT(sizeof(typename IteratorTraits<Iterator>::ValueType) == sizeof(ValueType), "Type not supported");
+                Reset();
+                this->Append(first, last);
+            }
+
+            /// @brief Hashes a block of bytes in one call
+            /// @param data Pointer to the block
+            /// @param size Size of the block in bytes
+            /// @param seed Seed value for the hash, defaults to 0
+            /// @return The hash value, equal to the one of the incremental form
+            static __WSTL_CONSTEXPR14__ uint64_t Hash(const uint8_t* data, size_t size, uint64_t seed = 0) {
+                seed = Start(seed);
+                if(size <= 16) return Short(data, size, seed);
+
+                size_t remaining = size;
+
+                if(remaining > BlockSize) {
+                    uint64_t lane1 = seed, lane2 = seed;
+
+                    do {
+                        Round(data, seed, lane1, lane2);
+                        data += BlockSize;
+                        remaining -= BlockSize;
+                    } while(remaining > BlockSize);
+
+                    seed ^= lane1 ^ lane2;
+                }
+
+                return Long(data, remaining, size, seed);
+            }
+
+            /// @brief Hashes a block of bytes in one call
+            /// @param data Pointer to the block
+            /// @param size Size of the block in bytes
+            /// @param seed Seed value for the hash, defaults to 0
+            static uint64_t Hash(const void* data, size_t size, uint64_t seed = 0) {
+                return Hash(static_cast<const uint8_t*>(data), size, seed);
+            }
+
+            /// @brief Resets the hasher to its initial state
+            __WSTL_CONSTEXPR14__ void Reset() {
+                this->m_Hash = 0;
+                m_State = Start(m_Seed);
+                m_Lane1 = m_State;
+                m_Lane2 = m_State;
+                m_Length = 0;
+                m_Buffered = 0;
+                m_HasBlocks = false;
+                m_IsFinalized = false;
+            }
+
+            /// @brief Pushes a value into the hasher
+            /// @param value The value to be hashed
+            /// @throws `LogicError` if the hasher is already finalized
+            __WSTL_CONSTEXPR14__ void PushBack(ValueType value) {
+                __WSTL_ASSERT_RETURN__(!m_IsFinalized, WSTL_MAKE_EXCEPTION(LogicError, "Cannot add value to finalized WyHash hash"));
+
+                if(m_Buffered == BufferSize) Consume();
+
+                m_Buffer[m_Buffered++] = value;
+                ++m_Length;
+            }
+
+        private:
+            /// @brief Number of bytes consumed by one round of the three lanes
+            static const __WSTL_CONSTEXPR__ __WSTL_INLINE_VARIABLE__ size_t BlockSize = 48;
+            /// @brief A round plus the 16 bytes the final step may read back
+            static const __WSTL_CONSTEXPR__ __WSTL_INLINE_VARIABLE__ size_t BufferSize = 64;
+
+            static const __WSTL_CONSTEXPR__ __WSTL_INLINE_VARIABLE__ uint64_t SECRET0 = 0xA0761D6478BD642FULL;
+            static const __WSTL_CONSTEXPR__ __WSTL_INLINE_VARIABLE__ uint64_t SECRET1 = 0xE7037ED1A0B428DBULL;
+            static const __WSTL_CONSTEXPR__ __WSTL_INLINE_VARIABLE__ uint64_t SECRET2 = 0x8EBC6AF09C88C6E3ULL;
+            static const __WSTL_CONSTEXPR__ __WSTL_INLINE_VARIABLE__ uint64_t SECRET3 = 0x589965CC75374CC3ULL;
+
+            uint64_t m_Seed;
+            uint64_t m_State;
+            uint64_t m_Lane1;
+            uint64_t m_Lane2;
+            uint64_t m_Length;
+            uint8_t m_Buffer[BufferSize];
+            uint8_t m_Buffered;
+            bool m_HasBlocks;
+            bool m_IsFinalized;
+
+            friend Base;
+
+            static __WSTL_CONSTEXPR14__ uint64_t Start(uint64_t seed) {
+                return seed ^ SECRET0;
+            }
+
+            /// @brief Mixes 48 bytes into the state and the two extra lanes
+            static __WSTL_CONSTEXPR14__ void Round(const uint8_t* data, uint64_t& seed, uint64_t& lane1, uint64_t& lane2) {
+                seed = __private::__WyMix(__private::__WyRead8(data) ^ SECRET1, __private::__WyRead8(data + 8) ^ seed);
+                lane1 = __private::__WyMix(__private::__WyRead8(data + 16) ^ SECRET2, __private::__WyRead8(data + 24) ^ lane1);
+                lane2 = __private::__WyMix(__private::__WyRead8(data + 32) ^ SECRET3, __private::__WyRead8(data + 40) ^ lane2);
+            }
+
+            /// @brief Hashes a key of up to 16 bytes
+            static __WSTL_CONSTEXPR14__ uint64_t Short(const uint8_t* data, size_t size, uint64_t seed) {
+                uint64_t a = 0, b = 0;
+
+                if(size >= 4) {
+                    const size_t middle = (size >> 3) << 2;
+                    a = (__private::__WyRead4(data) << 32) | __private::__WyRead4(data + middle);
+                    b = (__private::__WyRead4(data + size - 4) << 32) | __private::__WyRead4(data + size - 4 - middle);
+                }
+                else if(size > 0) a = (uint64_t(data[0]) << 16) | (uint64_t(data[size >> 1]) << 8) | data[size - 1];
+
+                return Final(a, b, seed, size);
+            }
+
+            /// @brief Hashes the last bytes of a key longer than 16 bytes, reading back before `data` if needed
+            static __WSTL_CONSTEXPR14__ uint64_t Long(const uint8_t* data, size_t remaining, uint64_t size, uint64_t seed) {
+                for(; remaining > 16; remaining -= 16, data += 16) {
+                    seed = __private::__WyMix(__private::__WyRead8(data) ^ SECRET1, __private::__WyRead8(data + 8) ^ seed);
+                }
+
+                return Final(__private::__WyRead8(data + remaining - 16), __private::__WyRead8(data + remaining - 8), seed, size);
+            }
+
+            static __WSTL_CONSTEXPR14__ uint64_t Final(uint64_t a, uint64_t b, uint64_t seed, uint64_t size) {
+                return __private::__WyMix(SECRET1 ^ size, __private::__WyMix(a ^ SECRET1, b ^ seed));
+            }
+
+            /// @brief Runs a round on the first 48 bytes of the full buffer and keeps the last 16
+            __WSTL_CONSTEXPR14__ void Consume() {
+                Round(m_Buffer, m_State, m_Lane1, m_Lane2);
+
+                for(size_t i = 0; i < BufferSize - BlockSize; ++i) m_Buffer[i] = m_Buffer[BlockSize + i];
+
+                m_Buffered = BufferSize - BlockSize;
+                m_HasBlocks = true;
+            }
+
+            /// @brief Appends a block of bytes to the hasher
+            /// @param data Pointer to the block
+            /// @param size Size of the block in bytes
+            /// @throws `LogicError` if the hasher is already finalized
+            __WSTL_CONSTEXPR14__ void AppendBlock(const uint8_t* data, size_t size) {
+                __WSTL_ASSERT_RETURN__(!m_IsFinalized, WSTL_MAKE_EXCEPTION(LogicError, "Cannot add value to finalized WyHash hash"));
+
+                m_Length += size;
+
+                while(size > 0) {
+                    if(m_Buffered == BufferSize) Consume();
+
+                    // Rounds that are followed by more input are run straight from the block
+                    if(m_Buffered == 0 && size > BufferSize) {
+                        for(; size > BufferSize; data += BlockSize, size -= BlockSize) Round(data, m_State, m_Lane1, m_Lane2);
+                        m_HasBlocks = true;
+                    }
+
+                    size_t count = BufferSize - m_Buffered;
+                    if(count > size) count = size;
+
+                    for(size_t i = 0; i < count; ++i) m_Buffer[m_Buffered + i] = data[i];
+
+                    m_Buffered = uint8_t(m_Buffered + count);
+                    data += count;
+                    size -= count;
+                }
+            }
+
+            /// @brief Finalizes the hash value
+            __WSTL_CONSTEXPR14__ void Finalize() {
+                if(!m_IsFinalized) {
+                    if(m_Length <= 16) this->m_Hash = Short(m_Buffer, m_Buffered, m_State);
+                    else {
+                        const uint8_t* data = m_Buffer;
+                        size_t remaining = m_Buffered;
+                        uint64_t seed = m_State;
+
+                        if(m_HasBlocks || remaining > BlockSize) {
+                            uint64_t lane1 = m_Lane1, lane2 = m_Lane2;
+
+                            for(; remaining > BlockSize; data += BlockSize, remaining -= BlockSize) Round(data, seed, lane1, lane2);
+                            seed ^= lane1 ^ lane2;
+                        }
+
+                        this->m_Hash = Long(data, remaining, m_Length, seed);
+                    }
+
+                    m_IsFinalized = true;
+                }
+            }
+        };
+    }
+}
+
+#endif
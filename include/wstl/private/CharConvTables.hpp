@@ -0,0 +1,1410 @@
+// Part of WardenSTL - https://github.com/WardenHD/WardenSTL
+// Copyright (c) 2025 Artem Bezruchko (WardenHD)
+//
+// Licensed under the MIT License. See LICENSE file for details.
+
+#ifndef __WSTL_PRIVATE_CHARCONVTABLES_HPP__
+#define __WSTL_PRIVATE_CHARCONVTABLES_HPP__
+
+#include "Platform.hpp"
+#include <stdint.h>
+
+namespace wstl {
+    namespace __private {
+        /// @brief Multipliers of the Schubfach algorithm for `float`
+        /// @details Entry `k + 45` is the upper 63 bits of `g = floor(10^-k * 2^r) + 1` plus one,
+        /// where `r` is chosen so that `2^125 <= g < 2^126`. Being a template member,
+        /// the table is only emitted when `float` formatting is used
+        template<typename T = void>
+        struct __FloatMultipliers {
+            static const int MinExponent = -45;
+            static const int MaxExponent = 31;
+
+            static const uint64_t Values[MaxExponent - MinExponent + 1];
+        };
+
+        template<typename T>
+        const uint64_t __FloatMultipliers<T>::Values[MaxExponent - MinExponent + 1] = {
+            0x59AEDFC10D7279C6ULL,
+            0x47BF19673DF52E38ULL,
+            0x72CB5BD86321E38DULL,
+            0x5BD5E313828182D7ULL,
+            0x4977E8DC68679BE0ULL,
+            0x758CA7C70D7292FFULL,
+            0x5E0A1FD271287599ULL,
+            0x4B3B4CA85A86C47BULL,
+            0x785EE10D5DA46D91ULL,
+            0x604BE73DE4838ADAULL,
+            0x4D0985CB1D3608AFULL,
+            0x7B426FAB61F00DE4ULL,
+            0x629B8C891B267183ULL,
+            0x4EE2D6D415B85ACFULL,
+            0x7E37BE2022C0914CULL,
+            0x64F964E68233A770ULL,
+            0x50C783EB9B5C85F3ULL,
+            0x409F9CBC7C4A04C3ULL,
+            0x6765C793FA10079EULL,
+            0x52B7D2DCC80CD2E5ULL,
+            0x422CA8B0A00A4251ULL,
+            0x69E10DE76676D081ULL,
+            0x54B40B1F852BDA01ULL,
+            0x43C33C1937564801ULL,
+            0x6C6B935B8BBD4001ULL,
+            0x56BC75E2D6310001ULL,
+            0x4563918244F40001ULL,
+            0x6F05B59D3B200001ULL,
+            0x58D15E1762800001ULL,
+            0x470DE4DF82000001ULL,
+            0x71AFD498D0000001ULL,
+            0x5AF3107A40000001ULL,
+            0x48C2739500000001ULL,
+            0x746A528800000001ULL,
+            0x5D21DBA000000001ULL,
+            0x4A817C8000000001ULL,
+            0x7735940000000001ULL,
+            0x5F5E100000000001ULL,
+            0x4C4B400000000001ULL,
+            0x7A12000000000001ULL,
+            0x61A8000000000001ULL,
+            0x4E20000000000001ULL,
+            0x7D00000000000001ULL,
+            0x6400000000000001ULL,
+            0x5000000000000001ULL,
+            0x4000000000000001ULL,
+            0x6666666666666667ULL,
+            0x51EB851EB851EB86ULL,
+            0x4189374BC6A7EF9EULL,
+            0x68DB8BAC710CB296ULL,
+            0x53E2D6238DA3C212ULL,
+            0x431BDE82D7B634DBULL,
+            0x6B5FCA6AF2BD215FULL,
+            0x55E63B88C230E77FULL,
+            0x44B82FA09B5A52CCULL,
+            0x6DF37F675EF6EAE0ULL,
+            0x57F5FF85E5925580ULL,
+            0x465E6604B7A84466ULL,
+            0x709709A125DA070AULL,
+            0x5A126E1A84AE6C08ULL,
+            0x480EBE7B9D58566DULL,
+            0x734ACA5F6226F0AEULL,
+            0x5C3BD5191B525A25ULL,
+            0x49C97747490EAE84ULL,
+            0x760F253EDB4AB0D3ULL,
+            0x5E72843249088D76ULL,
+            0x4B8ED0283A6D3DF8ULL,
+            0x78E480405D7B9659ULL,
+            0x60B6CD004AC94514ULL,
+            0x4D5F0A66A23A9DAAULL,
+            0x7BCB43D769F762A9ULL,
+            0x63090312BB2C4EEEULL,
+            0x4F3A68DBC8F03F25ULL,
+            0x7EC3DAF941806507ULL,
+            0x65697BFA9ACD1DA0ULL,
+            0x51212FFBAF0A7E19ULL,
+            0x40E7599625A1FE7BULL,
+        };
+
+        /// @brief Multipliers of the Schubfach algorithm for `double`
+        /// @details Entry `k + 324` is `g = floor(10^-k * 2^r) + 1` split into its upper and lower 63 bits,
+        /// where `r` is chosen so that `2^125 <= g < 2^126`. Being a template member,
+        /// the table is only emitted when `double` formatting is used
+        template<typename T = void>
+        struct __DoubleMultipliers {
+            static const int MinExponent = -324;
+            static const int MaxExponent = 292;
+
+            static const uint64_t Values[MaxExponent - MinExponent + 1][2];
+        };
+
+        template<typename T>
+        const uint64_t __DoubleMultipliers<T>::Values[MaxExponent - MinExponent + 1][2] = {
+            { 0x4F0CEDC95A718DD4ULL, 0x5B01E8B09AA0D1B5ULL },
+            { 0x7E7B160EF71C1621ULL, 0x119CA780F767B5EEULL },
+            { 0x652F44D8C5B011B4ULL, 0x0E16EC672C52F7F2ULL },
+            { 0x50F29D7A37C00E29ULL, 0x581256B8F0425FF5ULL },
+            { 0x40C21794F96671BAULL, 0x79A84560C0351991ULL },
+            { 0x679CF287F570B5F7ULL, 0x75DA089ACD21C281ULL },
+            { 0x52E3F5399126F7F9ULL, 0x44AE6D48A41B0201ULL },
+            { 0x424FF76140EBF994ULL, 0x36F1F106E9AF34CDULL },
+            { 0x6A198BCECE465C20ULL, 0x57E981A4A918547BULL },
+            { 0x54E13CA571D1E34DULL, 0x2CBACE1D541376C9ULL },
+            { 0x43E763B78E4182A4ULL, 0x23C8A4E44342C56EULL },
+            { 0x6CA56C58E39C043AULL, 0x060DD4A06B9E08B0ULL },
+            { 0x56EABD13E9499CFBULL, 0x1E7176E6BC7E6D59ULL },
+            { 0x458897432107B0C8ULL, 0x7EC12BEBC9FEBDE1ULL },
+            { 0x6F40F20501A5E7A7ULL, 0x7E01DFDFA9979635ULL },
+            { 0x5900C19D9AEB1FB9ULL, 0x4B34B319547944F7ULL },
+            { 0x4733CE17AF227FC7ULL, 0x55C3C27AA9FA9D93ULL },
+            { 0x71EC7CF2B1D0CC72ULL, 0x560603F7765DC8EAULL },
+            { 0x5B2397288E40A38EULL, 0x7804CFF92B7E3A55ULL },
+            { 0x48E945BA0B66E93FULL, 0x13370CC755FE9511ULL },
+            { 0x74A86F90123E41FEULL, 0x51F1AE0BBCCA881BULL },
+            { 0x5D538C7341CB67FEULL, 0x74C1580963D539AFULL },
+            { 0x4AA93D29016F8665ULL, 0x43CDE0078310FAF3ULL },
+            { 0x77752EA8024C0A3CULL, 0x0616333F381B2B1EULL },
+            { 0x5F90F22001D66E96ULL, 0x3811C298F9AF55B1ULL },
+            { 0x4C73F4E667DEBEDEULL, 0x600E35472E25DE28ULL },
+            { 0x7A532170A6313164ULL, 0x3349EED849D6303FULL },
+            { 0x61DC1AC084F42783ULL, 0x42A18BE03B11C033ULL },
+            { 0x4E49AF006A5CEC69ULL, 0x1BB46FE695A7CCF5ULL },
+            { 0x7D42B19A43C7E0A8ULL, 0x2C53E63DBC3FAE55ULL },
+            { 0x64355AE1CFD31A20ULL, 0x237651CAFCFFBEAAULL },
+            { 0x502AAF1B0CA8E1B3ULL, 0x35F8416F30CC9888ULL },
+            { 0x402225AF3D53E7C2ULL, 0x5E603458F3D6E06DULL },
+            { 0x669D0918621FD937ULL, 0x4A3386F4B957CD7BULL },
+            { 0x52173A79E8197A92ULL, 0x6E8F9F2A2DDFD796ULL },
+            { 0x41AC2EC7ECE12EDBULL, 0x720C7F54F17FDFABULL },
+            { 0x69137E0CAE3517C6ULL, 0x1CE0CBBB1BFFCC45ULL },
+            { 0x540F980A24F74638ULL, 0x171A3C95AFFFD69EULL },
+            { 0x433FACD4EA5F6B60ULL, 0x127B63AAF3331218ULL },
+            { 0x6B991487DD657899ULL, 0x6A5F05DE51EB5026ULL },
+            { 0x5614106CB11DFA14ULL, 0x5518D17EA7EF7352ULL },
+            { 0x44DCD9F08DB194DDULL, 0x2A7A41321FF2C2A8ULL },
+            { 0x6E2E2980E2B5BAFBULL, 0x5D906850331E043FULL },
+            { 0x5824EE00B55E2F2FULL, 0x647386A68F4B3699ULL },
+            { 0x4683F19A2AB1BF59ULL, 0x36C2D21ED908F87BULL },
+            { 0x70D31C29DDE93228ULL, 0x579E1CFE280E5A5DULL },
+            { 0x5A427CEE4B20F4EDULL, 0x2C7E7D98200B7B7EULL },
+            { 0x483530BEA280C3F1ULL, 0x09FECAE019A2C932ULL },
+            { 0x73884DFDD0CE064EULL, 0x43314499C29E0EB6ULL },
+            { 0x5C6D0B3173D8050BULL, 0x4F5A9D47CEE4D891ULL },
+            { 0x49F0D5C129799DA2ULL, 0x72AEE4397250AD41ULL },
+            { 0x764E22CEA8C295D1ULL, 0x377E39F583B44868ULL },
+            { 0x5EA4E8A553CEDE41ULL, 0x12CB61913629D387ULL },
+            { 0x4BB72084430BE500ULL, 0x756F8140F8217605ULL },
+            { 0x792500D39E796E67ULL, 0x6F18CECE59CF233CULL },
+            { 0x60EA670FB1FABEB9ULL, 0x3F470BD847D8E8FDULL },
+            { 0x4D885272F4C89894ULL, 0x329F3CAD064720CAULL },
+            { 0x7C0D50B7EE0DC0EDULL, 0x37652DE1A3A50143ULL },
+            { 0x633DDA2CBE716724ULL, 0x2C50F1814FB73436ULL },
+            { 0x4F64AE8A31F45283ULL, 0x3D0D8E010C92902BULL },
+            { 0x7F077DA9E986EA6BULL, 0x7B48E334E0EA8045ULL },
+            { 0x659F97BB2138BB89ULL, 0x49071C2A4D88669DULL },
+            { 0x514C796280FA2FA1ULL, 0x20D27CEEA46D1EE4ULL },
+            { 0x4109FAB533FB594DULL, 0x670ECA58838A7F1DULL },
+            { 0x680FF788532BC216ULL, 0x0B4ADD5A6C10CB62ULL },
+            { 0x533FF939DC2301ABULL, 0x22A24AAEBCDA3C4EULL },
+            { 0x4299942E49B59AEFULL, 0x354EA22563E1C9D8ULL },
+            { 0x6A8F537D42BC2B18ULL, 0x554A9D089FCFA95AULL },
+            { 0x553F75FDCEFCEF46ULL, 0x776EE406E63FBAAEULL },
+            { 0x4432C4CB0BFD8C38ULL, 0x5F8BE99F1E996225ULL },
+            { 0x6D1E07AB466279F4ULL, 0x327975CB64289D08ULL },
+            { 0x574B3955D1E86190ULL, 0x28612B091CED4A6DULL },
+            { 0x45D5C777DB204E0DULL, 0x06B4226DB0BDD524ULL },
+            { 0x6FBC72595E9A167BULL, 0x24536A491AC95506ULL },
+            { 0x59638EADE54811FCULL, 0x1D0F883A7BD44405ULL },
+            { 0x4782D88B1DD34196ULL, 0x4A72D361FCA9D004ULL },
+            { 0x726AF411C952028AULL, 0x43EAEBCFFAA94CD3ULL },
+            { 0x5B88C3416DDB353BULL, 0x4FEF230CC88770A9ULL },
+            { 0x493A35CDF17C2A96ULL, 0x0CBF4F3D6D3926EEULL },
+            { 0x7529EFAFE8C6AA89ULL, 0x61321862485B717CULL },
+            { 0x5DBB262653D22207ULL, 0x675B46B506AF8DFDULL },
+            { 0x4AFC1E850FDB4E6CULL, 0x52AF6BC405593E64ULL },
+            { 0x77F9CA6E7FC54A47ULL, 0x377F12D33BC1FD6DULL },
+            { 0x5FFB085866376E9FULL, 0x45FF42429634CABDULL },
+            { 0x4CC8D379EB5F8BB2ULL, 0x6B329B68782A3BCBULL },
+            { 0x7ADAEBF64565AC51ULL, 0x2B842BDA59DD2C77ULL },
+            { 0x6248BCC5045156A7ULL, 0x3C69BCAEAE4A89F9ULL },
+            { 0x4EA0970403744552ULL, 0x6387CA25583BA194ULL },
+            { 0x7DCDBE6CD253A21EULL, 0x05A6103BC05F68EDULL },
+            { 0x64A498570EA94E7EULL, 0x37B80CFC99E5ED8AULL },
+            { 0x5083AD1272210B98ULL, 0x2C933D96E184BE08ULL },
+            { 0x40695741F4E73C79ULL, 0x7075CADF1AD09807ULL },
+            { 0x670EF2032171FA5CULL, 0x4D8944982AE759A4ULL },
+            { 0x52725B35B45B2EB0ULL, 0x3E076A135585E150ULL },
+            { 0x41F515C49048F226ULL, 0x64D2BB42AAD1810DULL },
+            { 0x698822D41A0E503EULL, 0x07B7920444826815ULL },
+            { 0x546CE8A9AE71D9CBULL, 0x1FC60E69D0685344ULL },
+            { 0x438A53BAF1F4AE3CULL, 0x196B3EBB0D20429DULL },
+            { 0x6C1085F7E9877D2DULL, 0x0F11FDF815006A94ULL },
+            { 0x56739E5FEE05FDBDULL, 0x58DB319344005543ULL },
+            { 0x45294B7FF19E6497ULL, 0x60AF5ADC3666AA9CULL },
+            { 0x6EA878CCB5CA3A8CULL, 0x344BC4938A3DDDC7ULL },
+            { 0x5886C70A2B082ED6ULL, 0x5D096A0FA1CB17D2ULL },
+            { 0x46D238D4EF39BF12ULL, 0x173ABB3FB4A27975ULL },
+            { 0x71505AEE4B8F981DULL, 0x0B912B992103F588ULL },
+            { 0x5AA6AF25093FACE4ULL, 0x0940EFADB4032AD3ULL },
+            { 0x488558EA6DCC8A50ULL, 0x07672624900288A9ULL },
+            { 0x74088E43E2E0DD4CULL, 0x723EA36DB337410EULL },
+            { 0x5CD3A5031BE71770ULL, 0x5B654F8AF5C5CDA5ULL },
+            { 0x4A42EA68E31F45F3ULL, 0x62B772D5916B0AEBULL },
+            { 0x76D1770E38320986ULL, 0x0458B7BC1BDE77DDULL },
+            { 0x5F0DF8D82CF4D46BULL, 0x1D13C630164B9318ULL },
+            { 0x4C0B2D79BD90A9EFULL, 0x30DC9E8CDEA2DC13ULL },
+            { 0x79AB7BF5FC1AA97FULL, 0x0160FDAE31049351ULL },
+            { 0x6155FCC4C9AEEDFFULL, 0x1AB3FE24F403A90EULL },
+            { 0x4DDE63D0A158BE65ULL, 0x6229981D9002EDA5ULL },
+            { 0x7C97061A9BC130A2ULL, 0x69DC2695B337E2A1ULL },
+            { 0x63AC04E2163426E8ULL, 0x54B01EDE28F9821BULL },
+            { 0x4FBCD0B4DE901F20ULL, 0x43C018B1BA6134E2ULL },
+            { 0x7F9481216419CB67ULL, 0x1F99C11C5D68549DULL },
+            { 0x6610674DE9AE3C52ULL, 0x4C7B00E37DED107EULL },
+            { 0x51A6B90B21583042ULL, 0x09FC00B5FE574065ULL },
+            { 0x41522DA2811359CEULL, 0x3B3000919845CD1DULL },
+            { 0x68837C3734EBC2E3ULL, 0x784CCDB5C06FAE95ULL },
+            { 0x539C635F5D8968B6ULL, 0x2D0A3E2B00595877ULL },
+            { 0x42E382B2B13ABA2BULL, 0x3DA1CB5599E11393ULL },
+            { 0x6B059DEAB52AC378ULL, 0x629C7888F634EC1EULL },
+            { 0x559E17EEF755692DULL, 0x3549FA072B5D89B1ULL },
+            { 0x447E798BF91120F1ULL, 0x1107FB38EF7E07C1ULL },
+            { 0x6D9728DFF4E834B5ULL, 0x01A65EC17F300C68ULL },
+            { 0x57AC20B32A535D5DULL, 0x4E1EB23465C009EDULL },
+            { 0x46234D5C21DC4AB1ULL, 0x24E55B5D1E333B24ULL },
+            { 0x70387BC69C93AAB5ULL, 0x216EF894FD1EC506ULL },
+            { 0x59C6C96BB076222AULL, 0x4DF2607730E56A6CULL },
+            { 0x47D23ABC8D2B4E88ULL, 0x3E5B805F5A5121F0ULL },
+            { 0x72E9F79415121740ULL, 0x63C59A322A1B697FULL },
+            { 0x5BEE5FA9AA74DF67ULL, 0x03047B5B54E2BACCULL },
+            { 0x498B7FBAEEC3E5ECULL, 0x0269FC4910B5623DULL },
+            { 0x75ABFF917E063CACULL, 0x6A432D41B45569FBULL },
+            { 0x5E2332DACB38308AULL, 0x21CF5767C37787FCULL },
+            { 0x4B4F5BE23C2CF3A1ULL, 0x67D912B9692C6CCAULL },
+            { 0x787EF969F9E185CFULL, 0x595B5128A8471476ULL },
+            { 0x60659454C7E79E3FULL, 0x6115DA86ED05A9F8ULL },
+            { 0x4D1E1043D31FB1CCULL, 0x4DAB1538BD9E2193ULL },
+            { 0x7B634D3951CC4FADULL, 0x62AB552795C9CF52ULL },
+            { 0x62B5D7610E3D0C8BULL, 0x0222AA86116E3F75ULL },
+            { 0x4EF7DF80D830D6D5ULL, 0x4E822204DABE992AULL },
+            { 0x7E59659AF38157BCULL, 0x17369CD49130F510ULL },
+            { 0x65145148C2CDDFC9ULL, 0x5F5EE3DD40F3F740ULL },
+            { 0x50DD0DD3CF0B196EULL, 0x1918B64A9A5CC5CDULL },
+            { 0x40B0D7DCA5A27ABEULL, 0x4746F83BAEB09E3EULL },
+            { 0x678159610903F797ULL, 0x253E59F91780FD2FULL },
+            { 0x52CDE11A6D9CC612ULL, 0x50FEAE60DF9A6426ULL },
+            { 0x423E4DAEBE1704DBULL, 0x5A65584D7FAEB685ULL },
+            { 0x69FD4917968B3AF9ULL, 0x10A226E265E4573BULL },
+            { 0x54CAA0DFABA29594ULL, 0x0D4E8581EB1D1295ULL },
+            { 0x43D54D7FBC821143ULL, 0x243ED134BC174211ULL },
+            { 0x6C887BFF94034ED2ULL, 0x06CAE85460253682ULL },
+            { 0x56D396661002A574ULL, 0x6BD586A9E6842B9BULL },
+            { 0x457611EB40021DF7ULL, 0x09779EEE52035616ULL },
+            { 0x6F234FDECCD02FF1ULL, 0x5BF297E3B66BBCEFULL },
+            { 0x58E90CB23D73598EULL, 0x165BACB62B8963F3ULL },
+            { 0x4720D6F4FDF5E13EULL, 0x451623C4EFA11CC2ULL },
+            { 0x71CE24BB2FEFCECAULL, 0x3B569FA17F682E03ULL },
+            { 0x5B0B5095BFF30BD5ULL, 0x15DEE61ACC535803ULL },
+            { 0x48D5DA11665C0977ULL, 0x2B18B8157042ACCFULL },
+            { 0x74895CE8A3C6758BULL, 0x5E8DF355806AAE18ULL },
+            { 0x5D3AB0BA1C9EC46FULL, 0x653E5C4466BBBE7AULL },
+            { 0x4A955A2E7D4BD059ULL, 0x3765169D1EFC9861ULL },
+            { 0x77555D172EDFB3C2ULL, 0x256E8A94FE60F3CFULL },
+            { 0x5F777DAC257FC301ULL, 0x6ABED543FEB3F63FULL },
+            { 0x4C5F97BCEACC9C01ULL, 0x3BCBDDCFFEF65E99ULL },
+            { 0x7A328C6177ADC668ULL, 0x5FAC961997F0975BULL },
+            { 0x61C209E792F16B86ULL, 0x7FBD44E1465A12AFULL },
+            { 0x4E34D4B9425ABC6BULL, 0x7FCA9D810514DBBFULL },
+            { 0x7D21545B9D5DFA46ULL, 0x32DDC8CE6E87C5FFULL },
+            { 0x641AA9E2E44B2E9EULL, 0x5BE4A0A525396B32ULL },
+            { 0x501554B5836F587EULL, 0x7CB6E6EA842DEF5CULL },
+            { 0x4011109135F2AD32ULL, 0x30925255368B25E3ULL },
+            { 0x6681B41B89844850ULL, 0x4DB6EA21F0DEA304ULL },
+            { 0x52015CE2D469D373ULL, 0x57C5881B2718826AULL },
+            { 0x419AB0B576BB0F8FULL, 0x5FD139AF527A01EFULL },
+            { 0x68F781225791B27FULL, 0x4C81F5E550C3364AULL },
+            { 0x53F9341B79415B99ULL, 0x239B2B1DDA35C508ULL },
+            { 0x432DC3492DCDE2E1ULL, 0x02E288E4AE916A6DULL },
+            { 0x6B7C6BA849496B01ULL, 0x516A74A1174F10AEULL },
+            { 0x55FD22ED076DEF34ULL, 0x4121F6E745D8DA25ULL },
+            { 0x44CA82573924BF5DULL, 0x1A8192529E4714EBULL },
+            { 0x6E10D08B8EA1322EULL, 0x5D9C1D50FD3E87DDULL },
+            { 0x580D73A2D880F4F2ULL, 0x17B01773FDCB9FE4ULL },
+            { 0x4671294F139A5D8EULL, 0x4626792997D61984ULL },
+            { 0x70B50EE4EC2A2F4AULL, 0x3D0A5B75BFBCF59FULL },
+            { 0x5A2A7250BCEE8C3BULL, 0x4A6EAF916630C47FULL },
+            { 0x4821F50D63F209C9ULL, 0x21F2260DEB5A36CCULL },
+            { 0x736988156CB6760EULL, 0x69837016455D247AULL },
+            { 0x5C546CDDF091F80BULL, 0x6E02C011D1175062ULL },
+            { 0x49DD23E4C074C66FULL, 0x719BCCDB0DAC404EULL },
+            { 0x762E9FD467213D7FULL, 0x68F947C4E2AD33B0ULL },
+            { 0x5E8BB3105280FDFFULL, 0x6D94396A4EF0F627ULL },
+            { 0x4BA2F5A6A8673199ULL, 0x3E102DEEA58D91B9ULL },
+            { 0x7904BC3DDA3EB5C2ULL, 0x3019E3176F48E927ULL },
+            { 0x60D09697E1CBC49BULL, 0x4014B5AC590720ECULL },
+            { 0x4D73ABACB4A303AFULL, 0x4CDD5E237A6C1A57ULL },
+            { 0x7BEC45E12104D2B2ULL, 0x47C8969F2A46908AULL },
+            { 0x63236B1A80D0A88EULL, 0x6CA0787F5505406FULL },
+            { 0x4F4F88E200A6ED3FULL, 0x0A19F9FF773766BFULL },
+            { 0x7EE5A7D0010B1531ULL, 0x5CF65CCBF1F23DFEULL },
+            { 0x6584864000D5AA8EULL, 0x172B7D6FF4C1CB32ULL },
+            { 0x5136D1CCCD77BBA4ULL, 0x78EF978CC3CE3C28ULL },
+            { 0x40F8A7D70AC62FB7ULL, 0x13F2DFA3CFD83020ULL },
+            { 0x67F43FBE77A37F8BULL, 0x398499061959E699ULL },
+            { 0x5329CC985FB5FFA2ULL, 0x6136E0D1ADE18548ULL },
+            { 0x4287D6E04C91994FULL, 0x00F8B3DAF181376DULL },
+            { 0x6A72F166E0E8F54BULL, 0x1B27862B1C01F247ULL },
+            { 0x5528C11F1A53F76FULL, 0x2F52D1BC1667F506ULL },
+            { 0x44209A7F48432C59ULL, 0x0C424163451FF738ULL },
+            { 0x6D00F7320D3846F4ULL, 0x7A039BD208332526ULL },
+            { 0x5733F8F4D76038C3ULL, 0x7B361641A028EA85ULL },
+            { 0x45C32D90AC4CFA36ULL, 0x2F5E78348020BB9EULL },
+            { 0x6F9EAF4DE07B29F0ULL, 0x4BCA59ED99CDF8FCULL },
+            { 0x594BBF71806287F3ULL, 0x563B7B247B0B2D96ULL },
+            { 0x476FCC5ACD1B9FF6ULL, 0x11C92F50626F57ACULL },
+            { 0x724C7A2AE1C5CCBDULL, 0x02DB7EE703E55912ULL },
+            { 0x5B7061BBE7D17097ULL, 0x1BE2CBEC031DE0DCULL },
+            { 0x4926B496530DF3ACULL, 0x164F09899C17E716ULL },
+            { 0x750ABA8A1E7CB913ULL, 0x3D4B4275C68CA4F0ULL },
+            { 0x5DA22ED4E530940FULL, 0x4AA29B916BA3B726ULL },
+            { 0x4AE825771DC07672ULL, 0x6EE87C74561C9285ULL },
+            { 0x77D9D58B62CD8A51ULL, 0x3173FA53BCFA8408ULL },
+            { 0x5FE177A2B5713B74ULL, 0x278FFB7630C869A0ULL },
+            { 0x4CB45FB55DF42F90ULL, 0x1FA662C4F3D387B3ULL },
+            { 0x7ABA32BBC986B280ULL, 0x32A3D13B1FB8D91FULL },
+            { 0x622E8EFCA1388ECDULL, 0x0EE9742F4C93E0E6ULL },
+            { 0x4E8BA596E760723DULL, 0x58BAC3590A0FE71EULL },
+            { 0x7DAC3C24A5671D2FULL, 0x412AD228101971C9ULL },
+            { 0x6489C9B6EAB8E426ULL, 0x00EF0E8673478E3BULL },
+            { 0x506E3AF8BBC71CEBULL, 0x1A58D86B8F6C71C9ULL },
+            { 0x40582F2D6305B0BCULL, 0x1513E0560C56C16EULL },
+            { 0x66F37EAF04D5E793ULL, 0x3B530089AD579BE2ULL },
+            { 0x525C6558D0AB1FA9ULL, 0x15DC006E2446164FULL },
+            { 0x41E384470D55B2EDULL, 0x5E4999F1B69E783FULL },
+            { 0x696C06D81555EB15ULL, 0x7D428FE92430C065ULL },
+            { 0x54566BE0111188DEULL, 0x31020CBA835A3384ULL },
+            { 0x4378564CDA746D7EULL, 0x5A680A2ECF7B5C69ULL },
+            { 0x6BF3BD47C3ED7BFDULL, 0x770CDD17B25EFA42ULL },
+            { 0x565C976C9CBDFCCBULL, 0x1270B0DFC1E59502ULL },
+            { 0x4516DF8A16FE63D5ULL, 0x5B8D5A4C9B1E10CEULL },
+            { 0x6E8AFF4357FD6C89ULL, 0x127BC3ADC4FCE7B0ULL },
+            { 0x586F329C466456D4ULL, 0x0EC96957D0CA52F3ULL },
+            { 0x46BF5BB038504576ULL, 0x3F07877973D50F29ULL },
+            { 0x71322C4D26E6D58AULL, 0x31A5A58F1FBB4B75ULL },
+            { 0x5A8E89D75252446EULL, 0x5AEAEAD8E62F6F91ULL },
+            { 0x487207DF750E9D25ULL, 0x2F22557A51BF8C74ULL },
+            { 0x73E9A63254E42EA2ULL, 0x1836EF2A1C65AD86ULL },
+            { 0x5CBAEB5B771CF21BULL, 0x2CF8BF54E3848AD2ULL },
+            { 0x4A2F22AF927D8E7CULL, 0x23FA32AA4F9D3BDBULL },
+            { 0x76B1D118EA627D93ULL, 0x5329EAAA18FB92F8ULL },
+            { 0x5EF4A74721E86476ULL, 0x0F54BBBB472FA8C6ULL },
+            { 0x4BF6EC38E7ED1D2BULL, 0x25DD62FC38F2ED6CULL },
+            { 0x798B138E3FE1C845ULL, 0x22FBD1938E517BDFULL },
+            { 0x613C0FA4FFE7D36AULL, 0x4F2FDADC71DAC97FULL },
+            { 0x4DC9A61D998642BBULL, 0x58F3157D27E23ACCULL },
+            { 0x7C75D695C2706AC5ULL, 0x74B82261D969F7ADULL },
+            { 0x63917877CEC0556BULL, 0x10934EB4ADEE5FBEULL },
+            { 0x4FA793930BCD1122ULL, 0x4075D8908B251965ULL },
+            { 0x7F7285B812E1B504ULL, 0x00BC8DB411D4F56EULL },
+            { 0x65F537C675815D9CULL, 0x66FD3E29A7DD9125ULL },
+            { 0x5190F96B91344AE3ULL, 0x6BFDCB54864ADA84ULL },
+            { 0x4140C78940F6A24FULL, 0x6FFE3C439EA2486AULL },
+            { 0x6867A5A867F103B2ULL, 0x7FFD2D38FDD073DCULL },
+            { 0x53861E2053273628ULL, 0x6664242D97D9F64AULL },
+            { 0x42D1B1B375B8F820ULL, 0x51E9B68ADFE191D5ULL },
+            { 0x6AE91C5255F4C034ULL, 0x1CA924116635B621ULL },
+            { 0x558749DB77F70029ULL, 0x63BA83411E915E81ULL },
+            { 0x446C3B15F9926687ULL, 0x6962029A7EDAB201ULL },
+            { 0x6D79F82328EA3DA6ULL, 0x0F03375D97C45001ULL },
+            { 0x5794C6828721CAEBULL, 0x259C2C4ADFD04001ULL },
+            { 0x46109ECED2816F22ULL, 0x5149BD08B30D0001ULL },
+            { 0x701A97B150CF1837ULL, 0x3542C80DEB480001ULL },
+            { 0x59AEDFC10D7279C5ULL, 0x7768A00B22A00001ULL },
+            { 0x47BF19673DF52E37ULL, 0x79208008E8800001ULL },
+            { 0x72CB5BD86321E38CULL, 0x5B67334174000001ULL },
+            { 0x5BD5E313828182D6ULL, 0x7C528F6790000001ULL },
+            { 0x4977E8DC68679BDFULL, 0x16A872B940000001ULL },
+            { 0x758CA7C70D7292FEULL, 0x5773EAC200000001ULL },
+            { 0x5E0A1FD271287598ULL, 0x45F6556800000001ULL },
+            { 0x4B3B4CA85A86C47AULL, 0x04C5112000000001ULL },
+            { 0x785EE10D5DA46D90ULL, 0x07A1B50000000001ULL },
+            { 0x604BE73DE4838AD9ULL, 0x52E7C40000000001ULL },
+            { 0x4D0985CB1D3608AEULL, 0x0F1FD00000000001ULL },
+            { 0x7B426FAB61F00DE3ULL, 0x31CC800000000001ULL },
+            { 0x629B8C891B267182ULL, 0x5B0A000000000001ULL },
+            { 0x4EE2D6D415B85ACEULL, 0x7C08000000000001ULL },
+            { 0x7E37BE2022C0914BULL, 0x1340000000000001ULL },
+            { 0x64F964E68233A76FULL, 0x2900000000000001ULL },
+            { 0x50C783EB9B5C85F2ULL, 0x5400000000000001ULL },
+            { 0x409F9CBC7C4A04C2ULL, 0x1000000000000001ULL },
+            { 0x6765C793FA10079DULL, 0x0000000000000001ULL },
+            { 0x52B7D2DCC80CD2E4ULL, 0x0000000000000001ULL },
+            { 0x422CA8B0A00A4250ULL, 0x0000000000000001ULL },
+            { 0x69E10DE76676D080ULL, 0x0000000000000001ULL },
+            { 0x54B40B1F852BDA00ULL, 0x0000000000000001ULL },
+            { 0x43C33C1937564800ULL, 0x0000000000000001ULL },
+            { 0x6C6B935B8BBD4000ULL, 0x0000000000000001ULL },
+            { 0x56BC75E2D6310000ULL, 0x0000000000000001ULL },
+            { 0x4563918244F40000ULL, 0x0000000000000001ULL },
+            { 0x6F05B59D3B200000ULL, 0x0000000000000001ULL },
+            { 0x58D15E1762800000ULL, 0x0000000000000001ULL },
+            { 0x470DE4DF82000000ULL, 0x0000000000000001ULL },
+            { 0x71AFD498D0000000ULL, 0x0000000000000001ULL },
+            { 0x5AF3107A40000000ULL, 0x0000000000000001ULL },
+            { 0x48C2739500000000ULL, 0x0000000000000001ULL },
+            { 0x746A528800000000ULL, 0x0000000000000001ULL },
+            { 0x5D21DBA000000000ULL, 0x0000000000000001ULL },
+            { 0x4A817C8000000000ULL, 0x0000000000000001ULL },
+            { 0x7735940000000000ULL, 0x0000000000000001ULL },
+            { 0x5F5E100000000000ULL, 0x0000000000000001ULL },
+            { 0x4C4B400000000000ULL, 0x0000000000000001ULL },
+            { 0x7A12000000000000ULL, 0x0000000000000001ULL },
+            { 0x61A8000000000000ULL, 0x0000000000000001ULL },
+            { 0x4E20000000000000ULL, 0x0000000000000001ULL },
+            { 0x7D00000000000000ULL, 0x0000000000000001ULL },
+            { 0x6400000000000000ULL, 0x0000000000000001ULL },
+            { 0x5000000000000000ULL, 0x0000000000000001ULL },
+            { 0x4000000000000000ULL, 0x0000000000000001ULL },
+            { 0x6666666666666666ULL, 0x3333333333333334ULL },
+            { 0x51EB851EB851EB85ULL, 0x0F5C28F5C28F5C29ULL },
+            { 0x4189374BC6A7EF9DULL, 0x5916872B020C49BBULL },
+            { 0x68DB8BAC710CB295ULL, 0x74F0D844D013A92BULL },
+            { 0x53E2D6238DA3C211ULL, 0x43F3E0370CDC8755ULL },
+            { 0x431BDE82D7B634DAULL, 0x698FE69270B06C44ULL },
+            { 0x6B5FCA6AF2BD215EULL, 0x0F4CA41D811A46D4ULL },
+            { 0x55E63B88C230E77EULL, 0x3F70834ACDAE9F10ULL },
+            { 0x44B82FA09B5A52CBULL, 0x4C5A02A23E254C0DULL },
+            { 0x6DF37F675EF6EADFULL, 0x2D5CD10396A21347ULL },
+            { 0x57F5FF85E592557FULL, 0x3DE3DA69454E75D3ULL },
+            { 0x465E6604B7A84465ULL, 0x7E4FE1EDD10B9175ULL },
+            { 0x709709A125DA0709ULL, 0x4A19697C81AC1BEFULL },
+            { 0x5A126E1A84AE6C07ULL, 0x54E1213067BCE326ULL },
+            { 0x480EBE7B9D58566CULL, 0x43E74DC052FD8285ULL },
+            { 0x734ACA5F6226F0ADULL, 0x530BAF9A1E626A6DULL },
+            { 0x5C3BD5191B525A24ULL, 0x426FBFAE7EB521F1ULL },
+            { 0x49C97747490EAE83ULL, 0x4EBFCC8B9890E7F4ULL },
+            { 0x760F253EDB4AB0D2ULL, 0x4ACC7A78F41B0CBAULL },
+            { 0x5E72843249088D75ULL, 0x223D2EC729AF3D62ULL },
+            { 0x4B8ED0283A6D3DF7ULL, 0x34FDBF05BAF29781ULL },
+            { 0x78E480405D7B9658ULL, 0x54C931A2C4B758CFULL },
+            { 0x60B6CD004AC94513ULL, 0x5D6DC14F03C5E0A5ULL },
+            { 0x4D5F0A66A23A9DA9ULL, 0x31249AA59C9E4D51ULL },
+            { 0x7BCB43D769F762A8ULL, 0x4EA0F76F60FD4882ULL },
+            { 0x63090312BB2C4EEDULL, 0x254D92BF80CAA068ULL },
+            { 0x4F3A68DBC8F03F24ULL, 0x1DD7A89933D54D20ULL },
+            { 0x7EC3DAF941806506ULL, 0x62F2A75B86221500ULL },
+            { 0x65697BFA9ACD1D9FULL, 0x025BB91604E810CDULL },
+            { 0x51212FFBAF0A7E18ULL, 0x684960DE6A5340A4ULL },
+            { 0x40E7599625A1FE7AULL, 0x203AB3E521DC33B6ULL },
+            { 0x67D88F56A29CCA5DULL, 0x19F7863B696052BDULL },
+            { 0x5313A5DEE87D6EB0ULL, 0x7B2C6B62BAB37564ULL },
+            { 0x42761E4BED31255AULL, 0x2F56BC4EFBC2C450ULL },
+            { 0x6A5696DFE1E83BC3ULL, 0x655793B192D13A1AULL },
+            { 0x5512124CB4B9C969ULL, 0x377942F475742E7BULL },
+            { 0x440E750A2A2E3ABAULL, 0x5F9435905DF68B96ULL },
+            { 0x6CE3EE76A9E3912AULL, 0x65B9EF4D63241289ULL },
+            { 0x571CBEC554B60DBBULL, 0x6AFB25D782834207ULL },
+            { 0x45B0989DDD5E7163ULL, 0x08C8EB12CECF6806ULL },
+            { 0x6F80F42FC8971BD1ULL, 0x5ADB11B7B14BD9A3ULL },
+            { 0x5933F68CA078E30EULL, 0x157C0E2C8DD647B5ULL },
+            { 0x475CC53D4D2D8271ULL, 0x5DFCD823A4AB6C91ULL },
+            { 0x722E086215159D82ULL, 0x632E269F6DDF141BULL },
+            { 0x5B5806B4DDAAE468ULL, 0x4F581EE5F17F4349ULL },
+            { 0x49133890B1558386ULL, 0x72ACE584C1329C3BULL },
+            { 0x74EB8DB44EEF38D7ULL, 0x6AAE3C079B842D2AULL },
+            { 0x5D893E29D8BF60ACULL, 0x5558300616035755ULL },
+            { 0x4AD431BB13CC4D56ULL, 0x7779C004DE6912ABULL },
+            { 0x77B9E92B52E07BBEULL, 0x258F99A163DB5111ULL },
+            { 0x5FC7EDBC424D2FCBULL, 0x37A614811CAF740DULL },
+            { 0x4C9FF163683DBFD5ULL, 0x7951AA00E3BF900BULL },
+            { 0x7A998238A6C932EFULL, 0x754F7667D2CC19ABULL },
+            { 0x6214682D523A8F26ULL, 0x2AA5F8530F09AE22ULL },
+            { 0x4E76B9BDDB620C1EULL, 0x55519375A5A1581BULL },
+            { 0x7D8AC2C95F034697ULL, 0x3BB5B8BC3C3559C5ULL },
+            { 0x646F023AB2690545ULL, 0x7C9160969691149EULL },
+            { 0x5058CE955B87376BULL, 0x16DAB3ABABA743B2ULL },
+            { 0x40470BAAAF9F5F88ULL, 0x78AEF622EFB902F5ULL },
+            { 0x66D812AAB29898DBULL, 0x0DE4BD04B2C19E54ULL },
+            { 0x524675555BAD4715ULL, 0x57EA30D08F014B76ULL },
+            { 0x41D1F7777C8A9F44ULL, 0x4654F3DA0C01092CULL },
+            { 0x694FF258C7443207ULL, 0x23BB1FC346680EACULL },
+            { 0x543FF513D29CF4D2ULL, 0x4FC8E635D1ECD88AULL },
+            { 0x43665DA9754A5D75ULL, 0x263A51C4A7F0AD3BULL },
+            { 0x6BD6FC425543C8BBULL, 0x56C3B607731AAEC4ULL },
+            { 0x5645969B77696D62ULL, 0x789C919F8F488BD0ULL },
+            { 0x4504787C5F878AB5ULL, 0x46E3A7B2D906D640ULL },
+            { 0x6E6D8D93CC0C1122ULL, 0x3E390C515B3E239AULL },
+            { 0x5857A4763CD6741BULL, 0x4B60D6A77C31B615ULL },
+            { 0x46AC8391CA4529AFULL, 0x55E7121F968E2B44ULL },
+            { 0x711405B6106EA919ULL, 0x0971B698F0E3786DULL },
+            { 0x5A766AF80D255414ULL, 0x078E2BAD8D82C6BDULL },
+            { 0x485EBBF9A41DDCDCULL, 0x6C71BC8AD79BD231ULL },
+            { 0x73CAC65C39C96161ULL, 0x2D82C7448C2C8382ULL },
+            { 0x5CA23849C7D44DE7ULL, 0x3E023903A356CF9BULL },
+            { 0x4A1B603B06437185ULL, 0x7E682D9C82ABD949ULL },
+            { 0x76923391A39F1C09ULL, 0x4A4048FA6AAC8EDBULL },
+            { 0x5EDB5C7482E5B007ULL, 0x55003A61EEF07249ULL },
+            { 0x4BE2B05D35848CD2ULL, 0x773361E7F259F507ULL },
+            { 0x796AB3C855A0E151ULL, 0x3EB89CA6508FEE71ULL },
+            { 0x6122296D114D810DULL, 0x7EFA16EB73A6585BULL },
+            { 0x4DB4EDF0DAA4673EULL, 0x3261ABEF8FB846AFULL },
+            { 0x7C54AFE7C43A3ECAULL, 0x1D691318E5F3A44BULL },
+            { 0x6376F31FD02E98A1ULL, 0x64540F471E5C836FULL },
+            { 0x4F925C1973587A1BULL, 0x0376729F4B7D35F3ULL },
+            { 0x7F50935BEBC0C35EULL, 0x38BD84321261EFEBULL },
+            { 0x65DA0F7CBC9A35E5ULL, 0x13CAD0280EB4BFEFULL },
+            { 0x517B3F96FD482B1DULL, 0x5CA240200BC3CCBFULL },
+            { 0x412F66126439BC17ULL, 0x63B50019A3030A33ULL },
+            { 0x684BD683D38F9359ULL, 0x1F88002904D1A9EAULL },
+            { 0x536FDECFDC72DC47ULL, 0x32D3335403DAEE55ULL },
+            { 0x42BFE57316C249D2ULL, 0x5BDC291003158B77ULL },
+            { 0x6ACCA251BE03A951ULL, 0x12F9DB4CD1BC1258ULL },
+            { 0x557081DAFE695440ULL, 0x7594AF70A7C9A847ULL },
+            { 0x445A017BFEBAA9CDULL, 0x4476F2C0863AED06ULL },
+            { 0x6D5CCF2CCAC442E2ULL, 0x3A57EACDA3917B3CULL },
+            { 0x577D728A3BD03581ULL, 0x7B7988A482DAC8FDULL },
+            { 0x45FDF53B630CF79BULL, 0x15FAD3B6CF156D97ULL },
+            { 0x6FFCBB923814BF5EULL, 0x565E1F8AE4EF15BEULL },
+            { 0x5996FC74F9AA32B2ULL, 0x11E4E608B725AAFFULL },
+            { 0x47ABFD2A6154F55BULL, 0x27EA51A0928488CCULL },
+            { 0x72ACC843CEEE555EULL, 0x7310829A84074146ULL },
+            { 0x5BBD6D030BF1DDE5ULL, 0x42739BAED005CDD2ULL },
+            { 0x49645735A327E4B7ULL, 0x4EC2E2F24004A4A8ULL },
+            { 0x756D5855D1D96DF2ULL, 0x4AD16B1D333AA10CULL },
+            { 0x5DF11377DB1457F5ULL, 0x2241227DC2954DA3ULL },
+            { 0x4B2742C648DD132AULL, 0x4E9A81FE35443E1CULL },
+            { 0x783ED13D4161B844ULL, 0x175D9CC9EED39694ULL },
+            { 0x603240FDCDE7C69CULL, 0x7917B0A18BDC7876ULL },
+            { 0x4CF500CB0B1FD217ULL, 0x1412F3B46FE39392ULL },
+            { 0x7B219ADE7832E9BEULL, 0x535185ED7FD285B6ULL },
+            { 0x628148B1F9C25498ULL, 0x42A79E57997537C5ULL },
+            { 0x4ECDD3C1949B76E0ULL, 0x3552E512E12A9304ULL },
+            { 0x7E161F9C20F8BE33ULL, 0x6EEB081E3510EB39ULL },
+            { 0x64DE7FB01A609829ULL, 0x3F226CE4F740BC2EULL },
+            { 0x50B1FFC0151A1354ULL, 0x3281F0B72C33C9BEULL },
+            { 0x408E66334414DC43ULL, 0x42018D5F568FD498ULL },
+            { 0x674A3D1ED354939FULL, 0x1CCF48988A7FBA8DULL },
+            { 0x52A1CA7F0F76DC7FULL, 0x30A5D3AD3B99620BULL },
+            { 0x421B0865A5F8B065ULL, 0x73B7DC8A96144E6FULL },
+            { 0x69C4DA3C3CC11A3CULL, 0x52BFC7442353B0B1ULL },
+            { 0x549D7B6363CDAE96ULL, 0x756639034F7626F4ULL },
+            { 0x43B12F82B63E2545ULL, 0x4451C735D92B525DULL },
+            { 0x6C4EB26ABD303BA2ULL, 0x3A1C71EFC1DEEA2EULL },
+            { 0x56A55B889759C94EULL, 0x61B05B2634B254F2ULL },
+            { 0x45511606DF7B0772ULL, 0x1AF37C1E908EAA5BULL },
+            { 0x6EE8233E325E7250ULL, 0x2B1F2CFDB41776F8ULL },
+            { 0x58B9B5CB5B7EC1D9ULL, 0x6F4C23FE29AC5F2DULL },
+            { 0x46FAF7D5E2CBCE47ULL, 0x72A34FFE87BD18F1ULL },
+            { 0x71918C896ADFB073ULL, 0x04387FFDA5FB5B1BULL },
+            { 0x5ADAD6D4557FC05CULL, 0x0360666484C915AFULL },
+            { 0x48AF1243779966B0ULL, 0x02B3851D3707448CULL },
+            { 0x744B506BF28F0AB3ULL, 0x1DEC082EBE720746ULL },
+            { 0x5D090D2328726EF5ULL, 0x64BCD358985B3905ULL },
+            { 0x4A6DA41C205B8BF7ULL, 0x6A30A913AD15C738ULL },
+            { 0x7715D36033C5ACBFULL, 0x5D1AA81F7B560B8CULL },
+            { 0x5F44A919C3048A32ULL, 0x7DAEECE5FC44D609ULL },
+            { 0x4C36EDAE359D3B5BULL, 0x7E258A51969D7808ULL },
+            { 0x79F17C49EF61F893ULL, 0x16A276E8F0FBF33FULL },
+            { 0x618DFD07F2B4C6DCULL, 0x121B9253F3FCC299ULL },
+            { 0x4E0B30D328909F16ULL, 0x41AFA84329970214ULL },
+            { 0x7CDEB4850DB431BDULL, 0x4F7F739EA8F19CEDULL },
+            { 0x63E55D373E29C164ULL, 0x3F99294BBA5AE3F1ULL },
+            { 0x4FEAB0F8FE87CDE9ULL, 0x7FADBAA2FB7BE98DULL },
+            { 0x7FDDE7F4CA72E30FULL, 0x7F7C5DD1925FDC15ULL },
+            { 0x664B1FF7085BE8D9ULL, 0x4C637E4141E649ABULL },
+            { 0x51D5B32C06AFED7AULL, 0x704F983434B83AEFULL },
+            { 0x4177C2899EF32462ULL, 0x26A6135CF6F9C8BFULL },
+            { 0x68BF9DA8FE51D3D0ULL, 0x3DD685618B294132ULL },
+            { 0x53CC7E20CB74A973ULL, 0x4B12044E08EDCDC2ULL },
+            { 0x4309FE80A2C3BAC2ULL, 0x6F419D0B3A57D7CEULL },
+            { 0x6B4330CDD1392AD1ULL, 0x320294DEC3BFBFB0ULL },
+            { 0x55CF5A3E40FA88A7ULL, 0x419BAA4BCFCC995AULL },
+            { 0x44A5E1CB672ED3B9ULL, 0x1AE2EEA30CA3ADE1ULL },
+            { 0x6DD636123EB152C1ULL, 0x77D17DD1ADD2AFCFULL },
+            { 0x57DE91A832277567ULL, 0x797464A7BE42263FULL },
+            { 0x464BA7B9C1B92AB9ULL, 0x4790508631CE84FFULL },
+            { 0x70790C5C6928445CULL, 0x0C1A1A704FB0D4CCULL },
+            { 0x59FA7049EDB9D049ULL, 0x567B4859D95A43D6ULL },
+            { 0x47FB8D07F161736EULL, 0x11FC39E17AAE9CABULL },
+            { 0x732C14D98235857DULL, 0x032D2968C44A9445ULL },
+            { 0x5C2343E134F79DFDULL, 0x4F575453D03BA9D1ULL },
+            { 0x49B5CFE75D92E4CAULL, 0x72AC4376402FBB0EULL },
+            { 0x75EFB30BC8EB07ABULL, 0x0446D256CD192B49ULL },
+            { 0x5E595C096D88D2EFULL, 0x1D0575123DADBC3AULL },
+            { 0x4B7AB0078AD3DBF2ULL, 0x4A6AC40E97BE302FULL },
+            { 0x78C44CD8DE1FC650ULL, 0x771139B0F2C9E6B1ULL },
+            { 0x609D0A4718196B73ULL, 0x78DA948D8F07EBC1ULL },
+            { 0x4D4A6E9F467ABC5CULL, 0x60AEDD3E0C065634ULL },
+            { 0x7BAA4A9870C46094ULL, 0x344AFB9679A3BD20ULL },
+            { 0x62EEA2138D69E6DDULL, 0x103BFC78614FCA80ULL },
+            { 0x4F254E760ABB1F17ULL, 0x26966393810CA200ULL },
+            { 0x7EA21723445E9825ULL, 0x2423D2859B476999ULL },
+            { 0x654E78E9037EE01DULL, 0x69B642047C392148ULL },
+            { 0x510B93ED9C658017ULL, 0x6E2B680396941AA0ULL },
+            { 0x40D60FF149EACCDFULL, 0x71BC53361210154DULL },
+            { 0x67BCE64EDCAAE166ULL, 0x1C6085235019BBAEULL },
+            { 0x52FD850BE3BBE784ULL, 0x7D1A041C40149625ULL },
+            { 0x42646A6FE9631F9DULL, 0x4A7B367D0010781DULL },
+            { 0x6A3A43E642383295ULL, 0x5D91F0C8001A59C8ULL },
+            { 0x54FB698501C68EDEULL, 0x17A7F3D3334847D4ULL },
+            { 0x43FC546A67D20BE4ULL, 0x79532975C2A03976ULL },
+            { 0x6CC6ED770C83463BULL, 0x0EEB75893766C256ULL },
+            { 0x57058AC5A39C382FULL, 0x25892AD42C523512ULL },
+            { 0x459E089E1C7CF9BFULL, 0x37A0EF102374F742ULL },
+            { 0x6F6340FCFA618F98ULL, 0x59017E8038BB2536ULL },
+            { 0x591C33FD951AD946ULL, 0x7A67986693C8EA91ULL },
+            { 0x4749C33144157A9FULL, 0x151FAD1EDCA0BBA8ULL },
+            { 0x720F9EB539BBF765ULL, 0x0832AE97C76792A5ULL },
+            { 0x5B3FB22A94965F84ULL, 0x068EF21305EC7551ULL },
+            { 0x48FFC1BBAA11E603ULL, 0x1ED8C1A8D189F774ULL },
+            { 0x74CC692C434FD66BULL, 0x4AF4690E1C0FF253ULL },
+            { 0x5D705423690CAB89ULL, 0x225D20D816732843ULL },
+            { 0x4AC0434F873D5607ULL, 0x35174D79AB8F5369ULL },
+            { 0x779A054C0B955672ULL, 0x21BEE25C45B21F0EULL },
+            { 0x5FAE6AA33C77785BULL, 0x3498B5169E2818D8ULL },
+            { 0x4C8B888296C5F9E2ULL, 0x5D46F7454B534713ULL },
+            { 0x7A78DA6A8AD65C9DULL, 0x7BA4BED545520B52ULL },
+            { 0x61FA48553BDEB07EULL, 0x2FB6FF110441A2A8ULL },
+            { 0x4E61D37763188D31ULL, 0x72F8CC0D9D014EEDULL },
+            { 0x7D6952589E8DAEB6ULL, 0x1E5AE015C80217E1ULL },
+            { 0x645441E07ED7BEF8ULL, 0x1848B344A001ACB4ULL },
+            { 0x504367E6CBDFCBF9ULL, 0x603A2903B3348A2AULL },
+            { 0x4035ECB8A3196FFBULL, 0x002E873628F6D4EEULL },
+            { 0x66BCADF43828B32BULL, 0x19E40B89DB2487E3ULL },
+            { 0x52308B29C686F5BCULL, 0x14B66FA17C1D3983ULL },
+            { 0x41C06F549ED25E30ULL, 0x1091F2E7967DC79CULL },
+            { 0x6933E554315096B3ULL, 0x341CB7D8F0C93F5FULL },
+            { 0x542984435AA6DEF5ULL, 0x767D5FE0C0A0FF80ULL },
+            { 0x435469CF7BB8B25EULL, 0x2B977FE70080CC66ULL },
+            { 0x6BBA42E592C11D63ULL, 0x5F58CCA4CD9AE0A3ULL },
+            { 0x562E9BEADBCDB11CULL, 0x4C470A1D7148B3B6ULL },
+            { 0x44F216557CA48DB0ULL, 0x3D05A1B1276D5C92ULL },
+            { 0x6E5023BBFAA0E2B3ULL, 0x7B3C35E83F1560E9ULL },
+            { 0x58401C96621A4EF6ULL, 0x2F635E5365AAB3EDULL },
+            { 0x4699B0784E7B725EULL, 0x591C4B75EAEEF658ULL },
+            { 0x70F5E726E3F8B6FDULL, 0x74FA125644B18A26ULL },
+            { 0x5A5E5285832D5F31ULL, 0x43FB41DE9D5AD4EBULL },
+            { 0x484B75379C244C27ULL, 0x4FFC34B2177BDD89ULL },
+            { 0x73ABEEBF603A1372ULL, 0x4CC6BAB68BF96274ULL },
+            { 0x5C898BCC4CFB42C2ULL, 0x0A38955ED6611B90ULL },
+            { 0x4A07A309D72F689BULL, 0x21C6DDE5784DAFA7ULL },
+            { 0x76729E762518A75EULL, 0x693E2FD58D49190BULL },
+            { 0x5EC2185E8413B918ULL, 0x5431BFDE0AA0E0D5ULL },
+            { 0x4BCE79E536762DADULL, 0x29C1664B3BB3E711ULL },
+            { 0x794A5CA1F0BD15E2ULL, 0x0F9BD6DEC5ECA4E8ULL },
+            { 0x61084A1B26FDAB1BULL, 0x2616457F04BD50BAULL },
+            { 0x4DA03B48EBFE227CULL, 0x1E783798D09773C8ULL },
+            { 0x7C33920E46636A60ULL, 0x30C058F480F252D9ULL },
+            { 0x635C74D8384F884DULL, 0x0D66AD9067284247ULL },
+            { 0x4F7D2A469372D370ULL, 0x711EF14052869B6CULL },
+            { 0x7F2EAA0A85848581ULL, 0x34FE4ECD50D75F14ULL },
+            { 0x65BEEE6ED136D134ULL, 0x2A650BD773DF7F43ULL },
+            { 0x51658B8BDA9240F6ULL, 0x551DA312C319329CULL },
+            { 0x411E093CAEDB672BULL, 0x5DB14F4235ADC217ULL },
+            { 0x68300EC77E2BD845ULL, 0x7C4EE536BC49368AULL },
+            { 0x5359A56C64EFE037ULL, 0x7D0BEA92303A9208ULL },
+            { 0x42AE1DF050BFE693ULL, 0x173CBBA8269541A0ULL },
+            { 0x6AB02FE6E79970EBULL, 0x3EC792A6A422029AULL },
+            { 0x5559BFEBEC7AC0BCULL, 0x3239421EE9B4CEE1ULL },
+            { 0x4447CCBCBD2F0096ULL, 0x5B6101B25490A581ULL },
+            { 0x6D3FADFAC84B3424ULL, 0x2BCE691D541AA268ULL },
+            { 0x576624C8A03C29B6ULL, 0x563EBA7DDCE21B87ULL },
+            { 0x45EB50A08030215EULL, 0x78322ECB171B4939ULL },
+            { 0x6FDEE76733803564ULL, 0x59E9E47824F87527ULL },
+            { 0x597F1F85C2CCF783ULL, 0x6187E9F9B72D2A86ULL },
+            { 0x4798E6049BD72C69ULL, 0x346CBB2E2C242205ULL },
+            { 0x728E3CD42C8B7A42ULL, 0x20ADF849E039D007ULL },
+            { 0x5BA4FD768A092E9BULL, 0x33BE603B19C7D99FULL },
+            { 0x4950CAC53B3A8BAFULL, 0x42FEB3627B0647B3ULL },
+            { 0x754E113B91F745E5ULL, 0x5197856A5E7072B8ULL },
+            { 0x5DD80DC941929E51ULL, 0x27AC6ABB7EC05BC6ULL },
+            { 0x4B133E3A9ADBB1DAULL, 0x52F05562CBCD1638ULL },
+            { 0x781EC9F75E2C4FC4ULL, 0x1E4D556ADFAE89F3ULL },
+            { 0x6018A192B1BD0C9CULL, 0x7EA444557FBED4C3ULL },
+            { 0x4CE0814227CA707DULL, 0x4BB69D1132FF109CULL },
+            { 0x7B00CED03FAA4D95ULL, 0x5F8A94E851981A93ULL },
+            { 0x62670BD9CC883E11ULL, 0x32D543ED0E134875ULL },
+            { 0x4EB8D647D6D364DAULL, 0x5BDDCFF0D80F6D2BULL },
+            { 0x7DF48A0C8AEBD491ULL, 0x12FC7FE7C018AEABULL },
+            { 0x64C3A1A3A25643A7ULL, 0x28C9FFEC99AD5889ULL },
+            { 0x509C814FB511CFB9ULL, 0x0707FFF07AF113A1ULL },
+            { 0x407D343FC40E3FC7ULL, 0x1F39998D2F2742E7ULL },
+            { 0x672EB9FFA016CC71ULL, 0x7EC28F484B7204A4ULL },
+            { 0x528BC7FFB345705BULL, 0x189BA5D36F8E6A1DULL },
+            { 0x42096CCC8F6AC048ULL, 0x7A161E42BFA521B1ULL },
+            { 0x69A8AE1418AACD41ULL, 0x435696D132A1CF81ULL },
+            { 0x5486F1A9AD557101ULL, 0x1C454574288172CEULL },
+            { 0x439F27BAF1112734ULL, 0x169DD129BA0128A5ULL },
+            { 0x6C31D92B1B4EA520ULL, 0x242FB50F9001DAA1ULL },
+            { 0x568E4755AF721DB3ULL, 0x368C90D940017BB4ULL },
+            { 0x453E9F77BF8E7E29ULL, 0x120A0D7A999AC95DULL },
+            { 0x6ECA98BF98E3FD0EULL, 0x50101590F5C47561ULL },
+            { 0x58A213CC7A4FFDA5ULL, 0x26734473F7D05DE8ULL },
+            { 0x46E80FD6C83FFE1DULL, 0x6B8F69F65FD9E4B9ULL },
+            { 0x71734C8AD9FFFCFCULL, 0x45B24323CC8FD45CULL },
+            { 0x5AC2A3A247FFFD96ULL, 0x6AF502830A0CA9E3ULL },
+            { 0x489BB61B6CCCCADFULL, 0x08C402026E7087E9ULL },
+            { 0x742C569247AE1164ULL, 0x746CD003E3E73FDBULL },
+            { 0x5CF04541D2F1A783ULL, 0x76BD73364FEC3315ULL },
+            { 0x4A59D101758E1F9CULL, 0x5EFDF5C50CBCF5ABULL },
+            { 0x76F61B3588E365C7ULL, 0x4B2FEFA1ADFB22ABULL },
+            { 0x5F2B48F7A0B5EB06ULL, 0x08F3261AF195B555ULL },
+            { 0x4C22A0C61A2B226BULL, 0x20C284E25ADE2AABULL },
+            { 0x79D1013CF6AB6A45ULL, 0x1AD0D49D5E304444ULL },
+            { 0x617400FD9222BB6AULL, 0x48A7107DE4F369D0ULL },
+            { 0x4DF6673141B562BBULL, 0x53B8D9FE50C2BB0DULL },
+            { 0x7CBD71E869223792ULL, 0x52C15CCA1AD12B48ULL },
+            { 0x63CAC186BA81C60EULL, 0x75677D6E7BDA8906ULL },
+            { 0x4FD5679EFB9B04D8ULL, 0x5DEC645863153A6CULL },
+            { 0x7FBBD8FE5F5E6E27ULL, 0x497A3A2704EEC3DFULL },
+        };
+
+        /// @brief Powers of five for the Eisel-Lemire algorithm
+        /// @details Entry `q + 342` is `5^q` normalized so that its top bit is set and truncated to
+        /// 128 bits, given as the upper and lower 64 bits. The reciprocals from `5^-1` to `5^-27`
+        /// are rounded up instead. Being a template member, the table is only emitted when
+        /// floating-point parsing is used
+        template<typename T = void>
+        struct __PowersOfFive {
+            static const int MinExponent = -342;
+            static const int MaxExponent = 308;
+
+            static const uint64_t Values[MaxExponent - MinExponent + 1][2];
+        };
+
+        template<typename T>
+        const uint64_t __PowersOfFive<T>::Values[MaxExponent - MinExponent + 1][2] = {
+                { 0xEEF453D6923BD65AULL, 0x113FAA2906A13B3FULL },
+                { 0x9558B4661B6565F8ULL, 0x4AC7CA59A424C507ULL },
+                { 0xBAAEE17FA23EBF76ULL, 0x5D79BCF00D2DF649ULL },
+                { 0xE95A99DF8ACE6F53ULL, 0xF4D82C2C107973DCULL },
+                { 0x91D8A02BB6C10594ULL, 0x79071B9B8A4BE869ULL },
+                { 0xB64EC836A47146F9ULL, 0x9748E2826CDEE284ULL },
+                { 0xE3E27A444D8D98B7ULL, 0xFD1B1B2308169B25ULL },
+                { 0x8E6D8C6AB0787F72ULL, 0xFE30F0F5E50E20F7ULL },
+                { 0xB208EF855C969F4FULL, 0xBDBD2D335E51A935ULL },
+                { 0xDE8B2B66B3BC4723ULL, 0xAD2C788035E61382ULL },
+                { 0x8B16FB203055AC76ULL, 0x4C3BCB5021AFCC31ULL },
+                { 0xADDCB9E83C6B1793ULL, 0xDF4ABE242A1BBF3DULL },
+                { 0xD953E8624B85DD78ULL, 0xD71D6DAD34A2AF0DULL },
+                { 0x87D4713D6F33AA6BULL, 0x8672648C40E5AD68ULL },
+                { 0xA9C98D8CCB009506ULL, 0x680EFDAF511F18C2ULL },
+                { 0xD43BF0EFFDC0BA48ULL, 0x0212BD1B2566DEF2ULL },
+                { 0x84A57695FE98746DULL, 0x014BB630F7604B57ULL },
+                { 0xA5CED43B7E3E9188ULL, 0x419EA3BD35385E2DULL },
+                { 0xCF42894A5DCE35EAULL, 0x52064CAC828675B9ULL },
+                { 0x818995CE7AA0E1B2ULL, 0x7343EFEBD1940993ULL },
+                { 0xA1EBFB4219491A1FULL, 0x1014EBE6C5F90BF8ULL },
+                { 0xCA66FA129F9B60A6ULL, 0xD41A26E077774EF6ULL },
+                { 0xFD00B897478238D0ULL, 0x8920B098955522B4ULL },
+                { 0x9E20735E8CB16382ULL, 0x55B46E5F5D5535B0ULL },
+                { 0xC5A890362FDDBC62ULL, 0xEB2189F734AA831DULL },
+                { 0xF712B443BBD52B7BULL, 0xA5E9EC7501D523E4ULL },
+                { 0x9A6BB0AA55653B2DULL, 0x47B233C92125366EULL },
+                { 0xC1069CD4EABE89F8ULL, 0x999EC0BB696E840AULL },
+                { 0xF148440A256E2C76ULL, 0xC00670EA43CA250DULL },
+                { 0x96CD2A865764DBCAULL, 0x380406926A5E5728ULL },
+                { 0xBC807527ED3E12BCULL, 0xC605083704F5ECF2ULL },
+                { 0xEBA09271E88D976BULL, 0xF7864A44C633682EULL },
+                { 0x93445B8731587EA3ULL, 0x7AB3EE6AFBE0211DULL },
+                { 0xB8157268FDAE9E4CULL, 0x5960EA05BAD82964ULL },
+                { 0xE61ACF033D1A45DFULL, 0x6FB92487298E33BDULL },
+                { 0x8FD0C16206306BABULL, 0xA5D3B6D479F8E056ULL },
+                { 0xB3C4F1BA87BC8696ULL, 0x8F48A4899877186CULL },
+                { 0xE0B62E2929ABA83CULL, 0x331ACDABFE94DE87ULL },
+                { 0x8C71DCD9BA0B4925ULL, 0x9FF0C08B7F1D0B14ULL },
+                { 0xAF8E5410288E1B6FULL, 0x07ECF0AE5EE44DD9ULL },
+                { 0xDB71E91432B1A24AULL, 0xC9E82CD9F69D6150ULL },
+                { 0x892731AC9FAF056EULL, 0xBE311C083A225CD2ULL },
+                { 0xAB70FE17C79AC6CAULL, 0x6DBD630A48AAF406ULL },
+                { 0xD64D3D9DB981787DULL, 0x092CBBCCDAD5B108ULL },
+                { 0x85F0468293F0EB4EULL, 0x25BBF56008C58EA5ULL },
+                { 0xA76C582338ED2621ULL, 0xAF2AF2B80AF6F24EULL },
+                { 0xD1476E2C07286FAAULL, 0x1AF5AF660DB4AEE1ULL },
+                { 0x82CCA4DB847945CAULL, 0x50D98D9FC890ED4DULL },
+                { 0xA37FCE126597973CULL, 0xE50FF107BAB528A0ULL },
+                { 0xCC5FC196FEFD7D0CULL, 0x1E53ED49A96272C8ULL },
+                { 0xFF77B1FCBEBCDC4FULL, 0x25E8E89C13BB0F7AULL },
+                { 0x9FAACF3DF73609B1ULL, 0x77B191618C54E9ACULL },
+                { 0xC795830D75038C1DULL, 0xD59DF5B9EF6A2417ULL },
+                { 0xF97AE3D0D2446F25ULL, 0x4B0573286B44AD1DULL },
+                { 0x9BECCE62836AC577ULL, 0x4EE367F9430AEC32ULL },
+                { 0xC2E801FB244576D5ULL, 0x229C41F793CDA73FULL },
+                { 0xF3A20279ED56D48AULL, 0x6B43527578C1110FULL },
+                { 0x9845418C345644D6ULL, 0x830A13896B78AAA9ULL },
+                { 0xBE5691EF416BD60CULL, 0x23CC986BC656D553ULL },
+                { 0xEDEC366B11C6CB8FULL, 0x2CBFBE86B7EC8AA8ULL },
+                { 0x94B3A202EB1C3F39ULL, 0x7BF7D71432F3D6A9ULL },
+                { 0xB9E08A83A5E34F07ULL, 0xDAF5CCD93FB0CC53ULL },
+                { 0xE858AD248F5C22C9ULL, 0xD1B3400F8F9CFF68ULL },
+                { 0x91376C36D99995BEULL, 0x23100809B9C21FA1ULL },
+                { 0xB58547448FFFFB2DULL, 0xABD40A0C2832A78AULL },
+                { 0xE2E69915B3FFF9F9ULL, 0x16C90C8F323F516CULL },
+                { 0x8DD01FAD907FFC3BULL, 0xAE3DA7D97F6792E3ULL },
+                { 0xB1442798F49FFB4AULL, 0x99CD11CFDF41779CULL },
+                { 0xDD95317F31C7FA1DULL, 0x40405643D711D583ULL },
+                { 0x8A7D3EEF7F1CFC52ULL, 0x482835EA666B2572ULL },
+                { 0xAD1C8EAB5EE43B66ULL, 0xDA3243650005EECFULL },
+                { 0xD863B256369D4A40ULL, 0x90BED43E40076A82ULL },
+                { 0x873E4F75E2224E68ULL, 0x5A7744A6E804A291ULL },
+                { 0xA90DE3535AAAE202ULL, 0x711515D0A205CB36ULL },
+                { 0xD3515C2831559A83ULL, 0x0D5A5B44CA873E03ULL },
+                { 0x8412D9991ED58091ULL, 0xE858790AFE9486C2ULL },
+                { 0xA5178FFF668AE0B6ULL, 0x626E974DBE39A872ULL },
+                { 0xCE5D73FF402D98E3ULL, 0xFB0A3D212DC8128FULL },
+                { 0x80FA687F881C7F8EULL, 0x7CE66634BC9D0B99ULL },
+                { 0xA139029F6A239F72ULL, 0x1C1FFFC1EBC44E80ULL },
+                { 0xC987434744AC874EULL, 0xA327FFB266B56220ULL },
+                { 0xFBE9141915D7A922ULL, 0x4BF1FF9F0062BAA8ULL },
+                { 0x9D71AC8FADA6C9B5ULL, 0x6F773FC3603DB4A9ULL },
+                { 0xC4CE17B399107C22ULL, 0xCB550FB4384D21D3ULL },
+                { 0xF6019DA07F549B2BULL, 0x7E2A53A146606A48ULL },
+                { 0x99C102844F94E0FBULL, 0x2EDA7444CBFC426DULL },
+                { 0xC0314325637A1939ULL, 0xFA911155FEFB5308ULL },
+                { 0xF03D93EEBC589F88ULL, 0x793555AB7EBA27CAULL },
+                { 0x96267C7535B763B5ULL, 0x4BC1558B2F3458DEULL },
+                { 0xBBB01B9283253CA2ULL, 0x9EB1AAEDFB016F16ULL },
+                { 0xEA9C227723EE8BCBULL, 0x465E15A979C1CADCULL },
+                { 0x92A1958A7675175FULL, 0x0BFACD89EC191EC9ULL },
+                { 0xB749FAED14125D36ULL, 0xCEF980EC671F667BULL },
+                { 0xE51C79A85916F484ULL, 0x82B7E12780E7401AULL },
+                { 0x8F31CC0937AE58D2ULL, 0xD1B2ECB8B0908810ULL },
+                { 0xB2FE3F0B8599EF07ULL, 0x861FA7E6DCB4AA15ULL },
+                { 0xDFBDCECE67006AC9ULL, 0x67A791E093E1D49AULL },
+                { 0x8BD6A141006042BDULL, 0xE0C8BB2C5C6D24E0ULL },
+                { 0xAECC49914078536DULL, 0x58FAE9F773886E18ULL },
+                { 0xDA7F5BF590966848ULL, 0xAF39A475506A899EULL },
+                { 0x888F99797A5E012DULL, 0x6D8406C952429603ULL },
+                { 0xAAB37FD7D8F58178ULL, 0xC8E5087BA6D33B83ULL },
+                { 0xD5605FCDCF32E1D6ULL, 0xFB1E4A9A90880A64ULL },
+                { 0x855C3BE0A17FCD26ULL, 0x5CF2EEA09A55067FULL },
+                { 0xA6B34AD8C9DFC06FULL, 0xF42FAA48C0EA481EULL },
+                { 0xD0601D8EFC57B08BULL, 0xF13B94DAF124DA26ULL },
+                { 0x823C12795DB6CE57ULL, 0x76C53D08D6B70858ULL },
+                { 0xA2CB1717B52481EDULL, 0x54768C4B0C64CA6EULL },
+                { 0xCB7DDCDDA26DA268ULL, 0xA9942F5DCF7DFD09ULL },
+                { 0xFE5D54150B090B02ULL, 0xD3F93B35435D7C4CULL },
+                { 0x9EFA548D26E5A6E1ULL, 0xC47BC5014A1A6DAFULL },
+                { 0xC6B8E9B0709F109AULL, 0x359AB6419CA1091BULL },
+                { 0xF867241C8CC6D4C0ULL, 0xC30163D203C94B62ULL },
+                { 0x9B407691D7FC44F8ULL, 0x79E0DE63425DCF1DULL },
+                { 0xC21094364DFB5636ULL, 0x985915FC12F542E4ULL },
+                { 0xF294B943E17A2BC4ULL, 0x3E6F5B7B17B2939DULL },
+                { 0x979CF3CA6CEC5B5AULL, 0xA705992CEECF9C42ULL },
+                { 0xBD8430BD08277231ULL, 0x50C6FF782A838353ULL },
+                { 0xECE53CEC4A314EBDULL, 0xA4F8BF5635246428ULL },
+                { 0x940F4613AE5ED136ULL, 0x871B7795E136BE99ULL },
+                { 0xB913179899F68584ULL, 0x28E2557B59846E3FULL },
+                { 0xE757DD7EC07426E5ULL, 0x331AEADA2FE589CFULL },
+                { 0x9096EA6F3848984FULL, 0x3FF0D2C85DEF7621ULL },
+                { 0xB4BCA50B065ABE63ULL, 0x0FED077A756B53A9ULL },
+                { 0xE1EBCE4DC7F16DFBULL, 0xD3E8495912C62894ULL },
+                { 0x8D3360F09CF6E4BDULL, 0x64712DD7ABBBD95CULL },
+                { 0xB080392CC4349DECULL, 0xBD8D794D96AACFB3ULL },
+                { 0xDCA04777F541C567ULL, 0xECF0D7A0FC5583A0ULL },
+                { 0x89E42CAAF9491B60ULL, 0xF41686C49DB57244ULL },
+                { 0xAC5D37D5B79B6239ULL, 0x311C2875C522CED5ULL },
+                { 0xD77485CB25823AC7ULL, 0x7D633293366B828BULL },
+                { 0x86A8D39EF77164BCULL, 0xAE5DFF9C02033197ULL },
+                { 0xA8530886B54DBDEBULL, 0xD9F57F830283FDFCULL },
+                { 0xD267CAA862A12D66ULL, 0xD072DF63C324FD7BULL },
+                { 0x8380DEA93DA4BC60ULL, 0x4247CB9E59F71E6DULL },
+                { 0xA46116538D0DEB78ULL, 0x52D9BE85F074E608ULL },
+                { 0xCD795BE870516656ULL, 0x67902E276C921F8BULL },
+                { 0x806BD9714632DFF6ULL, 0x00BA1CD8A3DB53B6ULL },
+                { 0xA086CFCD97BF97F3ULL, 0x80E8A40ECCD228A4ULL },
+                { 0xC8A883C0FDAF7DF0ULL, 0x6122CD128006B2CDULL },
+                { 0xFAD2A4B13D1B5D6CULL, 0x796B805720085F81ULL },
+                { 0x9CC3A6EEC6311A63ULL, 0xCBE3303674053BB0ULL },
+                { 0xC3F490AA77BD60FCULL, 0xBEDBFC4411068A9CULL },
+                { 0xF4F1B4D515ACB93BULL, 0xEE92FB5515482D44ULL },
+                { 0x991711052D8BF3C5ULL, 0x751BDD152D4D1C4AULL },
+                { 0xBF5CD54678EEF0B6ULL, 0xD262D45A78A0635DULL },
+                { 0xEF340A98172AACE4ULL, 0x86FB897116C87C34ULL },
+                { 0x9580869F0E7AAC0EULL, 0xD45D35E6AE3D4DA0ULL },
+                { 0xBAE0A846D2195712ULL, 0x8974836059CCA109ULL },
+                { 0xE998D258869FACD7ULL, 0x2BD1A438703FC94BULL },
+                { 0x91FF83775423CC06ULL, 0x7B6306A34627DDCFULL },
+                { 0xB67F6455292CBF08ULL, 0x1A3BC84C17B1D542ULL },
+                { 0xE41F3D6A7377EECAULL, 0x20CABA5F1D9E4A93ULL },
+                { 0x8E938662882AF53EULL, 0x547EB47B7282EE9CULL },
+                { 0xB23867FB2A35B28DULL, 0xE99E619A4F23AA43ULL },
+                { 0xDEC681F9F4C31F31ULL, 0x6405FA00E2EC94D4ULL },
+                { 0x8B3C113C38F9F37EULL, 0xDE83BC408DD3DD04ULL },
+                { 0xAE0B158B4738705EULL, 0x9624AB50B148D445ULL },
+                { 0xD98DDAEE19068C76ULL, 0x3BADD624DD9B0957ULL },
+                { 0x87F8A8D4CFA417C9ULL, 0xE54CA5D70A80E5D6ULL },
+                { 0xA9F6D30A038D1DBCULL, 0x5E9FCF4CCD211F4CULL },
+                { 0xD47487CC8470652BULL, 0x7647C3200069671FULL },
+                { 0x84C8D4DFD2C63F3BULL, 0x29ECD9F40041E073ULL },
+                { 0xA5FB0A17C777CF09ULL, 0xF468107100525890ULL },
+                { 0xCF79CC9DB955C2CCULL, 0x7182148D4066EEB4ULL },
+                { 0x81AC1FE293D599BFULL, 0xC6F14CD848405530ULL },
+                { 0xA21727DB38CB002FULL, 0xB8ADA00E5A506A7CULL },
+                { 0xCA9CF1D206FDC03BULL, 0xA6D90811F0E4851CULL },
+                { 0xFD442E4688BD304AULL, 0x908F4A166D1DA663ULL },
+                { 0x9E4A9CEC15763E2EULL, 0x9A598E4E043287FEULL },
+                { 0xC5DD44271AD3CDBAULL, 0x40EFF1E1853F29FDULL },
+                { 0xF7549530E188C128ULL, 0xD12BEE59E68EF47CULL },
+                { 0x9A94DD3E8CF578B9ULL, 0x82BB74F8301958CEULL },
+                { 0xC13A148E3032D6E7ULL, 0xE36A52363C1FAF01ULL },
+                { 0xF18899B1BC3F8CA1ULL, 0xDC44E6C3CB279AC1ULL },
+                { 0x96F5600F15A7B7E5ULL, 0x29AB103A5EF8C0B9ULL },
+                { 0xBCB2B812DB11A5DEULL, 0x7415D448F6B6F0E7ULL },
+                { 0xEBDF661791D60F56ULL, 0x111B495B3464AD21ULL },
+                { 0x936B9FCEBB25C995ULL, 0xCAB10DD900BEEC34ULL },
+                { 0xB84687C269EF3BFBULL, 0x3D5D514F40EEA742ULL },
+                { 0xE65829B3046B0AFAULL, 0x0CB4A5A3112A5112ULL },
+                { 0x8FF71A0FE2C2E6DCULL, 0x47F0E785EABA72ABULL },
+                { 0xB3F4E093DB73A093ULL, 0x59ED216765690F56ULL },
+                { 0xE0F218B8D25088B8ULL, 0x306869C13EC3532CULL },
+                { 0x8C974F7383725573ULL, 0x1E414218C73A13FBULL },
+                { 0xAFBD2350644EEACFULL, 0xE5D1929EF90898FAULL },
+                { 0xDBAC6C247D62A583ULL, 0xDF45F746B74ABF39ULL },
+                { 0x894BC396CE5DA772ULL, 0x6B8BBA8C328EB783ULL },
+                { 0xAB9EB47C81F5114FULL, 0x066EA92F3F326564ULL },
+                { 0xD686619BA27255A2ULL, 0xC80A537B0EFEFEBDULL },
+                { 0x8613FD0145877585ULL, 0xBD06742CE95F5F36ULL },
+                { 0xA798FC4196E952E7ULL, 0x2C48113823B73704ULL },
+                { 0xD17F3B51FCA3A7A0ULL, 0xF75A15862CA504C5ULL },
+                { 0x82EF85133DE648C4ULL, 0x9A984D73DBE722FBULL },
+                { 0xA3AB66580D5FDAF5ULL, 0xC13E60D0D2E0EBBAULL },
+                { 0xCC963FEE10B7D1B3ULL, 0x318DF905079926A8ULL },
+                { 0xFFBBCFE994E5C61FULL, 0xFDF17746497F7052ULL },
+                { 0x9FD561F1FD0F9BD3ULL, 0xFEB6EA8BEDEFA633ULL },
+                { 0xC7CABA6E7C5382C8ULL, 0xFE64A52EE96B8FC0ULL },
+                { 0xF9BD690A1B68637BULL, 0x3DFDCE7AA3C673B0ULL },
+                { 0x9C1661A651213E2DULL, 0x06BEA10CA65C084EULL },
+                { 0xC31BFA0FE5698DB8ULL, 0x486E494FCFF30A62ULL },
+                { 0xF3E2F893DEC3F126ULL, 0x5A89DBA3C3EFCCFAULL },
+                { 0x986DDB5C6B3A76B7ULL, 0xF89629465A75E01CULL },
+                { 0xBE89523386091465ULL, 0xF6BBB397F1135823ULL },
+                { 0xEE2BA6C0678B597FULL, 0x746AA07DED582E2CULL },
+                { 0x94DB483840B717EFULL, 0xA8C2A44EB4571CDCULL },
+                { 0xBA121A4650E4DDEBULL, 0x92F34D62616CE413ULL },
+                { 0xE896A0D7E51E1566ULL, 0x77B020BAF9C81D17ULL },
+                { 0x915E2486EF32CD60ULL, 0x0ACE1474DC1D122EULL },
+                { 0xB5B5ADA8AAFF80B8ULL, 0x0D819992132456BAULL },
+                { 0xE3231912D5BF60E6ULL, 0x10E1FFF697ED6C69ULL },
+                { 0x8DF5EFABC5979C8FULL, 0xCA8D3FFA1EF463C1ULL },
+                { 0xB1736B96B6FD83B3ULL, 0xBD308FF8A6B17CB2ULL },
+                { 0xDDD0467C64BCE4A0ULL, 0xAC7CB3F6D05DDBDEULL },
+                { 0x8AA22C0DBEF60EE4ULL, 0x6BCDF07A423AA96BULL },
+                { 0xAD4AB7112EB3929DULL, 0x86C16C98D2C953C6ULL },
+                { 0xD89D64D57A607744ULL, 0xE871C7BF077BA8B7ULL },
+                { 0x87625F056C7C4A8BULL, 0x11471CD764AD4972ULL },
+                { 0xA93AF6C6C79B5D2DULL, 0xD598E40D3DD89BCFULL },
+                { 0xD389B47879823479ULL, 0x4AFF1D108D4EC2C3ULL },
+                { 0x843610CB4BF160CBULL, 0xCEDF722A585139BAULL },
+                { 0xA54394FE1EEDB8FEULL, 0xC2974EB4EE658828ULL },
+                { 0xCE947A3DA6A9273EULL, 0x733D226229FEEA32ULL },
+                { 0x811CCC668829B887ULL, 0x0806357D5A3F525FULL },
+                { 0xA163FF802A3426A8ULL, 0xCA07C2DCB0CF26F7ULL },
+                { 0xC9BCFF6034C13052ULL, 0xFC89B393DD02F0B5ULL },
+                { 0xFC2C3F3841F17C67ULL, 0xBBAC2078D443ACE2ULL },
+                { 0x9D9BA7832936EDC0ULL, 0xD54B944B84AA4C0DULL },
+                { 0xC5029163F384A931ULL, 0x0A9E795E65D4DF11ULL },
+                { 0xF64335BCF065D37DULL, 0x4D4617B5FF4A16D5ULL },
+                { 0x99EA0196163FA42EULL, 0x504BCED1BF8E4E45ULL },
+                { 0xC06481FB9BCF8D39ULL, 0xE45EC2862F71E1D6ULL },
+                { 0xF07DA27A82C37088ULL, 0x5D767327BB4E5A4CULL },
+                { 0x964E858C91BA2655ULL, 0x3A6A07F8D510F86FULL },
+                { 0xBBE226EFB628AFEAULL, 0x890489F70A55368BULL },
+                { 0xEADAB0ABA3B2DBE5ULL, 0x2B45AC74CCEA842EULL },
+                { 0x92C8AE6B464FC96FULL, 0x3B0B8BC90012929DULL },
+                { 0xB77ADA0617E3BBCBULL, 0x09CE6EBB40173744ULL },
+                { 0xE55990879DDCAABDULL, 0xCC420A6A101D0515ULL },
+                { 0x8F57FA54C2A9EAB6ULL, 0x9FA946824A12232DULL },
+                { 0xB32DF8E9F3546564ULL, 0x47939822DC96ABF9ULL },
+                { 0xDFF9772470297EBDULL, 0x59787E2B93BC56F7ULL },
+                { 0x8BFBEA76C619EF36ULL, 0x57EB4EDB3C55B65AULL },
+                { 0xAEFAE51477A06B03ULL, 0xEDE622920B6B23F1ULL },
+                { 0xDAB99E59958885C4ULL, 0xE95FAB368E45ECEDULL },
+                { 0x88B402F7FD75539BULL, 0x11DBCB0218EBB414ULL },
+                { 0xAAE103B5FCD2A881ULL, 0xD652BDC29F26A119ULL },
+                { 0xD59944A37C0752A2ULL, 0x4BE76D3346F0495FULL },
+                { 0x857FCAE62D8493A5ULL, 0x6F70A4400C562DDBULL },
+                { 0xA6DFBD9FB8E5B88EULL, 0xCB4CCD500F6BB952ULL },
+                { 0xD097AD07A71F26B2ULL, 0x7E2000A41346A7A7ULL },
+                { 0x825ECC24C873782FULL, 0x8ED400668C0C28C8ULL },
+                { 0xA2F67F2DFA90563BULL, 0x728900802F0F32FAULL },
+                { 0xCBB41EF979346BCAULL, 0x4F2B40A03AD2FFB9ULL },
+                { 0xFEA126B7D78186BCULL, 0xE2F610C84987BFA8ULL },
+                { 0x9F24B832E6B0F436ULL, 0x0DD9CA7D2DF4D7C9ULL },
+                { 0xC6EDE63FA05D3143ULL, 0x91503D1C79720DBBULL },
+                { 0xF8A95FCF88747D94ULL, 0x75A44C6397CE912AULL },
+                { 0x9B69DBE1B548CE7CULL, 0xC986AFBE3EE11ABAULL },
+                { 0xC24452DA229B021BULL, 0xFBE85BADCE996168ULL },
+                { 0xF2D56790AB41C2A2ULL, 0xFAE27299423FB9C3ULL },
+                { 0x97C560BA6B0919A5ULL, 0xDCCD879FC967D41AULL },
+                { 0xBDB6B8E905CB600FULL, 0x5400E987BBC1C920ULL },
+                { 0xED246723473E3813ULL, 0x290123E9AAB23B68ULL },
+                { 0x9436C0760C86E30BULL, 0xF9A0B6720AAF6521ULL },
+                { 0xB94470938FA89BCEULL, 0xF808E40E8D5B3E69ULL },
+                { 0xE7958CB87392C2C2ULL, 0xB60B1D1230B20E04ULL },
+                { 0x90BD77F3483BB9B9ULL, 0xB1C6F22B5E6F48C2ULL },
+                { 0xB4ECD5F01A4AA828ULL, 0x1E38AEB6360B1AF3ULL },
+                { 0xE2280B6C20DD5232ULL, 0x25C6DA63C38DE1B0ULL },
+                { 0x8D590723948A535FULL, 0x579C487E5A38AD0EULL },
+                { 0xB0AF48EC79ACE837ULL, 0x2D835A9DF0C6D851ULL },
+                { 0xDCDB1B2798182244ULL, 0xF8E431456CF88E65ULL },
+                { 0x8A08F0F8BF0F156BULL, 0x1B8E9ECB641B58FFULL },
+                { 0xAC8B2D36EED2DAC5ULL, 0xE272467E3D222F3FULL },
+                { 0xD7ADF884AA879177ULL, 0x5B0ED81DCC6ABB0FULL },
+                { 0x86CCBB52EA94BAEAULL, 0x98E947129FC2B4E9ULL },
+                { 0xA87FEA27A539E9A5ULL, 0x3F2398D747B36224ULL },
+                { 0xD29FE4B18E88640EULL, 0x8EEC7F0D19A03AADULL },
+                { 0x83A3EEEEF9153E89ULL, 0x1953CF68300424ACULL },
+                { 0xA48CEAAAB75A8E2BULL, 0x5FA8C3423C052DD7ULL },
+                { 0xCDB02555653131B6ULL, 0x3792F412CB06794DULL },
+                { 0x808E17555F3EBF11ULL, 0xE2BBD88BBEE40BD0ULL },
+                { 0xA0B19D2AB70E6ED6ULL, 0x5B6ACEAEAE9D0EC4ULL },
+                { 0xC8DE047564D20A8BULL, 0xF245825A5A445275ULL },
+                { 0xFB158592BE068D2EULL, 0xEED6E2F0F0D56712ULL },
+                { 0x9CED737BB6C4183DULL, 0x55464DD69685606BULL },
+                { 0xC428D05AA4751E4CULL, 0xAA97E14C3C26B886ULL },
+                { 0xF53304714D9265DFULL, 0xD53DD99F4B3066A8ULL },
+                { 0x993FE2C6D07B7FABULL, 0xE546A8038EFE4029ULL },
+                { 0xBF8FDB78849A5F96ULL, 0xDE98520472BDD033ULL },
+                { 0xEF73D256A5C0F77CULL, 0x963E66858F6D4440ULL },
+                { 0x95A8637627989AADULL, 0xDDE7001379A44AA8ULL },
+                { 0xBB127C53B17EC159ULL, 0x5560C018580D5D52ULL },
+                { 0xE9D71B689DDE71AFULL, 0xAAB8F01E6E10B4A6ULL },
+                { 0x9226712162AB070DULL, 0xCAB3961304CA70E8ULL },
+                { 0xB6B00D69BB55C8D1ULL, 0x3D607B97C5FD0D22ULL },
+                { 0xE45C10C42A2B3B05ULL, 0x8CB89A7DB77C506AULL },
+                { 0x8EB98A7A9A5B04E3ULL, 0x77F3608E92ADB242ULL },
+                { 0xB267ED1940F1C61CULL, 0x55F038B237591ED3ULL },
+                { 0xDF01E85F912E37A3ULL, 0x6B6C46DEC52F6688ULL },
+                { 0x8B61313BBABCE2C6ULL, 0x2323AC4B3B3DA015ULL },
+                { 0xAE397D8AA96C1B77ULL, 0xABEC975E0A0D081AULL },
+                { 0xD9C7DCED53C72255ULL, 0x96E7BD358C904A21ULL },
+                { 0x881CEA14545C7575ULL, 0x7E50D64177DA2E54ULL },
+                { 0xAA242499697392D2ULL, 0xDDE50BD1D5D0B9E9ULL },
+                { 0xD4AD2DBFC3D07787ULL, 0x955E4EC64B44E864ULL },
+                { 0x84EC3C97DA624AB4ULL, 0xBD5AF13BEF0B113EULL },
+                { 0xA6274BBDD0FADD61ULL, 0xECB1AD8AEACDD58EULL },
+                { 0xCFB11EAD453994BAULL, 0x67DE18EDA5814AF2ULL },
+                { 0x81CEB32C4B43FCF4ULL, 0x80EACF948770CED7ULL },
+                { 0xA2425FF75E14FC31ULL, 0xA1258379A94D028DULL },
+                { 0xCAD2F7F5359A3B3EULL, 0x096EE45813A04330ULL },
+                { 0xFD87B5F28300CA0DULL, 0x8BCA9D6E188853FCULL },
+                { 0x9E74D1B791E07E48ULL, 0x775EA264CF55347EULL },
+                { 0xC612062576589DDAULL, 0x95364AFE032A819EULL },
+                { 0xF79687AED3EEC551ULL, 0x3A83DDBD83F52205ULL },
+                { 0x9ABE14CD44753B52ULL, 0xC4926A9672793543ULL },
+                { 0xC16D9A0095928A27ULL, 0x75B7053C0F178294ULL },
+                { 0xF1C90080BAF72CB1ULL, 0x5324C68B12DD6339ULL },
+                { 0x971DA05074DA7BEEULL, 0xD3F6FC16EBCA5E04ULL },
+                { 0xBCE5086492111AEAULL, 0x88F4BB1CA6BCF585ULL },
+                { 0xEC1E4A7DB69561A5ULL, 0x2B31E9E3D06C32E6ULL },
+                { 0x9392EE8E921D5D07ULL, 0x3AFF322E62439FD0ULL },
+                { 0xB877AA3236A4B449ULL, 0x09BEFEB9FAD487C3ULL },
+                { 0xE69594BEC44DE15BULL, 0x4C2EBE687989A9B4ULL },
+                { 0x901D7CF73AB0ACD9ULL, 0x0F9D37014BF60A11ULL },
+                { 0xB424DC35095CD80FULL, 0x538484C19EF38C95ULL },
+                { 0xE12E13424BB40E13ULL, 0x2865A5F206B06FBAULL },
+                { 0x8CBCCC096F5088CBULL, 0xF93F87B7442E45D4ULL },
+                { 0xAFEBFF0BCB24AAFEULL, 0xF78F69A51539D749ULL },
+                { 0xDBE6FECEBDEDD5BEULL, 0xB573440E5A884D1CULL },
+                { 0x89705F4136B4A597ULL, 0x31680A88F8953031ULL },
+                { 0xABCC77118461CEFCULL, 0xFDC20D2B36BA7C3EULL },
+                { 0xD6BF94D5E57A42BCULL, 0x3D32907604691B4DULL },
+                { 0x8637BD05AF6C69B5ULL, 0xA63F9A49C2C1B110ULL },
+                { 0xA7C5AC471B478423ULL, 0x0FCF80DC33721D54ULL },
+                { 0xD1B71758E219652BULL, 0xD3C36113404EA4A9ULL },
+                { 0x83126E978D4FDF3BULL, 0x645A1CAC083126EAULL },
+                { 0xA3D70A3D70A3D70AULL, 0x3D70A3D70A3D70A4ULL },
+                { 0xCCCCCCCCCCCCCCCCULL, 0xCCCCCCCCCCCCCCCDULL },
+                { 0x8000000000000000ULL, 0x0000000000000000ULL },
+                { 0xA000000000000000ULL, 0x0000000000000000ULL },
+                { 0xC800000000000000ULL, 0x0000000000000000ULL },
+                { 0xFA00000000000000ULL, 0x0000000000000000ULL },
+                { 0x9C40000000000000ULL, 0x0000000000000000ULL },
+                { 0xC350000000000000ULL, 0x0000000000000000ULL },
+                { 0xF424000000000000ULL, 0x0000000000000000ULL },
+                { 0x9896800000000000ULL, 0x0000000000000000ULL },
+                { 0xBEBC200000000000ULL, 0x0000000000000000ULL },
+                { 0xEE6B280000000000ULL, 0x0000000000000000ULL },
+                { 0x9502F90000000000ULL, 0x0000000000000000ULL },
+                { 0xBA43B74000000000ULL, 0x0000000000000000ULL },
+                { 0xE8D4A51000000000ULL, 0x0000000000000000ULL },
+                { 0x9184E72A00000000ULL, 0x0000000000000000ULL },
+                { 0xB5E620F480000000ULL, 0x0000000000000000ULL },
+                { 0xE35FA931A0000000ULL, 0x0000000000000000ULL },
+                { 0x8E1BC9BF04000000ULL, 0x0000000000000000ULL },
+                { 0xB1A2BC2EC5000000ULL, 0x0000000000000000ULL },
+                { 0xDE0B6B3A76400000ULL, 0x0000000000000000ULL },
+                { 0x8AC7230489E80000ULL, 0x0000000000000000ULL },
+                { 0xAD78EBC5AC620000ULL, 0x0000000000000000ULL },
+                { 0xD8D726B7177A8000ULL, 0x0000000000000000ULL },
+                { 0x878678326EAC9000ULL, 0x0000000000000000ULL },
+                { 0xA968163F0A57B400ULL, 0x0000000000000000ULL },
+                { 0xD3C21BCECCEDA100ULL, 0x0000000000000000ULL },
+                { 0x84595161401484A0ULL, 0x0000000000000000ULL },
+                { 0xA56FA5B99019A5C8ULL, 0x0000000000000000ULL },
+                { 0xCECB8F27F4200F3AULL, 0x0000000000000000ULL },
+                { 0x813F3978F8940984ULL, 0x4000000000000000ULL },
+                { 0xA18F07D736B90BE5ULL, 0x5000000000000000ULL },
+                { 0xC9F2C9CD04674EDEULL, 0xA400000000000000ULL },
+                { 0xFC6F7C4045812296ULL, 0x4D00000000000000ULL },
+                { 0x9DC5ADA82B70B59DULL, 0xF020000000000000ULL },
+                { 0xC5371912364CE305ULL, 0x6C28000000000000ULL },
+                { 0xF684DF56C3E01BC6ULL, 0xC732000000000000ULL },
+                { 0x9A130B963A6C115CULL, 0x3C7F400000000000ULL },
+                { 0xC097CE7BC90715B3ULL, 0x4B9F100000000000ULL },
+                { 0xF0BDC21ABB48DB20ULL, 0x1E86D40000000000ULL },
+                { 0x96769950B50D88F4ULL, 0x1314448000000000ULL },
+                { 0xBC143FA4E250EB31ULL, 0x17D955A000000000ULL },
+                { 0xEB194F8E1AE525FDULL, 0x5DCFAB0800000000ULL },
+                { 0x92EFD1B8D0CF37BEULL, 0x5AA1CAE500000000ULL },
+                { 0xB7ABC627050305ADULL, 0xF14A3D9E40000000ULL },
+                { 0xE596B7B0C643C719ULL, 0x6D9CCD05D0000000ULL },
+                { 0x8F7E32CE7BEA5C6FULL, 0xE4820023A2000000ULL },
+                { 0xB35DBF821AE4F38BULL, 0xDDA2802C8A800000ULL },
+                { 0xE0352F62A19E306EULL, 0xD50B2037AD200000ULL },
+                { 0x8C213D9DA502DE45ULL, 0x4526F422CC340000ULL },
+                { 0xAF298D050E4395D6ULL, 0x9670B12B7F410000ULL },
+                { 0xDAF3F04651D47B4CULL, 0x3C0CDD765F114000ULL },
+                { 0x88D8762BF324CD0FULL, 0xA5880A69FB6AC800ULL },
+                { 0xAB0E93B6EFEE0053ULL, 0x8EEA0D047A457A00ULL },
+                { 0xD5D238A4ABE98068ULL, 0x72A4904598D6D880ULL },
+                { 0x85A36366EB71F041ULL, 0x47A6DA2B7F864750ULL },
+                { 0xA70C3C40A64E6C51ULL, 0x999090B65F67D924ULL },
+                { 0xD0CF4B50CFE20765ULL, 0xFFF4B4E3F741CF6DULL },
+                { 0x82818F1281ED449FULL, 0xBFF8F10E7A8921A4ULL },
+                { 0xA321F2D7226895C7ULL, 0xAFF72D52192B6A0DULL },
+                { 0xCBEA6F8CEB02BB39ULL, 0x9BF4F8A69F764490ULL },
+                { 0xFEE50B7025C36A08ULL, 0x02F236D04753D5B4ULL },
+                { 0x9F4F2726179A2245ULL, 0x01D762422C946590ULL },
+                { 0xC722F0EF9D80AAD6ULL, 0x424D3AD2B7B97EF5ULL },
+                { 0xF8EBAD2B84E0D58BULL, 0xD2E0898765A7DEB2ULL },
+                { 0x9B934C3B330C8577ULL, 0x63CC55F49F88EB2FULL },
+                { 0xC2781F49FFCFA6D5ULL, 0x3CBF6B71C76B25FBULL },
+                { 0xF316271C7FC3908AULL, 0x8BEF464E3945EF7AULL },
+                { 0x97EDD871CFDA3A56ULL, 0x97758BF0E3CBB5ACULL },
+                { 0xBDE94E8E43D0C8ECULL, 0x3D52EEED1CBEA317ULL },
+                { 0xED63A231D4C4FB27ULL, 0x4CA7AAA863EE4BDDULL },
+                { 0x945E455F24FB1CF8ULL, 0x8FE8CAA93E74EF6AULL },
+                { 0xB975D6B6EE39E436ULL, 0xB3E2FD538E122B44ULL },
+                { 0xE7D34C64A9C85D44ULL, 0x60DBBCA87196B616ULL },
+                { 0x90E40FBEEA1D3A4AULL, 0xBC8955E946FE31CDULL },
+                { 0xB51D13AEA4A488DDULL, 0x6BABAB6398BDBE41ULL },
+                { 0xE264589A4DCDAB14ULL, 0xC696963C7EED2DD1ULL },
+                { 0x8D7EB76070A08AECULL, 0xFC1E1DE5CF543CA2ULL },
+                { 0xB0DE65388CC8ADA8ULL, 0x3B25A55F43294BCBULL },
+                { 0xDD15FE86AFFAD912ULL, 0x49EF0EB713F39EBEULL },
+                { 0x8A2DBF142DFCC7ABULL, 0x6E3569326C784337ULL },
+                { 0xACB92ED9397BF996ULL, 0x49C2C37F07965404ULL },
+                { 0xD7E77A8F87DAF7FBULL, 0xDC33745EC97BE906ULL },
+                { 0x86F0AC99B4E8DAFDULL, 0x69A028BB3DED71A3ULL },
+                { 0xA8ACD7C0222311BCULL, 0xC40832EA0D68CE0CULL },
+                { 0xD2D80DB02AABD62BULL, 0xF50A3FA490C30190ULL },
+                { 0x83C7088E1AAB65DBULL, 0x792667C6DA79E0FAULL },
+                { 0xA4B8CAB1A1563F52ULL, 0x577001B891185938ULL },
+                { 0xCDE6FD5E09ABCF26ULL, 0xED4C0226B55E6F86ULL },
+                { 0x80B05E5AC60B6178ULL, 0x544F8158315B05B4ULL },
+                { 0xA0DC75F1778E39D6ULL, 0x696361AE3DB1C721ULL },
+                { 0xC913936DD571C84CULL, 0x03BC3A19CD1E38E9ULL },
+                { 0xFB5878494ACE3A5FULL, 0x04AB48A04065C723ULL },
+                { 0x9D174B2DCEC0E47BULL, 0x62EB0D64283F9C76ULL },
+                { 0xC45D1DF942711D9AULL, 0x3BA5D0BD324F8394ULL },
+                { 0xF5746577930D6500ULL, 0xCA8F44EC7EE36479ULL },
+                { 0x9968BF6ABBE85F20ULL, 0x7E998B13CF4E1ECBULL },
+                { 0xBFC2EF456AE276E8ULL, 0x9E3FEDD8C321A67EULL },
+                { 0xEFB3AB16C59B14A2ULL, 0xC5CFE94EF3EA101EULL },
+                { 0x95D04AEE3B80ECE5ULL, 0xBBA1F1D158724A12ULL },
+                { 0xBB445DA9CA61281FULL, 0x2A8A6E45AE8EDC97ULL },
+                { 0xEA1575143CF97226ULL, 0xF52D09D71A3293BDULL },
+                { 0x924D692CA61BE758ULL, 0x593C2626705F9C56ULL },
+                { 0xB6E0C377CFA2E12EULL, 0x6F8B2FB00C77836CULL },
+                { 0xE498F455C38B997AULL, 0x0B6DFB9C0F956447ULL },
+                { 0x8EDF98B59A373FECULL, 0x4724BD4189BD5EACULL },
+                { 0xB2977EE300C50FE7ULL, 0x58EDEC91EC2CB657ULL },
+                { 0xDF3D5E9BC0F653E1ULL, 0x2F2967B66737E3EDULL },
+                { 0x8B865B215899F46CULL, 0xBD79E0D20082EE74ULL },
+                { 0xAE67F1E9AEC07187ULL, 0xECD8590680A3AA11ULL },
+                { 0xDA01EE641A708DE9ULL, 0xE80E6F4820CC9495ULL },
+                { 0x884134FE908658B2ULL, 0x3109058D147FDCDDULL },
+                { 0xAA51823E34A7EEDEULL, 0xBD4B46F0599FD415ULL },
+                { 0xD4E5E2CDC1D1EA96ULL, 0x6C9E18AC7007C91AULL },
+                { 0x850FADC09923329EULL, 0x03E2CF6BC604DDB0ULL },
+                { 0xA6539930BF6BFF45ULL, 0x84DB8346B786151CULL },
+                { 0xCFE87F7CEF46FF16ULL, 0xE612641865679A63ULL },
+                { 0x81F14FAE158C5F6EULL, 0x4FCB7E8F3F60C07EULL },
+                { 0xA26DA3999AEF7749ULL, 0xE3BE5E330F38F09DULL },
+                { 0xCB090C8001AB551CULL, 0x5CADF5BFD3072CC5ULL },
+                { 0xFDCB4FA002162A63ULL, 0x73D9732FC7C8F7F6ULL },
+                { 0x9E9F11C4014DDA7EULL, 0x2867E7FDDCDD9AFAULL },
+                { 0xC646D63501A1511DULL, 0xB281E1FD541501B8ULL },
+                { 0xF7D88BC24209A565ULL, 0x1F225A7CA91A4226ULL },
+                { 0x9AE757596946075FULL, 0x3375788DE9B06958ULL },
+                { 0xC1A12D2FC3978937ULL, 0x0052D6B1641C83AEULL },
+                { 0xF209787BB47D6B84ULL, 0xC0678C5DBD23A49AULL },
+                { 0x9745EB4D50CE6332ULL, 0xF840B7BA963646E0ULL },
+                { 0xBD176620A501FBFFULL, 0xB650E5A93BC3D898ULL },
+                { 0xEC5D3FA8CE427AFFULL, 0xA3E51F138AB4CEBEULL },
+                { 0x93BA47C980E98CDFULL, 0xC66F336C36B10137ULL },
+                { 0xB8A8D9BBE123F017ULL, 0xB80B0047445D4184ULL },
+                { 0xE6D3102AD96CEC1DULL, 0xA60DC059157491E5ULL },
+                { 0x9043EA1AC7E41392ULL, 0x87C89837AD68DB2FULL },
+                { 0xB454E4A179DD1877ULL, 0x29BABE4598C311FBULL },
+                { 0xE16A1DC9D8545E94ULL, 0xF4296DD6FEF3D67AULL },
+                { 0x8CE2529E2734BB1DULL, 0x1899E4A65F58660CULL },
+                { 0xB01AE745B101E9E4ULL, 0x5EC05DCFF72E7F8FULL },
+                { 0xDC21A1171D42645DULL, 0x76707543F4FA1F73ULL },
+                { 0x899504AE72497EBAULL, 0x6A06494A791C53A8ULL },
+                { 0xABFA45DA0EDBDE69ULL, 0x0487DB9D17636892ULL },
+                { 0xD6F8D7509292D603ULL, 0x45A9D2845D3C42B6ULL },
+                { 0x865B86925B9BC5C2ULL, 0x0B8A2392BA45A9B2ULL },
+                { 0xA7F26836F282B732ULL, 0x8E6CAC7768D7141EULL },
+                { 0xD1EF0244AF2364FFULL, 0x3207D795430CD926ULL },
+                { 0x8335616AED761F1FULL, 0x7F44E6BD49E807B8ULL },
+                { 0xA402B9C5A8D3A6E7ULL, 0x5F16206C9C6209A6ULL },
+                { 0xCD036837130890A1ULL, 0x36DBA887C37A8C0FULL },
+                { 0x802221226BE55A64ULL, 0xC2494954DA2C9789ULL },
+                { 0xA02AA96B06DEB0FDULL, 0xF2DB9BAA10B7BD6CULL },
+                { 0xC83553C5C8965D3DULL, 0x6F92829494E5ACC7ULL },
+                { 0xFA42A8B73ABBF48CULL, 0xCB772339BA1F17F9ULL },
+                { 0x9C69A97284B578D7ULL, 0xFF2A760414536EFBULL },
+                { 0xC38413CF25E2D70DULL, 0xFEF5138519684ABAULL },
+                { 0xF46518C2EF5B8CD1ULL, 0x7EB258665FC25D69ULL },
+                { 0x98BF2F79D5993802ULL, 0xEF2F773FFBD97A61ULL },
+                { 0xBEEEFB584AFF8603ULL, 0xAAFB550FFACFD8FAULL },
+                { 0xEEAABA2E5DBF6784ULL, 0x95BA2A53F983CF38ULL },
+                { 0x952AB45CFA97A0B2ULL, 0xDD945A747BF26183ULL },
+                { 0xBA756174393D88DFULL, 0x94F971119AEEF9E4ULL },
+                { 0xE912B9D1478CEB17ULL, 0x7A37CD5601AAB85DULL },
+                { 0x91ABB422CCB812EEULL, 0xAC62E055C10AB33AULL },
+                { 0xB616A12B7FE617AAULL, 0x577B986B314D6009ULL },
+                { 0xE39C49765FDF9D94ULL, 0xED5A7E85FDA0B80BULL },
+                { 0x8E41ADE9FBEBC27DULL, 0x14588F13BE847307ULL },
+                { 0xB1D219647AE6B31CULL, 0x596EB2D8AE258FC8ULL },
+                { 0xDE469FBD99A05FE3ULL, 0x6FCA5F8ED9AEF3BBULL },
+                { 0x8AEC23D680043BEEULL, 0x25DE7BB9480D5854ULL },
+                { 0xADA72CCC20054AE9ULL, 0xAF561AA79A10AE6AULL },
+                { 0xD910F7FF28069DA4ULL, 0x1B2BA1518094DA04ULL },
+                { 0x87AA9AFF79042286ULL, 0x90FB44D2F05D0842ULL },
+                { 0xA99541BF57452B28ULL, 0x353A1607AC744A53ULL },
+                { 0xD3FA922F2D1675F2ULL, 0x42889B8997915CE8ULL },
+                { 0x847C9B5D7C2E09B7ULL, 0x69956135FEBADA11ULL },
+                { 0xA59BC234DB398C25ULL, 0x43FAB9837E699095ULL },
+                { 0xCF02B2C21207EF2EULL, 0x94F967E45E03F4BBULL },
+                { 0x8161AFB94B44F57DULL, 0x1D1BE0EEBAC278F5ULL },
+                { 0xA1BA1BA79E1632DCULL, 0x6462D92A69731732ULL },
+                { 0xCA28A291859BBF93ULL, 0x7D7B8F7503CFDCFEULL },
+                { 0xFCB2CB35E702AF78ULL, 0x5CDA735244C3D43EULL },
+                { 0x9DEFBF01B061ADABULL, 0x3A0888136AFA64A7ULL },
+                { 0xC56BAEC21C7A1916ULL, 0x088AAA1845B8FDD0ULL },
+                { 0xF6C69A72A3989F5BULL, 0x8AAD549E57273D45ULL },
+                { 0x9A3C2087A63F6399ULL, 0x36AC54E2F678864BULL },
+                { 0xC0CB28A98FCF3C7FULL, 0x84576A1BB416A7DDULL },
+                { 0xF0FDF2D3F3C30B9FULL, 0x656D44A2A11C51D5ULL },
+                { 0x969EB7C47859E743ULL, 0x9F644AE5A4B1B325ULL },
+                { 0xBC4665B596706114ULL, 0x873D5D9F0DDE1FEEULL },
+                { 0xEB57FF22FC0C7959ULL, 0xA90CB506D155A7EAULL },
+                { 0x9316FF75DD87CBD8ULL, 0x09A7F12442D588F2ULL },
+                { 0xB7DCBF5354E9BECEULL, 0x0C11ED6D538AEB2FULL },
+                { 0xE5D3EF282A242E81ULL, 0x8F1668C8A86DA5FAULL },
+                { 0x8FA475791A569D10ULL, 0xF96E017D694487BCULL },
+                { 0xB38D92D760EC4455ULL, 0x37C981DCC395A9ACULL },
+                { 0xE070F78D3927556AULL, 0x85BBE253F47B1417ULL },
+                { 0x8C469AB843B89562ULL, 0x93956D7478CCEC8EULL },
+                { 0xAF58416654A6BABBULL, 0x387AC8D1970027B2ULL },
+                { 0xDB2E51BFE9D0696AULL, 0x06997B05FCC0319EULL },
+                { 0x88FCF317F22241E2ULL, 0x441FECE3BDF81F03ULL },
+                { 0xAB3C2FDDEEAAD25AULL, 0xD527E81CAD7626C3ULL },
+                { 0xD60B3BD56A5586F1ULL, 0x8A71E223D8D3B074ULL },
+                { 0x85C7056562757456ULL, 0xF6872D5667844E49ULL },
+                { 0xA738C6BEBB12D16CULL, 0xB428F8AC016561DBULL },
+                { 0xD106F86E69D785C7ULL, 0xE13336D701BEBA52ULL },
+                { 0x82A45B450226B39CULL, 0xECC0024661173473ULL },
+                { 0xA34D721642B06084ULL, 0x27F002D7F95D0190ULL },
+                { 0xCC20CE9BD35C78A5ULL, 0x31EC038DF7B441F4ULL },
+                { 0xFF290242C83396CEULL, 0x7E67047175A15271ULL },
+                { 0x9F79A169BD203E41ULL, 0x0F0062C6E984D386ULL },
+                { 0xC75809C42C684DD1ULL, 0x52C07B78A3E60868ULL },
+                { 0xF92E0C3537826145ULL, 0xA7709A56CCDF8A82ULL },
+                { 0x9BBCC7A142B17CCBULL, 0x88A66076400BB691ULL },
+                { 0xC2ABF989935DDBFEULL, 0x6ACFF893D00EA435ULL },
+                { 0xF356F7EBF83552FEULL, 0x0583F6B8C4124D43ULL },
+                { 0x98165AF37B2153DEULL, 0xC3727A337A8B704AULL },
+                { 0xBE1BF1B059E9A8D6ULL, 0x744F18C0592E4C5CULL },
+                { 0xEDA2EE1C7064130CULL, 0x1162DEF06F79DF73ULL },
+                { 0x9485D4D1C63E8BE7ULL, 0x8ADDCB5645AC2BA8ULL },
+                { 0xB9A74A0637CE2EE1ULL, 0x6D953E2BD7173692ULL },
+                { 0xE8111C87C5C1BA99ULL, 0xC8FA8DB6CCDD0437ULL },
+                { 0x910AB1D4DB9914A0ULL, 0x1D9C9892400A22A2ULL },
+                { 0xB54D5E4A127F59C8ULL, 0x2503BEB6D00CAB4BULL },
+                { 0xE2A0B5DC971F303AULL, 0x2E44AE64840FD61DULL },
+                { 0x8DA471A9DE737E24ULL, 0x5CEAECFED289E5D2ULL },
+                { 0xB10D8E1456105DADULL, 0x7425A83E872C5F47ULL },
+                { 0xDD50F1996B947518ULL, 0xD12F124E28F77719ULL },
+                { 0x8A5296FFE33CC92FULL, 0x82BD6B70D99AAA6FULL },
+                { 0xACE73CBFDC0BFB7BULL, 0x636CC64D1001550BULL },
+                { 0xD8210BEFD30EFA5AULL, 0x3C47F7E05401AA4EULL },
+                { 0x8714A775E3E95C78ULL, 0x65ACFAEC34810A71ULL },
+                { 0xA8D9D1535CE3B396ULL, 0x7F1839A741A14D0DULL },
+                { 0xD31045A8341CA07CULL, 0x1EDE48111209A050ULL },
+                { 0x83EA2B892091E44DULL, 0x934AED0AAB460432ULL },
+                { 0xA4E4B66B68B65D60ULL, 0xF81DA84D5617853FULL },
+                { 0xCE1DE40642E3F4B9ULL, 0x36251260AB9D668EULL },
+                { 0x80D2AE83E9CE78F3ULL, 0xC1D72B7C6B426019ULL },
+                { 0xA1075A24E4421730ULL, 0xB24CF65B8612F81FULL },
+                { 0xC94930AE1D529CFCULL, 0xDEE033F26797B627ULL },
+                { 0xFB9B7CD9A4A7443CULL, 0x169840EF017DA3B1ULL },
+                { 0x9D412E0806E88AA5ULL, 0x8E1F289560EE864EULL },
+                { 0xC491798A08A2AD4EULL, 0xF1A6F2BAB92A27E2ULL },
+                { 0xF5B5D7EC8ACB58A2ULL, 0xAE10AF696774B1DBULL },
+                { 0x9991A6F3D6BF1765ULL, 0xACCA6DA1E0A8EF29ULL },
+                { 0xBFF610B0CC6EDD3FULL, 0x17FD090A58D32AF3ULL },
+                { 0xEFF394DCFF8A948EULL, 0xDDFC4B4CEF07F5B0ULL },
+                { 0x95F83D0A1FB69CD9ULL, 0x4ABDAF101564F98EULL },
+                { 0xBB764C4CA7A4440FULL, 0x9D6D1AD41ABE37F1ULL },
+                { 0xEA53DF5FD18D5513ULL, 0x84C86189216DC5EDULL },
+                { 0x92746B9BE2F8552CULL, 0x32FD3CF5B4E49BB4ULL },
+                { 0xB7118682DBB66A77ULL, 0x3FBC8C33221DC2A1ULL },
+                { 0xE4D5E82392A40515ULL, 0x0FABAF3FEAA5334AULL },
+                { 0x8F05B1163BA6832DULL, 0x29CB4D87F2A7400EULL },
+                { 0xB2C71D5BCA9023F8ULL, 0x743E20E9EF511012ULL },
+                { 0xDF78E4B2BD342CF6ULL, 0x914DA9246B255416ULL },
+                { 0x8BAB8EEFB6409C1AULL, 0x1AD089B6C2F7548EULL },
+                { 0xAE9672ABA3D0C320ULL, 0xA184AC2473B529B1ULL },
+                { 0xDA3C0F568CC4F3E8ULL, 0xC9E5D72D90A2741EULL },
+                { 0x8865899617FB1871ULL, 0x7E2FA67C7A658892ULL },
+                { 0xAA7EEBFB9DF9DE8DULL, 0xDDBB901B98FEEAB7ULL },
+                { 0xD51EA6FA85785631ULL, 0x552A74227F3EA565ULL },
+                { 0x8533285C936B35DEULL, 0xD53A88958F87275FULL },
+                { 0xA67FF273B8460356ULL, 0x8A892ABAF368F137ULL },
+                { 0xD01FEF10A657842CULL, 0x2D2B7569B0432D85ULL },
+                { 0x8213F56A67F6B29BULL, 0x9C3B29620E29FC73ULL },
+                { 0xA298F2C501F45F42ULL, 0x8349F3BA91B47B8FULL },
+                { 0xCB3F2F7642717713ULL, 0x241C70A936219A73ULL },
+                { 0xFE0EFB53D30DD4D7ULL, 0xED238CD383AA0110ULL },
+                { 0x9EC95D1463E8A506ULL, 0xF4363804324A40AAULL },
+                { 0xC67BB4597CE2CE48ULL, 0xB143C6053EDCD0D5ULL },
+                { 0xF81AA16FDC1B81DAULL, 0xDD94B7868E94050AULL },
+                { 0x9B10A4E5E9913128ULL, 0xCA7CF2B4191C8326ULL },
+                { 0xC1D4CE1F63F57D72ULL, 0xFD1C2F611F63A3F0ULL },
+                { 0xF24A01A73CF2DCCFULL, 0xBC633B39673C8CECULL },
+                { 0x976E41088617CA01ULL, 0xD5BE0503E085D813ULL },
+                { 0xBD49D14AA79DBC82ULL, 0x4B2D8644D8A74E18ULL },
+                { 0xEC9C459D51852BA2ULL, 0xDDF8E7D60ED1219EULL },
+                { 0x93E1AB8252F33B45ULL, 0xCABB90E5C942B503ULL },
+                { 0xB8DA1662E7B00A17ULL, 0x3D6A751F3B936243ULL },
+                { 0xE7109BFBA19C0C9DULL, 0x0CC512670A783AD4ULL },
+                { 0x906A617D450187E2ULL, 0x27FB2B80668B24C5ULL },
+                { 0xB484F9DC9641E9DAULL, 0xB1F9F660802DEDF6ULL },
+                { 0xE1A63853BBD26451ULL, 0x5E7873F8A0396973ULL },
+                { 0x8D07E33455637EB2ULL, 0xDB0B487B6423E1E8ULL },
+                { 0xB049DC016ABC5E5FULL, 0x91CE1A9A3D2CDA62ULL },
+                { 0xDC5C5301C56B75F7ULL, 0x7641A140CC7810FBULL },
+                { 0x89B9B3E11B6329BAULL, 0xA9E904C87FCB0A9DULL },
+                { 0xAC2820D9623BF429ULL, 0x546345FA9FBDCD44ULL },
+                { 0xD732290FBACAF133ULL, 0xA97C177947AD4095ULL },
+                { 0x867F59A9D4BED6C0ULL, 0x49ED8EABCCCC485DULL },
+                { 0xA81F301449EE8C70ULL, 0x5C68F256BFFF5A74ULL },
+                { 0xD226FC195C6A2F8CULL, 0x73832EEC6FFF3111ULL },
+                { 0x83585D8FD9C25DB7ULL, 0xC831FD53C5FF7EABULL },
+                { 0xA42E74F3D032F525ULL, 0xBA3E7CA8B77F5E55ULL },
+                { 0xCD3A1230C43FB26FULL, 0x28CE1BD2E55F35EBULL },
+                { 0x80444B5E7AA7CF85ULL, 0x7980D163CF5B81B3ULL },
+                { 0xA0555E361951C366ULL, 0xD7E105BCC332621FULL },
+                { 0xC86AB5C39FA63440ULL, 0x8DD9472BF3FEFAA7ULL },
+                { 0xFA856334878FC150ULL, 0xB14F98F6F0FEB951ULL },
+                { 0x9C935E00D4B9D8D2ULL, 0x6ED1BF9A569F33D3ULL },
+                { 0xC3B8358109E84F07ULL, 0x0A862F80EC4700C8ULL },
+                { 0xF4A642E14C6262C8ULL, 0xCD27BB612758C0FAULL },
+                { 0x98E7E9CCCFBD7DBDULL, 0x8038D51CB897789CULL },
+                { 0xBF21E44003ACDD2CULL, 0xE0470A63E6BD56C3ULL },
+                { 0xEEEA5D5004981478ULL, 0x1858CCFCE06CAC74ULL },
+                { 0x95527A5202DF0CCBULL, 0x0F37801E0C43EBC8ULL },
+                { 0xBAA718E68396CFFDULL, 0xD30560258F54E6BAULL },
+                { 0xE950DF20247C83FDULL, 0x47C6B82EF32A2069ULL },
+                { 0x91D28B7416CDD27EULL, 0x4CDC331D57FA5441ULL },
+                { 0xB6472E511C81471DULL, 0xE0133FE4ADF8E952ULL },
+                { 0xE3D8F9E563A198E5ULL, 0x58180FDDD97723A6ULL },
+                { 0x8E679C2F5E44FF8FULL, 0x570F09EAA7EA7648ULL },
+        };
+    }
+}
+
+#endif
\ No newline at end of file
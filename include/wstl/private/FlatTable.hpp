@@ -0,0 +1,774 @@
+// Part of WardenSTL - https://github.com/WardenHD/WardenSTL
+// Copyright (c) 2025 Artem Bezruchko (WardenHD)
+//
+// Licensed under the MIT License. See LICENSE file for details.
+
+#ifndef __WSTL_PRIVATE_FLATTABLE_HPP__
+#define __WSTL_PRIVATE_FLATTABLE_HPP__
+
+#include "Platform.hpp"
+#include "Error.hpp"
+#include "../Container.hpp"
+#include "../Iterator.hpp"
+#include "../Utility.hpp"
+#include "../Algorithm.hpp"
+#include "../PlacementNew.hpp"
+#include "../StandardExceptions.hpp"
+#include <stddef.h>
+#include <stdint.h>
+
+
+namespace wstl {
+    /// @brief Order in which a flat map or a flat set keeps its elements in memory
+    /// @ingroup containers
+    __WSTL_ENUM_CLASS__(FlatLayout) {
+        /// @brief Sorted by key, lookups are binary searches and iterators are pointers
+        Sorted,
+        /// @brief Breadth-first order of an implicit binary search tree, children of the element
+        /// at `i` are at `2i + 1` and `2i + 2`. Lookups are branch-free and prefetch the levels below,
+        /// but every insertion or erasure rebuilds the layout in O(n log n)
+        Eytzinger
+    };
+
+    namespace __private {
+        /// @brief Uninitialized memory for one element of a flat table
+        template<typename T>
+        struct __FlatSlot {
+            typename AlignedStorage<sizeof(T), AlignmentOf<T>::Value>::Type Buffer;
+        };
+
+        /// @brief Key extraction for flat maps
+        /// @details Keys are not const, since sorting moves the elements
+        template<typename Key, typename T>
+        struct __FlatMapTraits {
+            typedef Key KeyType;
+            typedef Pair<Key, T> ValueType;
+            /// @brief Type that iterators refer to
+            typedef ValueType IteratorValueType;
+
+            static const KeyType& GetKey(const ValueType& value) {
+                return value.First;
+            }
+        };
+
+        /// @brief Key extraction for flat sets
+        template<typename Key>
+        struct __FlatSetTraits {
+            typedef Key KeyType;
+            typedef Key ValueType;
+            /// @brief Type that iterators refer to
+            typedef const Key IteratorValueType;
+
+            static const KeyType& GetKey(const KeyType& value) {
+                return value;
+            }
+        };
+
+        /// @brief Bidirectional iterator over the elements of an Eytzinger layout in key order
+        /// @tparam T Type of the elements, const for const iterators
+        template<typename T>
+        class __FlatTreeIterator {
+        public:
+            typedef typename RemoveConst<T>::Type ValueType;
+            typedef BidirectionalIteratorTag IteratorCategory;
+            typedef T& ReferenceType;
+            typedef T* PointerType;
+            typedef ptrdiff_t DifferenceType;
+
+            __FlatTreeIterator() : m_Data(__WSTL_NULLPTR__), m_Index(0), m_Size(0) {}
+
+            __FlatTreeIterator(T* data, size_t index, size_t size) : m_Data(data), m_Index(index), m_Size(size) {}
+
+            /// @brief Converting constructor from a mutable iterator
+            template<typename U>
+            __FlatTreeIterator(const __FlatTreeIterator<U>& other) : m_Data(other.m_Data), m_Index(other.m_Index), m_Size(other.m_Size) {}
+
+            ReferenceType operator*() const {
+                return m_Data[m_Index];
+            }
+
+            PointerType operator->() const {
+                return m_Data + m_Index;
+            }
+
+            __FlatTreeIterator& operator++() {
+                // Leftmost element of the right subtree, or the first ancestor reached from the left
+                if(2 * m_Index + 2 < m_Size) {
+                    m_Index = 2 * m_Index + 2;
+                    while(2 * m_Index + 1 < m_Size) m_Index = 2 * m_Index + 1;
+                }
+                else {
+                    while(m_Index != 0 && (m_Index & 1) == 0) m_Index = (m_Index - 1) / 2;
+                    m_Index = m_Index == 0 ? m_Size : (m_Index - 1) / 2;
+                }
+
+                return *this;
+            }
+
+            __FlatTreeIterator operator++(int) {
+                __FlatTreeIterator original(*this);
+                ++*this;
+                return original;
+            }
+
+            __FlatTreeIterator& operator--() {
+                // Rightmost element of the left subtree, or the first ancestor reached from the right
+                if(m_Index == m_Size) {
+                    m_Index = 0;
+                    while(2 * m_Index + 2 < m_Size) m_Index = 2 * m_Index + 2;
+                }
+                else if(2 * m_Index + 1 < m_Size) {
+                    m_Index = 2 * m_Index + 1;
+                    while(2 * m_Index + 2 < m_Size) m_Index = 2 * m_Index + 2;
+                }
+                else {
+                    while((m_Index & 1) != 0) m_Index = (m_Index - 1) / 2;
+                    m_Index = m_Index == 0 ? m_Size : (m_Index - 1) / 2;
+                }
+
+                return *this;
+            }
+
+            __FlatTreeIterator operator--(int) {
+                __FlatTreeIterator original(*this);
+                --*this;
+                return original;
+            }
+
+            template<typename U>
+            bool operator==(const __FlatTreeIterator<U>& other) const {
+                return m_Index == other.m_Index;
+            }
+
+            template<typename U>
+            bool operator!=(const __FlatTreeIterator<U>& other) const {
+                return m_Index != other.m_Index;
+            }
+
+            /// @brief Gets the position of the element in memory
+            size_t Index() const {
+                return m_Index;
+            }
+
+        private:
+            template<typename>
+            friend class __FlatTreeIterator;
+
+            T* m_Data;
+            size_t m_Index;
+            size_t m_Size;
+        };
+
+        /// @brief Searching, iteration and conversion from and to sorted order for a `FlatLayout`
+        template<FlatLayout Layout>
+        struct __FlatOrder;
+
+        template<>
+        struct __FlatOrder<FlatLayout::Sorted> {
+            template<typename T>
+            struct Iterator {
+                typedef T* Type;
+            };
+
+            template<typename T>
+            static T* MakeIterator(T* data, size_t index, size_t) {
+                return data + index;
+            }
+
+            template<typename T>
+            static size_t IndexOf(const T* data, const T* position) {
+                return static_cast<size_t>(position - data);
+            }
+
+            /// @brief Finds the first element for which the predicate is false
+            /// @return Position of the element in memory, or `size` if there is none
+            template<typename T, typename Predicate>
+            static size_t Search(const T* data, size_t size, Predicate predicate) {
+                return static_cast<size_t>(__BranchlessPartitionPoint(data, static_cast<ptrdiff_t>(size), predicate) - data);
+            }
+
+            /// @brief Gets the index in key order of the element at a position in memory
+            static size_t Rank(size_t index, size_t) {
+                return index;
+            }
+
+            /// @brief Gets the position in memory of the element with an index in key order
+            static size_t Position(size_t rank, size_t) {
+                return rank;
+            }
+
+            /// @brief Rearranges sorted elements into the layout
+            template<typename T>
+            static void Build(T*, size_t) {}
+
+            /// @brief Rearranges elements in the layout back into sorted order
+            template<typename T>
+            static void Restore(T*, size_t) {}
+        };
+
+        template<>
+        struct __FlatOrder<FlatLayout::Eytzinger> {
+            template<typename T>
+            struct Iterator {
+                typedef __FlatTreeIterator<T> Type;
+            };
+
+            template<typename T>
+            static __FlatTreeIterator<T> MakeIterator(T* data, size_t index, size_t size) {
+                return __FlatTreeIterator<T>(data, index, size);
+            }
+
+            template<typename T, typename U>
+            static size_t IndexOf(const T*, const __FlatTreeIterator<U>& position) {
+                return position.Index();
+            }
+
+            /// @brief Finds the first element in key order for which the predicate is false
+            /// @return Position of the element in memory, or `size` if there is none
+            template<typename T, typename Predicate>
+            static size_t Search(const T* data, size_t size, Predicate predicate) {
+                return __EytzingerSearch(data, size, predicate);
+            }
+
+            static size_t Rank(size_t index, size_t size) {
+                if(index >= size) return size;
+
+                size_t rank = SubtreeSize(2 * index + 1, size);
+
+                // Every ancestor reached from the right precedes the element, with its left subtree
+                for(; index != 0; index = (index - 1) / 2)
+                    if((index & 1) == 0) rank += SubtreeSize(index - 1, size) + 1;
+
+                return rank;
+            }
+
+            static size_t Position(size_t rank, size_t size) {
+                if(rank >= size) return size;
+
+                size_t index = 0;
+
+                for(;;) {
+                    const size_t left = SubtreeSize(2 * index + 1, size);
+
+                    if(rank == left) return index;
+                    if(rank < left) index = 2 * index + 1;
+                    else {
+                        rank -= left + 1;
+                        index = 2 * index + 2;
+                    }
+                }
+            }
+
+            template<typename T>
+            static void Build(T* data, size_t size) {
+                __EytzingerBuild(data, size);
+            }
+
+            template<typename T>
+            static void Restore(T* data, size_t size) {
+                __EytzingerRestore(data, size);
+            }
+
+        private:
+            /// @brief Number of elements in the subtree of an element
+            static size_t SubtreeSize(size_t index, size_t size) {
+                size_t result = 0;
+
+                for(size_t first = index, last = index; first < size; first = 2 * first + 1, last = 2 * last + 2)
+                    result += Min(last, size - 1) - first + 1;
+
+                return result;
+            }
+        };
+
+        /// @brief Table of unique keys in contiguous memory, shared by `BasicFlatMap` and `BasicFlatSet`
+        /// @tparam Traits Key extraction, `__FlatMapTraits` or `__FlatSetTraits`
+        /// @tparam Storage Storage of `__FlatSlot`s
+        /// @tparam Compare Ordering of the keys
+        /// @tparam Layout Order of the elements in memory
+        /// @details Single insertions and erasures shift the elements after the position.
+        /// Ranges are appended first, then the appended part is sorted, merged with the rest
+        /// in place and stripped of duplicates, so filling a table costs O(n log n) instead of O(n^2).
+        /// In `FlatLayout::Eytzinger` every modification converts the table to sorted order and
+        /// back, so it is meant for tables that are filled once and then only read
+        template<typename Traits, typename Storage, typename Compare, FlatLayout Layout>
+        class __FlatTable : public TypedContainerBase<Storage, typename Traits::ValueType> {
+        private:
+            typedef TypedContainerBase<Storage, typename Traits::ValueType> Base;
+            typedef __FlatOrder<Layout> Order;
+            typedef typename Traits::IteratorValueType IteratorValueType;
+
+        public:
+            typedef typename Traits::KeyType KeyType;
+            typedef typename Base::ValueType ValueType;
+            typedef typename Base::SizeType SizeType;
+            typedef typename Base::DifferenceType DifferenceType;
+            typedef typename Base::ReferenceType ReferenceType;
+            typedef typename Base::ConstReferenceType ConstReferenceType;
+            typedef typename Base::PointerType PointerType;
+            typedef typename Base::ConstPointerType ConstPointerType;
+
+            typedef typename Base::StorageType StorageType;
+            typedef typename Storage::ValueType SlotType;
+
+            typedef Compare KeyCompareType;
+
+            typedef typename Order::template Iterator<IteratorValueType>::Type Iterator;
+            typedef typename Order::template Iterator<const ValueType>::Type ConstIterator;
+            typedef wstl::ReverseIterator<Iterator> ReverseIterator;
+            typedef wstl::ReverseIterator<ConstIterator> ConstReverseIterator;
+
+            /// @brief Layout of the elements in memory
+            static const __WSTL_CONSTEXPR__ FlatLayout LayoutType = Layout;
+
+            /// @brief Destructor
+            ~__FlatTable() {
+                Clear();
+            }
+
+            /// @brief Gets iterator to the element with the smallest key
+            Iterator Begin() {
+                return IteratorAt(Order::Position(0, this->m_CurrentSize));
+            }
+
+            /// @brief Gets const iterator to the element with the smallest key
+            ConstIterator Begin() const {
+                return IteratorAt(Order::Position(0, this->m_CurrentSize));
+            }
+
+            /// @brief Gets const iterator to the element with the smallest key
+            ConstIterator ConstBegin() const {
+                return Begin();
+            }
+
+            /// @brief Gets iterator past the element with the largest key
+            Iterator End() {
+                return IteratorAt(this->m_CurrentSize);
+            }
+
+            /// @brief Gets const iterator past the element with the largest key
+            ConstIterator End() const {
+                return IteratorAt(this->m_CurrentSize);
+            }
+
+            /// @brief Gets const iterator past the element with the largest key
+            ConstIterator ConstEnd() const {
+                return End();
+            }
+
+            /// @brief Gets reverse iterator to the element with the largest key
+            ReverseIterator ReverseBegin() {
+                return ReverseIterator(End());
+            }
+
+            /// @brief Gets const reverse iterator to the element with the largest key
+            ConstReverseIterator ReverseBegin() const {
+                return ConstReverseIterator(End());
+            }
+
+            /// @brief Gets const reverse iterator to the element with the largest key
+            ConstReverseIterator ConstReverseBegin() const {
+                return ReverseBegin();
+            }
+
+            /// @brief Gets reverse iterator before the element with the smallest key
+            ReverseIterator ReverseEnd() {
+                return ReverseIterator(Begin());
+            }
+
+            /// @brief Gets const reverse iterator before the element with the smallest key
+            ConstReverseIterator ReverseEnd() const {
+                return ConstReverseIterator(Begin());
+            }
+
+            /// @brief Gets const reverse iterator before the element with the smallest key
+            ConstReverseIterator ConstReverseEnd() const {
+                return ReverseEnd();
+            }
+
+            /// @brief Finds an element with the given key
+            /// @param key The key to search for
+            /// @return Iterator to the element, or `End()` if not found
+            Iterator Find(const KeyType& key) {
+                return IteratorAt(FindIndex(key));
+            }
+
+            /// @brief Finds an element with the given key
+            /// @param key The key to search for
+            /// @return Const iterator to the element, or `End()` if not found
+            ConstIterator Find(const KeyType& key) const {
+                return IteratorAt(FindIndex(key));
+            }
+
+            /// @brief Checks whether an element with the given key is in the table
+            /// @param key The key to search for
+            bool Contains(const KeyType& key) const {
+                return FindIndex(key) != this->m_CurrentSize;
+            }
+
+            /// @brief Counts elements with the given key
+            /// @param key The key to search for
+            /// @return `1` if the key is in the table, otherwise `0`
+            SizeType Count(const KeyType& key) const {
+                return Contains(key) ? 1 : 0;
+            }
+
+            /// @brief Finds the first element whose key is not less than the given key
+            /// @param key The key to compare against
+            Iterator LowerBound(const KeyType& key) {
+                return IteratorAt(LowerBoundIndex(key));
+            }
+
+            /// @brief Finds the first element whose key is not less than the given key
+            /// @param key The key to compare against
+            ConstIterator LowerBound(const KeyType& key) const {
+                return IteratorAt(LowerBoundIndex(key));
+            }
+
+            /// @brief Finds the first element whose key is greater than the given key
+            /// @param key The key to compare against
+            Iterator UpperBound(const KeyType& key) {
+                return IteratorAt(UpperBoundIndex(key));
+            }
+
+            /// @brief Finds the first element whose key is greater than the given key
+            /// @param key The key to compare against
+            ConstIterator UpperBound(const KeyType& key) const {
+                return IteratorAt(UpperBoundIndex(key));
+            }
+
+            /// @brief Finds the range of elements with the given key
+            /// @param key The key to search for
+            /// @return Pair of `LowerBound(key)` and `UpperBound(key)`
+            Pair<Iterator, Iterator> EqualRange(const KeyType& key) {
+                return Pair<Iterator, Iterator>(LowerBound(key), UpperBound(key));
+            }
+
+            /// @brief Finds the range of elements with the given key
+            /// @param key The key to search for
+            /// @return Pair of `LowerBound(key)` and `UpperBound(key)`
+            Pair<ConstIterator, ConstIterator> EqualRange(const KeyType& key) const {
+                return Pair<ConstIterator, ConstIterator>(LowerBound(key), UpperBound(key));
+            }
+
+            /// @brief Inserts an element if its key is not in the table
+            /// @param value The element to insert
+            /// @return Pair of iterator to the element with the key and whether the element was inserted
+            /// @throws `LengthError` if the table is full
+            Pair<Iterator, bool> Insert(ConstReferenceType value) {
+                return PlaceAt(Prepare(Traits::GetKey(value)), value);
+            }
+
+            #ifdef __WSTL_CXX11__
+            /// @brief Inserts an element if its key is not in the table
+            /// @param value The element to insert (rvalue reference)
+            /// @return Pair of iterator to the element with the key and whether the element was inserted
+            /// @throws `LengthError` if the table is full
+            /// @since C++11
+            Pair<Iterator, bool> Insert(ValueType&& value) {
+                return PlaceAt(Prepare(Traits::GetKey(value)), value);
+            }
+            #endif
+
+            /// @brief Inserts a range of elements, skipping keys that are already in the table
+            /// @param first Iterator to the first element in the range
+            /// @param last Iterator to the element following the last element in the range
+            /// @return The number of inserted elements
+            /// @throws `LengthError` if the table cannot hold all new keys
+            /// @details The elements are appended, then sorted and merged with the table at once.
+            /// Of several elements with the same key the first one is kept. When the free slots
+            /// run out, the appended elements are merged early to drop their duplicates
+            template<typename InputIterator>
+            SizeType Insert(InputIterator first, InputIterator last) {
+                const SizeType before = this->m_CurrentSize;
+                bool overflow = false;
+
+                Order::Restore(Data(), this->m_CurrentSize);
+
+                while(first != last) {
+                    if(this->Full()) {
+                        // Only keys which are already in the table can still be skipped
+                        const ValueType value(*first);
+                        if(!SortedContains(Traits::GetKey(value))) {
+                            this->RecordFailure();
+                            overflow = true;
+                            break;
+                        }
+
+                        ++first;
+                        continue;
+                    }
+
+                    const SizeType sorted = this->m_CurrentSize;
+                    for(; first != last && !this->Full(); ++first) {
+                        ::new(RawAt(this->m_CurrentSize)) ValueType(*first);
+                        ++this->m_CurrentSize;
+                    }
+
+                    MergeTail(sorted);
+                }
+
+                Order::Build(Data(), this->m_CurrentSize);
+
+                __WSTL_ASSERT_RETURNVALUE__(!overflow, WSTL_MAKE_EXCEPTION(LengthError, "Flat table full"), this->m_CurrentSize - before);
+                return this->m_CurrentSize - before;
+            }
+
+            #if defined(__WSTL_CXX11__) && !defined(__WSTL_NO_INITIALIZERLIST__)
+            /// @brief Inserts elements from an initializer list, skipping keys that are already in the table
+            /// @param list The initializer list to insert
+            /// @return The number of inserted elements
+            /// @throws `LengthError` if the table cannot hold all new keys
+            /// @since C++11
+            SizeType Insert(InitializerList<ValueType> list) {
+                return Insert(list.Begin(), list.End());
+            }
+            #endif
+
+            /// @brief Inserts a range of elements, skipping keys that are already in the table
+            /// @param range The range to insert
+            /// @return The number of inserted elements
+            /// @throws `LengthError` if the table cannot hold all new keys
+            /// @details See `Insert(InputIterator, InputIterator)`
+            template<typename Range>
+            inline SizeType InsertRange(const Range& range) {
+                return Insert(wstl::Begin(range), wstl::End(range));
+            }
+
+            #ifdef __WSTL_CXX11__
+            /// @brief Inserts elements by moving them from a range, skipping keys that are already in the table
+            /// @param range The range to move the elements from
+            /// @return The number of inserted elements
+            /// @throws `LengthError` if the table cannot hold all new keys
+            /// @details See `Insert(InputIterator, InputIterator)`
+            /// @since C++11
+            template<typename Range>
+            inline SizeType InsertRange(Range&& range) {
+                return Insert(MakeMoveIterator(wstl::Begin(range)), MakeMoveIterator(wstl::End(range)));
+            }
+            #endif
+
+            /// @brief Erases the element with the given key
+            /// @param key The key of the element to erase
+            /// @return The number of erased elements, `0` or `1`
+            SizeType Erase(const KeyType& key) {
+                const SizeType index = FindIndex(key);
+                if(index == this->m_CurrentSize) return 0;
+
+                EraseAt(index);
+                return 1;
+            }
+
+            /// @brief Erases the element at the given position
+            /// @param position Iterator to the element to erase
+            /// @return Iterator to the element following the erased element
+            Iterator Erase(ConstIterator position) {
+                return IteratorAt(EraseAt(Order::IndexOf(static_cast<ConstPointerType>(Data()), position)));
+            }
+
+            /// @brief Erases all elements from the table
+            void Clear() {
+                Destroy(Data(), Data() + this->m_CurrentSize);
+                this->m_CurrentSize = 0;
+            }
+
+            /// @brief Gets the key comparison functor
+            KeyCompareType KeyComp() const {
+                return m_Compare;
+            }
+
+        protected:
+            /// @brief Orders elements by their keys
+            struct ValueCompare {
+                Compare Function;
+
+                explicit ValueCompare(const Compare& function) : Function(function) {}
+
+                bool operator()(ConstReferenceType a, ConstReferenceType b) const {
+                    return Function(Traits::GetKey(a), Traits::GetKey(b));
+                }
+            };
+
+            /// @brief Checks whether an element precedes a key, the predicate of a lower bound search
+            struct KeyBefore {
+                const Compare& Function;
+                const KeyType& Key;
+
+                KeyBefore(const Compare& function, const KeyType& key) : Function(function), Key(key) {}
+
+                bool operator()(ConstReferenceType value) const {
+                    return Function(Traits::GetKey(value), Key);
+                }
+            };
+
+            /// @brief Checks whether an element does not follow a key, the predicate of an upper bound search
+            struct KeyNotAfter {
+                const Compare& Function;
+                const KeyType& Key;
+
+                KeyNotAfter(const Compare& function, const KeyType& key) : Function(function), Key(key) {}
+
+                bool operator()(ConstReferenceType value) const {
+                    return !Function(Key, Traits::GetKey(value));
+                }
+            };
+
+            /// @brief Result of searching for a key to insert
+            struct Probe {
+                /// @brief Position in memory of the element with the key, valid if found
+                SizeType Index;
+                /// @brief Index in key order of the element with the key or the one it goes before
+                SizeType Rank;
+                /// @brief Whether the key is already in the table
+                bool Found;
+            };
+
+            KeyCompareType m_Compare;
+
+            /// @brief Constructor, only for default-constructible storage
+            explicit __FlatTable(const KeyCompareType& compare) : Base(), m_Compare(compare) {}
+
+            /// @brief Constructor with custom storage, only for non-default-constructible storage
+            /// @param storage Storage for the slots
+            __FlatTable(const StorageType& storage, const KeyCompareType& compare) : Base(storage), m_Compare(compare) {}
+
+            PointerType Data() {
+                return reinterpret_cast<PointerType>(this->m_Storage.Data);
+            }
+
+            ConstPointerType Data() const {
+                return reinterpret_cast<ConstPointerType>(this->m_Storage.Data);
+            }
+
+            /// @brief Gets the memory of a slot to construct an element in
+            void* RawAt(SizeType index) {
+                return static_cast<void*>(this->m_Storage.Data + index);
+            }
+
+            Iterator IteratorAt(SizeType index) {
+                return Order::MakeIterator(static_cast<IteratorValueType*>(Data()), index, this->m_CurrentSize);
+            }
+
+            ConstIterator IteratorAt(SizeType index) const {
+                return Order::MakeIterator(Data(), index, this->m_CurrentSize);
+            }
+
+            SizeType LowerBoundIndex(const KeyType& key) const {
+                return Order::Search(Data(), this->m_CurrentSize, KeyBefore(m_Compare, key));
+            }
+
+            SizeType UpperBoundIndex(const KeyType& key) const {
+                return Order::Search(Data(), this->m_CurrentSize, KeyNotAfter(m_Compare, key));
+            }
+
+            /// @brief Finds the position of a key in memory
+            /// @return Position of the element, or `Size()` if not found
+            SizeType FindIndex(const KeyType& key) const {
+                const SizeType index = LowerBoundIndex(key);
+                return index != this->m_CurrentSize && !m_Compare(key, Traits::GetKey(Data()[index])) ? index : this->Size();
+            }
+
+            Probe Prepare(const KeyType& key) const {
+                Probe result;
+                result.Index = LowerBoundIndex(key);
+                result.Found = result.Index != this->m_CurrentSize && !m_Compare(key, Traits::GetKey(Data()[result.Index]));
+                result.Rank = Order::Rank(result.Index, this->m_CurrentSize);
+                return result;
+            }
+
+            /// @brief Inserts an element where a probe for its key points, unless the key was found.
+            /// Moves from the element if it is not const
+            template<typename U>
+            Pair<Iterator, bool> PlaceAt(const Probe& probe, U& value) {
+                if(probe.Found) return Pair<Iterator, bool>(IteratorAt(probe.Index), false);
+
+                if(this->Full()) this->RecordFailure();
+                __WSTL_ASSERT_RETURNVALUE__(!this->Full(), WSTL_MAKE_EXCEPTION(LengthError, "Flat table full"), (Pair<Iterator, bool>(End(), false)));
+
+                PointerType data = Data();
+                const SizeType size = this->m_CurrentSize;
+
+                Order::Restore(data, size);
+
+                if(probe.Rank == size) ::new(RawAt(size)) ValueType(__WSTL_MOVE__(value));
+                else {
+                    ::new(RawAt(size)) ValueType(__WSTL_MOVE__(data[size - 1]));
+                    MoveBackward(data + probe.Rank, data + size - 1, data + size);
+                    data[probe.Rank] = __WSTL_MOVE__(value);
+                }
+
+                ++this->m_CurrentSize;
+                Order::Build(data, this->m_CurrentSize);
+
+                return Pair<Iterator, bool>(IteratorAt(Order::Position(probe.Rank, this->m_CurrentSize)), true);
+            }
+
+            /// @brief Erases the element at a position in memory
+            /// @return Position in memory of the element following the erased one
+            SizeType EraseAt(SizeType index) {
+                PointerType data = Data();
+                const SizeType rank = Order::Rank(index, this->m_CurrentSize);
+
+                Order::Restore(data, this->m_CurrentSize);
+
+                Move(data + rank + 1, data + this->m_CurrentSize, data + rank);
+                data[--this->m_CurrentSize].~ValueType();
+
+                Order::Build(data, this->m_CurrentSize);
+                return Order::Position(rank, this->m_CurrentSize);
+            }
+
+        private:
+            /// @brief Checks whether a key is in the table while it is in sorted order
+            bool SortedContains(const KeyType& key) const {
+                const SizeType index = __FlatOrder<FlatLayout::Sorted>::Search(Data(), this->m_CurrentSize, KeyBefore(m_Compare, key));
+                return index != this->m_CurrentSize && !m_Compare(key, Traits::GetKey(Data()[index]));
+            }
+
+            /// @brief Sorts the elements from a position on and merges them into the sorted elements before it
+            void MergeTail(SizeType sorted) {
+                const ValueCompare compare(m_Compare);
+                PointerType first = Data();
+                PointerType middle = first + sorted;
+                PointerType last = first + this->m_CurrentSize;
+
+                if(middle == last) return;
+
+                StableSort(middle, last, compare);
+
+                // The merge keeps elements of the first run before equal ones of the second
+                if(middle != first && compare(*middle, *(middle - 1))) __MergeWithoutBuffer(first, middle, last, compare);
+
+                PointerType end = Unique(first, last, Equivalent(m_Compare));
+                Destroy(end, last);
+                this->m_CurrentSize = static_cast<SizeType>(end - first);
+            }
+
+            /// @brief Checks whether adjacent sorted elements have the same key
+            struct Equivalent {
+                Compare Function;
+
+                explicit Equivalent(const Compare& function) : Function(function) {}
+
+                bool operator()(ConstReferenceType a, ConstReferenceType b) const {
+                    return !Function(Traits::GetKey(a), Traits::GetKey(b));
+                }
+            };
+
+            static void Destroy(PointerType first, PointerType last) {
+                for(; first != last; ++first) first->~ValueType();
+            }
+
+            /// @brief Deleted copy constructor, derived classes copy the elements
+            __FlatTable(const __FlatTable&) __WSTL_DELETE__;
+
+            /// @brief Deleted copy assignment operator, derived classes copy the elements
+            __FlatTable& operator=(const __FlatTable&) __WSTL_DELETE__;
+        };
+
+        template<typename Traits, typename Storage, typename Compare, FlatLayout Layout>
+        const __WSTL_CONSTEXPR__ FlatLayout __FlatTable<Traits, Storage, Compare, Layout>::LayoutType;
+    }
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,721 @@
+// Part of WardenSTL - https://github.com/WardenHD/WardenSTL
+// Copyright (c) 2025 Artem Bezruchko (WardenHD)
+//
+// Licensed under the MIT License. See LICENSE file for details.
+
+#ifndef __WSTL_PRIVATE_HASHTABLE_HPP__
+#define __WSTL_PRIVATE_HASHTABLE_HPP__
+
+#include "Platform.hpp"
+#include "Error.hpp"
+#include "../Container.hpp"
+#include "../Iterator.hpp"
+#include "../Utility.hpp"
+#include "../PlacementNew.hpp"
+#include "../StandardExceptions.hpp"
+#include "../Bit.hpp"
+#include <stddef.h>
+#include <stdint.h>
+
+// Defines introduced
+
+/// @def __WSTL_HASH_NO_SIMD__
+/// @brief If defined, hash tables probe control bytes with portable word operations instead of SSE2 or NEON
+/// @ingroup containers
+#ifdef __DOXYGEN__
+    #define __WSTL_HASH_NO_SIMD__
+#endif
+
+#ifndef __WSTL_HASH_NO_SIMD__
+    #if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+        #define __WSTL_HASH_SSE2__
+        #include <emmintrin.h>
+    #elif (defined(__ARM_NEON) || defined(__ARM_NEON__)) && __WSTL_NATIVE_ENDIAN__ == __WSTL_LITTLE_ENDIAN__
+        #define __WSTL_HASH_NEON__
+        #include <arm_neon.h>
+    #endif
+#endif
+
+
+namespace wstl {
+    namespace __private {
+        /// @brief Control byte of a slot that has never held an element, ends every probe
+        static const __WSTL_CONSTEXPR__ uint8_t __HASH_EMPTY = 0x80;
+
+        /// @brief Control byte of a slot whose element was erased, probes continue past it
+        static const __WSTL_CONSTEXPR__ uint8_t __HASH_DELETED = 0xFE;
+
+        /// @brief Control byte past the end of a small table, never matches and never ends a probe
+        static const __WSTL_CONSTEXPR__ uint8_t __HASH_SENTINEL = 0xFF;
+
+        /// @brief Set of positions in a group of control bytes
+        /// @tparam Word Type of the bit mask
+        /// @tparam Shift Log2 of the number of mask bits per position
+        template<typename Word, size_t Shift>
+        struct __HashMask {
+            Word Bits;
+
+            explicit __HashMask(Word bits) : Bits(bits) {}
+
+            bool Any() const {
+                return Bits != 0;
+            }
+
+            /// @brief Gets the lowest position in the set
+            size_t Lowest() const {
+                return static_cast<size_t>(CountRightZero(Bits)) >> Shift;
+            }
+
+            /// @brief Removes the lowest position from the set
+            void Next() {
+                Bits &= Bits - 1;
+            }
+        };
+
+        #if defined(__WSTL_HASH_SSE2__)
+        /// @brief Group of 16 control bytes compared at once with SSE2
+        struct __HashGroup {
+            typedef __HashMask<uint32_t, 0> Mask;
+
+            static const __WSTL_CONSTEXPR__ size_t Width = 16;
+
+            explicit __HashGroup(const uint8_t* control) : m_Control(_mm_loadu_si128(reinterpret_cast<const __m128i*>(control))) {}
+
+            Mask Match(uint8_t tag) const {
+                return Mask(static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(static_cast<char>(tag)), m_Control))));
+            }
+
+            Mask MatchEmpty() const {
+                return Match(__HASH_EMPTY);
+            }
+
+            /// @brief Matches empty and deleted bytes, which are below the sentinel as signed values
+            Mask MatchAvailable() const {
+                return Mask(static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(static_cast<char>(__HASH_SENTINEL)), m_Control))));
+            }
+
+        private:
+            __m128i m_Control;
+        };
+
+        #elif defined(__WSTL_HASH_NEON__)
+        /// @brief Group of 8 control bytes compared at once with NEON
+        /// @details Comparisons give 0xFF per matching byte, the top bit of each is kept as the mask
+        struct __HashGroup {
+            typedef __HashMask<uint64_t, 3> Mask;
+
+            static const __WSTL_CONSTEXPR__ size_t Width = 8;
+
+            explicit __HashGroup(const uint8_t* control) : m_Control(vld1_u8(control)) {}
+
+            Mask Match(uint8_t tag) const {
+                return ToMask(vceq_u8(m_Control, vdup_n_u8(tag)));
+            }
+
+            Mask MatchEmpty() const {
+                return Match(__HASH_EMPTY);
+            }
+
+            /// @brief Matches empty and deleted bytes, which are below the sentinel as signed values
+            Mask MatchAvailable() const {
+                return ToMask(vclt_s8(vreinterpret_s8_u8(m_Control), vdup_n_s8(static_cast<int8_t>(__HASH_SENTINEL))));
+            }
+
+        private:
+            uint8x8_t m_Control;
+
+            static Mask ToMask(uint8x8_t bytes) {
+                return Mask(vget_lane_u64(vreinterpret_u64_u8(bytes), 0) & 0x8080808080808080ULL);
+            }
+        };
+
+        #else
+        /// @brief Group of control bytes compared at once in a native word
+        /// @details A mask has the top bit of each matching byte set. `Match` may also report a full
+        /// byte right after a real match, which costs one key comparison and is never wrong
+        struct __HashGroup {
+            typedef Conditional<sizeof(size_t) >= sizeof(uint64_t), uint64_t, uint32_t>::Type WordType;
+            typedef __HashMask<WordType, 3> Mask;
+
+            static const __WSTL_CONSTEXPR__ size_t Width = sizeof(WordType);
+
+            explicit __HashGroup(const uint8_t* control) : m_Control(0) {
+                // Little-endian order whatever the target, compilers turn this into one load
+                for(size_t i = 0; i < Width; ++i) m_Control |= static_cast<WordType>(control[i]) << (i * 8);
+            }
+
+            Mask Match(uint8_t tag) const {
+                const WordType x = m_Control ^ (LOW_BITS * tag);
+                return Mask((x - LOW_BITS) & ~x & HIGH_BITS);
+            }
+
+            /// @brief Matches bytes with the top bit set and bit 1 cleared
+            Mask MatchEmpty() const {
+                return Mask(m_Control & ~(m_Control << 6) & HIGH_BITS);
+            }
+
+            /// @brief Matches bytes with the top bit set and bit 0 cleared
+            Mask MatchAvailable() const {
+                return Mask(m_Control & ~(m_Control << 7) & HIGH_BITS);
+            }
+
+        private:
+            static const WordType LOW_BITS = static_cast<WordType>(0x0101010101010101ULL);
+            static const WordType HIGH_BITS = static_cast<WordType>(0x8080808080808080ULL);
+
+            WordType m_Control;
+        };
+        #endif
+
+        /// @brief Uninitialized memory for one element of a hash table
+        template<typename T>
+        struct __HashSlot {
+            typename AlignedStorage<sizeof(T), AlignmentOf<T>::Value>::Type Buffer;
+        };
+
+        /// @brief Control bytes of a fixed hash table, a base class so they exist before the table
+        template<size_t N>
+        struct __HashControl {
+            uint8_t Control[N + __HashGroup::Width - 1];
+        };
+
+        /// @brief Scrambles a hash, so that identity hashes of integers spread over the whole table
+        /// @details The upper bits pick the slot and the lower 7 bits become the control byte
+        inline uint32_t __HashMix(size_t hash) {
+            if __WSTL_IF_CONSTEXPR__(sizeof(size_t) >= sizeof(uint64_t))
+                return static_cast<uint32_t>((static_cast<uint64_t>(hash) * 0x9E3779B97F4A7C15ULL) >> 32);
+            else {
+                const uint32_t product = static_cast<uint32_t>(hash) * 0x9E3779B9U;
+                return product ^ (product >> 16);
+            }
+        }
+
+        template<typename T>
+        char __TransparentTest(typename T::IsTransparent*);
+
+        template<typename T>
+        long __TransparentTest(...);
+
+        /// @brief Checks whether a functor defines `IsTransparent`, so it accepts other types than the key
+        template<typename T>
+        struct __IsTransparent : BoolConstant<sizeof(__TransparentTest<T>(0)) == sizeof(char)> {};
+
+        /// @brief Enables a lookup by a value of type `K` if both functors are transparent
+        template<typename Hasher, typename KeyEqual, typename K, typename R>
+        struct __EnableIfTransparent : EnableIf<__IsTransparent<Hasher>::Value && __IsTransparent<KeyEqual>::Value, R> {};
+
+        /// @brief Key extraction for hash maps
+        template<typename Key, typename T>
+        struct __HashMapTraits {
+            typedef Key KeyType;
+            typedef Pair<const Key, T> ValueType;
+
+            static const KeyType& GetKey(const ValueType& value) {
+                return value.First;
+            }
+        };
+
+        /// @brief Key extraction for hash sets
+        template<typename Key>
+        struct __HashSetTraits {
+            typedef Key KeyType;
+            typedef const Key ValueType;
+
+            static const KeyType& GetKey(const KeyType& value) {
+                return value;
+            }
+        };
+
+        /// @brief Open-addressing hash table shared by `BasicHashMap` and `BasicHashSet`
+        /// @tparam Traits Key extraction, `__HashMapTraits` or `__HashSetTraits`
+        /// @tparam Storage Storage of `__HashSlot`s
+        /// @tparam Hasher Hash functor for the keys
+        /// @tparam KeyEqual Equality functor for the keys
+        /// @details Every slot has a control byte in a separate array: `__HASH_EMPTY`, `__HASH_DELETED`
+        /// or 7 bits of the hash of the element. Probing loads a whole `__HashGroup` of control bytes
+        /// and compares all of them with the 7 bits at once, then compares keys only where they match,
+        /// so a lookup usually costs one group comparison whatever the probe length. The first
+        /// `ControlPadding` control bytes are repeated after the last one, so a group starting
+        /// near the end reads the start of the table without wrapping
+        template<typename Traits, typename Storage, typename Hasher, typename KeyEqual>
+        class __HashTable : public TypedContainerBase<Storage, typename Traits::ValueType> {
+        private:
+            typedef TypedContainerBase<Storage, typename Traits::ValueType> Base;
+
+        public:
+            typedef typename Traits::KeyType KeyType;
+            typedef typename Base::ValueType ValueType;
+            typedef typename Base::SizeType SizeType;
+            typedef typename Base::DifferenceType DifferenceType;
+            typedef typename Base::ReferenceType ReferenceType;
+            typedef typename Base::ConstReferenceType ConstReferenceType;
+            typedef typename Base::PointerType PointerType;
+            typedef typename Base::ConstPointerType ConstPointerType;
+
+            typedef typename Base::StorageType StorageType;
+            typedef typename Storage::ValueType SlotType;
+
+            typedef Hasher HasherType;
+            typedef KeyEqual KeyEqualType;
+
+            /// @brief Number of control bytes needed past the capacity
+            static const __WSTL_CONSTEXPR__ SizeType ControlPadding = __HashGroup::Width - 1;
+
+        private:
+            template<bool IsConst>
+            class HashTableIterator {
+            public:
+                typedef typename Conditional<IsConst, const typename __HashTable::ValueType, typename __HashTable::ValueType>::Type ValueType;
+                typedef ForwardIteratorTag IteratorCategory;
+                typedef ValueType& ReferenceType;
+                typedef ValueType* PointerType;
+                typedef ptrdiff_t DifferenceType;
+
+                friend class __HashTable;
+
+                HashTableIterator() : m_Control(NullPointer), m_End(NullPointer), m_Slot(NullPointer) {}
+
+                HashTableIterator(const HashTableIterator<false>& other) : m_Control(other.m_Control), m_End(other.m_End), m_Slot(other.m_Slot) {}
+
+                HashTableIterator& operator=(const HashTableIterator& other) {
+                    m_Control = other.m_Control;
+                    m_End = other.m_End;
+                    m_Slot = other.m_Slot;
+                    return *this;
+                }
+
+                ReferenceType operator*() const {
+                    return *reinterpret_cast<PointerType>(m_Slot);
+                }
+
+                PointerType operator->() const {
+                    return reinterpret_cast<PointerType>(m_Slot);
+                }
+
+                HashTableIterator& operator++() {
+                    ++m_Control;
+                    ++m_Slot;
+                    SkipFree();
+                    return *this;
+                }
+
+                HashTableIterator operator++(int) {
+                    HashTableIterator original(*this);
+                    ++(*this);
+                    return original;
+                }
+
+                friend bool operator==(const HashTableIterator& a, const HashTableIterator& b) {
+                    return a.m_Control == b.m_Control;
+                }
+
+                friend bool operator!=(const HashTableIterator& a, const HashTableIterator& b) {
+                    return !(a == b);
+                }
+
+            private:
+                typedef typename Conditional<IsConst, const SlotType*, SlotType*>::Type SlotPointerType;
+
+                friend class HashTableIterator<true>;
+
+                const uint8_t* m_Control;
+                const uint8_t* m_End;
+                SlotPointerType m_Slot;
+
+                HashTableIterator(const uint8_t* control, const uint8_t* end, SlotPointerType slot) : m_Control(control), m_End(end), m_Slot(slot) {
+                    SkipFree();
+                }
+
+                void SkipFree() {
+                    while(m_Control != m_End && !IsFull(*m_Control)) {
+                        ++m_Control;
+                        ++m_Slot;
+                    }
+                }
+            };
+
+        public:
+            typedef HashTableIterator<false> Iterator;
+            typedef HashTableIterator<true> ConstIterator;
+
+            /// @brief Destructor
+            ~__HashTable() {
+                Clear();
+            }
+
+            /// @brief Gets iterator to the beginning of the table
+            Iterator Begin() {
+                return Iterator(m_Control, m_Control + this->Capacity(), this->m_Storage.Data);
+            }
+
+            /// @brief Gets const iterator to the beginning of the table
+            ConstIterator Begin() const {
+                return ConstIterator(m_Control, m_Control + this->Capacity(), this->m_Storage.Data);
+            }
+
+            /// @brief Gets const iterator to the beginning of the table
+            ConstIterator ConstBegin() const {
+                return Begin();
+            }
+
+            /// @brief Gets iterator to the end of the table
+            Iterator End() {
+                return Iterator(m_Control + this->Capacity(), m_Control + this->Capacity(), this->m_Storage.Data + this->Capacity());
+            }
+
+            /// @brief Gets const iterator to the end of the table
+            ConstIterator End() const {
+                return ConstIterator(m_Control + this->Capacity(), m_Control + this->Capacity(), this->m_Storage.Data + this->Capacity());
+            }
+
+            /// @brief Gets const iterator to the end of the table
+            ConstIterator ConstEnd() const {
+                return End();
+            }
+
+            /// @brief Finds an element with the given key
+            /// @param key The key to search for
+            /// @return Iterator to the element, or `End()` if not found
+            Iterator Find(const KeyType& key) {
+                const SizeType index = FindIndex(key);
+                return index == NoIndex() ? End() : IteratorAt(index);
+            }
+
+            /// @brief Finds an element with the given key
+            /// @param key The key to search for
+            /// @return Const iterator to the element, or `End()` if not found
+            ConstIterator Find(const KeyType& key) const {
+                const SizeType index = FindIndex(key);
+                return index == NoIndex() ? End() : IteratorAt(index);
+            }
+
+            /// @brief Checks whether an element with the given key is in the table
+            /// @param key The key to search for
+            bool Contains(const KeyType& key) const {
+                return FindIndex(key) != NoIndex();
+            }
+
+            /// @brief Finds an element with a key equivalent to a value of another type
+            /// @tparam K Type of the value
+            /// @param key The value to search for
+            /// @return Iterator to the element, or `End()` if not found
+            /// @details Only available if both `Hasher` and `KeyEqual` define `IsTransparent`, they are
+            /// called with the value itself instead of a key made from it
+            template<typename K>
+            typename __EnableIfTransparent<Hasher, KeyEqual, K, Iterator>::Type Find(const K& key) {
+                const SizeType index = FindIndex(key);
+                return index == NoIndex() ? End() : IteratorAt(index);
+            }
+
+            /// @brief Finds an element with a key equivalent to a value of another type
+            /// @tparam K Type of the value
+            /// @param key The value to search for
+            /// @return Const iterator to the element, or `End()` if not found
+            /// @details Only available if both `Hasher` and `KeyEqual` define `IsTransparent`, they are
+            /// called with the value itself instead of a key made from it
+            template<typename K>
+            typename __EnableIfTransparent<Hasher, KeyEqual, K, ConstIterator>::Type Find(const K& key) const {
+                const SizeType index = FindIndex(key);
+                return index == NoIndex() ? End() : IteratorAt(index);
+            }
+
+            /// @brief Checks whether an element with a key equivalent to a value of another type is in the table
+            /// @tparam K Type of the value
+            /// @param key The value to search for
+            /// @details Only available if both `Hasher` and `KeyEqual` define `IsTransparent`
+            template<typename K>
+            typename __EnableIfTransparent<Hasher, KeyEqual, K, bool>::Type Contains(const K& key) const {
+                return FindIndex(key) != NoIndex();
+            }
+
+            /// @brief Counts elements with the given key
+            /// @param key The key to search for
+            /// @return `1` if the key is in the table, otherwise `0`
+            SizeType Count(const KeyType& key) const {
+                return Contains(key) ? 1 : 0;
+            }
+
+            /// @brief Erases the element with the given key
+            /// @param key The key of the element to erase
+            /// @return The number of erased elements, `0` or `1`
+            SizeType Erase(const KeyType& key) {
+                const SizeType index = FindIndex(key);
+                if(index == NoIndex()) return 0;
+
+                EraseAt(index);
+                return 1;
+            }
+
+            /// @brief Erases the element at the given position
+            /// @param position Iterator to the element to erase
+            /// @return Iterator to the element following the erased element
+            Iterator Erase(ConstIterator position) {
+                const SizeType index = static_cast<SizeType>(position.m_Control - m_Control);
+                EraseAt(index);
+
+                Iterator result(m_Control + index, m_Control + this->Capacity(), this->m_Storage.Data + index);
+                result.SkipFree();
+                return result;
+            }
+
+            /// @brief Erases all elements from the table
+            void Clear() {
+                DestroyAll<ValueType>();
+
+                Initialize();
+                this->m_CurrentSize = 0;
+            }
+
+            /// @brief Gets the hash functor
+            HasherType HashFunction() const {
+                return m_Hasher;
+            }
+
+            /// @brief Gets the key equality functor
+            KeyEqualType KeyEq() const {
+                return m_Equal;
+            }
+
+            /// @brief Gets the ratio of elements to slots
+            float LoadFactor() const {
+                return this->Capacity() == 0 ? 0.0F : static_cast<float>(this->m_CurrentSize) / static_cast<float>(this->Capacity());
+            }
+
+            #ifdef __WSTL_INSTRUMENTATION__
+            /// @brief Gets the histogram of groups probed per lookup and insertion
+            /// @note Requires `__WSTL_INSTRUMENTATION__` to be defined
+            const ProbeHistogram& ProbeLengths() const {
+                return m_Probes;
+            }
+
+            /// @brief Zeroes the probe length histogram
+            /// @note Requires `__WSTL_INSTRUMENTATION__` to be defined
+            void ResetProbeLengths() {
+                m_Probes.Reset();
+            }
+            #endif
+
+        protected:
+            /// @brief Result of probing for a key to insert
+            struct Probe {
+                /// @brief Slot that holds the key or that the key goes to, `NoIndex()` if the table is full
+                SizeType Index;
+                /// @brief Control byte for the key
+                uint8_t Tag;
+                /// @brief Whether the key is already in the table
+                bool Found;
+            };
+
+            uint8_t* m_Control;
+            HasherType m_Hasher;
+            KeyEqualType m_Equal;
+            #ifdef __WSTL_INSTRUMENTATION__
+            mutable ProbeHistogram m_Probes;
+            #endif
+
+            /// @brief Constructor, only for default-constructible storage
+            /// @param control Control bytes, one per slot
+            __HashTable(uint8_t* control, const HasherType& hasher, const KeyEqualType& equal) : Base(), m_Control(control), m_Hasher(hasher), m_Equal(equal) {
+                Initialize();
+            }
+
+            /// @brief Constructor with custom storage, only for non-default-constructible storage
+            /// @param storage Storage for the slots
+            /// @param control Control bytes, one per slot
+            __HashTable(const StorageType& storage, uint8_t* control, const HasherType& hasher, const KeyEqualType& equal) : Base(storage), m_Control(control), m_Hasher(hasher), m_Equal(equal) {
+                Initialize();
+            }
+
+            /// @brief Records the number of groups a probe visited, does nothing without `__WSTL_INSTRUMENTATION__`
+            void RecordProbe(SizeType groups) const {
+                #ifdef __WSTL_INSTRUMENTATION__
+                if(groups != 0) m_Probes.Record(groups);
+                #else
+                (void) groups;
+                #endif
+            }
+
+            /// @brief Index past the last slot, returned when no slot is found
+            SizeType NoIndex() const {
+                return this->Capacity();
+            }
+
+            PointerType SlotAt(SizeType index) {
+                return reinterpret_cast<PointerType>(this->m_Storage.Data + index);
+            }
+
+            ConstPointerType SlotAt(SizeType index) const {
+                return reinterpret_cast<ConstPointerType>(this->m_Storage.Data + index);
+            }
+
+            /// @brief Gets the memory of a slot to construct an element in
+            void* RawAt(SizeType index) {
+                return static_cast<void*>(this->m_Storage.Data + index);
+            }
+
+            Iterator IteratorAt(SizeType index) {
+                return Iterator(m_Control + index, m_Control + this->Capacity(), this->m_Storage.Data + index);
+            }
+
+            ConstIterator IteratorAt(SizeType index) const {
+                return ConstIterator(m_Control + index, m_Control + this->Capacity(), this->m_Storage.Data + index);
+            }
+
+            /// @brief Finds the slot of a key, or of a value that `Hasher` and `KeyEqual` accept in place of a key
+            /// @return Index of the slot, or `NoIndex()` if not found
+            template<typename K>
+            SizeType FindIndex(const K& key) const {
+                const SizeType capacity = this->Capacity();
+                if(this->m_CurrentSize == 0) return NoIndex();
+
+                uint8_t tag;
+                SizeType position = Home(key, tag);
+
+                SizeType groups = 0;
+                for(SizeType probed = 0; probed < capacity; probed += __HashGroup::Width) {
+                    const __HashGroup group(m_Control + position);
+                    ++groups;
+
+                    for(typename __HashGroup::Mask match = group.Match(tag); match.Any(); match.Next()) {
+                        const SizeType index = Wrap(position + match.Lowest());
+
+                        if(m_Equal(Traits::GetKey(*SlotAt(index)), key)) {
+                            RecordProbe(groups);
+                            return index;
+                        }
+                    }
+
+                    if(group.MatchEmpty().Any()) break;
+                    position = Wrap(position + __HashGroup::Width);
+                }
+
+                RecordProbe(groups);
+                return NoIndex();
+            }
+
+            /// @brief Finds the slot of a key, or the slot to insert it into
+            /// @throws `LengthError` if the key is not in the table and the table is full
+            Probe Prepare(const KeyType& key) {
+                const SizeType capacity = this->Capacity();
+
+                Probe result;
+                result.Found = false;
+                result.Index = NoIndex();
+
+                SizeType position = Home(key, result.Tag);
+
+                SizeType groups = 0;
+                for(SizeType probed = 0; probed < capacity; probed += __HashGroup::Width) {
+                    const __HashGroup group(m_Control + position);
+                    ++groups;
+
+                    for(typename __HashGroup::Mask match = group.Match(result.Tag); match.Any(); match.Next()) {
+                        const SizeType index = Wrap(position + match.Lowest());
+
+                        if(m_Equal(Traits::GetKey(*SlotAt(index)), key)) {
+                            RecordProbe(groups);
+                            result.Index = index;
+                            result.Found = true;
+                            return result;
+                        }
+                    }
+
+                    // The first free slot is reused, but the key may still be further on
+                    if(result.Index == NoIndex()) {
+                        const typename __HashGroup::Mask available = group.MatchAvailable();
+                        if(available.Any()) result.Index = Wrap(position + available.Lowest());
+                    }
+
+                    if(group.MatchEmpty().Any()) break;
+                    position = Wrap(position + __HashGroup::Width);
+                }
+
+                RecordProbe(groups);
+                if(result.Index == NoIndex()) this->RecordFailure();
+
+                __WSTL_ASSERT_RETURNVALUE__(result.Index != NoIndex(), WSTL_MAKE_EXCEPTION(LengthError, "Hash table full"), result);
+                return result;
+            }
+
+            /// @brief Marks a prepared slot as holding an element, after the element was constructed in it
+            void Commit(const Probe& probe) {
+                SetControl(probe.Index, probe.Tag);
+                ++this->m_CurrentSize;
+            }
+
+            /// @brief Destroys the element in a slot and frees the slot
+            void EraseAt(SizeType index) {
+                SlotAt(index)->~ValueType();
+
+                // A probe that reaches the next slot stops there anyway if it is empty
+                const SizeType next = index + 1 == this->Capacity() ? 0 : index + 1;
+                SetControl(index, m_Control[next] == __HASH_EMPTY ? __HASH_EMPTY : __HASH_DELETED);
+                --this->m_CurrentSize;
+            }
+
+            /// @brief Inserts copies of the elements of another table, which has no duplicate keys
+            template<typename InputIterator>
+            void InsertUnique(InputIterator first, InputIterator last) {
+                for(; first != last; ++first) {
+                    const Probe probe = Prepare(Traits::GetKey(*first));
+                    if(probe.Index == NoIndex()) return;
+
+                    ::new(RawAt(probe.Index)) typename RemoveConst<ValueType>::Type(*first);
+                    Commit(probe);
+                }
+            }
+
+        private:
+            static bool IsFull(uint8_t control) {
+                return (control & 0x80) == 0;
+            }
+
+            /// @brief Gets the first slot to probe for a key and its control byte
+            template<typename K>
+            SizeType Home(const K& key, uint8_t& tag) const {
+                const uint32_t hash = __HashMix(m_Hasher(key));
+                tag = static_cast<uint8_t>(hash & 0x7F);
+
+                // Maps the hash onto the capacity with a multiplication instead of a division
+                return static_cast<SizeType>((static_cast<uint64_t>(hash) * this->Capacity()) >> 32);
+            }
+
+            /// @brief Maps a position of a group, which may lie in the repeated bytes, to a slot
+            SizeType Wrap(SizeType position) const {
+                return position >= this->Capacity() ? position - this->Capacity() : position;
+            }
+
+            /// @brief Sets the control byte of a slot and its copy past the end
+            void SetControl(SizeType index, uint8_t control) {
+                m_Control[index] = control;
+                if(index < ControlPadding) m_Control[this->Capacity() + index] = control;
+            }
+
+            void Initialize() {
+                const SizeType capacity = this->Capacity();
+
+                for(SizeType i = 0; i < capacity; ++i) m_Control[i] = __HASH_EMPTY;
+                for(SizeType i = 0; i < ControlPadding; ++i) m_Control[capacity + i] = i < capacity ? __HASH_EMPTY : __HASH_SENTINEL;
+            }
+
+            template<typename U>
+            typename EnableIf<IsTriviallyDestructible<U>::Value, void>::Type DestroyAll() {}
+
+            template<typename U>
+            typename EnableIf<!IsTriviallyDestructible<U>::Value, void>::Type DestroyAll() {
+                for(SizeType i = 0; i < this->Capacity(); ++i) if(IsFull(m_Control[i])) SlotAt(i)->~ValueType();
+            }
+
+            /// @brief Deleted copy constructor, derived classes copy the elements
+            __HashTable(const __HashTable&) __WSTL_DELETE__;
+
+            /// @brief Deleted copy assignment operator, derived classes copy the elements
+            __HashTable& operator=(const __HashTable&) __WSTL_DELETE__;
+        };
+
+        template<typename Traits, typename Storage, typename Hasher, typename KeyEqual>
+        const __WSTL_CONSTEXPR__ typename __HashTable<Traits, Storage, Hasher, KeyEqual>::SizeType __HashTable<Traits, Storage, Hasher, KeyEqual>::ControlPadding;
+    }
+}
+
+#endif
\ No newline at end of file
@@ -64,9 +64,9 @@ namespace wstl {
     /// @ingroup string
     namespace string {}
 
-    // /// @brief Namespace that holds variations of CRC functions
-    // /// @ingroup crc
-    // namespace crc {}
+    /// @brief Namespace that holds variations of CRC functions
+    /// @ingroup crc
+    namespace crc {}
 
     /// @brief Namespace that holds containers that use externally defined storage
     /// @ingroup containers
@@ -133,6 +133,7 @@ namespace wstl {
     #define __WSTL_ENUM_CLASS__(name) enum class name
     #define __WSTL_ENUM_CLASS_TYPE__(name, type) enum class name : type
     #define __WSTL_NORETURN__ [[noreturn]]
+    #define __WSTL_ALIGNAS__(alignment) alignas(alignment)
 
     #if defined(__WSTL_EXCEPTIONS__)
         #define __WSTL_NOEXCEPT__ noexcept
@@ -150,6 +151,12 @@ namespace wstl {
         #define __WSTL_NORETURN__
     #endif
 
+    #if defined(__WSTL_GCC__) || defined(__WSTL_CLANG__) || defined(__WSTL_ICC__)
+        #define __WSTL_ALIGNAS__(alignment) __attribute__((__aligned__(alignment)))
+    #else
+        #define __WSTL_ALIGNAS__(alignment)
+    #endif
+
     #if defined(__WSTL_EXCEPTIONS__)
         #define __WSTL_NOEXCEPT__ throw()
     #else
@@ -238,6 +245,126 @@ namespace wstl {
     #define __WSTL_EXPLICIT_EXPR__(...) explicit
 #endif
 
+// Constant evaluation detection
+
+#if defined(__has_builtin)
+    #if __has_builtin(__builtin_is_constant_evaluated)
+        #define __WSTL_HAS_IS_CONSTANT_EVALUATED__
+    #endif
+#endif
+
+#if !defined(__WSTL_HAS_IS_CONSTANT_EVALUATED__) && \
+    ((defined(__WSTL_GCC__) && __GNUC__ >= 9) || (defined(__WSTL_MSVC__) && _MSC_VER >= 1925))
+    #define __WSTL_HAS_IS_CONSTANT_EVALUATED__
+#endif
+
+// Evaluates to true inside constant evaluation, runtime-only code paths (like calls 
+// to libc) check it. If it cannot be detected and C++14 constexpr functions exist, 
+// it conservatively evaluates to true. Before C++14 the functions that check it are 
+// never constexpr, so it is always false
+#if defined(__WSTL_HAS_IS_CONSTANT_EVALUATED__) && defined(__WSTL_CXX14__)
+    #define __WSTL_IS_CONSTANT_EVALUATED__() __builtin_is_constant_evaluated()
+#elif defined(__WSTL_CXX14__)
+    #define __WSTL_IS_CONSTANT_EVALUATED__() true
+#else
+    #define __WSTL_IS_CONSTANT_EVALUATED__() false
+#endif
+
+// SIMD defines
+
+#ifdef __DOXYGEN__
+    /// @def __WSTL_USE_SIMD__
+    /// @brief If defined, enables SSE2, AVX2, NEON or Helium code paths when the target supports them
+    #define __WSTL_USE_SIMD__
+#endif
+
+#ifdef __WSTL_USE_SIMD__
+    #if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+        #define __WSTL_SSE2__
+        #ifdef __AVX2__
+            #define __WSTL_AVX2__
+        #endif
+    #elif (defined(__ARM_NEON) || defined(__ARM_NEON__)) && (defined(__aarch64__) || defined(_M_ARM64))
+        #define __WSTL_NEON__
+    #elif defined(__ARM_FEATURE_MVE)
+        // Bit 0 is integer MVE, bit 1 adds floating point
+        #define __WSTL_HELIUM__
+        #if __ARM_FEATURE_MVE & 2
+            #define __WSTL_HELIUM_FLOAT__
+        #endif
+    #endif
+#endif
+
+// DSP defines
+
+/// @def __WSTL_ARM_DSP__
+/// @brief Defined when the target has the saturating instructions of the ARM DSP extension,
+/// such as `QADD` and `SSAT`, and they can be reached through the ACLE intrinsics
+#if (defined(__WSTL_GCC__) || defined(__WSTL_CLANG__)) && defined(__ARM_FEATURE_DSP) && defined(__ARM_FEATURE_SAT)
+    #define __WSTL_ARM_DSP__
+#endif
+
+// Parallel defines
+
+#ifdef __DOXYGEN__
+    /// @def __WSTL_NO_PARALLEL__
+    /// @brief If defined, parallel execution policies run sequentially in hosted builds too
+    #define __WSTL_NO_PARALLEL__
+#endif
+
+// Parallel algorithms need threads, which only hosted environments have
+#if defined(__WSTL_CXX11__) && defined(__STDC_HOSTED__) && __STDC_HOSTED__ && !defined(__WSTL_NO_PARALLEL__)
+    #define __WSTL_PARALLEL__
+#endif
+
+// Prefetch defines
+
+/// @def __WSTL_PREFETCH__(address)
+/// @brief Hints the processor to load the cache line holding the address for reading,
+/// does nothing on compilers without a prefetch builtin. The address does not have to be valid
+#if defined(__WSTL_GCC__) || defined(__WSTL_CLANG__)
+    #define __WSTL_PREFETCH__(address) __builtin_prefetch(address)
+#else
+    #define __WSTL_PREFETCH__(address) ((void)0)
+#endif
+
+// Sanitizer defines
+
+#if defined(__SANITIZE_ADDRESS__)
+    #define __WSTL_ADDRESS_SANITIZER__
+#elif defined(__has_feature)
+    #if __has_feature(address_sanitizer)
+        #define __WSTL_ADDRESS_SANITIZER__
+    #endif
+#endif
+
+/// @def __WSTL_NO_SANITIZE_ADDRESS__
+/// @brief Excludes a function from AddressSanitizer checks. Used on functions that read whole
+/// aligned blocks past the end of an object, which cannot fault but are reported as overflows
+#if defined(__WSTL_ADDRESS_SANITIZER__) && (defined(__WSTL_GCC__) || defined(__WSTL_CLANG__))
+    #define __WSTL_NO_SANITIZE_ADDRESS__ __attribute__((no_sanitize_address))
+#else
+    #define __WSTL_NO_SANITIZE_ADDRESS__
+#endif
+
+// Atomic defines
+
+#ifdef __DOXYGEN__
+    /// @def __WSTL_ATOMIC_CRITICAL_SECTION__
+    /// @brief If defined, atomics never use compiler builtins and always go through `AtomicCriticalSection`.
+    /// It is defined automatically for ARMv6-M, which has no exclusive access instructions
+    #define __WSTL_ATOMIC_CRITICAL_SECTION__
+#endif
+
+#if !defined(__WSTL_ATOMIC_CRITICAL_SECTION__) && defined(__ARM_ARCH_6M__)
+    #define __WSTL_ATOMIC_CRITICAL_SECTION__
+#endif
+
+// GCC 4.7+ and Clang provide the __atomic builtins and announce them with the memory order macros
+#if !defined(__WSTL_ATOMIC_CRITICAL_SECTION__) && (defined(__WSTL_GCC__) || defined(__WSTL_CLANG__)) && defined(__ATOMIC_SEQ_CST)
+    #define __WSTL_HAS_ATOMIC_BUILTINS__
+#endif
+
 // Pragma diagnostic macros
 
 #ifdef __WSTL_CLANG__
@@ -0,0 +1,64 @@
+#include <doctest.h>
+#include <wstl/Deque.hpp>
+
+namespace {
+    // Non-trivially relocatable element that records whether it has been destroyed
+    struct Tracked {
+        static const unsigned Alive = 0xA11BEU;
+        static const unsigned Dead = 0xDEADU;
+
+        int Value;
+        unsigned State;
+
+        Tracked() : Value(0), State(Alive) {}
+        Tracked(int value) : Value(value), State(Alive) {}
+        Tracked(const Tracked& other) : Value(other.Value), State(Alive) {}
+        ~Tracked() { State = Dead; }
+
+        Tracked& operator=(const Tracked& other) {
+            Value = other.Value;
+            State = Alive;
+            return *this;
+        }
+    };
+
+    template<typename Container>
+    bool Intact(const Container& container, int count) {
+        if(static_cast<int>(container.Size()) != count) return false;
+
+        for(int i = 0; i < count; ++i) {
+            if(container[static_cast<size_t>(i)].State != Tracked::Alive) return false;
+            if(container[static_cast<size_t>(i)].Value != i) return false;
+        }
+
+        return true;
+    }
+}
+
+TEST_CASE("Deque inserting or erasing nothing in the middle leaves the elements intact") {
+    wstl::Deque<Tracked, 16> deque;
+
+    // Start in the middle of the buffer so the elements wrap around its end
+    for(int i = 0; i < 12; ++i) deque.PushBack(Tracked(0));
+    for(int i = 0; i < 12; ++i) deque.PopFront();
+    for(int i = 0; i < 8; ++i) deque.PushBack(Tracked(i));
+
+    SUBCASE("count and value") {
+        wstl::Deque<Tracked, 16>::Iterator position = deque.Insert(deque.Begin() + 3, 0, Tracked(42));
+        CHECK(position == deque.Begin() + 3);
+        CHECK(Intact(deque, 8));
+    }
+
+    SUBCASE("empty range") {
+        const Tracked source[1] = { Tracked(42) };
+        wstl::Deque<Tracked, 16>::Iterator position = deque.Insert(deque.Begin() + 3, source, source);
+        CHECK(position == deque.Begin() + 3);
+        CHECK(Intact(deque, 8));
+    }
+
+    SUBCASE("empty erase") {
+        wstl::Deque<Tracked, 16>::Iterator position = deque.Erase(deque.Begin() + 3, deque.Begin() + 3);
+        CHECK(position == deque.Begin() + 3);
+        CHECK(Intact(deque, 8));
+    }
+}
@@ -0,0 +1,127 @@
+#include <doctest.h>
+#include <wstl/Execution.hpp>
+#include <wstl/WorkStealingPool.hpp>
+
+#ifdef __WSTL_PARALLEL__
+#include <pthread.h>
+#include <sched.h>
+
+namespace {
+    const size_t ValueCount = 1 << 18;
+
+    typedef wstl::WorkStealingPool<2> Pool;
+
+    // Marks the thread that runs worker 1 of the pool
+    thread_local bool OnWorker = false;
+
+    wstl::Atomic<bool> WorkerStarted(false);
+    wstl::Atomic<size_t> WorkerCalls(0);
+    bool CallerWaited = false;
+
+    void Yield() {
+        sched_yield();
+    }
+
+    void* RunWorker(void* pool) {
+        OnWorker = true;
+        WorkerStarted.Store(true);
+        static_cast<Pool*>(pool)->Work(1);
+
+        return wstl::NullPointer;
+    }
+
+    // Starts worker 1 and installs the pool as the backend for its lifetime
+    class PoolScope {
+    public:
+        PoolScope() : m_Pool(&Yield) {
+            WorkerStarted.Store(false);
+            WorkerCalls.Store(0);
+            CallerWaited = false;
+
+            pthread_create(&m_Thread, wstl::NullPointer, &RunWorker, &m_Pool);
+            while(!WorkerStarted.Load()) sched_yield();
+
+            wstl::SetParallelBackend(&m_Pool);
+        }
+
+        ~PoolScope() {
+            wstl::SetParallelBackend(wstl::NullPointer);
+            m_Pool.Stop();
+            pthread_join(m_Thread, wstl::NullPointer);
+        }
+
+    private:
+        Pool m_Pool;
+        pthread_t m_Thread;
+    };
+
+    // Counts calls on the worker, the calling thread waits for the first one so a short run
+    // cannot finish before the worker gets to steal a task
+    void CountCall() {
+        if(OnWorker) {
+            WorkerCalls.FetchAdd(1, wstl::MEMORY_ORDER_RELAXED);
+            return;
+        }
+
+        if(CallerWaited) return;
+        for(long i = 0; i < 1000000 && WorkerCalls.Load() == 0; ++i) sched_yield();
+        CallerWaited = true;
+    }
+
+    struct CountingLess {
+        bool operator()(unsigned a, unsigned b) const {
+            CountCall();
+            return a < b;
+        }
+    };
+
+    struct CountingPlus {
+        unsigned operator()(unsigned a, unsigned b) const {
+            CountCall();
+            return a + b;
+        }
+    };
+
+    unsigned Values[ValueCount];
+
+    void Fill() {
+        unsigned state = 12345U;
+
+        for(size_t i = 0; i < ValueCount; ++i) {
+            state = state * 1103515245U + 12345U;
+            Values[i] = state >> 8;
+        }
+    }
+}
+
+TEST_CASE("Parallel Sort runs part of the work on a worker") {
+    Fill();
+
+    {
+        PoolScope scope;
+        wstl::Sort(wstl::execution::Parallel, Values, Values + ValueCount, CountingLess());
+    }
+
+    bool sorted = true;
+    for(size_t i = 1; i < ValueCount; ++i) sorted = sorted && !(Values[i] < Values[i - 1]);
+
+    CHECK(sorted);
+    CHECK(WorkerCalls.Load() > 0);
+}
+
+TEST_CASE("Parallel Reduce runs part of the work on a worker") {
+    Fill();
+
+    unsigned expected = 0;
+    for(size_t i = 0; i < ValueCount; ++i) expected += Values[i];
+
+    unsigned sum = 0;
+    {
+        PoolScope scope;
+        sum = wstl::Reduce(wstl::execution::Parallel, Values, Values + ValueCount, 0U, CountingPlus());
+    }
+
+    CHECK(sum == expected);
+    CHECK(WorkerCalls.Load() > 0);
+}
+#endif
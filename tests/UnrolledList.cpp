@@ -0,0 +1,66 @@
+#include <doctest.h>
+#include <wstl/UnrolledList.hpp>
+
+TEST_CASE("UnrolledList inserting a copy of its own element") {
+    wstl::UnrolledList<int, 4, 16> list;
+    for(int i = 0; i < 3; ++i) list.PushBack(i);
+
+    // The element is shifted within its node to make room before it
+    wstl::UnrolledList<int, 4, 16>::Iterator source = list.Begin();
+    ++source;
+    ++source;
+
+    wstl::UnrolledList<int, 4, 16>::Iterator position = list.Begin();
+    ++position;
+
+    list.Insert(position, *source);
+
+    const int expected[4] = { 0, 2, 1, 2 };
+    int i = 0;
+    for(wstl::UnrolledList<int, 4, 16>::Iterator it = list.Begin(); it != list.End(); ++it, ++i) {
+        REQUIRE(i < 4);
+        CHECK(*it == expected[i]);
+    }
+
+    CHECK(i == 4);
+}
+
+TEST_CASE("UnrolledList inserting several elements returns the first of them") {
+    wstl::UnrolledList<int, 4, 16> list;
+    for(int i = 1; i <= 3; ++i) list.PushBack(i);
+
+    // The second insertion splits the full node of the first one
+    wstl::UnrolledList<int, 4, 16>::Iterator inserted = list.Insert(wstl::Next(list.Begin(), 2), 2, 7);
+
+    CHECK(inserted == wstl::Next(list.Begin(), 2));
+    CHECK(*inserted == 7);
+    CHECK(*wstl::Next(inserted, 2) == 3);
+
+    const int source[5] = { 8, 9, 10, 11, 12 };
+    inserted = list.Insert(wstl::Next(list.Begin(), 1), source, source + 5);
+
+    CHECK(inserted == wstl::Next(list.Begin(), 1));
+    CHECK(*inserted == 8);
+}
+
+TEST_CASE("UnrolledList splicing within itself packs the nodes when too few are free") {
+    wstl::UnrolledList<int, 4, 20> list;
+    for(int i = 0; i < 8; ++i) list.PushBack(i);
+
+    // Split both full nodes, leaving 2 of the 6 nodes free
+    list.Insert(wstl::Next(list.Begin(), 2), 20);
+    list.Insert(wstl::Next(list.Begin(), 7), 21);
+    REQUIRE(list.NodeCount() == 4);
+
+    // Every boundary lies inside a node, so the splice needs 3 spare nodes
+    list.Splice(wstl::Next(list.Begin(), 1), list, wstl::Next(list.Begin(), 4), wstl::Next(list.Begin(), 6));
+
+    const int expected[10] = { 0, 3, 4, 1, 20, 2, 5, 21, 6, 7 };
+    int i = 0;
+    for(wstl::UnrolledList<int, 4, 20>::Iterator it = list.Begin(); it != list.End(); ++it, ++i) {
+        REQUIRE(i < 10);
+        CHECK(*it == expected[i]);
+    }
+
+    CHECK(i == 10);
+}
@@ -0,0 +1,92 @@
+#include <doctest.h>
+#include <wstl/Vector.hpp>
+#include <stdlib.h>
+
+namespace {
+    // Non-trivially relocatable element that records whether it has been destroyed
+    struct Tracked {
+        static const unsigned Alive = 0xA11BEU;
+        static const unsigned Dead = 0xDEADU;
+
+        int Value;
+        unsigned State;
+
+        Tracked() : Value(0), State(Alive) {}
+        Tracked(int value) : Value(value), State(Alive) {}
+        Tracked(const Tracked& other) : Value(other.Value), State(Alive) {}
+        ~Tracked() { State = Dead; }
+
+        Tracked& operator=(const Tracked& other) {
+            Value = other.Value;
+            State = Alive;
+            return *this;
+        }
+    };
+
+    template<typename Container>
+    bool Intact(const Container& container, int count) {
+        if(static_cast<int>(container.Size()) != count) return false;
+
+        for(int i = 0; i < count; ++i) {
+            if(container[static_cast<size_t>(i)].State != Tracked::Alive) return false;
+            if(container[static_cast<size_t>(i)].Value != i) return false;
+        }
+
+        return true;
+    }
+
+    // Allocator that counts the blocks it has handed out and not yet got back
+    class CountingAllocator : public wstl::Allocator {
+    public:
+        int Live;
+
+        CountingAllocator() : Live(0) {}
+
+        void* Allocate(size_t size) {
+            ++Live;
+            return malloc(size);
+        }
+
+        void Free(void* address) {
+            if(address) --Live;
+            free(address);
+        }
+    };
+}
+
+TEST_CASE("Vector inserting nothing in the middle leaves the elements intact") {
+    wstl::Vector<Tracked, 16> vector;
+    for(int i = 0; i < 8; ++i) vector.PushBack(Tracked(i));
+
+    SUBCASE("count and value") {
+        wstl::Vector<Tracked, 16>::Iterator position = vector.Insert(vector.Begin() + 3, 0, Tracked(42));
+        CHECK(position == vector.Begin() + 3);
+        CHECK(Intact(vector, 8));
+    }
+
+    SUBCASE("empty range") {
+        const Tracked source[1] = { Tracked(42) };
+        wstl::Vector<Tracked, 16>::Iterator position = vector.Insert(vector.Begin() + 3, source, source);
+        CHECK(position == vector.Begin() + 3);
+        CHECK(Intact(vector, 8));
+    }
+}
+
+TEST_CASE("Allocated vectors own separate blocks") {
+    CountingAllocator allocator;
+
+    {
+        wstl::allocated::Vector<int> source(allocator, 2);
+        for(int i = 0; i < 8; ++i) source.PushBack(i);
+
+        wstl::allocated::Vector<int> copy(source, allocator, 2);
+        wstl::allocated::Vector<int> moved(wstl::Move(copy), allocator, 2);
+
+        CHECK(source.Size() == 8);
+        CHECK(moved.Size() == 8);
+        CHECK(moved[7] == 7);
+        CHECK(allocator.Live == 3);
+    }
+
+    CHECK(allocator.Live == 0);
+}